@@ -23,7 +23,7 @@ cleanup()
     curl -s -X PUT "http://localhost:9200/wow_packets/_settings" \
         -H "Content-Type: application/json" -d '{"refresh_interval": "5s"}' > /dev/null
 
-    rm -rf "$CSV_DIR"/*.csv "$SSTABLE_OUT"/*
+    rm -rf "$CSV_DIR"/*.csv "$CSV_DIR"/*.rows "$SSTABLE_OUT"/*
     touch "$SSTABLE_OUT/.gitkeep"
 }
 trap cleanup EXIT
@@ -35,7 +35,10 @@ echo ">>>>> BULK LOAD PIPELINE <<<<<" > pipeline.log
 time {
     ./build/PktParser "$PKT_PATH" --export ${PARSER_VERSION:+--parser-version "$PARSER_VERSION"}
     ./utils/run_sstable.sh "$CSV_DIR" "$SSTABLE_OUT" 2>&1 | tee -a pipeline.log
-    sstableloader -d 127.0.0.1 "$SSTABLE_OUT/wow_packets/packets/" 2>&1 | tee -a pipeline.log
+    # packets/ and/or packet_blocks/ depending on STORAGE_LAYOUT
+    for table_dir in "$SSTABLE_OUT"/wow_packets/*/; do
+        sstableloader -d 127.0.0.1 "$table_dir" 2>&1 | tee -a pipeline.log
+    done
 }
 
 curl -s -X POST "http://localhost:9200/wow_packets/_forcemerge?max_num_segments=1&wait_for_completion=false" > /dev/null
@@ -17,7 +17,6 @@ RAM_GB="${2:-3}"
 
 CSV_DIR="./csv"
 SSTABLE_OUT="./sstable_output"
-MAX_BATCH_BYTES=$(( RAM_GB * 1024 * 1024 * 1024 ))
 TMPFS_SIZE="${RAM_GB}G"
 
 mkdir -p "$CSV_DIR" "$SSTABLE_OUT"
@@ -57,8 +56,10 @@ wait_for_signal()
     return 1
 }
 
-# collect all .pkt files
-find "$PKT_DIR" -name "*.pkt" | sort > /tmp/pkt_all_files.txt
+# collect all .pkt files (recursively) and pack them into batches that fit the tmpfs, largest first
+rm -f /tmp/pkt_batch_*
+./build/PktParser --plan "$PKT_DIR" $(( RAM_GB * 1024 )) /tmp/pkt_batch_
+cat /tmp/pkt_batch_* 2>/dev/null > /tmp/pkt_all_files.txt || true
 TOTAL_FILES=$(wc -l < /tmp/pkt_all_files.txt)
 
 if [ "$TOTAL_FILES" -eq 0 ]; then
@@ -66,26 +67,6 @@ if [ "$TOTAL_FILES" -eq 0 ]; then
     exit 0
 fi
 
-# split into batches by total file size
-BATCH_NUM=0
-CURRENT_SIZE=0
-BATCH_FILE="/tmp/pkt_batch_$(printf '%03d' $BATCH_NUM)"
-> "$BATCH_FILE"
-
-while IFS= read -r pkt_file; do
-    file_size=$(stat -c%s "$pkt_file")
-
-    if (( CURRENT_SIZE + file_size > MAX_BATCH_BYTES && CURRENT_SIZE > 0 )); then
-        BATCH_NUM=$((BATCH_NUM + 1))
-        BATCH_FILE="/tmp/pkt_batch_$(printf '%03d' $BATCH_NUM)"
-        > "$BATCH_FILE"
-        CURRENT_SIZE=0
-    fi
-
-    echo "$pkt_file" >> "$BATCH_FILE"
-    CURRENT_SIZE=$((CURRENT_SIZE + file_size))
-done < /tmp/pkt_all_files.txt
-
 BATCHES=(/tmp/pkt_batch_*)
 echo "Found $TOTAL_FILES .pkt files -> ${#BATCHES[@]} batches (max ~${RAM_GB}GB each)"
 
@@ -119,9 +100,11 @@ for batch_file in "${BATCHES[@]}"; do
 
     if wait_for_signal; then
         # load into Cassandra
-        sstableloader -d 127.0.0.1 "$SSTABLE_OUT/wow_packets/packets/"
+        for table_dir in "$SSTABLE_OUT"/wow_packets/*/; do
+            sstableloader -d 127.0.0.1 "$table_dir"
+        done
     else
-        echo ">>> Skipping sstableloader for batch $BATCH_NUM (SSTable gen failed)"
+        echo ">>> Skipping sstableloader for batch $BATCH_NUM (SSTable gen failed), its captures are not ingested, re-run them"
     fi
 
     # flush tmpfs for next batch
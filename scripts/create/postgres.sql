@@ -26,5 +26,17 @@ CREATE INDEX IF NOT EXISTS idx_opcodes_parser ON opcodes(parser_version);
 CREATE INDEX IF NOT EXISTS idx_opcodes_name ON opcodes(opcode_name);
 CREATE INDEX IF NOT EXISTS idx_opcodes_direction ON opcodes(direction);
 
+CREATE TABLE IF NOT EXISTS zstd_dictionaries
+(
+    dict_id INTEGER PRIMARY KEY,
+    parser_version VARCHAR(50) NOT NULL,
+    blob_format VARCHAR(10) NOT NULL,
+    opcode_value INTEGER NOT NULL,
+    dict_data BYTEA NOT NULL,
+    sample_count INTEGER NOT NULL,
+    created_at TIMESTAMPTZ DEFAULT NOW(),
+    UNIQUE(parser_version, blob_format, opcode_value)
+);
+
 GRANT ALL PRIVILEGES ON ALL TABLES IN SCHEMA public TO wowparser;
 GRANT ALL PRIVILEGES ON ALL SEQUENCES IN SCHEMA public TO wowparser;
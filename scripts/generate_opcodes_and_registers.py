@@ -47,6 +47,30 @@ namespace PktParser::{namespace}::Opcodes
     with open(output_path, 'w') as f:
         f.write(header)
 
+def generate_opcode_table(namespace: str, opcodes: list, output_path: Path):
+    table = f"""// AUTO-GENERATED from database - DO NOT EDIT
+// parser version: {namespace}
+// total opcodes: {len(opcodes)}
+#pragma once
+
+#include "Common/OpcodeEntry.h"
+
+namespace PktParser::{namespace}
+{{
+    inline constexpr Common::OpcodeEntry OPCODE_TABLE[] =
+    {{
+"""
+
+    for name, value, direction in opcodes:
+        table += f"        {{ 0x{value:X}, \"{name}\", \"{direction}\" }},\n"
+
+    table += """    };
+}
+"""
+
+    with open(output_path, 'w') as f:
+        f.write(table)
+
 def generate_registration_file(namespace: str, opcodes: list, opcode_count: int, reserve_size: int, output_path: Path):
     registration = f"""// AUTO-GENERATED from database - DO NOT EDIT
 // parser version: {namespace}
@@ -104,10 +128,12 @@ def generate_parser_files(parser_version: str, version_dir: str):
         reserve_size = 2 ** math.ceil(math.log2(opcode_count)) if opcode_count > 0 else 16
         
         generate_opcodes_header(parser_version, opcodes, output_dir / "Opcodes.h")
+        generate_opcode_table(parser_version, opcodes, output_dir / "OpcodeTable.h")
         generate_registration_file(parser_version, opcodes, opcode_count, reserve_size, output_dir / "RegisterHandlers.inl")
         
         print(f"Generated for {parser_version}:")
         print(f"  Opcodes.h ({opcode_count} opcodes)")
+        print(f"  OpcodeTable.h ({opcode_count} entries)")
         print(f"  RegisterHandlers.inl ({opcode_count} registrations)")
         print(f"  Output: {output_dir}")
         
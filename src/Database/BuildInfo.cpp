@@ -1,6 +1,9 @@
 #include "pchdef.h"
 #include "BuildInfo.h"
 #include "Config.h"
+#include "EmbeddedMetadata.h"
+#include "MetadataSnapshot.h"
+#include "OpcodeCache.h"
 
 namespace PktParser::Db
 {
@@ -10,51 +13,145 @@ namespace PktParser::Db
         return instance;
     }
 
-    void BuildInfo::Initialize()
+    BuildInfo::~BuildInfo()
     {
-        try
         {
-            std::string connStr = Config::GetPostgresConnectionString();
+            std::lock_guard<std::mutex> lock(_asyncMutex);
+            _asyncStop = true;
+        }
+        _asyncCondition.notify_all();
+
+        if (_refresher.joinable())
+            _refresher.join();
+    }
+
+    void BuildInfo::Initialize(bool forceRefresh /*= false*/)
+    {
+        std::lock_guard<std::mutex> lock(_refreshMutex);
 
-            pqxx::connection conn(connStr);
-            pqxx::work txn(conn);
+        std::string snapshotPath = Config::GetMetadataSnapshotPath();
+        std::chrono::seconds maxAge = Config::GetMetadataSnapshotMaxAge();
+        std::optional<MetadataSnapshot> snapshot = MetadataSnapshot::Load(snapshotPath);
 
-            std::string query = "SELECT build_number, patch_version, parser_version "
-                                "FROM builds "
-                                "WHERE parser_version IS NOT NULL";
-            
-            pqxx::result res = txn.exec(query);
-            
-            _mappings.clear();
-            
-            for (auto const& row : res)
+        // postgres is only touched to refresh a stale snapshot, without one the embedded tables serve until --refresh-metadata,
+        // so boxes that can't reach the database start without waiting on it
+        bool wantsRefresh = maxAge.count() > 0 && snapshot && !snapshot->IsFresh(maxAge);
+        if (forceRefresh || wantsRefresh)
+        {
+            try
+            {
+                snapshot = MetadataSnapshot::FetchFromDatabase();
+                if (snapshot->Save(snapshotPath))
+                    LOG("Refreshed metadata snapshot '{}' from database", snapshotPath);
+            }
+            catch (std::exception const& e)
             {
-                BuildMapping mapping;
-                mapping.BuildNumber = row["build_number"].as<uint32>();
-                mapping.PatchVersion = row["patch_version"].as<std::string>();
-                mapping.ParserVersion = row["parser_version"].as<std::string>();
-                
-                _mappings[mapping.BuildNumber] = mapping;
+                LOG("WARN: Metadata refresh from database failed, using {}: {}", snapshot ? "stale snapshot" : "embedded tables", e.what());
             }
+        }
+
+        Publish(snapshot);
+    }
 
-            LOG("Loaded {} supported builds from database", _mappings.size());
+    bool BuildInfo::Refresh()
+    {
+        std::lock_guard<std::mutex> lock(_refreshMutex);
+
+        std::optional<MetadataSnapshot> snapshot;
+        try
+        {
+            snapshot = MetadataSnapshot::FetchFromDatabase();
+            snapshot->Save(Config::GetMetadataSnapshotPath());
         }
         catch (std::exception const& e)
         {
-            LOG("ERROR: Failed to load build info from database: {}", e.what());
-            throw;
+            LOG("WARN: Metadata refresh from database failed, keeping current mappings: {}", e.what());
+            return false;
+        }
+
+        Publish(snapshot);
+        return true;
+    }
+
+    void BuildInfo::RefreshAsync(std::function<void(bool)> onDone /*= {}*/)
+    {
+        {
+            std::lock_guard<std::mutex> lock(_asyncMutex);
+            if (_asyncStop)
+                return;
+
+            if (onDone)
+                _waiting.push_back(std::move(onDone));
+            _asyncQueued = true;
+
+            if (!_refresher.joinable())
+                _refresher = std::thread(&BuildInfo::RefresherThread, this);
+        }
+        _asyncCondition.notify_one();
+    }
+
+    void BuildInfo::RefresherThread()
+    {
+        while (true)
+        {
+            std::vector<std::function<void(bool)>> waiting;
+            {
+                std::unique_lock<std::mutex> lock(_asyncMutex);
+                _asyncCondition.wait(lock, [this] { return _asyncQueued || _asyncStop; });
+                if (_asyncStop)
+                    break;
+
+                _asyncQueued = false;
+                waiting.swap(_waiting);
+            }
+
+            bool refreshed = Refresh();
+            for (auto const& onDone : waiting)
+                onDone(refreshed);
         }
+
+        // shutting down with callers still waiting, they get an answer rather than nothing
+        std::vector<std::function<void(bool)>> waiting;
+        {
+            std::lock_guard<std::mutex> lock(_asyncMutex);
+            waiting.swap(_waiting);
+        }
+        for (auto const& onDone : waiting)
+            onDone(false);
+    }
+
+    void BuildInfo::Publish(std::optional<MetadataSnapshot> const& snapshot)
+    {
+        auto mappings = std::make_shared<MappingTable>();
+
+        for (EmbeddedBuild const& build : EmbeddedMetadata::GetBuilds())
+            (*mappings)[build.BuildNumber] = BuildMapping{ build.BuildNumber, build.PatchVersion, build.ParserVersion };
+
+        if (snapshot)
+        {
+            for (BuildMapping const& mapping : snapshot->Builds)
+                (*mappings)[mapping.BuildNumber] = mapping;
+
+            // opcodes go first so a newly visible build never resolves to a version without them
+            OpcodeCache::Instance().ApplySnapshot(*snapshot);
+        }
+
+        size_t count = mappings->size();
+        _mappings.store(std::move(mappings), std::memory_order_release);
+
+        LOG("Loaded {} supported builds ({})", count, snapshot ? "snapshot" : "embedded");
     }
 
     std::optional<BuildMapping> BuildInfo::GetMapping(uint32 buildNumber) const
     {
-        if (auto it = _mappings.find(buildNumber); it != _mappings.end())
+        std::shared_ptr<MappingTable const> mappings = _mappings.load(std::memory_order_acquire);
+        if (auto it = mappings->find(buildNumber); it != mappings->end())
             return it->second;
         return std::nullopt;
     }
 
     bool BuildInfo::IsSupported(uint32 buildNumber) const
     {
-        return _mappings.find(buildNumber) != _mappings.end();
+        return _mappings.load(std::memory_order_acquire)->contains(buildNumber);
     }
 }
\ No newline at end of file
@@ -4,9 +4,18 @@
 #include <string>
 #include <optional>
 #include <unordered_map>
+#include <memory>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <thread>
+#include <vector>
 
 namespace PktParser::Db
 {
+    struct MetadataSnapshot;
+
     struct BuildMapping
     {
         uint32 BuildNumber;
@@ -17,14 +26,34 @@ namespace PktParser::Db
     class BuildInfo
     {
     private:
+        using MappingTable = std::unordered_map<uint32, BuildMapping>;
+
         BuildInfo() = default;
+        ~BuildInfo();
         
-        std::unordered_map<uint32, BuildMapping> _mappings;
+        // readers grab the current table without locking, refreshes publish a new one (RCU)
+        std::atomic<std::shared_ptr<MappingTable const>> _mappings{ std::make_shared<MappingTable const>() };
+        std::mutex _refreshMutex;
+
+        // RefreshAsync: one background thread, requests made while a refresh is pending share it
+        std::mutex _asyncMutex;
+        std::condition_variable _asyncCondition;
+        std::vector<std::function<void(bool)>> _waiting;
+        bool _asyncQueued = false;
+        bool _asyncStop = false;
+        std::thread _refresher;
+
+        void Publish(std::optional<MetadataSnapshot> const& snapshot);
+        void RefresherThread();
 
     public:
         static BuildInfo& Instance();
 
-        void Initialize();
+        void Initialize(bool forceRefresh = false);
+        bool Refresh();
+        // Refresh off the calling thread, for event loops; onDone gets its result on the refresher thread
+        void RefreshAsync(std::function<void(bool)> onDone = {});
+
         std::optional<BuildMapping> GetMapping(uint32 BuildNumber) const;
         bool IsSupported(uint32 BuildNumber) const;
     };
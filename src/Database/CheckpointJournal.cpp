@@ -0,0 +1,109 @@
+#include "pchdef.h"
+#include "CheckpointJournal.h"
+
+#include <fstream>
+#include <sstream>
+#include <unistd.h>
+
+namespace PktParser::Db
+{
+    CheckpointJournal::CheckpointJournal(std::string path, bool resume)
+        : _path{ std::move(path) }, _file{ nullptr }
+    {
+        if (resume)
+        {
+            Load();
+            Compact();
+        }
+
+        _file = fopen(_path.c_str(), resume ? "a" : "w");
+        if (!_file)
+            throw ParseException{ "Cannot open checkpoint journal " + _path };
+    }
+
+    CheckpointJournal::~CheckpointJournal()
+    {
+        if (_file)
+            fclose(_file);
+    }
+
+    void CheckpointJournal::Load()
+    {
+        std::ifstream in(_path);
+        if (!in.is_open())
+            return;
+
+        std::string line;
+        while (std::getline(in, line))
+        {
+            // the last line of a crashed run may be cut anywhere, only whole lines count
+            if (in.eof())
+                break;
+
+            std::istringstream fields(line);
+            std::string kind;
+            std::string fileId;
+            FileCheckpoint checkpoint;
+            if (!(fields >> kind >> fileId >> checkpoint.NextPacket >> checkpoint.ParsedCount >> checkpoint.SkippedCount >> checkpoint.FailedCount))
+                continue;
+            if (kind != "progress" && kind != "done")
+                continue;
+
+            checkpoint.Done = kind == "done";
+            _loaded[fileId] = checkpoint;
+        }
+    }
+
+    void CheckpointJournal::Compact()
+    {
+        // write aside and rename, a crash here leaves the old journal in place
+        std::string tmpPath = _path + ".tmp";
+        {
+            std::ofstream out(tmpPath, std::ios::trunc);
+            if (!out.is_open())
+                return;
+
+            for (auto const& [fileId, checkpoint] : _loaded)
+                out << (checkpoint.Done ? "done" : "progress") << ' ' << fileId << ' ' << checkpoint.NextPacket << ' '
+                    << checkpoint.ParsedCount << ' ' << checkpoint.SkippedCount << ' ' << checkpoint.FailedCount << '\n';
+
+            if (!out.good())
+                return;
+        }
+
+        std::error_code ec;
+        std::filesystem::rename(tmpPath, _path, ec);
+        if (ec)
+            LOG("WARN: Cannot compact checkpoint journal '{}': {}", _path, ec.message());
+    }
+
+    std::optional<FileCheckpoint> CheckpointJournal::Find(std::string const& fileId) const
+    {
+        auto itr = _loaded.find(fileId);
+        if (itr == _loaded.end())
+            return std::nullopt;
+        return itr->second;
+    }
+
+    void CheckpointJournal::Append(char const* kind, std::string const& fileId, FileCheckpoint const& checkpoint)
+    {
+        std::string line = fmt::format("{} {} {} {} {} {}\n", kind, fileId, checkpoint.NextPacket, checkpoint.ParsedCount,
+            checkpoint.SkippedCount, checkpoint.FailedCount);
+
+        std::lock_guard<std::mutex> lock(_mutex);
+        fwrite(line.data(), 1, line.size(), _file);
+        // a record a crash can take back would let a resume skip packets that never landed
+        if (fflush(_file) != 0 || fdatasync(fileno(_file)) != 0)
+            LOG("WARN: Cannot sync checkpoint journal '{}'", _path);
+    }
+
+    void CheckpointJournal::RecordProgress(std::string const& fileId, FileCheckpoint const& checkpoint)
+    {
+        Append("progress", fileId, checkpoint);
+    }
+
+    void CheckpointJournal::RecordDone(std::string const& fileId, FileCheckpoint const& checkpoint)
+    {
+        Append("done", fileId, checkpoint);
+    }
+}
@@ -0,0 +1,57 @@
+#pragma once
+
+#include "Misc/Define.h"
+
+#include <cstdio>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+
+namespace PktParser::Db
+{
+    struct FileCheckpoint
+    {
+        uint32 NextPacket = 0;      // every packet before it is acknowledged by all sinks
+        size_t ParsedCount = 0;
+        size_t SkippedCount = 0;
+        size_t FailedCount = 0;
+        bool Done = false;
+    };
+
+    /*
+     * append-only log of what the sinks have acknowledged, one line per record:
+     *   progress <file id> <next packet> <parsed> <skipped> <failed>
+     *   done <file id> <packets> <parsed> <skipped> <failed>
+     * the last line for a file wins, a line torn by a crash is ignored, every record is synced before Record* returns
+     */
+    class CheckpointJournal
+    {
+    private:
+        std::string _path;
+        std::FILE* _file;
+        std::mutex _mutex;
+        std::unordered_map<std::string, FileCheckpoint> _loaded;
+
+        void Load();
+        // one line per file, so a journal resumed over and over doesn't keep every batch it ever recorded
+        void Compact();
+        void Append(char const* kind, std::string const& fileId, FileCheckpoint const& checkpoint);
+
+    public:
+        // resume: what an earlier run recorded is loaded and appended to, otherwise the journal starts over
+        CheckpointJournal(std::string path, bool resume);
+        ~CheckpointJournal();
+
+        CheckpointJournal(CheckpointJournal const&) = delete;
+        CheckpointJournal& operator=(CheckpointJournal const&) = delete;
+
+        // as of when the journal was opened, records made since are not looked up
+        std::optional<FileCheckpoint> Find(std::string const& fileId) const;
+        size_t GetLoadedCount() const { return _loaded.size(); }
+        std::string const& GetPath() const { return _path; }
+
+        void RecordProgress(std::string const& fileId, FileCheckpoint const& checkpoint);
+        void RecordDone(std::string const& fileId, FileCheckpoint const& checkpoint);
+    };
+}
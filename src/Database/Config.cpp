@@ -7,6 +7,24 @@
 
 namespace PktParser::Db
 {
+    namespace
+    {
+        Common::BlobFormat GetBlobFormat(char const* var)
+        {
+            char const* value = std::getenv(var);
+            if (!value)
+                return Common::BlobFormat::Json;
+
+            std::optional<Common::BlobFormat> format = Common::ParseBlobFormat(value);
+            if (!format)
+            {
+                LOG("WARNING: {}={} is not json or binary, using json", var, value);
+                return Common::BlobFormat::Json;
+            }
+            return *format;
+        }
+    }
+
     std::once_flag Config::_initFlag;
 
     void Config::LoadEnvImpl()
@@ -44,13 +62,15 @@ namespace PktParser::Db
         char const* db = std::getenv("POSTGRES_DB");
         char const* user = std::getenv("POSTGRES_USER");
         char const* pass = std::getenv("POSTGRES_PASSWORD");
+        char const* timeout = std::getenv("POSTGRES_CONNECT_TIMEOUT");
 
         std::ostringstream oss;
         oss << "host=" << (host ? host : "localhost")
             << " port=" << (port ? port : "5432")
             << " dbname=" << (db ? db : "wow_metadata")
             << " user=" << (user ? user : "wowparser")
-            << " password=" << (pass ? pass : "");
+            << " password=" << (pass ? pass : "")
+            << " connect_timeout=" << (timeout ? timeout : "5");
 
         return oss.str();
     }
@@ -68,4 +88,147 @@ namespace PktParser::Db
         char const* keyspace = std::getenv("CASSANDRA_KEYSPACE");
         return keyspace ? keyspace : "wow_packets";
     }
+
+    std::string Config::GetMetadataSnapshotPath()
+    {
+        LoadEnv();
+        char const* path = std::getenv("METADATA_SNAPSHOT_PATH");
+        return path ? path : "metadata.snapshot";
+    }
+
+    std::chrono::seconds Config::GetMetadataSnapshotMaxAge()
+    {
+        LoadEnv();
+        char const* hours = std::getenv("METADATA_SNAPSHOT_MAX_AGE_HOURS");
+        return std::chrono::hours(hours ? std::atoi(hours) : 24);
+    }
+
+    std::chrono::seconds Config::GetMetadataRefreshInterval()
+    {
+        LoadEnv();
+        char const* minutes = std::getenv("METADATA_REFRESH_INTERVAL_MINUTES");
+        return std::chrono::minutes(minutes ? std::atoi(minutes) : 60);
+    }
+
+    Common::BlobFormat Config::GetCsvBlobFormat()
+    {
+        LoadEnv();
+        return GetBlobFormat("CSV_BLOB_FORMAT");
+    }
+
+    Common::BlobFormat Config::GetCassandraBlobFormat()
+    {
+        LoadEnv();
+        return GetBlobFormat("CASSANDRA_BLOB_FORMAT");
+    }
+
+    size_t Config::GetZstdDictionarySamples()
+    {
+        LoadEnv();
+        char const* samples = std::getenv("ZSTD_DICT_SAMPLES");
+        return samples ? std::strtoull(samples, nullptr, 10) : 2000;
+    }
+
+    StorageLayout Config::GetStorageLayout()
+    {
+        LoadEnv();
+        char const* layout = std::getenv("STORAGE_LAYOUT");
+        if (!layout || std::string_view(layout) == "packet")
+            return StorageLayout::Packet;
+        if (std::string_view(layout) == "block")
+            return StorageLayout::Block;
+
+        LOG("WARNING: STORAGE_LAYOUT={} is not packet or block, using packet", layout);
+        return StorageLayout::Packet;
+    }
+
+    size_t Config::GetParquetRowGroupRows()
+    {
+        LoadEnv();
+        char const* rows = std::getenv("PARQUET_ROW_GROUP_ROWS");
+        size_t value = rows ? std::strtoull(rows, nullptr, 10) : 0;
+        return value ? value : 262144;
+    }
+
+    Misc::ParquetCompression Config::GetParquetCompression()
+    {
+        LoadEnv();
+        char const* name = std::getenv("PARQUET_COMPRESSION");
+        if (!name)
+            return Misc::ParquetCompression::Zstd;
+
+        if (std::optional<Misc::ParquetCompression> compression = Misc::ParseParquetCompression(name))
+            return *compression;
+
+        LOG("WARNING: PARQUET_COMPRESSION={} is not zstd or none, using zstd", name);
+        return Misc::ParquetCompression::Zstd;
+    }
+
+    uint32 Config::GetArchiveFramePackets()
+    {
+        LoadEnv();
+        char const* packets = std::getenv("ARCHIVE_FRAME_PACKETS");
+        uint32 value = packets ? static_cast<uint32>(std::strtoul(packets, nullptr, 10)) : 0;
+        return value ? value : 1000;
+    }
+
+    size_t Config::GetParseThreads()
+    {
+        LoadEnv();
+        char const* threads = std::getenv("PARSE_THREADS");
+        return threads ? std::strtoull(threads, nullptr, 10) : 0;
+    }
+
+    std::chrono::milliseconds Config::GetBatchTarget()
+    {
+        LoadEnv();
+        char const* ms = std::getenv("BATCH_TARGET_MS");
+        int32 value = ms ? std::atoi(ms) : 0;
+        return std::chrono::milliseconds(value > 0 ? value : 200);
+    }
+
+    size_t Config::GetEsSinkThreads()
+    {
+        LoadEnv();
+        char const* threads = std::getenv("ES_SINK_THREADS");
+        size_t value = threads ? std::strtoull(threads, nullptr, 10) : 0;
+        return value ? value : 2;
+    }
+
+    size_t Config::GetEsSinkQueue()
+    {
+        LoadEnv();
+        char const* bulks = std::getenv("ES_SINK_QUEUE");
+        size_t value = bulks ? std::strtoull(bulks, nullptr, 10) : 0;
+        return value ? value : 8;
+    }
+
+    Misc::AffinityPolicy Config::GetAffinityPolicy()
+    {
+        LoadEnv();
+        char const* name = std::getenv("AFFINITY");
+        if (!name)
+            return Misc::AffinityPolicy::None;
+
+        if (std::optional<Misc::AffinityPolicy> policy = Misc::ParseAffinityPolicy(name))
+            return *policy;
+
+        LOG("WARNING: AFFINITY={} is not none, cores or numa, using none", name);
+        return Misc::AffinityPolicy::None;
+    }
+
+    std::string Config::GetCheckpointPath()
+    {
+        LoadEnv();
+        char const* path = std::getenv("CHECKPOINT_PATH");
+        return path ? path : "checkpoint.journal";
+    }
+
+    size_t Config::GetSortedRowsBytes()
+    {
+        LoadEnv();
+        char const* mb = std::getenv("SORTED_ROWS_MB");
+        size_t value = mb ? std::strtoull(mb, nullptr, 10) : 0;
+        return (value ? value : 256) * 1024 * 1024;
+    }
 }
\ No newline at end of file
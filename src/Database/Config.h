@@ -1,6 +1,12 @@
 #pragma once
 
 #include <mutex>
+#include <chrono>
+
+#include "Common/RecordFormat.h"
+#include "PacketBlock.h"
+#include "Misc/ParquetWriter.h"
+#include "Misc/CpuTopology.h"
 
 namespace PktParser::Db
 {
@@ -15,5 +21,24 @@ namespace PktParser::Db
         static std::string GetPostgresConnectionString();
         static std::string GetCassandraHost();
         static std::string GetCassandraKeyspace();
+        static std::string GetMetadataSnapshotPath();
+        static std::chrono::seconds GetMetadataSnapshotMaxAge();
+        static std::chrono::seconds GetMetadataRefreshInterval();
+        static Common::BlobFormat GetCsvBlobFormat();
+        static Common::BlobFormat GetCassandraBlobFormat();
+        static size_t GetZstdDictionarySamples();
+        static StorageLayout GetStorageLayout();
+        static size_t GetParquetRowGroupRows();
+        static Misc::ParquetCompression GetParquetCompression();
+        static uint32 GetArchiveFramePackets();
+        static size_t GetParseThreads();
+        static std::chrono::milliseconds GetBatchTarget();
+        static size_t GetEsSinkThreads();
+        static size_t GetEsSinkQueue();
+        static Misc::AffinityPolicy GetAffinityPolicy();
+        // empty disables the journal
+        static std::string GetCheckpointPath();
+        // all sorted row writers of a process together
+        static size_t GetSortedRowsBytes();
     };
 }
@@ -11,7 +11,8 @@ namespace PktParser::Db
 {
 
     Database::Database()
-        : _cluster{ nullptr }, _session{ nullptr }, _preparedInsert{ nullptr }, _preparedMetadata{ nullptr }, _timestampGen{ nullptr }
+        : _cluster{ nullptr }, _session{ nullptr }, _preparedInsert{ nullptr }, _preparedMetadata{ nullptr }, _preparedBlockInsert{ nullptr },
+        _preparedMetadataLookup{ nullptr }, _layout{ Config::GetStorageLayout() }, _timestampGen{ nullptr }
     {
         _cluster = cass_cluster_new();
         
@@ -54,6 +55,7 @@ namespace PktParser::Db
         _callbackContext.poolMutex = &_poolMutex;
         _callbackContext.pool = &_pool;
         _callbackContext.preparedStmt = _preparedInsert;
+        _callbackContext.preparedBlockStmt = _preparedBlockInsert;
         _callbackContext.session = _session;
     }
 
@@ -68,6 +70,12 @@ namespace PktParser::Db
 
         if (_preparedMetadata)
             cass_prepared_free(_preparedMetadata);
+
+        if (_preparedBlockInsert)
+            cass_prepared_free(_preparedBlockInsert);
+
+        if (_preparedMetadataLookup)
+            cass_prepared_free(_preparedMetadataLookup);
         
         CassFuture* closeFuture = cass_session_close(_session);
         cass_future_wait(closeFuture);
@@ -150,6 +158,45 @@ namespace PktParser::Db
 
         _preparedMetadata = const_cast<CassPrepared*>(cass_future_get_prepared(prepareFuture));
         cass_future_free(prepareFuture);
+
+        prepareFuture = cass_session_prepare(_session, "SELECT file_id FROM wow_packets.file_metadata WHERE file_id = ?");
+        cass_future_wait(prepareFuture);
+
+        if (cass_future_error_code(prepareFuture) != CASS_OK)
+        {
+            char const* msg;
+            size_t msgLen;
+            cass_future_error_message(prepareFuture, &msg, &msgLen);
+            cass_future_free(prepareFuture);
+            throw ParseException{ std::string("Cannot prepare metadata lookup: ") + std::string(msg, msgLen) };
+        }
+
+        _preparedMetadataLookup = const_cast<CassPrepared*>(cass_future_get_prepared(prepareFuture));
+        cass_future_free(prepareFuture);
+
+        // packet_blocks only has to exist when it is actually written to
+        if (_layout != StorageLayout::Block)
+            return;
+
+        char const* blockQuery =
+            "INSERT INTO wow_packets.packet_blocks "
+            "(build, file_id, bucket, block_start, packet_count, block) "
+            "VALUES (?, ?, ?, ?, ?, ?)";
+
+        prepareFuture = cass_session_prepare(_session, blockQuery);
+        cass_future_wait(prepareFuture);
+
+        if (cass_future_error_code(prepareFuture) != CASS_OK)
+        {
+            char const* msg;
+            size_t msgLen;
+            cass_future_error_message(prepareFuture, &msg, &msgLen);
+            cass_future_free(prepareFuture);
+            throw ParseException{ std::string("Cannot prepare block insert: ") + std::string(msg, msgLen) };
+        }
+
+        _preparedBlockInsert = const_cast<CassPrepared*>(cass_future_get_prepared(prepareFuture));
+        cass_future_free(prepareFuture);
     }
 
     void Database::StoreFileMetadata(CassUuid const& fileId, std::string const& srcFile, uint32 build, int64 startTime, uint32 pktCount)
@@ -177,22 +224,60 @@ namespace PktParser::Db
         cass_statement_free(stmt);
     }
 
-    void Database::StorePacket(Reader::PktHeader const& header, uint32 build, uint32 pktNumber, std::string const& json, std::vector<uint8> const& rawData, CassUuid const& fileId, ZSTD_CCtx* cctx)
+    bool Database::ClaimFile(CassUuid const& fileId, bool checkStored)
     {
-        while (_pendingCount.load(std::memory_order_relaxed) >= MAX_PENDING)
-            std::this_thread::sleep_for(std::chrono::microseconds(100));
+        {
+            std::lock_guard<std::mutex> lock(_claimedMutex);
+            if (!_claimed.emplace(fileId.time_and_version, fileId.clock_seq_and_node).second)
+                return false;
+        }
 
-        _pendingCount.fetch_add(1, std::memory_order_relaxed);
+        if (!checkStored)
+            return true;
+
+        CassStatement* stmt = cass_prepared_bind(_preparedMetadataLookup);
+        cass_statement_bind_uuid(stmt, 0, fileId);
+
+        CassFuture* future = cass_session_execute(_session, stmt);
+        cass_future_wait(future);
+
+        bool known = false;
+        if (cass_future_error_code(future) == CASS_OK)
+        {
+            CassResult const* result = cass_future_get_result(future);
+            known = cass_result_row_count(result) > 0;
+            cass_result_free(result);
+        }
+        else
+        {
+            char const* msg;
+            size_t msgLen;
+            cass_future_error_message(future, &msg, &msgLen);
+            LOG("WARN: Cannot look up file metadata, ingesting anyway: {}", std::string(msg, msgLen));
+        }
+
+        cass_future_free(future);
+        cass_statement_free(stmt);
+        return !known;
+    }
+
+    void Database::StorePacket(Reader::PktHeader const& header, uint32 build, uint32 pktNumber, std::string_view payload, std::span<uint8 const> rawData, CassUuid const& fileId, ZSTD_CCtx* cctx, ZSTD_CDict const* dict,
+        SinkAck* ack /*= nullptr*/)
+    {
+        ReservePending();
 
         InsertData* data = AcquireInsertData();
+        data->ack = ack;
+        if (ack)
+            ack->Acquire();
 
         try
         {
-            if (!json.empty())
+            if (!payload.empty())
             {
-                std::span<uint8 const> compressed = Misc::CompressJson(json, cctx);
+                std::span<uint8 const> compressed = Misc::CompressJson(payload, cctx, dict);
                 data->compressedJson.assign(compressed.begin(), compressed.end());
-                _totalBytes.fetch_add(json.size(), std::memory_order_relaxed);
+                _totalBytes.fetch_add(payload.size(), std::memory_order_relaxed);
             }
             else
             {
@@ -204,19 +289,25 @@ namespace PktParser::Db
 
             data->build = build;
             data->fileId = fileId;
-            data->bucket = pktNumber / 10000;
+            data->bucket = pktNumber / PACKETS_PER_BUCKET;
             data->packetNumber = pktNumber;
             data->direction = static_cast<uint8>(header.direction);
             data->packetLen = header.packetLength - 4;
             data->opcode = header.opcode;
             data->timestamp = static_cast<int64>(header.timestamp * 1000);
+            data->isBlock = false;
             data->context = &_callbackContext;
         }
         catch (std::exception const& e)
         {
             LOG("Failed to prepare packet {}: {}", data->packetNumber, e.what());
             _callbackContext.ReleaseToPool(data);
-            _pendingCount.fetch_sub(1, std::memory_order_relaxed);
+            _callbackContext.ReleasePending();
+            if (ack)
+            {
+                ack->Fail();
+                ack->Release();
+            }
             return;
         }
 
@@ -229,11 +320,65 @@ namespace PktParser::Db
         cass_statement_free(stmt);
     }
 
+    void Database::StoreBlock(uint32 build, CassUuid const& fileId, uint32 bucket, uint32 blockStart, uint32 packetCount, std::span<uint8 const> block, size_t uncompressedSize,
+        SinkAck* ack /*= nullptr*/)
+    {
+        ReservePending();
+
+        InsertData* data = AcquireInsertData();
+        data->ack = ack;
+        if (ack)
+            ack->Acquire();
+
+        data->compressedJson.assign(block.begin(), block.end());
+        data->build = build;
+        data->fileId = fileId;
+        data->bucket = bucket;
+        data->packetNumber = blockStart;
+        data->packetCount = packetCount;
+        data->isBlock = true;
+        data->context = &_callbackContext;
+
+        _totalBytes.fetch_add(uncompressedSize, std::memory_order_relaxed);
+        _totalCompressedBytes.fetch_add(block.size(), std::memory_order_relaxed);
+
+        CassStatement* stmt = cass_prepared_bind(_preparedBlockInsert);
+        BindInsertStatement(stmt, data);
+
+        CassFuture* future = cass_session_execute(_session, stmt);
+        cass_future_set_callback(future, InsertCallback, data);
+
+        cass_statement_free(stmt);
+    }
+
+    void Database::ReservePending()
+    {
+        size_t pending = _pendingCount.load(std::memory_order_relaxed);
+        if (pending < MAX_PENDING && _pendingCount.compare_exchange_weak(pending, pending + 1, std::memory_order_relaxed))
+            return;
+
+        // full: park until a callback frees a slot instead of polling
+        auto start = std::chrono::steady_clock::now();
+        while (true)
+        {
+            if (pending >= MAX_PENDING)
+            {
+                _pendingCount.wait(pending, std::memory_order_relaxed);
+                pending = _pendingCount.load(std::memory_order_relaxed);
+            }
+            else if (_pendingCount.compare_exchange_weak(pending, pending + 1, std::memory_order_relaxed))
+                break;
+        }
+
+        auto waited = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+        _stallMicros.fetch_add(static_cast<uint64>(waited.count()), std::memory_order_relaxed);
+    }
+
     void Database::RetryInsert(InsertData* data)
     {
         CallbackContext* ctx = data->context;
 
-        CassStatement* stmt = cass_prepared_bind(ctx->preparedStmt);
+        CassStatement* stmt = cass_prepared_bind(data->isBlock ? ctx->preparedBlockStmt : ctx->preparedStmt);
         BindInsertStatement(stmt, data);
 
         CassFuture* retryFuture = cass_session_execute(ctx->session, stmt);
@@ -250,10 +395,15 @@ namespace PktParser::Db
 
         cass_future_free(future);
 
+        SinkAck* ack = insertData->ack;
+
         if (rc == CASS_OK)
         {
             ctx->totalInserted->fetch_add(1, std::memory_order_relaxed);
-            ctx->pendingCount->fetch_sub(1, std::memory_order_relaxed);
+            // acknowledged before the slot is freed, so Flush returning means every ack has been released
+            if (ack)
+                ack->Release();
+            ctx->ReleasePending();
             ctx->ReleaseToPool(insertData);
             return;
         }
@@ -274,7 +424,12 @@ namespace PktParser::Db
 
         // total failure
         ctx->totalFailed->fetch_add(1, std::memory_order_relaxed);
-        ctx->pendingCount->fetch_sub(1, std::memory_order_relaxed);
+        if (ack)
+        {
+            ack->Fail();
+            ack->Release();
+        }
+        ctx->ReleasePending();
         ctx->ReleaseToPool(insertData);
 
         LOG("INSERT PERMANENTLY FAILED [Packet {}] after {} attempts: {}", failedPacketNumber, attemptCount, errDesc);
@@ -282,6 +437,17 @@ namespace PktParser::Db
 
     void Database::BindInsertStatement(CassStatement* stmt, InsertData const* data)
     {
+        if (data->isBlock)
+        {
+            cass_statement_bind_int32(stmt, 0, data->build);
+            cass_statement_bind_uuid(stmt, 1, data->fileId);
+            cass_statement_bind_int32(stmt, 2, data->bucket);
+            cass_statement_bind_int32(stmt, 3, data->packetNumber);
+            cass_statement_bind_int32(stmt, 4, data->packetCount);
+            cass_statement_bind_bytes(stmt, 5, reinterpret_cast<const cass_byte_t*>(data->compressedJson.data()), data->compressedJson.size());
+            return;
+        }
+
         cass_statement_bind_int32(stmt, 0, data->build);
         cass_statement_bind_uuid(stmt, 1, data->fileId);
         cass_statement_bind_int32(stmt, 2, data->bucket);
@@ -311,4 +477,10 @@ namespace PktParser::Db
         std::lock_guard<std::mutex> lock(*poolMutex);
         pool->push_back(data);
     }
+
+    void CallbackContext::ReleasePending()
+    {
+        pendingCount->fetch_sub(1, std::memory_order_relaxed);
+        pendingCount->notify_one();
+    }
 }
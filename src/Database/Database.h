@@ -1,12 +1,15 @@
 #pragma once
 
 #include "Reader/PktFileReader.h"
+#include "PacketBlock.h"
+#include "SinkAck.h"
 
 #include <cassandra.h>
 #include <string>
 #include <atomic>
 #include <vector>
 #include <mutex>
+#include <set>
 #include <zstd.h>
 
 namespace PktParser::Db
@@ -22,9 +25,12 @@ namespace PktParser::Db
 		std::mutex* poolMutex;
         std::vector<InsertData*>* pool;
         CassPrepared* preparedStmt;
+        CassPrepared* preparedBlockStmt;
 		CassSession* session;
 
 		void ReleaseToPool(InsertData* data);
+		// frees an in-flight slot and wakes a worker waiting in ReservePending
+		void ReleasePending();
 	};
 
 	struct InsertData
@@ -32,14 +38,17 @@ namespace PktParser::Db
 		int32 build;
 		CassUuid fileId;
 		int32 bucket;
-		int32 packetNumber;
+		int32 packetNumber;		// first packet of the block when isBlock
 		uint8 direction;
 		int32 packetLen;
 		int32 opcode;
 		int64 timestamp;
 		std::vector<uint8> compressedJson;
+		bool isBlock{};
+		int32 packetCount{};
 
 		CallbackContext* context;
+		SinkAck* ack{};			// released once the insert succeeds or is given up on
 		int32 retryCount{};
 	};
 	
@@ -52,6 +61,9 @@ namespace PktParser::Db
 		CassSession* _session;
 		CassPrepared* _preparedInsert;
 		CassPrepared* _preparedMetadata;
+		CassPrepared* _preparedBlockInsert;
+		CassPrepared* _preparedMetadataLookup;
+		StorageLayout _layout;
 		CassTimestampGen* _timestampGen;
 
 		std::atomic<size_t> _totalInserted{ 0 };
@@ -59,12 +71,18 @@ namespace PktParser::Db
 		std::atomic<size_t> _pendingCount{ 0 };
 		std::atomic<size_t> _totalBytes{ 0 };
 		std::atomic<size_t> _totalCompressedBytes{ 0 };
+		std::atomic<uint64> _stallMicros{ 0 };		// time workers waited for an in-flight slot
+
+		// file ids taken by this process, catches the same capture twice in one run before its metadata exists
+		std::mutex _claimedMutex;
+		std::set<std::pair<uint64, uint64>> _claimed;
 
 		static constexpr size_t MAX_PENDING = 8192;
 
 		CallbackContext _callbackContext;
 
 		InsertData* AcquireInsertData();
+		void ReservePending();
 		void PrepareStmts();
 
 		static void InsertCallback(CassFuture* future, void* data);
@@ -76,14 +94,24 @@ namespace PktParser::Db
 		~Database();
 		
 		CassSession* GetSession() const { return _session; }
+		StorageLayout GetStorageLayout() const { return _layout; }
 		
 		void StoreFileMetadata(CassUuid const& fileId, std::string const& srcFile, uint32 build, int64 startTime, uint32 pktCount);
-		void StorePacket(Reader::PktHeader const& header, uint32 build, uint32 pktNumber, std::string const& json, std::vector<uint8> const& rawData, CassUuid const& fileId, ZSTD_CCtx* cctx);
+		// false if this run already took the file or, with checkStored, file_metadata has it; a failed lookup lets it through
+		bool ClaimFile(CassUuid const& fileId, bool checkStored);
+		void StorePacket(Reader::PktHeader const& header, uint32 build, uint32 pktNumber, std::string_view payload, std::span<uint8 const> rawData, CassUuid const& fileId, ZSTD_CCtx* cctx, ZSTD_CDict const* dict,
+			SinkAck* ack = nullptr);
+		// one already compressed PacketBlockBuilder output, only valid with STORAGE_LAYOUT=block
+		void StoreBlock(uint32 build, CassUuid const& fileId, uint32 bucket, uint32 blockStart, uint32 packetCount, std::span<uint8 const> block, size_t uncompressedSize,
+			SinkAck* ack = nullptr);
 		
 		void Flush();
 
 		size_t GetTotalInserted() const { return _totalInserted.load(); }
 		size_t GetTotalFailed() const { return _totalFailed.load(); }
 		size_t GetTotalBytes() const { return _totalBytes.load(); }
+		size_t GetPendingCount() const { return _pendingCount.load(std::memory_order_relaxed); }
+		size_t GetMaxPending() const { return MAX_PENDING; }
+		uint64 GetStallMicros() const { return _stallMicros.load(std::memory_order_relaxed); }
 	};
 }
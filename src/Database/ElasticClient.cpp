@@ -9,13 +9,17 @@ namespace PktParser::Db
 {
     thread_local ElasticClient::ThreadContext ElasticClient::t_ctx;
 
-    ElasticClient::ElasticClient(std::string const& baseURL /*= "http://localhost:9200"*/)
-        : _baseURL{ baseURL }
+    ElasticClient::ElasticClient(size_t senderThreads, size_t queueDepth, std::string const& baseURL /*= "http://localhost:9200"*/)
+        : _baseURL{ baseURL }, _sendRing{ queueDepth }
     {
+        for (size_t i = 0; i < std::max<size_t>(senderThreads, 1); ++i)
+            _senders.emplace_back(&ElasticClient::SenderThread, this);
     }
 
     ElasticClient::~ElasticClient()
     {
+        Drain();
+
         LOG("Elasticsearch shutdown: {} indexed, {} failed, {:.2f} MB written", _totalIndexed.load(), _totalFailed.load(),
             _totalBytes.load() / (1024.0 * 1024.0));
     }
@@ -30,35 +34,84 @@ namespace PktParser::Db
             
             t_ctx.headers = nullptr;
             t_ctx.headers = curl_slist_append(t_ctx.headers, "Content-Type: application/x-ndjson");
-            t_ctx.buffer.reserve(BULK_RESERVE);
         }
         return t_ctx.curl;
     }
 
+    void ElasticClient::ReleaseCurl()
+    {
+        if (t_ctx.headers)
+        {
+            curl_slist_free_all(t_ctx.headers);
+            t_ctx.headers = nullptr;
+        }
+
+        if (t_ctx.curl)
+        {
+            curl_easy_cleanup(t_ctx.curl);
+            t_ctx.curl = nullptr;
+        }
+    }
+
+    void ElasticClient::Drain()
+    {
+        _sendRing.Close();
+        for (auto& sender : _senders)
+            sender.join();
+        _senders.clear();
+    }
+
+    void ElasticClient::Enqueue(std::pmr::string&& payload, int32 count, std::vector<SinkAck*> acks /*= {}*/)
+    {
+        auto start = std::chrono::steady_clock::now();
+        std::vector<SinkAck*> held = acks;
+        // refused only after Drain, nobody is left to answer for the documents
+        if (!_sendRing.Push(Bulk{ std::move(payload), count, std::move(acks) }))
+        {
+            _totalFailed.fetch_add(count, std::memory_order_relaxed);
+            for (SinkAck* ack : held)
+            {
+                ack->Fail();
+                ack->Release();
+            }
+        }
+        auto waited = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+        _stallMicros.fetch_add(static_cast<uint64>(waited.count()), std::memory_order_relaxed);
+    }
+
+    void ElasticClient::SenderThread()
+    {
+        Bulk bulk;
+        while (_sendRing.Pop(bulk))
+        {
+            bool sent = SendBulk(std::move(bulk.Payload), bulk.Count);
+            for (SinkAck* ack : bulk.Acks)
+            {
+                if (!sent)
+                    ack->Fail();
+                ack->Release();
+            }
+        }
+
+        ReleaseCurl();
+    }
+
     size_t ElasticClient::WriteCallback(char* ptr, size_t size, size_t nmemb, std::string* data)
     {
         data->append(ptr, size * nmemb);
         return size * nmemb;
     }
 
-    void ElasticClient::BufferDocument(std::string const& docStr, std::string const& fileId, uint32 pktNumber)
+    void ElasticClient::FlushBulkIfFull()
     {
-        fmt::format_to(std::back_inserter(t_ctx.buffer), R"({{"index":{{"_index":"wow_packets","_id":"{}_{}"}}}})", fileId, pktNumber);
-        t_ctx.buffer += '\n';
-        t_ctx.buffer.append(docStr);
-        t_ctx.buffer += '\n';
-        t_ctx.documentCount++;
+        if (t_ctx.documentCount < BULK_SIZE)
+            return;
 
-        if (t_ctx.documentCount >= BULK_SIZE)
-        {
-            std::string payload = std::move(t_ctx.buffer);
-            int32 count = t_ctx.documentCount;
-            t_ctx.buffer.clear();
-            t_ctx.buffer.reserve(BULK_RESERVE);
-            t_ctx.documentCount = 0;
+        std::pmr::string payload = t_ctx.bulk.TakeString();
+        int32 count = t_ctx.documentCount;
+        t_ctx.documentCount = 0;
 
-            SendBulk(std::move(payload), count);
-        }
+        Enqueue(std::move(payload), count);
     }
 
     void ElasticClient::WriteBaseDocument(JsonWriter& doc, Reader::PktHeader const& header, char const* opcodeName, 
@@ -74,29 +127,80 @@ namespace PktParser::Db
         doc.WriteInt("timestamp", static_cast<int64>(header.timestamp));
     }
     
-    void ElasticClient::IndexPacket(PktHeader const& header, char const* opcodeName, uint32 build, uint32 pktNumber,
+    bool ElasticClient::WriteBulkEntry(JsonWriter& bulk, PktHeader const& header, char const* opcodeName, uint32 build, uint32 pktNumber,
         ParseResult const& result, std::string const& srcFile, std::string const& fileId)
     {
         if (!result.searchFields)
+            return false;
+
+        bulk.Raw(R"({"index":{"_index":"wow_packets","_id":")");
+        bulk.Raw(fileId);
+        bulk.Raw("_");
+        bulk.RawUInt(pktNumber);
+        bulk.Raw(R"("}})");
+        bulk.EndLine();
+
+        bulk.BeginObject();
+        WriteBaseDocument(bulk, header, opcodeName, build, pktNumber, srcFile, fileId);
+        result.searchFields->WriteTo(bulk);
+        bulk.EndObject();
+        bulk.EndLine();
+        return true;
+    }
+
+    void ElasticClient::IndexPacket(PktHeader const& header, char const* opcodeName, uint32 build, uint32 pktNumber,
+        ParseResult const& result, std::string const& srcFile, std::string const& fileId)
+    {
+        // action line and document go straight into the thread's bulk body
+        JsonWriter& bulk = t_ctx.bulk;
+        if (t_ctx.documentCount == 0)
+            bulk.Reserve(BULK_RESERVE);
+
+        if (!WriteBulkEntry(bulk, header, opcodeName, build, pktNumber, result, srcFile, fileId))
             return;
 
-        JsonWriter doc(512);
-        doc.BeginObject();
-        WriteBaseDocument(doc, header, opcodeName, build, pktNumber, srcFile, fileId);
+        t_ctx.documentCount++;
+        FlushBulkIfFull();
+    }
+
+    void ElasticClient::IndexStaged(std::string_view lines, int32 count, SinkAck* ack /*= nullptr*/)
+    {
+        if (count == 0)
+            return;
+
+        if (_orderedCount == 0)
+            _ordered.Reserve(BULK_RESERVE);
+        _ordered.Raw(lines);
+        _orderedCount += count;
+
+        if (ack)
+        {
+            ack->Acquire();
+            _orderedAcks.push_back(ack);
+        }
 
-        result.searchFields->WriteTo(doc);
+        if (_orderedCount >= BULK_SIZE || ack)
+            FlushStaged();
+    }
 
-        doc.EndObject();
-        BufferDocument(doc.GetString(), fileId, pktNumber);
+    void ElasticClient::FlushStaged()
+    {
+        if (_orderedCount == 0)
+            return;
+
+        int32 count = _orderedCount;
+        _orderedCount = 0;
+        Enqueue(_ordered.TakeString(), count, std::move(_orderedAcks));
+        _orderedAcks.clear();
     }
 
-    void ElasticClient::SendBulk(std::string&& payload, int32 count)
+    bool ElasticClient::SendBulk(std::pmr::string&& payload, int32 count)
     {
         CURL* curl = GetCurl();
         if (!curl)
         {
             _totalFailed.fetch_add(count, std::memory_order_relaxed);
-            return;
+            return false;
         }
 
         std::string url = _baseURL + "/_bulk";
@@ -131,7 +235,7 @@ namespace PktParser::Db
             {
                 LOG("ES bulk req failed: {}", curl_easy_strerror(res));
                 _totalFailed.fetch_add(count, std::memory_order_relaxed);
-                return;
+                return false;
             }
 
             long httpCode = 0;
@@ -140,42 +244,37 @@ namespace PktParser::Db
             if (httpCode >= 200 && httpCode < 300)
             {
                 _totalIndexed.fetch_add(count, std::memory_order_relaxed);
-                return;
+                return true;
             }
 
             if (httpCode != 429)
             {
                 LOG("ES bulk response error (HTTP {}): {}", httpCode, response.substr(0, 200));
                 _totalFailed.fetch_add(count, std::memory_order_relaxed);
-                return;
+                return false;
             }
         }
 
         LOG("ES bulk failed after {} retries", MAX_RETRIES);
         _totalFailed.fetch_add(count, std::memory_order_relaxed);
+        return false;
     }
 
-    void ElasticClient::FlushThread()
+    void ElasticClient::FlushThread(SinkAck* ack /*= nullptr*/)
     {
-        if (!t_ctx.buffer.empty())
-        {
-            std::string payload = std::move(t_ctx.buffer);
-            int32 count = t_ctx.documentCount;
-            t_ctx.buffer.clear();
-            t_ctx.documentCount = 0;
-            SendBulk(std::move(payload), count);
-        }
+        if (t_ctx.bulk.Size() == 0)
+            return;
 
-        if (t_ctx.headers)
-        {
-            curl_slist_free_all(t_ctx.headers);
-            t_ctx.headers = nullptr;
-        }
+        std::pmr::string payload = t_ctx.bulk.TakeString();
+        int32 count = t_ctx.documentCount;
+        t_ctx.documentCount = 0;
 
-        if (t_ctx.curl)
+        std::vector<SinkAck*> acks;
+        if (ack)
         {
-            curl_easy_cleanup(t_ctx.curl);
-            t_ctx.curl = nullptr;
+            ack->Acquire();
+            acks.push_back(ack);
         }
+        Enqueue(std::move(payload), count, std::move(acks));
     }
 }
\ No newline at end of file
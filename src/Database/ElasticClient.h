@@ -4,10 +4,14 @@
 #include "Reader/PktFileReader.h"
 #include "ParseResult.h"
 #include "JsonWriter.h"
+#include "Misc/MpmcRing.h"
+#include "SinkAck.h"
 
 #include <string>
 #include <mutex>
 #include <atomic>
+#include <thread>
+#include <vector>
 #include <curl/curl.h>
 
 namespace PktParser::Db
@@ -24,36 +28,72 @@ namespace PktParser::Db
         std::atomic<size_t> _totalFailed{ 0 };
 
         std::atomic<size_t> _totalBytes{ 0 };
+
+        // parse workers only build bulk bodies, the blocking _bulk calls happen on the sender threads
+        struct Bulk
+        {
+            std::pmr::string Payload;
+            int32 Count;
+            std::vector<SinkAck*> Acks;     // released once the bulk is answered
+        };
+        Misc::MpmcRing<Bulk> _sendRing;
+        std::vector<std::thread> _senders;
+        std::atomic<uint64> _stallMicros{ 0 };      // time workers spent waiting for room in _sendRing
         
         struct ThreadContext
         {
             CURL* curl = nullptr;
             curl_slist* headers = nullptr;
-            std::string buffer;
+            Common::JsonWriter bulk;
             int32 documentCount = 0;
         };
         static thread_local ThreadContext t_ctx;
 
+        // ordered mode: one bulk body filled in commit order, so the bulks are the same on every run
+        Common::JsonWriter _ordered;
+        int32 _orderedCount = 0;
+        std::vector<SinkAck*> _orderedAcks;
+
         CURL* GetCurl();
-        void SendBulk(std::string&& payload, int32 count);
+        void ReleaseCurl();
+        void Enqueue(std::pmr::string&& payload, int32 count, std::vector<SinkAck*> acks = {});
+        void SenderThread();
+        // false if the documents were given up on
+        bool SendBulk(std::pmr::string&& payload, int32 count);
         static size_t WriteCallback(char* ptr, size_t size, size_t nmemb, std::string* data);
 
-        void BufferDocument(std::string const& docStr, std::string const& fileId, uint32 pktNumber);
+        void FlushBulkIfFull();
         static void WriteBaseDocument(Common::JsonWriter& doc, Reader::PktHeader const& header, char const* opcodeName,
             uint32 build, uint32 pktNumber, std::string const& srcFile, std::string const& fileId);
         
     public:
-        explicit ElasticClient(std::string const& baseURL = "http://localhost:9200");
+        ElasticClient(size_t senderThreads, size_t queueDepth, std::string const& baseURL = "http://localhost:9200");
         ~ElasticClient();
         
         void IndexPacket(Reader::PktHeader const& header, char const* opcodeName, uint32 build, uint32 pktNumber,
             Common::ParseResult const& result, std::string const& srcFile, std::string const& fileId);
 
-        void FlushThread();
+        // action line and document into any bulk body, false if the packet has nothing to index
+        static bool WriteBulkEntry(Common::JsonWriter& bulk, Reader::PktHeader const& header, char const* opcodeName, uint32 build, uint32 pktNumber,
+            Common::ParseResult const& result, std::string const& srcFile, std::string const& fileId);
+
+        // ordered mode: entries written with WriteBulkEntry, appended by one thread at a time
+        // with an ack the bulk goes out right away and holds it until answered
+        void IndexStaged(std::string_view lines, int32 count, SinkAck* ack = nullptr);
+        void FlushStaged();
+
+        // queues what the calling worker has left, call before it exits
+        // with an ack the bulk holds it until answered, used to close out a batch
+        void FlushThread(SinkAck* ack = nullptr);
+        // sends everything queued and stops the senders, every ack handed in is released by the time it returns
+        void Drain();
 
         size_t GetTotalIndexed() const { return _totalIndexed.load(); }
         size_t GetTotalFailed() const { return _totalFailed.load(); }
         size_t GetTotalBytes() const { return _totalBytes.load(); }
         int32 GetMaxBulk() const { return BULK_SIZE; }
+        size_t GetQueueDepth() const { return _sendRing.GetSize(); }
+        size_t GetQueueCapacity() const { return _sendRing.GetCapacity(); }
+        uint64 GetStallMicros() const { return _stallMicros.load(std::memory_order_relaxed); }
     };
 }
@@ -0,0 +1,45 @@
+#include "pchdef.h"
+#include "EmbeddedMetadata.h"
+
+#include "V11_2_0_62213/OpcodeTable.h"
+#include "V11_2_5_63506/OpcodeTable.h"
+#include "V11_2_7_64632/OpcodeTable.h"
+#include "V11_2_7_64877/OpcodeTable.h"
+#include "V12_0_0_65390/OpcodeTable.h"
+#include "V12_0_1_65818/OpcodeTable.h"
+
+namespace PktParser::Db
+{
+    static constexpr EmbeddedBuild BUILD_TABLE[] =
+    {
+        { 62213, "11.2.0", "V11_2_0_62213" },
+        { 63506, "11.2.5", "V11_2_5_63506" },
+        { 64632, "11.2.7", "V11_2_7_64632" },
+        { 64877, "11.2.7", "V11_2_7_64877" },
+        { 65390, "12.0.0", "V12_0_0_65390" },
+        { 65818, "12.0.1", "V12_0_1_65818" },
+    };
+
+    std::span<EmbeddedBuild const> EmbeddedMetadata::GetBuilds()
+    {
+        return BUILD_TABLE;
+    }
+
+    std::span<Common::OpcodeEntry const> EmbeddedMetadata::GetOpcodes(std::string_view parserVersion)
+    {
+        if (parserVersion == "V11_2_0_62213")
+            return V11_2_0_62213::OPCODE_TABLE;
+        if (parserVersion == "V11_2_5_63506")
+            return V11_2_5_63506::OPCODE_TABLE;
+        if (parserVersion == "V11_2_7_64632")
+            return V11_2_7_64632::OPCODE_TABLE;
+        if (parserVersion == "V11_2_7_64877")
+            return V11_2_7_64877::OPCODE_TABLE;
+        if (parserVersion == "V12_0_0_65390")
+            return V12_0_0_65390::OPCODE_TABLE;
+        if (parserVersion == "V12_0_1_65818")
+            return V12_0_1_65818::OPCODE_TABLE;
+
+        return {};
+    }
+}
@@ -0,0 +1,25 @@
+#pragma once
+
+#include "Misc/Define.h"
+#include "Common/OpcodeEntry.h"
+
+#include <span>
+#include <string_view>
+
+namespace PktParser::Db
+{
+    struct EmbeddedBuild
+    {
+        uint32 BuildNumber;
+        char const* PatchVersion;
+        char const* ParserVersion;
+    };
+
+    // compiled-in copy of the builds/opcodes tables, Postgres is only needed to refresh them
+    class EmbeddedMetadata
+    {
+    public:
+        static std::span<EmbeddedBuild const> GetBuilds();
+        static std::span<Common::OpcodeEntry const> GetOpcodes(std::string_view parserVersion);
+    };
+}
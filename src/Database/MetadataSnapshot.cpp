@@ -0,0 +1,188 @@
+#include "pchdef.h"
+#include "MetadataSnapshot.h"
+#include "Config.h"
+
+namespace PktParser::Db
+{
+    namespace
+    {
+        template<typename T>
+        void WritePod(std::ofstream& out, T value)
+        {
+            out.write(reinterpret_cast<char const*>(&value), sizeof(T));
+        }
+
+        void WriteStr(std::ofstream& out, std::string const& str)
+        {
+            WritePod<uint16>(out, static_cast<uint16>(str.size()));
+            out.write(str.data(), str.size());
+        }
+
+        template<typename T>
+        T ReadPod(std::ifstream& in)
+        {
+            T value{};
+            if (!in.read(reinterpret_cast<char*>(&value), sizeof(T)))
+                throw ParseException{ "Snapshot truncated" };
+            return value;
+        }
+
+        std::string ReadStr(std::ifstream& in)
+        {
+            std::string str(ReadPod<uint16>(in), '\0');
+            if (!in.read(str.data(), str.size()))
+                throw ParseException{ "Snapshot truncated" };
+            return str;
+        }
+    }
+
+    bool MetadataSnapshot::IsFresh(std::chrono::seconds maxAge) const
+    {
+        int64 now = std::chrono::duration_cast<std::chrono::seconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+        return now - CreatedAt <= maxAge.count();
+    }
+
+    bool MetadataSnapshot::Save(std::string const& path) const
+    {
+        // write aside and rename so a crashed refresh never leaves a torn snapshot
+        std::string tmpPath = path + ".tmp";
+        {
+            std::ofstream out(tmpPath, std::ios::binary | std::ios::trunc);
+            if (!out.is_open())
+            {
+                LOG("WARN: Cannot write metadata snapshot '{}'", tmpPath);
+                return false;
+            }
+
+            WritePod<uint32>(out, MAGIC);
+            WritePod<uint32>(out, FORMAT_VERSION);
+            WritePod<int64>(out, CreatedAt);
+
+            WritePod<uint32>(out, static_cast<uint32>(Builds.size()));
+            for (BuildMapping const& build : Builds)
+            {
+                WritePod<uint32>(out, build.BuildNumber);
+                WriteStr(out, build.PatchVersion);
+                WriteStr(out, build.ParserVersion);
+            }
+
+            WritePod<uint32>(out, static_cast<uint32>(Opcodes.size()));
+            for (auto const& [parserVersion, opcodes] : Opcodes)
+            {
+                WriteStr(out, parserVersion);
+                WritePod<uint32>(out, static_cast<uint32>(opcodes.size()));
+                for (OpcodeInfo const& info : opcodes)
+                {
+                    WritePod<uint32>(out, info.Value);
+                    WriteStr(out, info.Name);
+                    WriteStr(out, info.Direction);
+                }
+            }
+
+            if (!out.good())
+            {
+                LOG("WARN: Failed writing metadata snapshot '{}'", tmpPath);
+                return false;
+            }
+        }
+
+        std::error_code ec;
+        std::filesystem::rename(tmpPath, path, ec);
+        if (ec)
+        {
+            LOG("WARN: Cannot replace metadata snapshot '{}': {}", path, ec.message());
+            return false;
+        }
+
+        return true;
+    }
+
+    std::optional<MetadataSnapshot> MetadataSnapshot::Load(std::string const& path)
+    {
+        std::ifstream in(path, std::ios::binary);
+        if (!in.is_open())
+            return std::nullopt;
+
+        try
+        {
+            if (ReadPod<uint32>(in) != MAGIC || ReadPod<uint32>(in) != FORMAT_VERSION)
+            {
+                LOG("WARN: Ignoring metadata snapshot '{}' (unknown format)", path);
+                return std::nullopt;
+            }
+
+            MetadataSnapshot snapshot;
+            snapshot.CreatedAt = ReadPod<int64>(in);
+
+            // counts come from the file, nothing is sized by them up front, a corrupt one just runs into the end of it
+            uint32 buildCount = ReadPod<uint32>(in);
+            for (uint32 i = 0; i < buildCount; ++i)
+            {
+                BuildMapping build;
+                build.BuildNumber = ReadPod<uint32>(in);
+                build.PatchVersion = ReadStr(in);
+                build.ParserVersion = ReadStr(in);
+                snapshot.Builds.push_back(std::move(build));
+            }
+
+            uint32 versionCount = ReadPod<uint32>(in);
+            for (uint32 i = 0; i < versionCount; ++i)
+            {
+                std::vector<OpcodeInfo>& opcodes = snapshot.Opcodes[ReadStr(in)];
+                uint32 opcodeCount = ReadPod<uint32>(in);
+                for (uint32 j = 0; j < opcodeCount; ++j)
+                {
+                    OpcodeInfo info;
+                    info.Value = ReadPod<uint32>(in);
+                    info.Name = ReadStr(in);
+                    info.Direction = ReadStr(in);
+                    opcodes.push_back(std::move(info));
+                }
+            }
+
+            return snapshot;
+        }
+        catch (std::exception const& e)
+        {
+            LOG("WARN: Ignoring metadata snapshot '{}': {}", path, e.what());
+            return std::nullopt;
+        }
+    }
+
+    MetadataSnapshot MetadataSnapshot::FetchFromDatabase()
+    {
+        MetadataSnapshot snapshot;
+        snapshot.CreatedAt = std::chrono::duration_cast<std::chrono::seconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+
+        pqxx::connection conn(Config::GetPostgresConnectionString());
+        pqxx::work txn(conn);
+
+        pqxx::result builds = txn.exec("SELECT build_number, patch_version, parser_version "
+                                       "FROM builds "
+                                       "WHERE parser_version IS NOT NULL");
+
+        for (auto const& row : builds)
+        {
+            BuildMapping mapping;
+            mapping.BuildNumber = row["build_number"].as<uint32>();
+            mapping.PatchVersion = row["patch_version"].as<std::string>();
+            mapping.ParserVersion = row["parser_version"].as<std::string>();
+            snapshot.Builds.push_back(std::move(mapping));
+        }
+
+        // every version in one round trip instead of a connection per EnsureLoaded
+        pqxx::result opcodes = txn.exec("SELECT parser_version, opcode_value, opcode_name, direction "
+                                        "FROM opcodes");
+
+        for (auto const& row : opcodes)
+        {
+            OpcodeInfo info;
+            info.Value = row["opcode_value"].as<uint32>();
+            info.Name = row["opcode_name"].as<std::string>();
+            info.Direction = row["direction"].as<std::string>();
+            snapshot.Opcodes[row["parser_version"].as<std::string>()].push_back(std::move(info));
+        }
+
+        return snapshot;
+    }
+}
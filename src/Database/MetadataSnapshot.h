@@ -0,0 +1,31 @@
+#pragma once
+
+#include "Misc/Define.h"
+#include "BuildInfo.h"
+#include "OpcodeCache.h"
+
+#include <chrono>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace PktParser::Db
+{
+    // on-disk copy of the builds/opcodes tables as last fetched from Postgres
+    struct MetadataSnapshot
+    {
+        static constexpr uint32 MAGIC = 0x4D544B50; // "PKTM"
+        static constexpr uint32 FORMAT_VERSION = 1;
+
+        int64 CreatedAt = 0;
+        std::vector<BuildMapping> Builds;
+        std::unordered_map<std::string, std::vector<OpcodeInfo>> Opcodes;
+
+        bool IsFresh(std::chrono::seconds maxAge) const;
+        bool Save(std::string const& path) const;
+
+        static std::optional<MetadataSnapshot> Load(std::string const& path);
+        static MetadataSnapshot FetchFromDatabase();
+    };
+}
@@ -1,6 +1,7 @@
 #include "pchdef.h"
 #include "OpcodeCache.h"
-#include "Config.h"
+#include "EmbeddedMetadata.h"
+#include "MetadataSnapshot.h"
 
 namespace PktParser::Db
 {
@@ -12,67 +13,74 @@ namespace PktParser::Db
 
     void OpcodeCache::EnsureLoaded(std::string const& parserVersion)
     {
-        if (_cache.contains(parserVersion))
+        if (IsLoaded(parserVersion))
             return;
 
-        try
+        std::span<Common::OpcodeEntry const> embedded = EmbeddedMetadata::GetOpcodes(parserVersion);
+        if (embedded.empty())
         {
-            std::string connStr = Config::GetPostgresConnectionString();
-            
-            pqxx::connection conn(connStr);
-            pqxx::work txn(conn);
-            
-            std::string query = "SELECT opcode_value, opcode_name, direction "
-                                "FROM opcodes "
-                                "WHERE parser_version = " + txn.quote(parserVersion);
-            
-            pqxx::result res = txn.exec(query);
-            
-            auto& opcodes = _cache[parserVersion];
-            
-            for (auto const& row : res)
-            {
-                OpcodeInfo info;
-                info.Value = row["opcode_value"].as<uint32>();
-                info.Name = row["opcode_name"].as<std::string>();
-                info.Direction = row["direction"].as<std::string>();
-                
-                opcodes[info.Value] = std::move(info);
-            }
-            
-            LOG("Loaded {} opcodes from database for {}", opcodes.size(), parserVersion);
-        }
-        catch (std::exception const& e)
-        {
-            _cache.erase(parserVersion);
-            LOG("ERROR: Failed to load opcodes for {}: {}", parserVersion, e.what());
-            throw;
+            LOG("ERROR: No embedded opcodes for {}", parserVersion);
+            return;
         }
+
+        std::vector<OpcodeInfo> opcodes;
+        opcodes.reserve(embedded.size());
+
+        for (Common::OpcodeEntry const& entry : embedded)
+            opcodes.push_back(OpcodeInfo{ entry.Value, entry.Name, entry.Direction });
+
+        std::lock_guard<std::mutex> lock(_writeMutex);
+
+        // a refresh may have published this version while we were building it
+        std::shared_ptr<LookupTable const> current = _cache.load(std::memory_order_acquire);
+        if (current->contains(parserVersion))
+            return;
+
+        auto next = std::make_shared<LookupTable>(*current);
+        (*next)[parserVersion] = std::make_shared<OpcodeLookup const>(std::move(opcodes));
+        _cache.store(std::move(next), std::memory_order_release);
+
+        LOG("Loaded {} embedded opcodes for {}", embedded.size(), parserVersion);
     }
-    
+
+    void OpcodeCache::ApplySnapshot(MetadataSnapshot const& snapshot)
+    {
+        std::lock_guard<std::mutex> lock(_writeMutex);
+
+        // batches already in flight keep their old lookup alive through their own handle
+        auto next = std::make_shared<LookupTable>(*_cache.load(std::memory_order_acquire));
+        for (auto const& [parserVersion, opcodes] : snapshot.Opcodes)
+            (*next)[parserVersion] = std::make_shared<OpcodeLookup const>(opcodes);
+
+        _cache.store(std::move(next), std::memory_order_release);
+    }
+
+    std::shared_ptr<OpcodeLookup const> OpcodeCache::GetLookup(std::string const& parserVersion) const
+    {
+        std::shared_ptr<LookupTable const> cache = _cache.load(std::memory_order_acquire);
+        auto it = cache->find(parserVersion);
+        if (it == cache->end())
+            return nullptr;
+        return it->second;
+    }
+
     char const* OpcodeCache::GetOpcodeName(std::string const& parserVersion, uint32 opcodeValue) const
     {
-        auto versionIt = _cache.find(parserVersion);
-        if (versionIt == _cache.end())
+        std::shared_ptr<OpcodeLookup const> lookup = GetLookup(parserVersion);
+        if (!lookup)
             return "UNKNOWN_VERSION";
 
-        auto opcodeIt = versionIt->second.find(opcodeValue);
-        if (opcodeIt != versionIt->second.end())
-            return opcodeIt->second.Name.c_str();
-
-        return "UNKNOWN_OPCODE";
+        return lookup->GetName(opcodeValue);
     }
     
     size_t OpcodeCache::GetOpcodeCount(std::string const& parserVersion) const
     {
-        auto it = _cache.find(parserVersion);
-        if (it == _cache.end())
-            return 0;
-        return it->second.size(); 
+        std::shared_ptr<OpcodeLookup const> lookup = GetLookup(parserVersion);
+        return lookup ? lookup->Size() : 0;
     }
 
     bool OpcodeCache::IsLoaded(std::string const& parserVersion) const
     {
-        return _cache.contains(parserVersion);
+        return _cache.load(std::memory_order_acquire)->contains(parserVersion);
     }
 }
\ No newline at end of file
@@ -1,30 +1,36 @@
 #pragma once
 
 #include "Misc/Define.h"
+#include "OpcodeLookup.h"
+
+#include <memory>
+#include <atomic>
+#include <mutex>
 #include <string>
 #include <unordered_map>
 
 namespace PktParser::Db
 {
-    struct OpcodeInfo
-    {
-        uint32 Value;
-        std::string Name;
-        std::string Direction;
-    };
+    struct MetadataSnapshot;
 
     class OpcodeCache
     {
     private:
+        using LookupTable = std::unordered_map<std::string, std::shared_ptr<OpcodeLookup const>>;
+
         OpcodeCache() = default;
         
-        std::unordered_map<std::string, std::unordered_map<uint32, OpcodeInfo>> _cache;
+        // copy-on-write: writers publish a new table, readers never lock
+        std::atomic<std::shared_ptr<LookupTable const>> _cache{ std::make_shared<LookupTable const>() };
+        std::mutex _writeMutex;
 
     public:
         static OpcodeCache& Instance();
 
         void EnsureLoaded(std::string const& parserVersion);
+        void ApplySnapshot(MetadataSnapshot const& snapshot);
 
+        std::shared_ptr<OpcodeLookup const> GetLookup(std::string const& parserVersion) const;
         char const* GetOpcodeName(std::string const& parserVersion, uint32 opcodeValue) const;
         size_t GetOpcodeCount(std::string const& parserVersion) const;
         bool IsLoaded(std::string const& parserVersion) const;
@@ -0,0 +1,24 @@
+#include "pchdef.h"
+#include "OpcodeLookup.h"
+
+#include <bit>
+
+namespace PktParser::Db
+{
+    OpcodeLookup::OpcodeLookup(std::vector<OpcodeInfo> opcodes) : _opcodes{ std::move(opcodes) }
+    {
+        // keep load factor <= 0.5 so misses stop after a probe or two
+        size_t capacity = std::bit_ceil(std::max<size_t>(_opcodes.size() * 2, 16));
+        _slots.assign(capacity, Slot{ 0, nullptr });
+        _mask = static_cast<uint32>(capacity - 1);
+
+        for (OpcodeInfo const& info : _opcodes)
+        {
+            uint32 i = Hash(info.Value) & _mask;
+            while (_slots[i].Name && _slots[i].Value != info.Value)
+                i = (i + 1) & _mask;
+
+            _slots[i] = Slot{ info.Value, info.Name.c_str() };
+        }
+    }
+}
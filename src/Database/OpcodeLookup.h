@@ -0,0 +1,58 @@
+#pragma once
+
+#include "Misc/Define.h"
+
+#include <string>
+#include <vector>
+
+namespace PktParser::Db
+{
+    struct OpcodeInfo
+    {
+        uint32 Value;
+        std::string Name;
+        std::string Direction;
+    };
+
+    // immutable opcode -> info table for one parser version, resolved once per file and probed per packet
+    class OpcodeLookup
+    {
+    private:
+        struct Slot
+        {
+            uint32 Value;
+            char const* Name; // nullptr = empty slot
+        };
+
+        std::vector<OpcodeInfo> _opcodes;
+        std::vector<Slot> _slots;
+        uint32 _mask;
+
+        static uint32 Hash(uint32 opcode)
+        {
+            // opcodes are (group << 16 | index), fold the group into the low bits
+            return (opcode * 0x9E3779B1u) ^ (opcode >> 16);
+        }
+
+    public:
+        explicit OpcodeLookup(std::vector<OpcodeInfo> opcodes);
+
+        OpcodeLookup(OpcodeLookup const&) = delete;
+        OpcodeLookup& operator=(OpcodeLookup const&) = delete;
+
+        char const* GetName(uint32 opcode) const
+        {
+            for (uint32 i = Hash(opcode) & _mask; ; i = (i + 1) & _mask)
+            {
+                Slot const& slot = _slots[i];
+                if (!slot.Name)
+                    return "UNKNOWN_OPCODE";
+                if (slot.Value == opcode)
+                    return slot.Name;
+            }
+        }
+
+        std::vector<OpcodeInfo> const& GetOpcodes() const { return _opcodes; }
+        size_t Size() const { return _opcodes.size(); }
+    };
+}
@@ -0,0 +1,331 @@
+#include "pchdef.h"
+#include "PacketArchive.h"
+#include "Misc/Utilities.h"
+
+#include <algorithm>
+#include <charconv>
+#include <cstring>
+
+namespace PktParser::Db
+{
+    namespace
+    {
+        // zstd skips frames with magic 0x184D2A50..5F, the seek table lives in one
+        constexpr uint32 SKIPPABLE_MAGIC = 0x184D2A5E;
+        constexpr uint32 SEEK_MAGIC = 0x4B534B50;     // "PKSK" on disk
+        constexpr uint8 SEEK_VERSION = 1;
+        constexpr size_t ENTRY_BYTES = 4 + 4 + 4 + 8 + 8 + 8 + 4 + 4;
+        constexpr size_t FOOTER_BYTES = 4 + 1 + 4;
+        constexpr size_t SKIPPABLE_HEADER_BYTES = 8;
+        // cold storage, worth a slower level than the per-packet blobs
+        constexpr int32 ARCHIVE_ZSTD_LEVEL = 9;
+        constexpr size_t FRAME_RESERVE = 512 * 1024;
+
+        template<typename T>
+        void Put(std::vector<uint8>& out, T value)
+        {
+            uint8 const* bytes = reinterpret_cast<uint8 const*>(&value);
+            out.insert(out.end(), bytes, bytes + sizeof(T));
+        }
+
+        template<typename T>
+        T Get(uint8 const*& in)
+        {
+            T value;
+            std::memcpy(&value, in, sizeof(T));
+            in += sizeof(T);
+            return value;
+        }
+
+        constexpr std::string_view PACKET_PREFIX = R"({"packet_number":)";
+        constexpr std::string_view TIMESTAMP_PREFIX = R"(,"timestamp":)";
+
+        bool ParseLinePrefix(std::string_view line, uint32& pktNumber, int64& timestamp)
+        {
+            if (!line.starts_with(PACKET_PREFIX))
+                return false;
+
+            char const* p = line.data() + PACKET_PREFIX.size();
+            char const* end = line.data() + line.size();
+            auto [afterPkt, pktErr] = std::from_chars(p, end, pktNumber);
+            if (pktErr != std::errc{} || !std::string_view(afterPkt, end - afterPkt).starts_with(TIMESTAMP_PREFIX))
+                return false;
+
+            return std::from_chars(afterPkt + TIMESTAMP_PREFIX.size(), end, timestamp).ec == std::errc{};
+        }
+    }
+
+    PacketArchiveWriter::PacketArchiveWriter(std::string path) : _file{ nullptr }, _path{ std::move(path) }, _offset{ 0 }, _failed{ false }
+    {
+        _file = fopen(_path.c_str(), "wb");
+        if (!_file)
+            LOG("ERROR: Cannot open archive output '{}'", _path);
+    }
+
+    PacketArchiveWriter::~PacketArchiveWriter()
+    {
+        Close();
+    }
+
+    void PacketArchiveWriter::Write(void const* data, size_t size)
+    {
+        if (!_file || _failed)
+            return;
+
+        if (fwrite(data, 1, size, _file) != size)
+        {
+            LOG("ERROR: Archive write to '{}' failed", _path);
+            _failed = true;
+            return;
+        }
+        _offset += size;
+    }
+
+    void PacketArchiveWriter::AppendFrame(ArchiveFrame frame, std::span<uint8 const> compressed)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (!_file)
+            return;
+
+        frame.Offset = _offset;
+        Write(compressed.data(), compressed.size());
+        _frames.push_back(frame);
+    }
+
+    void PacketArchiveWriter::Close()
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (!_file)
+            return;
+
+        std::sort(_frames.begin(), _frames.end(), [](ArchiveFrame const& a, ArchiveFrame const& b) { return a.FirstPacket < b.FirstPacket; });
+
+        std::vector<uint8> table;
+        table.reserve(SKIPPABLE_HEADER_BYTES + _frames.size() * ENTRY_BYTES + FOOTER_BYTES);
+        Put<uint32>(table, SKIPPABLE_MAGIC);
+        Put<uint32>(table, static_cast<uint32>(_frames.size() * ENTRY_BYTES + FOOTER_BYTES));
+        for (ArchiveFrame const& frame : _frames)
+        {
+            Put(table, frame.FirstPacket);
+            Put(table, frame.LastPacket);
+            Put(table, frame.PacketCount);
+            Put(table, frame.MinTimestamp);
+            Put(table, frame.MaxTimestamp);
+            Put(table, frame.Offset);
+            Put(table, frame.CompressedSize);
+            Put(table, frame.DecompressedSize);
+        }
+        Put<uint32>(table, static_cast<uint32>(_frames.size()));
+        Put<uint8>(table, SEEK_VERSION);
+        Put<uint32>(table, SEEK_MAGIC);
+
+        Write(table.data(), table.size());
+        if (fclose(_file) != 0 && !_failed)
+            LOG("ERROR: Archive write to '{}' failed", _path);
+        _file = nullptr;
+    }
+
+    ArchiveFrameBuilder::ArchiveFrameBuilder(uint32 maxPackets)
+        : _lines{ FRAME_RESERVE }, _frame{}, _maxPackets{ maxPackets }, _cctx{ ZSTD_createCCtx() }
+    {
+        ZSTD_CCtx_setParameter(_cctx, ZSTD_c_compressionLevel, ARCHIVE_ZSTD_LEVEL);
+    }
+
+    ArchiveFrameBuilder::~ArchiveFrameBuilder()
+    {
+        ZSTD_freeCCtx(_cctx);
+    }
+
+    void ArchiveFrameBuilder::Add(Reader::PktHeader const& header, char const* opcodeName, uint32 pktNumber, std::string_view json, std::span<uint8 const> raw)
+    {
+        int64 timestamp = static_cast<int64>(header.timestamp * 1000);
+        if (_frame.PacketCount == 0)
+        {
+            _frame.FirstPacket = pktNumber;
+            _frame.MinTimestamp = timestamp;
+            _frame.MaxTimestamp = timestamp;
+        }
+        _frame.LastPacket = pktNumber;
+        _frame.MinTimestamp = std::min(_frame.MinTimestamp, timestamp);
+        _frame.MaxTimestamp = std::max(_frame.MaxTimestamp, timestamp);
+        ++_frame.PacketCount;
+
+        _lines.BeginObject();
+        _lines.WriteUInt("packet_number", pktNumber);
+        _lines.WriteInt("timestamp", timestamp);
+        _lines.WriteString("direction", Misc::DirectionToString(header.direction));
+        _lines.WriteUInt("opcode", header.opcode);
+        _lines.WriteString("packet_name", opcodeName);
+        _lines.WriteInt("length", header.packetLength - 4);
+        if (!json.empty())
+        {
+            _lines.Key("data");
+            _lines.Raw(json);
+        }
+        else
+            _lines.WriteString("raw", Misc::Base64Encode(raw.data(), raw.size()));
+        _lines.EndObject();
+        _lines.EndLine();
+    }
+
+    std::span<uint8 const> ArchiveFrameBuilder::Compress()
+    {
+        std::string_view text = _lines.GetView();
+        _compressed.resize(ZSTD_compressBound(text.size()));
+        size_t size = ZSTD_compress2(_cctx, _compressed.data(), _compressed.size(), text.data(), text.size());
+        if (ZSTD_isError(size))
+            throw ParseException{ fmt::format("Archive frame compression failed: {}", ZSTD_getErrorName(size)) };
+
+        _frame.CompressedSize = static_cast<uint32>(size);
+        _frame.DecompressedSize = static_cast<uint32>(text.size());
+        return std::span<uint8 const>(_compressed.data(), size);
+    }
+
+    void ArchiveFrameBuilder::Flush(PacketArchiveWriter& archive)
+    {
+        if (IsEmpty())
+            return;
+
+        std::span<uint8 const> compressed = Compress();
+        archive.AppendFrame(_frame, compressed);
+
+        _lines.Clear();
+        _frame = {};
+    }
+
+    void ArchiveFrameBuilder::Flush(std::vector<StagedArchiveFrame>& staged)
+    {
+        if (IsEmpty())
+            return;
+
+        std::span<uint8 const> compressed = Compress();
+        staged.push_back(StagedArchiveFrame{ _frame, std::vector<uint8>(compressed.begin(), compressed.end()) });
+
+        _lines.Clear();
+        _frame = {};
+    }
+
+    PacketArchiveReader::PacketArchiveReader(std::string path) : _path{ std::move(path) }
+    {
+        std::unique_ptr<FILE, decltype(&fclose)> file(fopen(_path.c_str(), "rb"), &fclose);
+        if (!file)
+            throw ParseException{ "Cannot open archive " + _path };
+
+        fseeko(file.get(), 0, SEEK_END);
+        int64 fileSize = ftello(file.get());
+        if (fileSize < static_cast<int64>(SKIPPABLE_HEADER_BYTES + FOOTER_BYTES))
+            throw ParseException{ "Archive too small: " + _path };
+
+        uint8 footer[FOOTER_BYTES];
+        fseeko(file.get(), fileSize - FOOTER_BYTES, SEEK_SET);
+        if (fread(footer, 1, FOOTER_BYTES, file.get()) != FOOTER_BYTES)
+            throw ParseException{ "Cannot read archive seek table: " + _path };
+
+        uint8 const* in = footer;
+        uint32 count = Get<uint32>(in);
+        uint8 version = Get<uint8>(in);
+        uint32 magic = Get<uint32>(in);
+        if (magic != SEEK_MAGIC || version != SEEK_VERSION)
+            throw ParseException{ "Not a packet archive (or unknown version): " + _path };
+
+        int64 tableBytes = static_cast<int64>(SKIPPABLE_HEADER_BYTES + count * ENTRY_BYTES + FOOTER_BYTES);
+        if (tableBytes > fileSize)
+            throw ParseException{ "Archive seek table out of bounds: " + _path };
+
+        std::vector<uint8> table(tableBytes);
+        fseeko(file.get(), fileSize - tableBytes, SEEK_SET);
+        if (fread(table.data(), 1, table.size(), file.get()) != table.size())
+            throw ParseException{ "Cannot read archive seek table: " + _path };
+
+        in = table.data();
+        if (Get<uint32>(in) != SKIPPABLE_MAGIC)
+            throw ParseException{ "Archive seek table is not a skippable frame: " + _path };
+        in += 4;
+
+        _frames.resize(count);
+        for (ArchiveFrame& frame : _frames)
+        {
+            frame.FirstPacket = Get<uint32>(in);
+            frame.LastPacket = Get<uint32>(in);
+            frame.PacketCount = Get<uint32>(in);
+            frame.MinTimestamp = Get<int64>(in);
+            frame.MaxTimestamp = Get<int64>(in);
+            frame.Offset = Get<uint64>(in);
+            frame.CompressedSize = Get<uint32>(in);
+            frame.DecompressedSize = Get<uint32>(in);
+        }
+    }
+
+    std::string PacketArchiveReader::ReadFrame(FILE* file, ArchiveFrame const& frame) const
+    {
+        std::vector<uint8> compressed(frame.CompressedSize);
+        fseeko(file, static_cast<off_t>(frame.Offset), SEEK_SET);
+        if (fread(compressed.data(), 1, compressed.size(), file) != compressed.size())
+            throw ParseException{ fmt::format("Cannot read archive frame at {} in {}", frame.Offset, _path) };
+
+        std::string text(frame.DecompressedSize, '\0');
+        size_t size = ZSTD_decompress(text.data(), text.size(), compressed.data(), compressed.size());
+        if (ZSTD_isError(size) || size != text.size())
+            throw ParseException{ fmt::format("Corrupt archive frame at {} in {}", frame.Offset, _path) };
+        return text;
+    }
+
+    template<typename Pred>
+    std::string PacketArchiveReader::Collect(std::vector<ArchiveFrame const*> const& frames, Pred&& keep) const
+    {
+        std::string out;
+        if (frames.empty())
+            return out;
+
+        std::unique_ptr<FILE, decltype(&fclose)> file(fopen(_path.c_str(), "rb"), &fclose);
+        if (!file)
+            throw ParseException{ "Cannot open archive " + _path };
+
+        for (ArchiveFrame const* frame : frames)
+        {
+            std::string text = ReadFrame(file.get(), *frame);
+
+            size_t start = 0;
+            while (start < text.size())
+            {
+                size_t end = text.find('\n', start);
+                if (end == std::string::npos)
+                    end = text.size();
+
+                std::string_view line(text.data() + start, end - start);
+                uint32 pktNumber;
+                int64 timestamp;
+                if (ParseLinePrefix(line, pktNumber, timestamp) && keep(pktNumber, timestamp))
+                {
+                    out.append(line);
+                    out.push_back('\n');
+                }
+                start = end + 1;
+            }
+        }
+        return out;
+    }
+
+    std::string PacketArchiveReader::ReadPackets(uint32 first, uint32 last) const
+    {
+        // frames never overlap, sorted by first packet they are sorted by last packet too
+        auto it = std::lower_bound(_frames.begin(), _frames.end(), first,
+            [](ArchiveFrame const& frame, uint32 pkt) { return frame.LastPacket < pkt; });
+
+        std::vector<ArchiveFrame const*> touched;
+        for (; it != _frames.end() && it->FirstPacket <= last; ++it)
+            touched.push_back(&*it);
+
+        return Collect(touched, [&](uint32 pktNumber, int64) { return pktNumber >= first && pktNumber <= last; });
+    }
+
+    std::string PacketArchiveReader::ReadTimeRange(int64 fromMs, int64 toMs) const
+    {
+        std::vector<ArchiveFrame const*> touched;
+        for (ArchiveFrame const& frame : _frames)
+            if (frame.MaxTimestamp >= fromMs && frame.MinTimestamp <= toMs)
+                touched.push_back(&frame);
+
+        return Collect(touched, [&](uint32, int64 timestamp) { return timestamp >= fromMs && timestamp <= toMs; });
+    }
+}
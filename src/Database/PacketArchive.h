@@ -0,0 +1,119 @@
+#pragma once
+
+#include "Misc/Define.h"
+#include "Reader/PktFileReader.h"
+#include "Common/JsonWriter.h"
+
+#include <cstdio>
+#include <mutex>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <zstd.h>
+
+namespace PktParser::Db
+{
+    /*
+     * one capture's parsed output as ndjson, cut into independent zstd frames of consecutive packets
+     * the file ends in a zstd skippable frame holding the seek table, so plain `zstd -d` still gives the ndjson:
+     *   frames..., uint32 skippable magic, uint32 size, ArchiveFrame entries (packed, LE), uint32 entry count, uint8 version, uint32 SEEK_MAGIC
+     * frames are appended in whatever order workers finish them, the seek table is sorted by packet number
+     */
+    struct ArchiveFrame
+    {
+        uint32 FirstPacket;
+        uint32 LastPacket;
+        uint32 PacketCount;
+        int64 MinTimestamp;     // ms
+        int64 MaxTimestamp;
+        uint64 Offset;
+        uint32 CompressedSize;
+        uint32 DecompressedSize;
+    };
+
+    // a compressed frame held back until it may be appended, see ordered mode in ParallelProcessor
+    struct StagedArchiveFrame
+    {
+        ArchiveFrame Frame;
+        std::vector<uint8> Compressed;
+    };
+
+    class PacketArchiveWriter
+    {
+    private:
+        FILE* _file;
+        std::string _path;
+        std::mutex _mutex;
+        uint64 _offset;
+        std::vector<ArchiveFrame> _frames;
+        bool _failed;
+
+        void Write(void const* data, size_t size);
+
+    public:
+        explicit PacketArchiveWriter(std::string path);
+        ~PacketArchiveWriter();
+
+        PacketArchiveWriter(PacketArchiveWriter const&) = delete;
+        PacketArchiveWriter& operator=(PacketArchiveWriter const&) = delete;
+
+        // any thread, frame.Offset is filled in here
+        void AppendFrame(ArchiveFrame frame, std::span<uint8 const> compressed);
+
+        // seek table and close, once every frame is in
+        void Close();
+    };
+
+    // one worker's frame in the making, lines start {"packet_number":N,"timestamp":T so readers can filter without a json parser
+    class ArchiveFrameBuilder
+    {
+    private:
+        Common::JsonWriter _lines;
+        std::vector<uint8> _compressed;
+        ArchiveFrame _frame;
+        uint32 _maxPackets;
+        ZSTD_CCtx* _cctx;
+
+        std::span<uint8 const> Compress();
+
+    public:
+        explicit ArchiveFrameBuilder(uint32 maxPackets);
+        ~ArchiveFrameBuilder();
+
+        ArchiveFrameBuilder(ArchiveFrameBuilder const&) = delete;
+        ArchiveFrameBuilder& operator=(ArchiveFrameBuilder const&) = delete;
+
+        bool IsEmpty() const { return _frame.PacketCount == 0; }
+        bool IsFull() const { return _frame.PacketCount >= _maxPackets; }
+
+        // json is the parsed payload, packets without one keep their raw bytes (base64)
+        void Add(Reader::PktHeader const& header, char const* opcodeName, uint32 pktNumber, std::string_view json, std::span<uint8 const> raw);
+
+        void Flush(PacketArchiveWriter& archive);
+        void Flush(std::vector<StagedArchiveFrame>& staged);
+    };
+
+    // read side: loads the seek table and decompresses only the frames a range touches
+    class PacketArchiveReader
+    {
+    private:
+        std::string _path;
+        std::vector<ArchiveFrame> _frames;
+
+        std::string ReadFrame(FILE* file, ArchiveFrame const& frame) const;
+
+        template<typename Pred>
+        std::string Collect(std::vector<ArchiveFrame const*> const& frames, Pred&& keep) const;
+
+    public:
+        explicit PacketArchiveReader(std::string path);
+
+        std::vector<ArchiveFrame> const& GetFrames() const { return _frames; }
+
+        // ndjson of packets first..last (inclusive), in packet order
+        std::string ReadPackets(uint32 first, uint32 last) const;
+        // ndjson of packets with fromMs <= timestamp <= toMs, in packet order
+        std::string ReadTimeRange(int64 fromMs, int64 toMs) const;
+    };
+}
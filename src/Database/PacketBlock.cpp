@@ -0,0 +1,139 @@
+#include "pchdef.h"
+#include "PacketBlock.h"
+#include "Misc/Utilities.h"
+
+using namespace PktParser::Common;
+
+namespace PktParser::Db
+{
+    namespace
+    {
+        constexpr uint8 FORMAT_VERSION = 1;
+    }
+
+    PacketBlockBuilder::PacketBlockBuilder()
+        : _index{ MAX_PACKETS * 16 }, _firstPacket{ 0 }, _lastPacket{ 0 }, _lastTimestamp{ 0 }, _count{ 0 }
+    {
+        _data.reserve(MAX_BYTES + 64 * 1024);
+    }
+
+    bool PacketBlockBuilder::Accepts(uint32 pktNumber) const
+    {
+        if (_count == 0)
+            return true;
+
+        return pktNumber / PACKETS_PER_BUCKET == GetBucket() && _count < MAX_PACKETS && _data.size() < MAX_BYTES;
+    }
+
+    void PacketBlockBuilder::Add(Reader::PktHeader const& header, uint32 pktNumber, std::span<uint8 const> data, bool isPayload)
+    {
+        int64 timestamp = static_cast<int64>(header.timestamp * 1000);
+
+        if (_count == 0)
+        {
+            _data.clear();
+            _index.Clear();
+            _firstPacket = pktNumber;
+            _lastPacket = pktNumber;
+            _lastTimestamp = timestamp;
+
+            BinaryWriter head(8);
+            head.UInt8(FORMAT_VERSION);
+            head.VarUInt(pktNumber);
+            head.VarInt(timestamp);
+            auto const* bytes = reinterpret_cast<uint8 const*>(head.Data());
+            _data.insert(_data.end(), bytes, bytes + head.Size());
+        }
+
+        // neighbours in a capture are a few ms and a packet number apart, deltas keep the index tiny
+        _index.VarUInt(pktNumber - _lastPacket);
+        _index.UInt8(static_cast<uint8>(header.direction));
+        _index.UInt8(isPayload ? 1 : 0);
+        _index.VarInt(header.packetLength - 4);
+        _index.VarUInt(header.opcode);
+        _index.VarInt(timestamp - _lastTimestamp);
+        _index.VarUInt(data.size());
+
+        _data.insert(_data.end(), data.begin(), data.end());
+
+        _lastPacket = pktNumber;
+        _lastTimestamp = timestamp;
+        ++_count;
+    }
+
+    std::span<uint8 const> PacketBlockBuilder::Finish(ZSTD_CCtx* cctx)
+    {
+        uint32 indexOffset = static_cast<uint32>(_data.size());
+        auto const* index = reinterpret_cast<uint8 const*>(_index.Data());
+        _data.insert(_data.end(), index, index + _index.Size());
+        _data.insert(_data.end(), reinterpret_cast<uint8 const*>(&indexOffset), reinterpret_cast<uint8 const*>(&indexOffset) + sizeof(indexOffset));
+
+        std::span<uint8 const> compressed = Misc::CompressData(_data, cctx);
+        _compressed.assign(compressed.begin(), compressed.end());
+        _count = 0;
+
+        return _compressed;
+    }
+
+    PacketBlockReader::PacketBlockReader(std::span<uint8 const> compressedBlock)
+    {
+        unsigned long long contentSize = ZSTD_getFrameContentSize(compressedBlock.data(), compressedBlock.size());
+        if (contentSize == ZSTD_CONTENTSIZE_ERROR || contentSize == ZSTD_CONTENTSIZE_UNKNOWN)
+            throw ParseException{ "PacketBlock: not a zstd frame with known size" };
+
+        _data.resize(contentSize);
+        size_t size = ZSTD_decompress(_data.data(), _data.size(), compressedBlock.data(), compressedBlock.size());
+        if (ZSTD_isError(size) || size < 1 + sizeof(uint32))
+            throw ParseException{ "PacketBlock: corrupt block" };
+        _data.resize(size);
+
+        uint8 const* base = reinterpret_cast<uint8 const*>(_data.data());
+
+        uint32 indexOffset;
+        std::memcpy(&indexOffset, base + size - sizeof(indexOffset), sizeof(indexOffset));
+        if (indexOffset > size - sizeof(indexOffset))
+            throw ParseException{ "PacketBlock: index offset out of range" };
+
+        BinaryReader head(base, indexOffset);
+        if (head.UInt8() != FORMAT_VERSION)
+            throw ParseException{ "PacketBlock: unknown format version" };
+        uint32 pktNumber = static_cast<uint32>(head.VarUInt());
+        int64 timestamp = head.VarInt();
+        size_t payloadOffset = indexOffset - head.Remaining();
+
+        BinaryReader index(base + indexOffset, size - sizeof(indexOffset) - indexOffset);
+
+        while (index.CanRead())
+        {
+            PacketBlockEntry entry;
+            pktNumber += static_cast<uint32>(index.VarUInt());
+            entry.PacketNumber = pktNumber;
+            entry.Direction = index.UInt8();
+            entry.IsPayload = index.UInt8() != 0;
+            entry.PacketLen = static_cast<int32>(index.VarInt());
+            entry.Opcode = static_cast<uint32>(index.VarUInt());
+
+            timestamp += index.VarInt();
+            entry.Timestamp = timestamp;
+
+            size_t len = index.VarUInt();
+            if (payloadOffset + len > indexOffset)
+                throw ParseException{ "PacketBlock: payload out of range" };
+
+            entry.Data = std::string_view(_data.data() + payloadOffset, len);
+            payloadOffset += len;
+
+            _entries.push_back(entry);
+        }
+    }
+
+    PacketBlockEntry const* PacketBlockReader::Find(uint32 pktNumber) const
+    {
+        auto it = std::lower_bound(_entries.begin(), _entries.end(), pktNumber,
+            [](PacketBlockEntry const& entry, uint32 number) { return entry.PacketNumber < number; });
+
+        if (it == _entries.end() || it->PacketNumber != pktNumber)
+            return nullptr;
+        return &*it;
+    }
+}
@@ -0,0 +1,94 @@
+#pragma once
+
+#include "Misc/Define.h"
+#include "Reader/PktFileReader.h"
+#include "Common/BinaryWriter.h"
+
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <zstd.h>
+
+namespace PktParser::Db
+{
+    enum class StorageLayout : uint8
+    {
+        Packet,     // one row / zstd frame per packet in wow_packets.packets
+        Block       // runs of packets of one bucket share a frame in wow_packets.packet_blocks
+    };
+
+    inline char const* StorageLayoutName(StorageLayout layout)
+    {
+        return layout == StorageLayout::Block ? "block" : "packet";
+    }
+
+    static constexpr uint32 PACKETS_PER_BUCKET = 10000;
+
+    /*
+     * uncompressed block:
+     *   uint8 version, varuint first packet number, varint first timestamp (ms), payloads back to back,
+     *   index (one entry per packet), uint32 index offset
+     * the whole thing is a single zstd frame
+     */
+    class PacketBlockBuilder
+    {
+    private:
+        static constexpr uint32 MAX_PACKETS = 512;
+        static constexpr size_t MAX_BYTES = 256 * 1024;
+
+        std::vector<uint8> _data;
+        Common::BinaryWriter _index;
+        std::vector<uint8> _compressed;
+        uint32 _firstPacket;
+        uint32 _lastPacket;
+        int64 _lastTimestamp;
+        uint32 _count;
+
+    public:
+        PacketBlockBuilder();
+
+        bool IsEmpty() const { return _count == 0; }
+        uint32 GetBucket() const { return _firstPacket / PACKETS_PER_BUCKET; }
+        uint32 GetFirstPacket() const { return _firstPacket; }
+        uint32 GetCount() const { return _count; }
+
+        // false when the packet belongs in the next block (other bucket, or this one is full)
+        bool Accepts(uint32 pktNumber) const;
+
+        // isPayload distinguishes parser output from raw packet bytes kept for unparsed opcodes
+        void Add(Reader::PktHeader const& header, uint32 pktNumber, std::span<uint8 const> data, bool isPayload);
+
+        // compressed block, valid until the next Add
+        std::span<uint8 const> Finish(ZSTD_CCtx* cctx);
+        size_t GetUncompressedSize() const { return _data.size(); }
+    };
+
+    struct PacketBlockEntry
+    {
+        uint32 PacketNumber;
+        uint8 Direction;
+        bool IsPayload;
+        int32 PacketLen;
+        uint32 Opcode;
+        int64 Timestamp;
+        std::string_view Data;
+    };
+
+    // read side: decompresses one block and indexes it, Find pulls out a single packet
+    class PacketBlockReader
+    {
+    private:
+        std::string _data;
+        std::vector<PacketBlockEntry> _entries;
+
+    public:
+        explicit PacketBlockReader(std::span<uint8 const> compressedBlock);
+
+        PacketBlockReader(PacketBlockReader const&) = delete;
+        PacketBlockReader& operator=(PacketBlockReader const&) = delete;
+
+        std::span<PacketBlockEntry const> GetEntries() const { return _entries; }
+        PacketBlockEntry const* Find(uint32 pktNumber) const;
+    };
+}
@@ -0,0 +1,35 @@
+#pragma once
+
+#include "Misc/Define.h"
+
+#include <atomic>
+
+namespace PktParser::Db
+{
+    // work whose writes are still in flight in the sinks: a sink takes a hold before it queues a write and drops it
+    // once the write is durable or was given up on, the last drop calls OnAcknowledged
+    class SinkAck
+    {
+    private:
+        std::atomic<size_t> _holds{ 1 };        // the producer's own, dropped once everything is handed off
+        std::atomic<bool> _failed{ false };
+
+    protected:
+        // may run on a driver or sender thread, must not block
+        virtual void OnAcknowledged(bool failed) = 0;
+
+    public:
+        virtual ~SinkAck() = default;
+
+        void Acquire() { _holds.fetch_add(1, std::memory_order_relaxed); }
+
+        // a write that was given up on, the work is still released but never counts as durable
+        void Fail() { _failed.store(true, std::memory_order_relaxed); }
+
+        void Release()
+        {
+            if (_holds.fetch_sub(1, std::memory_order_acq_rel) == 1)
+                OnAcknowledged(_failed.load(std::memory_order_relaxed));
+        }
+    };
+}
@@ -0,0 +1,280 @@
+#include "pchdef.h"
+#include "SortedRowWriter.h"
+#include "PacketBlock.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <tuple>
+
+namespace PktParser::Db
+{
+    namespace
+    {
+        constexpr char ROWS_MAGIC[] = { 'P', 'K', 'T', 'R', 'O', 'W', 'S' };
+        // build, file_id, bucket, packet_number, direction, packet_len, opcode, timestamp, blob length
+        constexpr size_t ROW_FIXED_BYTES = 4 + 16 + 4 + 4 + 1 + 4 + 4 + 8 + 4;
+        constexpr size_t WRITE_BUFFER_BYTES = 4 << 20;
+        // a quarter of a run goes to sort keys, enough for rows averaging up to ~3x their size in blob bytes
+        constexpr size_t RUN_REF_SHARE = 4;
+
+        uint64 Rotl64(uint64 v, int n)
+        {
+            return (v << n) | (v >> (64 - n));
+        }
+
+        uint64 Fmix64(uint64 k)
+        {
+            k ^= k >> 33;
+            k *= 0xff51afd7ed558ccdULL;
+            k ^= k >> 33;
+            k *= 0xc4ceb9fe1a85ec53ULL;
+            k ^= k >> 33;
+            return k;
+        }
+
+        // java bytes are signed, cassandra's tail handling sign extends them before shifting
+        uint64 TailByte(uint8 b, int shift)
+        {
+            return static_cast<uint64>(static_cast<int64>(static_cast<int8>(b))) << shift;
+        }
+
+        // org.apache.cassandra.utils.MurmurHash.hash3_x64_128 with seed 0, first half only
+        int64 CassandraMurmur3(uint8 const* key, size_t len)
+        {
+            constexpr uint64 c1 = 0x87c37b91114253d5ULL;
+            constexpr uint64 c2 = 0x4cf5ad432745937fULL;
+
+            uint64 h1 = 0;
+            uint64 h2 = 0;
+
+            size_t nblocks = len / 16;
+            for (size_t i = 0; i < nblocks; ++i)
+            {
+                uint64 k1;
+                uint64 k2;
+                std::memcpy(&k1, key + i * 16, 8);
+                std::memcpy(&k2, key + i * 16 + 8, 8);
+
+                k1 *= c1; k1 = Rotl64(k1, 31); k1 *= c2; h1 ^= k1;
+                h1 = Rotl64(h1, 27); h1 += h2; h1 = h1 * 5 + 0x52dce729;
+
+                k2 *= c2; k2 = Rotl64(k2, 33); k2 *= c1; h2 ^= k2;
+                h2 = Rotl64(h2, 31); h2 += h1; h2 = h2 * 5 + 0x38495ab5;
+            }
+
+            uint8 const* tail = key + nblocks * 16;
+            uint64 k1 = 0;
+            uint64 k2 = 0;
+
+            switch (len & 15)
+            {
+            case 15: k2 ^= TailByte(tail[14], 48); [[fallthrough]];
+            case 14: k2 ^= TailByte(tail[13], 40); [[fallthrough]];
+            case 13: k2 ^= TailByte(tail[12], 32); [[fallthrough]];
+            case 12: k2 ^= TailByte(tail[11], 24); [[fallthrough]];
+            case 11: k2 ^= TailByte(tail[10], 16); [[fallthrough]];
+            case 10: k2 ^= TailByte(tail[9], 8); [[fallthrough]];
+            case 9:
+                k2 ^= TailByte(tail[8], 0);
+                k2 *= c2; k2 = Rotl64(k2, 33); k2 *= c1; h2 ^= k2;
+                [[fallthrough]];
+            case 8: k1 ^= TailByte(tail[7], 56); [[fallthrough]];
+            case 7: k1 ^= TailByte(tail[6], 48); [[fallthrough]];
+            case 6: k1 ^= TailByte(tail[5], 40); [[fallthrough]];
+            case 5: k1 ^= TailByte(tail[4], 32); [[fallthrough]];
+            case 4: k1 ^= TailByte(tail[3], 24); [[fallthrough]];
+            case 3: k1 ^= TailByte(tail[2], 16); [[fallthrough]];
+            case 2: k1 ^= TailByte(tail[1], 8); [[fallthrough]];
+            case 1:
+                k1 ^= TailByte(tail[0], 0);
+                k1 *= c1; k1 = Rotl64(k1, 31); k1 *= c2; h1 ^= k1;
+                break;
+            default:
+                break;
+            }
+
+            h1 ^= len;
+            h2 ^= len;
+            h1 += h2;
+            h2 += h1;
+            h1 = Fmix64(h1);
+            h2 = Fmix64(h2);
+            h1 += h2;
+
+            return static_cast<int64>(h1);
+        }
+
+        uint8* PutBE32(uint8* out, uint32 v)
+        {
+            out[0] = static_cast<uint8>(v >> 24);
+            out[1] = static_cast<uint8>(v >> 16);
+            out[2] = static_cast<uint8>(v >> 8);
+            out[3] = static_cast<uint8>(v);
+            return out + 4;
+        }
+
+        uint8* PutBE64(uint8* out, uint64 v)
+        {
+            out = PutBE32(out, static_cast<uint32>(v >> 32));
+            return PutBE32(out, static_cast<uint32>(v));
+        }
+
+        // CompositeType component: uint16 length, value, end-of-component byte
+        uint8* PutComponent(uint8* out, uint8 const* value, uint16 len)
+        {
+            *out++ = static_cast<uint8>(len >> 8);
+            *out++ = static_cast<uint8>(len);
+            std::memcpy(out, value, len);
+            out += len;
+            *out++ = 0;
+            return out;
+        }
+    }
+
+    int64 PacketPartitionToken(uint32 build, UuidBytes const& fileId, uint32 bucket)
+    {
+        uint8 buildBytes[4];
+        uint8 bucketBytes[4];
+        PutBE32(buildBytes, build);
+        PutBE32(bucketBytes, bucket);
+
+        uint8 key[3 * 3 + 4 + 16 + 4];
+        uint8* out = PutComponent(key, buildBytes, 4);
+        out = PutComponent(out, fileId.data(), 16);
+        PutComponent(out, bucketBytes, 4);
+
+        // Murmur3Partitioner keeps Long.MIN_VALUE out of the token range
+        int64 token = CassandraMurmur3(key, sizeof(key));
+        return token == std::numeric_limits<int64>::min() ? std::numeric_limits<int64>::max() : token;
+    }
+
+    UuidBytes ParseUuidBytes(std::string_view text)
+    {
+        auto nibble = [](char c) -> uint8
+        {
+            if (c >= '0' && c <= '9')
+                return c - '0';
+            if (c >= 'a' && c <= 'f')
+                return c - 'a' + 10;
+            if (c >= 'A' && c <= 'F')
+                return c - 'A' + 10;
+            throw ParseException{ "Invalid uuid character" };
+        };
+
+        UuidBytes bytes{};
+        size_t n = 0;
+        for (size_t i = 0; i < text.size(); ++i)
+        {
+            if (text[i] == '-')
+                continue;
+            if (n >= 32 || i + 1 >= text.size())
+                throw ParseException{ "Invalid uuid " + std::string(text) };
+            bytes[n / 2] = static_cast<uint8>((nibble(text[i]) << 4) | nibble(text[i + 1]));
+            n += 2;
+            ++i;
+        }
+
+        if (n != 32)
+            throw ParseException{ "Invalid uuid " + std::string(text) };
+        return bytes;
+    }
+
+    SortedRowWriter::SortedRowWriter(std::string pathPrefix, size_t runBytes)
+        : _pathPrefix{ std::move(pathPrefix) }, _rowBytes{ 0 }, _runCount{ 0 }, _lastBuild{ 0 }, _lastFileId{}, _lastBucket{ 0 }, _lastToken{ 0 }, _hasLast{ false }
+    {
+        // sized once, a run is flushed before either would have to grow
+        size_t refBytes = runBytes / RUN_REF_SHARE;
+        _rowBytes = std::max(runBytes - refBytes, ROW_FIXED_BYTES);
+        _refs.reserve(std::max<size_t>(refBytes / sizeof(RowRef), 1));
+        _rows.reserve(_rowBytes);
+    }
+
+    SortedRowWriter::~SortedRowWriter()
+    {
+        Flush();
+    }
+
+    void SortedRowWriter::Add(uint32 build, UuidBytes const& fileId, Reader::PktHeader const& header, uint32 pktNumber, std::span<uint8 const> blob)
+    {
+        uint32 bucket = pktNumber / PACKETS_PER_BUCKET;
+        if (!_hasLast || bucket != _lastBucket || build != _lastBuild || fileId != _lastFileId)
+        {
+            _lastToken = PacketPartitionToken(build, fileId, bucket);
+            _lastBuild = build;
+            _lastFileId = fileId;
+            _lastBucket = bucket;
+            _hasLast = true;
+        }
+
+        size_t size = ROW_FIXED_BYTES + blob.size();
+        if (_refs.size() == _refs.capacity() || _rows.size() + size > _rows.capacity())
+            Flush();
+
+        // a single row bigger than the whole run is the only thing that grows the buffer
+        size_t offset = _rows.size();
+        _rows.resize(offset + size);
+
+        uint8* out = _rows.data() + offset;
+        out = PutBE32(out, build);
+        std::memcpy(out, fileId.data(), fileId.size());
+        out += fileId.size();
+        out = PutBE32(out, bucket);
+        out = PutBE32(out, pktNumber);
+        *out++ = static_cast<uint8>(header.direction);
+        out = PutBE32(out, static_cast<uint32>(header.packetLength - 4));
+        out = PutBE32(out, header.opcode);
+        out = PutBE64(out, static_cast<uint64>(static_cast<int64>(header.timestamp * 1000)));
+        out = PutBE32(out, static_cast<uint32>(blob.size()));
+        if (!blob.empty())
+            std::memcpy(out, blob.data(), blob.size());
+
+        _refs.push_back(RowRef{ _lastToken, build, fileId, bucket, pktNumber, offset, static_cast<uint32>(size) });
+    }
+
+    void SortedRowWriter::Flush()
+    {
+        if (_refs.empty())
+            return;
+
+        // DecoratedKey order: token, then the raw key bytes, whose fixed-width big-endian fields compare like the values
+        std::sort(_refs.begin(), _refs.end(), [](RowRef const& a, RowRef const& b)
+        {
+            return std::tie(a.Token, a.Build, a.FileId, a.Bucket, a.PacketNumber)
+                < std::tie(b.Token, b.Build, b.FileId, b.Bucket, b.PacketNumber);
+        });
+
+        std::string path = fmt::format("{}_{}.rows", _pathPrefix, _runCount++);
+        FILE* file = fopen(path.c_str(), "wb");
+        if (!file)
+        {
+            LOG("ERROR: Cannot open row output '{}'", path);
+        }
+        else
+        {
+            std::vector<char> buffer(WRITE_BUFFER_BYTES);
+            setvbuf(file, buffer.data(), _IOFBF, buffer.size());
+
+            bool ok = fwrite(ROWS_MAGIC, 1, sizeof(ROWS_MAGIC), file) == sizeof(ROWS_MAGIC) && fputc(VERSION, file) != EOF;
+            for (RowRef const& ref : _refs)
+            {
+                if (!ok)
+                    break;
+                ok = fwrite(_rows.data() + ref.Offset, 1, ref.Size, file) == ref.Size;
+            }
+
+            if (fclose(file) != 0 || !ok)
+                LOG("ERROR: Row write to '{}' failed - tmpfs full?", path);
+        }
+
+        _rows.clear();
+        _refs.clear();
+
+        // back to the budget after an oversized row
+        if (_rows.capacity() > _rowBytes)
+        {
+            std::vector<uint8>().swap(_rows);
+            _rows.reserve(_rowBytes);
+        }
+    }
+}
@@ -0,0 +1,72 @@
+#pragma once
+
+#include "Misc/Define.h"
+#include "Reader/PktFileReader.h"
+
+#include <array>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace PktParser::Db
+{
+    using UuidBytes = std::array<uint8, 16>;
+
+    // Murmur3Partitioner token of a wow_packets.packets partition (build, file_id, bucket)
+    int64 PacketPartitionToken(uint32 build, UuidBytes const& fileId, uint32 bucket);
+
+    // canonical "8-4-4-4-12" text to the 16 bytes Cassandra stores for a uuid
+    UuidBytes ParseUuidBytes(std::string_view text);
+
+    /*
+     * one worker's wow_packets.packets rows, buffered and written out in Cassandra's on-disk order
+     * (partition token, partition key bytes, packet number) so every run file becomes an sstable
+     * without any sorting on the jvm side
+     *
+     * run file: "PKTROWS" + uint8 version, then rows back to back, all big-endian:
+     *   int32 build, 16 byte file_id, int32 bucket, int32 packet_number, int8 direction,
+     *   int32 packet_len, int32 opcode, int64 timestamp (ms), int32 blob length, blob
+     */
+    class SortedRowWriter
+    {
+    private:
+        static constexpr uint8 VERSION = 1;
+
+        struct RowRef
+        {
+            int64 Token;
+            uint32 Build;
+            UuidBytes FileId;
+            uint32 Bucket;
+            uint32 PacketNumber;
+            size_t Offset;
+            uint32 Size;
+        };
+
+        std::string _pathPrefix;
+        std::vector<uint8> _rows;
+        std::vector<RowRef> _refs;
+        size_t _rowBytes;
+        uint32 _runCount;
+
+        // the partition of the previous row, consecutive packets nearly always share it
+        uint32 _lastBuild;
+        UuidBytes _lastFileId;
+        uint32 _lastBucket;
+        int64 _lastToken;
+        bool _hasLast;
+
+    public:
+        // runs go to <pathPrefix>_<n>.rows, rows and their sort keys together stay within runBytes
+        SortedRowWriter(std::string pathPrefix, size_t runBytes);
+        ~SortedRowWriter();
+
+        SortedRowWriter(SortedRowWriter const&) = delete;
+        SortedRowWriter& operator=(SortedRowWriter const&) = delete;
+
+        void Add(uint32 build, UuidBytes const& fileId, Reader::PktHeader const& header, uint32 pktNumber, std::span<uint8 const> blob);
+
+        // sorts what is buffered and writes it as the next run
+        void Flush();
+    };
+}
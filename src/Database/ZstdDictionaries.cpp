@@ -0,0 +1,352 @@
+#include "pchdef.h"
+#include "ZstdDictionaries.h"
+#include "Config.h"
+
+#include <pqxx/pqxx>
+#include <zdict.h>
+
+using namespace PktParser::Common;
+
+namespace PktParser::Db
+{
+    namespace
+    {
+        static constexpr size_t DICT_CAPACITY = 16 * 1024;
+        static constexpr int DICT_COMPRESSION_LEVEL = 1;
+
+        std::basic_string_view<std::byte> AsBytea(std::span<uint8 const> data)
+        {
+            return { reinterpret_cast<std::byte const*>(data.data()), data.size() };
+        }
+
+        std::shared_ptr<ZstdDictionary const> FromBytea(pqxx::field const& field)
+        {
+            std::basic_string<std::byte> raw = field.as<std::basic_string<std::byte>>();
+            std::vector<uint8> data(raw.size());
+            std::memcpy(data.data(), raw.data(), raw.size());
+            return std::make_shared<ZstdDictionary const>(std::move(data));
+        }
+
+        // returns the dictionary that ended up stored for this opcode, ours or one a concurrent run got in first
+        std::shared_ptr<ZstdDictionary const> StoreDictionary(std::string const& parserVersion, BlobFormat format, uint32 opcode,
+            std::shared_ptr<ZstdDictionary const> const& dict, size_t sampleCount)
+        {
+            pqxx::connection conn(Config::GetPostgresConnectionString());
+            pqxx::work txn(conn);
+
+            pqxx::result inserted = txn.exec_params(
+                "INSERT INTO zstd_dictionaries (dict_id, parser_version, blob_format, opcode_value, dict_data, sample_count) "
+                "VALUES ($1, $2, $3, $4, $5, $6) "
+                "ON CONFLICT DO NOTHING",
+                static_cast<int32>(dict->GetId()), parserVersion, BlobFormatName(format), static_cast<int32>(opcode),
+                AsBytea(dict->GetData()), static_cast<int32>(sampleCount));
+
+            if (inserted.affected_rows() == 1)
+            {
+                txn.commit();
+                return dict;
+            }
+
+            pqxx::result existing = txn.exec_params(
+                "SELECT dict_data FROM zstd_dictionaries "
+                "WHERE parser_version = $1 AND blob_format = $2 AND opcode_value = $3",
+                parserVersion, BlobFormatName(format), static_cast<int32>(opcode));
+            txn.commit();
+
+            if (existing.empty())
+                return nullptr;
+            return FromBytea(existing[0]["dict_data"]);
+        }
+    }
+
+    ZstdDictionary::ZstdDictionary(std::vector<uint8> data)
+        : _id{ 0 }, _data{ std::move(data) }, _cdict{ nullptr }, _ddict{ nullptr }
+    {
+        _id = ZSTD_getDictID_fromDict(_data.data(), _data.size());
+        _cdict = ZSTD_createCDict(_data.data(), _data.size(), DICT_COMPRESSION_LEVEL);
+        _ddict = ZSTD_createDDict(_data.data(), _data.size());
+
+        if (_id == 0 || !_cdict || !_ddict)
+        {
+            ZSTD_freeCDict(_cdict);
+            ZSTD_freeDDict(_ddict);
+            throw ParseException{ "Invalid zstd dictionary" };
+        }
+    }
+
+    ZstdDictionary::~ZstdDictionary()
+    {
+        ZSTD_freeCDict(_cdict);
+        ZSTD_freeDDict(_ddict);
+    }
+
+    DictionarySet::DictionarySet(std::string parserVersion, BlobFormat format, size_t sampleTarget)
+        : _parserVersion{ std::move(parserVersion) }, _format{ format }, _sampleTarget{ sampleTarget },
+        _samplers{ std::make_unique<Sampler[]>(SAMPLER_SLOTS) }
+    {
+    }
+
+    void DictionarySet::Load()
+    {
+        try
+        {
+            pqxx::connection conn(Config::GetPostgresConnectionString());
+            pqxx::work txn(conn);
+
+            pqxx::result rows = txn.exec_params(
+                "SELECT opcode_value, dict_data FROM zstd_dictionaries "
+                "WHERE parser_version = $1 AND blob_format = $2",
+                _parserVersion, BlobFormatName(_format));
+
+            for (auto const& row : rows)
+                Publish(row["opcode_value"].as<uint32>(), FromBytea(row["dict_data"]));
+
+            LOG("Loaded {} zstd dictionaries for {} ({})", rows.size(), _parserVersion, BlobFormatName(_format));
+        }
+        catch (std::exception const& e)
+        {
+            LOG("WARNING: Cannot load zstd dictionaries for {}: {}", _parserVersion, e.what());
+        }
+    }
+
+    void DictionarySet::Publish(uint32 opcode, std::shared_ptr<ZstdDictionary const> dict)
+    {
+        if (dict)
+            ZstdDictionaries::Instance().Register(dict);
+
+        std::lock_guard<std::mutex> lock(_writeMutex);
+
+        auto table = std::make_shared<Table>(*_table.load(std::memory_order_acquire));
+        (*table)[opcode] = std::move(dict);
+        _table.store(std::move(table), std::memory_order_release);
+    }
+
+    DictionarySet::Sampler* DictionarySet::FindSampler(uint32 opcode)
+    {
+        uint32 key = opcode + 1;
+        size_t slot = static_cast<size_t>((static_cast<uint64>(opcode) * 0x9E3779B97F4A7C15ULL) >> 32);
+
+        for (size_t probe = 0; probe < SAMPLER_SLOTS; ++probe)
+        {
+            Sampler& sampler = _samplers[(slot + probe) & (SAMPLER_SLOTS - 1)];
+            uint32 seen = sampler.Key.load(std::memory_order_acquire);
+            if (seen == 0 && sampler.Key.compare_exchange_strong(seen, key, std::memory_order_acq_rel))
+                return &sampler;
+
+            // a lost race leaves seen at whoever took the slot, it may still be this opcode
+            if (seen == key)
+                return &sampler;
+        }
+        return nullptr;
+    }
+
+    ZSTD_CDict const* DictionarySet::Select(Table const& table, uint32 opcode, std::string_view payload)
+    {
+        auto it = table.find(opcode);
+        if (it != table.end())
+            return it->second ? it->second->GetCDict() : nullptr;
+
+        if (_samplingOff.load(std::memory_order_relaxed))
+            return nullptr;
+
+        // an opcode past its target costs a load, only the first _sampleTarget packets of each reserve a slot
+        Sampler* sampler = FindSampler(opcode);
+        if (!sampler || sampler->Taken.load(std::memory_order_relaxed) >= _sampleTarget
+            || sampler->Taken.fetch_add(1, std::memory_order_relaxed) >= _sampleTarget)
+            return nullptr;
+
+        DictionarySamples ready;
+        {
+            std::lock_guard<std::mutex> lock(sampler->Mutex);
+
+            sampler->Samples.Data.insert(sampler->Samples.Data.end(), payload.begin(), payload.end());
+            sampler->Samples.Sizes.push_back(payload.size());
+
+            if (sampler->Samples.Sizes.size() < _sampleTarget)
+                return nullptr;
+
+            // exactly one reservation completes the set, Taken keeps everyone out from here on
+            ready = std::move(sampler->Samples);
+            sampler->Samples = {};
+        }
+
+        ZstdDictionaries::Instance().QueueTraining(shared_from_this(), opcode, std::move(ready));
+        return nullptr;
+    }
+
+    bool DictionarySet::Train(uint32 opcode, DictionarySamples const& samples)
+    {
+        if (_samplingOff.load(std::memory_order_relaxed))
+        {
+            Publish(opcode, nullptr);
+            return false;
+        }
+
+        std::vector<uint8> buffer(DICT_CAPACITY);
+        size_t size = ZDICT_trainFromBuffer(buffer.data(), buffer.size(), samples.Data.data(), samples.Sizes.data(),
+            static_cast<unsigned>(samples.Sizes.size()));
+
+        if (ZDICT_isError(size))
+        {
+            LOG("Zstd dictionary training failed for {} opcode 0x{:X}: {}", _parserVersion, opcode, ZDICT_getErrorName(size));
+            Publish(opcode, nullptr);
+            return true;
+        }
+        buffer.resize(size);
+
+        std::shared_ptr<ZstdDictionary const> stored;
+        try
+        {
+            // only used once persisted, a blob must never reference a dictionary nobody can load
+            stored = StoreDictionary(_parserVersion, _format, opcode, std::make_shared<ZstdDictionary const>(std::move(buffer)), samples.Sizes.size());
+        }
+        catch (std::exception const& e)
+        {
+            LOG("WARNING: Cannot store zstd dictionary for {} opcode 0x{:X}, no more sampling this run: {}", _parserVersion, opcode, e.what());
+            Publish(opcode, nullptr);
+            return false;
+        }
+
+        if (stored)
+            LOG("Zstd dictionary {} for {} opcode 0x{:X} ({} samples, {} bytes)", stored->GetId(), _parserVersion, opcode,
+                samples.Sizes.size(), stored->GetData().size());
+
+        Publish(opcode, std::move(stored));
+        return true;
+    }
+
+    ZstdDictionaries& ZstdDictionaries::Instance()
+    {
+        static ZstdDictionaries instance;
+        return instance;
+    }
+
+    ZstdDictionaries::~ZstdDictionaries()
+    {
+        // sets still waiting are dropped, their opcodes are sampled again next run
+        {
+            std::lock_guard<std::mutex> lock(_trainMutex);
+            _trainerStop = true;
+            _trainJobs.clear();
+        }
+        _trainCondition.notify_all();
+
+        if (_trainer.joinable())
+            _trainer.join();
+    }
+
+    void ZstdDictionaries::QueueTraining(std::shared_ptr<DictionarySet> set, uint32 opcode, DictionarySamples samples)
+    {
+        {
+            std::lock_guard<std::mutex> lock(_trainMutex);
+            if (_trainerStop)
+                return;
+
+            _trainJobs.push_back(TrainJob{ std::move(set), opcode, std::move(samples) });
+            if (!_trainer.joinable())
+                _trainer = std::thread(&ZstdDictionaries::TrainerThread, this);
+        }
+        _trainCondition.notify_one();
+    }
+
+    void ZstdDictionaries::TrainerThread()
+    {
+        while (true)
+        {
+            TrainJob job;
+            {
+                std::unique_lock<std::mutex> lock(_trainMutex);
+                _trainCondition.wait(lock, [this] { return !_trainJobs.empty() || _trainerStop; });
+                if (_trainerStop)
+                    return;
+
+                job = std::move(_trainJobs.front());
+                _trainJobs.pop_front();
+            }
+
+            // postgres unreachable: one failed connect per run, not one per opcode
+            if (!job.Set->Train(job.Opcode, job.Samples))
+                job.Set->StopSampling();
+        }
+    }
+
+    std::shared_ptr<DictionarySet> ZstdDictionaries::GetSet(std::string const& parserVersion, BlobFormat format)
+    {
+        size_t sampleTarget = Config::GetZstdDictionarySamples();
+        if (sampleTarget == 0)
+            return nullptr;
+
+        std::string key = parserVersion + '/' + BlobFormatName(format);
+
+        std::shared_ptr<DictionarySet> set;
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            auto it = _sets.find(key);
+            if (it != _sets.end())
+                return it->second;
+
+            set = std::make_shared<DictionarySet>(parserVersion, format, sampleTarget);
+            _sets.emplace(key, set);
+        }
+
+        set->Load();
+        return set;
+    }
+
+    void ZstdDictionaries::Register(std::shared_ptr<ZstdDictionary const> const& dict)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _byId[dict->GetId()] = dict;
+    }
+
+    std::shared_ptr<ZstdDictionary const> ZstdDictionaries::Find(uint32 dictId)
+    {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            auto it = _byId.find(dictId);
+            if (it != _byId.end())
+                return it->second;
+        }
+
+        pqxx::connection conn(Config::GetPostgresConnectionString());
+        pqxx::work txn(conn);
+        pqxx::result rows = txn.exec_params("SELECT dict_data FROM zstd_dictionaries WHERE dict_id = $1", static_cast<int32>(dictId));
+        txn.commit();
+
+        if (rows.empty())
+            return nullptr;
+
+        std::shared_ptr<ZstdDictionary const> dict = FromBytea(rows[0]["dict_data"]);
+        Register(dict);
+        return dict;
+    }
+
+    std::string ZstdDictionaries::Decompress(std::span<uint8 const> blob)
+    {
+        static thread_local std::unique_ptr<ZSTD_DCtx, decltype(&ZSTD_freeDCtx)> t_dctx{ ZSTD_createDCtx(), ZSTD_freeDCtx };
+
+        unsigned long long contentSize = ZSTD_getFrameContentSize(blob.data(), blob.size());
+        if (contentSize == ZSTD_CONTENTSIZE_ERROR || contentSize == ZSTD_CONTENTSIZE_UNKNOWN)
+            throw ParseException{ "Decompress: not a zstd frame with known size" };
+
+        std::string out(contentSize, '\0');
+        size_t result;
+
+        uint32 dictId = ZSTD_getDictID_fromFrame(blob.data(), blob.size());
+        if (dictId != 0)
+        {
+            std::shared_ptr<ZstdDictionary const> dict = Find(dictId);
+            if (!dict)
+                throw ParseException{ fmt::format("Decompress: unknown zstd dictionary {}", dictId) };
+            result = ZSTD_decompress_usingDDict(t_dctx.get(), out.data(), out.size(), blob.data(), blob.size(), dict->GetDDict());
+        }
+        else
+            result = ZSTD_decompressDCtx(t_dctx.get(), out.data(), out.size(), blob.data(), blob.size());
+
+        if (ZSTD_isError(result))
+            throw ParseException{ fmt::format("Decompress: {}", ZSTD_getErrorName(result)) };
+
+        out.resize(result);
+        return out;
+    }
+}
@@ -0,0 +1,141 @@
+#pragma once
+
+#include "Misc/Define.h"
+#include "Common/RecordFormat.h"
+
+#include <memory>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <deque>
+#include <thread>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <unordered_map>
+#include <zstd.h>
+
+namespace PktParser::Db
+{
+    // a trained dictionary with its digested compression and decompression forms, immutable once built
+    class ZstdDictionary
+    {
+    private:
+        uint32 _id;
+        std::vector<uint8> _data;
+        ZSTD_CDict* _cdict;
+        ZSTD_DDict* _ddict;
+
+    public:
+        explicit ZstdDictionary(std::vector<uint8> data);
+        ~ZstdDictionary();
+
+        ZstdDictionary(ZstdDictionary const&) = delete;
+        ZstdDictionary& operator=(ZstdDictionary const&) = delete;
+
+        uint32 GetId() const { return _id; }
+        std::span<uint8 const> GetData() const { return _data; }
+        ZSTD_CDict const* GetCDict() const { return _cdict; }
+        ZSTD_DDict const* GetDDict() const { return _ddict; }
+    };
+
+    struct DictionarySamples
+    {
+        std::vector<uint8> Data;
+        std::vector<size_t> Sizes;
+    };
+
+    // dictionaries of one (parser version, blob format), trained from the first packets of each opcode
+    class DictionarySet : public std::enable_shared_from_this<DictionarySet>
+    {
+    public:
+        // a null entry means the opcode was tried and is compressed without a dictionary
+        using Table = std::unordered_map<uint32, std::shared_ptr<ZstdDictionary const>>;
+
+    private:
+        // open addressing, a power of two comfortably above the opcodes of one version
+        static constexpr size_t SAMPLER_SLOTS = 8192;
+
+        // one opcode still without a dictionary, found without a lock and closed for good once Taken reaches the target
+        struct Sampler
+        {
+            std::atomic<uint32> Key{ 0 };       // opcode + 1, 0 while the slot is free
+            std::atomic<size_t> Taken{ 0 };     // samples reserved, only ever grows to the target
+            std::mutex Mutex;                   // only held while one of those samples is copied in
+            DictionarySamples Samples;
+        };
+
+        std::string _parserVersion;
+        Common::BlobFormat _format;
+        size_t _sampleTarget;
+
+        // copy-on-write like OpcodeCache, workers only ever load the pointer
+        std::atomic<std::shared_ptr<Table const>> _table{ std::make_shared<Table const>() };
+        std::mutex _writeMutex;
+        std::unique_ptr<Sampler[]> _samplers;
+        // set once storing failed, nothing trained here could be used so nothing more is sampled
+        std::atomic<bool> _samplingOff{ false };
+
+        Sampler* FindSampler(uint32 opcode);
+        void Publish(uint32 opcode, std::shared_ptr<ZstdDictionary const> dict);
+
+    public:
+        DictionarySet(std::string parserVersion, Common::BlobFormat format, size_t sampleTarget);
+
+        void Load();
+
+        // workers grab this once per batch and keep it for every packet in it
+        std::shared_ptr<Table const> GetTable() const { return _table.load(std::memory_order_acquire); }
+
+        // dictionary for this opcode if there is one yet, otherwise the payload may be kept as a training sample
+        // lock free unless the payload is taken, full sample sets are trained on the trainer thread
+        ZSTD_CDict const* Select(Table const& table, uint32 opcode, std::string_view payload);
+
+        // trainer thread only, false if the dictionary could not be stored
+        bool Train(uint32 opcode, DictionarySamples const& samples);
+        void StopSampling() { _samplingOff.store(true, std::memory_order_relaxed); }
+    };
+
+    class ZstdDictionaries
+    {
+    private:
+        ZstdDictionaries() = default;
+        ~ZstdDictionaries();
+
+        struct TrainJob
+        {
+            std::shared_ptr<DictionarySet> Set;
+            uint32 Opcode;
+            DictionarySamples Samples;
+        };
+
+        std::mutex _mutex;
+        std::unordered_map<std::string, std::shared_ptr<DictionarySet>> _sets;
+        std::unordered_map<uint32, std::shared_ptr<ZstdDictionary const>> _byId;
+
+        // training and the postgres round trip never run on a parse worker, one thread takes them in turn
+        std::mutex _trainMutex;
+        std::condition_variable _trainCondition;
+        std::deque<TrainJob> _trainJobs;
+        std::thread _trainer;
+        bool _trainerStop = false;
+
+        void TrainerThread();
+
+    public:
+        static ZstdDictionaries& Instance();
+
+        // queues a full sample set, the trainer is started by the first one
+        void QueueTraining(std::shared_ptr<DictionarySet> set, uint32 opcode, DictionarySamples samples);
+
+        // nullptr when dictionaries are disabled (ZSTD_DICT_SAMPLES=0)
+        std::shared_ptr<DictionarySet> GetSet(std::string const& parserVersion, Common::BlobFormat format);
+
+        void Register(std::shared_ptr<ZstdDictionary const> const& dict);
+        std::shared_ptr<ZstdDictionary const> Find(uint32 dictId);
+
+        // read side: blobs written with a dictionary carry its id in the zstd frame header
+        std::string Decompress(std::span<uint8 const> blob);
+    };
+}
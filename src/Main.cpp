@@ -7,7 +7,12 @@
 #include "IVersionParser.h"
 #include "Database/BuildInfo.h"
 #include "Database/OpcodeCache.h"
+#include "Database/Config.h"
+#include "Database/PacketArchive.h"
+#include "Database/CheckpointJournal.h"
 #include "Utilities.h"
+#include "Misc/CpuTopology.h"
+#include "Misc/FilePlan.h"
 
 #ifdef HAS_DROGON
 #include <drogon/HttpAppFramework.h>
@@ -21,6 +26,66 @@ using namespace PktParser::Db;
 
 using Stats = PktParser::ParallelProcessor::Stats;
 
+// --extract <archive> <first-packet> <last-packet> | --extract <archive> --time <from-ms> <to-ms>
+static int ExtractArchive(int argc, char* argv[])
+{
+	if (argc < 5)
+	{
+		LOG("Archive usage: {} --extract <file.ndjson.zst> <first-packet> <last-packet> | --time <from-ms> <to-ms>", argv[0]);
+		return 1;
+	}
+
+	try
+	{
+		PacketArchiveReader archive(argv[2]);
+
+		std::string lines;
+		if (std::string_view(argv[3]) == "--time" && argc >= 6)
+			lines = archive.ReadTimeRange(std::stoll(argv[4]), std::stoll(argv[5]));
+		else
+			lines = archive.ReadPackets(static_cast<uint32>(std::stoul(argv[3])), static_cast<uint32>(std::stoul(argv[4])));
+
+		fwrite(lines.data(), 1, lines.size(), stdout);
+		return 0;
+	}
+	catch (std::exception const& e)
+	{
+		LOG("ERROR extracting from {}: {}", argv[2], e.what());
+		return 1;
+	}
+}
+
+// --plan <dir> <max-batch-mb> <out-prefix>: writes <out-prefix>000, 001... with one capture path per line
+static int PlanBatchFiles(int argc, char* argv[])
+{
+	if (argc < 5)
+	{
+		LOG("Plan usage: {} --plan <pkt-dir> <max-batch-mb> <out-prefix>", argv[0]);
+		return 1;
+	}
+
+	std::vector<PktFile> files = CollectPktFiles(argv[2]);
+	uint64 budget = std::stoull(argv[3]) * 1024 * 1024;
+	std::vector<std::vector<PktFile>> batches = PlanBatches(files, budget);
+
+	for (size_t i = 0; i < batches.size(); ++i)
+	{
+		std::string path = fmt::format("{}{:03}", argv[4], i);
+		std::unique_ptr<FILE, decltype(&fclose)> out(fopen(path.c_str(), "w"), &fclose);
+		if (!out)
+		{
+			LOG("ERROR: cannot write batch list {}", path);
+			return 1;
+		}
+
+		for (PktFile const& file : batches[i])
+			fmt::print(out.get(), "{}\n", std::filesystem::absolute(file.Path).string());
+	}
+
+	LOG("Planned {} file(s) into {} batch(es) of at most {} MB", files.size(), batches.size(), argv[3]);
+	return 0;
+}
+
 int main(int argc, char* argv[])
 {
 	Logger::Instance().Init("pkt_parser.log");
@@ -28,18 +93,33 @@ int main(int argc, char* argv[])
 	if (argc < 2)
 	{
 		LOG("Server usage: {} --serve", argv[0]);
-		LOG("Parser usage: {} <path-to-pkt-file> [--parser-version V11_2_5_63506]", argv[0]);
+		LOG("Parser usage: {} <path-to-pkt-file> [--parser-version V11_2_5_63506] [--export] [--parquet] [--archive] [--ordered] [--resume] [--reingest] [--refresh-metadata]", argv[0]);
+		LOG("  --export skips duplicates within the run only: file_metadata is written before sstableloader runs, so it says nothing about");
+		LOG("  whether the packets loaded; a direct run over captures whose load failed needs --reingest");
+		LOG("  --refresh-metadata fetches builds and opcodes from Postgres into the snapshot, without a snapshot the embedded tables are used");
+		LOG("Archive usage: {} --extract <file.ndjson.zst> <first-packet> <last-packet>", argv[0]);
+		LOG("Plan usage: {} --plan <pkt-dir> <max-batch-mb> <out-prefix>", argv[0]);
         return 1;
 	}
 
 	std::string inputPath = argv[1];
     std::string forcedParserVersion = "";
     bool toCSV = false;
+	bool toParquet = false;
+	bool toArchive = false;
+	bool ordered = false;
+	bool resume = false;
+	bool reingest = false;
 	bool serveRequested = false;
+	bool refreshMetadata = false;
 
 	std::string arg = argv[1];
 	if (arg == "--serve")
 		serveRequested = true;
+	else if (arg == "--extract")
+		return ExtractArchive(argc, argv);
+	else if (arg == "--plan")
+		return PlanBatchFiles(argc, argv);
 	else
     {
 		for (int i = 2; i < argc; i++)
@@ -52,11 +132,23 @@ int main(int argc, char* argv[])
 			}
 			else if (arg == "--export")
 				toCSV = true;
+			else if (arg == "--parquet")
+				toParquet = true;
+			else if (arg == "--archive")
+				toArchive = true;
+			else if (arg == "--ordered")
+				ordered = true;
+			else if (arg == "--resume")
+				resume = true;
+			else if (arg == "--reingest")
+				reingest = true;
+			else if (arg == "--refresh-metadata")
+				refreshMetadata = true;
 		}
 	}
 	
 	curl_global_init(CURL_GLOBAL_DEFAULT);
-	BuildInfo::Instance().Initialize();
+	BuildInfo::Instance().Initialize(refreshMetadata);
 
 	std::optional<Database> db;
 	db.emplace();
@@ -78,6 +170,27 @@ int main(int argc, char* argv[])
 			}, { drogon::Get }
 		);
 
+		// the refresh blocks on postgres, it runs on BuildInfo's refresher thread and answers from there, never on the event loop
+		drogon::app().registerHandler("/api/metadata/refresh",
+			[](drogon::HttpRequestPtr const&, std::function<void(drogon::HttpResponsePtr const&)>&& callback)
+			{
+				BuildInfo::Instance().RefreshAsync([callback = std::move(callback)](bool refreshed)
+				{
+					Json::Value json;
+					json["refreshed"] = refreshed;
+					drogon::HttpResponsePtr res = drogon::HttpResponse::newHttpJsonResponse(json);
+					callback(res);
+				});
+			}, { drogon::Post }
+		);
+
+		std::chrono::seconds refreshInterval = Config::GetMetadataRefreshInterval();
+		if (refreshInterval.count() > 0)
+		{
+			LOG("Metadata refresh every {}s", refreshInterval.count());
+			drogon::app().getLoop()->runEvery(refreshInterval, []{ BuildInfo::Instance().RefreshAsync(); });
+		}
+
 		drogon::app().run();
 
 		curl_global_cleanup();
@@ -88,24 +201,64 @@ int main(int argc, char* argv[])
 	#endif
 	}
 
-	std::vector<std::filesystem::path> files = Misc::CollectPktFiles(inputPath);
+	std::vector<PktFile> files = Misc::CollectPktFiles(inputPath);
 	if (files.empty())
 	{
         LOG("No .pkt files found in '{}'", inputPath);
         curl_global_cleanup();
         return 0;
 	}
-	LOG("Found {} .pkt file(s) to process", files.size());
+	uint64 totalBytes = 0;
+	for (PktFile const& file : files)
+		totalBytes += file.Size;
+	LOG("Found {} .pkt file(s) to process, {:.2f} GB, largest first", files.size(), totalBytes / (1024.0 * 1024.0 * 1024.0));
+
+	// what the sinks acknowledged, a later --resume skips finished files and picks unfinished ones up after their last acknowledged batch
+	std::optional<CheckpointJournal> journal;
+	std::string checkpointPath = Config::GetCheckpointPath();
+	if (!checkpointPath.empty())
+	{
+		try
+		{
+			journal.emplace(checkpointPath, resume);
+		}
+		catch (std::exception const& e)
+		{
+			LOG("ERROR: {}", e.what());
+			curl_global_cleanup();
+			return 1;
+		}
+
+		if (resume)
+			LOG("Resuming from {}: {} file(s) recorded", checkpointPath, journal->GetLoadedCount());
+		if (resume && (toCSV || toParquet))
+			LOG("WARNING: --resume with --export/--parquet rewrites the output files, keep what the earlier run produced");
+	}
+	else if (resume)
+		LOG("WARNING: --resume without CHECKPOINT_PATH, nothing to resume from");
 
 	std::unordered_map<std::string, VersionContext> versionCache;
+	std::mutex versionMutex;
 
-	ParallelProcessor processor(db ? &(*db) : nullptr, 0, toCSV);
 	ParallelProcessor::Stats totalStats{};
-	LOG("Using {} threads", processor.GetThreadCount());
+	std::mutex totalsMutex;
 
-    auto globalStart = std::chrono::high_resolution_clock::now();
+	// numa: one reader and pool per node, files split between them by size; cores: one pool, reader and workers one per core
+	AffinityPolicy affinity = Config::GetAffinityPolicy();
+	CpuTopology topology = CpuTopology::Detect();
+	size_t shardCount = affinity == AffinityPolicy::Numa ? topology.GetNodes().size() : 1;
+	LOG("CPU topology: {}, affinity: {}{}", topology.Describe(), AffinityPolicyName(affinity),
+		shardCount > 1 ? fmt::format(", {} readers", shardCount) : std::string());
 
-	for (auto const& filePath : files)
+	Common::BlobFormat blobFormat = toCSV ? Config::GetCsvBlobFormat() : Config::GetCassandraBlobFormat();
+	LOG("Packet blobs: {} ({} sink), storage layout: {}", Common::BlobFormatName(blobFormat), toCSV ? "export" : "cassandra",
+		StorageLayoutName(Config::GetStorageLayout()));
+	if (ordered)
+		LOG("Ordered output: export, parquet, archive and search bulks are committed in packet order");
+	if (toParquet)
+		LOG("Spell casts to parquet/ ({} rows per row group, {})", Config::GetParquetRowGroupRows(), Misc::ParquetCompressionName(Config::GetParquetCompression()));
+
+	auto submitFile = [&](ParallelProcessor& processor, std::filesystem::path const& filePath)
 	{
 		LOG("--- Processing: {} ---", filePath.string());
 
@@ -114,50 +267,110 @@ int main(int argc, char* argv[])
 			PktFileReader reader(filePath.string().c_str());
 			reader.ParseFileHeader();
 			uint32 build = reader.GetFileHeader().clientBuild;
-			
+
 			std::string parserVersion = forcedParserVersion;
-			if (parserVersion.empty())
+			IVersionParser* parser = nullptr;
 			{
-				std::optional<BuildMapping> mapping = BuildInfo::Instance().GetMapping(build);
-				if (!mapping.has_value())
+				std::lock_guard<std::mutex> lock(versionMutex);
+				if (parserVersion.empty())
 				{
-					LOG("SKIP: Build {} not supported, skipping {}", build, filePath.string());
-					continue;
+					std::optional<BuildMapping> mapping = BuildInfo::Instance().GetMapping(build);
+					if (!mapping.has_value())
+					{
+						LOG("SKIP: Build {} not supported, skipping {}", build, filePath.string());
+						return;
+					}
+					parserVersion = mapping->ParserVersion;
+					LOG("Build {} (patch {}) -> parser {}", build, mapping->PatchVersion, parserVersion);
 				}
-				parserVersion = mapping->ParserVersion;
-				LOG("Build {} (patch {}) -> parser {}", build, mapping->PatchVersion, parserVersion);
-			}
 
-			OpcodeCache::Instance().EnsureLoaded(parserVersion);
-			if (OpcodeCache::Instance().GetOpcodeCount(parserVersion) == 0)
-			{
-				LOG("SKIP: No opcodes for parser {}, skipping {}", parserVersion, filePath.string());
-				continue;
-			}
+				OpcodeCache::Instance().EnsureLoaded(parserVersion);
+				if (OpcodeCache::Instance().GetOpcodeCount(parserVersion) == 0)
+				{
+					LOG("SKIP: No opcodes for parser {}, skipping {}", parserVersion, filePath.string());
+					return;
+				}
 
-			if (!versionCache.contains(parserVersion))
-			{
-				if (!VersionFactory::IsSupported(build))
+				if (!versionCache.contains(parserVersion))
 				{
-					LOG("SKIP: Build {} not supported, skipping {}", build, filePath.string());
-					continue;
+					if (!VersionFactory::IsSupported(build))
+					{
+						LOG("SKIP: Build {} not supported, skipping {}", build, filePath.string());
+						return;
+					}
+					VersionContext created = VersionFactory::Create(build);
+					if (created.Parser)
+						created.Parser->SetBlobFormat(blobFormat);
+					versionCache.emplace(parserVersion, std::move(created));
 				}
-				versionCache.emplace(parserVersion, VersionFactory::Create(build));
+				parser = versionCache.at(parserVersion).Parser;
 			}
 
-			VersionContext& ctx = versionCache.at(parserVersion);
-			ParallelProcessor::Stats stats = processor.ProcessFile(reader, ctx.Parser, build, parserVersion);
-
-			LOG("File done — Parsed: {}, Skipped: {}, Failed: {}, Time: {}ms", stats.ParsedCount, stats.SkippedCount, stats.FailedCount, stats.TotalTime);
+			processor.SubmitFile(reader, parser, build, parserVersion, [&totalStats, &totalsMutex, name = filePath.string()](Stats const& stats)
+			{
+				LOG("File done: {} — Parsed: {}, Skipped: {}, Failed: {}, Time: {}ms", name, stats.ParsedCount, stats.SkippedCount, stats.FailedCount, stats.TotalTime);
 
-			totalStats.ParsedCount += stats.ParsedCount;
-            totalStats.SkippedCount += stats.SkippedCount;
-            totalStats.FailedCount += stats.FailedCount;
+				std::lock_guard<std::mutex> lock(totalsMutex);
+				totalStats.ParsedCount += stats.ParsedCount;
+				totalStats.SkippedCount += stats.SkippedCount;
+				totalStats.FailedCount += stats.FailedCount;
+			});
 		}
 		catch (std::exception const& e)
         {
             LOG("ERROR processing {}: {}", filePath.string(), e.what());
         }
+	};
+
+	// balanced by bytes rather than by count, one huge capture doesn't leave a single reader running long after the rest
+	std::vector<std::vector<PktFile>> shardFiles = AssignLongestFirst(files, shardCount);
+
+	// runs on the thread that will read the shard's files, so pinning it first also places the pool's memory
+	auto runShard = [&](size_t shard)
+	{
+		ParallelProcessor::Placement placement{};
+		if (affinity == AffinityPolicy::Numa)
+			placement.Cpus = topology.GetNodes()[shard].Cpus;
+		else if (affinity == AffinityPolicy::Cores)
+			placement.Cpus = topology.GetCpus();
+
+		if (!placement.Cpus.empty() && !PinCurrentThread(std::span<uint32 const>(placement.Cpus).first(1)))
+			LOG("WARNING: could not pin the reader to cpu {}", placement.Cpus.front());
+
+		size_t threads = Config::GetParseThreads();
+		if (shardCount > 1 && threads != 0)
+			threads = std::max<size_t>(threads / shardCount, 1);
+		placement.Shard = shard;
+		placement.ShardCount = shardCount;
+
+		ParallelProcessor processor(db ? &(*db) : nullptr, threads, toCSV, toParquet, toArchive, ordered, placement);
+		processor.SetCheckpoint(journal ? &*journal : nullptr);
+		processor.SetSkipIngested(!reingest);
+		if (affinity == AffinityPolicy::None)
+			LOG("Using {} parse threads, {} elasticsearch senders", processor.GetThreadCount(), Config::GetEsSinkThreads());
+		else
+			LOG("Reader {}: cpu {}, {} parse threads on cpus {}, {} elasticsearch senders", shard, placement.Cpus.front(), processor.GetThreadCount(),
+				FormatCpuList(placement.Cpus.size() > 1 ? std::span<uint32 const>(placement.Cpus).subspan(1) : std::span<uint32 const>(placement.Cpus)),
+				Config::GetEsSinkThreads());
+
+		for (PktFile const& file : shardFiles[shard])
+			submitFile(processor, file.Path);
+
+		processor.WaitIdle();
+		processor.LogStageMetrics();
+	};
+
+    auto globalStart = std::chrono::high_resolution_clock::now();
+
+	if (shardCount == 1)
+		runShard(0);
+	else
+	{
+		std::vector<std::thread> shards;
+		for (size_t shard = 0; shard < shardCount; ++shard)
+			shards.emplace_back(runShard, shard);
+		for (auto& shard : shards)
+			shard.join();
 	}
 
 	auto globalEnd = std::chrono::high_resolution_clock::now();
@@ -0,0 +1,142 @@
+#include "pchdef.h"
+#include "Base64.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#define PKT_BASE64_X86 1
+#include <immintrin.h>
+#endif
+
+namespace PktParser::Misc
+{
+	namespace
+	{
+		constexpr char TABLE[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+		size_t EncodeScalar(char* out, uint8 const* data, size_t len)
+		{
+			size_t outPos = 0;
+			size_t i = 0;
+
+			for (; i + 2 < len; i += 3)
+			{
+				uint32 b = (static_cast<uint32>(data[i]) << 16) | (static_cast<uint32>(data[i + 1]) << 8) | static_cast<uint32>(data[i + 2]);
+				out[outPos++] = TABLE[(b >> 18) & 0x3F];
+				out[outPos++] = TABLE[(b >> 12) & 0x3F];
+				out[outPos++] = TABLE[(b >> 6) & 0x3F];
+				out[outPos++] = TABLE[b & 0x3F];
+			}
+
+			// handle remainder
+			if (i + 1 == len)
+			{
+				uint32 b = static_cast<uint32>(data[i]) << 16;
+				out[outPos++] = TABLE[(b >> 18) & 0x3F];
+				out[outPos++] = TABLE[(b >> 12) & 0x3F];
+				out[outPos++] = '=';
+				out[outPos++] = '=';
+			}
+			else if (i + 2 == len)
+			{
+				uint32 b = (static_cast<uint32>(data[i]) << 16) | (static_cast<uint32>(data[i + 1]) << 8);
+				out[outPos++] = TABLE[(b >> 18) & 0x3F];
+				out[outPos++] = TABLE[(b >> 12) & 0x3F];
+				out[outPos++] = TABLE[(b >> 6) & 0x3F];
+				out[outPos++] = '=';
+			}
+
+			return outPos;
+		}
+
+#ifdef PKT_BASE64_X86
+		/*
+		 * 12 input bytes -> 16 sextets -> 16 chars per 128 bit lane (Mula / Lemire):
+		 *   pshufb spreads each 3 byte group over a 32 bit word as [b1 b0 b2 b1],
+		 *   two multiplies move the four 6 bit fields into their own bytes,
+		 *   and a 16 entry pshufb table gives the offset that turns a sextet into its ascii char
+		 */
+		__attribute__((target("ssse3")))
+		__m128i EncodeLane(__m128i in)
+		{
+			in = _mm_shuffle_epi8(in, _mm_setr_epi8(1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10));
+
+			__m128i hi = _mm_mulhi_epu16(_mm_and_si128(in, _mm_set1_epi32(0x0FC0FC00)), _mm_set1_epi32(0x04000040));
+			__m128i lo = _mm_mullo_epi16(_mm_and_si128(in, _mm_set1_epi32(0x003F03F0)), _mm_set1_epi32(0x01000010));
+			__m128i sextets = _mm_or_si128(hi, lo);
+
+			// 0..25 -> 13, 26..51 -> 0, 52..61 -> 1..10, 62 -> 11, 63 -> 12
+			__m128i bucket = _mm_subs_epu8(sextets, _mm_set1_epi8(51));
+			bucket = _mm_or_si128(bucket, _mm_and_si128(_mm_cmpgt_epi8(_mm_set1_epi8(26), sextets), _mm_set1_epi8(13)));
+
+			__m128i offsets = _mm_setr_epi8('a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+				'0' - 52, '0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0);
+			return _mm_add_epi8(sextets, _mm_shuffle_epi8(offsets, bucket));
+		}
+
+		__attribute__((target("ssse3")))
+		size_t EncodeSsse3(char* out, uint8 const* data, size_t len)
+		{
+			size_t i = 0;
+			char* o = out;
+
+			// each step reads 16 bytes but consumes 12
+			for (; i + 16 <= len; i += 12, o += 16)
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(o), EncodeLane(_mm_loadu_si128(reinterpret_cast<__m128i const*>(data + i))));
+
+			return (o - out) + EncodeScalar(o, data + i, len - i);
+		}
+
+		__attribute__((target("avx2")))
+		size_t EncodeAvx2(char* out, uint8 const* data, size_t len)
+		{
+			size_t i = 0;
+			char* o = out;
+
+			__m256i const spread = _mm256_setr_epi8(1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10,
+				1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10);
+			__m256i const offsets = _mm256_setr_epi8('a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+				'0' - 52, '0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0,
+				'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+				'0' - 52, '0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0);
+
+			// 24 bytes per step, one 12 byte group per lane; the upper load reads up to i + 28
+			for (; i + 28 <= len; i += 24, o += 32)
+			{
+				__m128i low = _mm_loadu_si128(reinterpret_cast<__m128i const*>(data + i));
+				__m128i high = _mm_loadu_si128(reinterpret_cast<__m128i const*>(data + i + 12));
+				__m256i in = _mm256_shuffle_epi8(_mm256_inserti128_si256(_mm256_castsi128_si256(low), high, 1), spread);
+
+				__m256i hi = _mm256_mulhi_epu16(_mm256_and_si256(in, _mm256_set1_epi32(0x0FC0FC00)), _mm256_set1_epi32(0x04000040));
+				__m256i lo = _mm256_mullo_epi16(_mm256_and_si256(in, _mm256_set1_epi32(0x003F03F0)), _mm256_set1_epi32(0x01000010));
+				__m256i sextets = _mm256_or_si256(hi, lo);
+
+				__m256i bucket = _mm256_subs_epu8(sextets, _mm256_set1_epi8(51));
+				bucket = _mm256_or_si256(bucket, _mm256_and_si256(_mm256_cmpgt_epi8(_mm256_set1_epi8(26), sextets), _mm256_set1_epi8(13)));
+
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(o), _mm256_add_epi8(sextets, _mm256_shuffle_epi8(offsets, bucket)));
+			}
+
+			return (o - out) + EncodeSsse3(o, data + i, len - i);
+		}
+#endif
+
+		using EncodeFn = size_t(*)(char*, uint8 const*, size_t);
+
+		EncodeFn SelectEncoder()
+		{
+#ifdef PKT_BASE64_X86
+			__builtin_cpu_init();
+			if (__builtin_cpu_supports("avx2"))
+				return EncodeAvx2;
+			if (__builtin_cpu_supports("ssse3"))
+				return EncodeSsse3;
+#endif
+			return EncodeScalar;
+		}
+	}
+
+	size_t Base64EncodeTo(char* out, uint8 const* data, size_t len)
+	{
+		static EncodeFn const encode = SelectEncoder();
+		return encode(out, data, len);
+	}
+}
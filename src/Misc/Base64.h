@@ -0,0 +1,17 @@
+#pragma once
+
+#include "Define.h"
+
+#include <cstddef>
+
+namespace PktParser::Misc
+{
+	inline constexpr size_t Base64EncodedSize(size_t len)
+	{
+		return ((len + 2) / 3) * 4;
+	}
+
+	// writes Base64EncodedSize(len) chars to out, returns the number written
+	// standard alphabet with '=' padding, AVX2 / SSSE3 when the cpu has them
+	size_t Base64EncodeTo(char* out, uint8 const* data, size_t len);
+}
@@ -0,0 +1,160 @@
+#include "pchdef.h"
+#include "CpuTopology.h"
+
+#include <charconv>
+#include <fstream>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace PktParser::Misc
+{
+	std::optional<AffinityPolicy> ParseAffinityPolicy(std::string_view name)
+	{
+		if (name == "none")
+			return AffinityPolicy::None;
+		if (name == "cores")
+			return AffinityPolicy::Cores;
+		if (name == "numa")
+			return AffinityPolicy::Numa;
+		return std::nullopt;
+	}
+
+	char const* AffinityPolicyName(AffinityPolicy policy)
+	{
+		switch (policy)
+		{
+			case AffinityPolicy::Cores: return "cores";
+			case AffinityPolicy::Numa: return "numa";
+			default: return "none";
+		}
+	}
+
+	std::vector<uint32> ParseCpuList(std::string_view list)
+	{
+		std::vector<uint32> cpus;
+		while (!list.empty())
+		{
+			size_t comma = list.find(',');
+			std::string_view range = list.substr(0, comma);
+			list = comma == std::string_view::npos ? std::string_view() : list.substr(comma + 1);
+
+			while (!range.empty() && std::isspace(static_cast<unsigned char>(range.back())))
+				range.remove_suffix(1);
+
+			uint32 first = 0;
+			auto [end, ec] = std::from_chars(range.data(), range.data() + range.size(), first);
+			if (ec != std::errc{})
+				continue;
+
+			uint32 last = first;
+			if (end != range.data() + range.size() && *end == '-')
+				std::from_chars(end + 1, range.data() + range.size(), last);
+
+			for (uint32 cpu = first; cpu <= last; ++cpu)
+				cpus.push_back(cpu);
+		}
+		return cpus;
+	}
+
+	std::string FormatCpuList(std::span<uint32 const> cpus)
+	{
+		std::string out;
+		for (size_t i = 0; i < cpus.size();)
+		{
+			size_t j = i;
+			while (j + 1 < cpus.size() && cpus[j + 1] == cpus[j] + 1)
+				++j;
+
+			if (!out.empty())
+				out += ',';
+			out += j == i ? fmt::format("{}", cpus[i]) : fmt::format("{}-{}", cpus[i], cpus[j]);
+			i = j + 1;
+		}
+		return out;
+	}
+
+	CpuTopology CpuTopology::Detect()
+	{
+		std::vector<uint32> allowed;
+#ifdef __linux__
+		cpu_set_t set;
+		CPU_ZERO(&set);
+		if (sched_getaffinity(0, sizeof(set), &set) == 0)
+			for (uint32 cpu = 0; cpu < CPU_SETSIZE; ++cpu)
+				if (CPU_ISSET(cpu, &set))
+					allowed.push_back(cpu);
+#endif
+		if (allowed.empty())
+			for (uint32 cpu = 0; cpu < std::max(std::thread::hardware_concurrency(), 1u); ++cpu)
+				allowed.push_back(cpu);
+
+		CpuTopology topology;
+
+		std::error_code ec;
+		for (auto const& entry : std::filesystem::directory_iterator("/sys/devices/system/node", ec))
+		{
+			std::string name = entry.path().filename().string();
+			uint32 id = 0;
+			if (!name.starts_with("node") || std::from_chars(name.data() + 4, name.data() + name.size(), id).ec != std::errc{})
+				continue;
+
+			std::ifstream file(entry.path() / "cpulist");
+			std::string list;
+			std::getline(file, list);
+
+			NumaNode node{ id, {} };
+			for (uint32 cpu : ParseCpuList(list))
+				if (std::binary_search(allowed.begin(), allowed.end(), cpu))
+					node.Cpus.push_back(cpu);
+
+			// memory-only nodes and nodes outside our cpuset have nothing to run on
+			if (!node.Cpus.empty())
+				topology._nodes.push_back(std::move(node));
+		}
+
+		// no sysfs (containers, other platforms): one node with everything we may use
+		if (topology._nodes.empty())
+			topology._nodes.push_back(NumaNode{ 0, std::move(allowed) });
+
+		std::sort(topology._nodes.begin(), topology._nodes.end(), [](NumaNode const& a, NumaNode const& b) { return a.Id < b.Id; });
+		return topology;
+	}
+
+	std::vector<uint32> CpuTopology::GetCpus() const
+	{
+		std::vector<uint32> cpus;
+		for (NumaNode const& node : _nodes)
+			cpus.insert(cpus.end(), node.Cpus.begin(), node.Cpus.end());
+		return cpus;
+	}
+
+	std::string CpuTopology::Describe() const
+	{
+		std::string out = fmt::format("{} node{}:", _nodes.size(), _nodes.size() == 1 ? "" : "s");
+		for (size_t i = 0; i < _nodes.size(); ++i)
+			out += fmt::format("{} node{} {}", i ? "," : "", _nodes[i].Id, FormatCpuList(_nodes[i].Cpus));
+		return out;
+	}
+
+	bool PinCurrentThread(std::span<uint32 const> cpus)
+	{
+#ifdef __linux__
+		if (cpus.empty())
+			return false;
+
+		cpu_set_t set;
+		CPU_ZERO(&set);
+		for (uint32 cpu : cpus)
+			if (cpu < CPU_SETSIZE)
+				CPU_SET(cpu, &set);
+
+		return pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0;
+#else
+		(void)cpus;
+		return false;
+#endif
+	}
+}
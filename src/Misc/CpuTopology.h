@@ -0,0 +1,51 @@
+#pragma once
+
+#include "Define.h"
+
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace PktParser::Misc
+{
+	enum class AffinityPolicy : uint8
+	{
+		None,       // the scheduler places everything
+		Cores,      // reader and workers pinned one per core, one pool for the machine
+		Numa        // one reader and pool per numa node, pinned inside it, files sharded between nodes
+	};
+
+	std::optional<AffinityPolicy> ParseAffinityPolicy(std::string_view name);
+	char const* AffinityPolicyName(AffinityPolicy policy);
+
+	struct NumaNode
+	{
+		uint32 Id;
+		std::vector<uint32> Cpus;
+	};
+
+	// nodes and their cpus from sysfs, limited to the cpus this process may run on
+	class CpuTopology
+	{
+	private:
+		std::vector<NumaNode> _nodes;
+
+	public:
+		static CpuTopology Detect();
+
+		std::vector<NumaNode> const& GetNodes() const { return _nodes; }
+		// every usable cpu, node by node
+		std::vector<uint32> GetCpus() const;
+		// "2 nodes: node0 0-15,32-47, node1 16-31,48-63"
+		std::string Describe() const;
+	};
+
+	// "0-3,8,10-11" as written by the kernel
+	std::vector<uint32> ParseCpuList(std::string_view list);
+	std::string FormatCpuList(std::span<uint32 const> cpus);
+
+	// false if the platform can't pin or the kernel refused
+	bool PinCurrentThread(std::span<uint32 const> cpus);
+}
@@ -0,0 +1,39 @@
+#include "pchdef.h"
+#include "CsvWriter.h"
+
+namespace PktParser::Misc
+{
+	CsvWriter::CsvWriter(std::string path) : _file{ nullptr }, _path{ std::move(path) }, _buffer(BUFFER_BYTES), _size{ 0 }
+	{
+		_file = fopen(_path.c_str(), "w");
+		if (!_file)
+		{
+			LOG("ERROR: Cannot open CSV output '{}'", _path);
+			return;
+		}
+
+		// everything already arrives in large chunks, stdio buffering would only add a copy
+		setvbuf(_file, nullptr, _IONBF, 0);
+	}
+
+	CsvWriter::~CsvWriter()
+	{
+		Flush();
+		if (_file)
+			fclose(_file);
+	}
+
+	void CsvWriter::Flush()
+	{
+		if (_size == 0)
+			return;
+
+		if (_file)
+		{
+			size_t written = fwrite(_buffer.data(), 1, _size, _file);
+			if (written != _size)
+				LOG("ERROR: CSV write to '{}' failed ({} of {} bytes) - tmpfs full?", _path, written, _size);
+		}
+		_size = 0;
+	}
+}
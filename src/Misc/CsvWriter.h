@@ -0,0 +1,47 @@
+#pragma once
+
+#include "Define.h"
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+namespace PktParser::Misc
+{
+	// one worker's csv file, lines are formatted straight into a large buffer that goes out in single writes
+	class CsvWriter
+	{
+	private:
+		static constexpr size_t BUFFER_BYTES = 4 << 20;
+
+		FILE* _file;
+		std::string _path;
+		std::vector<char> _buffer;
+		size_t _size;
+
+	public:
+		explicit CsvWriter(std::string path);
+		~CsvWriter();
+
+		CsvWriter(CsvWriter const&) = delete;
+		CsvWriter& operator=(CsvWriter const&) = delete;
+
+		bool IsOpen() const { return _file != nullptr; }
+
+		// room for at least n bytes, the line is written through the pointer and closed with Commit
+		char* Reserve(size_t n)
+		{
+			if (_size + n > _buffer.size()) [[unlikely]]
+			{
+				Flush();
+				if (n > _buffer.size())
+					_buffer.resize(n);
+			}
+			return _buffer.data() + _size;
+		}
+
+		void Commit(char* end) { _size = end - _buffer.data(); }
+
+		void Flush();
+	};
+}
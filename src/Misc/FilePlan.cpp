@@ -0,0 +1,118 @@
+#include "pchdef.h"
+#include "FilePlan.h"
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+
+namespace PktParser::Misc
+{
+	namespace
+	{
+		// stat is mostly waiting on the filesystem, worth more threads than cores on network mounts
+		constexpr size_t STAT_THREADS = 16;
+		constexpr size_t STAT_CHUNK = 64;
+
+		void StatAll(std::vector<PktFile>& files)
+		{
+			std::atomic<size_t> next{ 0 };
+			auto worker = [&]
+			{
+				for (size_t begin; (begin = next.fetch_add(STAT_CHUNK, std::memory_order_relaxed)) < files.size();)
+				{
+					for (size_t i = begin; i < std::min(begin + STAT_CHUNK, files.size()); ++i)
+					{
+						std::error_code ec;
+						uintmax_t size = std::filesystem::file_size(files[i].Path, ec);
+						files[i].Size = ec ? 0 : static_cast<uint64>(size);
+					}
+				}
+			};
+
+			size_t threadCount = std::min(STAT_THREADS, (files.size() + STAT_CHUNK - 1) / STAT_CHUNK);
+			std::vector<std::thread> threads;
+			for (size_t i = 1; i < threadCount; ++i)
+				threads.emplace_back(worker);
+			worker();
+			for (auto& thread : threads)
+				thread.join();
+		}
+
+		bool LargerFirst(PktFile const& a, PktFile const& b)
+		{
+			return a.Size != b.Size ? a.Size > b.Size : a.Path < b.Path;
+		}
+	}
+
+	std::vector<PktFile> CollectPktFiles(std::string const& input)
+	{
+		namespace fs = std::filesystem;
+		std::vector<PktFile> files;
+
+		fs::path inputPath(input);
+
+		if (input.ends_with(".pkt"))
+		{
+			if (fs::exists(inputPath))
+				files.push_back(PktFile{ inputPath, 0 });
+		}
+		else if (fs::is_directory(inputPath))
+		{
+			// is_regular_file follows links, so a directory of symlinks to captures works too
+			std::error_code ec;
+			for (fs::recursive_directory_iterator itr(inputPath, fs::directory_options::skip_permission_denied, ec), end; !ec && itr != end; itr.increment(ec))
+				if (itr->path().extension() == ".pkt" && itr->is_regular_file(ec))
+					files.push_back(PktFile{ itr->path(), 0 });
+
+			if (ec)
+				LOG("WARNING: listing '{}' stopped early: {}", input, ec.message());
+		}
+
+		StatAll(files);
+		std::sort(files.begin(), files.end(), LargerFirst);
+		return files;
+	}
+
+	std::vector<std::vector<PktFile>> AssignLongestFirst(std::vector<PktFile> const& files, size_t queues)
+	{
+		std::vector<std::vector<PktFile>> assigned(std::max<size_t>(queues, 1));
+		std::vector<uint64> load(assigned.size(), 0);
+
+		std::vector<PktFile> sorted = files;
+		std::sort(sorted.begin(), sorted.end(), LargerFirst);
+
+		for (PktFile& file : sorted)
+		{
+			size_t lightest = std::min_element(load.begin(), load.end()) - load.begin();
+			load[lightest] += file.Size;
+			assigned[lightest].push_back(std::move(file));
+		}
+		return assigned;
+	}
+
+	std::vector<std::vector<PktFile>> PlanBatches(std::vector<PktFile> const& files, uint64 budgetBytes)
+	{
+		std::vector<std::vector<PktFile>> batches;
+		std::vector<uint64> used;
+
+		std::vector<PktFile> sorted = files;
+		std::sort(sorted.begin(), sorted.end(), LargerFirst);
+
+		for (PktFile& file : sorted)
+		{
+			size_t batch = 0;
+			while (batch < batches.size() && used[batch] + file.Size > budgetBytes)
+				++batch;
+
+			if (batch == batches.size())
+			{
+				batches.emplace_back();
+				used.push_back(0);
+			}
+
+			used[batch] += file.Size;
+			batches[batch].push_back(std::move(file));
+		}
+		return batches;
+	}
+}
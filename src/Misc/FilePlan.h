@@ -0,0 +1,27 @@
+#pragma once
+
+#include "Define.h"
+
+#include <filesystem>
+#include <string>
+#include <vector>
+
+namespace PktParser::Misc
+{
+	struct PktFile
+	{
+		std::filesystem::path Path;
+		uint64 Size;
+	};
+
+	// one .pkt file or every .pkt under a directory, subdirectories included, sizes stat'ed in parallel
+	// largest first, ties by path, so the order doesn't depend on the directory listing
+	std::vector<PktFile> CollectPktFiles(std::string const& input);
+
+	// longest processing time first: each file, largest first, goes to the queue with the fewest bytes so far,
+	// so small files end up filling whatever gap the big ones left between queues
+	std::vector<std::vector<PktFile>> AssignLongestFirst(std::vector<PktFile> const& files, size_t queues);
+
+	// first fit decreasing into batches of at most budgetBytes, a file larger than the budget gets a batch of its own
+	std::vector<std::vector<PktFile>> PlanBatches(std::vector<PktFile> const& files, uint64 budgetBytes);
+}
@@ -0,0 +1,97 @@
+#include "pchdef.h"
+#include "Fingerprint.h"
+
+#include <bit>
+#include <cstring>
+
+namespace PktParser::Misc
+{
+	namespace
+	{
+		constexpr uint64 PRIME1 = 0x9E3779B185EBCA87ULL;
+		constexpr uint64 PRIME2 = 0xC2B2AE3D27D4EB4FULL;
+		constexpr uint64 PRIME3 = 0x165667B19E3779F9ULL;
+		constexpr uint64 PRIME4 = 0x85EBCA77C2B2AE63ULL;
+		constexpr uint64 PRIME5 = 0x27D4EB2F165667C5ULL;
+
+		uint64 Read64(uint8 const* p)
+		{
+			uint64 v;
+			std::memcpy(&v, p, sizeof(v));
+			return v;
+		}
+
+		uint32 Read32(uint8 const* p)
+		{
+			uint32 v;
+			std::memcpy(&v, p, sizeof(v));
+			return v;
+		}
+
+		uint64 Round(uint64 acc, uint64 input)
+		{
+			acc += input * PRIME2;
+			acc = std::rotl(acc, 31);
+			return acc * PRIME1;
+		}
+
+		uint64 MergeRound(uint64 acc, uint64 val)
+		{
+			acc ^= Round(0, val);
+			return acc * PRIME1 + PRIME4;
+		}
+	}
+
+	uint64 Hash64(std::span<uint8 const> data, uint64 seed /*= 0*/)
+	{
+		uint8 const* p = data.data();
+		uint8 const* end = p + data.size();
+		uint64 h;
+
+		if (data.size() >= 32)
+		{
+			// four independent lanes, the loop is bound by loads rather than by the multiply chain
+			uint64 v1 = seed + PRIME1 + PRIME2;
+			uint64 v2 = seed + PRIME2;
+			uint64 v3 = seed;
+			uint64 v4 = seed - PRIME1;
+
+			for (uint8 const* limit = end - 32; p <= limit; p += 32)
+			{
+				v1 = Round(v1, Read64(p));
+				v2 = Round(v2, Read64(p + 8));
+				v3 = Round(v3, Read64(p + 16));
+				v4 = Round(v4, Read64(p + 24));
+			}
+
+			h = std::rotl(v1, 1) + std::rotl(v2, 7) + std::rotl(v3, 12) + std::rotl(v4, 18);
+			h = MergeRound(h, v1);
+			h = MergeRound(h, v2);
+			h = MergeRound(h, v3);
+			h = MergeRound(h, v4);
+		}
+		else
+			h = seed + PRIME5;
+
+		h += static_cast<uint64>(data.size());
+
+		for (; p + 8 <= end; p += 8)
+			h = std::rotl(h ^ Round(0, Read64(p)), 27) * PRIME1 + PRIME4;
+
+		if (p + 4 <= end)
+		{
+			h = std::rotl(h ^ (static_cast<uint64>(Read32(p)) * PRIME1), 23) * PRIME2 + PRIME3;
+			p += 4;
+		}
+
+		for (; p < end; ++p)
+			h = std::rotl(h ^ (*p * PRIME5), 11) * PRIME1;
+
+		h ^= h >> 33;
+		h *= PRIME2;
+		h ^= h >> 29;
+		h *= PRIME3;
+		h ^= h >> 32;
+		return h;
+	}
+}
@@ -0,0 +1,184 @@
+#pragma once
+
+#include "Define.h"
+
+#include <atomic>
+#include <bit>
+#include <memory>
+#include <optional>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace PktParser::Misc
+{
+	/*
+	 * bounded multi-producer multi-consumer ring (Vyukov): every cell carries a sequence number, so a push or pop
+	 * is one CAS on the shared position plus a store on the cell, no lock
+	 * blocking callers spin briefly, then park on an atomic wait (a futex on linux) and are woken one at a time
+	 */
+	template<typename T>
+	class MpmcRing
+	{
+	private:
+		static constexpr size_t CACHE_LINE = 64;
+		static constexpr int32 SPIN_TRIES = 64;
+
+		struct Cell
+		{
+			std::atomic<size_t> Sequence;
+			std::optional<T> Value;
+		};
+
+		size_t _mask;
+		std::unique_ptr<Cell[]> _cells;
+
+		alignas(CACHE_LINE) std::atomic<size_t> _pushPos{ 0 };
+		alignas(CACHE_LINE) std::atomic<size_t> _popPos{ 0 };
+
+		// bumped after every push / pop, parked threads wait for them to move
+		alignas(CACHE_LINE) std::atomic<uint32> _pushed{ 0 };
+		std::atomic<uint32> _consumersParked{ 0 };
+		alignas(CACHE_LINE) std::atomic<uint32> _popped{ 0 };
+		std::atomic<uint32> _producersParked{ 0 };
+
+		std::atomic<bool> _closed{ false };
+
+		static void Pause()
+		{
+#if defined(__SSE2__)
+			_mm_pause();
+#endif
+		}
+
+		static void Signal(std::atomic<uint32>& counter, std::atomic<uint32> const& parked)
+		{
+			// seq_cst on both sides: either the parked thread is seen here, or it sees the new counter and does not sleep
+			counter.fetch_add(1);
+			if (parked.load() != 0)
+				counter.notify_one();
+		}
+
+		template<typename Try>
+		bool Blocking(Try&& attempt, std::atomic<uint32>& counter, std::atomic<uint32>& parked)
+		{
+			for (int32 i = 0; i < SPIN_TRIES; ++i)
+			{
+				if (attempt())
+					return true;
+				Pause();
+			}
+
+			while (true)
+			{
+				uint32 seen = counter.load();
+				if (attempt())
+					return true;
+				// one more look after seeing the flag, anything pushed before Close is visible now
+				if (_closed.load())
+					return attempt();
+
+				parked.fetch_add(1);
+				counter.wait(seen);
+				parked.fetch_sub(1);
+			}
+		}
+
+	public:
+		// capacity is rounded up to a power of two
+		explicit MpmcRing(size_t capacity)
+			: _mask{ std::bit_ceil(std::max<size_t>(capacity, 2)) - 1 }, _cells{ std::make_unique<Cell[]>(_mask + 1) }
+		{
+			for (size_t i = 0; i <= _mask; ++i)
+				_cells[i].Sequence.store(i, std::memory_order_relaxed);
+		}
+
+		MpmcRing(MpmcRing const&) = delete;
+		MpmcRing& operator=(MpmcRing const&) = delete;
+
+		size_t GetCapacity() const { return _mask + 1; }
+		// a snapshot for metrics, may be stale by the time it returns
+		size_t GetSize() const
+		{
+			size_t popped = _popPos.load(std::memory_order_relaxed);
+			size_t pushed = _pushPos.load(std::memory_order_relaxed);
+			return pushed > popped ? std::min(pushed - popped, _mask + 1) : 0;
+		}
+
+		bool TryPush(T& value)
+		{
+			size_t pos = _pushPos.load(std::memory_order_relaxed);
+			while (true)
+			{
+				Cell& cell = _cells[pos & _mask];
+				size_t seq = cell.Sequence.load(std::memory_order_acquire);
+				intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+
+				if (diff == 0)
+				{
+					if (_pushPos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+					{
+						cell.Value.emplace(std::move(value));
+						cell.Sequence.store(pos + 1, std::memory_order_release);
+						Signal(_pushed, _consumersParked);
+						return true;
+					}
+				}
+				else if (diff < 0)
+					return false;       // full
+				else
+					pos = _pushPos.load(std::memory_order_relaxed);
+			}
+		}
+
+		bool TryPop(T& out)
+		{
+			size_t pos = _popPos.load(std::memory_order_relaxed);
+			while (true)
+			{
+				Cell& cell = _cells[pos & _mask];
+				size_t seq = cell.Sequence.load(std::memory_order_acquire);
+				intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos + 1);
+
+				if (diff == 0)
+				{
+					if (_popPos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+					{
+						out = std::move(*cell.Value);
+						cell.Value.reset();
+						cell.Sequence.store(pos + _mask + 1, std::memory_order_release);
+						Signal(_popped, _producersParked);
+						return true;
+					}
+				}
+				else if (diff < 0)
+					return false;       // empty
+				else
+					pos = _popPos.load(std::memory_order_relaxed);
+			}
+		}
+
+		// waits for room, false only if the ring was closed first
+		bool Push(T value)
+		{
+			return Blocking([&] { return TryPush(value); }, _popped, _producersParked);
+		}
+
+		// waits for an item, false once the ring is closed and drained
+		bool Pop(T& out)
+		{
+			return Blocking([&] { return TryPop(out); }, _pushed, _consumersParked);
+		}
+
+		// wakes everyone, pops still drain what is left
+		void Close()
+		{
+			_closed.store(true);
+			_pushed.fetch_add(1);
+			_pushed.notify_all();
+			_popped.fetch_add(1);
+			_popped.notify_all();
+		}
+	};
+}
@@ -0,0 +1,347 @@
+#include "pchdef.h"
+#include "ParquetWriter.h"
+
+namespace PktParser::Misc
+{
+	namespace
+	{
+		constexpr char PARQUET_MAGIC[] = { 'P', 'A', 'R', '1' };
+		constexpr size_t WRITE_BUFFER_BYTES = 4 << 20;
+
+		// parquet.thrift enums used below
+		constexpr int32 PAGE_TYPE_DATA = 0;
+		constexpr int32 ENCODING_PLAIN = 0;
+		constexpr int32 ENCODING_RLE = 3;
+		constexpr int32 REPETITION_REQUIRED = 0;
+		constexpr int32 REPETITION_OPTIONAL = 1;
+		constexpr int32 CODEC_UNCOMPRESSED = 0;
+		constexpr int32 CODEC_ZSTD = 6;
+
+		void PutVarUInt(std::vector<uint8>& out, uint64 value)
+		{
+			while (value >= 0x80)
+			{
+				out.push_back(static_cast<uint8>(value | 0x80));
+				value >>= 7;
+			}
+			out.push_back(static_cast<uint8>(value));
+		}
+
+		// thrift compact protocol, just the parts the parquet footer and page headers need
+		class CompactWriter
+		{
+		private:
+			static constexpr uint8 TYPE_I32 = 5;
+			static constexpr uint8 TYPE_I64 = 6;
+			static constexpr uint8 TYPE_BINARY = 8;
+			static constexpr uint8 TYPE_LIST = 9;
+			static constexpr uint8 TYPE_STRUCT = 12;
+
+			std::vector<uint8>& _out;
+			std::vector<int16> _outerIds;
+			int16 _lastId = 0;
+
+			void FieldHeader(int16 id, uint8 type)
+			{
+				int16 delta = id - _lastId;
+				if (delta > 0 && delta <= 15)
+					_out.push_back(static_cast<uint8>((delta << 4) | type));
+				else
+				{
+					_out.push_back(type);
+					PutVarUInt(_out, static_cast<uint16>((id << 1) ^ (id >> 15)));
+				}
+				_lastId = id;
+			}
+
+			void BeginList(int16 id, uint8 elementType, size_t size)
+			{
+				FieldHeader(id, TYPE_LIST);
+				if (size < 15)
+					_out.push_back(static_cast<uint8>((size << 4) | elementType));
+				else
+				{
+					_out.push_back(static_cast<uint8>(0xF0 | elementType));
+					PutVarUInt(_out, size);
+				}
+			}
+
+			void PutI32(int32 value) { PutVarUInt(_out, static_cast<uint32>((value << 1) ^ (value >> 31))); }
+			void PutI64(int64 value) { PutVarUInt(_out, static_cast<uint64>((value << 1) ^ (value >> 63))); }
+
+			void PutString(std::string_view value)
+			{
+				PutVarUInt(_out, value.size());
+				_out.insert(_out.end(), value.begin(), value.end());
+			}
+
+		public:
+			explicit CompactWriter(std::vector<uint8>& out) : _out{ out } {}
+
+			void I32(int16 id, int32 value) { FieldHeader(id, TYPE_I32); PutI32(value); }
+			void I64(int16 id, int64 value) { FieldHeader(id, TYPE_I64); PutI64(value); }
+			void String(int16 id, std::string_view value) { FieldHeader(id, TYPE_BINARY); PutString(value); }
+
+			void I32List(int16 id, std::initializer_list<int32> values)
+			{
+				BeginList(id, TYPE_I32, values.size());
+				for (int32 value : values)
+					PutI32(value);
+			}
+
+			void StringList(int16 id, std::initializer_list<std::string_view> values)
+			{
+				BeginList(id, TYPE_BINARY, values.size());
+				for (std::string_view value : values)
+					PutString(value);
+			}
+
+			void BeginStructList(int16 id, size_t size) { BeginList(id, TYPE_STRUCT, size); }
+
+			void BeginStruct(int16 id)
+			{
+				FieldHeader(id, TYPE_STRUCT);
+				BeginElement();
+			}
+
+			// a struct inside a list has no field header of its own
+			void BeginElement()
+			{
+				_outerIds.push_back(_lastId);
+				_lastId = 0;
+			}
+
+			void EndStruct()
+			{
+				_out.push_back(0);
+				_lastId = _outerIds.back();
+				_outerIds.pop_back();
+			}
+
+			// stop byte of the outermost struct
+			void EndMessage() { _out.push_back(0); }
+		};
+
+		// RLE / bit-packing hybrid at bit width 1, a single run either way
+		void PutDefinitionLevels(std::vector<uint8>& out, std::span<uint8 const> valid)
+		{
+			size_t lengthAt = out.size();
+			out.resize(lengthAt + 4);
+
+			bool allSame = std::all_of(valid.begin(), valid.end(), [&](uint8 v) { return (v != 0) == (valid[0] != 0); });
+			if (allSame)
+			{
+				PutVarUInt(out, static_cast<uint64>(valid.size()) << 1);
+				out.push_back(valid[0] != 0 ? 1 : 0);
+			}
+			else
+			{
+				size_t groups = (valid.size() + 7) / 8;
+				PutVarUInt(out, (static_cast<uint64>(groups) << 1) | 1);
+				size_t bitsAt = out.size();
+				out.resize(bitsAt + groups, 0);
+				for (size_t i = 0; i < valid.size(); ++i)
+					if (valid[i])
+						out[bitsAt + i / 8] |= static_cast<uint8>(1 << (i % 8));
+			}
+
+			uint32 length = static_cast<uint32>(out.size() - lengthAt - 4);
+			std::memcpy(out.data() + lengthAt, &length, 4);
+		}
+	}
+
+	std::optional<ParquetCompression> ParseParquetCompression(std::string_view name)
+	{
+		if (name == "none")
+			return ParquetCompression::None;
+		if (name == "zstd")
+			return ParquetCompression::Zstd;
+		return std::nullopt;
+	}
+
+	char const* ParquetCompressionName(ParquetCompression compression)
+	{
+		return compression == ParquetCompression::Zstd ? "zstd" : "none";
+	}
+
+	ParquetWriter::ParquetWriter(std::string path, std::vector<ParquetColumn> columns, ParquetCompression compression)
+		: _file{ nullptr }, _path{ std::move(path) }, _columns{ std::move(columns) }, _compression{ compression }, _cctx{ nullptr },
+		_offset{ 0 }, _failed{ false }
+	{
+		_file = fopen(_path.c_str(), "wb");
+		if (!_file)
+		{
+			LOG("ERROR: Cannot open parquet output '{}'", _path);
+			return;
+		}
+		setvbuf(_file, nullptr, _IOFBF, WRITE_BUFFER_BYTES);
+
+		if (_compression == ParquetCompression::Zstd)
+		{
+			_cctx = ZSTD_createCCtx();
+			ZSTD_CCtx_setParameter(_cctx, ZSTD_c_compressionLevel, ZSTD_LEVEL);
+		}
+
+		Write(PARQUET_MAGIC, sizeof(PARQUET_MAGIC));
+	}
+
+	ParquetWriter::~ParquetWriter()
+	{
+		Close();
+		if (_cctx)
+			ZSTD_freeCCtx(_cctx);
+	}
+
+	void ParquetWriter::Write(void const* data, size_t size)
+	{
+		if (!_file || _failed)
+			return;
+
+		if (fwrite(data, 1, size, _file) != size)
+		{
+			LOG("ERROR: Parquet write to '{}' failed", _path);
+			_failed = true;
+			return;
+		}
+		_offset += static_cast<int64>(size);
+	}
+
+	void ParquetWriter::BeginRowGroup(size_t rows)
+	{
+		RowGroupMeta& group = _rowGroups.emplace_back();
+		group.Rows = static_cast<int64>(rows);
+		group.Chunks.reserve(_columns.size());
+	}
+
+	void ParquetWriter::WriteColumn(std::span<uint8 const> values, std::span<uint8 const> valid)
+	{
+		RowGroupMeta& group = _rowGroups.back();
+		ParquetColumn const& column = _columns[group.Chunks.size()];
+
+		// v1 page: definition levels (optional columns only) then the values, compressed together
+		_page.clear();
+		if (column.Optional && group.Rows > 0)
+			PutDefinitionLevels(_page, valid);
+		_page.insert(_page.end(), values.begin(), values.end());
+
+		std::span<uint8 const> data = _page;
+		if (_cctx)
+		{
+			_compressed.resize(ZSTD_compressBound(_page.size()));
+			size_t size = ZSTD_compress2(_cctx, _compressed.data(), _compressed.size(), _page.data(), _page.size());
+			if (ZSTD_isError(size))
+				throw ParseException{ fmt::format("Parquet page compression failed: {}", ZSTD_getErrorName(size)) };
+			data = std::span<uint8 const>(_compressed.data(), size);
+		}
+
+		_header.clear();
+		CompactWriter header(_header);
+		header.I32(1, PAGE_TYPE_DATA);
+		header.I32(2, static_cast<int32>(_page.size()));
+		header.I32(3, static_cast<int32>(data.size()));
+		header.BeginStruct(5);
+		header.I32(1, static_cast<int32>(group.Rows));
+		header.I32(2, ENCODING_PLAIN);
+		header.I32(3, ENCODING_RLE);
+		header.I32(4, ENCODING_RLE);
+		header.EndStruct();
+		header.EndMessage();
+
+		ChunkMeta& chunk = group.Chunks.emplace_back();
+		chunk.PageOffset = _offset;
+		chunk.UncompressedSize = static_cast<int64>(_header.size() + _page.size());
+		chunk.CompressedSize = static_cast<int64>(_header.size() + data.size());
+
+		Write(_header.data(), _header.size());
+		Write(data.data(), data.size());
+	}
+
+	void ParquetWriter::EndRowGroup()
+	{
+		if (_rowGroups.back().Chunks.size() != _columns.size())
+			throw ParseException{ fmt::format("Parquet row group in '{}' is missing columns", _path) };
+	}
+
+	void ParquetWriter::WriteFooter()
+	{
+		int64 totalRows = 0;
+		for (RowGroupMeta const& group : _rowGroups)
+			totalRows += group.Rows;
+
+		std::vector<uint8> footer;
+		CompactWriter meta(footer);
+		meta.I32(1, 1);
+
+		meta.BeginStructList(2, _columns.size() + 1);
+		meta.BeginElement();
+		meta.String(4, "schema");
+		meta.I32(5, static_cast<int32>(_columns.size()));
+		meta.EndStruct();
+		for (ParquetColumn const& column : _columns)
+		{
+			meta.BeginElement();
+			meta.I32(1, static_cast<int32>(column.Type));
+			if (column.Type == ParquetType::FixedLenByteArray)
+				meta.I32(2, column.TypeLength);
+			meta.I32(3, column.Optional ? REPETITION_OPTIONAL : REPETITION_REQUIRED);
+			meta.String(4, column.Name);
+			if (column.Converted != ParquetConvertedType::None)
+				meta.I32(6, static_cast<int32>(column.Converted));
+			meta.EndStruct();
+		}
+
+		meta.I64(3, totalRows);
+
+		meta.BeginStructList(4, _rowGroups.size());
+		for (RowGroupMeta const& group : _rowGroups)
+		{
+			meta.BeginElement();
+			meta.BeginStructList(1, group.Chunks.size());
+
+			int64 groupBytes = 0;
+			for (size_t i = 0; i < group.Chunks.size(); ++i)
+			{
+				ChunkMeta const& chunk = group.Chunks[i];
+				ParquetColumn const& column = _columns[i];
+				groupBytes += chunk.UncompressedSize;
+
+				meta.BeginElement();
+				meta.I64(2, chunk.PageOffset);
+				meta.BeginStruct(3);
+				meta.I32(1, static_cast<int32>(column.Type));
+				meta.I32List(2, { ENCODING_PLAIN, ENCODING_RLE });
+				meta.StringList(3, { column.Name });
+				meta.I32(4, _compression == ParquetCompression::Zstd ? CODEC_ZSTD : CODEC_UNCOMPRESSED);
+				meta.I64(5, group.Rows);
+				meta.I64(6, chunk.UncompressedSize);
+				meta.I64(7, chunk.CompressedSize);
+				meta.I64(9, chunk.PageOffset);
+				meta.EndStruct();
+				meta.EndStruct();
+			}
+
+			meta.I64(2, groupBytes);
+			meta.I64(3, group.Rows);
+			meta.EndStruct();
+		}
+
+		meta.String(6, "PktParser");
+		meta.EndMessage();
+
+		uint32 footerLength = static_cast<uint32>(footer.size());
+		Write(footer.data(), footer.size());
+		Write(&footerLength, sizeof(footerLength));
+		Write(PARQUET_MAGIC, sizeof(PARQUET_MAGIC));
+	}
+
+	void ParquetWriter::Close()
+	{
+		if (!_file)
+			return;
+
+		WriteFooter();
+		if (fclose(_file) != 0 && !_failed)
+			LOG("ERROR: Parquet write to '{}' failed", _path);
+		_file = nullptr;
+	}
+}
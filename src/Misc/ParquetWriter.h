@@ -0,0 +1,113 @@
+#pragma once
+
+#include "Define.h"
+
+#include <cstdio>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <zstd.h>
+
+namespace PktParser::Misc
+{
+	// parquet.thrift Type, only the fixed-width ones are written
+	enum class ParquetType : uint8
+	{
+		Boolean = 0,
+		Int32 = 1,
+		Int64 = 2,
+		Float = 4,
+		Double = 5,
+		FixedLenByteArray = 7
+	};
+
+	// parquet.thrift ConvertedType, read by every reader that predates LogicalType
+	enum class ParquetConvertedType : int8
+	{
+		None = -1,
+		UInt8 = 11,
+		UInt16 = 12,
+		UInt32 = 13,
+		UInt64 = 14,
+		Int8 = 15,
+		Int16 = 16,
+		Int32 = 17,
+		Int64 = 18
+	};
+
+	enum class ParquetCompression : uint8
+	{
+		None,
+		Zstd
+	};
+
+	std::optional<ParquetCompression> ParseParquetCompression(std::string_view name);
+	char const* ParquetCompressionName(ParquetCompression compression);
+
+	struct ParquetColumn
+	{
+		std::string Name;
+		ParquetType Type;
+		ParquetConvertedType Converted = ParquetConvertedType::None;
+		int32 TypeLength = 0;       // FixedLenByteArray only
+		bool Optional = false;
+	};
+
+	/*
+	 * flat schema, one data page (v1, PLAIN values, RLE definition levels) per column chunk
+	 * a row group is written column by column: BeginRowGroup, WriteColumn for each column in schema order, EndRowGroup
+	 */
+	class ParquetWriter
+	{
+	private:
+		static constexpr int32 ZSTD_LEVEL = 3;
+
+		struct ChunkMeta
+		{
+			int64 PageOffset;
+			int64 UncompressedSize;
+			int64 CompressedSize;
+		};
+
+		struct RowGroupMeta
+		{
+			int64 Rows;
+			std::vector<ChunkMeta> Chunks;
+		};
+
+		FILE* _file;
+		std::string _path;
+		std::vector<ParquetColumn> _columns;
+		ParquetCompression _compression;
+		ZSTD_CCtx* _cctx;
+		int64 _offset;
+		bool _failed;
+
+		std::vector<RowGroupMeta> _rowGroups;
+		std::vector<uint8> _page;
+		std::vector<uint8> _compressed;
+		std::vector<uint8> _header;
+
+		void Write(void const* data, size_t size);
+		void WriteFooter();
+
+	public:
+		ParquetWriter(std::string path, std::vector<ParquetColumn> columns, ParquetCompression compression);
+		~ParquetWriter();
+
+		ParquetWriter(ParquetWriter const&) = delete;
+		ParquetWriter& operator=(ParquetWriter const&) = delete;
+
+		bool IsOpen() const { return _file != nullptr; }
+
+		void BeginRowGroup(size_t rows);
+		// values: PLAIN encoding of the non-null rows only, valid: one byte per row, empty for required columns
+		void WriteColumn(std::span<uint8 const> values, std::span<uint8 const> valid);
+		void EndRowGroup();
+
+		// writes the footer, nothing is readable before this
+		void Close();
+	};
+}
@@ -1,5 +1,8 @@
 #pragma once
 
+#include "Base64.h"
+#include "Fingerprint.h"
+
 #include <string>
 #include <ctime>
 #include <fmt/core.h>
@@ -18,55 +21,31 @@
 
 namespace PktParser::Misc
 {
-	inline std::vector<std::filesystem::path> CollectPktFiles(std::string const& input)
+	// named by content, so the same capture gets the same id whoever sent it and under whatever name
+	inline CassUuid GenerateFileId(std::span<uint8 const> contents)
 	{
-		namespace fs = std::filesystem;
-		std::vector<fs::path> files;
-
-		fs::path inputPath(input);
-
-		if (input.ends_with(".pkt"))
-		{
-			if (fs::exists(inputPath))
-				files.push_back(inputPath);
-			return files;
-		}
+		uint64 content = Hash64(contents);
+		uint64 size = contents.size();
 
-		if (!fs::is_directory(inputPath))
-			return files;
+		CassUuid uuid;
+		uuid.time_and_version = content;
+		uuid.clock_seq_and_node = Hash64(std::span<uint8 const>(reinterpret_cast<uint8 const*>(&size), sizeof(size)), content);
 
-		for (auto const& entry : fs::directory_iterator(inputPath))
-			if (entry.is_regular_file() && entry.path().extension() == ".pkt")
-				files.push_back(entry.path());
+		uuid.time_and_version = (uuid.time_and_version & 0xFFFFFFFFFFFF0FFFULL) | 0x0000000000004000ULL;
+		uuid.clock_seq_and_node = (uuid.clock_seq_and_node & 0x3FFFFFFFFFFFFFFFULL) | 0x8000000000000000ULL;
 
-		std::sort(files.begin(), files.end());
-    	return files;
+		return uuid;
 	}
 
-	inline CassUuid GenerateFileId(uint32 startTime, size_t fileSize)
-    {
-        std::hash<uint64> hasher;
-
-        uint64 combined1 = (static_cast<uint64>(startTime) << 32) | static_cast<uint64>(fileSize & 0xFFFFFFFF);
-        uint64 combined2 = (static_cast<uint64>(fileSize) << 32) | static_cast<uint64>(startTime);
-        
-        CassUuid uuid;
-        uuid.time_and_version = hasher(combined1);
-        uuid.clock_seq_and_node = hasher(combined2);
-
-        uuid.time_and_version = (uuid.time_and_version & 0xFFFFFFFFFFFF0FFFULL) | 0x0000000000004000ULL;
-        uuid.clock_seq_and_node = (uuid.clock_seq_and_node & 0x3FFFFFFFFFFFFFFFULL) | 0x8000000000000000ULL;
-
-        return uuid;
-    }
-
 	inline thread_local std::vector<uint8> t_compressBuffer;
-	inline std::span<uint8 const> CompressJson(std::string const& json, ZSTD_CCtx* cctx)
+	// a dictionary, when given, stays referenced only for this call and its id goes into the frame header
+	inline std::span<uint8 const> CompressJson(std::string_view json, ZSTD_CCtx* cctx, ZSTD_CDict const* dict = nullptr)
     {
         size_t maxSize = ZSTD_compressBound(json.size());
         if (t_compressBuffer.size() < maxSize)
 			t_compressBuffer.resize(maxSize);
 
+        ZSTD_CCtx_refCDict(cctx, dict);
         size_t compressedSize = ZSTD_compress2(cctx, t_compressBuffer.data(), t_compressBuffer.size(), json.data(), json.size());
 
         if (ZSTD_isError(compressedSize))
@@ -82,12 +61,14 @@ namespace PktParser::Misc
         return std::span<uint8 const>(t_compressBuffer.data(), compressedSize);
     }
 
-	inline std::span<uint8 const> CompressData(std::vector<uint8> const& input, ZSTD_CCtx* cctx)
+	inline std::span<uint8 const> CompressData(std::span<uint8 const> input, ZSTD_CCtx* cctx)
     {
         size_t maxSize = ZSTD_compressBound(input.size());
         if (t_compressBuffer.size() < maxSize)
 			t_compressBuffer.resize(maxSize);
 
+        // the context may still reference a dictionary from the last CompressJson
+        ZSTD_CCtx_refCDict(cctx, nullptr);
         size_t compressedSize = ZSTD_compress2(cctx, t_compressBuffer.data(), t_compressBuffer.size(), input.data(), input.size());
 
         if (ZSTD_isError(compressedSize))
@@ -106,44 +87,11 @@ namespace PktParser::Misc
 	inline thread_local std::string t_base64Buffer;
 	inline std::string_view Base64Encode(uint8 const* data, size_t len)
 	{
-		static constexpr char table[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
-		size_t outSize = ((len + 2) / 3) * 4;
-
+		size_t outSize = Base64EncodedSize(len);
 		if (t_base64Buffer.size() < outSize)
 			t_base64Buffer.resize(outSize);
 
-		char* out = t_base64Buffer.data();
-		size_t outPos = 0;
-		size_t i = 0;
-
-		for (; i + 2 < len; i += 3)
-		{
-			uint32 b = (static_cast<uint32>(data[i]) << 16) | (static_cast<uint32>(data[i + 1]) << 8) | static_cast<uint32>(data[i + 2]);
-			out[outPos++] = table[(b >> 18) & 0x3F];
-			out[outPos++] = table[(b >> 12) & 0x3F];
-			out[outPos++] = table[(b >> 6) & 0x3F];
-			out[outPos++] = table[b & 0x3F];
-		}
-
-		// handle remainder
-		if (i + 1 == len)
-		{
-			uint32 b = static_cast<uint32>(data[i]) << 16;
-			out[outPos++] = table[(b >> 18) & 0x3F];
-			out[outPos++] = table[(b >> 12) & 0x3F];
-			out[outPos++] = '=';
-			out[outPos++] = '=';
-		}
-		else if (i + 2 == len)
-		{
-			uint32 b = (static_cast<uint32>(data[i]) << 16) | (static_cast<uint32>(data[i + 1]) << 8);
-			out[outPos++] = table[(b >> 18) & 0x3F];
-			out[outPos++] = table[(b >> 12) & 0x3F];
-			out[outPos++] = table[(b >> 6) & 0x3F];
-			out[outPos++] = '=';
-		}
-
-		return std::string_view(t_base64Buffer.data(), outPos);
+		return std::string_view(t_base64Buffer.data(), Base64EncodeTo(t_base64Buffer.data(), data, len));
 	}
 
 	template<typename T>
@@ -66,9 +66,8 @@ namespace PktParser::Misc
 
     std::string WowGuid128::ToHexString() const
     {
-		if (IsEmpty())
-			return "0";
-		return fmt::format("{:016X}{:016X}", High, Low);
+		char buffer[HEX_CHARS_MAX];
+		return std::string(buffer, ToHexChars(buffer));
     }
 
     WowGuid128 ReadGuid128(BitReader& reader)
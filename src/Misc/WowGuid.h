@@ -4,8 +4,38 @@
 #include "Reader/BitReader.h"
 #include "Enums/GuidTypes.h"
 
+#include <array>
+#include <cstring>
+
 namespace PktParser::Misc
 {
+	namespace Detail
+	{
+		// "00".."FF", two uppercase digits per byte value
+		inline constexpr std::array<char, 512> HEX_PAIRS = []
+		{
+			constexpr char digits[] = "0123456789ABCDEF";
+			std::array<char, 512> table{};
+			for (size_t i = 0; i < 256; ++i)
+			{
+				table[i * 2] = digits[i >> 4];
+				table[i * 2 + 1] = digits[i & 0xF];
+			}
+			return table;
+		}();
+
+		// 16 digits, zero padded, most significant first
+		inline char* WriteHex64(char* out, uint64 value)
+		{
+			for (int32 shift = 56; shift >= 0; shift -= 8)
+			{
+				std::memcpy(out, &HEX_PAIRS[((value >> shift) & 0xFF) * 2], 2);
+				out += 2;
+			}
+			return out;
+		}
+	}
+
 	using GuidType = PktParser::Enums::GuidType;
 	using BitReader = PktParser::Reader::BitReader;
 
@@ -24,8 +54,20 @@ namespace PktParser::Misc
 		bool IsEmpty() const;
 		bool HasEntry() const;
 
+		static constexpr size_t HEX_CHARS_MAX = 32;
+
 		std::string ToString() const;
 		std::string ToHexString() const;
+		// ToHexString into a caller buffer of at least HEX_CHARS_MAX, returns the length
+		size_t ToHexChars(char* out) const
+		{
+			if (IsEmpty())
+			{
+				*out = '0';
+				return 1;
+			}
+			return Detail::WriteHex64(Detail::WriteHex64(out, High), Low) - out;
+		}
 
 		bool operator!=(WowGuid128 const& other) const
 		{
@@ -0,0 +1,166 @@
+#pragma once
+
+#include "Misc/Define.h"
+#include "Misc/Exceptions.h"
+#include "Misc/WowGuid.h"
+
+#include <string>
+#include <string_view>
+#include <memory_resource>
+#include <cstring>
+#include <fmt/format.h>
+
+namespace PktParser::Common
+{
+    class BinaryWriter
+    {
+    private:
+        std::pmr::string _buffer;
+
+    public:
+        explicit BinaryWriter(size_t reserveBytes = 256, std::pmr::memory_resource* resource = std::pmr::get_default_resource())
+            : _buffer{ resource }
+        {
+            _buffer.reserve(reserveBytes);
+        }
+
+        void UInt8(uint8 val)
+        {
+            _buffer += static_cast<char>(val);
+        }
+
+        void VarUInt(uint64 val)
+        {
+            while (val >= 0x80)
+            {
+                _buffer += static_cast<char>((val & 0x7F) | 0x80);
+                val >>= 7;
+            }
+            _buffer += static_cast<char>(val);
+        }
+
+        void VarInt(int64 val)
+        {
+            // zigzag so small negatives stay short
+            VarUInt((static_cast<uint64>(val) << 1) ^ static_cast<uint64>(val >> 63));
+        }
+
+        void Float(float val)
+        {
+            Bytes(&val, sizeof(val));
+        }
+
+        void Guid(Misc::WowGuid128 const& guid)
+        {
+            Bytes(&guid.Low, sizeof(guid.Low));
+            Bytes(&guid.High, sizeof(guid.High));
+        }
+
+        void Bytes(void const* data, size_t len)
+        {
+            _buffer.append(static_cast<char const*>(data), len);
+        }
+
+        void String(std::string_view val)
+        {
+            VarUInt(val.size());
+            _buffer.append(val);
+        }
+
+        std::pmr::string TakeString() { return std::move(_buffer); }
+        std::string_view GetView() const { return _buffer; }
+        char const* Data() const { return _buffer.data(); }
+        size_t Size() const { return _buffer.size(); }
+        void Clear() { _buffer.clear(); }
+    };
+
+    class BinaryReader
+    {
+    private:
+        uint8 const* _pos;
+        uint8 const* _end;
+
+        void Require(size_t len, char const* what) const
+        {
+            if (static_cast<size_t>(_end - _pos) < len)
+                throw ParseException{ fmt::format("{}: need {} bytes, {} left", what, len, _end - _pos) };
+        }
+
+    public:
+        BinaryReader(uint8 const* data, size_t length) : _pos{ data }, _end{ data + length } {}
+
+        uint8 UInt8()
+        {
+            Require(1, "UInt8");
+            return *_pos++;
+        }
+
+        uint64 VarUInt()
+        {
+            uint64 val = 0;
+            for (uint32 shift = 0; shift < 64; shift += 7)
+            {
+                uint8 byte = UInt8();
+                val |= static_cast<uint64>(byte & 0x7F) << shift;
+                if (!(byte & 0x80))
+                    return val;
+            }
+            throw ParseException{ "VarUInt: overlong encoding" };
+        }
+
+        int64 VarInt()
+        {
+            uint64 val = VarUInt();
+            return static_cast<int64>(val >> 1) ^ -static_cast<int64>(val & 1);
+        }
+
+        float Float()
+        {
+            float val;
+            Bytes(&val, sizeof(val));
+            return val;
+        }
+
+        Misc::WowGuid128 Guid()
+        {
+            Misc::WowGuid128 guid;
+            Bytes(&guid.Low, sizeof(guid.Low));
+            Bytes(&guid.High, sizeof(guid.High));
+            return guid;
+        }
+
+        void Bytes(void* dst, size_t len)
+        {
+            Require(len, "Bytes");
+            std::memcpy(dst, _pos, len);
+            _pos += len;
+        }
+
+        // points into the reader's buffer
+        std::string_view StringView()
+        {
+            size_t len = VarUInt();
+            Require(len, "String");
+            std::string_view val(reinterpret_cast<char const*>(_pos), len);
+            _pos += len;
+            return val;
+        }
+
+        std::string String()
+        {
+            return std::string(StringView());
+        }
+
+        // element count for a following array, rejects counts the remaining bytes cannot hold
+        size_t Count(size_t minElementSize)
+        {
+            uint64 count = VarUInt();
+            if (count > Remaining() / minElementSize)
+                throw ParseException{ fmt::format("Count: {} elements of at least {} bytes, {} left", count, minElementSize, Remaining()) };
+            return static_cast<size_t>(count);
+        }
+
+        bool CanRead() const { return _pos < _end; }
+        size_t Remaining() const { return _end - _pos; }
+    };
+}
@@ -0,0 +1,126 @@
+#pragma once
+
+#include "Misc/Define.h"
+#include "Misc/WowGuid.h"
+#include "JsonKey.h"
+
+#include <array>
+#include <cstddef>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+namespace PktParser::Common
+{
+    enum class FieldType : uint8
+    {
+        Int8,
+        Int32,
+        Int64,
+        UInt8,
+        UInt32,
+        UInt64,
+        Float,
+        Bool,
+        Guid
+    };
+
+    enum class FieldRule : uint8
+    {
+        Always,
+        OmitIfZero
+    };
+
+    // one flat member of a Structures type, tables of these drive the generic serializers
+    struct FieldDescriptor
+    {
+        JsonKey Name;
+        uint16 Offset;
+        FieldType Type;
+        FieldRule Rule;
+    };
+
+    template<size_t N>
+    using FieldTable = std::array<FieldDescriptor, N>;
+
+    template<FieldType> struct FieldValue;
+    template<> struct FieldValue<FieldType::Int8> { using Type = int8; };
+    template<> struct FieldValue<FieldType::Int32> { using Type = int32; };
+    template<> struct FieldValue<FieldType::Int64> { using Type = int64; };
+    template<> struct FieldValue<FieldType::UInt8> { using Type = uint8; };
+    template<> struct FieldValue<FieldType::UInt32> { using Type = uint32; };
+    template<> struct FieldValue<FieldType::UInt64> { using Type = uint64; };
+    template<> struct FieldValue<FieldType::Float> { using Type = float; };
+    template<> struct FieldValue<FieldType::Bool> { using Type = bool; };
+    template<> struct FieldValue<FieldType::Guid> { using Type = Misc::WowGuid128; };
+
+    template<FieldType Type>
+    using FieldValueT = typename FieldValue<Type>::Type;
+
+    // the other way round, a member type without a FieldType is a compile error rather than a guess
+    template<typename V> struct FieldTypeOf { static_assert(sizeof(V) == 0, "member type has no FieldType"); };
+    template<> struct FieldTypeOf<int8> { static constexpr FieldType Value = FieldType::Int8; };
+    template<> struct FieldTypeOf<int32> { static constexpr FieldType Value = FieldType::Int32; };
+    template<> struct FieldTypeOf<int64> { static constexpr FieldType Value = FieldType::Int64; };
+    template<> struct FieldTypeOf<uint8> { static constexpr FieldType Value = FieldType::UInt8; };
+    template<> struct FieldTypeOf<uint32> { static constexpr FieldType Value = FieldType::UInt32; };
+    template<> struct FieldTypeOf<uint64> { static constexpr FieldType Value = FieldType::UInt64; };
+    template<> struct FieldTypeOf<float> { static constexpr FieldType Value = FieldType::Float; };
+    template<> struct FieldTypeOf<bool> { static constexpr FieldType Value = FieldType::Bool; };
+    template<> struct FieldTypeOf<Misc::WowGuid128> { static constexpr FieldType Value = FieldType::Guid; };
+
+    template<typename M>
+    consteval FieldDescriptor MakeFieldDescriptor(JsonKey name, size_t offset, FieldRule rule)
+    {
+        using V = std::remove_cv_t<M>;
+        constexpr FieldType type = FieldTypeOf<V>::Value;
+        static_assert(std::is_same_v<FieldValueT<type>, V>, "FieldTypeOf and FieldValue disagree");
+
+        if (offset > std::numeric_limits<uint16>::max())
+            throw "field offset does not fit a descriptor";
+        return FieldDescriptor{ name, static_cast<uint16>(offset), type, rule };
+    }
+
+    // a table entry for Struct::Member, offset and type both come from the member so neither can drift from the struct
+    #define FIELD_DESCRIPTOR(Name, Struct, Member, Rule) \
+        ::PktParser::Common::MakeFieldDescriptor<decltype(std::declval<Struct&>().Member)>(Name, offsetof(Struct, Member), Rule)
+
+    template<auto const& Fields, size_t I, typename T>
+    inline auto ReadField(T const& obj)
+    {
+        constexpr FieldDescriptor field = Fields[I];
+        using V = FieldValueT<field.Type>;
+
+        static_assert(field.Offset + sizeof(V) <= sizeof(T), "field descriptor out of bounds");
+
+        // structures are packed, go through memcpy rather than a misaligned load
+        V value;
+        std::memcpy(&value, reinterpret_cast<uint8 const*>(&obj) + field.Offset, sizeof(V));
+        return value;
+    }
+
+    template<auto const& Fields, size_t I, typename T>
+    inline void StoreField(T& obj, FieldValueT<Fields[I].Type> const& value)
+    {
+        std::memcpy(reinterpret_cast<uint8*>(&obj) + Fields[I].Offset, &value, sizeof(value));
+    }
+
+    template<typename V>
+    inline bool IsZeroValue(V const& value)
+    {
+        if constexpr (std::is_same_v<V, Misc::WowGuid128>)
+            return value.IsEmpty();
+        else
+            return value == V{};
+    }
+
+    template<auto const& Fields, typename Func>
+    inline void ForEachField(Func&& func)
+    {
+        [&]<size_t... I>(std::index_sequence<I...>)
+        {
+            (func(std::integral_constant<size_t, I>{}), ...);
+        }(std::make_index_sequence<Fields.size()>{});
+    }
+}
@@ -0,0 +1,177 @@
+#pragma once
+
+#include "FieldDescriptor.h"
+#include "JsonWriter.h"
+#include "BinaryWriter.h"
+
+#include <vector>
+
+namespace PktParser::Common
+{
+    template<auto const& Fields, size_t I, typename T>
+    inline bool ShouldWriteField(T const& obj)
+    {
+        if constexpr (Fields[I].Rule == FieldRule::OmitIfZero)
+            return !IsZeroValue(ReadField<Fields, I>(obj));
+        else
+            return true;
+    }
+
+    template<auto const& Fields, typename T>
+    inline void WriteJsonFields(JsonWriter& w, T const& obj)
+    {
+        ForEachField<Fields>([&](auto index)
+        {
+            constexpr size_t I = decltype(index)::value;
+            constexpr FieldDescriptor field = Fields[I];
+
+            if (!ShouldWriteField<Fields, I>(obj))
+                return;
+
+            auto value = ReadField<Fields, I>(obj);
+            if constexpr (field.Type == FieldType::Guid)
+                w.WriteGuid(field.Name, value);
+            else if constexpr (field.Type == FieldType::Float)
+                w.WriteDouble(field.Name, value);
+            else if constexpr (field.Type == FieldType::Bool)
+                w.WriteBool(field.Name, value);
+            else if constexpr (std::is_signed_v<decltype(value)>)
+                w.WriteInt(field.Name, value);
+            else
+                w.WriteUInt(field.Name, value);
+        });
+    }
+
+    // presence mask, then only the present fields: varints for integers, raw floats and guids
+    template<auto const& Fields, typename T>
+    inline void WriteBinaryFields(BinaryWriter& w, T const& obj)
+    {
+        static_assert(Fields.size() <= 64, "presence mask holds at most 64 fields");
+
+        uint64 mask = 0;
+        ForEachField<Fields>([&](auto index)
+        {
+            constexpr size_t I = decltype(index)::value;
+            if (ShouldWriteField<Fields, I>(obj))
+                mask |= uint64(1) << I;
+        });
+        w.VarUInt(mask);
+
+        ForEachField<Fields>([&](auto index)
+        {
+            constexpr size_t I = decltype(index)::value;
+            constexpr FieldDescriptor field = Fields[I];
+
+            if (!(mask & (uint64(1) << I)))
+                return;
+
+            auto value = ReadField<Fields, I>(obj);
+            if constexpr (field.Type == FieldType::Guid)
+                w.Guid(value);
+            else if constexpr (field.Type == FieldType::Float)
+                w.Float(value);
+            else if constexpr (field.Type == FieldType::Bool)
+                w.UInt8(value ? 1 : 0);
+            else if constexpr (std::is_signed_v<decltype(value)>)
+                w.VarInt(value);
+            else
+                w.VarUInt(value);
+        });
+    }
+
+    // inverse of WriteBinaryFields, absent fields are left zeroed
+    template<auto const& Fields, typename T>
+    inline void ReadBinaryFields(BinaryReader& r, T& obj)
+    {
+        uint64 mask = r.VarUInt();
+
+        ForEachField<Fields>([&](auto index)
+        {
+            constexpr size_t I = decltype(index)::value;
+            constexpr FieldDescriptor field = Fields[I];
+            using V = FieldValueT<field.Type>;
+
+            V value{};
+            if (mask & (uint64(1) << I))
+            {
+                if constexpr (field.Type == FieldType::Guid)
+                    value = r.Guid();
+                else if constexpr (field.Type == FieldType::Float)
+                    value = r.Float();
+                else if constexpr (field.Type == FieldType::Bool)
+                    value = r.UInt8() != 0;
+                else if constexpr (std::is_signed_v<V>)
+                    value = static_cast<V>(r.VarInt());
+                else
+                    value = static_cast<V>(r.VarUInt());
+            }
+
+            StoreField<Fields, I>(obj, value);
+        });
+    }
+
+    // one fixed-width value buffer per field plus a validity byte, omitted fields read back as null
+    template<auto const& Fields>
+    class ColumnAppender
+    {
+    public:
+        struct Column
+        {
+            FieldDescriptor const* Field;
+            std::vector<uint8> Values;
+            std::vector<uint8> Valid;
+        };
+
+    private:
+        std::array<Column, Fields.size()> _columns;
+        size_t _rowCount = 0;
+
+    public:
+        ColumnAppender()
+        {
+            for (size_t i = 0; i < Fields.size(); ++i)
+                _columns[i].Field = &Fields[i];
+        }
+
+        template<typename T>
+        void Append(T const& obj)
+        {
+            ForEachField<Fields>([&](auto index)
+            {
+                constexpr size_t I = decltype(index)::value;
+
+                auto value = ReadField<Fields, I>(obj);
+                Column& column = _columns[I];
+
+                uint8 const* bytes = reinterpret_cast<uint8 const*>(&value);
+                column.Values.insert(column.Values.end(), bytes, bytes + sizeof(value));
+                column.Valid.push_back(ShouldWriteField<Fields, I>(obj) ? 1 : 0);
+            });
+            ++_rowCount;
+        }
+
+        void Reserve(size_t rows)
+        {
+            ForEachField<Fields>([&](auto index)
+            {
+                constexpr size_t I = decltype(index)::value;
+                _columns[I].Values.reserve(rows * sizeof(FieldValueT<Fields[I].Type>));
+                _columns[I].Valid.reserve(rows);
+            });
+        }
+
+        void Clear()
+        {
+            for (Column& column : _columns)
+            {
+                column.Values.clear();
+                column.Valid.clear();
+            }
+            _rowCount = 0;
+        }
+
+        Column const& GetColumn(size_t index) const { return _columns[index]; }
+        size_t GetColumnCount() const { return Fields.size(); }
+        size_t GetRowCount() const { return _rowCount; }
+    };
+}
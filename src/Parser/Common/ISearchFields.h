@@ -1,6 +1,7 @@
 #pragma once
 
 #include "JsonWriter.h"
+#include "RecordFormat.h"
 
 namespace PktParser::Common
 {
@@ -8,5 +9,7 @@ namespace PktParser::Common
     {
         virtual ~ISearchFields() = default;
         virtual void WriteTo(JsonWriter& doc) const = 0;
+        // which concrete fields these are, for sinks that want more than the search document
+        virtual RecordKind GetKind() const = 0;
     };
 }
\ No newline at end of file
@@ -0,0 +1,36 @@
+#pragma once
+
+#include "Misc/Define.h"
+
+#include <string_view>
+
+namespace PktParser::Common
+{
+    // a key with its quotes and colon already in place, built at compile time from a literal
+    struct JsonKey
+    {
+        static constexpr size_t CAPACITY = 48;
+
+        char Text[CAPACITY];
+        uint8 Length;
+
+        template<size_t N>
+        consteval JsonKey(char const (&name)[N]) : Text{}, Length{ static_cast<uint8>(N + 2) }
+        {
+            static_assert(N + 2 <= CAPACITY, "json key too long");
+
+            Text[0] = '"';
+            for (size_t i = 0; i + 1 < N; ++i)
+            {
+                // keys are written verbatim, anything that would need escaping is a compile error
+                if (name[i] == '"' || name[i] == '\\' || static_cast<unsigned char>(name[i]) < 0x20)
+                    throw "json key needs escaping";
+                Text[i + 1] = name[i];
+            }
+            Text[N] = '"';
+            Text[N + 1] = ':';
+        }
+
+        std::string_view Name() const { return { Text + 1, Length - 3u }; }
+    };
+}
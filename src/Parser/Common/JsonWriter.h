@@ -2,251 +2,341 @@
 
 #include "Misc/Define.h"
 #include "Misc/WowGuid.h"
+#include "JsonKey.h"
 
 #include <string>
+#include <string_view>
+#include <memory_resource>
+#include <charconv>
+#include <cstring>
+#include <algorithm>
 #include <fmt/format.h>
+#include <fmt/compile.h>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
 
 namespace PktParser::Common
 {
     class JsonWriter
     {
     private:
-        std::string _buffer;
+        // longest output of a single number: 20 digit uint64 / shortest round-trip double
+        static constexpr size_t MAX_NUMBER_CHARS = 32;
+        static constexpr size_t GROW_STEP = 256;
+
+        // _buffer.size() is only the writable area, _size is what has actually been written
+        std::pmr::string _buffer;
+        size_t _size;
         bool _needsComma;
-    
+
     public:
-        explicit JsonWriter(size_t reserveBytes = 1024) : _needsComma{ false }
+        explicit JsonWriter(size_t reserveBytes = 1024, std::pmr::memory_resource* resource = std::pmr::get_default_resource())
+            : _buffer{ resource }, _size{ 0 }, _needsComma{ false }
         {
             _buffer.reserve(reserveBytes);
         }
 
         void BeginObject()
         {
-            Comma();
-            _buffer += '{';
+            char* out = Ensure(2);
+            if (_needsComma)
+                *out++ = ',';
+            *out++ = '{';
+            Commit(out);
             _needsComma = false;
         }
 
         void EndObject()
         {
-            _buffer += '}';
+            Put('}');
             _needsComma = true;
         }
 
         void BeginArray()
         {
-            Comma();
-            _buffer += '[';
+            char* out = Ensure(2);
+            if (_needsComma)
+                *out++ = ',';
+            *out++ = '[';
+            Commit(out);
             _needsComma = false;
         }
 
         void EndArray()
         {
-            _buffer += ']';
+            Put(']');
             _needsComma = true;
         }
 
-        void Key(char const* key)
+        void Key(JsonKey const& key)
         {
-            Comma();
-            _buffer += '"';
-            _buffer += key;
-            _buffer += "\":";
+            char* out = Ensure(1 + key.Length);
+            if (_needsComma)
+                *out++ = ',';
+            std::memcpy(out, key.Text, key.Length);
+            Commit(out + key.Length);
             _needsComma = false;
         }
 
-        void String(std::string const& val)
+        void String(std::string_view val)
         {
             Comma();
-            _buffer += '"';
+            Put('"');
             EscapeString(val);
-            _buffer += '"';
-            _needsComma = true;
-        }
-
-        void String(char const* val)
-        {
-            Comma();
-            _buffer += '"';
-            EscapeString(val);
-            _buffer += '"';
+            Put('"');
             _needsComma = true;
         }
 
         void Int(int64 val)
         {
             Comma();
-            fmt::format_to(std::back_inserter(_buffer), "{}", val);
+            Number(val);
             _needsComma = true;
         }
 
         void UInt(uint64 val)
         {
             Comma();
-            fmt::format_to(std::back_inserter(_buffer), "{}", val);
+            Number(val);
             _needsComma = true;
         }
 
         void UInt64(uint64 val)
         {
-            Comma();
-            fmt::format_to(std::back_inserter(_buffer), "{}", val);
-            _needsComma = true;
+            UInt(val);
         }
 
         void Double(double val)
         {
             Comma();
-            fmt::format_to(std::back_inserter(_buffer), "{}", val);
+            // fmt's shortest round-trip form, kept over std::to_chars so existing output stays byte-identical
+            char* out = Ensure(MAX_NUMBER_CHARS);
+            Commit(fmt::format_to(out, FMT_COMPILE("{}"), val));
             _needsComma = true;
         }
 
         void Bool(bool val)
         {
             Comma();
-            _buffer += val ? "true" : "false";
+            if (val)
+                Put("true", 4);
+            else
+                Put("false", 5);
             _needsComma = true;
         }
 
         void Null()
         {
             Comma();
-            _buffer += "null";
+            Put("null", 4);
             _needsComma = true;
         }
 
-        void WriteString(char const* key, std::string const& val)
-        {
-            Key(key);
-            String(val);
-        }
-
-        void WriteString(char const* key, char const* val)
+        void WriteString(JsonKey const& key, std::string_view val)
         {
             Key(key);
             String(val);
         }
 
-        void WriteInt(char const* key, int64 val)
+        void WriteInt(JsonKey const& key, int64 val)
         {
             Key(key);
             Int(val);
         }
 
-        void WriteUInt(char const* key, uint64 val)
+        void WriteUInt(JsonKey const& key, uint64 val)
         {
             Key(key);
             UInt(val);
         }
 
-        void WriteDouble(char const* key, double val)
+        void WriteDouble(JsonKey const& key, double val)
         {
             Key(key);
             Double(val);
         }
 
-        void WriteBool(char const* key, bool val)
+        void WriteBool(JsonKey const& key, bool val)
         {
             Key(key);
             Bool(val);
         }
 
-        void WriteGuid(char const* key, Misc::WowGuid128 const& guid)
+        void WriteGuid(JsonKey const& key, Misc::WowGuid128 const& guid)
         {
             Key(key);
-            BeginArray();
-            UInt64(guid.High);
-            UInt64(guid.Low);
-            EndArray();
+
+            char* out = Ensure(3 + 2 * MAX_NUMBER_CHARS);
+            *out++ = '[';
+            out = std::to_chars(out, out + MAX_NUMBER_CHARS, guid.High).ptr;
+            *out++ = ',';
+            out = std::to_chars(out, out + MAX_NUMBER_CHARS, guid.Low).ptr;
+            *out++ = ']';
+            Commit(out);
+            _needsComma = true;
+        }
+
+        // the guid as the hex string ToHexString would give, formatted straight into the buffer
+        void WriteGuidHex(JsonKey const& key, Misc::WowGuid128 const& guid)
+        {
+            Key(key);
+
+            char* out = Ensure(2 + Misc::WowGuid128::HEX_CHARS_MAX);
+            *out++ = '"';
+            out += guid.ToHexChars(out);
+            *out++ = '"';
+            Commit(out);
+            _needsComma = true;
+        }
+
+        // ndjson: closes the current line, the next value starts a new top-level document
+        void EndLine()
+        {
+            Put('\n');
+            _needsComma = false;
+        }
+
+        // verbatim text, the caller guarantees it is valid json in this position
+        void Raw(std::string_view text)
+        {
+            Put(text.data(), text.size());
+        }
+
+        void RawUInt(uint64 val)
+        {
+            Number(val);
+        }
+
+        void Reserve(size_t bytes)
+        {
+            _buffer.reserve(bytes);
+        }
+
+        // keeps the buffer for the next document
+        void Clear()
+        {
+            _size = 0;
+            _needsComma = false;
+        }
+
+        std::pmr::string TakeString()
+        {
+            _buffer.resize(_size);
+            _size = 0;
+            return std::move(_buffer);
         }
 
-        std::string TakeString() { return std::move(_buffer); }
-        std::string const& GetString() const { return _buffer; }
+        std::string_view GetView() const { return { _buffer.data(), _size }; }
         char const* Data() const { return _buffer.data(); }
-        size_t Size() const { return _buffer.size(); }
-    
+        size_t Size() const { return _size; }
+
     private:
+        // room for n more bytes, the string is grown in steps so reserved capacity is never zero-filled up front
+        char* Ensure(size_t n)
+        {
+            if (_size + n > _buffer.size()) [[unlikely]]
+                _buffer.resize(_size + std::max(n, GROW_STEP));
+            return _buffer.data() + _size;
+        }
+
+        void Commit(char* end)
+        {
+            _size = end - _buffer.data();
+        }
+
+        void Put(char c)
+        {
+            *Ensure(1) = c;
+            ++_size;
+        }
+
+        void Put(char const* data, size_t len)
+        {
+            std::memcpy(Ensure(len), data, len);
+            _size += len;
+        }
+
+        template<typename T>
+        void Number(T val)
+        {
+            char* out = Ensure(MAX_NUMBER_CHARS);
+            Commit(std::to_chars(out, out + MAX_NUMBER_CHARS, val).ptr);
+        }
+
         void Comma()
         {
             if (_needsComma)
-                _buffer += ',';
+                Put(',');
         }
 
-        void EscapeString(std::string const& s)
+        static bool NeedsEscape(char c)
         {
-            size_t start = 0;
-            for (size_t i = 0; i < s.size(); ++i)
+            return c == '"' || c == '\\' || static_cast<unsigned char>(c) < 0x20;
+        }
+
+        // offset of the first byte that needs escaping, or len
+        static size_t FindEscape(char const* s, size_t len)
+        {
+            size_t i = 0;
+#if defined(__SSE2__)
+            __m128i const quote = _mm_set1_epi8('"');
+            __m128i const backslash = _mm_set1_epi8('\\');
+            __m128i const control = _mm_set1_epi8(0x1F);
+
+            for (; i + 16 <= len; i += 16)
             {
-                char c = s[i];
-                if (c != '"' && c != '\\' && c != '\n' && c != '\r' && c != '\t' && static_cast<unsigned char>(c) >= 0x20)
-                    continue;
-                
-                _buffer.append(s, start, i - start);
+                __m128i chunk = _mm_loadu_si128(reinterpret_cast<__m128i const*>(s + i));
+                // unsigned c <= 0x1F  <=>  max(c, 0x1F) == 0x1F
+                __m128i hits = _mm_or_si128(
+                    _mm_or_si128(_mm_cmpeq_epi8(chunk, quote), _mm_cmpeq_epi8(chunk, backslash)),
+                    _mm_cmpeq_epi8(_mm_max_epu8(chunk, control), control));
 
-                switch (c)
-                {
-                case '"':
-                    _buffer += "\\\"";
-                    break;
-                case '\\':
-                    _buffer += "\\\\";
-                    break;
-                case '\n':
-                    _buffer += "\\n";
-                    break;
-                case '\r':
-                    _buffer += "\\r";
-                    break;
-                case '\t':
-                    _buffer += "\\t";
-                    break;
-                default:
-                    fmt::format_to(std::back_inserter(_buffer), "\\u{:04x}", static_cast<unsigned char>(c));
-                    break;
-                }
-                start = i + 1;
+                int mask = _mm_movemask_epi8(hits);
+                if (mask != 0)
+                    return i + __builtin_ctz(static_cast<uint32>(mask));
             }
-            _buffer.append(s, start, s.size() - start);
+#endif
+            for (; i < len; ++i)
+                if (NeedsEscape(s[i]))
+                    return i;
+            return len;
         }
 
-        void EscapeString(char const* s)
+        void EscapeString(std::string_view s)
         {
-            char const* start = s;
-            while (*s)
+            size_t start = 0;
+            while (start < s.size())
             {
-                char c = *s;
-                if (c != '"' && c != '\\' && c != '\n' && c != '\r' && c != '\t' && static_cast<unsigned char>(c) >= 0x20)
-                {
-                    ++s;
-                    continue;
-                }
+                size_t i = start + FindEscape(s.data() + start, s.size() - start);
+                Put(s.data() + start, i - start);
+                if (i == s.size())
+                    return;
 
-                _buffer.append(start, s - start);
-
-                switch (c)
+                switch (char c = s[i])
                 {
                 case '"':
-                    _buffer += "\\\"";
+                    Put("\\\"", 2);
                     break;
                 case '\\':
-                    _buffer += "\\\\";
+                    Put("\\\\", 2);
                     break;
                 case '\n':
-                    _buffer += "\\n";
+                    Put("\\n", 2);
                     break;
                 case '\r':
-                    _buffer += "\\r";
+                    Put("\\r", 2);
                     break;
                 case '\t':
-                    _buffer += "\\t";
+                    Put("\\t", 2);
                     break;
                 default:
-                    fmt::format_to(std::back_inserter(_buffer), "\\u{:04x}", static_cast<unsigned char>(c));
+                    Commit(fmt::format_to(Ensure(6), FMT_COMPILE("\\u{:04x}"), static_cast<unsigned char>(c)));
                     break;
                 }
-                start = ++s;
+                start = i + 1;
             }
-            _buffer.append(start, s - start);
         }
     };
 }
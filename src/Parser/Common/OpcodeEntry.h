@@ -0,0 +1,13 @@
+#pragma once
+
+#include "Misc/Define.h"
+
+namespace PktParser::Common
+{
+    struct OpcodeEntry
+    {
+        uint32 Value;
+        char const* Name;
+        char const* Direction;
+    };
+}
@@ -0,0 +1,106 @@
+#pragma once
+
+#include "Misc/Define.h"
+
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <optional>
+
+namespace PktParser::Common
+{
+    namespace Detail
+    {
+        inline thread_local std::pmr::memory_resource* t_packetResource = nullptr;
+    }
+
+    // what parsed structures, search fields and payloads allocate from:
+    // the worker's arena while a batch is being parsed, the heap anywhere else
+    inline std::pmr::memory_resource* CurrentResource()
+    {
+        std::pmr::memory_resource* resource = Detail::t_packetResource;
+        return resource ? resource : std::pmr::get_default_resource();
+    }
+
+    // per-worker bump allocator, everything parsed from one batch is dropped at once by Reset
+    class PacketArena
+    {
+    private:
+        // heap fallback once the buffer runs out, counts how much so the next round fits in one buffer
+        class OverflowResource final : public std::pmr::memory_resource
+        {
+        public:
+            size_t Allocated = 0;
+
+        private:
+            void* do_allocate(size_t bytes, size_t alignment) override
+            {
+                Allocated += bytes;
+                return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+            }
+
+            void do_deallocate(void* p, size_t bytes, size_t alignment) override
+            {
+                std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+            }
+
+            bool do_is_equal(std::pmr::memory_resource const& other) const noexcept override
+            {
+                return this == &other;
+            }
+        };
+
+        size_t _capacity;
+        std::unique_ptr<std::byte[]> _buffer;
+        OverflowResource _overflow;
+        std::optional<std::pmr::monotonic_buffer_resource> _resource;
+
+    public:
+        explicit PacketArena(size_t initialBytes)
+            : _capacity{ initialBytes }, _buffer{ std::make_unique<std::byte[]>(initialBytes) }
+        {
+            _resource.emplace(_buffer.get(), _capacity, &_overflow);
+        }
+
+        PacketArena(PacketArena const&) = delete;
+        PacketArena& operator=(PacketArena const&) = delete;
+
+        std::pmr::memory_resource* Resource() { return &*_resource; }
+        size_t GetCapacity() const { return _capacity; }
+
+        // nothing allocated from the arena may be used after this
+        void Reset()
+        {
+            if (_overflow.Allocated == 0)
+            {
+                _resource->release();
+                return;
+            }
+
+            // the last round spilled to the heap, grow so steady state stays inside the buffer
+            _resource.reset();
+            _capacity += _overflow.Allocated;
+            _overflow.Allocated = 0;
+            _buffer = std::make_unique<std::byte[]>(_capacity);
+            _resource.emplace(_buffer.get(), _capacity, &_overflow);
+        }
+
+        // routes CurrentResource() to this arena on the calling thread for the scope's lifetime
+        class Scope
+        {
+        private:
+            std::pmr::memory_resource* _previous;
+
+        public:
+            explicit Scope(PacketArena& arena) : _previous{ Detail::t_packetResource }
+            {
+                Detail::t_packetResource = arena.Resource();
+            }
+
+            ~Scope() { Detail::t_packetResource = _previous; }
+
+            Scope(Scope const&) = delete;
+            Scope& operator=(Scope const&) = delete;
+        };
+    };
+}
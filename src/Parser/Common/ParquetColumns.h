@@ -0,0 +1,99 @@
+#pragma once
+
+#include "FieldSerializers.h"
+#include "Misc/ParquetWriter.h"
+
+#include <string>
+#include <vector>
+
+namespace PktParser::Common
+{
+    inline Misc::ParquetColumn MakeParquetColumn(FieldDescriptor const& field)
+    {
+        using Misc::ParquetType;
+        using Misc::ParquetConvertedType;
+
+        Misc::ParquetColumn column{ std::string(field.Name.Name()), ParquetType::Int32 };
+        column.Optional = field.Rule == FieldRule::OmitIfZero;
+
+        switch (field.Type)
+        {
+        case FieldType::Int8: column.Converted = ParquetConvertedType::Int8; break;
+        case FieldType::Int32: break;
+        case FieldType::Int64: column.Type = ParquetType::Int64; break;
+        case FieldType::UInt8: column.Converted = ParquetConvertedType::UInt8; break;
+        case FieldType::UInt32: column.Converted = ParquetConvertedType::UInt32; break;
+        case FieldType::UInt64: column.Type = ParquetType::Int64; column.Converted = ParquetConvertedType::UInt64; break;
+        case FieldType::Float: column.Type = ParquetType::Float; break;
+        case FieldType::Bool: column.Type = ParquetType::Boolean; break;
+        case FieldType::Guid: column.Type = ParquetType::FixedLenByteArray; column.TypeLength = sizeof(Misc::WowGuid128); break;
+        }
+        return column;
+    }
+
+    template<auto const& Fields>
+    inline std::vector<Misc::ParquetColumn> MakeParquetSchema()
+    {
+        std::vector<Misc::ParquetColumn> columns;
+        columns.reserve(Fields.size());
+        for (FieldDescriptor const& field : Fields)
+            columns.push_back(MakeParquetColumn(field));
+        return columns;
+    }
+
+    // one row group from everything in the appender, omitted values become nulls
+    template<auto const& Fields>
+    inline void WriteParquetRowGroup(Misc::ParquetWriter& writer, ColumnAppender<Fields> const& rows)
+    {
+        std::vector<uint8> plain;
+        writer.BeginRowGroup(rows.GetRowCount());
+
+        ForEachField<Fields>([&](auto index)
+        {
+            constexpr size_t I = decltype(index)::value;
+            constexpr FieldDescriptor field = Fields[I];
+            using V = FieldValueT<field.Type>;
+
+            auto const& column = rows.GetColumn(I);
+            V const* values = reinterpret_cast<V const*>(column.Values.data());
+            bool optional = field.Rule == FieldRule::OmitIfZero;
+
+            plain.clear();
+            size_t present = 0;
+            for (size_t row = 0; row < rows.GetRowCount(); ++row)
+            {
+                if (optional && !column.Valid[row])
+                    continue;
+
+                V value;
+                std::memcpy(&value, values + row, sizeof(V));
+
+                if constexpr (field.Type == FieldType::Bool)
+                {
+                    // PLAIN booleans are bit-packed, least significant bit first
+                    if (present % 8 == 0)
+                        plain.push_back(0);
+                    if (value)
+                        plain.back() |= static_cast<uint8>(1 << (present % 8));
+                }
+                else if constexpr (sizeof(V) == 1)
+                {
+                    // 8-bit fields are stored as INT32
+                    int32 wide = value;
+                    uint8 const* bytes = reinterpret_cast<uint8 const*>(&wide);
+                    plain.insert(plain.end(), bytes, bytes + sizeof(wide));
+                }
+                else
+                {
+                    uint8 const* bytes = reinterpret_cast<uint8 const*>(&value);
+                    plain.insert(plain.end(), bytes, bytes + sizeof(V));
+                }
+                ++present;
+            }
+
+            writer.WriteColumn(plain, optional ? std::span<uint8 const>(column.Valid) : std::span<uint8 const>());
+        });
+
+        writer.EndRowGroup();
+    }
+}
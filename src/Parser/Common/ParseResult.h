@@ -2,40 +2,81 @@
 
 #include "Misc/Define.h"
 #include "ISearchFields.h"
+#include "RecordFormat.h"
 
+#include <concepts>
+#include <cstddef>
+#include <memory_resource>
 #include <string>
+#include <type_traits>
 
 namespace PktParser::Common
 {
     struct ParseResult
     {
-        std::string json;
+        std::pmr::string payload;
         ISearchFields* searchFields = nullptr;
+        BlobFormat format = BlobFormat::Json;
 
-        ParseResult(std::string json, ISearchFields* fields) : json{ std::move(json) }, searchFields{ fields } {}
+        ParseResult(std::pmr::string payload, std::nullptr_t, BlobFormat format = BlobFormat::Json)
+            : payload{ std::move(payload) }, format{ format } {}
+
+        // the search fields are placed in the payload's resource, the packet arena on worker threads
+        template<std::derived_from<ISearchFields> T>
+        ParseResult(std::pmr::string payload, T&& fields, BlobFormat format = BlobFormat::Json)
+            : payload{ std::move(payload) }, format{ format }
+        {
+            using Fields = std::remove_cvref_t<T>;
+
+            _fieldsResource = this->payload.get_allocator().resource();
+            searchFields = std::pmr::polymorphic_allocator<Fields>{ _fieldsResource }.template new_object<Fields>(std::forward<T>(fields));
+            _destroyFields = [](ISearchFields* ptr, std::pmr::memory_resource* resource)
+            {
+                std::pmr::polymorphic_allocator<Fields>{ resource }.delete_object(static_cast<Fields*>(ptr));
+            };
+        }
 
         ParseResult() = default;
-        ~ParseResult() { delete searchFields; }
+        ~ParseResult() { DestroyFields(); }
+        // constructing (not assigning) keeps the payload in the arena it came from
         ParseResult(ParseResult&& other) noexcept
+            : payload{ std::move(other.payload) }, format{ other.format }
         {
-            json = std::move(other.json);
-            searchFields = other.searchFields;
-            other.searchFields = nullptr;
+            TakeFields(other);
         }
 
         ParseResult& operator=(ParseResult&& other) noexcept
         {
             if (this != &other)
             {
-                delete searchFields;
-                json = std::move(other.json);
-                searchFields = other.searchFields;
-                other.searchFields = nullptr;
+                DestroyFields();
+                payload = std::move(other.payload);
+                format = other.format;
+                TakeFields(other);
             }
             return *this;
         }
 
         ParseResult(ParseResult const&) = delete;
         ParseResult& operator=(ParseResult const&) = delete;
+
+    private:
+        std::pmr::memory_resource* _fieldsResource = nullptr;
+        void (*_destroyFields)(ISearchFields*, std::pmr::memory_resource*) = nullptr;
+
+        void DestroyFields()
+        {
+            if (searchFields)
+                _destroyFields(searchFields, _fieldsResource);
+            searchFields = nullptr;
+        }
+
+        void TakeFields(ParseResult& other)
+        {
+            searchFields = other.searchFields;
+            _fieldsResource = other._fieldsResource;
+            _destroyFields = other._destroyFields;
+            other.searchFields = nullptr;
+        }
     };
 }
@@ -0,0 +1,51 @@
+#pragma once
+
+#include "Misc/Define.h"
+#include "BinaryWriter.h"
+
+#include <optional>
+#include <string_view>
+
+namespace PktParser::Common
+{
+    enum class BlobFormat : uint8
+    {
+        Json,
+        Binary
+    };
+
+    enum class RecordKind : uint8
+    {
+        SpellCast = 1
+    };
+
+    // first byte of every binary record, never the first byte of a json text
+    static constexpr uint8 RECORD_MAGIC = 0xB7;
+    static constexpr size_t SPELL_CAST_BINARY_RESERVE = 512;
+
+    // schema id = parser build << 8 | record kind, so a blob names the exact layout it was written with
+    inline constexpr uint64 MakeSchemaId(uint32 parserBuild, RecordKind kind)
+    {
+        return (static_cast<uint64>(parserBuild) << 8) | static_cast<uint8>(kind);
+    }
+
+    inline void WriteRecordHeader(BinaryWriter& w, uint32 parserBuild, RecordKind kind)
+    {
+        w.UInt8(RECORD_MAGIC);
+        w.VarUInt(MakeSchemaId(parserBuild, kind));
+    }
+
+    inline std::optional<BlobFormat> ParseBlobFormat(std::string_view name)
+    {
+        if (name == "json")
+            return BlobFormat::Json;
+        if (name == "binary")
+            return BlobFormat::Binary;
+        return std::nullopt;
+    }
+
+    inline char const* BlobFormatName(BlobFormat format)
+    {
+        return format == BlobFormat::Binary ? "binary" : "json";
+    }
+}
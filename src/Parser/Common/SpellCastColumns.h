@@ -0,0 +1,118 @@
+#pragma once
+
+#include "Misc/Define.h"
+#include "Reader/PktFileReader.h"
+#include "FieldDescriptor.h"
+#include "FieldSerializers.h"
+#include "ParquetColumns.h"
+#include "SpellSearchFields.h"
+
+#include <cstddef>
+#include <string>
+
+namespace PktParser::Common
+{
+    // one analytics row per spell start / go, flat so a field table can address it
+    struct SpellCastRow
+    {
+        uint32 Build;
+        uint32 PacketNumber;
+        int64 TimestampMs;
+        uint32 Opcode;
+        uint8 Direction;
+        int32 SpellID;
+        uint8 CasterType;
+        uint32 CasterEntry;
+        uint64 CasterLow;
+        int32 MapID;
+        uint32 CastFlags;
+        uint32 CastFlagsEx;
+        uint32 CastFlagsEx2;
+        uint32 CastTime;
+        uint32 HitTargetCount;
+        uint32 MissTargetCount;
+        uint32 TargetPointCount;
+    };
+
+    inline constexpr FieldTable<17> SPELL_CAST_ROW_FIELDS =
+    {{
+        { "build", offsetof(SpellCastRow, Build), FieldType::UInt32, FieldRule::Always },
+        { "packet_number", offsetof(SpellCastRow, PacketNumber), FieldType::UInt32, FieldRule::Always },
+        { "timestamp_ms", offsetof(SpellCastRow, TimestampMs), FieldType::Int64, FieldRule::Always },
+        { "opcode", offsetof(SpellCastRow, Opcode), FieldType::UInt32, FieldRule::Always },
+        { "direction", offsetof(SpellCastRow, Direction), FieldType::UInt8, FieldRule::Always },
+        { "spell_id", offsetof(SpellCastRow, SpellID), FieldType::Int32, FieldRule::Always },
+        { "caster_type", offsetof(SpellCastRow, CasterType), FieldType::UInt8, FieldRule::Always },
+        { "caster_entry", offsetof(SpellCastRow, CasterEntry), FieldType::UInt32, FieldRule::Always },
+        { "caster_low", offsetof(SpellCastRow, CasterLow), FieldType::UInt64, FieldRule::Always },
+        { "map_id", offsetof(SpellCastRow, MapID), FieldType::Int32, FieldRule::Always },
+        { "cast_flags", offsetof(SpellCastRow, CastFlags), FieldType::UInt32, FieldRule::Always },
+        { "cast_flags_ex", offsetof(SpellCastRow, CastFlagsEx), FieldType::UInt32, FieldRule::Always },
+        { "cast_flags_ex2", offsetof(SpellCastRow, CastFlagsEx2), FieldType::UInt32, FieldRule::Always },
+        { "cast_time", offsetof(SpellCastRow, CastTime), FieldType::UInt32, FieldRule::Always },
+        { "hit_target_count", offsetof(SpellCastRow, HitTargetCount), FieldType::UInt32, FieldRule::Always },
+        { "miss_target_count", offsetof(SpellCastRow, MissTargetCount), FieldType::UInt32, FieldRule::Always },
+        { "target_point_count", offsetof(SpellCastRow, TargetPointCount), FieldType::UInt32, FieldRule::Always },
+    }};
+
+    inline SpellCastRow MakeSpellCastRow(uint32 build, Reader::PktHeader const& header, uint32 pktNumber, SpellSearchFields const& fields)
+    {
+        SpellCastRow row{};
+        row.Build = build;
+        row.PacketNumber = pktNumber;
+        row.TimestampMs = static_cast<int64>(header.timestamp * 1000);
+        row.Opcode = header.opcode;
+        row.Direction = static_cast<uint8>(header.direction);
+        row.SpellID = fields.spellId;
+        row.CasterType = static_cast<uint8>(fields.casterType);
+        row.CasterEntry = fields.casterEntry;
+        row.CasterLow = fields.casterLow;
+        row.MapID = fields.mapId;
+        row.CastFlags = fields.castFlags;
+        row.CastFlagsEx = fields.castFlagsEx;
+        row.CastFlagsEx2 = fields.castFlagsEx2;
+        row.CastTime = fields.castTime;
+        row.HitTargetCount = static_cast<uint32>(fields.hitTargetEntries.size());
+        row.MissTargetCount = fields.missTargetCount;
+        row.TargetPointCount = fields.targetPointCount;
+        return row;
+    }
+
+    // one worker's spell casts, appended column-wise and written out a row group at a time
+    class SpellCastParquetSink
+    {
+    private:
+        ColumnAppender<SPELL_CAST_ROW_FIELDS> _rows;
+        Misc::ParquetWriter _writer;
+        size_t _rowGroupRows;
+
+    public:
+        SpellCastParquetSink(std::string path, size_t rowGroupRows, Misc::ParquetCompression compression)
+            : _writer{ std::move(path), MakeParquetSchema<SPELL_CAST_ROW_FIELDS>(), compression }, _rowGroupRows{ rowGroupRows }
+        {
+            _rows.Reserve(rowGroupRows);
+        }
+
+        ~SpellCastParquetSink() { Flush(); }
+
+        SpellCastParquetSink(SpellCastParquetSink const&) = delete;
+        SpellCastParquetSink& operator=(SpellCastParquetSink const&) = delete;
+
+        void Append(SpellCastRow const& row)
+        {
+            _rows.Append(row);
+            if (_rows.GetRowCount() >= _rowGroupRows)
+                Flush();
+        }
+
+        void Flush()
+        {
+            if (_rows.GetRowCount() == 0)
+                return;
+
+            if (_writer.IsOpen())
+                WriteParquetRowGroup(_writer, _rows);
+            _rows.Clear();
+        }
+    };
+}
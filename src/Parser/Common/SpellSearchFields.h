@@ -4,30 +4,44 @@
 #include "JsonWriter.h"
 #include "ISearchFields.h"
 
-#include <string>
 #include <vector>
+#include <memory_resource>
 
 namespace PktParser::Common
 {
     struct SpellSearchFields final : ISearchFields
     {
-        int32 spellId;
-        std::string castId;
-        std::string originalCastId;
-        std::string casterGuid;
-        std::string casterType;
-        uint32 casterEntry;
-        uint64 casterLow;
-        int32 mapId;
-        std::vector<uint32> hitTargetEntries;
+        int32 spellId = 0;
+        // kept raw, the hex text is only produced if the document is actually written
+        Misc::WowGuid128 castId{};
+        Misc::WowGuid128 originalCastId{};
+        Misc::WowGuid128 casterGuid{};
+        Enums::GuidType casterType{};
+        uint32 casterEntry = 0;
+        uint64 casterLow = 0;
+        int32 mapId = 0;
+        std::pmr::vector<uint32> hitTargetEntries;
+
+        // not part of the search document, only the columnar export reads these
+        uint32 castFlags = 0;
+        uint32 castFlagsEx = 0;
+        uint32 castFlagsEx2 = 0;
+        uint32 castTime = 0;
+        uint32 missTargetCount = 0;
+        uint32 targetPointCount = 0;
+
+        explicit SpellSearchFields(std::pmr::memory_resource* resource = std::pmr::get_default_resource())
+            : hitTargetEntries{ resource } {}
+
+        RecordKind GetKind() const override { return RecordKind::SpellCast; }
 
         void WriteTo(JsonWriter& doc) const override
         {
             doc.WriteInt("spell_id", spellId);
-            doc.WriteString("cast_id", castId);
-            doc.WriteString("original_cast_id", originalCastId);
-            doc.WriteString("caster_guid", casterGuid);
-            doc.WriteString("caster_type", casterType);
+            doc.WriteGuidHex("cast_id", castId);
+            doc.WriteGuidHex("original_cast_id", originalCastId);
+            doc.WriteGuidHex("caster_guid", casterGuid);
+            doc.WriteString("caster_type", Enums::GuidTypeToString(casterType));
             doc.WriteUInt("caster_entry", casterEntry);
             doc.WriteUInt("caster_low", casterLow);
             doc.WriteInt("map_id", mapId);
@@ -1,8 +1,16 @@
 #include "pchdef.h"
 #include "ParallelProcessor.h"
 #include "Database/OpcodeCache.h"
+#include "Database/Config.h"
 #include "Misc/Utilities.h"
+#include "Misc/CsvWriter.h"
+#include "Misc/CpuTopology.h"
 #include "Common/ParseResult.h"
+#include "Common/PacketArena.h"
+#include "Common/SpellCastColumns.h"
+#include "RecordDecoder.h"
+
+#include <fmt/compile.h>
 
 using namespace PktParser::Reader;
 using namespace PktParser::Db;
@@ -12,226 +20,676 @@ using namespace PktParser::Common;
 
 namespace PktParser
 {
-    static thread_local std::string t_csvLine;
-
-    ParallelProcessor::ParallelProcessor(Db::Database* db, size_t threadCount /*= 0*/, bool toCSV /*= false*/)
-        : _db{ db }, _threadCount{ threadCount }, _toCSV{ toCSV }
+    ParallelProcessor::ParallelProcessor(Db::Database* db, size_t threadCount /*= 0*/, bool toCSV /*= false*/, bool toParquet /*= false*/, bool toArchive /*= false*/,
+        bool ordered /*= false*/, Placement placement /*= {}*/)
+        : _db{ db }, _es{ Config::GetEsSinkThreads(), Config::GetEsSinkQueue() }, _threadCount{ threadCount }, _toCSV{ toCSV }, _toParquet{ toParquet }, _toArchive{ toArchive }, _ordered{ ordered },
+        _layout{ Config::GetStorageLayout() }, _placement{ std::move(placement) }, _batchTarget{ Config::GetBatchTarget() }
     {
         if (toCSV)
             std::filesystem::create_directories("csv");
-
-        if (threadCount == 0)
+        if (toParquet)
+            std::filesystem::create_directories("parquet");
+        if (toArchive)
+            std::filesystem::create_directories("archive");
+
+        if (threadCount == 0 && !_placement.Cpus.empty())
+            _threadCount = std::max<size_t>(_placement.Cpus.size() - 1, 1);
+        else if (threadCount == 0)
         {
             _threadCount = std::thread::hardware_concurrency();
             if (_threadCount == 0)
                 _threadCount = 4;
         }
 
+        // one batch being filled, a full ring and one per worker
+        // ordered mode adds one more per worker, so a slow batch at the head doesn't stall everyone right away
+        // slabs are touched here, so with a pinned caller they sit on the reader's node
+        size_t poolSize = _threadCount * (_ordered ? 2 : 1) + MAX_QED_BATCHES + 1;
+        _freeBatches.emplace(poolSize);
+        for (size_t i = 0; i < poolSize; ++i)
+            _freeBatches->Push(std::make_unique<PacketBatch>(BATCH_MAX_PACKETS, BATCH_SLAB_BYTES));
+
+        // one writer per worker, or the single ordered one, each run file still large enough to make a sensible sstable
+        size_t rowWriters = std::max<size_t>(_placement.ShardCount, 1) * (_ordered ? 1 : _threadCount);
+        _sortedRowBytes = std::max<size_t>(Config::GetSortedRowsBytes() / rowWriters, 1024 * 1024);
+
+        if (_ordered)
+        {
+            _reorderWindow = poolSize;
+            _reorder = std::make_unique<ReorderSlot[]>(_reorderWindow);
+
+            std::string name = _placement.Shard == 0 ? "ordered" : fmt::format("ordered_{}", _placement.Shard);
+            if (_toCSV && _layout == StorageLayout::Block)
+                _orderedCsv.emplace(fmt::format("csv/blocks_{}.csv", name));
+            else if (_toCSV)
+                _orderedRows.emplace(fmt::format("csv/packets_{}", name), _sortedRowBytes);
+            if (_toParquet)
+                _orderedSpells.emplace(fmt::format("parquet/spell_casts_{}.parquet", name), Config::GetParquetRowGroupRows(), Config::GetParquetCompression());
+        }
+
+        _ackThread = std::thread(&ParallelProcessor::AckThread, this);
+
         for (size_t i = 0; i < _threadCount; ++i)
             _workers.emplace_back(&ParallelProcessor::WorkerThread, this, i);
     }
 
     ParallelProcessor::~ParallelProcessor()
     {
-        _done.store(true);
-        _queueCV.notify_all();
+        _batchRing.Close();
 
         for (auto& worker : _workers)
             worker.join();
+
+        if (_ordered)
+            _es.FlushStaged();
+
+        // every bulk answered, then every file's last insert back, only then has each batch been acknowledged
+        _es.Drain();
+        WaitIdle();
+
+        {
+            std::lock_guard<std::mutex> lock(_ackMutex);
+            _ackStop = true;
+        }
+        _ackCondition.notify_all();
+        _ackThread.join();
+
+        // closed here instead of with the members, files they hold rows of only count once they are on disk
+        _orderedRows.reset();
+        _orderedCsv.reset();
+        _orderedSpells.reset();
+
+        if (_journal)
+            for (auto const& [fileId, checkpoint] : _doneOnClose)
+                _journal->RecordDone(fileId, checkpoint);
     }
 
-    void ParallelProcessor::ProcessBatch(BatchWork const& work, Db::ElasticClient& es, FILE* csvFile, ZSTD_CCtx* cctx)
+    void ParallelProcessor::ProcessBatch(BatchWork const& work, Db::ElasticClient& es, Db::SortedRowWriter* rows, Misc::CsvWriter* csv, Db::PacketBlockBuilder* block,
+        Common::SpellCastParquetSink* spells, Db::ArchiveFrameBuilder* frame, ZSTD_CCtx* cctx, StagedOutput* staged)
     {
-        for (Pkt const& pkt : work.Packets)
+        FileJob& file = *work.File;
+        BatchAck* ack = work.Ack;
+        std::string* stagedCsv = staged && _toCSV ? &staged->BlockCsv : nullptr;
+        size_t parsed = 0;
+        size_t skipped = 0;
+        size_t failed = 0;
+
+        // ordered mode keeps what depends on order aside, cassandra writes go out right away either way
+        auto index = [&](Pkt const& pkt, char const* opcodeName, ParseResult const& result)
+        {
+            if (!staged)
+                es.IndexPacket(pkt.header, opcodeName, file.Build, pkt.pktNumber, result, file.SrcFile, file.FileIdStr);
+            else if (ElasticClient::WriteBulkEntry(staged->Bulk, pkt.header, opcodeName, file.Build, pkt.pktNumber, result, file.SrcFile, file.FileIdStr))
+                staged->BulkCount++;
+        };
+
+        auto flushFrame = [&]
+        {
+            if (staged)
+                frame->Flush(staged->Frames);
+            else
+                frame->Flush(*file.Archive);
+        };
+
+        // one snapshot per batch, dictionaries trained meanwhile are picked up by the next batch
+        std::shared_ptr<DictionarySet::Table const> dictionaries = file.Dictionaries ? file.Dictionaries->GetTable() : nullptr;
+
+        for (Pkt const& pkt : work.Batch->GetPackets())
         {
-            char const* opcodeName = OpcodeCache::Instance().GetOpcodeName(work.ParserVersion, pkt.header.opcode);
             try
             {
                 BitReader pktReader = pkt.CreateReader();
-                std::optional<ParseResult> pktDataOptResult = work.Parser->ParsePacket(pkt.header.opcode, pktReader);
+                std::optional<ParseResult> pktDataOptResult = file.Parser->ParsePacket(pkt.header.opcode, pktReader);
                 if (!pktDataOptResult)
                 {
-                    _skippedCount.fetch_add(1, std::memory_order_relaxed);
+                    ++skipped;
                     continue;
                 }
 
-                if (_toCSV)
+                char const* opcodeName = file.Opcodes->GetName(pkt.header.opcode);
+
+                ISearchFields const* fields = pktDataOptResult->searchFields;
+                if (fields && fields->GetKind() == RecordKind::SpellCast && (spells || (staged && _toParquet)))
+                {
+                    SpellCastRow row = MakeSpellCastRow(file.Build, pkt.header, pkt.pktNumber, static_cast<SpellSearchFields const&>(*fields));
+                    if (staged)
+                        staged->Spells.push_back(row);
+                    else
+                        spells->Append(row);
+                }
+
+                if (frame)
                 {
-                    std::span<uint8 const> compressed;
-                    std::string_view b64;
-                    if (!pktDataOptResult->json.empty())
+                    // the archive is read without the parser, binary records go in as the json they stand for
+                    std::string_view json = pktDataOptResult->payload;
+                    std::string decoded;
+                    if (pktDataOptResult->format == BlobFormat::Binary && !json.empty())
                     {
-                        compressed = Misc::CompressJson(pktDataOptResult->json, cctx);
-                        b64 = Misc::Base64Encode(compressed.data(), compressed.size());
+                        decoded = RecordDecoder::ToJson(std::span<uint8 const>(reinterpret_cast<uint8 const*>(json.data()), json.size()));
+                        json = decoded;
                     }
-                    else
-                        b64 = Misc::Base64Encode(pkt.data.data(), pkt.data.size());
 
-                    t_csvLine.clear();
-                    fmt::format_to(std::back_inserter(t_csvLine), "{},{},{},{},{},{},{},{},{}\n",
-                        work.Build, work.FileIdStr, pkt.pktNumber / 10000, pkt.pktNumber, static_cast<int>(pkt.header.direction),
-                        pkt.header.packetLength - 4, pkt.header.opcode, static_cast<int64>(pkt.header.timestamp), b64);
+                    frame->Add(pkt.header, opcodeName, pkt.pktNumber, json, pkt.data);
+                    if (frame->IsFull())
+                        flushFrame();
+                }
+
+                if (block)
+                {
+                    // a block is one zstd frame for many opcodes, per-opcode dictionaries don't apply
+                    std::string_view payload = pktDataOptResult->payload;
+                    bool isPayload = !payload.empty();
+                    std::span<uint8 const> data = isPayload
+                        ? std::span<uint8 const>(reinterpret_cast<uint8 const*>(payload.data()), payload.size())
+                        : std::span<uint8 const>(pkt.data);
+
+                    if (!block->Accepts(pkt.pktNumber))
+                        FlushBlock(file, *block, csv, stagedCsv, cctx, ack);
+                    block->Add(pkt.header, pkt.pktNumber, data, isPayload);
+
+                    index(pkt, opcodeName, *pktDataOptResult);
+                    ++parsed;
+                    continue;
+                }
 
-                    size_t written = fwrite(t_csvLine.data(), 1, t_csvLine.size(), csvFile);
-                    if (written != t_csvLine.size())
-                        LOG("ERROR: CSV write failed for pkt {} - tmpfs full?", pkt.pktNumber);
+                ZSTD_CDict const* dict = nullptr;
+                if (dictionaries && !pktDataOptResult->payload.empty())
+                    dict = file.Dictionaries->Select(*dictionaries, pkt.header.opcode, pktDataOptResult->payload);
+
+                if (rows || (staged && _toCSV))
+                {
+                    std::span<uint8 const> blob;
+                    if (!pktDataOptResult->payload.empty())
+                        blob = Misc::CompressJson(pktDataOptResult->payload, cctx, dict);
+                    else
+                        blob = pkt.data;
 
-                    es.IndexPacket(pkt.header, opcodeName, work.Build, pkt.pktNumber, *pktDataOptResult, work.SrcFile, work.FileIdStr);
+                    if (staged)
+                        staged->AddRow(pkt.header, pkt.pktNumber, blob);
+                    else
+                        rows->Add(file.Build, file.FileIdBytes, pkt.header, pkt.pktNumber, blob);
+                    index(pkt, opcodeName, *pktDataOptResult);
                 }
                 else
                 {
-                    es.IndexPacket(pkt.header, opcodeName, work.Build, pkt.pktNumber, *pktDataOptResult, work.SrcFile, work.FileIdStr);
-                    _db->StorePacket(pkt.header, work.Build, pkt.pktNumber, pktDataOptResult->json, pkt.data, work.FileId, cctx);
+                    index(pkt, opcodeName, *pktDataOptResult);
+                    _db->StorePacket(pkt.header, file.Build, pkt.pktNumber, pktDataOptResult->payload, pkt.data, file.FileId, cctx, dict, ack);
                 }
 
-                _parsedCount.fetch_add(1, std::memory_order_relaxed);
+                ++parsed;
             }
             catch (std::exception const& e)
             {
-                LOG("Failed to parse packet {} OP {}: {}", pkt.pktNumber, opcodeName, e.what());
-                _failedCount.fetch_add(1, std::memory_order_relaxed);
+                LOG("Failed to parse packet {} OP {}: {}", pkt.pktNumber, file.Opcodes->GetName(pkt.header.opcode), e.what());
+                ++failed;
             }
         }
+
+        // blocks and archive frames never span batches, whoever gets the next batch starts a fresh one
+        if (block && !block->IsEmpty())
+            FlushBlock(file, *block, csv, stagedCsv, cctx, ack);
+        if (frame)
+            flushFrame();
+
+        ack->ParsedCount = parsed;
+        ack->SkippedCount = skipped;
+        ack->FailedCount = failed;
+
+        file.ParsedCount.fetch_add(parsed, std::memory_order_relaxed);
+        file.SkippedCount.fetch_add(skipped, std::memory_order_relaxed);
+        file.FailedCount.fetch_add(failed, std::memory_order_relaxed);
+        _parsedCount.fetch_add(parsed, std::memory_order_relaxed);
+        _skippedCount.fetch_add(skipped, std::memory_order_relaxed);
+        _failedCount.fetch_add(failed, std::memory_order_relaxed);
     }
 
-    void ParallelProcessor::WorkerThread(size_t threadNumber)
+    void ParallelProcessor::FlushBlock(FileJob const& file, Db::PacketBlockBuilder& block, Misc::CsvWriter* csv, std::string* stagedCsv, ZSTD_CCtx* cctx, BatchAck* ack)
     {
-        static constexpr size_t LOG_EVERY_N_BATCHES = 100;
+        uint32 bucket = block.GetBucket();
+        uint32 firstPacket = block.GetFirstPacket();
+        uint32 count = block.GetCount();
 
-        ElasticClient es;
-        ZSTD_CCtx* cctx = ZSTD_createCCtx();
-        ZSTD_CCtx_setParameter(cctx, ZSTD_c_compressionLevel, 1);
+        std::span<uint8 const> blob = block.Finish(cctx);
 
-        FILE* csvFile = nullptr;
-        if (_toCSV)
+        if (!csv && !stagedCsv)
         {
-            std::string path = fmt::format("csv/pkt_thread_{}.csv", threadNumber);
-            csvFile = fopen(path.c_str(), "w");
-            setvbuf(csvFile, nullptr, _IOFBF, 1 << 16);
+            _db->StoreBlock(file.Build, file.FileId, bucket, firstPacket, count, blob, block.GetUncompressedSize(), ack);
+            return;
         }
 
+        size_t maxLine = CSV_FIXED_COLUMNS_MAX + Misc::Base64EncodedSize(blob.size()) + 1;
+        size_t stagedStart = stagedCsv ? stagedCsv->size() : 0;
+        if (stagedCsv)
+            stagedCsv->resize(stagedStart + maxLine);
+
+        char* out = stagedCsv ? stagedCsv->data() + stagedStart : csv->Reserve(maxLine);
+        out = fmt::format_to(out, FMT_COMPILE("{},{},{},{},{},"), file.Build, file.FileIdStr, bucket, firstPacket, count);
+        out += Misc::Base64EncodeTo(out, blob.data(), blob.size());
+        *out++ = '\n';
+
+        if (stagedCsv)
+            stagedCsv->resize(out - stagedCsv->data());
+        else
+            csv->Commit(out);
+    }
+
+    void ParallelProcessor::AdaptBatchBudget(size_t bytes, std::chrono::steady_clock::duration elapsed)
+    {
+        // batches the reader closed on its deadline say little about throughput
+        if (bytes < BATCH_MIN_BYTES || elapsed.count() <= 0)
+            return;
+
+        double target = static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(_batchTarget).count());
+        double sample = static_cast<double>(bytes) * target / static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+
+        // moving average over roughly the last 8 batches, clamped so one odd batch can't blow up memory
+        size_t budget = _batchBudget.load(std::memory_order_relaxed);
+        size_t next;
+        do
+        {
+            double smoothed = static_cast<double>(budget) + (sample - static_cast<double>(budget)) / 8.0;
+            next = std::clamp(static_cast<size_t>(smoothed), BATCH_MIN_BYTES, BATCH_MAX_BYTES);
+        } while (!_batchBudget.compare_exchange_weak(budget, next, std::memory_order_relaxed));
+    }
+
+    void ParallelProcessor::CommitReady()
+    {
+        // whoever wins the flag commits every consecutive ready slot, the rest just leave theirs behind
+        // after letting go it looks once more, a slot readied while it was finishing must not be stranded
+        while (!_committing.exchange(true))
+        {
+            while (true)
+            {
+                ReorderSlot& slot = _reorder[_nextCommit.load() % _reorderWindow];
+                if (!slot.Ready.load())
+                    break;
+
+                CommitStaged(slot);
+
+                BatchWork work = std::move(slot.Work);
+                slot.Ready.store(false);
+                _nextCommit.fetch_add(1);
+
+                RecycleBatch(std::move(work.Batch));
+                work.Ack->Release();
+            }
+
+            _committing.store(false);
+            if (!_reorder[_nextCommit.load() % _reorderWindow].Ready.load())
+                break;
+        }
+    }
+
+    void ParallelProcessor::CommitStaged(ReorderSlot& slot)
+    {
+        FileJob& file = *slot.Work.File;
+        StagedOutput& out = slot.Output;
+
+        if (_orderedRows)
+            for (StagedOutput::Row const& row : out.Rows)
+                _orderedRows->Add(file.Build, file.FileIdBytes, row.Header, row.PktNumber, std::span<uint8 const>(out.RowBytes.data() + row.Offset, row.Size));
+
+        if (_orderedCsv && !out.BlockCsv.empty())
+        {
+            char* dst = _orderedCsv->Reserve(out.BlockCsv.size());
+            std::memcpy(dst, out.BlockCsv.data(), out.BlockCsv.size());
+            _orderedCsv->Commit(dst + out.BlockCsv.size());
+        }
+
+        if (_orderedSpells)
+            for (SpellCastRow const& row : out.Spells)
+                _orderedSpells->Append(row);
+
+        for (StagedArchiveFrame const& frame : out.Frames)
+            file.Archive->AppendFrame(frame.Frame, frame.Compressed);
+
+        _es.IndexStaged(out.Bulk.GetView(), out.BulkCount, _journal ? slot.Work.Ack : nullptr);
+        out.Clear();
+    }
+
+    void ParallelProcessor::RecycleBatch(std::unique_ptr<PacketBatch> batch)
+    {
+        batch->Clear();
+        _freeBatches->Push(std::move(batch));
+    }
+
+    void ParallelProcessor::BatchAck::OnAcknowledged(bool failed)
+    {
+        SinkFailed = failed;
+        Owner->QueueAcknowledged(this);
+    }
+
+    void ParallelProcessor::QueueAcknowledged(BatchAck* ack)
+    {
+        {
+            std::lock_guard<std::mutex> lock(_ackMutex);
+            _acked.push_back(ack);
+        }
+        _ackCondition.notify_one();
+    }
+
+    void ParallelProcessor::AckThread()
+    {
+        std::vector<BatchAck*> acked;
         while (true)
         {
-            BatchWork work;
+            {
+                std::unique_lock<std::mutex> lock(_ackMutex);
+                _ackCondition.wait(lock, [this] { return !_acked.empty() || _ackStop; });
+                if (_acked.empty())
+                    return;
+                acked.swap(_acked);
+            }
 
+            // releasing may finish a file, which stores its metadata synchronously, so never on a driver thread
+            for (BatchAck* ack : acked)
             {
-                std::unique_lock<std::mutex> lock(_queueMutex);
-                _queueCV.wait(lock, [this]{ return !_batchQueue.empty() || _done.load(); });
+                std::unique_ptr<BatchAck> owned(ack);
+                AdvanceCheckpoint(*owned);
+                ReleaseFile(*owned->File);
+            }
+            acked.clear();
+        }
+    }
 
-                if (_batchQueue.empty() && _done.load())
-                    break;
+    void ParallelProcessor::AdvanceCheckpoint(BatchAck const& ack)
+    {
+        FileJob& file = *ack.File;
+        if (ack.SinkFailed && !file.CheckpointStalled)
+        {
+            LOG("CHECKPOINT: {} stays at packet {}, a sink gave up on packets {}-{}", file.SrcFile, file.Checkpoint.NextPacket, ack.FirstPacket, ack.EndPacket - 1);
+            file.CheckpointStalled = true;
+        }
+        if (file.CheckpointStalled || ack.FirstPacket == ack.EndPacket)
+            return;
+
+        file.Acked[ack.FirstPacket] = FileCheckpoint{ ack.EndPacket, ack.ParsedCount, ack.SkippedCount, ack.FailedCount };
+
+        bool moved = false;
+        for (auto itr = file.Acked.begin(); itr != file.Acked.end() && itr->first == file.Checkpoint.NextPacket; itr = file.Acked.erase(itr))
+        {
+            file.Checkpoint.NextPacket = itr->second.NextPacket;
+            file.Checkpoint.ParsedCount += itr->second.ParsedCount;
+            file.Checkpoint.SkippedCount += itr->second.SkippedCount;
+            file.Checkpoint.FailedCount += itr->second.FailedCount;
+            moved = true;
+        }
+
+        // export and parquet writers buffer across batches and archives are rewritten per file, those can only start a file over
+        if (moved && _journal && !_toCSV && !_toParquet && !_toArchive)
+            _journal->RecordProgress(file.FileIdStr, file.Checkpoint);
+    }
 
-                if (!_batchQueue.empty())
+    void ParallelProcessor::ReleaseFile(FileJob& file)
+    {
+        if (file.Pending.fetch_sub(1, std::memory_order_acq_rel) == 1)
+            FinishFile(file);
+    }
+
+    void ParallelProcessor::FinishFile(FileJob& file)
+    {
+        try
+        {
+            if (file.Archive)
+                file.Archive->Close();
+
+            if (!file.Aborted)
+            {
+                size_t parsed = file.ParsedCount.load(std::memory_order_relaxed);
+                // file_metadata is what ClaimFile skips on, a capture a sink gave up on must not look ingested
+                if (file.CheckpointStalled)
+                    LOG("WARN: {} was only partly stored, not recording it as ingested, re-run it", file.SrcFile);
+                else
+                    _db->StoreFileMetadata(file.FileId, file.SrcFile, file.Build, file.StartTime, static_cast<uint32>(file.Resumed.ParsedCount + parsed));
+
+                if (_journal && !file.CheckpointStalled)
                 {
-                    work = std::move(_batchQueue.front());
-                    _batchQueue.pop();
-                    _queueCV.notify_all();
+                    if (_toCSV || _toParquet)
+                    {
+                        std::lock_guard<std::mutex> lock(_doneMutex);
+                        _doneOnClose.emplace_back(file.FileIdStr, file.Checkpoint);
+                    }
+                    else
+                        _journal->RecordDone(file.FileIdStr, file.Checkpoint);
                 }
+
+                auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::high_resolution_clock::now() - file.Started);
+                if (file.OnDone)
+                    file.OnDone(Stats{ parsed, file.SkippedCount.load(std::memory_order_relaxed), file.FailedCount.load(std::memory_order_relaxed),
+                        static_cast<size_t>(duration.count()) });
             }
+        }
+        catch (std::exception const& e)
+        {
+            LOG("ERROR finishing {}: {}", file.SrcFile, e.what());
+        }
+
+        _filesInFlight.fetch_sub(1, std::memory_order_release);
+        _filesInFlight.notify_all();
+    }
+
+    std::string ParallelProcessor::WorkerName(size_t threadNumber) const
+    {
+        return _placement.Shard == 0 ? fmt::format("{}", threadNumber) : fmt::format("{}_{}", _placement.Shard, threadNumber);
+    }
+
+    void ParallelProcessor::WorkerThread(size_t threadNumber)
+    {
+        static constexpr size_t LOG_EVERY_N_BATCHES = 100;
+
+        // pinned before anything is allocated, so the arena and writers are first touched on this core's node
+        if (!_placement.Cpus.empty())
+        {
+            std::span<uint32 const> cpus(_placement.Cpus);
+            uint32 cpu = cpus.size() > 1 ? cpus[1 + threadNumber % (cpus.size() - 1)] : cpus[0];
+            if (!Misc::PinCurrentThread(std::span<uint32 const>(&cpu, 1)))
+                LOG("WARNING: could not pin worker {} to cpu {}", WorkerName(threadNumber), cpu);
+        }
+
+        ZSTD_CCtx* cctx = ZSTD_createCCtx();
+        ZSTD_CCtx_setParameter(cctx, ZSTD_c_compressionLevel, 1);
+
+        // packet rows leave pre-sorted for CQLSSTableWriter, blocks still go through csv
+        std::optional<Db::SortedRowWriter> rows;
+        std::optional<Misc::CsvWriter> csv;
+        if (_toCSV && !_ordered)
+        {
+            if (_layout == StorageLayout::Block)
+                csv.emplace(fmt::format("csv/blocks_thread_{}.csv", WorkerName(threadNumber)));
+            else
+                rows.emplace(fmt::format("csv/packets_thread_{}", WorkerName(threadNumber)), _sortedRowBytes);
+        }
+
+        // structures, search fields and payloads of a whole batch, dropped in one go once it is done
+        PacketArena arena(PACKET_ARENA_BYTES);
 
-            if (!work.Packets.empty())
+        std::optional<Db::PacketBlockBuilder> block;
+        if (_layout == StorageLayout::Block)
+            block.emplace();
+
+        std::optional<Db::ArchiveFrameBuilder> frame;
+        if (_toArchive)
+            frame.emplace(Config::GetArchiveFramePackets());
+
+        std::optional<SpellCastParquetSink> spells;
+        if (_toParquet && !_ordered)
+            spells.emplace(fmt::format("parquet/spell_casts_thread_{}.parquet", WorkerName(threadNumber)), Config::GetParquetRowGroupRows(), Config::GetParquetCompression());
+
+        BatchWork work;
+        while (_batchRing.Pop(work))
+        {
+            ReorderSlot* slot = _ordered ? &_reorder[work.Seq % _reorderWindow] : nullptr;
+            work.Ack = new BatchAck(this, work.File);
+
+            if (!work.Batch->IsEmpty())
             {
-                ProcessBatch(work, es, csvFile, cctx);
+                work.Ack->FirstPacket = work.Batch->GetPackets().front().pktNumber;
+                work.Ack->EndPacket = work.Batch->GetPackets().back().pktNumber + 1;
+
+                auto batchStart = std::chrono::steady_clock::now();
+                {
+                    PacketArena::Scope arenaScope(arena);
+                    ProcessBatch(work, _es, rows ? &*rows : nullptr, csv ? &*csv : nullptr, block ? &*block : nullptr,
+                        spells ? &*spells : nullptr, frame && work.File->Archive ? &*frame : nullptr, cctx, slot ? &slot->Output : nullptr);
+                }
+                arena.Reset();
+
+                // with a journal the batch's search documents leave with it, its checkpoint must not wait for a bulk to fill up
+                if (_journal && !slot)
+                    _es.FlushThread(work.Ack);
+
+                AdaptBatchBudget(work.Batch->GetBytes(), std::chrono::steady_clock::now() - batchStart);
 
-                _batchesCompleted.fetch_add(1, std::memory_order_relaxed);
-                _completionCV.notify_one();
-                
                 size_t count = _batchesProcessed.fetch_add(1, std::memory_order_relaxed);
                 if (count % LOG_EVERY_N_BATCHES == 0)
-                    LOG("Progress: ~{} packets parsed...", _parsedCount.load());
+                {
+                    LOG("Progress: ~{} packets parsed, batch budget {} KB...", _parsedCount.load(), GetBatchBudget() / 1024);
+                    LogStageMetrics();
+                }
             }
-        }
 
-        es.FlushThread();
+            if (slot)
+            {
+                // the batch is only recycled once committed, that is what keeps the reorder window bounded
+                slot->Work = std::move(work);
+                slot->Ready.store(true);
+                CommitReady();
+            }
+            else
+            {
+                RecycleBatch(std::move(work.Batch));
+                work.Ack->Release();
+            }
+            work = {};
+        }
 
-        if (csvFile)
-            fclose(csvFile);
+        _es.FlushThread();
     }
 
-    ParallelProcessor::Stats ParallelProcessor::ProcessFile(PktFileReader& reader, IVersionParser* parser, uint32 build, std::string const& parserVersion)
+    void ParallelProcessor::SubmitFile(PktFileReader& reader, IVersionParser* parser, uint32 build, std::string const& parserVersion, FileDoneCallback onDone)
     {
-        auto startTime = std::chrono::high_resolution_clock::now();
-        
-        std::string srcFile = reader.GetFilePath();
-        CassUuid fileId = Misc::GenerateFileId(reader.GetStartTime(), reader.GetFileSize());
+        auto file = std::make_shared<FileJob>();
+        file->Started = std::chrono::high_resolution_clock::now();
+        file->Parser = parser;
+        file->Build = build;
+        file->StartTime = static_cast<int64>(reader.GetStartTime());
+        file->SrcFile = reader.GetFilePath();
+        file->FileId = Misc::GenerateFileId(reader.GetContents());
+        file->OnDone = std::move(onDone);
 
         char uuidStr[CASS_UUID_STRING_LENGTH];
-        cass_uuid_string(fileId, uuidStr);
-        std::string fileIdStr(uuidStr);
-        LOG("Processing file '{}' with UUID {}", srcFile, fileIdStr);
-
-        _parsedCount.store(0);
-        _skippedCount.store(0);
-        _failedCount.store(0);
-        _batchesCompleted.store(0);
-        size_t batchesPushed = 0;
-
-        std::vector<Pkt> currentPackets;
-        currentPackets.reserve(BATCH_SIZE);
-
-		while (true)
-		{
-            std::optional<Pkt> pktOpt = reader.ReadNextPacket();
-            if (!pktOpt.has_value())
-                break;
-
-            currentPackets.push_back(std::move(*pktOpt));
+        cass_uuid_string(file->FileId, uuidStr);
+        file->FileIdStr = uuidStr;
+        file->FileIdBytes = ParseUuidBytes(file->FileIdStr);
+        LOG("Processing file '{}' with UUID {}", file->SrcFile, file->FileIdStr);
 
-            if (currentPackets.size() >= BATCH_SIZE)
+        if (std::optional<FileCheckpoint> recorded = _journal ? _journal->Find(file->FileIdStr) : std::nullopt)
+        {
+            if (recorded->Done)
             {
-                BatchWork work;
-                work.Packets = std::move(currentPackets);
-                work.Parser = parser;
-                work.Build = build;
-                work.ParserVersion = parserVersion;
-                work.SrcFile = srcFile;
-                work.FileId = fileId;
-                work.FileIdStr = fileIdStr;
+                LOG("RESUME: {} was already done ({} packets), skipping", file->SrcFile, recorded->NextPacket);
+                return;
+            }
 
-                {
-                    std::unique_lock<std::mutex> lock(_queueMutex);
-                    if (!_queueCV.wait_for(lock, std::chrono::seconds(15), [&]{ return _batchQueue.size() < MAX_QED_BATCHES; }))
-                        LOG("WARN: Queue full for 15s!");
-                    
-                    _batchQueue.push(std::move(work));
-                    _queueCV.notify_one();
-                }
+            uint32 skipped = reader.SkipPackets(recorded->NextPacket);
+            if (skipped != recorded->NextPacket)
+                LOG("WARNING: {} has {} packets, the journal has {} acknowledged", file->SrcFile, skipped, recorded->NextPacket);
+            LOG("RESUME: {} picks up at packet {} ({} parsed before)", file->SrcFile, skipped, recorded->ParsedCount);
 
-                batchesPushed++;
-                currentPackets.clear();
-                currentPackets.reserve(BATCH_SIZE);
-            }
-		}
+            file->Resumed = *recorded;
+            file->Checkpoint = *recorded;
+        }
+        // a file the journal has progress for is ours to finish, only unknown ones are checked for duplicates
+        // export writes file_metadata before the sstables are even generated, a row there proves nothing about the packets,
+        // so export runs only skip a capture seen earlier in the same run
+        else if (_skipIngested && _db && !_db->ClaimFile(file->FileId, !_toCSV))
+        {
+            LOG("SKIP: {} has the same content as an already ingested capture ({})", file->SrcFile, file->FileIdStr);
+            return;
+        }
+
+        file->Opcodes = OpcodeCache::Instance().GetLookup(parserVersion);
+        if (!file->Opcodes)
+            throw ParseException{ "No opcodes loaded for " + parserVersion };
 
-        if (!currentPackets.empty())
+        if (_toArchive)
+            file->Archive = std::make_shared<PacketArchiveWriter>(fmt::format("archive/{}.ndjson.zst", file->FileIdStr));
+
+        if (_layout == StorageLayout::Packet)
+            file->Dictionaries = ZstdDictionaries::Instance().GetSet(parserVersion, parser->GetBlobFormat());
+
+        // from here on the file is closed out by whoever releases it last, this thread included
+        _filesInFlight.fetch_add(1, std::memory_order_relaxed);
+
+        auto push = [&](std::unique_ptr<PacketBatch> batch)
         {
-            BatchWork work;
-            work.Packets = std::move(currentPackets);
-            work.Parser = parser;
-            work.Build = build;
-            work.ParserVersion = parserVersion;
-            work.SrcFile = srcFile;
-            work.FileId = fileId;
-            work.FileIdStr = fileIdStr;
+            file->Pending.fetch_add(1, std::memory_order_relaxed);
+
+            auto pushStart = std::chrono::steady_clock::now();
+            _batchRing.Push(BatchWork{ std::move(batch), file, _nextSeq++ });
+            auto waited = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - pushStart);
+            _readStallMicros.fetch_add(static_cast<uint64>(waited.count()), std::memory_order_relaxed);
+            if (waited >= std::chrono::seconds(15))
+                LOG("WARN: Queue full for {}s!", std::chrono::duration_cast<std::chrono::seconds>(waited).count());
+        };
+
+        std::unique_ptr<PacketBatch> batch;
+        try
+        {
+            // ordered output must not depend on timing, so there batches are cut on a fixed budget and never on the deadline
+            auto nextBudget = [this] { return _ordered ? BATCH_SLAB_BYTES : GetBatchBudget(); };
+
+            _freeBatches->Pop(batch);
+            size_t budget = nextBudget();
+            auto deadline = std::chrono::steady_clock::now() + _batchTarget;
 
-            std::unique_lock<std::mutex> lock(_queueMutex);
-            _batchQueue.push(std::move(work));
-            _queueCV.notify_one();
-            batchesPushed++;
+            while (reader.ReadNextPacket(*batch))
+            {
+                // the clock is only read every 256 packets
+                bool full = batch->GetCount() >= BATCH_MAX_PACKETS || batch->GetBytes() >= budget
+                    || (!_ordered && batch->GetCount() % 256 == 0 && std::chrono::steady_clock::now() >= deadline);
+                if (full)
+                {
+                    push(std::move(batch));
+                    _freeBatches->Pop(batch);
+                    budget = nextBudget();
+                    deadline = std::chrono::steady_clock::now() + _batchTarget;
+                }
+            }
+
+            if (!batch->IsEmpty())
+                push(std::move(batch));
+            else
+                RecycleBatch(std::move(batch));
         }
-        
+        catch (...)
         {
-            std::unique_lock<std::mutex> lock(_queueMutex);
-            _completionCV.wait(lock, [this, batchesPushed]{
-                return _batchesCompleted.load(std::memory_order_acquire) >= batchesPushed;
-            });
+            if (batch)
+                RecycleBatch(std::move(batch));
+
+            // batches already queued still run, the file just isn't recorded
+            file->Aborted = true;
+            ReleaseFile(*file);
+            throw;
         }
 
-        _db->StoreFileMetadata(fileId, srcFile, build, static_cast<int64>(reader.GetStartTime()), static_cast<uint32>(_parsedCount.load()));
+        ReleaseFile(*file);
+    }
 
-        auto endTime = std::chrono::high_resolution_clock::now();
-		auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(endTime - startTime);
+    void ParallelProcessor::LogStageMetrics() const
+    {
+        std::string cassandra = _db && !_toCSV
+            ? fmt::format(", cassandra in flight {}/{} (waited {}ms)", _db->GetPendingCount(), _db->GetMaxPending(), _db->GetStallMicros() / 1000)
+            : std::string();
 
-        return Stats{ _parsedCount.load(), _skippedCount.load(), _failedCount.load(), static_cast<size_t>(duration.count()) };
+        LOG("Stages: read -> parse {}/{} (waited {}ms), parse -> es {}/{} (waited {}ms){}",
+            _batchRing.GetSize(), _batchRing.GetCapacity(), _readStallMicros.load(std::memory_order_relaxed) / 1000,
+            _es.GetQueueDepth(), _es.GetQueueCapacity(), _es.GetStallMicros() / 1000, cassandra);
+    }
+
+    void ParallelProcessor::WaitIdle()
+    {
+        for (size_t inFlight; (inFlight = _filesInFlight.load(std::memory_order_acquire)) != 0;)
+            _filesInFlight.wait(inFlight);
     }
 }
\ No newline at end of file
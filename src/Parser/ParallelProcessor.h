@@ -1,14 +1,26 @@
 #pragma once
 
 #include "Reader/PktFileReader.h"
+#include "Reader/PacketBatch.h"
 #include "Database/Database.h"
 #include "Database/ElasticClient.h"
+#include "Database/OpcodeLookup.h"
+#include "Database/ZstdDictionaries.h"
+#include "Database/SortedRowWriter.h"
+#include "Database/PacketArchive.h"
+#include "Database/CheckpointJournal.h"
+#include "Database/SinkAck.h"
 #include "IVersionParser.h"
+#include "Misc/MpmcRing.h"
+#include "Misc/CsvWriter.h"
+#include "Common/SpellCastColumns.h"
 
 #include <vector>
 #include <thread>
 #include <atomic>
-#include <queue>
+#include <functional>
+#include <map>
+#include <mutex>
 #include <condition_variable>
 #include <cassandra.h>
 #include <zstd.h>
@@ -26,45 +38,220 @@ namespace PktParser
             size_t TotalTime;
         };
 
+        // runs on whichever thread releases the file last, usually the one handling acknowledged batches
+        using FileDoneCallback = std::function<void(Stats const&)>;
+
+        // where this processor's threads run, the default leaves it to the scheduler
+        struct Placement
+        {
+            std::vector<uint32> Cpus;       // Cpus[0] is the reader's (whoever calls SubmitFile), workers take the rest in turn
+            size_t Shard;                   // keeps per-worker output files apart when several processors run at once
+            size_t ShardCount;              // processors running at once, process-wide buffer budgets are split between them
+        };
+
     private:
-        static constexpr size_t BATCH_SIZE = 10000;
-        static constexpr size_t MAX_QED_BATCHES = 3;
+        // a batch closes on whichever comes first: the packet cap, the byte budget or the target duration on the reader side
+        static constexpr size_t BATCH_MAX_PACKETS = 65536;
+        static constexpr size_t BATCH_MIN_BYTES = 256 * 1024;
+        static constexpr size_t BATCH_MAX_BYTES = 64 * 1024 * 1024;
+        // ring capacity, a power of two
+        static constexpr size_t MAX_QED_BATCHES = 4;
+        // starting payload slab of a pooled batch, grown slabs keep their size
+        static constexpr size_t BATCH_SLAB_BYTES = 4 * 1024 * 1024;
+        // starting size of each worker's packet arena, it grows to whatever a batch needed
+        static constexpr size_t PACKET_ARENA_BYTES = 4 * 1024 * 1024;
+        // block csv: 4 numeric columns, the file uuid and separators, comfortably rounded up
+        static constexpr size_t CSV_FIXED_COLUMNS_MAX = 192;
 
-        struct BatchWork
+        struct BatchAck;
+
+        // one capture in flight, shared by its batches, whoever drops the last pending count closes it out
+        struct FileJob
         {
-            std::vector<Reader::Pkt> Packets;
             Versions::IVersionParser* Parser;
+            std::shared_ptr<Db::OpcodeLookup const> Opcodes;
+            std::shared_ptr<Db::DictionarySet> Dictionaries;
             uint32 Build;
-            std::string ParserVersion;
+            int64 StartTime;
             std::string SrcFile;
             CassUuid FileId;
             std::string FileIdStr;
+            Db::UuidBytes FileIdBytes;
+            std::shared_ptr<Db::PacketArchiveWriter> Archive;
+            FileDoneCallback OnDone;
+            std::chrono::high_resolution_clock::time_point Started;
+            bool Aborted = false;       // reading failed, no metadata and no callback
+
+            std::atomic<size_t> ParsedCount{ 0 };
+            std::atomic<size_t> SkippedCount{ 0 };
+            std::atomic<size_t> FailedCount{ 0 };
+            // one per queued batch until every sink acknowledged it, plus one the reader holds until the whole file is queued
+            std::atomic<size_t> Pending{ 1 };
+
+            // checkpoint, only touched on the ack thread: packets before Checkpoint.NextPacket are acknowledged,
+            // batches acknowledged ahead of a gap wait in Acked keyed by their first packet
+            Db::FileCheckpoint Resumed;     // what an earlier run had already recorded
+            Db::FileCheckpoint Checkpoint;
+            std::map<uint32, Db::FileCheckpoint> Acked;
+            bool CheckpointStalled = false; // a sink gave up on a batch, nothing past it may be recorded
+        };
+
+        // a batch until every sink acknowledged its writes, handed to the ack thread from whichever sink was last
+        struct BatchAck : Db::SinkAck
+        {
+            ParallelProcessor* Owner;
+            std::shared_ptr<FileJob> File;
+            uint32 FirstPacket = 0;
+            uint32 EndPacket = 0;
+            size_t ParsedCount = 0;
+            size_t SkippedCount = 0;
+            size_t FailedCount = 0;
+            bool SinkFailed = false;
+
+            BatchAck(ParallelProcessor* owner, std::shared_ptr<FileJob> file) : Owner{ owner }, File{ std::move(file) } { }
+
+        protected:
+            void OnAcknowledged(bool failed) override;
+        };
+
+        struct BatchWork
+        {
+            std::unique_ptr<Reader::PacketBatch> Batch;
+            std::shared_ptr<FileJob> File;
+            size_t Seq;         // read order, ordered mode commits by it
+            BatchAck* Ack = nullptr;
+        };
+
+        // ordered mode: what a batch has for the order-sensitive sinks, held until every earlier batch is committed
+        struct StagedOutput
+        {
+            struct Row
+            {
+                Reader::PktHeader Header;
+                uint32 PktNumber;
+                size_t Offset;
+                uint32 Size;
+            };
+
+            std::vector<Row> Rows;
+            std::vector<uint8> RowBytes;
+            std::string BlockCsv;
+            std::vector<Common::SpellCastRow> Spells;
+            std::vector<Db::StagedArchiveFrame> Frames;
+            Common::JsonWriter Bulk;
+            int32 BulkCount = 0;
+
+            void AddRow(Reader::PktHeader const& header, uint32 pktNumber, std::span<uint8 const> blob)
+            {
+                Rows.push_back(Row{ header, pktNumber, RowBytes.size(), static_cast<uint32>(blob.size()) });
+                RowBytes.insert(RowBytes.end(), blob.begin(), blob.end());
+            }
+
+            void Clear()
+            {
+                Rows.clear();
+                RowBytes.clear();
+                BlockCsv.clear();
+                Spells.clear();
+                Frames.clear();
+                Bulk.Clear();
+                BulkCount = 0;
+            }
+        };
+
+        // one per batch that can be in flight, indexed by Seq modulo the window
+        struct ReorderSlot
+        {
+            std::atomic<bool> Ready{ false };
+            BatchWork Work;
+            StagedOutput Output;
         };
 
         Db::Database* _db;
+        // sink stage for search documents, its own sender threads and bulk queue
+        Db::ElasticClient _es;
         std::vector<std::thread> _workers;
-        std::queue<BatchWork> _batchQueue;
-        std::mutex _queueMutex;
-        std::condition_variable _queueCV;
-        std::atomic<bool> _done{ false };
+        Misc::MpmcRing<BatchWork> _batchRing{ MAX_QED_BATCHES };
+        // batches not in flight, workers hand them back once processed, so what is in flight is capped by the pool
+        std::optional<Misc::MpmcRing<std::unique_ptr<Reader::PacketBatch>>> _freeBatches;
         size_t _threadCount;
         bool _toCSV;
+        bool _toParquet;
+        bool _toArchive;
+        bool _ordered;
+        Db::StorageLayout _layout;
+        Placement _placement;
+        size_t _sortedRowBytes = 0;         // per sorted row writer, SORTED_ROWS_MB split over every writer of the process
 
         std::atomic<size_t> _parsedCount{ 0 };
         std::atomic<size_t> _skippedCount{ 0 };
         std::atomic<size_t> _failedCount{ 0 };
         std::atomic<size_t> _batchesProcessed{ 0 };
-        std::atomic<size_t> _batchesCompleted{ 0 };
-	    std::condition_variable _completionCV;
+        std::atomic<size_t> _filesInFlight{ 0 };       // WaitIdle waits on it
+        std::atomic<uint64> _readStallMicros{ 0 };     // time the reader waited for room in _batchRing
+        std::chrono::milliseconds _batchTarget;
+        // bytes a worker gets through in about _batchTarget, re-estimated after every batch
+        std::atomic<size_t> _batchBudget{ BATCH_SLAB_BYTES };
+
+        // ordered mode: batches only go back to the pool once committed, so the window is the pool size
+        size_t _reorderWindow = 0;
+        std::unique_ptr<ReorderSlot[]> _reorder;
+        std::atomic<size_t> _nextCommit{ 0 };
+        std::atomic<bool> _committing{ false };
+        size_t _nextSeq = 0;            // reader side
+        // single writers for the whole run, only touched by whoever holds _committing
+        std::optional<Db::SortedRowWriter> _orderedRows;
+        std::optional<Misc::CsvWriter> _orderedCsv;
+        std::optional<Common::SpellCastParquetSink> _orderedSpells;
+
+        // acknowledged batches move checkpoints and release their file here, off the cassandra and elasticsearch threads
+        std::thread _ackThread;
+        std::mutex _ackMutex;
+        std::condition_variable _ackCondition;
+        std::vector<BatchAck*> _acked;
+        bool _ackStop = false;
+        Db::CheckpointJournal* _journal = nullptr;
+        bool _skipIngested = true;
+        // export and parquet writers buffer across files, their files only count once the writers are closed
+        std::mutex _doneMutex;
+        std::vector<std::pair<std::string, Db::FileCheckpoint>> _doneOnClose;
         
-        void ProcessBatch(BatchWork const& work, Db::ElasticClient& es, FILE* csvFile, ZSTD_CCtx* cctx);
+        void ProcessBatch(BatchWork const& work, Db::ElasticClient& es, Db::SortedRowWriter* rows, Misc::CsvWriter* csv, Db::PacketBlockBuilder* block,
+            Common::SpellCastParquetSink* spells, Db::ArchiveFrameBuilder* frame, ZSTD_CCtx* cctx, StagedOutput* staged);
+        void FlushBlock(FileJob const& file, Db::PacketBlockBuilder& block, Misc::CsvWriter* csv, std::string* stagedCsv, ZSTD_CCtx* cctx, BatchAck* ack);
+        void CommitReady();
+        void CommitStaged(ReorderSlot& slot);
+        void AdaptBatchBudget(size_t bytes, std::chrono::steady_clock::duration elapsed);
+        void RecycleBatch(std::unique_ptr<Reader::PacketBatch> batch);
+        void QueueAcknowledged(BatchAck* ack);
+        void AckThread();
+        void AdvanceCheckpoint(BatchAck const& ack);
+        void ReleaseFile(FileJob& file);
+        void FinishFile(FileJob& file);
         void WorkerThread(size_t threadCount);
+        std::string WorkerName(size_t threadNumber) const;
 
     public:
-        ParallelProcessor(Db::Database* db, size_t threadCount = 0, bool toCSV = false);
+        ParallelProcessor(Db::Database* db, size_t threadCount = 0, bool toCSV = false, bool toParquet = false, bool toArchive = false, bool ordered = false,
+            Placement placement = {});
         ~ParallelProcessor();
 
-        Stats ProcessFile(Reader::PktFileReader& reader, Versions::IVersionParser* parser, uint32 build, std::string const& parserVersion);
+        // journal to record acknowledged batches and finished files in and to resume from, call before the first SubmitFile
+        void SetCheckpoint(Db::CheckpointJournal* journal) { _journal = journal; }
+        // files are named by their content, one already submitted is skipped unless this is off,
+        // and so is one already in file_metadata when writing to cassandra directly
+        void SetSkipIngested(bool skip) { _skipIngested = skip; }
+
+        // queues the whole file and returns, its last batches still run while the next file is read
+        // onDone gets the file's stats once every sink acknowledged it and its metadata is stored
+        // a file the journal has as done is skipped, one it has progress for is picked up after the last acknowledged packet
+        void SubmitFile(Reader::PktFileReader& reader, Versions::IVersionParser* parser, uint32 build, std::string const& parserVersion, FileDoneCallback onDone);
+        // blocks until every submitted file is done
+        void WaitIdle();
         size_t GetThreadCount() const { return _threadCount; }
+        size_t GetBatchBudget() const { return _batchBudget.load(std::memory_order_relaxed); }
+
+        // queue depth and producer wait time per stage, the stage whose producers wait most is the bottleneck behind it
+        void LogStageMetrics() const;
     };
 }
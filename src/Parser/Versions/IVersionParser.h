@@ -10,8 +10,15 @@ namespace PktParser::Versions
 {
     class IVersionParser
     {
+    protected:
+        Common::BlobFormat _blobFormat = Common::BlobFormat::Json;
+
     public:
         virtual ~IVersionParser() = default;
         virtual std::optional<Common::ParseResult> ParsePacket(uint32 opcode, Reader::BitReader& reader) = 0;
+
+        // set once before parsing starts, decides how handlers encode ParseResult::payload
+        void SetBlobFormat(Common::BlobFormat format) { _blobFormat = format; }
+        Common::BlobFormat GetBlobFormat() const { return _blobFormat; }
     };
 }
@@ -0,0 +1,79 @@
+#include "pchdef.h"
+#include "RecordDecoder.h"
+#include "Common/RecordFormat.h"
+
+#include "V11_2_0_62213/Parser.h"
+#include "V11_2_0_62213/Serializers/SpellSerializer.h"
+#include "V11_2_5_63506/Parser.h"
+#include "V11_2_5_63506/Serializers/SpellSerializer.h"
+#include "V11_2_7_64632/Parser.h"
+#include "V11_2_7_64632/Serializers/SpellSerializer.h"
+#include "V11_2_7_64877/Parser.h"
+#include "V11_2_7_64877/Serializers/SpellSerializer.h"
+#include "V12_0_0_65390/Parser.h"
+#include "V12_0_0_65390/Serializers/SpellSerializer.h"
+#include "V12_0_1_65818/Parser.h"
+#include "V12_0_1_65818/Serializers/SpellSerializer.h"
+
+using namespace PktParser::Common;
+
+namespace PktParser::Versions
+{
+    namespace
+    {
+        static constexpr size_t RENDER_JSON_RESERVE = 8192;
+
+        template<typename DecodeFn, typename SerializeFn>
+        std::string RenderSpell(BinaryReader& r, DecodeFn decode, SerializeFn serialize)
+        {
+            JsonWriter w(RENDER_JSON_RESERVE);
+            serialize(w, decode(r));
+            return std::string(w.GetView());
+        }
+
+        std::string RenderSpellRecord(uint32 parserBuild, BinaryReader& r)
+        {
+            switch (parserBuild)
+            {
+                case V11_2_0_62213::PARSER_BUILD:
+                    return RenderSpell(r, V11_2_0_62213::Serializers::DecodeSpellData, V11_2_0_62213::Serializers::SerializeSpellData);
+                case V11_2_5_63506::PARSER_BUILD:
+                    return RenderSpell(r, V11_2_5_63506::Serializers::DecodeSpellData, V11_2_5_63506::Serializers::SerializeSpellData);
+                case V11_2_7_64632::PARSER_BUILD:
+                    return RenderSpell(r, V11_2_7_64632::Serializers::DecodeSpellData, V11_2_7_64632::Serializers::SerializeSpellData);
+                case V11_2_7_64877::PARSER_BUILD:
+                    return RenderSpell(r, V11_2_7_64877::Serializers::DecodeSpellData, V11_2_7_64877::Serializers::SerializeSpellData);
+                case V12_0_0_65390::PARSER_BUILD:
+                    return RenderSpell(r, V12_0_0_65390::Serializers::DecodeSpellData, V12_0_0_65390::Serializers::SerializeSpellData);
+                case V12_0_1_65818::PARSER_BUILD:
+                    return RenderSpell(r, V12_0_1_65818::Serializers::DecodeSpellData, V12_0_1_65818::Serializers::SerializeSpellData);
+                default:
+                    throw ParseException{ fmt::format("RecordDecoder: no parser for build {}", parserBuild) };
+            }
+        }
+    }
+
+    bool RecordDecoder::IsBinaryRecord(std::span<uint8 const> blob)
+    {
+        return !blob.empty() && blob[0] == RECORD_MAGIC;
+    }
+
+    std::string RecordDecoder::ToJson(std::span<uint8 const> blob)
+    {
+        if (!IsBinaryRecord(blob))
+            throw ParseException{ "RecordDecoder: not a binary record" };
+
+        BinaryReader r(blob.data() + 1, blob.size() - 1);
+        uint64 schemaId = r.VarUInt();
+        uint32 parserBuild = static_cast<uint32>(schemaId >> 8);
+        RecordKind kind = static_cast<RecordKind>(schemaId & 0xFF);
+
+        switch (kind)
+        {
+            case RecordKind::SpellCast:
+                return RenderSpellRecord(parserBuild, r);
+            default:
+                throw ParseException{ fmt::format("RecordDecoder: unknown record kind {} (build {})", static_cast<uint32>(kind), parserBuild) };
+        }
+    }
+}
@@ -0,0 +1,19 @@
+#pragma once
+
+#include "Misc/Define.h"
+
+#include <span>
+#include <string>
+
+namespace PktParser::Versions
+{
+    // read side of BlobFormat::Binary, blobs are kept compact and only rendered when someone looks at them
+    class RecordDecoder
+    {
+    public:
+        static bool IsBinaryRecord(std::span<uint8 const> blob);
+
+        // renders a (decompressed) binary record as the json its parser would have written, throws ParseException on unknown schemas
+        static std::string ToJson(std::span<uint8 const> blob);
+    };
+}
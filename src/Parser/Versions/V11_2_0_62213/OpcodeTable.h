@@ -0,0 +1,2137 @@
+// AUTO-GENERATED from database - DO NOT EDIT
+// parser version: V11_2_0_62213
+// total opcodes: 2124
+#pragma once
+
+#include "Common/OpcodeEntry.h"
+
+namespace PktParser::V11_2_0_62213
+{
+    inline constexpr Common::OpcodeEntry OPCODE_TABLE[] =
+    {
+        { 0x2F0299, "CMSG_ABANDON_NPE_RESPONSE", "ClientToServer" },
+        { 0x340029, "CMSG_ACCEPT_GUILD_INVITE", "ClientToServer" },
+        { 0x2F025A, "CMSG_ACCEPT_RETURNING_PLAYER_PROMPT", "ClientToServer" },
+        { 0x340174, "CMSG_ACCEPT_SOCIAL_CONTRACT", "ClientToServer" },
+        { 0x2F0004, "CMSG_ACCEPT_TRADE", "ClientToServer" },
+        { 0x34000C, "CMSG_ACCEPT_WARGAME_INVITE", "ClientToServer" },
+        { 0x2F02DC, "CMSG_ACCOUNT_BANK_DEPOSIT_MONEY", "ClientToServer" },
+        { 0x2F02DD, "CMSG_ACCOUNT_BANK_WITHDRAW_MONEY", "ClientToServer" },
+        { 0x340160, "CMSG_ACCOUNT_NOTIFICATION_ACKNOWLEDGED", "ClientToServer" },
+        { 0x3400C0, "CMSG_ACCOUNT_STORE_BEGIN_PURCHASE_OR_REFUND", "ClientToServer" },
+        { 0x2F0288, "CMSG_ACTIVATE_SOULBIND", "ClientToServer" },
+        { 0x30003E, "CMSG_ACTIVATE_TAXI", "ClientToServer" },
+        { 0x2F0171, "CMSG_ADD_ACCOUNT_COSMETIC", "ClientToServer" },
+        { 0x340086, "CMSG_ADD_BATTLENET_FRIEND", "ClientToServer" },
+        { 0x3400FE, "CMSG_ADD_FRIEND", "ClientToServer" },
+        { 0x340102, "CMSG_ADD_IGNORE", "ClientToServer" },
+        { 0x340004, "CMSG_ADDON_LIST", "ClientToServer" },
+        { 0x2F0170, "CMSG_ADD_TOY", "ClientToServer" },
+        { 0x2F00B3, "CMSG_ADVENTURE_JOURNAL_OPEN_QUEST", "ClientToServer" },
+        { 0x2F028B, "CMSG_ADVENTURE_JOURNAL_UPDATE_SUGGESTIONS", "ClientToServer" },
+        { 0x2F022B, "CMSG_ADVENTURE_MAP_START_QUEST", "ClientToServer" },
+        { 0x30008D, "CMSG_ALTER_APPEARANCE", "ClientToServer" },
+        { 0x300043, "CMSG_AREA_SPIRIT_HEALER_QUERY", "ClientToServer" },
+        { 0x300044, "CMSG_AREA_SPIRIT_HEALER_QUEUE", "ClientToServer" },
+        { 0x2F0086, "CMSG_AREA_TRIGGER", "ClientToServer" },
+        { 0x2F0056, "CMSG_ARTIFACT_ADD_POWER", "ClientToServer" },
+        { 0x2F0058, "CMSG_ARTIFACT_SET_APPEARANCE", "ClientToServer" },
+        { 0x2F00BF, "CMSG_ASSIGN_EQUIPMENT_SET_SPEC", "ClientToServer" },
+        { 0x2F011D, "CMSG_ATTACK_STOP", "ClientToServer" },
+        { 0x2F011C, "CMSG_ATTACK_SWING", "ClientToServer" },
+        { 0x340114, "CMSG_AUCTIONABLE_TOKEN_SELL", "ClientToServer" },
+        { 0x340115, "CMSG_AUCTIONABLE_TOKEN_SELL_AT_MARKET_PRICE", "ClientToServer" },
+        { 0x300061, "CMSG_AUCTION_BROWSE_QUERY", "ClientToServer" },
+        { 0x300069, "CMSG_AUCTION_CANCEL_COMMODITIES_PURCHASE", "ClientToServer" },
+        { 0x300068, "CMSG_AUCTION_CONFIRM_COMMODITIES_PURCHASE", "ClientToServer" },
+        { 0x300067, "CMSG_AUCTION_GET_COMMODITY_QUOTE", "ClientToServer" },
+        { 0x30005C, "CMSG_AUCTION_HELLO_REQUEST", "ClientToServer" },
+        { 0x300065, "CMSG_AUCTION_LIST_BIDDED_ITEMS", "ClientToServer" },
+        { 0x300066, "CMSG_AUCTION_LIST_BUCKETS_BY_BUCKET_KEYS", "ClientToServer" },
+        { 0x300062, "CMSG_AUCTION_LIST_ITEMS_BY_BUCKET_KEY", "ClientToServer" },
+        { 0x300063, "CMSG_AUCTION_LIST_ITEMS_BY_ITEM_ID", "ClientToServer" },
+        { 0x300064, "CMSG_AUCTION_LIST_OWNED_ITEMS", "ClientToServer" },
+        { 0x300060, "CMSG_AUCTION_PLACE_BID", "ClientToServer" },
+        { 0x30005E, "CMSG_AUCTION_REMOVE_ITEM", "ClientToServer" },
+        { 0x30005F, "CMSG_AUCTION_REPLICATE_ITEMS", "ClientToServer" },
+        { 0x30006A, "CMSG_AUCTION_SELL_COMMODITY", "ClientToServer" },
+        { 0x30005D, "CMSG_AUCTION_SELL_ITEM", "ClientToServer" },
+        { 0x340161, "CMSG_AUCTION_SET_FAVORITE_ITEM", "ClientToServer" },
+        { 0x350002, "CMSG_AUTH_CONTINUED_SESSION", "ClientToServer" },
+        { 0x350001, "CMSG_AUTH_SESSION", "ClientToServer" },
+        { 0x310003, "CMSG_AUTOBANK_ITEM", "ClientToServer" },
+        { 0x2F02E6, "CMSG_AUTO_DEPOSIT_ACCOUNT_BANK", "ClientToServer" },
+        { 0x2F02EE, "CMSG_AUTO_DEPOSIT_CHARACTER_BANK", "ClientToServer" },
+        { 0x310004, "CMSG_AUTO_EQUIP_ITEM", "ClientToServer" },
+        { 0x310009, "CMSG_AUTO_EQUIP_ITEM_SLOT", "ClientToServer" },
+        { 0x300048, "CMSG_AUTO_GUILD_BANK_ITEM", "ClientToServer" },
+        { 0x310005, "CMSG_AUTO_STORE_BAG_ITEM", "ClientToServer" },
+        { 0x310002, "CMSG_AUTOSTORE_BANK_ITEM", "ClientToServer" },
+        { 0x300051, "CMSG_AUTO_STORE_GUILD_BANK_ITEM", "ClientToServer" },
+        { 0x2F0256, "CMSG_AZERITE_EMPOWERED_ITEM_SELECT_POWER", "ClientToServer" },
+        { 0x2F0237, "CMSG_AZERITE_EMPOWERED_ITEM_VIEWED", "ClientToServer" },
+        { 0x2F0258, "CMSG_AZERITE_ESSENCE_ACTIVATE_ESSENCE", "ClientToServer" },
+        { 0x2F0257, "CMSG_AZERITE_ESSENCE_UNLOCK_MILESTONE", "ClientToServer" },
+        { 0x300046, "CMSG_BANKER_ACTIVATE", "ClientToServer" },
+        { 0x2F001F, "CMSG_BATTLEFIELD_LEAVE", "ClientToServer" },
+        { 0x2F002A, "CMSG_BATTLEFIELD_LIST", "ClientToServer" },
+        { 0x3000C3, "CMSG_BATTLEFIELD_PORT", "ClientToServer" },
+        { 0x2F018F, "CMSG_BATTLEMASTER_HELLO", "ClientToServer" },
+        { 0x3000BA, "CMSG_BATTLEMASTER_JOIN", "ClientToServer" },
+        { 0x3000BB, "CMSG_BATTLEMASTER_JOIN_ARENA", "ClientToServer" },
+        { 0x3000C1, "CMSG_BATTLEMASTER_JOIN_BRAWL", "ClientToServer" },
+        { 0x3000BD, "CMSG_BATTLEMASTER_JOIN_RATED_BG_BLITZ", "ClientToServer" },
+        { 0x3000BC, "CMSG_BATTLEMASTER_JOIN_RATED_SOLO_SHUFFLE", "ClientToServer" },
+        { 0x3000BE, "CMSG_BATTLEMASTER_JOIN_SKIRMISH", "ClientToServer" },
+        { 0x340101, "CMSG_BATTLENET_CHALLENGE_RESPONSE", "ClientToServer" },
+        { 0x340122, "CMSG_BATTLENET_REQUEST", "ClientToServer" },
+        { 0x3400FB, "CMSG_BATTLE_PAY_ACK_FAILED_RESPONSE", "ClientToServer" },
+        { 0x34013E, "CMSG_BATTLE_PAY_CANCEL_OPEN_CHECKOUT", "ClientToServer" },
+        { 0x3400FA, "CMSG_BATTLE_PAY_CONFIRM_PURCHASE_RESPONSE", "ClientToServer" },
+        { 0x3400F1, "CMSG_BATTLE_PAY_DISTRIBUTION_ASSIGN_TO_TARGET", "ClientToServer" },
+        { 0x340164, "CMSG_BATTLE_PAY_DISTRIBUTION_ASSIGN_VAS", "ClientToServer" },
+        { 0x3400E8, "CMSG_BATTLE_PAY_GET_PRODUCT_LIST", "ClientToServer" },
+        { 0x3400E9, "CMSG_BATTLE_PAY_GET_PURCHASE_LIST", "ClientToServer" },
+        { 0x340137, "CMSG_BATTLE_PAY_OPEN_CHECKOUT", "ClientToServer" },
+        { 0x340133, "CMSG_BATTLE_PAY_REQUEST_PRICE_INFO", "ClientToServer" },
+        { 0x3400F9, "CMSG_BATTLE_PAY_START_PURCHASE", "ClientToServer" },
+        { 0x340120, "CMSG_BATTLE_PAY_START_VAS_PURCHASE", "ClientToServer" },
+        { 0x290002, "CMSG_BATTLE_PET_CLEAR_FANFARE", "ClientToServer" },
+        { 0x34004F, "CMSG_BATTLE_PET_DELETE_PET", "ClientToServer" },
+        { 0x340050, "CMSG_BATTLE_PET_DELETE_PET_CHEAT", "ClientToServer" },
+        { 0x340052, "CMSG_BATTLE_PET_MODIFY_NAME", "ClientToServer" },
+        { 0x34004E, "CMSG_BATTLE_PET_REQUEST_JOURNAL", "ClientToServer" },
+        { 0x34004D, "CMSG_BATTLE_PET_REQUEST_JOURNAL_LOCK", "ClientToServer" },
+        { 0x340057, "CMSG_BATTLE_PET_SET_BATTLE_SLOT", "ClientToServer" },
+        { 0x34005A, "CMSG_BATTLE_PET_SET_FLAGS", "ClientToServer" },
+        { 0x340053, "CMSG_BATTLE_PET_SUMMON", "ClientToServer" },
+        { 0x2F0090, "CMSG_BATTLE_PET_UPDATE_DISPLAY_NOTIFY", "ClientToServer" },
+        { 0x2F008F, "CMSG_BATTLE_PET_UPDATE_NOTIFY", "ClientToServer" },
+        { 0x2F0001, "CMSG_BEGIN_TRADE", "ClientToServer" },
+        { 0x300045, "CMSG_BINDER_ACTIVATE", "ClientToServer" },
+        { 0x3000CB, "CMSG_BLACK_MARKET_BID_ON_ITEM", "ClientToServer" },
+        { 0x3000C9, "CMSG_BLACK_MARKET_OPEN", "ClientToServer" },
+        { 0x3000CA, "CMSG_BLACK_MARKET_REQUEST_ITEMS", "ClientToServer" },
+        { 0x2F0259, "CMSG_BONUS_ROLL", "ClientToServer" },
+        { 0x3400B1, "CMSG_BUG_REPORT", "ClientToServer" },
+        { 0x2F0002, "CMSG_BUSY_TRADE", "ClientToServer" },
+        { 0x300123, "CMSG_BUY_ACCOUNT_BANK_TAB", "ClientToServer" },
+        { 0x300037, "CMSG_BUY_BACK_ITEM", "ClientToServer" },
+        { 0x300036, "CMSG_BUY_ITEM", "ClientToServer" },
+        { 0x2F00A3, "CMSG_CAGE_BATTLE_PET", "ClientToServer" },
+        { 0x3400A9, "CMSG_CALENDAR_ADD_EVENT", "ClientToServer" },
+        { 0x34009D, "CMSG_CALENDAR_COMMUNITY_INVITE", "ClientToServer" },
+        { 0x3400A5, "CMSG_CALENDAR_COMPLAIN", "ClientToServer" },
+        { 0x3400A4, "CMSG_CALENDAR_COPY_EVENT", "ClientToServer" },
+        { 0x3400A7, "CMSG_CALENDAR_EVENT_SIGN_UP", "ClientToServer" },
+        { 0x34009B, "CMSG_CALENDAR_GET", "ClientToServer" },
+        { 0x34009C, "CMSG_CALENDAR_GET_EVENT", "ClientToServer" },
+        { 0x3400A6, "CMSG_CALENDAR_GET_NUM_PENDING", "ClientToServer" },
+        { 0x34009E, "CMSG_CALENDAR_INVITE", "ClientToServer" },
+        { 0x3400A2, "CMSG_CALENDAR_MODERATOR_STATUS", "ClientToServer" },
+        { 0x3400A3, "CMSG_CALENDAR_REMOVE_EVENT", "ClientToServer" },
+        { 0x34009F, "CMSG_CALENDAR_REMOVE_INVITE", "ClientToServer" },
+        { 0x3400A0, "CMSG_CALENDAR_RSVP", "ClientToServer" },
+        { 0x3400A1, "CMSG_CALENDAR_STATUS", "ClientToServer" },
+        { 0x3400AA, "CMSG_CALENDAR_UPDATE_EVENT", "ClientToServer" },
+        { 0x2F005A, "CMSG_CANCEL_AURA", "ClientToServer" },
+        { 0x30007F, "CMSG_CANCEL_AUTO_REPEAT_SPELL", "ClientToServer" },
+        { 0x2F0177, "CMSG_CANCEL_CAST", "ClientToServer" },
+        { 0x2F0138, "CMSG_CANCEL_CHANNELLING", "ClientToServer" },
+        { 0x2F0140, "CMSG_CANCEL_GROWTH_AURA", "ClientToServer" },
+        { 0x2F00CC, "CMSG_CANCEL_MASTER_LOOT_ROLL", "ClientToServer" },
+        { 0x2F0059, "CMSG_CANCEL_MOD_SPEED_NO_CONTROL_AURAS", "ClientToServer" },
+        { 0x2F0153, "CMSG_CANCEL_MOUNT_AURA", "ClientToServer" },
+        { 0x2F002B, "CMSG_CANCEL_QUEUED_SPELL", "ClientToServer" },
+        { 0x30008A, "CMSG_CANCEL_TEMP_ENCHANTMENT", "ClientToServer" },
+        { 0x2F0006, "CMSG_CANCEL_TRADE", "ClientToServer" },
+        { 0x34008E, "CMSG_CAN_DUEL", "ClientToServer" },
+        { 0x340132, "CMSG_CAN_REDEEM_TOKEN_FOR_BALANCE", "ClientToServer" },
+        { 0x2F0174, "CMSG_CAST_SPELL", "ClientToServer" },
+        { 0x2C0002, "CMSG_CHALLENGE_MODE_REQUEST_LEADERS", "ClientToServer" },
+        { 0x2F0211, "CMSG_CHANGE_BAG_SLOT_FLAG", "ClientToServer" },
+        { 0x2F0212, "CMSG_CHANGE_BANK_BAG_SLOT_FLAG", "ClientToServer" },
+        { 0x2F01F2, "CMSG_CHANGE_MONUMENT_APPEARANCE", "ClientToServer" },
+        { 0x340127, "CMSG_CHANGE_REALM_TICKET", "ClientToServer" },
+        { 0x340078, "CMSG_CHANGE_SUB_GROUP", "ClientToServer" },
+        { 0x3400F4, "CMSG_CHARACTER_CHECK_UPGRADE", "ClientToServer" },
+        { 0x3400EF, "CMSG_CHARACTER_RENAME_REQUEST", "ClientToServer" },
+        { 0x3400F2, "CMSG_CHARACTER_UPGRADE_MANUAL_UNREVOKE_REQUEST", "ClientToServer" },
+        { 0x3400F3, "CMSG_CHARACTER_UPGRADE_START", "ClientToServer" },
+        { 0x3400B8, "CMSG_CHAR_CUSTOMIZE", "ClientToServer" },
+        { 0x3400CA, "CMSG_CHAR_DELETE", "ClientToServer" },
+        { 0x3400BE, "CMSG_CHAR_RACE_OR_FACTION_CHANGE", "ClientToServer" },
+        { 0x2B002A, "CMSG_CHAT_ADDON_MESSAGE", "ClientToServer" },
+        { 0x2B002B, "CMSG_CHAT_ADDON_MESSAGE_TARGETED", "ClientToServer" },
+        { 0x2B0032, "CMSG_CHAT_CAN_LOCAL_WHISPER_TARGET_REQUEST", "ClientToServer" },
+        { 0x2B001F, "CMSG_CHAT_CHANNEL_ANNOUNCEMENTS", "ClientToServer" },
+        { 0x2B001D, "CMSG_CHAT_CHANNEL_BAN", "ClientToServer" },
+        { 0x2B0022, "CMSG_CHAT_CHANNEL_DECLINE_INVITE", "ClientToServer" },
+        { 0x2B0012, "CMSG_CHAT_CHANNEL_DISPLAY_LIST", "ClientToServer" },
+        { 0x2B001B, "CMSG_CHAT_CHANNEL_INVITE", "ClientToServer" },
+        { 0x2B001C, "CMSG_CHAT_CHANNEL_KICK", "ClientToServer" },
+        { 0x2B0011, "CMSG_CHAT_CHANNEL_LIST", "ClientToServer" },
+        { 0x2B0016, "CMSG_CHAT_CHANNEL_MODERATE", "ClientToServer" },
+        { 0x2B0017, "CMSG_CHAT_CHANNEL_MODERATOR", "ClientToServer" },
+        { 0x2B0015, "CMSG_CHAT_CHANNEL_OWNER", "ClientToServer" },
+        { 0x2B0013, "CMSG_CHAT_CHANNEL_PASSWORD", "ClientToServer" },
+        { 0x2B0014, "CMSG_CHAT_CHANNEL_SET_OWNER", "ClientToServer" },
+        { 0x2B0020, "CMSG_CHAT_CHANNEL_SILENCE_ALL", "ClientToServer" },
+        { 0x2B001E, "CMSG_CHAT_CHANNEL_UNBAN", "ClientToServer" },
+        { 0x2B0018, "CMSG_CHAT_CHANNEL_UNMODERATOR", "ClientToServer" },
+        { 0x2B0021, "CMSG_CHAT_CHANNEL_UNSILENCE_ALL", "ClientToServer" },
+        { 0x2B000A, "CMSG_CHAT_DROP_CAUTIONARY_CHAT_MESSAGE", "ClientToServer" },
+        { 0x2B0000, "CMSG_CHAT_JOIN_CHANNEL", "ClientToServer" },
+        { 0x2B0001, "CMSG_CHAT_LEAVE_CHANNEL", "ClientToServer" },
+        { 0x2B0031, "CMSG_CHAT_LOBBY_MATCHMAKER_MESSAGE_INSTANCE_CHAT", "ClientToServer" },
+        { 0x2B0030, "CMSG_CHAT_LOBBY_MATCHMAKER_MESSAGE_PARTY", "ClientToServer" },
+        { 0x2B000F, "CMSG_CHAT_MESSAGE_AFK", "ClientToServer" },
+        { 0x2B0007, "CMSG_CHAT_MESSAGE_CHANNEL", "ClientToServer" },
+        { 0x2B0010, "CMSG_CHAT_MESSAGE_DND", "ClientToServer" },
+        { 0x2B0024, "CMSG_CHAT_MESSAGE_EMOTE", "ClientToServer" },
+        { 0x2B000D, "CMSG_CHAT_MESSAGE_GUILD", "ClientToServer" },
+        { 0x2B0028, "CMSG_CHAT_MESSAGE_INSTANCE_CHAT", "ClientToServer" },
+        { 0x2B000E, "CMSG_CHAT_MESSAGE_OFFICER", "ClientToServer" },
+        { 0x2B0026, "CMSG_CHAT_MESSAGE_PARTY", "ClientToServer" },
+        { 0x2B0027, "CMSG_CHAT_MESSAGE_RAID", "ClientToServer" },
+        { 0x2B0029, "CMSG_CHAT_MESSAGE_RAID_WARNING", "ClientToServer" },
+        { 0x2B0023, "CMSG_CHAT_MESSAGE_SAY", "ClientToServer" },
+        { 0x2B0008, "CMSG_CHAT_MESSAGE_WHISPER", "ClientToServer" },
+        { 0x2B0025, "CMSG_CHAT_MESSAGE_YELL", "ClientToServer" },
+        { 0x2B0005, "CMSG_CHAT_REGISTER_ADDON_PREFIXES", "ClientToServer" },
+        { 0x2B0004, "CMSG_CHAT_REPORT_FILTERED", "ClientToServer" },
+        { 0x2B0003, "CMSG_CHAT_REPORT_IGNORED", "ClientToServer" },
+        { 0x2B000B, "CMSG_CHAT_SEND_CAUTIONARY_CHANNEL_MESSAGE", "ClientToServer" },
+        { 0x2B0009, "CMSG_CHAT_SEND_CAUTIONARY_CHAT_MESSAGE", "ClientToServer" },
+        { 0x2B0006, "CMSG_CHAT_UNREGISTER_ALL_ADDON_PREFIXES", "ClientToServer" },
+        { 0x340071, "CMSG_CHECK_CHARACTER_NAME_AVAILABILITY", "ClientToServer" },
+        { 0x2F010E, "CMSG_CHECK_IS_ADVENTURE_MAP_POI_VALID", "ClientToServer" },
+        { 0x2F017C, "CMSG_CHOICE_RESPONSE", "ClientToServer" },
+        { 0x2F0287, "CMSG_CHROMIE_TIME_SELECT_EXPANSION", "ClientToServer" },
+        { 0x2F0264, "CMSG_CLAIM_WEEKLY_REWARD", "ClientToServer" },
+        { 0x2F02C1, "CMSG_CLASS_TALENTS_DELETE_CONFIG", "ClientToServer" },
+        { 0x2F00C3, "CMSG_CLASS_TALENTS_NOTIFY_EMPTY_CONFIG", "ClientToServer" },
+        { 0x2F02C3, "CMSG_CLASS_TALENTS_NOTIFY_VALIDATION_FAILED", "ClientToServer" },
+        { 0x2F02C0, "CMSG_CLASS_TALENTS_RENAME_CONFIG", "ClientToServer" },
+        { 0x2F02BF, "CMSG_CLASS_TALENTS_REQUEST_NEW_CONFIG", "ClientToServer" },
+        { 0x2F02C4, "CMSG_CLASS_TALENTS_SET_STARTER_BUILD_ACTIVE", "ClientToServer" },
+        { 0x2F00C2, "CMSG_CLASS_TALENTS_SET_USES_SHARED_ACTION_BARS", "ClientToServer" },
+        { 0x290005, "CMSG_CLEAR_NEW_APPEARANCE", "ClientToServer" },
+        { 0x2F0052, "CMSG_CLEAR_RAID_MARKER", "ClientToServer" },
+        { 0x2F0008, "CMSG_CLEAR_TRADE_ITEM", "ClientToServer" },
+        { 0x3000C5, "CMSG_CLIENT_PORT_GRAVEYARD", "ClientToServer" },
+        { 0x300025, "CMSG_CLOSE_INTERACTION", "ClientToServer" },
+        { 0x2F017D, "CMSG_CLOSE_QUEST_CHOICE", "ClientToServer" },
+        { 0x2F028F, "CMSG_CLOSE_RUNEFORGE_INTERACTION", "ClientToServer" },
+        { 0x2F02C5, "CMSG_CLOSE_TRAIT_SYSTEM_INTERACTION", "ClientToServer" },
+        { 0x340149, "CMSG_CLUB_FINDER_APPLICATION_RESPONSE", "ClientToServer" },
+        { 0x340147, "CMSG_CLUB_FINDER_GET_APPLICANTS_LIST", "ClientToServer" },
+        { 0x340144, "CMSG_CLUB_FINDER_POST", "ClientToServer" },
+        { 0x34014B, "CMSG_CLUB_FINDER_REQUEST_CLUBS_DATA", "ClientToServer" },
+        { 0x340145, "CMSG_CLUB_FINDER_REQUEST_CLUBS_LIST", "ClientToServer" },
+        { 0x340146, "CMSG_CLUB_FINDER_REQUEST_MEMBERSHIP_TO_CLUB", "ClientToServer" },
+        { 0x34014A, "CMSG_CLUB_FINDER_REQUEST_PENDING_CLUBS_LIST", "ClientToServer" },
+        { 0x34014C, "CMSG_CLUB_FINDER_REQUEST_SUBSCRIBED_CLUB_POSTING_IDS", "ClientToServer" },
+        { 0x340148, "CMSG_CLUB_FINDER_RESPOND_TO_APPLICANT", "ClientToServer" },
+        { 0x340167, "CMSG_CLUB_FINDER_WHISPER_APPLICANT_REQUEST", "ClientToServer" },
+        { 0x340124, "CMSG_CLUB_PRESENCE_SUBSCRIBE", "ClientToServer" },
+        { 0x34005D, "CMSG_COLLECTION_ITEM_SET_FAVORITE", "ClientToServer" },
+        { 0x34001C, "CMSG_COMMENTATOR_ENABLE", "ClientToServer" },
+        { 0x340020, "CMSG_COMMENTATOR_ENTER_INSTANCE", "ClientToServer" },
+        { 0x340021, "CMSG_COMMENTATOR_EXIT_INSTANCE", "ClientToServer" },
+        { 0x34001D, "CMSG_COMMENTATOR_GET_MAP_INFO", "ClientToServer" },
+        { 0x34001F, "CMSG_COMMENTATOR_GET_PLAYER_COOLDOWNS", "ClientToServer" },
+        { 0x34001E, "CMSG_COMMENTATOR_GET_PLAYER_INFO", "ClientToServer" },
+        { 0x340165, "CMSG_COMMENTATOR_SPECTATE", "ClientToServer" },
+        { 0x34001B, "CMSG_COMMENTATOR_START_WARGAME", "ClientToServer" },
+        { 0x340112, "CMSG_COMMERCE_TOKEN_GET_COUNT", "ClientToServer" },
+        { 0x34011C, "CMSG_COMMERCE_TOKEN_GET_LOG", "ClientToServer" },
+        { 0x340113, "CMSG_COMMERCE_TOKEN_GET_MARKET_PRICE", "ClientToServer" },
+        { 0x340098, "CMSG_COMPLAINT", "ClientToServer" },
+        { 0x3000E3, "CMSG_COMPLETE_CINEMATIC", "ClientToServer" },
+        { 0x300075, "CMSG_COMPLETE_MOVIE", "ClientToServer" },
+        { 0x2F0057, "CMSG_CONFIRM_ARTIFACT_RESPEC", "ClientToServer" },
+        { 0x2F00C6, "CMSG_CONFIRM_PROFESSION_RESPEC", "ClientToServer" },
+        { 0x2F00C5, "CMSG_CONFIRM_RESPEC_WIPE", "ClientToServer" },
+        { 0x340000, "CMSG_CONNECT_TO_FAILED", "ClientToServer" },
+        { 0x340117, "CMSG_CONSUMABLE_TOKEN_BUY", "ClientToServer" },
+        { 0x340118, "CMSG_CONSUMABLE_TOKEN_BUY_AT_MARKET_PRICE", "ClientToServer" },
+        { 0x340116, "CMSG_CONSUMABLE_TOKEN_CAN_VETERAN_BUY", "ClientToServer" },
+        { 0x34011A, "CMSG_CONSUMABLE_TOKEN_REDEEM", "ClientToServer" },
+        { 0x34011B, "CMSG_CONSUMABLE_TOKEN_REDEEM_CONFIRMATION", "ClientToServer" },
+        { 0x2F02D5, "CMSG_CONTENT_TRACKING_START_TRACKING", "ClientToServer" },
+        { 0x2F02D6, "CMSG_CONTENT_TRACKING_STOP_TRACKING", "ClientToServer" },
+        { 0x3000FB, "CMSG_CONTRIBUTION_CONTRIBUTE", "ClientToServer" },
+        { 0x3000FC, "CMSG_CONTRIBUTION_LAST_UPDATE_REQUEST", "ClientToServer" },
+        { 0x3000E5, "CMSG_CONVERSATION_CINEMATIC_READY", "ClientToServer" },
+        { 0x3000E4, "CMSG_CONVERSATION_LINE_STARTED", "ClientToServer" },
+        { 0x2F02E5, "CMSG_CONVERT_ITEM_TO_BIND_TO_ACCOUNT", "ClientToServer" },
+        { 0x34007A, "CMSG_CONVERT_RAID", "ClientToServer" },
+        { 0x30010F, "CMSG_COVENANT_RENOWN_REQUEST_CATCHUP_STATE", "ClientToServer" },
+        { 0x30011B, "CMSG_CRAFTING_ORDER_CANCEL", "ClientToServer" },
+        { 0x300118, "CMSG_CRAFTING_ORDER_CLAIM", "ClientToServer" },
+        { 0x300114, "CMSG_CRAFTING_ORDER_CREATE", "ClientToServer" },
+        { 0x30011A, "CMSG_CRAFTING_ORDER_FULFILL", "ClientToServer" },
+        { 0x300117, "CMSG_CRAFTING_ORDER_GET_NPC_REWARD_INFO", "ClientToServer" },
+        { 0x300116, "CMSG_CRAFTING_ORDER_LIST_CRAFTER_ORDERS", "ClientToServer" },
+        { 0x300115, "CMSG_CRAFTING_ORDER_LIST_MY_ORDERS", "ClientToServer" },
+        { 0x30011C, "CMSG_CRAFTING_ORDER_REJECT", "ClientToServer" },
+        { 0x300119, "CMSG_CRAFTING_ORDER_RELEASE", "ClientToServer" },
+        { 0x30011D, "CMSG_CRAFTING_ORDER_REPORT_PLAYER", "ClientToServer" },
+        { 0x30011E, "CMSG_CRAFTING_ORDER_UPDATE_IGNORE_LIST", "ClientToServer" },
+        { 0x340070, "CMSG_CREATE_CHARACTER", "ClientToServer" },
+        { 0x2F01DB, "CMSG_CREATE_SHIPMENT", "ClientToServer" },
+        { 0x340010, "CMSG_DB_QUERY_BULK", "ClientToServer" },
+        { 0x3000B7, "CMSG_DECLINE_GUILD_INVITES", "ClientToServer" },
+        { 0x3000D2, "CMSG_DECLINE_PETITION", "ClientToServer" },
+        { 0x3000A3, "CMSG_DELETE_EQUIPMENT_SET", "ClientToServer" },
+        { 0x3400FF, "CMSG_DEL_FRIEND", "ClientToServer" },
+        { 0x340103, "CMSG_DEL_IGNORE", "ClientToServer" },
+        { 0x30012B, "CMSG_DELVE_TELEPORT_OUT", "ClientToServer" },
+        { 0x2F016A, "CMSG_DESTROY_ITEM", "ClientToServer" },
+        { 0x340044, "CMSG_DF_BOOT_PLAYER_VOTE", "ClientToServer" },
+        { 0x340036, "CMSG_DF_CONFIRM_EXPAND_SEARCH", "ClientToServer" },
+        { 0x340042, "CMSG_DF_GET_JOIN_STATUS", "ClientToServer" },
+        { 0x340041, "CMSG_DF_GET_SYSTEM_INFO", "ClientToServer" },
+        { 0x340037, "CMSG_DF_JOIN", "ClientToServer" },
+        { 0x340040, "CMSG_DF_LEAVE", "ClientToServer" },
+        { 0x340035, "CMSG_DF_PROPOSAL_RESPONSE", "ClientToServer" },
+        { 0x340048, "CMSG_DF_READY_CHECK_RESPONSE", "ClientToServer" },
+        { 0x340043, "CMSG_DF_SET_ROLES", "ClientToServer" },
+        { 0x340045, "CMSG_DF_TELEPORT", "ClientToServer" },
+        { 0x32005E, "CMSG_DISCARDED_TIME_SYNC_ACKS", "ClientToServer" },
+        { 0x300091, "CMSG_DISMISS_CRITTER", "ClientToServer" },
+        { 0x340143, "CMSG_DO_COUNTDOWN", "ClientToServer" },
+        { 0x2F00CB, "CMSG_DO_MASTER_LOOT_ROLL", "ClientToServer" },
+        { 0x34005E, "CMSG_DO_READY_CHECK", "ClientToServer" },
+        { 0x30007A, "CMSG_DUEL_RESPONSE", "ClientToServer" },
+        { 0x2F0103, "CMSG_EJECT_PASSENGER", "ClientToServer" },
+        { 0x3000DF, "CMSG_EMOTE", "ClientToServer" },
+        { 0x350007, "CMSG_ENABLE_NAGLE", "ClientToServer" },
+        { 0x30003C, "CMSG_ENABLE_TAXI_NODE", "ClientToServer" },
+        { 0x340111, "CMSG_ENGINE_SURVEY", "ClientToServer" },
+        { 0x350003, "CMSG_ENTER_ENCRYPTED_MODE_ACK", "ClientToServer" },
+        { 0x340014, "CMSG_ENUM_CHARACTERS", "ClientToServer" },
+        { 0x34010B, "CMSG_ENUM_CHARACTERS_DELETED_BY_CLIENT", "ClientToServer" },
+        { 0x300080, "CMSG_FAR_SIGHT", "ClientToServer" },
+        { 0x2F005E, "CMSG_GAME_EVENT_DEBUG_DISABLE", "ClientToServer" },
+        { 0x2F005D, "CMSG_GAME_EVENT_DEBUG_ENABLE", "ClientToServer" },
+        { 0x300087, "CMSG_GAME_OBJ_REPORT_USE", "ClientToServer" },
+        { 0x300086, "CMSG_GAME_OBJ_USE", "ClientToServer" },
+        { 0x2F01D6, "CMSG_GARRISON_ADD_FOLLOWER_HEALTH", "ClientToServer" },
+        { 0x2F01BC, "CMSG_GARRISON_ASSIGN_FOLLOWER_TO_BUILDING", "ClientToServer" },
+        { 0x2F01A9, "CMSG_GARRISON_CANCEL_CONSTRUCTION", "ClientToServer" },
+        { 0x2F020D, "CMSG_GARRISON_CHECK_UPGRADEABLE", "ClientToServer" },
+        { 0x2F01FF, "CMSG_GARRISON_COMPLETE_MISSION", "ClientToServer" },
+        { 0x2F01D7, "CMSG_GARRISON_FULLY_HEAL_ALL_FOLLOWERS", "ClientToServer" },
+        { 0x2F01BF, "CMSG_GARRISON_GENERATE_RECRUITS", "ClientToServer" },
+        { 0x2F01CE, "CMSG_GARRISON_GET_CLASS_SPEC_CATEGORY_INFO", "ClientToServer" },
+        { 0x2F01D5, "CMSG_GARRISON_GET_MAP_DATA", "ClientToServer" },
+        { 0x2F022F, "CMSG_GARRISON_GET_MISSION_REWARD", "ClientToServer" },
+        { 0x2F01CA, "CMSG_GARRISON_LEARN_TALENT", "ClientToServer" },
+        { 0x2F0201, "CMSG_GARRISON_MISSION_BONUS_ROLL", "ClientToServer" },
+        { 0x2F01A5, "CMSG_GARRISON_PURCHASE_BUILDING", "ClientToServer" },
+        { 0x2F01C1, "CMSG_GARRISON_RECRUIT_FOLLOWER", "ClientToServer" },
+        { 0x2F01F6, "CMSG_GARRISON_REMOVE_FOLLOWER", "ClientToServer" },
+        { 0x2F01BD, "CMSG_GARRISON_REMOVE_FOLLOWER_FROM_BUILDING", "ClientToServer" },
+        { 0x2F01BE, "CMSG_GARRISON_RENAME_FOLLOWER", "ClientToServer" },
+        { 0x2F01A4, "CMSG_GARRISON_REQUEST_BLUEPRINT_AND_SPECIALIZATION_DATA", "ClientToServer" },
+        { 0x2F01D9, "CMSG_GARRISON_REQUEST_SHIPMENT_INFO", "ClientToServer" },
+        { 0x2F01C2, "CMSG_GARRISON_RESEARCH_TALENT", "ClientToServer" },
+        { 0x2F01A6, "CMSG_GARRISON_SET_BUILDING_ACTIVE", "ClientToServer" },
+        { 0x2F01BA, "CMSG_GARRISON_SET_FOLLOWER_FAVORITE", "ClientToServer" },
+        { 0x2F01B2, "CMSG_GARRISON_SET_FOLLOWER_INACTIVE", "ClientToServer" },
+        { 0x2F01C0, "CMSG_GARRISON_SET_RECRUITMENT_PREFERENCES", "ClientToServer" },
+        { 0x2F029C, "CMSG_GARRISON_SOCKET_TALENT", "ClientToServer" },
+        { 0x2F01FE, "CMSG_GARRISON_START_MISSION", "ClientToServer" },
+        { 0x2F01AA, "CMSG_GARRISON_SWAP_BUILDINGS", "ClientToServer" },
+        { 0x340013, "CMSG_GENERATE_RANDOM_CHARACTER_NAME", "ClientToServer" },
+        { 0x3400E3, "CMSG_GET_ACCOUNT_CHARACTER_LIST", "ClientToServer" },
+        { 0x34015F, "CMSG_GET_ACCOUNT_NOTIFICATIONS", "ClientToServer" },
+        { 0x2F019F, "CMSG_GET_GARRISON_INFO", "ClientToServer" },
+        { 0x3000CD, "CMSG_GET_ITEM_PURCHASE_DATA", "ClientToServer" },
+        { 0x2F01DA, "CMSG_GET_LANDING_PAGE_SHIPMENTS", "ClientToServer" },
+        { 0x2F016E, "CMSG_GET_MIRROR_IMAGE_DATA", "ClientToServer" },
+        { 0x34001A, "CMSG_GET_PVP_OPTIONS_ENABLED", "ClientToServer" },
+        { 0x34014D, "CMSG_GET_RAF_ACCOUNT_INFO", "ClientToServer" },
+        { 0x340190, "CMSG_GET_REGIONWIDE_CHARACTER_RESTRICTION_AND_MAIL_DATA", "ClientToServer" },
+        { 0x340119, "CMSG_GET_REMAINING_GAME_TIME", "ClientToServer" },
+        { 0x2F01EF, "CMSG_GET_TROPHY_LIST", "ClientToServer" },
+        { 0x34010D, "CMSG_GET_UNDELETE_CHARACTER_COOLDOWN_STATUS", "ClientToServer" },
+        { 0x34011E, "CMSG_GET_VAS_ACCOUNT_CHARACTER_LIST", "ClientToServer" },
+        { 0x34011F, "CMSG_GET_VAS_TRANSFER_TARGET_REALM_LIST", "ClientToServer" },
+        { 0x3400BC, "CMSG_GM_TICKET_ACKNOWLEDGE_SURVEY", "ClientToServer" },
+        { 0x3400BB, "CMSG_GM_TICKET_GET_CASE_STATUS", "ClientToServer" },
+        { 0x3400BA, "CMSG_GM_TICKET_GET_SYSTEM_STATUS", "ClientToServer" },
+        { 0x30010E, "CMSG_GOSSIP_REFRESH_OPTIONS", "ClientToServer" },
+        { 0x300026, "CMSG_GOSSIP_SELECT_OPTION", "ClientToServer" },
+        { 0x2D0020, "CMSG_GUILD_ADD_BATTLENET_FRIEND", "ClientToServer" },
+        { 0x2D0005, "CMSG_GUILD_ADD_RANK", "ClientToServer" },
+        { 0x2D0002, "CMSG_GUILD_ASSIGN_MEMBER_RANK", "ClientToServer" },
+        { 0x300047, "CMSG_GUILD_BANK_ACTIVATE", "ClientToServer" },
+        { 0x300055, "CMSG_GUILD_BANK_BUY_TAB", "ClientToServer" },
+        { 0x300057, "CMSG_GUILD_BANK_DEPOSIT_MONEY", "ClientToServer" },
+        { 0x2D0019, "CMSG_GUILD_BANK_LOG_QUERY", "ClientToServer" },
+        { 0x300054, "CMSG_GUILD_BANK_QUERY_TAB", "ClientToServer" },
+        { 0x2D001A, "CMSG_GUILD_BANK_REMAINING_WITHDRAW_MONEY_QUERY", "ClientToServer" },
+        { 0x2D001D, "CMSG_GUILD_BANK_SET_TAB_TEXT", "ClientToServer" },
+        { 0x2D001E, "CMSG_GUILD_BANK_TEXT_QUERY", "ClientToServer" },
+        { 0x300056, "CMSG_GUILD_BANK_UPDATE_TAB", "ClientToServer" },
+        { 0x300058, "CMSG_GUILD_BANK_WITHDRAW_MONEY", "ClientToServer" },
+        { 0x2D0017, "CMSG_GUILD_CHALLENGE_UPDATE_REQUEST", "ClientToServer" },
+        { 0x2D0018, "CMSG_GUILD_CHANGE_NAME_REQUEST", "ClientToServer" },
+        { 0x34002A, "CMSG_GUILD_DECLINE_INVITATION", "ClientToServer" },
+        { 0x2D0009, "CMSG_GUILD_DELETE", "ClientToServer" },
+        { 0x2D0006, "CMSG_GUILD_DELETE_RANK", "ClientToServer" },
+        { 0x2D0001, "CMSG_GUILD_DEMOTE_MEMBER", "ClientToServer" },
+        { 0x2D001C, "CMSG_GUILD_EVENT_LOG_QUERY", "ClientToServer" },
+        { 0x2D0012, "CMSG_GUILD_GET_ACHIEVEMENT_MEMBERS", "ClientToServer" },
+        { 0x2D000E, "CMSG_GUILD_GET_RANKS", "ClientToServer" },
+        { 0x2D0014, "CMSG_GUILD_GET_ROSTER", "ClientToServer" },
+        { 0x340034, "CMSG_GUILD_INVITE_BY_NAME", "ClientToServer" },
+        { 0x2D0003, "CMSG_GUILD_LEAVE", "ClientToServer" },
+        { 0x2D000F, "CMSG_GUILD_NEWS_UPDATE_STICKY", "ClientToServer" },
+        { 0x2D0004, "CMSG_GUILD_OFFICER_REMOVE_MEMBER", "ClientToServer" },
+        { 0x2D001B, "CMSG_GUILD_PERMISSIONS_QUERY", "ClientToServer" },
+        { 0x2D0000, "CMSG_GUILD_PROMOTE_MEMBER", "ClientToServer" },
+        { 0x2D000A, "CMSG_GUILD_QUERY_MEMBER_RECIPES", "ClientToServer" },
+        { 0x2D000C, "CMSG_GUILD_QUERY_MEMBERS_FOR_RECIPE", "ClientToServer" },
+        { 0x2D000D, "CMSG_GUILD_QUERY_NEWS", "ClientToServer" },
+        { 0x2D000B, "CMSG_GUILD_QUERY_RECIPES", "ClientToServer" },
+        { 0x2D001F, "CMSG_GUILD_REPLACE_GUILD_MASTER", "ClientToServer" },
+        { 0x2D0023, "CMSG_GUILD_REQUEST_RENAME", "ClientToServer" },
+        { 0x2D0022, "CMSG_GUILD_REQUEST_RENAME_NAME_CHECK", "ClientToServer" },
+        { 0x2D0024, "CMSG_GUILD_REQUEST_RENAME_REFUND", "ClientToServer" },
+        { 0x2D0021, "CMSG_GUILD_REQUEST_RENAME_STATUS", "ClientToServer" },
+        { 0x2D0010, "CMSG_GUILD_SET_ACHIEVEMENT_TRACKING", "ClientToServer" },
+        { 0x2D0011, "CMSG_GUILD_SET_FOCUSED_ACHIEVEMENT", "ClientToServer" },
+        { 0x3400F6, "CMSG_GUILD_SET_GUILD_MASTER", "ClientToServer" },
+        { 0x2D0013, "CMSG_GUILD_SET_MEMBER_NOTE", "ClientToServer" },
+        { 0x2D0008, "CMSG_GUILD_SET_RANK_PERMISSIONS", "ClientToServer" },
+        { 0x2D0007, "CMSG_GUILD_SHIFT_RANK", "ClientToServer" },
+        { 0x2D0016, "CMSG_GUILD_UPDATE_INFO_TEXT", "ClientToServer" },
+        { 0x2D0015, "CMSG_GUILD_UPDATE_MOTD_TEXT", "ClientToServer" },
+        { 0x30009F, "CMSG_HEARTH_AND_RESURRECT", "ClientToServer" },
+        { 0x2F017E, "CMSG_HIDE_QUEST_CHOICE", "ClientToServer" },
+        { 0x340011, "CMSG_HOTFIX_REQUEST", "ClientToServer" },
+        { 0x2F0003, "CMSG_IGNORE_TRADE", "ClientToServer" },
+        { 0x340006, "CMSG_INITIATE_ROLE_POLL", "ClientToServer" },
+        { 0x2F0000, "CMSG_INITIATE_TRADE", "ClientToServer" },
+        { 0x3000C7, "CMSG_INSPECT", "ClientToServer" },
+        { 0x340061, "CMSG_INSTANCE_ABANDON_VOTE_RESPONSE", "ClientToServer" },
+        { 0x3000A4, "CMSG_INSTANCE_LOCK_RESPONSE", "ClientToServer" },
+        { 0x2F0260, "CMSG_ISLAND_QUEUE", "ClientToServer" },
+        { 0x3000CE, "CMSG_ITEM_PURCHASE_REFUND", "ClientToServer" },
+        { 0x2F020E, "CMSG_ITEM_TEXT_QUERY", "ClientToServer" },
+        { 0x2F008D, "CMSG_JOIN_PET_BATTLE_QUEUE", "ClientToServer" },
+        { 0x2F0025, "CMSG_JOIN_RATED_BATTLEGROUND", "ClientToServer" },
+        { 0x3400AB, "CMSG_KEEP_ALIVE", "ClientToServer" },
+        { 0x2F00E1, "CMSG_KEYBOUND_OVERRIDE", "ClientToServer" },
+        { 0x35000D, "CMSG_LATENCY_REPORT", "ClientToServer" },
+        { 0x3000FA, "CMSG_LEARN_PVP_TALENTS", "ClientToServer" },
+        { 0x3000F8, "CMSG_LEARN_TALENTS", "ClientToServer" },
+        { 0x340075, "CMSG_LEAVE_GROUP", "ClientToServer" },
+        { 0x2F008E, "CMSG_LEAVE_PET_BATTLE_QUEUE", "ClientToServer" },
+        { 0x34003B, "CMSG_LFG_LIST_APPLY_TO_GROUP", "ClientToServer" },
+        { 0x34003C, "CMSG_LFG_LIST_CANCEL_APPLICATION", "ClientToServer" },
+        { 0x34003D, "CMSG_LFG_LIST_DECLINE_APPLICANT", "ClientToServer" },
+        { 0x340039, "CMSG_LFG_LIST_GET_STATUS", "ClientToServer" },
+        { 0x34003E, "CMSG_LFG_LIST_INVITE_APPLICANT", "ClientToServer" },
+        { 0x34003F, "CMSG_LFG_LIST_INVITE_RESPONSE", "ClientToServer" },
+        { 0x2F0254, "CMSG_LFG_LIST_JOIN", "ClientToServer" },
+        { 0x340038, "CMSG_LFG_LIST_LEAVE", "ClientToServer" },
+        { 0x34003A, "CMSG_LFG_LIST_SEARCH", "ClientToServer" },
+        { 0x2F0255, "CMSG_LFG_LIST_UPDATE_REQUEST", "ClientToServer" },
+        { 0x300033, "CMSG_LIST_INVENTORY", "ClientToServer" },
+        { 0x3400E6, "CMSG_LIVE_REGION_ACCOUNT_RESTORE", "ClientToServer" },
+        { 0x3400E5, "CMSG_LIVE_REGION_CHARACTER_COPY", "ClientToServer" },
+        { 0x3400E4, "CMSG_LIVE_REGION_GET_ACCOUNT_CHARACTER_LIST", "ClientToServer" },
+        { 0x3400E7, "CMSG_LIVE_REGION_KEY_BINDINGS_COPY", "ClientToServer" },
+        { 0x340024, "CMSG_LOADING_SCREEN_NOTIFY", "ClientToServer" },
+        { 0x2F01F0, "CMSG_LOAD_SELECTED_TROPHY", "ClientToServer" },
+        { 0x340172, "CMSG_LOBBY_MATCHMAKER_ABANDON_QUEUE", "ClientToServer" },
+        { 0x340169, "CMSG_LOBBY_MATCHMAKER_ACCEPT_PARTY_INVITE", "ClientToServer" },
+        { 0x34017B, "CMSG_LOBBY_MATCHMAKER_CREATE_CHARACTER", "ClientToServer" },
+        { 0x340170, "CMSG_LOBBY_MATCHMAKER_ENTER_QUEUE", "ClientToServer" },
+        { 0x34016C, "CMSG_LOBBY_MATCHMAKER_LEAVE_PARTY", "ClientToServer" },
+        { 0x340168, "CMSG_LOBBY_MATCHMAKER_PARTY_INVITE", "ClientToServer" },
+        { 0x34016B, "CMSG_LOBBY_MATCHMAKER_PARTY_UNINVITE", "ClientToServer" },
+        { 0x340171, "CMSG_LOBBY_MATCHMAKER_QUEUE_PROPSAL_RESPONSE", "ClientToServer" },
+        { 0x34016A, "CMSG_LOBBY_MATCHMAKER_REJECT_PARTY_INVITE", "ClientToServer" },
+        { 0x34016D, "CMSG_LOBBY_MATCHMAKER_SET_PARTY_PLAYLIST_ENTRY", "ClientToServer" },
+        { 0x34016E, "CMSG_LOBBY_MATCHMAKER_SET_PLAYER_READY", "ClientToServer" },
+        { 0x350005, "CMSG_LOG_DISCONNECT", "ClientToServer" },
+        { 0x300070, "CMSG_LOGOUT_CANCEL", "ClientToServer" },
+        { 0x300071, "CMSG_LOGOUT_INSTANT", "ClientToServer" },
+        { 0x300122, "CMSG_LOGOUT_LOBBY_MATCHMAKER", "ClientToServer" },
+        { 0x30006F, "CMSG_LOGOUT_REQUEST", "ClientToServer" },
+        { 0x350009, "CMSG_LOG_STREAMING_ERROR", "ClientToServer" },
+        { 0x2F00C9, "CMSG_LOOT_ITEM", "ClientToServer" },
+        { 0x2F00C8, "CMSG_LOOT_MONEY", "ClientToServer" },
+        { 0x2F00CD, "CMSG_LOOT_RELEASE", "ClientToServer" },
+        { 0x2F00CE, "CMSG_LOOT_ROLL", "ClientToServer" },
+        { 0x2F00C7, "CMSG_LOOT_UNIT", "ClientToServer" },
+        { 0x3400CE, "CMSG_LOW_LEVEL_RAID1", "ClientToServer" },
+        { 0x3000AB, "CMSG_LOW_LEVEL_RAID2", "ClientToServer" },
+        { 0x3000D9, "CMSG_MAIL_CREATE_TEXT_ITEM", "ClientToServer" },
+        { 0x2F00E3, "CMSG_MAIL_DELETE", "ClientToServer" },
+        { 0x3000D4, "CMSG_MAIL_GET_LIST", "ClientToServer" },
+        { 0x3000D8, "CMSG_MAIL_MARK_AS_READ", "ClientToServer" },
+        { 0x340081, "CMSG_MAIL_RETURN_TO_SENDER", "ClientToServer" },
+        { 0x3000D6, "CMSG_MAIL_TAKE_ITEM", "ClientToServer" },
+        { 0x3000D5, "CMSG_MAIL_TAKE_MONEY", "ClientToServer" },
+        { 0x2F00E4, "CMSG_MAKE_CONTITIONAL_APPEARANCE_PERMANENT", "ClientToServer" },
+        { 0x2F00CA, "CMSG_MASTER_LOOT_ITEM", "ClientToServer" },
+        { 0x300052, "CMSG_MERGE_GUILD_BANK_ITEM_WITH_GUILD_BANK_ITEM", "ClientToServer" },
+        { 0x30004F, "CMSG_MERGE_GUILD_BANK_ITEM_WITH_ITEM", "ClientToServer" },
+        { 0x30004D, "CMSG_MERGE_ITEM_WITH_GUILD_BANK_ITEM", "ClientToServer" },
+        { 0x340077, "CMSG_MINIMAP_PING", "ClientToServer" },
+        { 0x2F0036, "CMSG_MISSILE_TRAJECTORY_COLLISION", "ClientToServer" },
+        { 0x290003, "CMSG_MOUNT_CLEAR_FANFARE", "ClientToServer" },
+        { 0x34005C, "CMSG_MOUNT_SET_FAVORITE", "ClientToServer" },
+        { 0x2F0154, "CMSG_MOUNT_SPECIAL_ANIM", "ClientToServer" },
+        { 0x32006D, "CMSG_MOVE_ADD_IMPULSE_ACK", "ClientToServer" },
+        { 0x32006B, "CMSG_MOVE_APPLY_INERTIA_ACK", "ClientToServer" },
+        { 0x320031, "CMSG_MOVE_APPLY_MOVEMENT_FORCE_ACK", "ClientToServer" },
+        { 0x32004C, "CMSG_MOVE_CHANGE_TRANSPORT", "ClientToServer" },
+        { 0x320051, "CMSG_MOVE_CHANGE_VEHICLE_SEATS", "ClientToServer" },
+        { 0x320056, "CMSG_MOVE_COLLISION_DISABLE_ACK", "ClientToServer" },
+        { 0x320057, "CMSG_MOVE_COLLISION_ENABLE_ACK", "ClientToServer" },
+        { 0x320050, "CMSG_MOVE_DISMISS_VEHICLE", "ClientToServer" },
+        { 0x320007, "CMSG_MOVE_DOUBLE_JUMP", "ClientToServer" },
+        { 0x32003A, "CMSG_MOVE_ENABLE_DOUBLE_JUMP_ACK", "ClientToServer" },
+        { 0x320083, "CMSG_MOVE_ENABLE_FULL_SPEED_TURNING_ACK", "ClientToServer" },
+        { 0x320040, "CMSG_MOVE_ENABLE_SWIM_TO_FLY_TRANS_ACK", "ClientToServer" },
+        { 0x320017, "CMSG_MOVE_FALL_LAND", "ClientToServer" },
+        { 0x320035, "CMSG_MOVE_FALL_RESET", "ClientToServer" },
+        { 0x320038, "CMSG_MOVE_FEATHER_FALL_ACK", "ClientToServer" },
+        { 0x32004B, "CMSG_MOVE_FORCE_FLIGHT_BACK_SPEED_CHANGE_ACK", "ClientToServer" },
+        { 0x32004A, "CMSG_MOVE_FORCE_FLIGHT_SPEED_CHANGE_ACK", "ClientToServer" },
+        { 0x32004F, "CMSG_MOVE_FORCE_PITCH_RATE_CHANGE_ACK", "ClientToServer" },
+        { 0x32002A, "CMSG_MOVE_FORCE_ROOT_ACK", "ClientToServer" },
+        { 0x320028, "CMSG_MOVE_FORCE_RUN_BACK_SPEED_CHANGE_ACK", "ClientToServer" },
+        { 0x320027, "CMSG_MOVE_FORCE_RUN_SPEED_CHANGE_ACK", "ClientToServer" },
+        { 0x32003E, "CMSG_MOVE_FORCE_SWIM_BACK_SPEED_CHANGE_ACK", "ClientToServer" },
+        { 0x320029, "CMSG_MOVE_FORCE_SWIM_SPEED_CHANGE_ACK", "ClientToServer" },
+        { 0x32003F, "CMSG_MOVE_FORCE_TURN_RATE_CHANGE_ACK", "ClientToServer" },
+        { 0x32002B, "CMSG_MOVE_FORCE_UNROOT_ACK", "ClientToServer" },
+        { 0x32003D, "CMSG_MOVE_FORCE_WALK_SPEED_CHANGE_ACK", "ClientToServer" },
+        { 0x320052, "CMSG_MOVE_GRAVITY_DISABLE_ACK", "ClientToServer" },
+        { 0x320053, "CMSG_MOVE_GRAVITY_ENABLE_ACK", "ClientToServer" },
+        { 0x30004C, "CMSG_MOVE_GUILD_BANK_ITEM", "ClientToServer" },
+        { 0x32002C, "CMSG_MOVE_HEARTBEAT", "ClientToServer" },
+        { 0x32002F, "CMSG_MOVE_HOVER_ACK", "ClientToServer" },
+        { 0x320054, "CMSG_MOVE_INERTIA_DISABLE_ACK", "ClientToServer" },
+        { 0x320055, "CMSG_MOVE_INERTIA_ENABLE_ACK", "ClientToServer" },
+        { 0x320063, "CMSG_MOVE_INIT_ACTIVE_MOVER_COMPLETE", "ClientToServer" },
+        { 0x320006, "CMSG_MOVE_JUMP", "ClientToServer" },
+        { 0x32002E, "CMSG_MOVE_KNOCK_BACK_ACK", "ClientToServer" },
+        { 0x32006C, "CMSG_MOVE_REMOVE_INERTIA_ACK", "ClientToServer" },
+        { 0x320032, "CMSG_MOVE_REMOVE_MOVEMENT_FORCE_ACK", "ClientToServer" },
+        { 0x320033, "CMSG_MOVE_REMOVE_MOVEMENT_FORCES", "ClientToServer" },
+        { 0x32006F, "CMSG_MOVE_SET_ADV_FLY", "ClientToServer" },
+        { 0x320077, "CMSG_MOVE_SET_ADV_FLYING_ADD_IMPULSE_MAX_SPEED_ACK", "ClientToServer" },
+        { 0x320072, "CMSG_MOVE_SET_ADV_FLYING_AIR_FRICTION_ACK", "ClientToServer" },
+        { 0x320078, "CMSG_MOVE_SET_ADV_FLYING_BANKING_RATE_ACK", "ClientToServer" },
+        { 0x320075, "CMSG_MOVE_SET_ADV_FLYING_DOUBLE_JUMP_VEL_MOD_ACK", "ClientToServer" },
+        { 0x320076, "CMSG_MOVE_SET_ADV_FLYING_GLIDE_START_MIN_HEIGHT_ACK", "ClientToServer" },
+        { 0x32007F, "CMSG_MOVE_SET_ADV_FLYING_LAUNCH_SPEED_COEFFICIENT_ACK", "ClientToServer" },
+        { 0x320074, "CMSG_MOVE_SET_ADV_FLYING_LIFT_COEFFICIENT_ACK", "ClientToServer" },
+        { 0x320073, "CMSG_MOVE_SET_ADV_FLYING_MAX_VEL_ACK", "ClientToServer" },
+        { 0x32007D, "CMSG_MOVE_SET_ADV_FLYING_OVER_MAX_DECELERATION_ACK", "ClientToServer" },
+        { 0x320079, "CMSG_MOVE_SET_ADV_FLYING_PITCHING_RATE_DOWN_ACK", "ClientToServer" },
+        { 0x32007A, "CMSG_MOVE_SET_ADV_FLYING_PITCHING_RATE_UP_ACK", "ClientToServer" },
+        { 0x32007C, "CMSG_MOVE_SET_ADV_FLYING_SURFACE_FRICTION_ACK", "ClientToServer" },
+        { 0x32007B, "CMSG_MOVE_SET_ADV_FLYING_TURN_VELOCITY_THRESHOLD_ACK", "ClientToServer" },
+        { 0x32006E, "CMSG_MOVE_SET_CAN_ADV_FLY_ACK", "ClientToServer" },
+        { 0x320070, "CMSG_MOVE_SET_CAN_DRIVE_ACK", "ClientToServer" },
+        { 0x320043, "CMSG_MOVE_SET_CAN_FLY_ACK", "ClientToServer" },
+        { 0x320041, "CMSG_MOVE_SET_CAN_TURN_WHILE_FALLING_ACK", "ClientToServer" },
+        { 0x320058, "CMSG_MOVE_SET_COLLISION_HEIGHT_ACK", "ClientToServer" },
+        { 0x320025, "CMSG_MOVE_SET_FACING", "ClientToServer" },
+        { 0x32007E, "CMSG_MOVE_SET_FACING_HEARTBEAT", "ClientToServer" },
+        { 0x320045, "CMSG_MOVE_SET_FLY", "ClientToServer" },
+        { 0x320042, "CMSG_MOVE_SET_IGNORE_MOVEMENT_FORCES_ACK", "ClientToServer" },
+        { 0x32005F, "CMSG_MOVE_SET_MOD_MOVEMENT_FORCE_MAGNITUDE_ACK", "ClientToServer" },
+        { 0x320026, "CMSG_MOVE_SET_PITCH", "ClientToServer" },
+        { 0x32000E, "CMSG_MOVE_SET_RUN_MODE", "ClientToServer" },
+        { 0x320022, "CMSG_MOVE_SET_TURN_RATE_CHEAT", "ClientToServer" },
+        { 0x320030, "CMSG_MOVE_SET_VEHICLE_REC_ID_ACK", "ClientToServer" },
+        { 0x32000F, "CMSG_MOVE_SET_WALK_MODE", "ClientToServer" },
+        { 0x320034, "CMSG_MOVE_SPLINE_DONE", "ClientToServer" },
+        { 0x320046, "CMSG_MOVE_START_ASCEND", "ClientToServer" },
+        { 0x320001, "CMSG_MOVE_START_BACKWARD", "ClientToServer" },
+        { 0x32004D, "CMSG_MOVE_START_DESCEND", "ClientToServer" },
+        { 0x320071, "CMSG_MOVE_START_DRIVE_FORWARD", "ClientToServer" },
+        { 0x320000, "CMSG_MOVE_START_FORWARD", "ClientToServer" },
+        { 0x32000C, "CMSG_MOVE_START_PITCH_DOWN", "ClientToServer" },
+        { 0x32000B, "CMSG_MOVE_START_PITCH_UP", "ClientToServer" },
+        { 0x320003, "CMSG_MOVE_START_STRAFE_LEFT", "ClientToServer" },
+        { 0x320004, "CMSG_MOVE_START_STRAFE_RIGHT", "ClientToServer" },
+        { 0x320018, "CMSG_MOVE_START_SWIM", "ClientToServer" },
+        { 0x320008, "CMSG_MOVE_START_TURN_LEFT", "ClientToServer" },
+        { 0x320009, "CMSG_MOVE_START_TURN_RIGHT", "ClientToServer" },
+        { 0x320002, "CMSG_MOVE_STOP", "ClientToServer" },
+        { 0x320047, "CMSG_MOVE_STOP_ASCEND", "ClientToServer" },
+        { 0x32000D, "CMSG_MOVE_STOP_PITCH", "ClientToServer" },
+        { 0x320005, "CMSG_MOVE_STOP_STRAFE", "ClientToServer" },
+        { 0x320019, "CMSG_MOVE_STOP_SWIM", "ClientToServer" },
+        { 0x32000A, "CMSG_MOVE_STOP_TURN", "ClientToServer" },
+        { 0x320016, "CMSG_MOVE_TELEPORT_ACK", "ClientToServer" },
+        { 0x320037, "CMSG_MOVE_TIME_SKIPPED", "ClientToServer" },
+        { 0x320036, "CMSG_MOVE_UPDATE_FALL_SPEED", "ClientToServer" },
+        { 0x320039, "CMSG_MOVE_WATER_WALK_ACK", "ClientToServer" },
+        { 0x2C0001, "CMSG_MYTHIC_PLUS_REQUEST_MAP_STATS", "ClientToServer" },
+        { 0x2F0083, "CMSG_NEUTRAL_PLAYER_SELECT_FACTION", "ClientToServer" },
+        { 0x3000E2, "CMSG_NEXT_CINEMATIC_CAMERA", "ClientToServer" },
+        { 0x2F002C, "CMSG_OBJECT_UPDATE_FAILED", "ClientToServer" },
+        { 0x2F002D, "CMSG_OBJECT_UPDATE_RESCUED", "ClientToServer" },
+        { 0x2F0286, "CMSG_OFFER_PETITION", "ClientToServer" },
+        { 0x3000E1, "CMSG_OPENING_CINEMATIC", "ClientToServer" },
+        { 0x2F020F, "CMSG_OPEN_ITEM", "ClientToServer" },
+        { 0x2F01D0, "CMSG_OPEN_MISSION_NPC", "ClientToServer" },
+        { 0x2F01D8, "CMSG_OPEN_SHIPMENT_NPC", "ClientToServer" },
+        { 0x2F01E3, "CMSG_OPEN_TRADESKILL_NPC", "ClientToServer" },
+        { 0x30008E, "CMSG_OPT_OUT_OF_LOOT", "ClientToServer" },
+        { 0x3000B8, "CMSG_OVERRIDE_SCREEN_FLASH", "ClientToServer" },
+        { 0x340030, "CMSG_PARTY_INVITE", "ClientToServer" },
+        { 0x340032, "CMSG_PARTY_INVITE_RESPONSE", "ClientToServer" },
+        { 0x340073, "CMSG_PARTY_UNINVITE", "ClientToServer" },
+        { 0x2F00EC, "CMSG_PERFORM_ITEM_INTERACTION", "ClientToServer" },
+        { 0x2F02AE, "CMSG_PERKS_PROGRAM_ITEMS_REFRESHED", "ClientToServer" },
+        { 0x2F02B1, "CMSG_PERKS_PROGRAM_REQUEST_CART_CHECKOUT", "ClientToServer" },
+        { 0x290012, "CMSG_PERKS_PROGRAM_REQUEST_PENDING_REWARDS", "ClientToServer" },
+        { 0x2F02B0, "CMSG_PERKS_PROGRAM_REQUEST_PURCHASE", "ClientToServer" },
+        { 0x2F02B2, "CMSG_PERKS_PROGRAM_REQUEST_REFUND", "ClientToServer" },
+        { 0x2F02B3, "CMSG_PERKS_PROGRAM_SET_FROZEN_VENDOR_ITEM", "ClientToServer" },
+        { 0x2F02AF, "CMSG_PERKS_PROGRAM_STATUS_REQUEST", "ClientToServer" },
+        { 0x30001E, "CMSG_PET_ABANDON", "ClientToServer" },
+        { 0x30001F, "CMSG_PET_ABANDON_BY_NUMBER", "ClientToServer" },
+        { 0x30001C, "CMSG_PET_ACTION", "ClientToServer" },
+        { 0x2F0092, "CMSG_PET_BATTLE_FINAL_NOTIFY", "ClientToServer" },
+        { 0x34006D, "CMSG_PET_BATTLE_INPUT", "ClientToServer" },
+        { 0x2F00E2, "CMSG_PET_BATTLE_QUEUE_PROPOSE_MATCH_RESULT", "ClientToServer" },
+        { 0x2F0091, "CMSG_PET_BATTLE_QUIT_NOTIFY", "ClientToServer" },
+        { 0x34006E, "CMSG_PET_BATTLE_REPLACE_FRONT_PET", "ClientToServer" },
+        { 0x2F008B, "CMSG_PET_BATTLE_REQUEST_PVP", "ClientToServer" },
+        { 0x2F008C, "CMSG_PET_BATTLE_REQUEST_UPDATE", "ClientToServer" },
+        { 0x2F0089, "CMSG_PET_BATTLE_REQUEST_WILD", "ClientToServer" },
+        { 0x2F0093, "CMSG_PET_BATTLE_SCRIPT_ERROR_NOTIFY", "ClientToServer" },
+        { 0x300020, "CMSG_PET_CANCEL_AURA", "ClientToServer" },
+        { 0x2F0173, "CMSG_PET_CAST_SPELL", "ClientToServer" },
+        { 0x30005A, "CMSG_PETITION_BUY", "ClientToServer" },
+        { 0x3400F7, "CMSG_PETITION_RENAME_GUILD", "ClientToServer" },
+        { 0x300059, "CMSG_PETITION_SHOW_LIST", "ClientToServer" },
+        { 0x30005B, "CMSG_PETITION_SHOW_SIGNATURES", "ClientToServer" },
+        { 0x3400B0, "CMSG_PET_RENAME", "ClientToServer" },
+        { 0x30001B, "CMSG_PET_SET_ACTION", "ClientToServer" },
+        { 0x300021, "CMSG_PET_SPELL_AUTOCAST", "ClientToServer" },
+        { 0x30001D, "CMSG_PET_STOP_ATTACK", "ClientToServer" },
+        { 0x350004, "CMSG_PING", "ClientToServer" },
+        { 0x340016, "CMSG_PLAYER_LOGIN", "ClientToServer" },
+        { 0x300031, "CMSG_PUSH_QUEST_TO_PARTY", "ClientToServer" },
+        { 0x2F0028, "CMSG_PVP_LOG_DATA", "ClientToServer" },
+        { 0x2F0147, "CMSG_QUERY_BATTLE_PET_NAME", "ClientToServer" },
+        { 0x34008C, "CMSG_QUERY_CORPSE_LOCATION_FROM_CLIENT", "ClientToServer" },
+        { 0x34008D, "CMSG_QUERY_CORPSE_TRANSPORT", "ClientToServer" },
+        { 0x2F0055, "CMSG_QUERY_COUNTDOWN_TIMER", "ClientToServer" },
+        { 0x2F0141, "CMSG_QUERY_CREATURE", "ClientToServer" },
+        { 0x2F0142, "CMSG_QUERY_GAME_OBJECT", "ClientToServer" },
+        { 0x2F0148, "CMSG_QUERY_GARRISON_PET_NAME", "ClientToServer" },
+        { 0x3400B6, "CMSG_QUERY_GUILD_INFO", "ClientToServer" },
+        { 0x300098, "CMSG_QUERY_INSPECT_ACHIEVEMENTS", "ClientToServer" },
+        { 0x3000D7, "CMSG_QUERY_NEXT_MAIL_TIME", "ClientToServer" },
+        { 0x2F0143, "CMSG_QUERY_NPC_TEXT", "ClientToServer" },
+        { 0x2F0145, "CMSG_QUERY_PAGE_TEXT", "ClientToServer" },
+        { 0x2F0149, "CMSG_QUERY_PETITION", "ClientToServer" },
+        { 0x2F0146, "CMSG_QUERY_PET_NAME", "ClientToServer" },
+        { 0x35000B, "CMSG_QUERY_PLAYER_NAME_BY_COMMUNITY_ID", "ClientToServer" },
+        { 0x35000E, "CMSG_QUERY_PLAYER_NAMES", "ClientToServer" },
+        { 0x35000C, "CMSG_QUERY_PLAYER_NAMES_FOR_COMMUNITY", "ClientToServer" },
+        { 0x2F0021, "CMSG_QUERY_QUEST_COMPLETION_NPCS", "ClientToServer" },
+        { 0x2F0144, "CMSG_QUERY_QUEST_INFO", "ClientToServer" },
+        { 0x2F0022, "CMSG_QUERY_QUEST_ITEM_USABILITY", "ClientToServer" },
+        { 0x3400B5, "CMSG_QUERY_REALM_NAME", "ClientToServer" },
+        { 0x340082, "CMSG_QUERY_SCENARIO_POI", "ClientToServer" },
+        { 0x2F02EA, "CMSG_QUERY_SELECTED_WOW_LABS_AREA", "ClientToServer" },
+        { 0x30006E, "CMSG_QUERY_TIME", "ClientToServer" },
+        { 0x2F0232, "CMSG_QUERY_TREASURE_PICKER", "ClientToServer" },
+        { 0x2F02EB, "CMSG_QUERY_WOW_LABS_AREA_INFO", "ClientToServer" },
+        { 0x300030, "CMSG_QUEST_CONFIRM_ACCEPT", "ClientToServer" },
+        { 0x30002A, "CMSG_QUEST_GIVER_ACCEPT_QUEST", "ClientToServer" },
+        { 0x30002C, "CMSG_QUEST_GIVER_CHOOSE_REWARD", "ClientToServer" },
+        { 0x3000E8, "CMSG_QUEST_GIVER_CLOSE_QUEST", "ClientToServer" },
+        { 0x30002B, "CMSG_QUEST_GIVER_COMPLETE_QUEST", "ClientToServer" },
+        { 0x300028, "CMSG_QUEST_GIVER_HELLO", "ClientToServer" },
+        { 0x300029, "CMSG_QUEST_GIVER_QUERY_QUEST", "ClientToServer" },
+        { 0x30002D, "CMSG_QUEST_GIVER_REQUEST_REWARD", "ClientToServer" },
+        { 0x30002F, "CMSG_QUEST_GIVER_STATUS_MULTIPLE_QUERY", "ClientToServer" },
+        { 0x30002E, "CMSG_QUEST_GIVER_STATUS_QUERY", "ClientToServer" },
+        { 0x3000CC, "CMSG_QUEST_LOG_REMOVE_QUEST", "ClientToServer" },
+        { 0x3400DD, "CMSG_QUEST_POI_QUERY", "ClientToServer" },
+        { 0x300032, "CMSG_QUEST_PUSH_RESULT", "ClientToServer" },
+        { 0x2F0278, "CMSG_QUEST_SESSION_BEGIN_RESPONSE", "ClientToServer" },
+        { 0x2F0277, "CMSG_QUEST_SESSION_REQUEST_START", "ClientToServer" },
+        { 0x340158, "CMSG_QUEST_SESSION_REQUEST_STOP", "ClientToServer" },
+        { 0x350008, "CMSG_QUEUED_MESSAGES_END", "ClientToServer" },
+        { 0x340130, "CMSG_QUICK_JOIN_AUTO_ACCEPT_REQUESTS", "ClientToServer" },
+        { 0x34012F, "CMSG_QUICK_JOIN_REQUEST_INVITE", "ClientToServer" },
+        { 0x34015D, "CMSG_QUICK_JOIN_REQUEST_INVITE_WITH_CONFIRMATION", "ClientToServer" },
+        { 0x34012E, "CMSG_QUICK_JOIN_RESPOND_TO_INVITE", "ClientToServer" },
+        { 0x34012D, "CMSG_QUICK_JOIN_SIGNAL_TOAST_DISPLAYED", "ClientToServer" },
+        { 0x30009C, "CMSG_RAF_CLAIM_ACTIVITY_REWARD", "ClientToServer" },
+        { 0x34014E, "CMSG_RAF_CLAIM_NEXT_REWARD", "ClientToServer" },
+        { 0x340150, "CMSG_RAF_GENERATE_RECRUITMENT_LINK", "ClientToServer" },
+        { 0x34014F, "CMSG_RAF_UPDATE_RECRUITMENT_INFO", "ClientToServer" },
+        { 0x340080, "CMSG_RANDOM_ROLL", "ClientToServer" },
+        { 0x2F0210, "CMSG_READ_ITEM", "ClientToServer" },
+        { 0x34005F, "CMSG_READY_CHECK_RESPONSE", "ClientToServer" },
+        { 0x300073, "CMSG_RECLAIM_CORPSE", "ClientToServer" },
+        { 0x2F0236, "CMSG_REMOVE_NEW_ITEM", "ClientToServer" },
+        { 0x340151, "CMSG_REMOVE_RAF_RECRUIT", "ClientToServer" },
+        { 0x340015, "CMSG_REORDER_CHARACTERS", "ClientToServer" },
+        { 0x300084, "CMSG_REPAIR_ITEM", "ClientToServer" },
+        { 0x2F01F1, "CMSG_REPLACE_TROPHY", "ClientToServer" },
+        { 0x3000C4, "CMSG_REPOP_REQUEST", "ClientToServer" },
+        { 0x30008C, "CMSG_REPORT_PVP_PLAYER_AFK", "ClientToServer" },
+        { 0x2F0270, "CMSG_REPORT_SERVER_LAG", "ClientToServer" },
+        { 0x2F0271, "CMSG_REPORT_STUCK_IN_COMBAT", "ClientToServer" },
+        { 0x3400C2, "CMSG_REQUEST_ACCOUNT_DATA", "ClientToServer" },
+        { 0x2F0234, "CMSG_REQUEST_AREA_POI_UPDATE", "ClientToServer" },
+        { 0x340008, "CMSG_REQUEST_BATTLEFIELD_STATUS", "ClientToServer" },
+        { 0x2F0023, "CMSG_REQUEST_CEMETERY_LIST", "ClientToServer" },
+        { 0x3400B7, "CMSG_REQUEST_CHARACTER_GUILD_FOLLOW_INFO", "ClientToServer" },
+        { 0x2F0262, "CMSG_REQUEST_COVENANT_CALLINGS", "ClientToServer" },
+        { 0x3000C8, "CMSG_REQUEST_CROWD_CONTROL_SPELL", "ClientToServer" },
+        { 0x290019, "CMSG_REQUEST_CURRENCY_DATA_FOR_ACCOUNT_CHARACTERS", "ClientToServer" },
+        { 0x2F029B, "CMSG_REQUEST_GARRISON_TALENT_WORLD_QUEST_UNLOCKS", "ClientToServer" },
+        { 0x2F0054, "CMSG_REQUEST_GUILD_PARTY_STATE", "ClientToServer" },
+        { 0x2F0053, "CMSG_REQUEST_GUILD_REWARDS_LIST", "ClientToServer" },
+        { 0x2F0272, "CMSG_REQUEST_LATEST_SPLASH_SCREEN", "ClientToServer" },
+        { 0x2F017F, "CMSG_REQUEST_LFG_LIST_BLACKLIST", "ClientToServer" },
+        { 0x2F00B7, "CMSG_REQUEST_MYTHIC_PLUS_AFFIXES", "ClientToServer" },
+        { 0x2F00B8, "CMSG_REQUEST_MYTHIC_PLUS_SEASON_DATA", "ClientToServer" },
+        { 0x2F02E9, "CMSG_REQUEST_PARTY_ELIGIBILITY_FOR_DELVE_TIERS", "ClientToServer" },
+        { 0x340023, "CMSG_REQUEST_PARTY_JOIN_UPDATES", "ClientToServer" },
+        { 0x34007F, "CMSG_REQUEST_PARTY_MEMBER_STATS", "ClientToServer" },
+        { 0x300022, "CMSG_REQUEST_PET_INFO", "ClientToServer" },
+        { 0x2F014C, "CMSG_REQUEST_PLAYED_TIME", "ClientToServer" },
+        { 0x2F0041, "CMSG_REQUEST_PVP_REWARDS", "ClientToServer" },
+        { 0x3400F8, "CMSG_REQUEST_RAID_INFO", "ClientToServer" },
+        { 0x34000F, "CMSG_REQUEST_RATED_PVP_INFO", "ClientToServer" },
+        { 0x340193, "CMSG_REQUEST_REALM_GUILD_MASTER_INFO", "ClientToServer" },
+        { 0x2F0235, "CMSG_REQUEST_SCHEDULED_AREA_POI_UPDATE", "ClientToServer" },
+        { 0x2F0042, "CMSG_REQUEST_SCHEDULED_PVP_INFO", "ClientToServer" },
+        { 0x300023, "CMSG_REQUEST_STABLED_PETS", "ClientToServer" },
+        { 0x29001E, "CMSG_REQUEST_STORE_FRONT_INFO_UPDATE", "ClientToServer" },
+        { 0x2F00FE, "CMSG_REQUEST_VEHICLE_EXIT", "ClientToServer" },
+        { 0x2F0100, "CMSG_REQUEST_VEHICLE_NEXT_SEAT", "ClientToServer" },
+        { 0x2F00FF, "CMSG_REQUEST_VEHICLE_PREV_SEAT", "ClientToServer" },
+        { 0x2F0101, "CMSG_REQUEST_VEHICLE_SWITCH_SEAT", "ClientToServer" },
+        { 0x2F0265, "CMSG_REQUEST_WEEKLY_REWARDS", "ClientToServer" },
+        { 0x2F0233, "CMSG_REQUEST_WORLD_QUEST_UPDATE", "ClientToServer" },
+        { 0x2F00B5, "CMSG_RESET_CHALLENGE_MODE", "ClientToServer" },
+        { 0x2F00B6, "CMSG_RESET_CHALLENGE_MODE_CHEAT", "ClientToServer" },
+        { 0x340094, "CMSG_RESET_INSTANCES", "ClientToServer" },
+        { 0x3400AF, "CMSG_RESURRECT_RESPONSE", "ClientToServer" },
+        { 0x2F01F3, "CMSG_REVERT_MONUMENT_APPEARANCE", "ClientToServer" },
+        { 0x2F0102, "CMSG_RIDE_VEHICLE_INTERACT", "ClientToServer" },
+        { 0x34017E, "CMSG_RPE_RESET_CHARACTER", "ClientToServer" },
+        { 0x340178, "CMSG_SAVE_ACCOUNT_DATA_EXPORT", "ClientToServer" },
+        { 0x2F0037, "CMSG_SAVE_CUF_PROFILES", "ClientToServer" },
+        { 0x3000A2, "CMSG_SAVE_EQUIPMENT_SET", "ClientToServer" },
+        { 0x2F0184, "CMSG_SAVE_GUILD_EMBLEM", "ClientToServer" },
+        { 0x2F0185, "CMSG_SAVE_PERSONAL_EMBLEM", "ClientToServer" },
+        { 0x2F00DE, "CMSG_SCENE_PLAYBACK_CANCELED", "ClientToServer" },
+        { 0x2F00DD, "CMSG_SCENE_PLAYBACK_COMPLETE", "ClientToServer" },
+        { 0x2F00DF, "CMSG_SCENE_TRIGGER_EVENT", "ClientToServer" },
+        { 0x2F02D8, "CMSG_SEAMLESS_TRANSFER_COMPLETE", "ClientToServer" },
+        { 0x2F02EC, "CMSG_SELECT_WOW_LABS_AREA", "ClientToServer" },
+        { 0x3000CF, "CMSG_SELF_RES", "ClientToServer" },
+        { 0x300035, "CMSG_SELL_ALL_JUNK_ITEMS", "ClientToServer" },
+        { 0x300034, "CMSG_SELL_ITEM", "ClientToServer" },
+        { 0x340126, "CMSG_SEND_CHARACTER_CLUB_INVITATION", "ClientToServer" },
+        { 0x3400FD, "CMSG_SEND_CONTACT_LIST", "ClientToServer" },
+        { 0x340026, "CMSG_SEND_MAIL", "ClientToServer" },
+        { 0x2F02DA, "CMSG_SEND_PING_UNIT", "ClientToServer" },
+        { 0x2F02DB, "CMSG_SEND_PING_WORLD_POINT", "ClientToServer" },
+        { 0x300019, "CMSG_SEND_TEXT_EMOTE", "ClientToServer" },
+        { 0x3400C9, "CMSG_SERVER_TIME_OFFSET_REQUEST", "ClientToServer" },
+        { 0x3000D0, "CMSG_SET_ACTION_BAR_TOGGLES", "ClientToServer" },
+        { 0x340062, "CMSG_SET_ACTION_BUTTON", "ClientToServer" },
+        { 0x320059, "CMSG_SET_ACTIVE_MOVER", "ClientToServer" },
+        { 0x2F0192, "CMSG_SET_ADVANCED_COMBAT_LOGGING", "ClientToServer" },
+        { 0x34007B, "CMSG_SET_ASSISTANT_LEADER", "ClientToServer" },
+        { 0x2F0213, "CMSG_SET_BACKPACK_AUTOSORT_DISABLED", "ClientToServer" },
+        { 0x2F0214, "CMSG_SET_BACKPACK_SELL_JUNK_DISABLED", "ClientToServer" },
+        { 0x2F0215, "CMSG_SET_BANK_AUTOSORT_DISABLED", "ClientToServer" },
+        { 0x340100, "CMSG_SET_CONTACT_NOTES", "ClientToServer" },
+        { 0x2F0015, "CMSG_SET_CURRENCY_FLAGS", "ClientToServer" },
+        { 0x2F00E0, "CMSG_SET_DIFFICULTY_ID", "ClientToServer" },
+        { 0x3400AE, "CMSG_SET_DUNGEON_DIFFICULTY", "ClientToServer" },
+        { 0x2F013B, "CMSG_SET_EMPOWER_MIN_HOLD_STAGE_PERCENT", "ClientToServer" },
+        { 0x340046, "CMSG_SET_EVERYONE_IS_ASSISTANT", "ClientToServer" },
+        { 0x340131, "CMSG_SET_EXCLUDED_CHAT_CENSOR_SOURCES", "ClientToServer" },
+        { 0x300076, "CMSG_SET_FACTION_AT_WAR", "ClientToServer" },
+        { 0x300078, "CMSG_SET_FACTION_INACTIVE", "ClientToServer" },
+        { 0x300077, "CMSG_SET_FACTION_NOT_AT_WAR", "ClientToServer" },
+        { 0x2F0065, "CMSG_SET_GAME_EVENT_DEBUG_VIEW_STATE", "ClientToServer" },
+        { 0x2F0217, "CMSG_SET_INSERT_ITEMS_LEFT_TO_RIGHT", "ClientToServer" },
+        { 0x340074, "CMSG_SET_LOOT_METHOD", "ClientToServer" },
+        { 0x3000DD, "CMSG_SET_LOOT_SPECIALIZATION", "ClientToServer" },
+        { 0x34007D, "CMSG_SET_PARTY_ASSIGNMENT", "ClientToServer" },
+        { 0x340076, "CMSG_SET_PARTY_LEADER", "ClientToServer" },
+        { 0x2F0012, "CMSG_SET_PET_FAVORITE", "ClientToServer" },
+        { 0x2F0011, "CMSG_SET_PET_SLOT", "ClientToServer" },
+        { 0x2F0013, "CMSG_SET_PET_SPECIALIZATION", "ClientToServer" },
+        { 0x3400B4, "CMSG_SET_PLAYER_DECLINED_NAMES", "ClientToServer" },
+        { 0x2F0024, "CMSG_SET_PREFERRED_CEMETERY", "ClientToServer" },
+        { 0x2F0189, "CMSG_SET_PVP", "ClientToServer" },
+        { 0x340109, "CMSG_SET_RAID_DIFFICULTY", "ClientToServer" },
+        { 0x340047, "CMSG_SET_RESTRICT_PINGS_TO_ASSISTANTS", "ClientToServer" },
+        { 0x340005, "CMSG_SET_ROLE", "ClientToServer" },
+        { 0x3400B2, "CMSG_SET_SAVED_INSTANCE_EXTEND", "ClientToServer" },
+        { 0x3000C6, "CMSG_SET_SELECTION", "ClientToServer" },
+        { 0x30001A, "CMSG_SET_SHEATHED", "ClientToServer" },
+        { 0x2F0216, "CMSG_SET_SORT_BAGS_RIGHT_TO_LEFT", "ClientToServer" },
+        { 0x30008B, "CMSG_SET_TAXI_BENCHMARK_MODE", "ClientToServer" },
+        { 0x2F0152, "CMSG_SET_TITLE", "ClientToServer" },
+        { 0x2F000A, "CMSG_SET_TRADE_CURRENCY", "ClientToServer" },
+        { 0x2F0009, "CMSG_SET_TRADE_GOLD", "ClientToServer" },
+        { 0x2F0007, "CMSG_SET_TRADE_ITEM", "ClientToServer" },
+        { 0x34018C, "CMSG_SETUP_WARBAND_GROUPS", "ClientToServer" },
+        { 0x2F01D2, "CMSG_SET_USING_PARTY_GARRISON", "ClientToServer" },
+        { 0x2F018A, "CMSG_SET_WAR_MODE", "ClientToServer" },
+        { 0x300079, "CMSG_SET_WATCHED_FACTION", "ClientToServer" },
+        { 0x3400F0, "CMSG_SHOW_TRADE_SKILL", "ClientToServer" },
+        { 0x3000D1, "CMSG_SIGN_PETITION", "ClientToServer" },
+        { 0x34007E, "CMSG_SILENCE_PARTY_TALKER", "ClientToServer" },
+        { 0x340173, "CMSG_SOCIAL_CONTRACT_REQUEST", "ClientToServer" },
+        { 0x300083, "CMSG_SOCKET_GEMS", "ClientToServer" },
+        { 0x2F02DE, "CMSG_SORT_ACCOUNT_BANK_BAGS", "ClientToServer" },
+        { 0x2F0218, "CMSG_SORT_BAGS", "ClientToServer" },
+        { 0x2F0219, "CMSG_SORT_BANK_BAGS", "ClientToServer" },
+        { 0x2F0167, "CMSG_SPAWN_TRACKING_UPDATE", "ClientToServer" },
+        { 0x2F02D1, "CMSG_SPECTATE_CHANGE", "ClientToServer" },
+        { 0x300027, "CMSG_SPELL_CLICK", "ClientToServer" },
+        { 0x2F0139, "CMSG_SPELL_EMPOWER_RELEASE", "ClientToServer" },
+        { 0x2F013A, "CMSG_SPELL_EMPOWER_RESTART", "ClientToServer" },
+        { 0x300042, "CMSG_SPIRIT_HEALER_ACTIVATE", "ClientToServer" },
+        { 0x300053, "CMSG_SPLIT_GUILD_BANK_ITEM", "ClientToServer" },
+        { 0x300050, "CMSG_SPLIT_GUILD_BANK_ITEM_TO_INVENTORY", "ClientToServer" },
+        { 0x310008, "CMSG_SPLIT_ITEM", "ClientToServer" },
+        { 0x30004E, "CMSG_SPLIT_ITEM_TO_GUILD_BANK", "ClientToServer" },
+        { 0x2F0035, "CMSG_STAND_STATE_CHANGE", "ClientToServer" },
+        { 0x3000E9, "CMSG_START_CHALLENGE_MODE", "ClientToServer" },
+        { 0x340060, "CMSG_START_INSTANCE_ABANDON_VOTE", "ClientToServer" },
+        { 0x34000B, "CMSG_START_SPECTATOR_WAR_GAME", "ClientToServer" },
+        { 0x34000A, "CMSG_START_WAR_GAME", "ClientToServer" },
+        { 0x300049, "CMSG_STORE_GUILD_BANK_ITEM", "ClientToServer" },
+        { 0x3400C1, "CMSG_SUBMIT_USER_FEEDBACK", "ClientToServer" },
+        { 0x2F0290, "CMSG_SUBSCRIPTION_INTERSTITIAL_RESPONSE", "ClientToServer" },
+        { 0x340096, "CMSG_SUMMON_RESPONSE", "ClientToServer" },
+        { 0x340072, "CMSG_SUPPORT_TICKET_SUBMIT_COMPLAINT", "ClientToServer" },
+        { 0x2F0020, "CMSG_SURRENDER_ARENA", "ClientToServer" },
+        { 0x350000, "CMSG_SUSPEND_COMMS_ACK", "ClientToServer" },
+        { 0x350006, "CMSG_SUSPEND_TOKEN_RESPONSE", "ClientToServer" },
+        { 0x30004B, "CMSG_SWAP_GUILD_BANK_ITEM_WITH_GUILD_BANK_ITEM", "ClientToServer" },
+        { 0x310007, "CMSG_SWAP_INV_ITEM", "ClientToServer" },
+        { 0x310006, "CMSG_SWAP_ITEM", "ClientToServer" },
+        { 0x30004A, "CMSG_SWAP_ITEM_WITH_GUILD_BANK_ITEM", "ClientToServer" },
+        { 0x340079, "CMSG_SWAP_SUB_GROUPS", "ClientToServer" },
+        { 0x2F0186, "CMSG_TABARD_VENDOR_ACTIVATE", "ClientToServer" },
+        { 0x300024, "CMSG_TALK_TO_GOSSIP", "ClientToServer" },
+        { 0x30003B, "CMSG_TAXI_NODE_STATUS_QUERY", "ClientToServer" },
+        { 0x30003D, "CMSG_TAXI_QUERY_AVAILABLE_NODES", "ClientToServer" },
+        { 0x30003F, "CMSG_TAXI_REQUEST_EARLY_LANDING", "ClientToServer" },
+        { 0x32005D, "CMSG_TIME_ADJUSTMENT_RESPONSE", "ClientToServer" },
+        { 0x32005A, "CMSG_TIME_SYNC_RESPONSE", "ClientToServer" },
+        { 0x32005C, "CMSG_TIME_SYNC_RESPONSE_DROPPED", "ClientToServer" },
+        { 0x32005B, "CMSG_TIME_SYNC_RESPONSE_FAILED", "ClientToServer" },
+        { 0x340083, "CMSG_TOGGLE_DIFFICULTY", "ClientToServer" },
+        { 0x2F0188, "CMSG_TOGGLE_PVP", "ClientToServer" },
+        { 0x300090, "CMSG_TOTEM_DESTROYED", "ClientToServer" },
+        { 0x290004, "CMSG_TOY_CLEAR_FANFARE", "ClientToServer" },
+        { 0x2F0231, "CMSG_TRADE_SKILL_SET_FAVORITE", "ClientToServer" },
+        { 0x300041, "CMSG_TRAINER_BUY_SPELL", "ClientToServer" },
+        { 0x300040, "CMSG_TRAINER_LIST", "ClientToServer" },
+        { 0x2F02B9, "CMSG_TRAITS_COMMIT_CONFIG", "ClientToServer" },
+        { 0x2F02B7, "CMSG_TRAITS_TALENT_TEST_UNLEARN_SPELLS", "ClientToServer" },
+        { 0x2F02E7, "CMSG_TRANSFER_CURRENCY_FROM_ACCOUNT_CHARACTER", "ClientToServer" },
+        { 0x2F0043, "CMSG_TRANSMOGRIFY_ITEMS", "ClientToServer" },
+        { 0x3000D3, "CMSG_TURN_IN_PETITION", "ClientToServer" },
+        { 0x34010A, "CMSG_TUTORIAL", "ClientToServer" },
+        { 0x2F0261, "CMSG_UI_MAP_QUEST_LINES_REQUEST", "ClientToServer" },
+        { 0x2F0005, "CMSG_UNACCEPT_TRADE", "ClientToServer" },
+        { 0x34010C, "CMSG_UNDELETE_CHARACTER", "ClientToServer" },
+        { 0x30007D, "CMSG_UNLEARN_SKILL", "ClientToServer" },
+        { 0x2F0051, "CMSG_UNLEARN_SPECIALIZATION", "ClientToServer" },
+        { 0x340163, "CMSG_UPDATE_AADC_STATUS", "ClientToServer" },
+        { 0x30012A, "CMSG_UPDATE_ACCOUNT_BANK_TAB_SETTINGS", "ClientToServer" },
+        { 0x3400C3, "CMSG_UPDATE_ACCOUNT_DATA", "ClientToServer" },
+        { 0x2F0176, "CMSG_UPDATE_AREA_TRIGGER_VISUAL", "ClientToServer" },
+        { 0x340090, "CMSG_UPDATE_CLIENT_SETTINGS", "ClientToServer" },
+        { 0x2F01E4, "CMSG_UPDATE_CRAFTING_NPC_RECIPES", "ClientToServer" },
+        { 0x320060, "CMSG_UPDATE_MISSILE_TRAJECTORY", "ClientToServer" },
+        { 0x34007C, "CMSG_UPDATE_RAID_TARGET", "ClientToServer" },
+        { 0x2F0175, "CMSG_UPDATE_SPELL_VISUAL", "ClientToServer" },
+        { 0x340121, "CMSG_UPDATE_VAS_PURCHASE_STATES", "ClientToServer" },
+        { 0x2F019A, "CMSG_UPGRADE_GARRISON", "ClientToServer" },
+        { 0x2F028E, "CMSG_UPGRADE_RUNEFORGE_LEGENDARY", "ClientToServer" },
+        { 0x2F0108, "CMSG_USE_CRITTER_ITEM", "ClientToServer" },
+        { 0x2F0032, "CMSG_USED_FOLLOW", "ClientToServer" },
+        { 0x310001, "CMSG_USE_EQUIPMENT_SET", "ClientToServer" },
+        { 0x2F016F, "CMSG_USE_ITEM", "ClientToServer" },
+        { 0x2F0172, "CMSG_USE_TOY", "ClientToServer" },
+        { 0x340136, "CMSG_VAS_CHECK_TRANSFER_OK", "ClientToServer" },
+        { 0x340135, "CMSG_VAS_GET_QUEUE_MINUTES", "ClientToServer" },
+        { 0x340134, "CMSG_VAS_GET_SERVICE_STATUS", "ClientToServer" },
+        { 0x2F0030, "CMSG_VIOLENCE_LEVEL", "ClientToServer" },
+        { 0x34013A, "CMSG_VOICE_CHANNEL_STT_TOKEN_REQUEST", "ClientToServer" },
+        { 0x34013B, "CMSG_VOICE_CHAT_JOIN_CHANNEL", "ClientToServer" },
+        { 0x340139, "CMSG_VOICE_CHAT_LOGIN", "ClientToServer" },
+        { 0x340018, "CMSG_WARDEN3_DATA", "ClientToServer" },
+        { 0x3400AD, "CMSG_WHO", "ClientToServer" },
+        { 0x3400AC, "CMSG_WHO_IS", "ClientToServer" },
+        { 0x2F02D4, "CMSG_WORLD_LOOT_OBJECT_CLICK", "ClientToServer" },
+        { 0x340025, "CMSG_WORLD_PORT_RESPONSE", "ClientToServer" },
+        { 0x310000, "CMSG_WRAP_ITEM", "ClientToServer" },
+        { 0x360030, "SMSG_ABORT_NEW_WORLD", "ServerToClient" },
+        { 0x360346, "SMSG_ACCOUNT_CHARACTER_CURRENCY_LISTS", "ServerToClient" },
+        { 0x36034B, "SMSG_ACCOUNT_CONVERSION_STATE_UPDATE", "ServerToClient" },
+        { 0x3602FF, "SMSG_ACCOUNT_COSMETIC_ADDED", "ServerToClient" },
+        { 0x3602E7, "SMSG_ACCOUNT_CRITERIA_UPDATE", "ServerToClient" },
+        { 0x3601A8, "SMSG_ACCOUNT_DATA_TIMES", "ServerToClient" },
+        { 0x360337, "SMSG_ACCOUNT_EXPORT_RESPONSE", "ServerToClient" },
+        { 0x360351, "SMSG_ACCOUNT_ITEM_COLLECTION_DATA", "ServerToClient" },
+        { 0x360047, "SMSG_ACCOUNT_MOUNT_REMOVED", "ServerToClient" },
+        { 0x360046, "SMSG_ACCOUNT_MOUNT_UPDATE", "ServerToClient" },
+        { 0x3602FE, "SMSG_ACCOUNT_NOTIFICATIONS_RESPONSE", "ServerToClient" },
+        { 0x360320, "SMSG_ACCOUNT_STORE_CURRENCY_UPDATE", "ServerToClient" },
+        { 0x360321, "SMSG_ACCOUNT_STORE_FRONT_UPDATE", "ServerToClient" },
+        { 0x360322, "SMSG_ACCOUNT_STORE_ITEM_STATE_CHANGED", "ServerToClient" },
+        { 0x360323, "SMSG_ACCOUNT_STORE_RESULT", "ServerToClient" },
+        { 0x360048, "SMSG_ACCOUNT_TOY_UPDATE", "ServerToClient" },
+        { 0x36004C, "SMSG_ACCOUNT_TRANSMOG_SET_FAVORITES_UPDATE", "ServerToClient" },
+        { 0x36004B, "SMSG_ACCOUNT_TRANSMOG_UPDATE", "ServerToClient" },
+        { 0x36004E, "SMSG_ACCOUNT_WARBAND_SCENE_UPDATE", "ServerToClient" },
+        { 0x360185, "SMSG_ACHIEVEMENT_DELETED", "ServerToClient" },
+        { 0x3600E0, "SMSG_ACHIEVEMENT_EARNED", "ServerToClient" },
+        { 0x4A0020, "SMSG_ACTIVATE_ESSENCE_FAILED", "ServerToClient" },
+        { 0x4A0022, "SMSG_ACTIVATE_SOULBIND_FAILED", "ServerToClient" },
+        { 0x36011C, "SMSG_ACTIVATE_TAXI_REPLY", "ServerToClient" },
+        { 0x4D0045, "SMSG_ACTIVE_GLYPHS", "ServerToClient" },
+        { 0x3601E3, "SMSG_ACTIVE_SCHEDULED_WORLD_STATE_INFO", "ServerToClient" },
+        { 0x3600DA, "SMSG_ADD_BATTLENET_FRIEND_RESPONSE", "ServerToClient" },
+        { 0x360042, "SMSG_ADD_ITEM_PASSIVE", "ServerToClient" },
+        { 0x36010F, "SMSG_ADD_LOSS_OF_CONTROL", "ServerToClient" },
+        { 0x3600DF, "SMSG_ADDON_LIST_REQUEST", "ServerToClient" },
+        { 0x360156, "SMSG_ADD_RUNE_POWER", "ServerToClient" },
+        { 0x360069, "SMSG_ADJUST_SPLINE_DURATION", "ServerToClient" },
+        { 0x3602FC, "SMSG_ADVANCED_COMBAT_LOG", "ServerToClient" },
+        { 0x3602F7, "SMSG_ADVENTURE_JOURNAL_DATA_RESPONSE", "ServerToClient" },
+        { 0x3600B6, "SMSG_AE_LOOT_TARGET_ACK", "ServerToClient" },
+        { 0x3600B5, "SMSG_AE_LOOT_TARGETS", "ServerToClient" },
+        { 0x360153, "SMSG_AI_REACTION", "ServerToClient" },
+        { 0x360005, "SMSG_ALL_ACCOUNT_CRITERIA", "ServerToClient" },
+        { 0x360004, "SMSG_ALL_ACHIEVEMENT_DATA", "ServerToClient" },
+        { 0x420000, "SMSG_ALL_GUILD_ACHIEVEMENTS", "ServerToClient" },
+        { 0x360291, "SMSG_ALLIED_RACE_DETAILS", "ServerToClient" },
+        { 0x3602D4, "SMSG_APPLY_MOUNT_EQUIPMENT_RESULT", "ServerToClient" },
+        { 0x36001D, "SMSG_ARCHAEOLOGY_SURVERY_CAST", "ServerToClient" },
+        { 0x4A0018, "SMSG_AREA_POI_UPDATE_RESPONSE", "ServerToClient" },
+        { 0x3601DC, "SMSG_AREA_SPIRIT_HEALER_TIME", "ServerToClient" },
+        { 0x370004, "SMSG_AREA_TRIGGER_DENIED", "ServerToClient" },
+        { 0x3601B4, "SMSG_AREA_TRIGGER_NO_CORPSE", "ServerToClient" },
+        { 0x370002, "SMSG_AREA_TRIGGER_PLAY_SPELL_VISUAL", "ServerToClient" },
+        { 0x370003, "SMSG_AREA_TRIGGER_UPDATE_DECAL_PROPERTIES", "ServerToClient" },
+        { 0x3600E6, "SMSG_ARENA_CLEAR_OPPONENTS", "ServerToClient" },
+        { 0x3600CF, "SMSG_ARENA_CROWD_CONTROL_SPELL_RESULT", "ServerToClient" },
+        { 0x3600E5, "SMSG_ARENA_PREP_OPPONENT_SPECIALIZATIONS", "ServerToClient" },
+        { 0x36023E, "SMSG_ARTIFACT_ENDGAME_POWERS_REFUNDED", "ServerToClient" },
+        { 0x36023C, "SMSG_ARTIFACT_FORGE_ERROR", "ServerToClient" },
+        { 0x36023D, "SMSG_ARTIFACT_RESPEC_PROMPT", "ServerToClient" },
+        { 0x360284, "SMSG_ARTIFACT_XP_GAIN", "ServerToClient" },
+        { 0x3C002C, "SMSG_ATTACKER_STATE_UPDATE", "ServerToClient" },
+        { 0x3C0017, "SMSG_ATTACK_START", "ServerToClient" },
+        { 0x3C0018, "SMSG_ATTACK_STOP", "ServerToClient" },
+        { 0x3C0026, "SMSG_ATTACK_SWING_ERROR", "ServerToClient" },
+        { 0x3C0027, "SMSG_ATTACK_SWING_LANDED_LOG", "ServerToClient" },
+        { 0x36026D, "SMSG_AUCTIONABLE_TOKEN_AUCTION_SOLD", "ServerToClient" },
+        { 0x36026C, "SMSG_AUCTIONABLE_TOKEN_SELL_AT_MARKET_PRICE_RESPONSE", "ServerToClient" },
+        { 0x36026B, "SMSG_AUCTIONABLE_TOKEN_SELL_CONFIRM_REQUIRED", "ServerToClient" },
+        { 0x360190, "SMSG_AUCTION_CLOSED_NOTIFICATION", "ServerToClient" },
+        { 0x36018D, "SMSG_AUCTION_COMMAND_RESULT", "ServerToClient" },
+        { 0x360324, "SMSG_AUCTION_DISABLE_NEW_POSTINGS", "ServerToClient" },
+        { 0x3602EE, "SMSG_AUCTION_FAVORITE_LIST", "ServerToClient" },
+        { 0x3602E6, "SMSG_AUCTION_GET_COMMODITY_QUOTE_RESULT", "ServerToClient" },
+        { 0x36018B, "SMSG_AUCTION_HELLO_RESPONSE", "ServerToClient" },
+        { 0x3602E5, "SMSG_AUCTION_LIST_BIDDED_ITEMS_RESULT", "ServerToClient" },
+        { 0x3602E1, "SMSG_AUCTION_LIST_BUCKETS_RESULT", "ServerToClient" },
+        { 0x3602E2, "SMSG_AUCTION_LIST_ITEMS_RESULT", "ServerToClient" },
+        { 0x3602E4, "SMSG_AUCTION_LIST_OWNED_ITEMS_RESULT", "ServerToClient" },
+        { 0x36018F, "SMSG_AUCTION_OUTBID_NOTIFICATION", "ServerToClient" },
+        { 0x360191, "SMSG_AUCTION_OWNER_BID_NOTIFICATION", "ServerToClient" },
+        { 0x36018C, "SMSG_AUCTION_REPLICATE_RESPONSE", "ServerToClient" },
+        { 0x36018E, "SMSG_AUCTION_WON_NOTIFICATION", "ServerToClient" },
+        { 0x4D0012, "SMSG_AURA_POINTS_DEPLETED", "ServerToClient" },
+        { 0x4D0011, "SMSG_AURA_UPDATE", "ServerToClient" },
+        { 0x3D0000, "SMSG_AUTH_CHALLENGE", "ServerToClient" },
+        { 0x360000, "SMSG_AUTH_FAILED", "ServerToClient" },
+        { 0x360001, "SMSG_AUTH_RESPONSE", "ServerToClient" },
+        { 0x3A0001, "SMSG_AVAILABLE_HOTFIXES", "ServerToClient" },
+        { 0x360325, "SMSG_BACKPACK_DEFAULT_SIZE_CHANGED", "ServerToClient" },
+        { 0x4E0007, "SMSG_BAG_CLEANUP_FINISHED", "ServerToClient" },
+        { 0x36015B, "SMSG_BARBER_SHOP_RESULT", "ServerToClient" },
+        { 0x3602C5, "SMSG_BATCH_PRESENCE_SUBSCRIPTION", "ServerToClient" },
+        { 0x3C0005, "SMSG_BATTLEFIELD_LIST", "ServerToClient" },
+        { 0x3C000B, "SMSG_BATTLEFIELD_PORT_DENIED", "ServerToClient" },
+        { 0x3C0001, "SMSG_BATTLEFIELD_STATUS_ACTIVE", "ServerToClient" },
+        { 0x3C0004, "SMSG_BATTLEFIELD_STATUS_FAILED", "ServerToClient" },
+        { 0x3C000E, "SMSG_BATTLEFIELD_STATUS_GROUP_PROPOSAL_FAILED", "ServerToClient" },
+        { 0x3C0000, "SMSG_BATTLEFIELD_STATUS_NEED_CONFIRMATION", "ServerToClient" },
+        { 0x3C0003, "SMSG_BATTLEFIELD_STATUS_NONE", "ServerToClient" },
+        { 0x3C0002, "SMSG_BATTLEFIELD_STATUS_QUEUED", "ServerToClient" },
+        { 0x3C000D, "SMSG_BATTLEFIELD_STATUS_WAIT_FOR_GROUPS", "ServerToClient" },
+        { 0x3C000C, "SMSG_BATTLEGROUND_INFO_THROTTLED", "ServerToClient" },
+        { 0x3C0029, "SMSG_BATTLEGROUND_INIT", "ServerToClient" },
+        { 0x3C0009, "SMSG_BATTLEGROUND_PLAYER_JOINED", "ServerToClient" },
+        { 0x3C000A, "SMSG_BATTLEGROUND_PLAYER_LEFT", "ServerToClient" },
+        { 0x3C0006, "SMSG_BATTLEGROUND_PLAYER_POSITIONS", "ServerToClient" },
+        { 0x3C0028, "SMSG_BATTLEGROUND_POINTS", "ServerToClient" },
+        { 0x360226, "SMSG_BATTLENET_CHALLENGE_ABORT", "ServerToClient" },
+        { 0x360225, "SMSG_BATTLENET_CHALLENGE_START", "ServerToClient" },
+        { 0x36029E, "SMSG_BATTLE_NET_CONNECTION_STATUS", "ServerToClient" },
+        { 0x36029D, "SMSG_BATTLENET_NOTIFICATION", "ServerToClient" },
+        { 0x36029C, "SMSG_BATTLENET_RESPONSE", "ServerToClient" },
+        { 0x360221, "SMSG_BATTLE_PAY_ACK_FAILED", "ServerToClient" },
+        { 0x360216, "SMSG_BATTLE_PAY_BATTLE_PET_DELIVERED", "ServerToClient" },
+        { 0x360217, "SMSG_BATTLE_PAY_COLLECTION_ITEM_DELIVERED", "ServerToClient" },
+        { 0x360220, "SMSG_BATTLE_PAY_CONFIRM_PURCHASE", "ServerToClient" },
+        { 0x360214, "SMSG_BATTLE_PAY_DELIVERY_ENDED", "ServerToClient" },
+        { 0x360213, "SMSG_BATTLE_PAY_DELIVERY_STARTED", "ServerToClient" },
+        { 0x360304, "SMSG_BATTLE_PAY_DISTRIBUTION_ASSIGN_VAS_RESPONSE", "ServerToClient" },
+        { 0x360211, "SMSG_BATTLE_PAY_DISTRIBUTION_UNREVOKED", "ServerToClient" },
+        { 0x360212, "SMSG_BATTLE_PAY_DISTRIBUTION_UPDATE", "ServerToClient" },
+        { 0x360210, "SMSG_BATTLE_PAY_GET_DISTRIBUTION_LIST_RESPONSE", "ServerToClient" },
+        { 0x36020E, "SMSG_BATTLE_PAY_GET_PRODUCT_LIST_RESPONSE", "ServerToClient" },
+        { 0x36020F, "SMSG_BATTLE_PAY_GET_PURCHASE_LIST_RESPONSE", "ServerToClient" },
+        { 0x360215, "SMSG_BATTLE_PAY_MOUNT_DELIVERED", "ServerToClient" },
+        { 0x36021F, "SMSG_BATTLE_PAY_PURCHASE_UPDATE", "ServerToClient" },
+        { 0x3602B9, "SMSG_BATTLE_PAY_START_CHECKOUT", "ServerToClient" },
+        { 0x36021D, "SMSG_BATTLE_PAY_START_DISTRIBUTION_ASSIGN_TO_TARGET_RESPONSE", "ServerToClient" },
+        { 0x36021C, "SMSG_BATTLE_PAY_START_PURCHASE_RESPONSE", "ServerToClient" },
+        { 0x3602AD, "SMSG_BATTLE_PAY_VALIDATE_PURCHASE_RESPONSE", "ServerToClient" },
+        { 0x360117, "SMSG_BATTLE_PET_CAGE_DATE_ERROR", "ServerToClient" },
+        { 0x360088, "SMSG_BATTLE_PET_DELETED", "ServerToClient" },
+        { 0x3600D5, "SMSG_BATTLE_PET_ERROR", "ServerToClient" },
+        { 0x360087, "SMSG_BATTLE_PET_JOURNAL", "ServerToClient" },
+        { 0x360085, "SMSG_BATTLE_PET_JOURNAL_LOCK_ACQUIRED", "ServerToClient" },
+        { 0x360086, "SMSG_BATTLE_PET_JOURNAL_LOCK_DENIED", "ServerToClient" },
+        { 0x36008A, "SMSG_BATTLE_PET_RESTORED", "ServerToClient" },
+        { 0x360089, "SMSG_BATTLE_PET_REVOKED", "ServerToClient" },
+        { 0x36008B, "SMSG_BATTLE_PETS_HEALED", "ServerToClient" },
+        { 0x360083, "SMSG_BATTLE_PET_TRAP_LEVEL", "ServerToClient" },
+        { 0x360082, "SMSG_BATTLE_PET_UPDATES", "ServerToClient" },
+        { 0x360011, "SMSG_BIND_POINT_UPDATE", "ServerToClient" },
+        { 0x3600C5, "SMSG_BLACK_MARKET_BID_ON_ITEM_RESULT", "ServerToClient" },
+        { 0x3600C6, "SMSG_BLACK_MARKET_OUTBID", "ServerToClient" },
+        { 0x3600C4, "SMSG_BLACK_MARKET_REQUEST_ITEMS_RESULT", "ServerToClient" },
+        { 0x3600C7, "SMSG_BLACK_MARKET_WON", "ServerToClient" },
+        { 0x3600E2, "SMSG_BONUS_ROLL_EMPTY", "ServerToClient" },
+        { 0x3C002B, "SMSG_BOSS_KILL", "ServerToClient" },
+        { 0x3C0016, "SMSG_BREAK_TARGET", "ServerToClient" },
+        { 0x3B0012, "SMSG_BROADCAST_ACHIEVEMENT", "ServerToClient" },
+        { 0x3602C7, "SMSG_BROADCAST_SUMMON_CAST", "ServerToClient" },
+        { 0x3602C8, "SMSG_BROADCAST_SUMMON_RESPONSE", "ServerToClient" },
+        { 0x360164, "SMSG_BUY_FAILED", "ServerToClient" },
+        { 0x360163, "SMSG_BUY_SUCCEEDED", "ServerToClient" },
+        { 0x3A000F, "SMSG_CACHE_INFO", "ServerToClient" },
+        { 0x3A000E, "SMSG_CACHE_VERSION", "ServerToClient" },
+        { 0x36013C, "SMSG_CALENDAR_CLEAR_PENDING_ACTION", "ServerToClient" },
+        { 0x36013D, "SMSG_CALENDAR_COMMAND_RESULT", "ServerToClient" },
+        { 0x36012C, "SMSG_CALENDAR_COMMUNITY_INVITE", "ServerToClient" },
+        { 0x360134, "SMSG_CALENDAR_EVENT_REMOVED_ALERT", "ServerToClient" },
+        { 0x360135, "SMSG_CALENDAR_EVENT_UPDATED_ALERT", "ServerToClient" },
+        { 0x36012D, "SMSG_CALENDAR_INVITE_ADDED", "ServerToClient" },
+        { 0x360131, "SMSG_CALENDAR_INVITE_ALERT", "ServerToClient" },
+        { 0x360136, "SMSG_CALENDAR_INVITE_NOTES", "ServerToClient" },
+        { 0x360137, "SMSG_CALENDAR_INVITE_NOTES_ALERT", "ServerToClient" },
+        { 0x36012E, "SMSG_CALENDAR_INVITE_REMOVED", "ServerToClient" },
+        { 0x360133, "SMSG_CALENDAR_INVITE_REMOVED_ALERT", "ServerToClient" },
+        { 0x36012F, "SMSG_CALENDAR_INVITE_STATUS", "ServerToClient" },
+        { 0x360132, "SMSG_CALENDAR_INVITE_STATUS_ALERT", "ServerToClient" },
+        { 0x360130, "SMSG_CALENDAR_MODERATOR_STATUS", "ServerToClient" },
+        { 0x360138, "SMSG_CALENDAR_RAID_LOCKOUT_ADDED", "ServerToClient" },
+        { 0x360139, "SMSG_CALENDAR_RAID_LOCKOUT_REMOVED", "ServerToClient" },
+        { 0x36013A, "SMSG_CALENDAR_RAID_LOCKOUT_UPDATED", "ServerToClient" },
+        { 0x36012A, "SMSG_CALENDAR_SEND_CALENDAR", "ServerToClient" },
+        { 0x36012B, "SMSG_CALENDAR_SEND_EVENT", "ServerToClient" },
+        { 0x36013B, "SMSG_CALENDAR_SEND_NUM_PENDING", "ServerToClient" },
+        { 0x3601C2, "SMSG_CAMERA_EFFECT", "ServerToClient" },
+        { 0x36017B, "SMSG_CANCEL_AUTO_REPEAT", "ServerToClient" },
+        { 0x3C0025, "SMSG_CANCEL_COMBAT", "ServerToClient" },
+        { 0x4D0037, "SMSG_CANCEL_ORPHAN_SPELL_VISUAL", "ServerToClient" },
+        { 0x36003B, "SMSG_CANCEL_PING_PIN", "ServerToClient" },
+        { 0x36002E, "SMSG_CANCEL_PRELOAD_WORLD", "ServerToClient" },
+        { 0x3600D4, "SMSG_CANCEL_SCENE", "ServerToClient" },
+        { 0x4D0035, "SMSG_CANCEL_SPELL_VISUAL", "ServerToClient" },
+        { 0x4D0039, "SMSG_CANCEL_SPELL_VISUAL_KIT", "ServerToClient" },
+        { 0x3C0021, "SMSG_CAN_DUEL_RESULT", "ServerToClient" },
+        { 0x3602AC, "SMSG_CAN_REDEEM_TOKEN_FOR_BALANCE_RESPONSE", "ServerToClient" },
+        { 0x3C0008, "SMSG_CAPTURE_POINT_REMOVED", "ServerToClient" },
+        { 0x360115, "SMSG_CAS_REFRESH_REMOTE_DATA", "ServerToClient" },
+        { 0x4D0048, "SMSG_CAST_FAILED", "ServerToClient" },
+        { 0x3B0009, "SMSG_CAUTIONARY_CHANNEL_MESSAGE", "ServerToClient" },
+        { 0x3B0008, "SMSG_CAUTIONARY_CHAT_MESSAGE", "ServerToClient" },
+        { 0x360061, "SMSG_CHAIN_MISSILE_BOUNCE", "ServerToClient" },
+        { 0x3600A6, "SMSG_CHALLENGE_MODE_COMPLETE", "ServerToClient" },
+        { 0x3600A7, "SMSG_CHALLENGE_MODE_NEW_PLAYER_RECORD", "ServerToClient" },
+        { 0x3600AD, "SMSG_CHALLENGE_MODE_REQUEST_LEADERS_RESULT", "ServerToClient" },
+        { 0x3600A5, "SMSG_CHALLENGE_MODE_RESET", "ServerToClient" },
+        { 0x4A0030, "SMSG_CHALLENGE_MODE_SET_LEAVER_PENALTY_TIMER", "ServerToClient" },
+        { 0x3600A3, "SMSG_CHALLENGE_MODE_START", "ServerToClient" },
+        { 0x3600A4, "SMSG_CHALLENGE_MODE_UPDATE_DEATH_COUNT", "ServerToClient" },
+        { 0x4A000C, "SMSG_CHANGE_PLAYER_DIFFICULTY_RESULT", "ServerToClient" },
+        { 0x36029F, "SMSG_CHANGE_REALM_TICKET_RESPONSE", "ServerToClient" },
+        { 0x3B001B, "SMSG_CHANNEL_LIST", "ServerToClient" },
+        { 0x3B0017, "SMSG_CHANNEL_NOTIFY", "ServerToClient" },
+        { 0x3B0019, "SMSG_CHANNEL_NOTIFY_JOINED", "ServerToClient" },
+        { 0x3B001A, "SMSG_CHANNEL_NOTIFY_LEFT", "ServerToClient" },
+        { 0x3B0018, "SMSG_CHANNEL_NOTIFY_NPE_JOINED_BATCH", "ServerToClient" },
+        { 0x360259, "SMSG_CHARACTER_CHECK_UPGRADE_RESULT", "ServerToClient" },
+        { 0x3601A2, "SMSG_CHARACTER_LOGIN_FAILED", "ServerToClient" },
+        { 0x360224, "SMSG_CHARACTER_OBJECT_TEST_RESPONSE", "ServerToClient" },
+        { 0x3601FF, "SMSG_CHARACTER_RENAME_RESULT", "ServerToClient" },
+        { 0x360258, "SMSG_CHARACTER_UPGRADE_ABORTED", "ServerToClient" },
+        { 0x360257, "SMSG_CHARACTER_UPGRADE_COMPLETE", "ServerToClient" },
+        { 0x36025A, "SMSG_CHARACTER_UPGRADE_MANUAL_UNREVOKE_RESULT", "ServerToClient" },
+        { 0x360256, "SMSG_CHARACTER_UPGRADE_STARTED", "ServerToClient" },
+        { 0x36017F, "SMSG_CHAR_CUSTOMIZE_FAILURE", "ServerToClient" },
+        { 0x360180, "SMSG_CHAR_CUSTOMIZE_SUCCESS", "ServerToClient" },
+        { 0x360243, "SMSG_CHAR_FACTION_CHANGE_RESULT", "ServerToClient" },
+        { 0x3B0001, "SMSG_CHAT", "ServerToClient" },
+        { 0x3B000E, "SMSG_CHAT_AUTO_RESPONDED", "ServerToClient" },
+        { 0x3B0022, "SMSG_CHAT_CAN_LOCAL_WHISPER_TARGET_RESPONSE", "ServerToClient" },
+        { 0x3B0014, "SMSG_CHAT_DOWN", "ServerToClient" },
+        { 0x3B0000, "SMSG_CHAT_IGNORED_ACCOUNT_MUTED", "ServerToClient" },
+        { 0x3B0015, "SMSG_CHAT_IS_DOWN", "ServerToClient" },
+        { 0x3B0023, "SMSG_CHAT_NOT_IN_GUILD", "ServerToClient" },
+        { 0x3B0006, "SMSG_CHAT_NOT_IN_PARTY", "ServerToClient" },
+        { 0x3B0004, "SMSG_CHAT_PLAYER_AMBIGUOUS", "ServerToClient" },
+        { 0x3B000D, "SMSG_CHAT_PLAYER_NOTFOUND", "ServerToClient" },
+        { 0x3B0016, "SMSG_CHAT_RECONNECT", "ServerToClient" },
+        { 0x3B001D, "SMSG_CHAT_REGIONAL_SERVICE_STATUS", "ServerToClient" },
+        { 0x3B0007, "SMSG_CHAT_RESTRICTED", "ServerToClient" },
+        { 0x3B001C, "SMSG_CHAT_SERVER_MESSAGE", "ServerToClient" },
+        { 0x4D0002, "SMSG_CHEAT_IGNORE_DIMISHING_RETURNS", "ServerToClient" },
+        { 0x4A0023, "SMSG_CHECK_ABANDON_NPE", "ServerToClient" },
+        { 0x36001B, "SMSG_CHECK_CHARACTER_NAME_AVAILABILITY_RESULT", "ServerToClient" },
+        { 0x360027, "SMSG_CHECK_WARGAME_ENTRY", "ServerToClient" },
+        { 0x3602F1, "SMSG_CHROMIE_TIME_SELECT_EXPANSION_SUCCESS", "ServerToClient" },
+        { 0x3602D8, "SMSG_CLAIM_RAF_REWARD_RESPONSE", "ServerToClient" },
+        { 0x4D0016, "SMSG_CLEAR_ALL_SPELL_CHARGES", "ServerToClient" },
+        { 0x360054, "SMSG_CLEAR_BOSS_EMOTES", "ServerToClient" },
+        { 0x360158, "SMSG_CLEAR_COOLDOWN", "ServerToClient" },
+        { 0x4D0015, "SMSG_CLEAR_COOLDOWNS", "ServerToClient" },
+        { 0x360013, "SMSG_CLEAR_RESURRECT", "ServerToClient" },
+        { 0x4D0017, "SMSG_CLEAR_SPELL_CHARGES", "ServerToClient" },
+        { 0x3C0022, "SMSG_CLEAR_TARGET", "ServerToClient" },
+        { 0x4B0022, "SMSG_CLEAR_TREASURE_PICKER_CACHE", "ServerToClient" },
+        { 0x36023B, "SMSG_CLOSE_ARTIFACT_FORGE", "ServerToClient" },
+        { 0x3602D0, "SMSG_CLUB_FINDER_ERROR_MESSAGE", "ServerToClient" },
+        { 0x3602D3, "SMSG_CLUB_FINDER_GET_CLUB_POSTING_IDS_RESPONSE", "ServerToClient" },
+        { 0x3602D1, "SMSG_CLUB_FINDER_LOOKUP_CLUB_POSTINGS_LIST", "ServerToClient" },
+        { 0x3602CE, "SMSG_CLUB_FINDER_RESPONSE_CHARACTER_APPLICATION_LIST", "ServerToClient" },
+        { 0x3602D2, "SMSG_CLUB_FINDER_RESPONSE_POST_RECRUITMENT_MESSAGE", "ServerToClient" },
+        { 0x3602CF, "SMSG_CLUB_FINDER_UPDATE_APPLICATIONS", "ServerToClient" },
+        { 0x360310, "SMSG_CLUB_FINDER_WHISPER_APPLICANT_RESPONSE", "ServerToClient" },
+        { 0x3600B4, "SMSG_COIN_REMOVED", "ServerToClient" },
+        { 0x3C0019, "SMSG_COMBAT_EVENT_FAILED", "ServerToClient" },
+        { 0x3601A4, "SMSG_COMMENTATOR_MAP_INFO", "ServerToClient" },
+        { 0x3601A5, "SMSG_COMMENTATOR_PLAYER_INFO", "ServerToClient" },
+        { 0x3601A3, "SMSG_COMMENTATOR_STATE_CHANGED", "ServerToClient" },
+        { 0x360268, "SMSG_COMMERCE_TOKEN_GET_COUNT_RESPONSE", "ServerToClient" },
+        { 0x360274, "SMSG_COMMERCE_TOKEN_GET_LOG_RESPONSE", "ServerToClient" },
+        { 0x36026A, "SMSG_COMMERCE_TOKEN_GET_MARKET_PRICE_RESPONSE", "ServerToClient" },
+        { 0x360269, "SMSG_COMMERCE_TOKEN_UPDATE", "ServerToClient" },
+        { 0x36014A, "SMSG_COMPLAINT_RESULT", "ServerToClient" },
+        { 0x360234, "SMSG_COMPLETE_SHIPMENT_RESPONSE", "ServerToClient" },
+        { 0x3D000A, "SMSG_COMPRESSED_PACKET", "ServerToClient" },
+        { 0x3602AB, "SMSG_CONFIRM_PARTY_INVITE", "ServerToClient" },
+        { 0x3D0005, "SMSG_CONNECT_TO", "ServerToClient" },
+        { 0x3600D2, "SMSG_CONSOLE_WRITE", "ServerToClient" },
+        { 0x360270, "SMSG_CONSUMABLE_TOKEN_BUY_AT_MARKET_PRICE_RESPONSE", "ServerToClient" },
+        { 0x36026F, "SMSG_CONSUMABLE_TOKEN_BUY_CHOICE_REQUIRED", "ServerToClient" },
+        { 0x36026E, "SMSG_CONSUMABLE_TOKEN_CAN_VETERAN_BUY_RESPONSE", "ServerToClient" },
+        { 0x360272, "SMSG_CONSUMABLE_TOKEN_REDEEM_CONFIRM_REQUIRED", "ServerToClient" },
+        { 0x360273, "SMSG_CONSUMABLE_TOKEN_REDEEM_RESPONSE", "ServerToClient" },
+        { 0x360222, "SMSG_CONTACT_LIST", "ServerToClient" },
+        { 0x3602B2, "SMSG_CONTRIBUTION_LAST_UPDATE_RESPONSE", "ServerToClient" },
+        { 0x3600E4, "SMSG_CONTROL_UPDATE", "ServerToClient" },
+        { 0x3602FA, "SMSG_CONVERT_ITEMS_TO_CURRENCY_VALUE", "ServerToClient" },
+        { 0x3601D5, "SMSG_COOLDOWN_CHEAT", "ServerToClient" },
+        { 0x360157, "SMSG_COOLDOWN_EVENT", "ServerToClient" },
+        { 0x3600EB, "SMSG_CORPSE_LOCATION", "ServerToClient" },
+        { 0x3601E6, "SMSG_CORPSE_RECLAIM_DELAY", "ServerToClient" },
+        { 0x3601B0, "SMSG_CORPSE_TRANSPORT_QUERY", "ServerToClient" },
+        { 0x4B0024, "SMSG_COVENANT_CALLINGS_AVAILABILITY_RESPONSE", "ServerToClient" },
+        { 0x360294, "SMSG_COVENANT_PREVIEW_OPEN_NPC", "ServerToClient" },
+        { 0x3602FB, "SMSG_COVENANT_RENOWN_SEND_CATCHUP_STATE", "ServerToClient" },
+        { 0x360330, "SMSG_CRAFT_ENCHANT_RESULT", "ServerToClient" },
+        { 0x360331, "SMSG_CRAFTING_HOUSE_HELLO_RESPONSE", "ServerToClient" },
+        { 0x36032D, "SMSG_CRAFTING_ORDER_CANCEL_RESULT", "ServerToClient" },
+        { 0x360329, "SMSG_CRAFTING_ORDER_CLAIM_RESULT", "ServerToClient" },
+        { 0x36032B, "SMSG_CRAFTING_ORDER_CRAFT_RESULT", "ServerToClient" },
+        { 0x360327, "SMSG_CRAFTING_ORDER_CREATE_RESULT", "ServerToClient" },
+        { 0x36032C, "SMSG_CRAFTING_ORDER_FULFILL_RESULT", "ServerToClient" },
+        { 0x360328, "SMSG_CRAFTING_ORDER_LIST_ORDERS_RESPONSE", "ServerToClient" },
+        { 0x360333, "SMSG_CRAFTING_ORDER_NPC_REWARD_INFO", "ServerToClient" },
+        { 0x36032F, "SMSG_CRAFTING_ORDER_REJECT_RESULT", "ServerToClient" },
+        { 0x36032A, "SMSG_CRAFTING_ORDER_RELEASE_RESULT", "ServerToClient" },
+        { 0x360332, "SMSG_CRAFTING_ORDER_UPDATE_STATE", "ServerToClient" },
+        { 0x36019E, "SMSG_CREATE_CHAR", "ServerToClient" },
+        { 0x360233, "SMSG_CREATE_SHIPMENT_RESPONSE", "ServerToClient" },
+        { 0x360336, "SMSG_CREATOR_VISUALS_OVERRIDE", "ServerToClient" },
+        { 0x360184, "SMSG_CRITERIA_DELETED", "ServerToClient" },
+        { 0x36017E, "SMSG_CRITERIA_UPDATE", "ServerToClient" },
+        { 0x36015F, "SMSG_CROSSED_INEBRIATION_THRESHOLD", "ServerToClient" },
+        { 0x360348, "SMSG_CURRENCY_TRANSFER_LOG", "ServerToClient" },
+        { 0x360347, "SMSG_CURRENCY_TRANSFER_RESULT", "ServerToClient" },
+        { 0x360064, "SMSG_CUSTOM_LOAD_SCREEN", "ServerToClient" },
+        { 0x4B0000, "SMSG_DAILY_QUESTS_RESET", "ServerToClient" },
+        { 0x4D0054, "SMSG_DAMAGE_CALC_LOG", "ServerToClient" },
+        { 0x3A0000, "SMSG_DB_REPLY", "ServerToClient" },
+        { 0x360171, "SMSG_DEATH_RELEASE_LOC", "ServerToClient" },
+        { 0x3600F3, "SMSG_DEBUG_MENU_MANAGER_FULL_UPDATE", "ServerToClient" },
+        { 0x3B000C, "SMSG_DEFENSE_MESSAGE", "ServerToClient" },
+        { 0x36019F, "SMSG_DELETE_CHAR", "ServerToClient" },
+        { 0x400022, "SMSG_DELETE_EXPIRED_MISSIONS_RESULT", "ServerToClient" },
+        { 0x36034D, "SMSG_DELVES_ACCOUNT_DATA_ELEMENT_CHANGED", "ServerToClient" },
+        { 0x3601DE, "SMSG_DESTROY_ARENA_UNIT", "ServerToClient" },
+        { 0x360196, "SMSG_DESTRUCTIBLE_BUILDING_DAMAGE", "ServerToClient" },
+        { 0x360020, "SMSG_DIFFERENT_INSTANCE_FROM_PARTY", "ServerToClient" },
+        { 0x36003F, "SMSG_DISENCHANT_CREDIT", "ServerToClient" },
+        { 0x360010, "SMSG_DISMOUNT_RESULT", "ServerToClient" },
+        { 0x4D001E, "SMSG_DISPEL_FAILED", "ServerToClient" },
+        { 0x360035, "SMSG_DISPLAY_GAME_ERROR", "ServerToClient" },
+        { 0x4A0004, "SMSG_DISPLAY_PLAYER_CHOICE", "ServerToClient" },
+        { 0x3600E8, "SMSG_DISPLAY_PROMOTION", "ServerToClient" },
+        { 0x4B001E, "SMSG_DISPLAY_QUEST_POPUP", "ServerToClient" },
+        { 0x3600C1, "SMSG_DISPLAY_TOAST", "ServerToClient" },
+        { 0x360285, "SMSG_DISPLAY_WORLD_TEXT", "ServerToClient" },
+        { 0x4D0053, "SMSG_DISPLAY_WORLD_TEXT_ON_TARGET", "ServerToClient" },
+        { 0x360079, "SMSG_DONT_AUTO_PUSH_SPELLS_TO_ACTION_BAR", "ServerToClient" },
+        { 0x3D0004, "SMSG_DROP_NEW_CONNECTION", "ServerToClient" },
+        { 0x3C001B, "SMSG_DUEL_ARRANGED", "ServerToClient" },
+        { 0x3C001F, "SMSG_DUEL_COMPLETE", "ServerToClient" },
+        { 0x3C001E, "SMSG_DUEL_COUNTDOWN", "ServerToClient" },
+        { 0x3C001D, "SMSG_DUEL_IN_BOUNDS", "ServerToClient" },
+        { 0x3C001C, "SMSG_DUEL_OUT_OF_BOUNDS", "ServerToClient" },
+        { 0x3C001A, "SMSG_DUEL_REQUESTED", "ServerToClient" },
+        { 0x3C0020, "SMSG_DUEL_WINNER", "ServerToClient" },
+        { 0x3601E1, "SMSG_DURABILITY_DAMAGE_DEATH", "ServerToClient" },
+        { 0x360260, "SMSG_EMOTE", "ServerToClient" },
+        { 0x36015A, "SMSG_ENABLE_BARBER_SHOP", "ServerToClient" },
+        { 0x3601B1, "SMSG_ENCHANTMENT_LOG", "ServerToClient" },
+        { 0x36021B, "SMSG_ENCOUNTER_END", "ServerToClient" },
+        { 0x36021A, "SMSG_ENCOUNTER_START", "ServerToClient" },
+        { 0x360147, "SMSG_END_LIGHTNING_STORM", "ServerToClient" },
+        { 0x3D0001, "SMSG_ENTER_ENCRYPTED_MODE", "ServerToClient" },
+        { 0x360018, "SMSG_ENUM_CHARACTERS_RESULT", "ServerToClient" },
+        { 0x36028A, "SMSG_ENUM_VAS_PURCHASE_STATES_RESPONSE", "ServerToClient" },
+        { 0x4D000E, "SMSG_ENVIRONMENTAL_DAMAGE_LOG", "ServerToClient" },
+        { 0x360150, "SMSG_EQUIPMENT_SET_ID", "ServerToClient" },
+        { 0x3B0005, "SMSG_EXPECTED_SPAM_RECORDS", "ServerToClient" },
+        { 0x3601FB, "SMSG_EXPLORATION_EXPERIENCE", "ServerToClient" },
+        { 0x3600F0, "SMSG_EXPORT_ACCOUNT_PROFILE", "ServerToClient" },
+        { 0x3602F8, "SMSG_EXTERNAL_TRANSACTION_ID_GENERATED", "ServerToClient" },
+        { 0x3601C1, "SMSG_FACTION_BONUS_INFO", "ServerToClient" },
+        { 0x4A0002, "SMSG_FAILED_PLAYER_CONDITION", "ServerToClient" },
+        { 0x3602A8, "SMSG_FAILED_QUEST_TURN_IN", "ServerToClient" },
+        { 0x360058, "SMSG_FEATURE_SYSTEM_STATUS", "ServerToClient" },
+        { 0x360345, "SMSG_FEATURE_SYSTEM_STATUS2", "ServerToClient" },
+        { 0x360059, "SMSG_FEATURE_SYSTEM_STATUS_GLUE_SCREEN", "ServerToClient" },
+        { 0x3601E0, "SMSG_FEIGN_DEATH_RESISTED", "ServerToClient" },
+        { 0x36016E, "SMSG_FISH_ESCAPED", "ServerToClient" },
+        { 0x36016D, "SMSG_FISH_NOT_HOOKED", "ServerToClient" },
+        { 0x48005B, "SMSG_FLIGHT_SPLINE_SYNC", "ServerToClient" },
+        { 0x4D0010, "SMSG_FLUSH_COMBAT_LOG_FILE", "ServerToClient" },
+        { 0x3601ED, "SMSG_FORCE_ANIM", "ServerToClient" },
+        { 0x3601EE, "SMSG_FORCE_ANIMATIONS", "ServerToClient" },
+        { 0x360172, "SMSG_FORCED_DEATH_UPDATE", "ServerToClient" },
+        { 0x36004A, "SMSG_FORCE_RANDOM_TRANSMOG_TOAST", "ServerToClient" },
+        { 0x4B0021, "SMSG_FORCE_SPAWN_TRACKING_UPDATE", "ServerToClient" },
+        { 0x360223, "SMSG_FRIEND_STATUS", "ServerToClient" },
+        { 0x360279, "SMSG_GAIN_MAW_POWER", "ServerToClient" },
+        { 0x36005C, "SMSG_GAME_OBJECT_ACTIVATE_ANIM_KIT", "ServerToClient" },
+        { 0x3602BF, "SMSG_GAME_OBJECT_BASE", "ServerToClient" },
+        { 0x36030F, "SMSG_GAME_OBJECT_CLOSE_INTERACTION", "ServerToClient" },
+        { 0x36005D, "SMSG_GAME_OBJECT_CUSTOM_ANIM", "ServerToClient" },
+        { 0x36005E, "SMSG_GAME_OBJECT_DESPAWN", "ServerToClient" },
+        { 0x36030E, "SMSG_GAME_OBJECT_INTERACTION", "ServerToClient" },
+        { 0x4D003C, "SMSG_GAME_OBJECT_PLAY_SPELL_VISUAL", "ServerToClient" },
+        { 0x4D003B, "SMSG_GAME_OBJECT_PLAY_SPELL_VISUAL_KIT", "ServerToClient" },
+        { 0x3601BB, "SMSG_GAME_OBJECT_RESET_STATE", "ServerToClient" },
+        { 0x36029B, "SMSG_GAME_OBJECT_SET_STATE_LOCAL", "ServerToClient" },
+        { 0x360120, "SMSG_GAME_SPEED_SET", "ServerToClient" },
+        { 0x3601AA, "SMSG_GAME_TIME_SET", "ServerToClient" },
+        { 0x3601A9, "SMSG_GAME_TIME_UPDATE", "ServerToClient" },
+        { 0x400024, "SMSG_GARRISON_ACTIVATE_MISSION_BONUS_ABILITY", "ServerToClient" },
+        { 0x400048, "SMSG_GARRISON_ADD_EVENT", "ServerToClient" },
+        { 0x400016, "SMSG_GARRISON_ADD_FOLLOWER_RESULT", "ServerToClient" },
+        { 0x40001A, "SMSG_GARRISON_ADD_MISSION_RESULT", "ServerToClient" },
+        { 0x40004B, "SMSG_GARRISON_ADD_SPEC_GROUPS", "ServerToClient" },
+        { 0x40004F, "SMSG_GARRISON_APPLY_TALENT_SOCKET_DATA_CHANGES", "ServerToClient" },
+        { 0x40002C, "SMSG_GARRISON_ASSIGN_FOLLOWER_TO_BUILDING_RESULT", "ServerToClient" },
+        { 0x400051, "SMSG_GARRISON_AUTO_TROOP_MIN_LEVEL_UPDATE_RESULT", "ServerToClient" },
+        { 0x40000B, "SMSG_GARRISON_BUILDING_ACTIVATED", "ServerToClient" },
+        { 0x400004, "SMSG_GARRISON_BUILDING_REMOVED", "ServerToClient" },
+        { 0x400006, "SMSG_GARRISON_BUILDING_SET_ACTIVE_SPECIALIZATION_RESULT", "ServerToClient" },
+        { 0x40001D, "SMSG_GARRISON_CHANGE_MISSION_START_TIME_RESULT", "ServerToClient" },
+        { 0x400047, "SMSG_GARRISON_CLEAR_COLLECTION", "ServerToClient" },
+        { 0x40004A, "SMSG_GARRISON_CLEAR_EVENT_LIST", "ServerToClient" },
+        { 0x40004C, "SMSG_GARRISON_CLEAR_SPEC_GROUPS", "ServerToClient" },
+        { 0x400046, "SMSG_GARRISON_COLLECTION_REMOVE_ENTRY", "ServerToClient" },
+        { 0x400045, "SMSG_GARRISON_COLLECTION_UPDATE_ENTRY", "ServerToClient" },
+        { 0x40003D, "SMSG_GARRISON_COMPLETE_BUILDING_CONSTRUCTION_RESULT", "ServerToClient" },
+        { 0x40001C, "SMSG_GARRISON_COMPLETE_MISSION_RESULT", "ServerToClient" },
+        { 0x40000C, "SMSG_GARRISON_CREATE_RESULT", "ServerToClient" },
+        { 0x400023, "SMSG_GARRISON_DELETE_MISSION_RESULT", "ServerToClient" },
+        { 0x400035, "SMSG_GARRISON_DELETE_RESULT", "ServerToClient" },
+        { 0x40002B, "SMSG_GARRISON_FOLLOWER_ACTIVATIONS_SET", "ServerToClient" },
+        { 0x400029, "SMSG_GARRISON_FOLLOWER_CHANGED_FLAGS", "ServerToClient" },
+        { 0x400027, "SMSG_GARRISON_FOLLOWER_CHANGED_ITEM_LEVEL", "ServerToClient" },
+        { 0x400028, "SMSG_GARRISON_FOLLOWER_CHANGED_QUALITY", "ServerToClient" },
+        { 0x400026, "SMSG_GARRISON_FOLLOWER_CHANGED_XP", "ServerToClient" },
+        { 0x40002A, "SMSG_GARRISON_FOLLOWER_FATIGUE_CLEARED", "ServerToClient" },
+        { 0x400033, "SMSG_GARRISON_GENERATE_FOLLOWERS_RESULT", "ServerToClient" },
+        { 0x400015, "SMSG_GARRISON_GET_CLASS_SPEC_CATEGORY_INFO_RESULT", "ServerToClient" },
+        { 0x40001E, "SMSG_GARRISON_GET_RECALL_PORTAL_LAST_USED_TIME_RESULT", "ServerToClient" },
+        { 0x40003F, "SMSG_GARRISON_IS_UPGRADEABLE_RESPONSE", "ServerToClient" },
+        { 0x400007, "SMSG_GARRISON_LEARN_BLUEPRINT_RESULT", "ServerToClient" },
+        { 0x400005, "SMSG_GARRISON_LEARN_SPECIALIZATION_RESULT", "ServerToClient" },
+        { 0x400040, "SMSG_GARRISON_LIST_COMPLETED_MISSIONS_CHEAT_RESULT", "ServerToClient" },
+        { 0x400019, "SMSG_GARRISON_LIST_FOLLOWERS_CHEAT_RESULT", "ServerToClient" },
+        { 0x400042, "SMSG_GARRISON_MAP_DATA_RESPONSE", "ServerToClient" },
+        { 0x400020, "SMSG_GARRISON_MISSION_BONUS_ROLL_RESULT", "ServerToClient" },
+        { 0x400043, "SMSG_GARRISON_MISSION_REQUEST_REWARD_INFO_RESPONSE", "ServerToClient" },
+        { 0x400025, "SMSG_GARRISON_MISSION_START_CONDITION_UPDATE", "ServerToClient" },
+        { 0x400037, "SMSG_GARRISON_OPEN_CRAFTER", "ServerToClient" },
+        { 0x400030, "SMSG_GARRISON_OPEN_RECRUITMENT_NPC", "ServerToClient" },
+        { 0x400003, "SMSG_GARRISON_PLACE_BUILDING_RESULT", "ServerToClient" },
+        { 0x400001, "SMSG_GARRISON_PLOT_PLACED", "ServerToClient" },
+        { 0x400002, "SMSG_GARRISON_PLOT_REMOVED", "ServerToClient" },
+        { 0x400034, "SMSG_GARRISON_RECRUIT_FOLLOWER_RESULT", "ServerToClient" },
+        { 0x40000A, "SMSG_GARRISON_REMOTE_INFO", "ServerToClient" },
+        { 0x400049, "SMSG_GARRISON_REMOVE_EVENT", "ServerToClient" },
+        { 0x40002F, "SMSG_GARRISON_REMOVE_FOLLOWER_ABILITY_RESULT", "ServerToClient" },
+        { 0x40002D, "SMSG_GARRISON_REMOVE_FOLLOWER_FROM_BUILDING_RESULT", "ServerToClient" },
+        { 0x400017, "SMSG_GARRISON_REMOVE_FOLLOWER_RESULT", "ServerToClient" },
+        { 0x40002E, "SMSG_GARRISON_RENAME_FOLLOWER_RESULT", "ServerToClient" },
+        { 0x400009, "SMSG_GARRISON_REQUEST_BLUEPRINT_AND_SPECIALIZATION_DATA_RESULT", "ServerToClient" },
+        { 0x40000E, "SMSG_GARRISON_RESEARCH_TALENT_RESULT", "ServerToClient" },
+        { 0x400013, "SMSG_GARRISON_RESET_TALENT_TREE", "ServerToClient" },
+        { 0x400014, "SMSG_GARRISON_RESET_TALENT_TREE_SOCKET_DATA", "ServerToClient" },
+        { 0x40001B, "SMSG_GARRISON_START_MISSION_RESULT", "ServerToClient" },
+        { 0x40003C, "SMSG_GARRISON_SWAP_BUILDINGS_RESPONSE", "ServerToClient" },
+        { 0x40004D, "SMSG_GARRISON_SWITCH_TALENT_TREE_BRANCH", "ServerToClient" },
+        { 0x40000F, "SMSG_GARRISON_TALENT_COMPLETED", "ServerToClient" },
+        { 0x400010, "SMSG_GARRISON_TALENT_REMOVED", "ServerToClient" },
+        { 0x400012, "SMSG_GARRISON_TALENT_REMOVE_SOCKET_DATA", "ServerToClient" },
+        { 0x400011, "SMSG_GARRISON_TALENT_UPDATE_SOCKET_DATA", "ServerToClient" },
+        { 0x40004E, "SMSG_GARRISON_TALENT_WORLD_QUEST_UNLOCKS_RESPONSE", "ServerToClient" },
+        { 0x400008, "SMSG_GARRISON_UNLEARN_BLUEPRINT_RESULT", "ServerToClient" },
+        { 0x400018, "SMSG_GARRISON_UPDATE_FOLLOWER", "ServerToClient" },
+        { 0x40003E, "SMSG_GARRISON_UPDATE_GARRISON_MONUMENT_SELECTIONS", "ServerToClient" },
+        { 0x400050, "SMSG_GARRISON_UPDATE_MISSION_CHEAT_RESULT", "ServerToClient" },
+        { 0x40000D, "SMSG_GARRISON_UPGRADE_RESULT", "ServerToClient" },
+        { 0x40001F, "SMSG_GARRISON_USE_RECALL_PORTAL_RESULT", "ServerToClient" },
+        { 0x36001C, "SMSG_GENERATE_RANDOM_CHARACTER_NAME_RESULT", "ServerToClient" },
+        { 0x3602B3, "SMSG_GENERATE_SSO_TOKEN_RESPONSE", "ServerToClient" },
+        { 0x3601FD, "SMSG_GET_ACCOUNT_CHARACTER_LIST_RESULT", "ServerToClient" },
+        { 0x400000, "SMSG_GET_GARRISON_INFO_RESULT", "ServerToClient" },
+        { 0x360236, "SMSG_GET_LANDING_PAGE_SHIPMENTS_RESPONSE", "ServerToClient" },
+        { 0x36033C, "SMSG_GET_REALM_HIDDEN_RESULT", "ServerToClient" },
+        { 0x360271, "SMSG_GET_REMAINING_GAME_TIME_RESPONSE", "ServerToClient" },
+        { 0x36025E, "SMSG_GET_SELECTED_TROPHY_ID_RESPONSE", "ServerToClient" },
+        { 0x360231, "SMSG_GET_SHIPMENT_INFO_RESPONSE", "ServerToClient" },
+        { 0x360235, "SMSG_GET_SHIPMENTS_OF_TYPE_RESPONSE", "ServerToClient" },
+        { 0x36025D, "SMSG_GET_TROPHY_LIST_RESPONSE", "ServerToClient" },
+        { 0x360286, "SMSG_GET_VAS_ACCOUNT_CHARACTER_LIST_RESULT", "ServerToClient" },
+        { 0x360287, "SMSG_GET_VAS_TRANSFER_TARGET_REALM_LIST_RESULT", "ServerToClient" },
+        { 0x4A000D, "SMSG_GM_PLAYER_INFO", "ServerToClient" },
+        { 0x4A0003, "SMSG_GM_REQUEST_PLAYER_INFO", "ServerToClient" },
+        { 0x360142, "SMSG_GM_TICKET_CASE_STATUS", "ServerToClient" },
+        { 0x360141, "SMSG_GM_TICKET_SYSTEM_STATUS", "ServerToClient" },
+        { 0x360199, "SMSG_GOD_MODE", "ServerToClient" },
+        { 0x4B0017, "SMSG_GOSSIP_COMPLETE", "ServerToClient" },
+        { 0x4B0018, "SMSG_GOSSIP_MESSAGE", "ServerToClient" },
+        { 0x4B0028, "SMSG_GOSSIP_OPTION_NPC_INTERACTION", "ServerToClient" },
+        { 0x36022E, "SMSG_GOSSIP_POI", "ServerToClient" },
+        { 0x4B0019, "SMSG_GOSSIP_QUEST_UPDATE", "ServerToClient" },
+        { 0x4B0027, "SMSG_GOSSIP_REFRESH_OPTIONS", "ServerToClient" },
+        { 0x360024, "SMSG_GROUP_ACTION_THROTTLED", "ServerToClient" },
+        { 0x36022B, "SMSG_GROUP_AUTO_KICK", "ServerToClient" },
+        { 0x360227, "SMSG_GROUP_DECLINE", "ServerToClient" },
+        { 0x36022A, "SMSG_GROUP_DESTROYED", "ServerToClient" },
+        { 0x3600CA, "SMSG_GROUP_NEW_LEADER", "ServerToClient" },
+        { 0x360228, "SMSG_GROUP_REQUEST_DECLINE", "ServerToClient" },
+        { 0x360229, "SMSG_GROUP_UNINVITE", "ServerToClient" },
+        { 0x42000D, "SMSG_GUILD_ACHIEVEMENT_DELETED", "ServerToClient" },
+        { 0x42000C, "SMSG_GUILD_ACHIEVEMENT_EARNED", "ServerToClient" },
+        { 0x42000F, "SMSG_GUILD_ACHIEVEMENT_MEMBERS", "ServerToClient" },
+        { 0x420027, "SMSG_GUILD_BANK_LOG_QUERY_RESULTS", "ServerToClient" },
+        { 0x420026, "SMSG_GUILD_BANK_QUERY_RESULTS", "ServerToClient" },
+        { 0x420028, "SMSG_GUILD_BANK_REMAINING_WITHDRAW_MONEY", "ServerToClient" },
+        { 0x42002B, "SMSG_GUILD_BANK_TEXT_QUERY_RESULT", "ServerToClient" },
+        { 0x42001B, "SMSG_GUILD_CHALLENGE_COMPLETED", "ServerToClient" },
+        { 0x42001A, "SMSG_GUILD_CHALLENGE_UPDATE", "ServerToClient" },
+        { 0x420025, "SMSG_GUILD_CHANGE_NAME_RESULT", "ServerToClient" },
+        { 0x420002, "SMSG_GUILD_COMMAND_RESULT", "ServerToClient" },
+        { 0x42000E, "SMSG_GUILD_CRITERIA_DELETED", "ServerToClient" },
+        { 0x42000B, "SMSG_GUILD_CRITERIA_UPDATE", "ServerToClient" },
+        { 0x420040, "SMSG_GUILD_EVENT_BANK_CONTENTS_CHANGED", "ServerToClient" },
+        { 0x42003F, "SMSG_GUILD_EVENT_BANK_MONEY_CHANGED", "ServerToClient" },
+        { 0x420035, "SMSG_GUILD_EVENT_DISBANDED", "ServerToClient" },
+        { 0x42002A, "SMSG_GUILD_EVENT_LOG_QUERY_RESULTS", "ServerToClient" },
+        { 0x420036, "SMSG_GUILD_EVENT_MOTD", "ServerToClient" },
+        { 0x420034, "SMSG_GUILD_EVENT_NEW_LEADER", "ServerToClient" },
+        { 0x420032, "SMSG_GUILD_EVENT_PLAYER_JOINED", "ServerToClient" },
+        { 0x420033, "SMSG_GUILD_EVENT_PLAYER_LEFT", "ServerToClient" },
+        { 0x420037, "SMSG_GUILD_EVENT_PRESENCE_CHANGE", "ServerToClient" },
+        { 0x42003A, "SMSG_GUILD_EVENT_RANK_CHANGED", "ServerToClient" },
+        { 0x420039, "SMSG_GUILD_EVENT_RANKS_UPDATED", "ServerToClient" },
+        { 0x420038, "SMSG_GUILD_EVENT_STATUS_CHANGE", "ServerToClient" },
+        { 0x42003B, "SMSG_GUILD_EVENT_TAB_ADDED", "ServerToClient" },
+        { 0x42003C, "SMSG_GUILD_EVENT_TAB_DELETED", "ServerToClient" },
+        { 0x42003D, "SMSG_GUILD_EVENT_TAB_MODIFIED", "ServerToClient" },
+        { 0x42003E, "SMSG_GUILD_EVENT_TAB_TEXT_CHANGED", "ServerToClient" },
+        { 0x420024, "SMSG_GUILD_FLAGGED_FOR_RENAME", "ServerToClient" },
+        { 0x420004, "SMSG_GUILD_HARDCORE_MEMBER_DEATH", "ServerToClient" },
+        { 0x420012, "SMSG_GUILD_INVITE", "ServerToClient" },
+        { 0x420030, "SMSG_GUILD_INVITE_DECLINED", "ServerToClient" },
+        { 0x420031, "SMSG_GUILD_INVITE_EXPIRED", "ServerToClient" },
+        { 0x42001C, "SMSG_GUILD_ITEM_LOOTED_NOTIFY", "ServerToClient" },
+        { 0x420006, "SMSG_GUILD_KNOWN_RECIPES", "ServerToClient" },
+        { 0x42002C, "SMSG_GUILD_MEMBER_DAILY_RESET", "ServerToClient" },
+        { 0x420005, "SMSG_GUILD_MEMBER_RECIPES", "ServerToClient" },
+        { 0x420007, "SMSG_GUILD_MEMBERS_WITH_RECIPE", "ServerToClient" },
+        { 0x420011, "SMSG_GUILD_MEMBER_UPDATE_NOTE", "ServerToClient" },
+        { 0x420022, "SMSG_GUILD_MOVED", "ServerToClient" },
+        { 0x420021, "SMSG_GUILD_MOVE_STARTING", "ServerToClient" },
+        { 0x420023, "SMSG_GUILD_NAME_CHANGED", "ServerToClient" },
+        { 0x420009, "SMSG_GUILD_NEWS", "ServerToClient" },
+        { 0x42000A, "SMSG_GUILD_NEWS_DELETED", "ServerToClient" },
+        { 0x420013, "SMSG_GUILD_PARTY_STATE", "ServerToClient" },
+        { 0x420029, "SMSG_GUILD_PERMISSIONS_QUERY_RESULTS", "ServerToClient" },
+        { 0x420010, "SMSG_GUILD_RANKS", "ServerToClient" },
+        { 0x420044, "SMSG_GUILD_RENAME_NAME_CHECK", "ServerToClient" },
+        { 0x420046, "SMSG_GUILD_RENAME_REFUND_RESULT", "ServerToClient" },
+        { 0x420045, "SMSG_GUILD_RENAME_REQUESTED_RESULT", "ServerToClient" },
+        { 0x420043, "SMSG_GUILD_RENAME_STATUS_UPDATE", "ServerToClient" },
+        { 0x420014, "SMSG_GUILD_REPUTATION_REACTION_CHANGED", "ServerToClient" },
+        { 0x420020, "SMSG_GUILD_RESET", "ServerToClient" },
+        { 0x420008, "SMSG_GUILD_REWARD_LIST", "ServerToClient" },
+        { 0x420003, "SMSG_GUILD_ROSTER", "ServerToClient" },
+        { 0x420001, "SMSG_GUILD_SEND_RANK_CHANGE", "ServerToClient" },
+        { 0x360344, "SMSG_HARDCORE_DEATH_ALERT", "ServerToClient" },
+        { 0x36016F, "SMSG_HEALTH_UPDATE", "ServerToClient" },
+        { 0x360177, "SMSG_HIGHEST_THREAT_UPDATE", "ServerToClient" },
+        { 0x3A0003, "SMSG_HOTFIX_CONNECT", "ServerToClient" },
+        { 0x3A0002, "SMSG_HOTFIX_MESSAGE", "ServerToClient" },
+        { 0x3601C0, "SMSG_INITIALIZE_FACTIONS", "ServerToClient" },
+        { 0x360014, "SMSG_INITIAL_SETUP", "ServerToClient" },
+        { 0x3601E2, "SMSG_INIT_WORLD_STATES", "ServerToClient" },
+        { 0x3600CE, "SMSG_INSPECT_RESULT", "ServerToClient" },
+        { 0x360093, "SMSG_INSTANCE_ABANDON_VOTE_COMPLETED", "ServerToClient" },
+        { 0x360094, "SMSG_INSTANCE_ABANDON_VOTE_PLAYER_LEFT", "ServerToClient" },
+        { 0x360092, "SMSG_INSTANCE_ABANDON_VOTE_RESPONSE", "ServerToClient" },
+        { 0x360091, "SMSG_INSTANCE_ABANDON_VOTE_STARTED", "ServerToClient" },
+        { 0x360249, "SMSG_INSTANCE_ENCOUNTER_CHANGE_PRIORITY", "ServerToClient" },
+        { 0x360248, "SMSG_INSTANCE_ENCOUNTER_DISENGAGE_UNIT", "ServerToClient" },
+        { 0x360251, "SMSG_INSTANCE_ENCOUNTER_END", "ServerToClient" },
+        { 0x360247, "SMSG_INSTANCE_ENCOUNTER_ENGAGE_UNIT", "ServerToClient" },
+        { 0x360253, "SMSG_INSTANCE_ENCOUNTER_GAIN_COMBAT_RESURRECTION_CHARGE", "ServerToClient" },
+        { 0x360252, "SMSG_INSTANCE_ENCOUNTER_IN_COMBAT_RESURRECTION", "ServerToClient" },
+        { 0x36024C, "SMSG_INSTANCE_ENCOUNTER_OBJECTIVE_COMPLETE", "ServerToClient" },
+        { 0x36024B, "SMSG_INSTANCE_ENCOUNTER_OBJECTIVE_START", "ServerToClient" },
+        { 0x360250, "SMSG_INSTANCE_ENCOUNTER_OBJECTIVE_UPDATE", "ServerToClient" },
+        { 0x360254, "SMSG_INSTANCE_ENCOUNTER_PHASE_SHIFT_CHANGED", "ServerToClient" },
+        { 0x36024D, "SMSG_INSTANCE_ENCOUNTER_START", "ServerToClient" },
+        { 0x36024A, "SMSG_INSTANCE_ENCOUNTER_TIMER_START", "ServerToClient" },
+        { 0x36024F, "SMSG_INSTANCE_ENCOUNTER_UPDATE_ALLOW_RELEASE_IN_PROGRESS", "ServerToClient" },
+        { 0x36024E, "SMSG_INSTANCE_ENCOUNTER_UPDATE_SUPPRESS_RELEASE", "ServerToClient" },
+        { 0x360197, "SMSG_INSTANCE_GROUP_SIZE_CHANGED", "ServerToClient" },
+        { 0x3600D1, "SMSG_INSTANCE_INFO", "ServerToClient" },
+        { 0x360125, "SMSG_INSTANCE_RESET", "ServerToClient" },
+        { 0x360126, "SMSG_INSTANCE_RESET_FAILED", "ServerToClient" },
+        { 0x360219, "SMSG_INSTANCE_SAVE_CREATED", "ServerToClient" },
+        { 0x4D004A, "SMSG_INTERRUPT_POWER_REGEN", "ServerToClient" },
+        { 0x3A000A, "SMSG_INVALIDATE_PAGE_TEXT", "ServerToClient" },
+        { 0x4A0007, "SMSG_INVALIDATE_PLAYER", "ServerToClient" },
+        { 0x3601EF, "SMSG_INVALID_PROMOTION_CODE", "ServerToClient" },
+        { 0x4E0005, "SMSG_INVENTORY_CHANGE_FAILURE", "ServerToClient" },
+        { 0x3602AA, "SMSG_INVENTORY_FIXUP_COMPLETE", "ServerToClient" },
+        { 0x3602BB, "SMSG_INVENTORY_FULL_OVERFLOW", "ServerToClient" },
+        { 0x3601F8, "SMSG_ISLAND_AZERITE_GAIN", "ServerToClient" },
+        { 0x3601F9, "SMSG_ISLAND_COMPLETE", "ServerToClient" },
+        { 0x4B0004, "SMSG_IS_QUEST_COMPLETE_RESPONSE", "ServerToClient" },
+        { 0x360188, "SMSG_ITEM_CHANGED", "ServerToClient" },
+        { 0x36025F, "SMSG_ITEM_COOLDOWN", "ServerToClient" },
+        { 0x3601F1, "SMSG_ITEM_ENCHANT_TIME_UPDATE", "ServerToClient" },
+        { 0x360034, "SMSG_ITEM_EXPIRE_PURCHASE_REFUND", "ServerToClient" },
+        { 0x3602F0, "SMSG_ITEM_INTERACTION_COMPLETE", "ServerToClient" },
+        { 0x360032, "SMSG_ITEM_PURCHASE_REFUND_RESULT", "ServerToClient" },
+        { 0x3600C0, "SMSG_ITEM_PUSH_RESULT", "ServerToClient" },
+        { 0x3601F0, "SMSG_ITEM_TIME_UPDATE", "ServerToClient" },
+        { 0x360128, "SMSG_KICK_REASON", "ServerToClient" },
+        { 0x360300, "SMSG_LATENCY_REPORT_PING", "ServerToClient" },
+        { 0x4D003E, "SMSG_LEARNED_SPELLS", "ServerToClient" },
+        { 0x36006D, "SMSG_LEARN_PVP_TALENT_FAILED", "ServerToClient" },
+        { 0x36006C, "SMSG_LEARN_TALENT_FAILED", "ServerToClient" },
+        { 0x3602C0, "SMSG_LEGACY_LOOT_RULES", "ServerToClient" },
+        { 0x3602D6, "SMSG_LEVEL_LINKING_RESULT", "ServerToClient" },
+        { 0x360186, "SMSG_LEVEL_UP_INFO", "ServerToClient" },
+        { 0x440019, "SMSG_LFG_BOOT_PLAYER", "ServerToClient" },
+        { 0x440017, "SMSG_LFG_DISABLED", "ServerToClient" },
+        { 0x44001F, "SMSG_LFG_EXPAND_SEARCH_PROMPT", "ServerToClient" },
+        { 0x440009, "SMSG_LFG_INSTANCE_SHUTDOWN_COUNTDOWN", "ServerToClient" },
+        { 0x440020, "SMSG_LFG_JOIN_LOBBY_MATCHMAKER_QUEUE", "ServerToClient" },
+        { 0x440000, "SMSG_LFG_JOIN_RESULT", "ServerToClient" },
+        { 0x44000F, "SMSG_LFG_LIST_APPLICANT_LIST_UPDATE", "ServerToClient" },
+        { 0x44000C, "SMSG_LFG_LIST_APPLICATION_STATUS_UPDATE", "ServerToClient" },
+        { 0x44000D, "SMSG_LFG_LIST_APPLY_TO_GROUP_RESULT", "ServerToClient" },
+        { 0x440001, "SMSG_LFG_LIST_JOIN_RESULT", "ServerToClient" },
+        { 0x440002, "SMSG_LFG_LIST_SEARCH_RESULTS", "ServerToClient" },
+        { 0x440010, "SMSG_LFG_LIST_SEARCH_RESULTS_UPDATE", "ServerToClient" },
+        { 0x440003, "SMSG_LFG_LIST_SEARCH_STATUS", "ServerToClient" },
+        { 0x44000E, "SMSG_LFG_LIST_UPDATE_BLACKLIST", "ServerToClient" },
+        { 0x44000B, "SMSG_LFG_LIST_UPDATE_EXPIRATION", "ServerToClient" },
+        { 0x44000A, "SMSG_LFG_LIST_UPDATE_STATUS", "ServerToClient" },
+        { 0x440018, "SMSG_LFG_OFFER_CONTINUE", "ServerToClient" },
+        { 0x44001A, "SMSG_LFG_PARTY_INFO", "ServerToClient" },
+        { 0x44001B, "SMSG_LFG_PLAYER_INFO", "ServerToClient" },
+        { 0x44001C, "SMSG_LFG_PLAYER_REWARD", "ServerToClient" },
+        { 0x440011, "SMSG_LFG_PROPOSAL_UPDATE", "ServerToClient" },
+        { 0x440004, "SMSG_LFG_QUEUE_STATUS", "ServerToClient" },
+        { 0x44001E, "SMSG_LFG_READY_CHECK_RESULT", "ServerToClient" },
+        { 0x440006, "SMSG_LFG_READY_CHECK_UPDATE", "ServerToClient" },
+        { 0x440005, "SMSG_LFG_ROLE_CHECK_UPDATE", "ServerToClient" },
+        { 0x440014, "SMSG_LFG_SLOT_INVALID", "ServerToClient" },
+        { 0x440016, "SMSG_LFG_TELEPORT_DENIED", "ServerToClient" },
+        { 0x440008, "SMSG_LFG_UPDATE_STATUS", "ServerToClient" },
+        { 0x36020B, "SMSG_LIVE_REGION_ACCOUNT_RESTORE_RESULT", "ServerToClient" },
+        { 0x36020A, "SMSG_LIVE_REGION_CHARACTER_COPY_RESULT", "ServerToClient" },
+        { 0x3601FE, "SMSG_LIVE_REGION_GET_ACCOUNT_CHARACTER_LIST_RESULT", "ServerToClient" },
+        { 0x36020C, "SMSG_LIVE_REGION_KEY_BINDINGS_COPY_RESULT", "ServerToClient" },
+        { 0x360055, "SMSG_LOAD_CUF_PROFILES", "ServerToClient" },
+        { 0x3601AC, "SMSG_LOAD_EQUIPMENT_SET", "ServerToClient" },
+        { 0x360311, "SMSG_LOBBY_MATCHMAKER_LOBBY_ACQUIRED_SERVER", "ServerToClient" },
+        { 0x360312, "SMSG_LOBBY_MATCHMAKER_PARTY_INFO", "ServerToClient" },
+        { 0x360313, "SMSG_LOBBY_MATCHMAKER_PARTY_INVITE_REJECTED", "ServerToClient" },
+        { 0x360315, "SMSG_LOBBY_MATCHMAKER_QUEUE_PROPOSED", "ServerToClient" },
+        { 0x360316, "SMSG_LOBBY_MATCHMAKER_QUEUE_RESULT", "ServerToClient" },
+        { 0x360314, "SMSG_LOBBY_MATCHMAKER_RECEIVE_INVITE", "ServerToClient" },
+        { 0x3601AB, "SMSG_LOGIN_SET_TIME_SPEED", "ServerToClient" },
+        { 0x36002F, "SMSG_LOGIN_VERIFY_WORLD", "ServerToClient" },
+        { 0x360124, "SMSG_LOGOUT_CANCEL_ACK", "ServerToClient" },
+        { 0x360123, "SMSG_LOGOUT_COMPLETE", "ServerToClient" },
+        { 0x360122, "SMSG_LOGOUT_RESPONSE", "ServerToClient" },
+        { 0x360182, "SMSG_LOG_XP_GAIN", "ServerToClient" },
+        { 0x3600BE, "SMSG_LOOT_ALL_PASSED", "ServerToClient" },
+        { 0x3601DD, "SMSG_LOOT_LIST", "ServerToClient" },
+        { 0x3600B9, "SMSG_LOOT_MONEY_NOTIFY", "ServerToClient" },
+        { 0x3600B8, "SMSG_LOOT_RELEASE", "ServerToClient" },
+        { 0x3600B7, "SMSG_LOOT_RELEASE_ALL", "ServerToClient" },
+        { 0x3600B3, "SMSG_LOOT_REMOVED", "ServerToClient" },
+        { 0x3600B2, "SMSG_LOOT_RESPONSE", "ServerToClient" },
+        { 0x3600BB, "SMSG_LOOT_ROLL", "ServerToClient" },
+        { 0x3600BD, "SMSG_LOOT_ROLLS_COMPLETE", "ServerToClient" },
+        { 0x3600BF, "SMSG_LOOT_ROLL_WON", "ServerToClient" },
+        { 0x36010E, "SMSG_LOSS_OF_CONTROL_AURA_UPDATE", "ServerToClient" },
+        { 0x3600D8, "SMSG_MAIL_COMMAND_RESULT", "ServerToClient" },
+        { 0x3601F2, "SMSG_MAIL_LIST_RESULT", "ServerToClient" },
+        { 0x3601F3, "SMSG_MAIL_QUERY_NEXT_TIME_RESULT", "ServerToClient" },
+        { 0x3C002A, "SMSG_MAP_OBJECTIVES_INIT", "ServerToClient" },
+        { 0x36005F, "SMSG_MAP_OBJ_EVENTS", "ServerToClient" },
+        { 0x3600BC, "SMSG_MASTER_LOOT_CANDIDATE_LIST", "ServerToClient" },
+        { 0x360317, "SMSG_MEETING_STONE_FAILED", "ServerToClient" },
+        { 0x36000A, "SMSG_MESSAGE_BOX", "ServerToClient" },
+        { 0x36016C, "SMSG_MINIMAP_PING", "ServerToClient" },
+        { 0x4D0004, "SMSG_MIRROR_IMAGE_COMPONENTED_DATA", "ServerToClient" },
+        { 0x4D0003, "SMSG_MIRROR_IMAGE_CREATURE_DATA", "ServerToClient" },
+        { 0x360355, "SMSG_MIRROR_VARS", "ServerToClient" },
+        { 0x360060, "SMSG_MISSILE_CANCEL", "ServerToClient" },
+        { 0x360200, "SMSG_MODIFY_COOLDOWN", "ServerToClient" },
+        { 0x3B0003, "SMSG_MOTD", "ServerToClient" },
+        { 0x36000F, "SMSG_MOUNT_RESULT", "ServerToClient" },
+        { 0x480062, "SMSG_MOVE_ADD_IMPULSE", "ServerToClient" },
+        { 0x48005E, "SMSG_MOVE_APPLY_INERTIA", "ServerToClient" },
+        { 0x480045, "SMSG_MOVE_APPLY_MOVEMENT_FORCE", "ServerToClient" },
+        { 0x480041, "SMSG_MOVE_DISABLE_COLLISION", "ServerToClient" },
+        { 0x48002B, "SMSG_MOVE_DISABLE_DOUBLE_JUMP", "ServerToClient" },
+        { 0x480075, "SMSG_MOVE_DISABLE_FULL_SPEED_TURNING", "ServerToClient" },
+        { 0x48003D, "SMSG_MOVE_DISABLE_GRAVITY", "ServerToClient" },
+        { 0x48003F, "SMSG_MOVE_DISABLE_INERTIA", "ServerToClient" },
+        { 0x48003C, "SMSG_MOVE_DISABLE_TRANSITION_BETWEEN_SWIM_AND_FLY", "ServerToClient" },
+        { 0x480042, "SMSG_MOVE_ENABLE_COLLISION", "ServerToClient" },
+        { 0x48002A, "SMSG_MOVE_ENABLE_DOUBLE_JUMP", "ServerToClient" },
+        { 0x480074, "SMSG_MOVE_ENABLE_FULL_SPEED_TURNING", "ServerToClient" },
+        { 0x48003E, "SMSG_MOVE_ENABLE_GRAVITY", "ServerToClient" },
+        { 0x480040, "SMSG_MOVE_ENABLE_INERTIA", "ServerToClient" },
+        { 0x48003B, "SMSG_MOVE_ENABLE_TRANSITION_BETWEEN_SWIM_AND_FLY", "ServerToClient" },
+        { 0x480031, "SMSG_MOVE_KNOCK_BACK", "ServerToClient" },
+        { 0x3602C6, "SMSG_MOVEMENT_ENFORCEMENT_ALERT", "ServerToClient" },
+        { 0x48005F, "SMSG_MOVE_REMOVE_INERTIA", "ServerToClient" },
+        { 0x480046, "SMSG_MOVE_REMOVE_MOVEMENT_FORCE", "ServerToClient" },
+        { 0x480027, "SMSG_MOVE_ROOT", "ServerToClient" },
+        { 0x480003, "SMSG_MOVE_SET_ACTIVE_MOVER", "ServerToClient" },
+        { 0x48006B, "SMSG_MOVE_SET_ADV_FLYING_ADD_IMPULSE_MAX_SPEED", "ServerToClient" },
+        { 0x480066, "SMSG_MOVE_SET_ADV_FLYING_AIR_FRICTION", "ServerToClient" },
+        { 0x48006C, "SMSG_MOVE_SET_ADV_FLYING_BANKING_RATE", "ServerToClient" },
+        { 0x480069, "SMSG_MOVE_SET_ADV_FLYING_DOUBLE_JUMP_VEL_MOD", "ServerToClient" },
+        { 0x48006A, "SMSG_MOVE_SET_ADV_FLYING_GLIDE_START_MIN_HEIGHT", "ServerToClient" },
+        { 0x480072, "SMSG_MOVE_SET_ADV_FLYING_LAUNCH_SPEED_COEFFICIENT", "ServerToClient" },
+        { 0x480068, "SMSG_MOVE_SET_ADV_FLYING_LIFT_COEFFICIENT", "ServerToClient" },
+        { 0x480067, "SMSG_MOVE_SET_ADV_FLYING_MAX_VEL", "ServerToClient" },
+        { 0x480071, "SMSG_MOVE_SET_ADV_FLYING_OVER_MAX_DECELERATION", "ServerToClient" },
+        { 0x48006D, "SMSG_MOVE_SET_ADV_FLYING_PITCHING_RATE_DOWN", "ServerToClient" },
+        { 0x48006E, "SMSG_MOVE_SET_ADV_FLYING_PITCHING_RATE_UP", "ServerToClient" },
+        { 0x480070, "SMSG_MOVE_SET_ADV_FLYING_SURFACE_FRICTION", "ServerToClient" },
+        { 0x48006F, "SMSG_MOVE_SET_ADV_FLYING_TURN_VELOCITY_THRESHOLD", "ServerToClient" },
+        { 0x480064, "SMSG_MOVE_SET_CAN_ADV_FLY", "ServerToClient" },
+        { 0x480076, "SMSG_MOVE_SET_CAN_DRIVE", "ServerToClient" },
+        { 0x480033, "SMSG_MOVE_SET_CAN_FLY", "ServerToClient" },
+        { 0x480035, "SMSG_MOVE_SET_CANNOT_SWIM", "ServerToClient" },
+        { 0x480037, "SMSG_MOVE_SET_CAN_TURN_WHILE_FALLING", "ServerToClient" },
+        { 0x480043, "SMSG_MOVE_SET_COLLISION_HEIGHT", "ServerToClient" },
+        { 0x480047, "SMSG_MOVE_SET_COMPOUND_STATE", "ServerToClient" },
+        { 0x48002D, "SMSG_MOVE_SET_FEATHER_FALL", "ServerToClient" },
+        { 0x480023, "SMSG_MOVE_SET_FLIGHT_BACK_SPEED", "ServerToClient" },
+        { 0x480022, "SMSG_MOVE_SET_FLIGHT_SPEED", "ServerToClient" },
+        { 0x48002F, "SMSG_MOVE_SET_HOVERING", "ServerToClient" },
+        { 0x480039, "SMSG_MOVE_SET_IGNORE_MOVEMENT_FORCES", "ServerToClient" },
+        { 0x48002C, "SMSG_MOVE_SET_LAND_WALK", "ServerToClient" },
+        { 0x480014, "SMSG_MOVE_SET_MOD_MOVEMENT_FORCE_MAGNITUDE", "ServerToClient" },
+        { 0x48002E, "SMSG_MOVE_SET_NORMAL_FALL", "ServerToClient" },
+        { 0x480026, "SMSG_MOVE_SET_PITCH_RATE", "ServerToClient" },
+        { 0x48001F, "SMSG_MOVE_SET_RUN_BACK_SPEED", "ServerToClient" },
+        { 0x48001E, "SMSG_MOVE_SET_RUN_SPEED", "ServerToClient" },
+        { 0x480021, "SMSG_MOVE_SET_SWIM_BACK_SPEED", "ServerToClient" },
+        { 0x480020, "SMSG_MOVE_SET_SWIM_SPEED", "ServerToClient" },
+        { 0x480025, "SMSG_MOVE_SET_TURN_RATE", "ServerToClient" },
+        { 0x480044, "SMSG_MOVE_SET_VEHICLE_REC_ID", "ServerToClient" },
+        { 0x480024, "SMSG_MOVE_SET_WALK_SPEED", "ServerToClient" },
+        { 0x480029, "SMSG_MOVE_SET_WATER_WALK", "ServerToClient" },
+        { 0x480048, "SMSG_MOVE_SKIP_TIME", "ServerToClient" },
+        { 0x48004D, "SMSG_MOVE_SPLINE_DISABLE_COLLISION", "ServerToClient" },
+        { 0x48004B, "SMSG_MOVE_SPLINE_DISABLE_GRAVITY", "ServerToClient" },
+        { 0x48004E, "SMSG_MOVE_SPLINE_ENABLE_COLLISION", "ServerToClient" },
+        { 0x48004C, "SMSG_MOVE_SPLINE_ENABLE_GRAVITY", "ServerToClient" },
+        { 0x480049, "SMSG_MOVE_SPLINE_ROOT", "ServerToClient" },
+        { 0x48004F, "SMSG_MOVE_SPLINE_SET_FEATHER_FALL", "ServerToClient" },
+        { 0x48001A, "SMSG_MOVE_SPLINE_SET_FLIGHT_BACK_SPEED", "ServerToClient" },
+        { 0x480019, "SMSG_MOVE_SPLINE_SET_FLIGHT_SPEED", "ServerToClient" },
+        { 0x480059, "SMSG_MOVE_SPLINE_SET_FLYING", "ServerToClient" },
+        { 0x480051, "SMSG_MOVE_SPLINE_SET_HOVER", "ServerToClient" },
+        { 0x480054, "SMSG_MOVE_SPLINE_SET_LAND_WALK", "ServerToClient" },
+        { 0x480050, "SMSG_MOVE_SPLINE_SET_NORMAL_FALL", "ServerToClient" },
+        { 0x48001D, "SMSG_MOVE_SPLINE_SET_PITCH_RATE", "ServerToClient" },
+        { 0x480016, "SMSG_MOVE_SPLINE_SET_RUN_BACK_SPEED", "ServerToClient" },
+        { 0x480057, "SMSG_MOVE_SPLINE_SET_RUN_MODE", "ServerToClient" },
+        { 0x480015, "SMSG_MOVE_SPLINE_SET_RUN_SPEED", "ServerToClient" },
+        { 0x480018, "SMSG_MOVE_SPLINE_SET_SWIM_BACK_SPEED", "ServerToClient" },
+        { 0x480017, "SMSG_MOVE_SPLINE_SET_SWIM_SPEED", "ServerToClient" },
+        { 0x48001C, "SMSG_MOVE_SPLINE_SET_TURN_RATE", "ServerToClient" },
+        { 0x480058, "SMSG_MOVE_SPLINE_SET_WALK_MODE", "ServerToClient" },
+        { 0x48001B, "SMSG_MOVE_SPLINE_SET_WALK_SPEED", "ServerToClient" },
+        { 0x480053, "SMSG_MOVE_SPLINE_SET_WATER_WALK", "ServerToClient" },
+        { 0x480055, "SMSG_MOVE_SPLINE_START_SWIM", "ServerToClient" },
+        { 0x480056, "SMSG_MOVE_SPLINE_STOP_SWIM", "ServerToClient" },
+        { 0x48004A, "SMSG_MOVE_SPLINE_UNROOT", "ServerToClient" },
+        { 0x48005A, "SMSG_MOVE_SPLINE_UNSET_FLYING", "ServerToClient" },
+        { 0x480052, "SMSG_MOVE_SPLINE_UNSET_HOVER", "ServerToClient" },
+        { 0x480032, "SMSG_MOVE_TELEPORT", "ServerToClient" },
+        { 0x480028, "SMSG_MOVE_UNROOT", "ServerToClient" },
+        { 0x480065, "SMSG_MOVE_UNSET_CAN_ADV_FLY", "ServerToClient" },
+        { 0x480077, "SMSG_MOVE_UNSET_CAN_DRIVE", "ServerToClient" },
+        { 0x480034, "SMSG_MOVE_UNSET_CAN_FLY", "ServerToClient" },
+        { 0x480036, "SMSG_MOVE_UNSET_CANNOT_SWIM", "ServerToClient" },
+        { 0x480038, "SMSG_MOVE_UNSET_CAN_TURN_WHILE_FALLING", "ServerToClient" },
+        { 0x480030, "SMSG_MOVE_UNSET_HOVERING", "ServerToClient" },
+        { 0x48003A, "SMSG_MOVE_UNSET_IGNORE_MOVEMENT_FORCES", "ServerToClient" },
+        { 0x48000E, "SMSG_MOVE_UPDATE", "ServerToClient" },
+        { 0x480063, "SMSG_MOVE_UPDATE_ADD_IMPULSE", "ServerToClient" },
+        { 0x480060, "SMSG_MOVE_UPDATE_APPLY_INERTIA", "ServerToClient" },
+        { 0x480012, "SMSG_MOVE_UPDATE_APPLY_MOVEMENT_FORCE", "ServerToClient" },
+        { 0x48000D, "SMSG_MOVE_UPDATE_COLLISION_HEIGHT", "ServerToClient" },
+        { 0x48000A, "SMSG_MOVE_UPDATE_FLIGHT_BACK_SPEED", "ServerToClient" },
+        { 0x480009, "SMSG_MOVE_UPDATE_FLIGHT_SPEED", "ServerToClient" },
+        { 0x480010, "SMSG_MOVE_UPDATE_KNOCK_BACK", "ServerToClient" },
+        { 0x480011, "SMSG_MOVE_UPDATE_MOD_MOVEMENT_FORCE_MAGNITUDE", "ServerToClient" },
+        { 0x48000C, "SMSG_MOVE_UPDATE_PITCH_RATE", "ServerToClient" },
+        { 0x480061, "SMSG_MOVE_UPDATE_REMOVE_INERTIA", "ServerToClient" },
+        { 0x480013, "SMSG_MOVE_UPDATE_REMOVE_MOVEMENT_FORCE", "ServerToClient" },
+        { 0x480005, "SMSG_MOVE_UPDATE_RUN_BACK_SPEED", "ServerToClient" },
+        { 0x480004, "SMSG_MOVE_UPDATE_RUN_SPEED", "ServerToClient" },
+        { 0x480008, "SMSG_MOVE_UPDATE_SWIM_BACK_SPEED", "ServerToClient" },
+        { 0x480007, "SMSG_MOVE_UPDATE_SWIM_SPEED", "ServerToClient" },
+        { 0x48000F, "SMSG_MOVE_UPDATE_TELEPORT", "ServerToClient" },
+        { 0x48000B, "SMSG_MOVE_UPDATE_TURN_RATE", "ServerToClient" },
+        { 0x480006, "SMSG_MOVE_UPDATE_WALK_SPEED", "ServerToClient" },
+        { 0x360276, "SMSG_MULTI_FLOOR_LEAVE_FLOOR", "ServerToClient" },
+        { 0x360275, "SMSG_MULTI_FLOOR_NEW_FLOOR", "ServerToClient" },
+        { 0x3D0009, "SMSG_MULTIPLE_PACKETS", "ServerToClient" },
+        { 0x3600A8, "SMSG_MYTHIC_PLUS_ALL_MAP_STATS", "ServerToClient" },
+        { 0x3600AA, "SMSG_MYTHIC_PLUS_CURRENT_AFFIXES", "ServerToClient" },
+        { 0x3600AF, "SMSG_MYTHIC_PLUS_NEW_WEEK_RECORD", "ServerToClient" },
+        { 0x3600A9, "SMSG_MYTHIC_PLUS_SEASON_DATA", "ServerToClient" },
+        { 0x360074, "SMSG_NEUTRAL_PLAYER_FACTION_SELECT_RESULT", "ServerToClient" },
+        { 0x36033B, "SMSG_NEW_DATA_BUILD", "ServerToClient" },
+        { 0x36011D, "SMSG_NEW_TAXI_PATH", "ServerToClient" },
+        { 0x36002B, "SMSG_NEW_WORLD", "ServerToClient" },
+        { 0x4D0034, "SMSG_NOTIFY_DEST_LOC_SPELL_CAST", "ServerToClient" },
+        { 0x360149, "SMSG_NOTIFY_MISSILE_TRAJECTORY_COLLISION", "ServerToClient" },
+        { 0x360031, "SMSG_NOTIFY_MONEY", "ServerToClient" },
+        { 0x3600D9, "SMSG_NOTIFY_RECEIVED_MAIL", "ServerToClient" },
+        { 0x36030D, "SMSG_NPC_INTERACTION_OPEN_RESULT", "ServerToClient" },
+        { 0x360154, "SMSG_OFFER_PETITION_ERROR", "ServerToClient" },
+        { 0x360183, "SMSG_ON_CANCEL_EXPECTED_RIDE_VEHICLE_AURA", "ServerToClient" },
+        { 0x480002, "SMSG_ON_MONSTER_MOVE", "ServerToClient" },
+        { 0x36023A, "SMSG_OPEN_ARTIFACT_FORGE", "ServerToClient" },
+        { 0x4E0006, "SMSG_OPEN_CONTAINER", "ServerToClient" },
+        { 0x440015, "SMSG_OPEN_LFG_DUNGEON_FINDER", "ServerToClient" },
+        { 0x360232, "SMSG_OPEN_SHIPMENT_NPC_RESULT", "ServerToClient" },
+        { 0x360159, "SMSG_OVERRIDE_LIGHT", "ServerToClient" },
+        { 0x3601B7, "SMSG_PAGE_TEXT", "ServerToClient" },
+        { 0x36022C, "SMSG_PARTY_COMMAND_RESULT", "ServerToClient" },
+        { 0x360350, "SMSG_PARTY_ELIGIBILITY_FOR_DELVE_TIERS_RESPONSE", "ServerToClient" },
+        { 0x360056, "SMSG_PARTY_INVITE", "ServerToClient" },
+        { 0x3601F6, "SMSG_PARTY_KILL_LOG", "ServerToClient" },
+        { 0x3601F5, "SMSG_PARTY_MEMBER_FULL_STATE", "ServerToClient" },
+        { 0x3601F4, "SMSG_PARTY_MEMBER_PARTIAL_STATE", "ServerToClient" },
+        { 0x3602F6, "SMSG_PARTY_NOTIFY_LFG_LEADER_CHANGE", "ServerToClient" },
+        { 0x36008C, "SMSG_PARTY_UPDATE", "ServerToClient" },
+        { 0x36005B, "SMSG_PAST_TIME_EVENTS", "ServerToClient" },
+        { 0x3601AE, "SMSG_PAUSE_MIRROR_TIMER", "ServerToClient" },
+        { 0x360195, "SMSG_PENDING_RAID_LOCK", "ServerToClient" },
+        { 0x36030A, "SMSG_PERKS_PROGRAM_ACTIVITY_COMPLETE", "ServerToClient" },
+        { 0x360306, "SMSG_PERKS_PROGRAM_ACTIVITY_UPDATE", "ServerToClient" },
+        { 0x36030B, "SMSG_PERKS_PROGRAM_DISABLED", "ServerToClient" },
+        { 0x360307, "SMSG_PERKS_PROGRAM_RESULT", "ServerToClient" },
+        { 0x360305, "SMSG_PERKS_PROGRAM_VENDOR_UPDATE", "ServerToClient" },
+        { 0x3601E5, "SMSG_PET_ACTION_FEEDBACK", "ServerToClient" },
+        { 0x36013F, "SMSG_PET_ACTION_SOUND", "ServerToClient" },
+        { 0x36009E, "SMSG_PET_BATTLE_CHAT_RESTRICTED", "ServerToClient" },
+        { 0x360113, "SMSG_PET_BATTLE_DEBUG_QUEUE_DUMP_RESPONSE", "ServerToClient" },
+        { 0x360097, "SMSG_PET_BATTLE_FINALIZE_LOCATION", "ServerToClient" },
+        { 0x36009C, "SMSG_PET_BATTLE_FINAL_ROUND", "ServerToClient" },
+        { 0x36009D, "SMSG_PET_BATTLE_FINISHED", "ServerToClient" },
+        { 0x360099, "SMSG_PET_BATTLE_FIRST_ROUND", "ServerToClient" },
+        { 0x360098, "SMSG_PET_BATTLE_INITIAL_UPDATE", "ServerToClient" },
+        { 0x36009F, "SMSG_PET_BATTLE_MAX_GAME_LENGTH_WARNING", "ServerToClient" },
+        { 0x360096, "SMSG_PET_BATTLE_PVP_CHALLENGE", "ServerToClient" },
+        { 0x3600D6, "SMSG_PET_BATTLE_QUEUE_PROPOSE_MATCH", "ServerToClient" },
+        { 0x3600D7, "SMSG_PET_BATTLE_QUEUE_STATUS", "ServerToClient" },
+        { 0x36009B, "SMSG_PET_BATTLE_REPLACEMENTS_MADE", "ServerToClient" },
+        { 0x360095, "SMSG_PET_BATTLE_REQUEST_FAILED", "ServerToClient" },
+        { 0x36009A, "SMSG_PET_BATTLE_ROUND_RESULT", "ServerToClient" },
+        { 0x360084, "SMSG_PET_BATTLE_SLOT_UPDATES", "ServerToClient" },
+        { 0x4D0049, "SMSG_PET_CAST_FAILED", "ServerToClient" },
+        { 0x4D0013, "SMSG_PET_CLEAR_SPELLS", "ServerToClient" },
+        { 0x360140, "SMSG_PET_DISMISS_SOUND", "ServerToClient" },
+        { 0x36011A, "SMSG_PET_GOD_MODE", "ServerToClient" },
+        { 0x3601A1, "SMSG_PET_GUIDS", "ServerToClient" },
+        { 0x360037, "SMSG_PETITION_ALREADY_SIGNED", "ServerToClient" },
+        { 0x420042, "SMSG_PETITION_RENAME_GUILD_RESPONSE", "ServerToClient" },
+        { 0x36015C, "SMSG_PETITION_SHOW_LIST", "ServerToClient" },
+        { 0x36015D, "SMSG_PETITION_SHOW_SIGNATURES", "ServerToClient" },
+        { 0x3601E8, "SMSG_PETITION_SIGN_RESULTS", "ServerToClient" },
+        { 0x4D0040, "SMSG_PET_LEARNED_SPELLS", "ServerToClient" },
+        { 0x36001F, "SMSG_PET_MODE", "ServerToClient" },
+        { 0x360161, "SMSG_PET_NAME_INVALID", "ServerToClient" },
+        { 0x36001E, "SMSG_PET_NEWLY_TAMED", "ServerToClient" },
+        { 0x4D0014, "SMSG_PET_SPELLS_MESSAGE", "ServerToClient" },
+        { 0x36002A, "SMSG_PET_STABLE_RESULT", "ServerToClient" },
+        { 0x360151, "SMSG_PET_TAME_FAILURE", "ServerToClient" },
+        { 0x4D0041, "SMSG_PET_UNLEARNED_SPELLS", "ServerToClient" },
+        { 0x36000C, "SMSG_PHASE_SHIFT_CHANGE", "ServerToClient" },
+        { 0x360173, "SMSG_PLAYED_TIME", "ServerToClient" },
+        { 0x4A002D, "SMSG_PLAYER_ACKNOWLEDGE_ARROW_CALLOUT", "ServerToClient" },
+        { 0x4A001F, "SMSG_PLAYER_AZERITE_ITEM_EQUIPPED_STATUS_CHANGED", "ServerToClient" },
+        { 0x4A001E, "SMSG_PLAYER_AZERITE_ITEM_GAINS", "ServerToClient" },
+        { 0x4A0021, "SMSG_PLAYER_BONUS_ROLL_FAILED", "ServerToClient" },
+        { 0x4A0000, "SMSG_PLAYER_BOUND", "ServerToClient" },
+        { 0x4A0006, "SMSG_PLAYER_CHOICE_CLEAR", "ServerToClient" },
+        { 0x4A0005, "SMSG_PLAYER_CHOICE_DISPLAY_ERROR", "ServerToClient" },
+        { 0x4A0012, "SMSG_PLAYER_CONDITION_RESULT", "ServerToClient" },
+        { 0x4A002F, "SMSG_PLAYER_END_OF_MATCH_DETAILS", "ServerToClient" },
+        { 0x4A002C, "SMSG_PLAYER_HIDE_ARROW_CALLOUT", "ServerToClient" },
+        { 0x4A0011, "SMSG_PLAYER_IS_ADVENTURE_MAP_POI_VALID", "ServerToClient" },
+        { 0x4A0016, "SMSG_PLAYER_OPEN_SUBSCRIPTION_INTERSTITIAL", "ServerToClient" },
+        { 0x420041, "SMSG_PLAYER_SAVE_GUILD_EMBLEM", "ServerToClient" },
+        { 0x4A002E, "SMSG_PLAYER_SAVE_PERSONAL_EMBLEM", "ServerToClient" },
+        { 0x4A002B, "SMSG_PLAYER_SHOW_ARROW_CALLOUT", "ServerToClient" },
+        { 0x4A0029, "SMSG_PLAYER_SHOW_GENERIC_WIDGET_DISPLAY", "ServerToClient" },
+        { 0x4A002A, "SMSG_PLAYER_SHOW_PARTY_POSE_UI", "ServerToClient" },
+        { 0x4A0024, "SMSG_PLAYER_SHOW_UI_EVENT_TOAST", "ServerToClient" },
+        { 0x4A000E, "SMSG_PLAYER_SKINNED", "ServerToClient" },
+        { 0x4A0015, "SMSG_PLAYER_TUTORIAL_HIGHLIGHT_SPELL", "ServerToClient" },
+        { 0x4A0014, "SMSG_PLAYER_TUTORIAL_UNHIGHLIGHT_SPELL", "ServerToClient" },
+        { 0x360205, "SMSG_PLAY_MUSIC", "ServerToClient" },
+        { 0x360207, "SMSG_PLAY_OBJECT_SOUND", "ServerToClient" },
+        { 0x3601CD, "SMSG_PLAY_ONE_SHOT_ANIM_KIT", "ServerToClient" },
+        { 0x4D0038, "SMSG_PLAY_ORPHAN_SPELL_VISUAL", "ServerToClient" },
+        { 0x3600D3, "SMSG_PLAY_SCENE", "ServerToClient" },
+        { 0x360204, "SMSG_PLAY_SOUND", "ServerToClient" },
+        { 0x360208, "SMSG_PLAY_SPEAKERBOT_SOUND", "ServerToClient" },
+        { 0x4D0036, "SMSG_PLAY_SPELL_VISUAL", "ServerToClient" },
+        { 0x4D003A, "SMSG_PLAY_SPELL_VISUAL_KIT", "ServerToClient" },
+        { 0x36019B, "SMSG_PLAY_TIME_WARNING", "ServerToClient" },
+        { 0x3D0006, "SMSG_PONG", "ServerToClient" },
+        { 0x360170, "SMSG_POWER_UPDATE", "ServerToClient" },
+        { 0x36000D, "SMSG_PRELOAD_CHILD_MAP", "ServerToClient" },
+        { 0x36002C, "SMSG_PRELOAD_WORLD", "ServerToClient" },
+        { 0x3602C9, "SMSG_PREPOPULATE_NAME_CACHE", "ServerToClient" },
+        { 0x360203, "SMSG_PRE_RESSURECT", "ServerToClient" },
+        { 0x360063, "SMSG_PRINT_NOTIFICATION", "ServerToClient" },
+        { 0x3601F7, "SMSG_PROC_RESIST", "ServerToClient" },
+        { 0x360296, "SMSG_PROFESSION_GOSSIP", "ServerToClient" },
+        { 0x4D0042, "SMSG_PUSH_SPELL_TO_ACTION_BAR", "ServerToClient" },
+        { 0x3C0024, "SMSG_PVP_CREDIT", "ServerToClient" },
+        { 0x3C002F, "SMSG_PVP_MATCH_COMPLETE", "ServerToClient" },
+        { 0x3C0030, "SMSG_PVP_MATCH_INITIALIZE", "ServerToClient" },
+        { 0x3C002E, "SMSG_PVP_MATCH_SET_STATE", "ServerToClient" },
+        { 0x3C002D, "SMSG_PVP_MATCH_START", "ServerToClient" },
+        { 0x3C0010, "SMSG_PVP_MATCH_STATISTICS", "ServerToClient" },
+        { 0x3C0013, "SMSG_PVP_OPTIONS_ENABLED", "ServerToClient" },
+        { 0x360301, "SMSG_PVP_TIER_RECORD", "ServerToClient" },
+        { 0x3A000C, "SMSG_QUERY_BATTLE_PET_NAME_RESPONSE", "ServerToClient" },
+        { 0x3A0006, "SMSG_QUERY_CREATURE_RESPONSE", "ServerToClient" },
+        { 0x3A0007, "SMSG_QUERY_GAME_OBJECT_RESPONSE", "ServerToClient" },
+        { 0x400041, "SMSG_QUERY_GARRISON_PET_NAME_RESPONSE", "ServerToClient" },
+        { 0x42002F, "SMSG_QUERY_GUILD_FOLLOW_INFO_RESPONSE", "ServerToClient" },
+        { 0x42002D, "SMSG_QUERY_GUILD_INFO_RESPONSE", "ServerToClient" },
+        { 0x3A0010, "SMSG_QUERY_ITEM_TEXT_RESPONSE", "ServerToClient" },
+        { 0x3A0008, "SMSG_QUERY_NPC_TEXT_RESPONSE", "ServerToClient" },
+        { 0x3A0009, "SMSG_QUERY_PAGE_TEXT_RESPONSE", "ServerToClient" },
+        { 0x3A000D, "SMSG_QUERY_PETITION_RESPONSE", "ServerToClient" },
+        { 0x3A000B, "SMSG_QUERY_PET_NAME_RESPONSE", "ServerToClient" },
+        { 0x4A000A, "SMSG_QUERY_PLAYER_NAME_BY_COMMUNITY_ID_RESPONSE", "ServerToClient" },
+        { 0x4A0026, "SMSG_QUERY_PLAYER_NAMES_RESPONSE", "ServerToClient" },
+        { 0x4B0016, "SMSG_QUERY_QUEST_INFO_RESPONSE", "ServerToClient" },
+        { 0x42002E, "SMSG_QUERY_REALM_GUILD_MASTER_INFO_RESPONSE", "ServerToClient" },
+        { 0x36031C, "SMSG_QUERY_SELECTED_WOW_LABS_AREA_RESPONSE", "ServerToClient" },
+        { 0x360181, "SMSG_QUERY_TIME_RESPONSE", "ServerToClient" },
+        { 0x36031D, "SMSG_QUERY_WOW_LABS_AREA_INFO_RESPONSE", "ServerToClient" },
+        { 0x4B0001, "SMSG_QUEST_COMPLETION_NPC_RESPONSE", "ServerToClient" },
+        { 0x4B000F, "SMSG_QUEST_CONFIRM_ACCEPT", "ServerToClient" },
+        { 0x4B001C, "SMSG_QUEST_FORCE_REMOVED", "ServerToClient" },
+        { 0x4B0005, "SMSG_QUEST_GIVER_INVALID_QUEST", "ServerToClient" },
+        { 0x4B0014, "SMSG_QUEST_GIVER_OFFER_REWARD_MESSAGE", "ServerToClient" },
+        { 0x4B0003, "SMSG_QUEST_GIVER_QUEST_COMPLETE", "ServerToClient" },
+        { 0x4B0012, "SMSG_QUEST_GIVER_QUEST_DETAILS", "ServerToClient" },
+        { 0x4B0006, "SMSG_QUEST_GIVER_QUEST_FAILED", "ServerToClient" },
+        { 0x4B001A, "SMSG_QUEST_GIVER_QUEST_LIST_MESSAGE", "ServerToClient" },
+        { 0x4B0013, "SMSG_QUEST_GIVER_REQUEST_ITEMS", "ServerToClient" },
+        { 0x4B001B, "SMSG_QUEST_GIVER_STATUS", "ServerToClient" },
+        { 0x4B0011, "SMSG_QUEST_GIVER_STATUS_MULTIPLE", "ServerToClient" },
+        { 0x4B0002, "SMSG_QUEST_ITEM_USABILITY_RESPONSE", "ServerToClient" },
+        { 0x4B0007, "SMSG_QUEST_LOG_FULL", "ServerToClient" },
+        { 0x4B0008, "SMSG_QUEST_NON_LOG_UPDATE_COMPLETE", "ServerToClient" },
+        { 0x4B001D, "SMSG_QUEST_POI_QUERY_RESPONSE", "ServerToClient" },
+        { 0x4B001F, "SMSG_QUEST_POI_UPDATE_RESPONSE", "ServerToClient" },
+        { 0x4B0010, "SMSG_QUEST_PUSH_RESULT", "ServerToClient" },
+        { 0x3602EC, "SMSG_QUEST_SESSION_INFO_RESPONSE", "ServerToClient" },
+        { 0x3602DA, "SMSG_QUEST_SESSION_READY_CHECK", "ServerToClient" },
+        { 0x3602DB, "SMSG_QUEST_SESSION_READY_CHECK_RESPONSE", "ServerToClient" },
+        { 0x3602D9, "SMSG_QUEST_SESSION_RESULT", "ServerToClient" },
+        { 0x4B000C, "SMSG_QUEST_UPDATE_ADD_CREDIT", "ServerToClient" },
+        { 0x4B000D, "SMSG_QUEST_UPDATE_ADD_CREDIT_SIMPLE", "ServerToClient" },
+        { 0x4B000E, "SMSG_QUEST_UPDATE_ADD_PVP_CREDIT", "ServerToClient" },
+        { 0x4B0009, "SMSG_QUEST_UPDATE_COMPLETE", "ServerToClient" },
+        { 0x4B000A, "SMSG_QUEST_UPDATE_FAILED", "ServerToClient" },
+        { 0x4B000B, "SMSG_QUEST_UPDATE_FAILED_TIMER", "ServerToClient" },
+        { 0x3602A9, "SMSG_QUEUE_SUMMARY_UPDATE", "ServerToClient" },
+        { 0x3602D7, "SMSG_RAF_ACCOUNT_INFO", "ServerToClient" },
+        { 0x3602E8, "SMSG_RAF_ACTIVITY_STATE_CHANGED", "ServerToClient" },
+        { 0x360338, "SMSG_RAF_DEBUG_FRIEND_MONTHS", "ServerToClient" },
+        { 0x360244, "SMSG_RAID_DIFFICULTY_SET", "ServerToClient" },
+        { 0x360246, "SMSG_RAID_GROUP_ONLY", "ServerToClient" },
+        { 0x3B000A, "SMSG_RAID_INSTANCE_MESSAGE", "ServerToClient" },
+        { 0x360038, "SMSG_RAID_MARKERS_CHANGED", "ServerToClient" },
+        { 0x3600CD, "SMSG_RANDOM_ROLL", "ServerToClient" },
+        { 0x3C000F, "SMSG_RATED_PVP_INFO", "ServerToClient" },
+        { 0x360240, "SMSG_READ_ITEM_RESULT_FAILED", "ServerToClient" },
+        { 0x360237, "SMSG_READ_ITEM_RESULT_OK", "ServerToClient" },
+        { 0x360090, "SMSG_READY_CHECK_COMPLETED", "ServerToClient" },
+        { 0x36008F, "SMSG_READY_CHECK_RESPONSE", "ServerToClient" },
+        { 0x36008E, "SMSG_READY_CHECK_STARTED", "ServerToClient" },
+        { 0x3A0005, "SMSG_REALM_QUERY_RESPONSE", "ServerToClient" },
+        { 0x3601E7, "SMSG_REATTACH_RESURRECT", "ServerToClient" },
+        { 0x360039, "SMSG_RECEIVE_PING_UNIT", "ServerToClient" },
+        { 0x36003A, "SMSG_RECEIVE_PING_WORLD_POINT", "ServerToClient" },
+        { 0x36032E, "SMSG_RECRAFT_ITEM_RESULT", "ServerToClient" },
+        { 0x36015E, "SMSG_RECRUIT_A_FRIEND_FAILURE", "ServerToClient" },
+        { 0x3600ED, "SMSG_REFRESH_COMPONENT", "ServerToClient" },
+        { 0x36001A, "SMSG_REGIONWIDE_CHARACTER_MAIL_DATA", "ServerToClient" },
+        { 0x360019, "SMSG_REGIONWIDE_CHARACTER_RESTRICTIONS_DATA", "ServerToClient" },
+        { 0x360043, "SMSG_REMOVE_ITEM_PASSIVE", "ServerToClient" },
+        { 0x4D0043, "SMSG_REMOVE_SPELL_FROM_ACTION_BAR", "ServerToClient" },
+        { 0x36025C, "SMSG_REPLACE_TROPHY_RESPONSE", "ServerToClient" },
+        { 0x4A0009, "SMSG_REPORT_PVP_PLAYER_AFK_RESULT", "ServerToClient" },
+        { 0x360025, "SMSG_REQUEST_CEMETERY_LIST_RESPONSE", "ServerToClient" },
+        { 0x3C0014, "SMSG_REQUEST_PVP_REWARDS_RESPONSE", "ServerToClient" },
+        { 0x3C0015, "SMSG_REQUEST_SCHEDULED_PVP_INFO_RESPONSE", "ServerToClient" },
+        { 0x3D0007, "SMSG_RESET_COMPRESSION_CONTEXT", "ServerToClient" },
+        { 0x360155, "SMSG_RESET_FAILED_NOTIFY", "ServerToClient" },
+        { 0x360335, "SMSG_RESET_LAST_LOADED_CONFIG_CVARS", "ServerToClient" },
+        { 0x4B0020, "SMSG_RESET_QUEST_POI", "ServerToClient" },
+        { 0x3C0023, "SMSG_RESET_RANGED_COMBAT_TIMER", "ServerToClient" },
+        { 0x360009, "SMSG_RESET_WEEKLY_CURRENCY", "ServerToClient" },
+        { 0x3600B0, "SMSG_RESPEC_WIPE_CONFIRM", "ServerToClient" },
+        { 0x360006, "SMSG_RESPOND_INSPECT_ACHIEVEMENTS", "ServerToClient" },
+        { 0x360308, "SMSG_RESPONSE_PERK_PENDING_REWARDS", "ServerToClient" },
+        { 0x360309, "SMSG_RESPONSE_PERK_RECENT_PURCHASES", "ServerToClient" },
+        { 0x4D0052, "SMSG_RESTART_GLOBAL_COOLDOWN", "ServerToClient" },
+        { 0x360052, "SMSG_RESTRICTED_ACCOUNT_WARNING", "ServerToClient" },
+        { 0x4D002C, "SMSG_RESUME_CAST", "ServerToClient" },
+        { 0x4D002F, "SMSG_RESUME_CAST_BAR", "ServerToClient" },
+        { 0x3D0003, "SMSG_RESUME_COMMS", "ServerToClient" },
+        { 0x360041, "SMSG_RESUME_TOKEN", "ServerToClient" },
+        { 0x360012, "SMSG_RESURRECT_REQUEST", "ServerToClient" },
+        { 0x4D0050, "SMSG_RESYNC_RUNES", "ServerToClient" },
+        { 0x3602CD, "SMSG_RETURN_APPLICANT_LIST", "ServerToClient" },
+        { 0x36023F, "SMSG_RETURNING_PLAYER_PROMPT", "ServerToClient" },
+        { 0x3602CC, "SMSG_RETURN_RECRUITING_CLUBS", "ServerToClient" },
+        { 0x360021, "SMSG_ROLE_CHANGED_INFORM", "ServerToClient" },
+        { 0x44001D, "SMSG_ROLE_CHOSEN", "ServerToClient" },
+        { 0x360022, "SMSG_ROLE_POLL_INFORM", "ServerToClient" },
+        { 0x360295, "SMSG_RUNEFORGE_LEGENDARY_CRAFTING_OPEN_NPC", "ServerToClient" },
+        { 0x36004F, "SMSG_RUNE_REGEN_DEBUG", "ServerToClient" },
+        { 0x360283, "SMSG_SCENARIO_COMPLETED", "ServerToClient" },
+        { 0x3600D0, "SMSG_SCENARIO_POIS", "ServerToClient" },
+        { 0x3600C9, "SMSG_SCENARIO_PROGRESS_UPDATE", "ServerToClient" },
+        { 0x360299, "SMSG_SCENARIO_SHOW_CRITERIA", "ServerToClient" },
+        { 0x3600C8, "SMSG_SCENARIO_STATE", "ServerToClient" },
+        { 0x360298, "SMSG_SCENARIO_UI_UPDATE", "ServerToClient" },
+        { 0x360241, "SMSG_SCENARIO_VACATE", "ServerToClient" },
+        { 0x36007A, "SMSG_SCENE_OBJECT_EVENT", "ServerToClient" },
+        { 0x36007F, "SMSG_SCENE_OBJECT_PET_BATTLE_FINAL_ROUND", "ServerToClient" },
+        { 0x360080, "SMSG_SCENE_OBJECT_PET_BATTLE_FINISHED", "ServerToClient" },
+        { 0x36007C, "SMSG_SCENE_OBJECT_PET_BATTLE_FIRST_ROUND", "ServerToClient" },
+        { 0x36007B, "SMSG_SCENE_OBJECT_PET_BATTLE_INITIAL_UPDATE", "ServerToClient" },
+        { 0x36007E, "SMSG_SCENE_OBJECT_PET_BATTLE_REPLACEMENTS_MADE", "ServerToClient" },
+        { 0x36007D, "SMSG_SCENE_OBJECT_PET_BATTLE_ROUND_RESULT", "ServerToClient" },
+        { 0x4A0019, "SMSG_SCHEDULED_AREA_POI_UPDATE_RESPONSE", "ServerToClient" },
+        { 0x4D0047, "SMSG_SCRIPT_CAST", "ServerToClient" },
+        { 0x36005A, "SMSG_SEASON_INFO", "ServerToClient" },
+        { 0x360162, "SMSG_SELL_RESPONSE", "ServerToClient" },
+        { 0x360044, "SMSG_SEND_ITEM_PASSIVES", "ServerToClient" },
+        { 0x4D0019, "SMSG_SEND_KNOWN_SPELLS", "ServerToClient" },
+        { 0x3600CB, "SMSG_SEND_RAID_TARGET_UPDATE_ALL", "ServerToClient" },
+        { 0x3600CC, "SMSG_SEND_RAID_TARGET_UPDATE_SINGLE", "ServerToClient" },
+        { 0x4D001B, "SMSG_SEND_SPELL_CHARGES", "ServerToClient" },
+        { 0x4D001A, "SMSG_SEND_SPELL_HISTORY", "ServerToClient" },
+        { 0x4D001C, "SMSG_SEND_UNLEARN_SPELLS", "ServerToClient" },
+        { 0x3600EA, "SMSG_SERVER_FIRST_ACHIEVEMENTS", "ServerToClient" },
+        { 0x360121, "SMSG_SERVER_TIME", "ServerToClient" },
+        { 0x3601B2, "SMSG_SERVER_TIME_OFFSET", "ServerToClient" },
+        { 0x3601CC, "SMSG_SET_AI_ANIM_KIT", "ServerToClient" },
+        { 0x3601D0, "SMSG_SET_ANIM_TIER", "ServerToClient" },
+        { 0x360077, "SMSG_SET_CHR_UPGRADE_TIER", "ServerToClient" },
+        { 0x360008, "SMSG_SET_CURRENCY", "ServerToClient" },
+        { 0x440012, "SMSG_SET_DF_FAST_LAUNCH_RESULT", "ServerToClient" },
+        { 0x360143, "SMSG_SET_DUNGEON_DIFFICULTY", "ServerToClient" },
+        { 0x36019D, "SMSG_SET_FACTION_AT_WAR", "ServerToClient" },
+        { 0x3601C7, "SMSG_SET_FACTION_NOT_VISIBLE", "ServerToClient" },
+        { 0x3601C8, "SMSG_SET_FACTION_STANDING", "ServerToClient" },
+        { 0x3601C6, "SMSG_SET_FACTION_VISIBLE", "ServerToClient" },
+        { 0x4D0027, "SMSG_SET_FLAT_SPELL_MODIFIER", "ServerToClient" },
+        { 0x360356, "SMSG_SET_INSTANCE_LEAVER", "ServerToClient" },
+        { 0x360033, "SMSG_SET_ITEM_PURCHASE_DATA", "ServerToClient" },
+        { 0x360267, "SMSG_SET_LOOT_METHOD_FAILED", "ServerToClient" },
+        { 0x360036, "SMSG_SET_MAX_WEEKLY_QUANTITY", "ServerToClient" },
+        { 0x3601CF, "SMSG_SET_MELEE_ANIM_KIT", "ServerToClient" },
+        { 0x3601CE, "SMSG_SET_MOVEMENT_ANIM_KIT", "ServerToClient" },
+        { 0x4D0028, "SMSG_SET_PCT_SPELL_MODIFIER", "ServerToClient" },
+        { 0x3600C2, "SMSG_SET_PET_SPECIALIZATION", "ServerToClient" },
+        { 0x4A000B, "SMSG_SET_PLAYER_DECLINED_NAMES_RESULT", "ServerToClient" },
+        { 0x360053, "SMSG_SET_PLAY_HOVER_ANIM", "ServerToClient" },
+        { 0x3601D1, "SMSG_SET_PROFICIENCY", "ServerToClient" },
+        { 0x3602E0, "SMSG_SET_QUEST_REPLAY_COOLDOWN_OVERRIDE", "ServerToClient" },
+        { 0x40003A, "SMSG_SET_SHIPMENT_READY_RESPONSE", "ServerToClient" },
+        { 0x4D0018, "SMSG_SET_SPELL_CHARGES", "ServerToClient" },
+        { 0x360116, "SMSG_SET_TIME_ZONE_INFORMATION", "ServerToClient" },
+        { 0x4D000F, "SMSG_SETUP_COMBAT_LOG_FILE_FLUSH", "ServerToClient" },
+        { 0x360007, "SMSG_SETUP_CURRENCY", "ServerToClient" },
+        { 0x360194, "SMSG_SET_VEHICLE_REC_ID", "ServerToClient" },
+        { 0x36030C, "SMSG_SHADOWLANDS_CAPACITANCE_UPDATE", "ServerToClient" },
+        { 0x40003B, "SMSG_SHIPMENT_FACTION_UPDATE_RESULT", "ServerToClient" },
+        { 0x36034E, "SMSG_SHOW_DELVES_COMPANION_CONFIGURATION_UI", "ServerToClient" },
+        { 0x36034C, "SMSG_SHOW_DELVES_DISPLAY_UI", "ServerToClient" },
+        { 0x360073, "SMSG_SHOW_NEUTRAL_PLAYER_FACTION_SELECT_UI", "ServerToClient" },
+        { 0x4B0015, "SMSG_SHOW_QUEST_COMPLETION_TEXT", "ServerToClient" },
+        { 0x36016B, "SMSG_SHOW_TAXI_NODES", "ServerToClient" },
+        { 0x36020D, "SMSG_SHOW_TRADE_SKILL_RESPONSE", "ServerToClient" },
+        { 0x360318, "SMSG_SOCIAL_CONTRACT_REQUEST_RESPONSE", "ServerToClient" },
+        { 0x3601C4, "SMSG_SOCKET_GEMS_FAILURE", "ServerToClient" },
+        { 0x3601C3, "SMSG_SOCKET_GEMS_SUCCESS", "ServerToClient" },
+        { 0x36013E, "SMSG_SPECIAL_MOUNT_ANIM", "ServerToClient" },
+        { 0x3601B6, "SMSG_SPEC_INVOLUNTARILY_CHANGED", "ServerToClient" },
+        { 0x36033A, "SMSG_SPECTATE_END", "ServerToClient" },
+        { 0x360339, "SMSG_SPECTATE_PLAYER", "ServerToClient" },
+        { 0x4D000C, "SMSG_SPELL_ABSORB_LOG", "ServerToClient" },
+        { 0x4D0006, "SMSG_SPELL_CATEGORY_COOLDOWN", "ServerToClient" },
+        { 0x4D0022, "SMSG_SPELL_CHANNEL_START", "ServerToClient" },
+        { 0x4D0023, "SMSG_SPELL_CHANNEL_UPDATE", "ServerToClient" },
+        { 0x4D0005, "SMSG_SPELL_COOLDOWN", "ServerToClient" },
+        { 0x4D001F, "SMSG_SPELL_DAMAGE_SHIELD", "ServerToClient" },
+        { 0x4D0030, "SMSG_SPELL_DELAYED", "ServerToClient" },
+        { 0x4D0007, "SMSG_SPELL_DISPELL_LOG", "ServerToClient" },
+        { 0x4D0026, "SMSG_SPELL_EMPOWER_SET_STAGE", "ServerToClient" },
+        { 0x4D0024, "SMSG_SPELL_EMPOWER_START", "ServerToClient" },
+        { 0x4D0025, "SMSG_SPELL_EMPOWER_UPDATE", "ServerToClient" },
+        { 0x4D0009, "SMSG_SPELL_ENERGIZE_LOG", "ServerToClient" },
+        { 0x4D0031, "SMSG_SPELL_EXECUTE_LOG", "ServerToClient" },
+        { 0x4D0046, "SMSG_SPELL_FAILED_OTHER", "ServerToClient" },
+        { 0x4D0044, "SMSG_SPELL_FAILURE", "ServerToClient" },
+        { 0x4D004B, "SMSG_SPELL_FAILURE_MESSAGE", "ServerToClient" },
+        { 0x4D002A, "SMSG_SPELL_GO", "ServerToClient" },
+        { 0x4D000B, "SMSG_SPELL_HEAL_ABSORB_LOG", "ServerToClient" },
+        { 0x4D000A, "SMSG_SPELL_HEAL_LOG", "ServerToClient" },
+        { 0x4D0021, "SMSG_SPELL_INSTAKILL_LOG", "ServerToClient" },
+        { 0x4D000D, "SMSG_SPELL_INTERRUPT_LOG", "ServerToClient" },
+        { 0x4D0032, "SMSG_SPELL_MISS_LOG", "ServerToClient" },
+        { 0x4D0020, "SMSG_SPELL_NON_MELEE_DAMAGE_LOG", "ServerToClient" },
+        { 0x4D001D, "SMSG_SPELL_OR_DAMAGE_IMMUNE", "ServerToClient" },
+        { 0x4D0008, "SMSG_SPELL_PERIODIC_AURA_LOG", "ServerToClient" },
+        { 0x4D0029, "SMSG_SPELL_PREPARE", "ServerToClient" },
+        { 0x4D002B, "SMSG_SPELL_START", "ServerToClient" },
+        { 0x360065, "SMSG_SPELL_VISUAL_LOAD_SCREEN", "ServerToClient" },
+        { 0x3602F2, "SMSG_SPLASH_SCREEN_SHOW_LATEST", "ServerToClient" },
+        { 0x3601BA, "SMSG_STAND_STATE_UPDATE", "ServerToClient" },
+        { 0x3600A0, "SMSG_START_ELAPSED_TIMER", "ServerToClient" },
+        { 0x3600A2, "SMSG_START_ELAPSED_TIMERS", "ServerToClient" },
+        { 0x36006B, "SMSG_STARTER_BUILD_ACTIVATE_FAILED", "ServerToClient" },
+        { 0x360146, "SMSG_START_LIGHTNING_STORM", "ServerToClient" },
+        { 0x3600BA, "SMSG_START_LOOT_ROLL", "ServerToClient" },
+        { 0x3601AD, "SMSG_START_MIRROR_TIMER", "ServerToClient" },
+        { 0x36003D, "SMSG_START_TIMER", "ServerToClient" },
+        { 0x3600A1, "SMSG_STOP_ELAPSED_TIMER", "ServerToClient" },
+        { 0x3601AF, "SMSG_STOP_MIRROR_TIMER", "ServerToClient" },
+        { 0x360209, "SMSG_STOP_SPEAKERBOT_SOUND", "ServerToClient" },
+        { 0x36003E, "SMSG_STOP_TIMER", "ServerToClient" },
+        { 0x36003C, "SMSG_STREAMING_MOVIES", "ServerToClient" },
+        { 0x36022D, "SMSG_SUGGEST_INVITE_INFORM", "ServerToClient" },
+        { 0x36014F, "SMSG_SUMMON_CANCEL", "ServerToClient" },
+        { 0x360023, "SMSG_SUMMON_RAID_MEMBER_VALIDATE_FAILED", "ServerToClient" },
+        { 0x3601BE, "SMSG_SUMMON_REQUEST", "ServerToClient" },
+        { 0x4D003D, "SMSG_SUPERCEDED_SPELLS", "ServerToClient" },
+        { 0x3D0002, "SMSG_SUSPEND_COMMS", "ServerToClient" },
+        { 0x360040, "SMSG_SUSPEND_TOKEN", "ServerToClient" },
+        { 0x3602EA, "SMSG_SYNC_WOW_ENTITLEMENTS", "ServerToClient" },
+        { 0x3601B5, "SMSG_TALENTS_INVOLUNTARILY_RESET", "ServerToClient" },
+        { 0x36011B, "SMSG_TAXI_NODE_STATUS", "ServerToClient" },
+        { 0x360119, "SMSG_TEXT_EMOTE", "ServerToClient" },
+        { 0x36017A, "SMSG_THREAT_CLEAR", "ServerToClient" },
+        { 0x360179, "SMSG_THREAT_REMOVE", "ServerToClient" },
+        { 0x360178, "SMSG_THREAT_UPDATE", "ServerToClient" },
+        { 0x480001, "SMSG_TIME_ADJUSTMENT", "ServerToClient" },
+        { 0x36034F, "SMSG_TIMERUNNING_SEASON_ENDED", "ServerToClient" },
+        { 0x480000, "SMSG_TIME_SYNC_REQUEST", "ServerToClient" },
+        { 0x360175, "SMSG_TITLE_EARNED", "ServerToClient" },
+        { 0x360176, "SMSG_TITLE_LOST", "ServerToClient" },
+        { 0x360165, "SMSG_TOTEM_CREATED", "ServerToClient" },
+        { 0x360167, "SMSG_TOTEM_DURATION_CHANGED", "ServerToClient" },
+        { 0x360168, "SMSG_TOTEM_MOVED", "ServerToClient" },
+        { 0x360166, "SMSG_TOTEM_REMOVED", "ServerToClient" },
+        { 0x360017, "SMSG_TRADE_STATUS", "ServerToClient" },
+        { 0x360016, "SMSG_TRADE_UPDATED", "ServerToClient" },
+        { 0x36017D, "SMSG_TRAINER_BUY_FAILED", "ServerToClient" },
+        { 0x36017C, "SMSG_TRAINER_LIST", "ServerToClient" },
+        { 0x36006A, "SMSG_TRAIT_CONFIG_COMMIT_FAILED", "ServerToClient" },
+        { 0x3601A0, "SMSG_TRANSFER_ABORTED", "ServerToClient" },
+        { 0x360066, "SMSG_TRANSFER_PENDING", "ServerToClient" },
+        { 0x3A0011, "SMSG_TREASURE_PICKER_RESPONSE", "ServerToClient" },
+        { 0x360261, "SMSG_TRIGGER_CINEMATIC", "ServerToClient" },
+        { 0x360169, "SMSG_TRIGGER_MOVIE", "ServerToClient" },
+        { 0x3601EA, "SMSG_TURN_IN_PETITION_RESULT", "ServerToClient" },
+        { 0x360255, "SMSG_TUTORIAL_FLAGS", "ServerToClient" },
+        { 0x360206, "SMSG_UI_ACTION", "ServerToClient" },
+        { 0x4B0023, "SMSG_UI_MAP_QUEST_LINES_RESPONSE", "ServerToClient" },
+        { 0x360262, "SMSG_UNDELETE_CHARACTER_RESPONSE", "ServerToClient" },
+        { 0x360263, "SMSG_UNDELETE_COOLDOWN_STATUS_RESPONSE", "ServerToClient" },
+        { 0x4D003F, "SMSG_UNLEARNED_SPELLS", "ServerToClient" },
+        { 0x36000E, "SMSG_UNLOAD_CHILD_MAP", "ServerToClient" },
+        { 0x360357, "SMSG_UNSET_INSTANCE_LEAVER", "ServerToClient" },
+        { 0x360302, "SMSG_UPDATE_AADC_STATUS_RESPONSE", "ServerToClient" },
+        { 0x3601A6, "SMSG_UPDATE_ACCOUNT_DATA", "ServerToClient" },
+        { 0x3601A7, "SMSG_UPDATE_ACCOUNT_DATA_COMPLETE", "ServerToClient" },
+        { 0x360078, "SMSG_UPDATE_ACTION_BUTTONS", "ServerToClient" },
+        { 0x3602BA, "SMSG_UPDATE_BNET_SESSION_KEY", "ServerToClient" },
+        { 0x3C0007, "SMSG_UPDATE_CAPTURE_POINT", "ServerToClient" },
+        { 0x3602B6, "SMSG_UPDATE_CELESTIAL_BODY", "ServerToClient" },
+        { 0x36025B, "SMSG_UPDATE_CHARACTER_FLAGS", "ServerToClient" },
+        { 0x360202, "SMSG_UPDATE_CHARGE_CATEGORY_COOLDOWN", "ServerToClient" },
+        { 0x360201, "SMSG_UPDATE_COOLDOWN", "ServerToClient" },
+        { 0x400038, "SMSG_UPDATE_CRAFTING_NPC_RECIPES", "ServerToClient" },
+        { 0x400021, "SMSG_UPDATE_DAILY_MISSION_COUNTER", "ServerToClient" },
+        { 0x3600E3, "SMSG_UPDATE_EXPANSION_LEVEL", "ServerToClient" },
+        { 0x3602BD, "SMSG_UPDATE_GAME_TIME_STATE", "ServerToClient" },
+        { 0x360148, "SMSG_UPDATE_INSTANCE_OWNERSHIP", "ServerToClient" },
+        { 0x360127, "SMSG_UPDATE_LAST_INSTANCE", "ServerToClient" },
+        { 0x460000, "SMSG_UPDATE_OBJECT", "ServerToClient" },
+        { 0x360070, "SMSG_UPDATE_PRIMARY_SPEC", "ServerToClient" },
+        { 0x36008D, "SMSG_UPDATE_RECENT_PLAYER_GUIDS", "ServerToClient" },
+        { 0x36006F, "SMSG_UPDATE_TALENT_DATA", "ServerToClient" },
+        { 0x3601E4, "SMSG_UPDATE_WORLD_STATE", "ServerToClient" },
+        { 0x3601EB, "SMSG_USE_EQUIPMENT_SET_RESULT", "ServerToClient" },
+        { 0x3B000F, "SMSG_USERLIST_ADD", "ServerToClient" },
+        { 0x3B0010, "SMSG_USERLIST_REMOVE", "ServerToClient" },
+        { 0x3B0011, "SMSG_USERLIST_UPDATE", "ServerToClient" },
+        { 0x3602B1, "SMSG_VAS_CHECK_TRANSFER_OK_RESPONSE", "ServerToClient" },
+        { 0x3602AF, "SMSG_VAS_GET_QUEUE_MINUTES_RESPONSE", "ServerToClient" },
+        { 0x3602AE, "SMSG_VAS_GET_SERVICE_STATUS_RESPONSE", "ServerToClient" },
+        { 0x360289, "SMSG_VAS_PURCHASE_COMPLETE", "ServerToClient" },
+        { 0x360288, "SMSG_VAS_PURCHASE_STATE_UPDATE", "ServerToClient" },
+        { 0x360051, "SMSG_VENDOR_INVENTORY", "ServerToClient" },
+        { 0x4A0010, "SMSG_VIGNETTE_UPDATE", "ServerToClient" },
+        { 0x3602B5, "SMSG_VOICE_CHANNEL_INFO_RESPONSE", "ServerToClient" },
+        { 0x3602FD, "SMSG_VOICE_CHANNEL_STT_TOKEN_RESPONSE", "ServerToClient" },
+        { 0x3602B4, "SMSG_VOICE_LOGIN_RESPONSE", "ServerToClient" },
+        { 0x4E0004, "SMSG_VOID_ITEM_SWAP_RESPONSE", "ServerToClient" },
+        { 0x4E0001, "SMSG_VOID_STORAGE_CONTENTS", "ServerToClient" },
+        { 0x4E0000, "SMSG_VOID_STORAGE_FAILED", "ServerToClient" },
+        { 0x4E0002, "SMSG_VOID_STORAGE_TRANSFER_CHANGES", "ServerToClient" },
+        { 0x4E0003, "SMSG_VOID_TRANSFER_RESULT", "ServerToClient" },
+        { 0x360003, "SMSG_WAIT_QUEUE_FINISH", "ServerToClient" },
+        { 0x360002, "SMSG_WAIT_QUEUE_UPDATE", "ServerToClient" },
+        { 0x36000B, "SMSG_WARDEN3_DATA", "ServerToClient" },
+        { 0x3602B8, "SMSG_WARDEN3_DISABLED", "ServerToClient" },
+        { 0x3602B7, "SMSG_WARDEN3_ENABLED", "ServerToClient" },
+        { 0x3601FA, "SMSG_WARFRONT_COMPLETE", "ServerToClient" },
+        { 0x3C0012, "SMSG_WARGAME_REQUEST_OPPONENT_RESPONSE", "ServerToClient" },
+        { 0x3C0011, "SMSG_WARGAME_REQUEST_SUCCESSFULLY_SENT_TO_OPPONENT", "ServerToClient" },
+        { 0x360145, "SMSG_WEATHER", "ServerToClient" },
+        { 0x3602F4, "SMSG_WEEKLY_REWARD_CLAIM_RESULT", "ServerToClient" },
+        { 0x3602F5, "SMSG_WEEKLY_REWARDS_PROGRESS_RESULT", "ServerToClient" },
+        { 0x3602F3, "SMSG_WEEKLY_REWARDS_RESULT", "ServerToClient" },
+        { 0x3B0002, "SMSG_WHO", "ServerToClient" },
+        { 0x360144, "SMSG_WHO_IS", "ServerToClient" },
+        { 0x3602BC, "SMSG_WILL_BE_KICKED_FOR_ADDED_SUBSCRIPTION_TIME", "ServerToClient" },
+        { 0x4A0017, "SMSG_WORLD_QUEST_UPDATE_RESPONSE", "ServerToClient" },
+        { 0x360045, "SMSG_WORLD_SERVER_INFO", "ServerToClient" },
+        { 0x3602EB, "SMSG_WOW_ENTITLEMENT_NOTIFICATION", "ServerToClient" },
+        { 0x360319, "SMSG_WOW_LABS_NOTIFY_PLAYERS_MATCH_END", "ServerToClient" },
+        { 0x36031A, "SMSG_WOW_LABS_NOTIFY_PLAYERS_MATCH_STATE_CHANGED", "ServerToClient" },
+        { 0x360326, "SMSG_WOW_LABS_PARTY_ERROR", "ServerToClient" },
+        { 0x36031F, "SMSG_WOW_LABS_SET_PREDICTION_CIRCLE", "ServerToClient" },
+        { 0x36031B, "SMSG_WOW_LABS_SET_WOW_LABS_AREA_ID_RESPONSE", "ServerToClient" },
+        { 0x360334, "SMSG_XP_AWARDED_FROM_CURRENCY", "ServerToClient" },
+        { 0x360062, "SMSG_XP_GAIN_ABORTED", "ServerToClient" },
+        { 0x360245, "SMSG_XP_GAIN_ENABLED", "ServerToClient" },
+        { 0x3B000B, "SMSG_ZONE_UNDER_ATTACK", "ServerToClient" },
+    };
+}
@@ -1,4 +1,5 @@
 #include "SpellHandler.h"
+#include "Common/PacketArena.h"
 
 using namespace PktParser::Reader;
 using namespace PktParser::V11_2_5_63506::Structures;
@@ -7,7 +8,7 @@ namespace PktParser::V11_2_5_63506::Handlers
 {
     SpellCastData ParseSpellCastData(BitReader& reader)
     {
-        SpellCastData data{};
+        SpellCastData data{ Common::CurrentResource() };
 
         data.CasterGUID = Misc::ReadPackedGuid128(reader);
         data.CasterUnit = Misc::ReadPackedGuid128(reader);
@@ -108,7 +109,7 @@ namespace PktParser::V11_2_5_63506::Handlers
         if (hasMapID)
             targetData.MapID = reader.ReadUInt32();
 
-        targetData.Name = reader.ReadWoWString(nameLength);
+        targetData.Name = reader.ReadWoWStringView(nameLength);
 
         return targetData;
     }
@@ -0,0 +1,59 @@
+#pragma once
+
+#include "Common/FieldDescriptor.h"
+#include "SpellCastData.h"
+#include "SpellTargetData.h"
+#include "TargetLocation.h"
+#include "WorldStateData.h"
+
+#include <cstddef>
+
+namespace PktParser::V11_2_5_63506::Structures
+{
+    using FieldRule = Common::FieldRule;
+
+    inline constexpr Common::FieldTable<13> SPELL_CAST_FIXED_FIELDS =
+    {{
+        FIELD_DESCRIPTOR("SpellID", SpellCastFixedData, SpellID, FieldRule::Always),
+        FIELD_DESCRIPTOR("SpellXSpellVisualID", SpellCastFixedData, Visual.SpellXSpellVisualID, FieldRule::OmitIfZero),
+        FIELD_DESCRIPTOR("ScriptVisualID", SpellCastFixedData, Visual.ScriptVisualID, FieldRule::OmitIfZero),
+        FIELD_DESCRIPTOR("CastFlags", SpellCastFixedData, CastFlags, FieldRule::OmitIfZero),
+        FIELD_DESCRIPTOR("CastFlagsEx", SpellCastFixedData, CastFlagsEx, FieldRule::OmitIfZero),
+        FIELD_DESCRIPTOR("CastFlagsEx2", SpellCastFixedData, CastFlagsEx2, FieldRule::OmitIfZero),
+        FIELD_DESCRIPTOR("CastTime", SpellCastFixedData, CastTime, FieldRule::OmitIfZero),
+        FIELD_DESCRIPTOR("TravelTime", SpellCastFixedData, MissileTrajectory.TravelTime, FieldRule::OmitIfZero),
+        FIELD_DESCRIPTOR("Pitch", SpellCastFixedData, MissileTrajectory.Pitch, FieldRule::OmitIfZero),
+        FIELD_DESCRIPTOR("AmmoDisplayID", SpellCastFixedData, AmmoDisplayID, FieldRule::OmitIfZero),
+        FIELD_DESCRIPTOR("DestLocSpellCastIndex", SpellCastFixedData, DestLocSpellCastIndex, FieldRule::OmitIfZero),
+        FIELD_DESCRIPTOR("ImmunitySchool", SpellCastFixedData, Immunities.School, FieldRule::OmitIfZero),
+        FIELD_DESCRIPTOR("ImmunityValue", SpellCastFixedData, Immunities.Value, FieldRule::OmitIfZero),
+    }};
+
+    inline constexpr Common::FieldTable<2> SPELL_HEAL_PREDICTION_FIELDS =
+    {{
+        FIELD_DESCRIPTOR("HealPoints", SpellHealPrediction, Points, FieldRule::OmitIfZero),
+        FIELD_DESCRIPTOR("HealType", SpellHealPrediction, Type, FieldRule::OmitIfZero),
+    }};
+
+    inline constexpr Common::FieldTable<3> SPELL_TARGET_FIELDS =
+    {{
+        FIELD_DESCRIPTOR("Flags", SpellTargetData, Flags, FieldRule::OmitIfZero),
+        FIELD_DESCRIPTOR("Unit", SpellTargetData, Unit, FieldRule::OmitIfZero),
+        FIELD_DESCRIPTOR("Item", SpellTargetData, Item, FieldRule::OmitIfZero),
+    }};
+
+    inline constexpr Common::FieldTable<4> TARGET_LOCATION_FIELDS =
+    {{
+        FIELD_DESCRIPTOR("Transport", TargetLocation, Transport, FieldRule::OmitIfZero),
+        FIELD_DESCRIPTOR("X", TargetLocation, X, FieldRule::Always),
+        FIELD_DESCRIPTOR("Y", TargetLocation, Y, FieldRule::Always),
+        FIELD_DESCRIPTOR("Z", TargetLocation, Z, FieldRule::Always),
+    }};
+
+    inline constexpr Common::FieldTable<3> WORLD_STATE_FIELDS =
+    {{
+        FIELD_DESCRIPTOR("WorldStateId", WorldStateData, Info.VariableID, FieldRule::Always),
+        FIELD_DESCRIPTOR("Value", WorldStateData, Info.Value, FieldRule::Always),
+        FIELD_DESCRIPTOR("Hidden", WorldStateData, Hidden, FieldRule::Always),
+    }};
+}
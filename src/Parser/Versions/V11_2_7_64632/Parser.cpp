@@ -7,6 +7,8 @@
 #include "Serializers/SpellSerializer.h"
 #include "SearchFields/SpellSearchFields.h"
 #include "JsonWriter.h"
+#include "RecordFormat.h"
+#include "PacketArena.h"
 
 using namespace PktParser::Common;
 
@@ -17,6 +19,26 @@ namespace PktParser::V11_2_7_64632
 	using namespace Serializers;
 	using namespace SearchFields;
 
+	namespace
+	{
+		ParseResult MakeSpellResult(SpellCastData const& data, BlobFormat format)
+		{
+			SpellSearchFields fields = FillSpellFields(data);
+
+			if (format == BlobFormat::Binary)
+			{
+				BinaryWriter w(SPELL_CAST_BINARY_RESERVE, CurrentResource());
+				WriteRecordHeader(w, PARSER_BUILD, RecordKind::SpellCast);
+				EncodeSpellData(w, data);
+				return ParseResult{ w.TakeString(), std::move(fields), BlobFormat::Binary };
+			}
+
+			JsonWriter w(SPELL_CAST_JSON_RESERVE, CurrentResource());
+			SerializeSpellData(w, data);
+			return ParseResult{ w.TakeString(), std::move(fields) };
+		}
+	}
+
 	Parser::Parser() : _registry { this }
 	{
 		_registry.Reserve(REGISTRY_RESERVE_SIZE);
@@ -36,26 +58,12 @@ namespace PktParser::V11_2_7_64632
 
     ParseResult Parser::HandleSpellStart(BitReader &reader)
     {
-		SpellCastData data = ParseSpellCastData(reader);
-
-		JsonWriter w(SPELL_CAST_JSON_RESERVE);
-		SerializeSpellData(w, data);
-
-		SpellSearchFields fields = FillSpellFields(data);
-
-		return ParseResult{ w.TakeString(), new SpellSearchFields(fields) };
+		return MakeSpellResult(ParseSpellCastData(reader), _blobFormat);
     }
 
     ParseResult Parser::HandleSpellGo(BitReader &reader)
     {
-        SpellCastData data = ParseSpellCastData(reader);
-
-		JsonWriter w(SPELL_CAST_JSON_RESERVE);
-		SerializeSpellData(w, data);
-
-		SpellSearchFields fields = FillSpellFields(data);
-
-		return ParseResult{ w.TakeString(), new SpellSearchFields(fields) };
+		return MakeSpellResult(ParseSpellCastData(reader), _blobFormat);
     }
 	
     ParseResult Parser::HandleUpdateWorldState([[maybe_unused]] BitReader &reader)
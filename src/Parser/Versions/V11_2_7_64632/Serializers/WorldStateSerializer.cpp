@@ -5,9 +5,7 @@ namespace PktParser::V11_2_7_64632::Serializers
     void SerializeUpdateWorldState(JsonWriter &w, WorldStateData const &data)
     {
         w.BeginObject();
-        w.WriteInt("WorldStateId", data.Info.VariableID);
-        w.WriteInt("Value", data.Info.Value);
-        w.WriteBool("Hidden", data.Hidden);
+        Common::WriteJsonFields<WORLD_STATE_FIELDS>(w, data);
         w.EndObject();
     }
 }
\ No newline at end of file
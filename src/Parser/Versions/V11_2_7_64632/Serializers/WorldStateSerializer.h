@@ -1,7 +1,9 @@
 #pragma once
 
 #include "JsonWriter.h"
+#include "FieldSerializers.h"
 #include "../Structures/WorldStateData.h"
+#include "../Structures/FieldDescriptors.h"
 
 using namespace PktParser::V11_2_7_64632::Structures;
 
@@ -0,0 +1,2312 @@
+// AUTO-GENERATED from database - DO NOT EDIT
+// parser version: V11_2_7_64877
+// total opcodes: 2299
+#pragma once
+
+#include "Common/OpcodeEntry.h"
+
+namespace PktParser::V11_2_7_64877
+{
+    inline constexpr Common::OpcodeEntry OPCODE_TABLE[] =
+    {
+        { 0x39029A, "CMSG_ABANDON_NPE_RESPONSE", "ClientToServer" },
+        { 0x3E0029, "CMSG_ACCEPT_GUILD_INVITE", "ClientToServer" },
+        { 0x3E0177, "CMSG_ACCEPT_SOCIAL_CONTRACT", "ClientToServer" },
+        { 0x390004, "CMSG_ACCEPT_TRADE", "ClientToServer" },
+        { 0x3E000C, "CMSG_ACCEPT_WARGAME_INVITE", "ClientToServer" },
+        { 0x3902DC, "CMSG_ACCOUNT_BANK_DEPOSIT_MONEY", "ClientToServer" },
+        { 0x3902DD, "CMSG_ACCOUNT_BANK_WITHDRAW_MONEY", "ClientToServer" },
+        { 0x3E0163, "CMSG_ACCOUNT_NOTIFICATION_ACKNOWLEDGED", "ClientToServer" },
+        { 0x3E00C1, "CMSG_ACCOUNT_STORE_BEGIN_PURCHASE_OR_REFUND", "ClientToServer" },
+        { 0x390289, "CMSG_ACTIVATE_SOULBIND", "ClientToServer" },
+        { 0x3A003E, "CMSG_ACTIVATE_TAXI", "ClientToServer" },
+        { 0x390172, "CMSG_ADD_ACCOUNT_COSMETIC", "ClientToServer" },
+        { 0x3E0086, "CMSG_ADD_BATTLENET_FRIEND", "ClientToServer" },
+        { 0x3E0100, "CMSG_ADD_FRIEND", "ClientToServer" },
+        { 0x3E0104, "CMSG_ADD_IGNORE", "ClientToServer" },
+        { 0x3E0004, "CMSG_ADDON_LIST", "ClientToServer" },
+        { 0x390171, "CMSG_ADD_TOY", "ClientToServer" },
+        { 0x3900B4, "CMSG_ADVENTURE_JOURNAL_OPEN_QUEST", "ClientToServer" },
+        { 0x39028C, "CMSG_ADVENTURE_JOURNAL_UPDATE_SUGGESTIONS", "ClientToServer" },
+        { 0x39022C, "CMSG_ADVENTURE_MAP_START_QUEST", "ClientToServer" },
+        { 0x3A008D, "CMSG_ALTER_APPEARANCE", "ClientToServer" },
+        { 0x3A0043, "CMSG_AREA_SPIRIT_HEALER_QUERY", "ClientToServer" },
+        { 0x3A0044, "CMSG_AREA_SPIRIT_HEALER_QUEUE", "ClientToServer" },
+        { 0x390087, "CMSG_AREA_TRIGGER", "ClientToServer" },
+        { 0x390056, "CMSG_ARTIFACT_ADD_POWER", "ClientToServer" },
+        { 0x390058, "CMSG_ARTIFACT_SET_APPEARANCE", "ClientToServer" },
+        { 0x3900C0, "CMSG_ASSIGN_EQUIPMENT_SET_SPEC", "ClientToServer" },
+        { 0x39011E, "CMSG_ATTACK_STOP", "ClientToServer" },
+        { 0x39011D, "CMSG_ATTACK_SWING", "ClientToServer" },
+        { 0x3E0116, "CMSG_AUCTIONABLE_TOKEN_SELL", "ClientToServer" },
+        { 0x3E0117, "CMSG_AUCTIONABLE_TOKEN_SELL_AT_MARKET_PRICE", "ClientToServer" },
+        { 0x3A0061, "CMSG_AUCTION_BROWSE_QUERY", "ClientToServer" },
+        { 0x3A0069, "CMSG_AUCTION_CANCEL_COMMODITIES_PURCHASE", "ClientToServer" },
+        { 0x3A0068, "CMSG_AUCTION_CONFIRM_COMMODITIES_PURCHASE", "ClientToServer" },
+        { 0x3A0067, "CMSG_AUCTION_GET_COMMODITY_QUOTE", "ClientToServer" },
+        { 0x3A005C, "CMSG_AUCTION_HELLO_REQUEST", "ClientToServer" },
+        { 0x3A0065, "CMSG_AUCTION_LIST_BIDDED_ITEMS", "ClientToServer" },
+        { 0x3A0066, "CMSG_AUCTION_LIST_BUCKETS_BY_BUCKET_KEYS", "ClientToServer" },
+        { 0x3A0062, "CMSG_AUCTION_LIST_ITEMS_BY_BUCKET_KEY", "ClientToServer" },
+        { 0x3A0063, "CMSG_AUCTION_LIST_ITEMS_BY_ITEM_ID", "ClientToServer" },
+        { 0x3A0064, "CMSG_AUCTION_LIST_OWNED_ITEMS", "ClientToServer" },
+        { 0x3A0060, "CMSG_AUCTION_PLACE_BID", "ClientToServer" },
+        { 0x3A005E, "CMSG_AUCTION_REMOVE_ITEM", "ClientToServer" },
+        { 0x3A005F, "CMSG_AUCTION_REPLICATE_ITEMS", "ClientToServer" },
+        { 0x3A006A, "CMSG_AUCTION_SELL_COMMODITY", "ClientToServer" },
+        { 0x3A005D, "CMSG_AUCTION_SELL_ITEM", "ClientToServer" },
+        { 0x3E0164, "CMSG_AUCTION_SET_FAVORITE_ITEM", "ClientToServer" },
+        { 0x3F0003, "CMSG_AUTH_CONTINUED_SESSION", "ClientToServer" },
+        { 0x3F0001, "CMSG_AUTH_SESSION", "ClientToServer" },
+        { 0x3B0003, "CMSG_AUTOBANK_ITEM", "ClientToServer" },
+        { 0x3902E6, "CMSG_AUTO_DEPOSIT_ACCOUNT_BANK", "ClientToServer" },
+        { 0x3902EE, "CMSG_AUTO_DEPOSIT_CHARACTER_BANK", "ClientToServer" },
+        { 0x3B0004, "CMSG_AUTO_EQUIP_ITEM", "ClientToServer" },
+        { 0x3B0009, "CMSG_AUTO_EQUIP_ITEM_SLOT", "ClientToServer" },
+        { 0x3A0048, "CMSG_AUTO_GUILD_BANK_ITEM", "ClientToServer" },
+        { 0x3B0005, "CMSG_AUTO_STORE_BAG_ITEM", "ClientToServer" },
+        { 0x3B0002, "CMSG_AUTOSTORE_BANK_ITEM", "ClientToServer" },
+        { 0x3A0051, "CMSG_AUTO_STORE_GUILD_BANK_ITEM", "ClientToServer" },
+        { 0x390258, "CMSG_AZERITE_EMPOWERED_ITEM_SELECT_POWER", "ClientToServer" },
+        { 0x390238, "CMSG_AZERITE_EMPOWERED_ITEM_VIEWED", "ClientToServer" },
+        { 0x39025A, "CMSG_AZERITE_ESSENCE_ACTIVATE_ESSENCE", "ClientToServer" },
+        { 0x390259, "CMSG_AZERITE_ESSENCE_UNLOCK_MILESTONE", "ClientToServer" },
+        { 0x3A0046, "CMSG_BANKER_ACTIVATE", "ClientToServer" },
+        { 0x39001F, "CMSG_BATTLEFIELD_LEAVE", "ClientToServer" },
+        { 0x39002A, "CMSG_BATTLEFIELD_LIST", "ClientToServer" },
+        { 0x3A00C3, "CMSG_BATTLEFIELD_PORT", "ClientToServer" },
+        { 0x390190, "CMSG_BATTLEMASTER_HELLO", "ClientToServer" },
+        { 0x3A00BA, "CMSG_BATTLEMASTER_JOIN", "ClientToServer" },
+        { 0x3A00BB, "CMSG_BATTLEMASTER_JOIN_ARENA", "ClientToServer" },
+        { 0x3A00C1, "CMSG_BATTLEMASTER_JOIN_BRAWL", "ClientToServer" },
+        { 0x3A00BD, "CMSG_BATTLEMASTER_JOIN_RATED_BG_BLITZ", "ClientToServer" },
+        { 0x3A00BC, "CMSG_BATTLEMASTER_JOIN_RATED_SOLO_SHUFFLE", "ClientToServer" },
+        { 0x3A00BE, "CMSG_BATTLEMASTER_JOIN_SKIRMISH", "ClientToServer" },
+        { 0x3E0103, "CMSG_BATTLENET_CHALLENGE_RESPONSE", "ClientToServer" },
+        { 0x3E0124, "CMSG_BATTLENET_REQUEST", "ClientToServer" },
+        { 0x3E00FC, "CMSG_BATTLE_PAY_ACK_FAILED_RESPONSE", "ClientToServer" },
+        { 0x3E0141, "CMSG_BATTLE_PAY_CANCEL_OPEN_CHECKOUT", "ClientToServer" },
+        { 0x3E00FB, "CMSG_BATTLE_PAY_CONFIRM_PURCHASE_RESPONSE", "ClientToServer" },
+        { 0x3E00F2, "CMSG_BATTLE_PAY_DISTRIBUTION_ASSIGN_TO_TARGET", "ClientToServer" },
+        { 0x3E0167, "CMSG_BATTLE_PAY_DISTRIBUTION_ASSIGN_VAS", "ClientToServer" },
+        { 0x3E00E9, "CMSG_BATTLE_PAY_GET_PRODUCT_LIST", "ClientToServer" },
+        { 0x3E00EA, "CMSG_BATTLE_PAY_GET_PURCHASE_LIST", "ClientToServer" },
+        { 0x3E013A, "CMSG_BATTLE_PAY_OPEN_CHECKOUT", "ClientToServer" },
+        { 0x3E0135, "CMSG_BATTLE_PAY_REQUEST_PRICE_INFO", "ClientToServer" },
+        { 0x3E00FA, "CMSG_BATTLE_PAY_START_PURCHASE", "ClientToServer" },
+        { 0x3E0122, "CMSG_BATTLE_PAY_START_VAS_PURCHASE", "ClientToServer" },
+        { 0x290002, "CMSG_BATTLE_PET_CLEAR_FANFARE", "ClientToServer" },
+        { 0x3E004F, "CMSG_BATTLE_PET_DELETE_PET", "ClientToServer" },
+        { 0x3E0052, "CMSG_BATTLE_PET_MODIFY_NAME", "ClientToServer" },
+        { 0x3E004E, "CMSG_BATTLE_PET_REQUEST_JOURNAL", "ClientToServer" },
+        { 0x3E004D, "CMSG_BATTLE_PET_REQUEST_JOURNAL_LOCK", "ClientToServer" },
+        { 0x3E0057, "CMSG_BATTLE_PET_SET_BATTLE_SLOT", "ClientToServer" },
+        { 0x3E005A, "CMSG_BATTLE_PET_SET_FLAGS", "ClientToServer" },
+        { 0x3E0053, "CMSG_BATTLE_PET_SUMMON", "ClientToServer" },
+        { 0x390091, "CMSG_BATTLE_PET_UPDATE_DISPLAY_NOTIFY", "ClientToServer" },
+        { 0x390090, "CMSG_BATTLE_PET_UPDATE_NOTIFY", "ClientToServer" },
+        { 0x390001, "CMSG_BEGIN_TRADE", "ClientToServer" },
+        { 0x3A0045, "CMSG_BINDER_ACTIVATE", "ClientToServer" },
+        { 0x3A00CB, "CMSG_BLACK_MARKET_BID_ON_ITEM", "ClientToServer" },
+        { 0x3A00C9, "CMSG_BLACK_MARKET_OPEN", "ClientToServer" },
+        { 0x3A00CA, "CMSG_BLACK_MARKET_REQUEST_ITEMS", "ClientToServer" },
+        { 0x39025B, "CMSG_BONUS_ROLL", "ClientToServer" },
+        { 0x3E00B1, "CMSG_BUG_REPORT", "ClientToServer" },
+        { 0x390002, "CMSG_BUSY_TRADE", "ClientToServer" },
+        { 0x3A0123, "CMSG_BUY_ACCOUNT_BANK_TAB", "ClientToServer" },
+        { 0x3A0037, "CMSG_BUY_BACK_ITEM", "ClientToServer" },
+        { 0x3A0036, "CMSG_BUY_ITEM", "ClientToServer" },
+        { 0x3900A4, "CMSG_CAGE_BATTLE_PET", "ClientToServer" },
+        { 0x3E00A9, "CMSG_CALENDAR_ADD_EVENT", "ClientToServer" },
+        { 0x3E009D, "CMSG_CALENDAR_COMMUNITY_INVITE", "ClientToServer" },
+        { 0x3E00A5, "CMSG_CALENDAR_COMPLAIN", "ClientToServer" },
+        { 0x3E00A4, "CMSG_CALENDAR_COPY_EVENT", "ClientToServer" },
+        { 0x3E00A7, "CMSG_CALENDAR_EVENT_SIGN_UP", "ClientToServer" },
+        { 0x3E009B, "CMSG_CALENDAR_GET", "ClientToServer" },
+        { 0x3E009C, "CMSG_CALENDAR_GET_EVENT", "ClientToServer" },
+        { 0x3E00A6, "CMSG_CALENDAR_GET_NUM_PENDING", "ClientToServer" },
+        { 0x3E009E, "CMSG_CALENDAR_INVITE", "ClientToServer" },
+        { 0x3E00A2, "CMSG_CALENDAR_MODERATOR_STATUS", "ClientToServer" },
+        { 0x3E00A3, "CMSG_CALENDAR_REMOVE_EVENT", "ClientToServer" },
+        { 0x3E009F, "CMSG_CALENDAR_REMOVE_INVITE", "ClientToServer" },
+        { 0x3E00A0, "CMSG_CALENDAR_RSVP", "ClientToServer" },
+        { 0x3E00A1, "CMSG_CALENDAR_STATUS", "ClientToServer" },
+        { 0x3E00AA, "CMSG_CALENDAR_UPDATE_EVENT", "ClientToServer" },
+        { 0x39005A, "CMSG_CANCEL_AURA", "ClientToServer" },
+        { 0x3A007F, "CMSG_CANCEL_AUTO_REPEAT_SPELL", "ClientToServer" },
+        { 0x390178, "CMSG_CANCEL_CAST", "ClientToServer" },
+        { 0x390139, "CMSG_CANCEL_CHANNELLING", "ClientToServer" },
+        { 0x390141, "CMSG_CANCEL_GROWTH_AURA", "ClientToServer" },
+        { 0x3900CD, "CMSG_CANCEL_MASTER_LOOT_ROLL", "ClientToServer" },
+        { 0x390059, "CMSG_CANCEL_MOD_SPEED_NO_CONTROL_AURAS", "ClientToServer" },
+        { 0x390154, "CMSG_CANCEL_MOUNT_AURA", "ClientToServer" },
+        { 0x39002B, "CMSG_CANCEL_QUEUED_SPELL", "ClientToServer" },
+        { 0x3A008A, "CMSG_CANCEL_TEMP_ENCHANTMENT", "ClientToServer" },
+        { 0x390006, "CMSG_CANCEL_TRADE", "ClientToServer" },
+        { 0x3E008E, "CMSG_CAN_DUEL", "ClientToServer" },
+        { 0x3E0134, "CMSG_CAN_REDEEM_TOKEN_FOR_BALANCE", "ClientToServer" },
+        { 0x390175, "CMSG_CAST_SPELL", "ClientToServer" },
+        { 0x2C0002, "CMSG_CHALLENGE_MODE_REQUEST_LEADERS", "ClientToServer" },
+        { 0x390212, "CMSG_CHANGE_BAG_SLOT_FLAG", "ClientToServer" },
+        { 0x390213, "CMSG_CHANGE_BANK_BAG_SLOT_FLAG", "ClientToServer" },
+        { 0x3901F3, "CMSG_CHANGE_MONUMENT_APPEARANCE", "ClientToServer" },
+        { 0x3E0129, "CMSG_CHANGE_REALM_TICKET", "ClientToServer" },
+        { 0x3E0078, "CMSG_CHANGE_SUB_GROUP", "ClientToServer" },
+        { 0x3E00F5, "CMSG_CHARACTER_CHECK_UPGRADE", "ClientToServer" },
+        { 0x3E00F0, "CMSG_CHARACTER_RENAME_REQUEST", "ClientToServer" },
+        { 0x3E00F3, "CMSG_CHARACTER_UPGRADE_MANUAL_UNREVOKE_REQUEST", "ClientToServer" },
+        { 0x3E00F4, "CMSG_CHARACTER_UPGRADE_START", "ClientToServer" },
+        { 0x3E00B9, "CMSG_CHAR_CUSTOMIZE", "ClientToServer" },
+        { 0x3E00CB, "CMSG_CHAR_DELETE", "ClientToServer" },
+        { 0x3E00BF, "CMSG_CHAR_RACE_OR_FACTION_CHANGE", "ClientToServer" },
+        { 0x2B002A, "CMSG_CHAT_ADDON_MESSAGE", "ClientToServer" },
+        { 0x2B002B, "CMSG_CHAT_ADDON_MESSAGE_TARGETED", "ClientToServer" },
+        { 0x2B0032, "CMSG_CHAT_CAN_LOCAL_WHISPER_TARGET_REQUEST", "ClientToServer" },
+        { 0x2B001F, "CMSG_CHAT_CHANNEL_ANNOUNCEMENTS", "ClientToServer" },
+        { 0x2B001D, "CMSG_CHAT_CHANNEL_BAN", "ClientToServer" },
+        { 0x2B0022, "CMSG_CHAT_CHANNEL_DECLINE_INVITE", "ClientToServer" },
+        { 0x2B0012, "CMSG_CHAT_CHANNEL_DISPLAY_LIST", "ClientToServer" },
+        { 0x2B001B, "CMSG_CHAT_CHANNEL_INVITE", "ClientToServer" },
+        { 0x2B001C, "CMSG_CHAT_CHANNEL_KICK", "ClientToServer" },
+        { 0x2B0011, "CMSG_CHAT_CHANNEL_LIST", "ClientToServer" },
+        { 0x2B0016, "CMSG_CHAT_CHANNEL_MODERATE", "ClientToServer" },
+        { 0x2B0017, "CMSG_CHAT_CHANNEL_MODERATOR", "ClientToServer" },
+        { 0x2B0015, "CMSG_CHAT_CHANNEL_OWNER", "ClientToServer" },
+        { 0x2B0013, "CMSG_CHAT_CHANNEL_PASSWORD", "ClientToServer" },
+        { 0x2B0014, "CMSG_CHAT_CHANNEL_SET_OWNER", "ClientToServer" },
+        { 0x2B0020, "CMSG_CHAT_CHANNEL_SILENCE_ALL", "ClientToServer" },
+        { 0x2B001E, "CMSG_CHAT_CHANNEL_UNBAN", "ClientToServer" },
+        { 0x2B0018, "CMSG_CHAT_CHANNEL_UNMODERATOR", "ClientToServer" },
+        { 0x2B0021, "CMSG_CHAT_CHANNEL_UNSILENCE_ALL", "ClientToServer" },
+        { 0x2B000A, "CMSG_CHAT_DROP_CAUTIONARY_CHAT_MESSAGE", "ClientToServer" },
+        { 0x2B0000, "CMSG_CHAT_JOIN_CHANNEL", "ClientToServer" },
+        { 0x2B0001, "CMSG_CHAT_LEAVE_CHANNEL", "ClientToServer" },
+        { 0x2B0031, "CMSG_CHAT_LOBBY_MATCHMAKER_MESSAGE_INSTANCE_CHAT", "ClientToServer" },
+        { 0x2B0030, "CMSG_CHAT_LOBBY_MATCHMAKER_MESSAGE_PARTY", "ClientToServer" },
+        { 0x2B000F, "CMSG_CHAT_MESSAGE_AFK", "ClientToServer" },
+        { 0x2B0007, "CMSG_CHAT_MESSAGE_CHANNEL", "ClientToServer" },
+        { 0x2B0010, "CMSG_CHAT_MESSAGE_DND", "ClientToServer" },
+        { 0x2B0024, "CMSG_CHAT_MESSAGE_EMOTE", "ClientToServer" },
+        { 0x2B000D, "CMSG_CHAT_MESSAGE_GUILD", "ClientToServer" },
+        { 0x2B0028, "CMSG_CHAT_MESSAGE_INSTANCE_CHAT", "ClientToServer" },
+        { 0x2B000E, "CMSG_CHAT_MESSAGE_OFFICER", "ClientToServer" },
+        { 0x2B0026, "CMSG_CHAT_MESSAGE_PARTY", "ClientToServer" },
+        { 0x2B0027, "CMSG_CHAT_MESSAGE_RAID", "ClientToServer" },
+        { 0x2B0029, "CMSG_CHAT_MESSAGE_RAID_WARNING", "ClientToServer" },
+        { 0x2B0023, "CMSG_CHAT_MESSAGE_SAY", "ClientToServer" },
+        { 0x2B0008, "CMSG_CHAT_MESSAGE_WHISPER", "ClientToServer" },
+        { 0x2B0025, "CMSG_CHAT_MESSAGE_YELL", "ClientToServer" },
+        { 0x2B0005, "CMSG_CHAT_REGISTER_ADDON_PREFIXES", "ClientToServer" },
+        { 0x2B0004, "CMSG_CHAT_REPORT_FILTERED", "ClientToServer" },
+        { 0x2B0003, "CMSG_CHAT_REPORT_IGNORED", "ClientToServer" },
+        { 0x2B000B, "CMSG_CHAT_SEND_CAUTIONARY_CHANNEL_MESSAGE", "ClientToServer" },
+        { 0x2B0009, "CMSG_CHAT_SEND_CAUTIONARY_CHAT_MESSAGE", "ClientToServer" },
+        { 0x2B0006, "CMSG_CHAT_UNREGISTER_ALL_ADDON_PREFIXES", "ClientToServer" },
+        { 0x3E0071, "CMSG_CHECK_CHARACTER_NAME_AVAILABILITY", "ClientToServer" },
+        { 0x39010F, "CMSG_CHECK_IS_ADVENTURE_MAP_POI_VALID", "ClientToServer" },
+        { 0x39017D, "CMSG_CHOICE_RESPONSE", "ClientToServer" },
+        { 0x390288, "CMSG_CHROMIE_TIME_SELECT_EXPANSION", "ClientToServer" },
+        { 0x390265, "CMSG_CLAIM_WEEKLY_REWARD", "ClientToServer" },
+        { 0x3902C2, "CMSG_CLASS_TALENTS_DELETE_CONFIG", "ClientToServer" },
+        { 0x3900C4, "CMSG_CLASS_TALENTS_NOTIFY_EMPTY_CONFIG", "ClientToServer" },
+        { 0x3902C4, "CMSG_CLASS_TALENTS_NOTIFY_VALIDATION_FAILED", "ClientToServer" },
+        { 0x3902C1, "CMSG_CLASS_TALENTS_RENAME_CONFIG", "ClientToServer" },
+        { 0x3902C0, "CMSG_CLASS_TALENTS_REQUEST_NEW_CONFIG", "ClientToServer" },
+        { 0x3902C5, "CMSG_CLASS_TALENTS_SET_STARTER_BUILD_ACTIVE", "ClientToServer" },
+        { 0x3900C3, "CMSG_CLASS_TALENTS_SET_USES_SHARED_ACTION_BARS", "ClientToServer" },
+        { 0x290005, "CMSG_CLEAR_NEW_APPEARANCE", "ClientToServer" },
+        { 0x390052, "CMSG_CLEAR_RAID_MARKER", "ClientToServer" },
+        { 0x390008, "CMSG_CLEAR_TRADE_ITEM", "ClientToServer" },
+        { 0x3A00C5, "CMSG_CLIENT_PORT_GRAVEYARD", "ClientToServer" },
+        { 0x3A0025, "CMSG_CLOSE_INTERACTION", "ClientToServer" },
+        { 0x39017E, "CMSG_CLOSE_QUEST_CHOICE", "ClientToServer" },
+        { 0x390290, "CMSG_CLOSE_RUNEFORGE_INTERACTION", "ClientToServer" },
+        { 0x3902C6, "CMSG_CLOSE_TRAIT_SYSTEM_INTERACTION", "ClientToServer" },
+        { 0x3E014C, "CMSG_CLUB_FINDER_APPLICATION_RESPONSE", "ClientToServer" },
+        { 0x3E014A, "CMSG_CLUB_FINDER_GET_APPLICANTS_LIST", "ClientToServer" },
+        { 0x3E0147, "CMSG_CLUB_FINDER_POST", "ClientToServer" },
+        { 0x3E014E, "CMSG_CLUB_FINDER_REQUEST_CLUBS_DATA", "ClientToServer" },
+        { 0x3E0148, "CMSG_CLUB_FINDER_REQUEST_CLUBS_LIST", "ClientToServer" },
+        { 0x3E0149, "CMSG_CLUB_FINDER_REQUEST_MEMBERSHIP_TO_CLUB", "ClientToServer" },
+        { 0x3E014D, "CMSG_CLUB_FINDER_REQUEST_PENDING_CLUBS_LIST", "ClientToServer" },
+        { 0x3E014F, "CMSG_CLUB_FINDER_REQUEST_SUBSCRIBED_CLUB_POSTING_IDS", "ClientToServer" },
+        { 0x3E014B, "CMSG_CLUB_FINDER_RESPOND_TO_APPLICANT", "ClientToServer" },
+        { 0x3E016A, "CMSG_CLUB_FINDER_WHISPER_APPLICANT_REQUEST", "ClientToServer" },
+        { 0x3E0126, "CMSG_CLUB_PRESENCE_SUBSCRIBE", "ClientToServer" },
+        { 0x3E005D, "CMSG_COLLECTION_ITEM_SET_FAVORITE", "ClientToServer" },
+        { 0x3E001C, "CMSG_COMMENTATOR_ENABLE", "ClientToServer" },
+        { 0x3E0020, "CMSG_COMMENTATOR_ENTER_INSTANCE", "ClientToServer" },
+        { 0x3E0021, "CMSG_COMMENTATOR_EXIT_INSTANCE", "ClientToServer" },
+        { 0x3E001D, "CMSG_COMMENTATOR_GET_MAP_INFO", "ClientToServer" },
+        { 0x3E001F, "CMSG_COMMENTATOR_GET_PLAYER_COOLDOWNS", "ClientToServer" },
+        { 0x3E001E, "CMSG_COMMENTATOR_GET_PLAYER_INFO", "ClientToServer" },
+        { 0x3E0168, "CMSG_COMMENTATOR_SPECTATE", "ClientToServer" },
+        { 0x3E001B, "CMSG_COMMENTATOR_START_WARGAME", "ClientToServer" },
+        { 0x3E0114, "CMSG_COMMERCE_TOKEN_GET_COUNT", "ClientToServer" },
+        { 0x3E011E, "CMSG_COMMERCE_TOKEN_GET_LOG", "ClientToServer" },
+        { 0x3E0115, "CMSG_COMMERCE_TOKEN_GET_MARKET_PRICE", "ClientToServer" },
+        { 0x3E0098, "CMSG_COMPLAINT", "ClientToServer" },
+        { 0x3A00E3, "CMSG_COMPLETE_CINEMATIC", "ClientToServer" },
+        { 0x3A0075, "CMSG_COMPLETE_MOVIE", "ClientToServer" },
+        { 0x390057, "CMSG_CONFIRM_ARTIFACT_RESPEC", "ClientToServer" },
+        { 0x3900C7, "CMSG_CONFIRM_PROFESSION_RESPEC", "ClientToServer" },
+        { 0x3900C6, "CMSG_CONFIRM_RESPEC_WIPE", "ClientToServer" },
+        { 0x3E0000, "CMSG_CONNECT_TO_FAILED", "ClientToServer" },
+        { 0x3E0119, "CMSG_CONSUMABLE_TOKEN_BUY", "ClientToServer" },
+        { 0x3E011A, "CMSG_CONSUMABLE_TOKEN_BUY_AT_MARKET_PRICE", "ClientToServer" },
+        { 0x3E0118, "CMSG_CONSUMABLE_TOKEN_CAN_VETERAN_BUY", "ClientToServer" },
+        { 0x3E011C, "CMSG_CONSUMABLE_TOKEN_REDEEM", "ClientToServer" },
+        { 0x3E011D, "CMSG_CONSUMABLE_TOKEN_REDEEM_CONFIRMATION", "ClientToServer" },
+        { 0x3902D5, "CMSG_CONTENT_TRACKING_START_TRACKING", "ClientToServer" },
+        { 0x3902D6, "CMSG_CONTENT_TRACKING_STOP_TRACKING", "ClientToServer" },
+        { 0x3A00FB, "CMSG_CONTRIBUTION_CONTRIBUTE", "ClientToServer" },
+        { 0x3A00FC, "CMSG_CONTRIBUTION_LAST_UPDATE_REQUEST", "ClientToServer" },
+        { 0x3A00E5, "CMSG_CONVERSATION_CINEMATIC_READY", "ClientToServer" },
+        { 0x3A00E4, "CMSG_CONVERSATION_LINE_STARTED", "ClientToServer" },
+        { 0x3902E5, "CMSG_CONVERT_ITEM_TO_BIND_TO_ACCOUNT", "ClientToServer" },
+        { 0x3E007A, "CMSG_CONVERT_RAID", "ClientToServer" },
+        { 0x3E018D, "CMSG_CONVERT_TIMERUNNING_CHARACTER", "ClientToServer" },
+        { 0x3A010F, "CMSG_COVENANT_RENOWN_REQUEST_CATCHUP_STATE", "ClientToServer" },
+        { 0x3A011B, "CMSG_CRAFTING_ORDER_CANCEL", "ClientToServer" },
+        { 0x3A0118, "CMSG_CRAFTING_ORDER_CLAIM", "ClientToServer" },
+        { 0x3A0114, "CMSG_CRAFTING_ORDER_CREATE", "ClientToServer" },
+        { 0x3A011A, "CMSG_CRAFTING_ORDER_FULFILL", "ClientToServer" },
+        { 0x3A0117, "CMSG_CRAFTING_ORDER_GET_NPC_REWARD_INFO", "ClientToServer" },
+        { 0x3A0116, "CMSG_CRAFTING_ORDER_LIST_CRAFTER_ORDERS", "ClientToServer" },
+        { 0x3A0115, "CMSG_CRAFTING_ORDER_LIST_MY_ORDERS", "ClientToServer" },
+        { 0x3A011C, "CMSG_CRAFTING_ORDER_REJECT", "ClientToServer" },
+        { 0x3A0119, "CMSG_CRAFTING_ORDER_RELEASE", "ClientToServer" },
+        { 0x3A011D, "CMSG_CRAFTING_ORDER_REPORT_PLAYER", "ClientToServer" },
+        { 0x3A011E, "CMSG_CRAFTING_ORDER_UPDATE_IGNORE_LIST", "ClientToServer" },
+        { 0x3E0070, "CMSG_CREATE_CHARACTER", "ClientToServer" },
+        { 0x3901DC, "CMSG_CREATE_SHIPMENT", "ClientToServer" },
+        { 0x3E0010, "CMSG_DB_QUERY_BULK", "ClientToServer" },
+        { 0x3A00B7, "CMSG_DECLINE_GUILD_INVITES", "ClientToServer" },
+        { 0x3A012F, "CMSG_DECLINE_NEIGHBORHOOD_INVITES", "ClientToServer" },
+        { 0x3A00D2, "CMSG_DECLINE_PETITION", "ClientToServer" },
+        { 0x3A00A3, "CMSG_DELETE_EQUIPMENT_SET", "ClientToServer" },
+        { 0x3E0101, "CMSG_DEL_FRIEND", "ClientToServer" },
+        { 0x3E0105, "CMSG_DEL_IGNORE", "ClientToServer" },
+        { 0x3A012B, "CMSG_DELVE_TELEPORT_OUT", "ClientToServer" },
+        { 0x39016B, "CMSG_DESTROY_ITEM", "ClientToServer" },
+        { 0x3E0044, "CMSG_DF_BOOT_PLAYER_VOTE", "ClientToServer" },
+        { 0x3E0036, "CMSG_DF_CONFIRM_EXPAND_SEARCH", "ClientToServer" },
+        { 0x3E0042, "CMSG_DF_GET_JOIN_STATUS", "ClientToServer" },
+        { 0x3E0041, "CMSG_DF_GET_SYSTEM_INFO", "ClientToServer" },
+        { 0x3E0037, "CMSG_DF_JOIN", "ClientToServer" },
+        { 0x3E0040, "CMSG_DF_LEAVE", "ClientToServer" },
+        { 0x3E0035, "CMSG_DF_PROPOSAL_RESPONSE", "ClientToServer" },
+        { 0x3E0048, "CMSG_DF_READY_CHECK_RESPONSE", "ClientToServer" },
+        { 0x3E0043, "CMSG_DF_SET_ROLES", "ClientToServer" },
+        { 0x3E0045, "CMSG_DF_TELEPORT", "ClientToServer" },
+        { 0x3C005E, "CMSG_DISCARDED_TIME_SYNC_ACKS", "ClientToServer" },
+        { 0x3A0091, "CMSG_DISMISS_CRITTER", "ClientToServer" },
+        { 0x3E0146, "CMSG_DO_COUNTDOWN", "ClientToServer" },
+        { 0x3900CC, "CMSG_DO_MASTER_LOOT_ROLL", "ClientToServer" },
+        { 0x3E005E, "CMSG_DO_READY_CHECK", "ClientToServer" },
+        { 0x3A007A, "CMSG_DUEL_RESPONSE", "ClientToServer" },
+        { 0x390104, "CMSG_EJECT_PASSENGER", "ClientToServer" },
+        { 0x3A00DF, "CMSG_EMOTE", "ClientToServer" },
+        { 0x3F0009, "CMSG_ENABLE_NAGLE", "ClientToServer" },
+        { 0x3A003C, "CMSG_ENABLE_TAXI_NODE", "ClientToServer" },
+        { 0x3902FE, "CMSG_ENCOUNTER_JOURNAL_START_ARATHI_RPE", "ClientToServer" },
+        { 0x3E0113, "CMSG_ENGINE_SURVEY", "ClientToServer" },
+        { 0x3F0005, "CMSG_ENTER_ENCRYPTED_MODE_ACK", "ClientToServer" },
+        { 0x3E0014, "CMSG_ENUM_CHARACTERS", "ClientToServer" },
+        { 0x3E010D, "CMSG_ENUM_CHARACTERS_DELETED_BY_CLIENT", "ClientToServer" },
+        { 0x3A0080, "CMSG_FAR_SIGHT", "ClientToServer" },
+        { 0x39005E, "CMSG_GAME_EVENT_DEBUG_DISABLE", "ClientToServer" },
+        { 0x39005D, "CMSG_GAME_EVENT_DEBUG_ENABLE", "ClientToServer" },
+        { 0x3A0087, "CMSG_GAME_OBJ_REPORT_USE", "ClientToServer" },
+        { 0x3A0086, "CMSG_GAME_OBJ_USE", "ClientToServer" },
+        { 0x3901D7, "CMSG_GARRISON_ADD_FOLLOWER_HEALTH", "ClientToServer" },
+        { 0x3901BD, "CMSG_GARRISON_ASSIGN_FOLLOWER_TO_BUILDING", "ClientToServer" },
+        { 0x3901AA, "CMSG_GARRISON_CANCEL_CONSTRUCTION", "ClientToServer" },
+        { 0x39020E, "CMSG_GARRISON_CHECK_UPGRADEABLE", "ClientToServer" },
+        { 0x390200, "CMSG_GARRISON_COMPLETE_MISSION", "ClientToServer" },
+        { 0x3901D8, "CMSG_GARRISON_FULLY_HEAL_ALL_FOLLOWERS", "ClientToServer" },
+        { 0x3901C0, "CMSG_GARRISON_GENERATE_RECRUITS", "ClientToServer" },
+        { 0x3901CF, "CMSG_GARRISON_GET_CLASS_SPEC_CATEGORY_INFO", "ClientToServer" },
+        { 0x3901D6, "CMSG_GARRISON_GET_MAP_DATA", "ClientToServer" },
+        { 0x390230, "CMSG_GARRISON_GET_MISSION_REWARD", "ClientToServer" },
+        { 0x3901CB, "CMSG_GARRISON_LEARN_TALENT", "ClientToServer" },
+        { 0x390202, "CMSG_GARRISON_MISSION_BONUS_ROLL", "ClientToServer" },
+        { 0x3901A6, "CMSG_GARRISON_PURCHASE_BUILDING", "ClientToServer" },
+        { 0x3901C2, "CMSG_GARRISON_RECRUIT_FOLLOWER", "ClientToServer" },
+        { 0x3901F7, "CMSG_GARRISON_REMOVE_FOLLOWER", "ClientToServer" },
+        { 0x3901BE, "CMSG_GARRISON_REMOVE_FOLLOWER_FROM_BUILDING", "ClientToServer" },
+        { 0x3901BF, "CMSG_GARRISON_RENAME_FOLLOWER", "ClientToServer" },
+        { 0x3901A5, "CMSG_GARRISON_REQUEST_BLUEPRINT_AND_SPECIALIZATION_DATA", "ClientToServer" },
+        { 0x3901DA, "CMSG_GARRISON_REQUEST_SHIPMENT_INFO", "ClientToServer" },
+        { 0x3901C3, "CMSG_GARRISON_RESEARCH_TALENT", "ClientToServer" },
+        { 0x3901A7, "CMSG_GARRISON_SET_BUILDING_ACTIVE", "ClientToServer" },
+        { 0x3901BB, "CMSG_GARRISON_SET_FOLLOWER_FAVORITE", "ClientToServer" },
+        { 0x3901B3, "CMSG_GARRISON_SET_FOLLOWER_INACTIVE", "ClientToServer" },
+        { 0x3901C1, "CMSG_GARRISON_SET_RECRUITMENT_PREFERENCES", "ClientToServer" },
+        { 0x39029D, "CMSG_GARRISON_SOCKET_TALENT", "ClientToServer" },
+        { 0x3901FF, "CMSG_GARRISON_START_MISSION", "ClientToServer" },
+        { 0x3901AB, "CMSG_GARRISON_SWAP_BUILDINGS", "ClientToServer" },
+        { 0x3E0013, "CMSG_GENERATE_RANDOM_CHARACTER_NAME", "ClientToServer" },
+        { 0x3E00E4, "CMSG_GET_ACCOUNT_CHARACTER_LIST", "ClientToServer" },
+        { 0x3E0162, "CMSG_GET_ACCOUNT_NOTIFICATIONS", "ClientToServer" },
+        { 0x3901A0, "CMSG_GET_GARRISON_INFO", "ClientToServer" },
+        { 0x3A00CD, "CMSG_GET_ITEM_PURCHASE_DATA", "ClientToServer" },
+        { 0x3901DB, "CMSG_GET_LANDING_PAGE_SHIPMENTS", "ClientToServer" },
+        { 0x39016F, "CMSG_GET_MIRROR_IMAGE_DATA", "ClientToServer" },
+        { 0x3E001A, "CMSG_GET_PVP_OPTIONS_ENABLED", "ClientToServer" },
+        { 0x3E0150, "CMSG_GET_RAF_ACCOUNT_INFO", "ClientToServer" },
+        { 0x3E0193, "CMSG_GET_REGIONWIDE_CHARACTER_RESTRICTION_AND_MAIL_DATA", "ClientToServer" },
+        { 0x3E011B, "CMSG_GET_REMAINING_GAME_TIME", "ClientToServer" },
+        { 0x3901F0, "CMSG_GET_TROPHY_LIST", "ClientToServer" },
+        { 0x3E010F, "CMSG_GET_UNDELETE_CHARACTER_COOLDOWN_STATUS", "ClientToServer" },
+        { 0x3E0120, "CMSG_GET_VAS_ACCOUNT_CHARACTER_LIST", "ClientToServer" },
+        { 0x3E0121, "CMSG_GET_VAS_TRANSFER_TARGET_REALM_LIST", "ClientToServer" },
+        { 0x3E00BD, "CMSG_GM_TICKET_ACKNOWLEDGE_SURVEY", "ClientToServer" },
+        { 0x3E00BC, "CMSG_GM_TICKET_GET_CASE_STATUS", "ClientToServer" },
+        { 0x3E00BB, "CMSG_GM_TICKET_GET_SYSTEM_STATUS", "ClientToServer" },
+        { 0x3A010E, "CMSG_GOSSIP_REFRESH_OPTIONS", "ClientToServer" },
+        { 0x3A0026, "CMSG_GOSSIP_SELECT_OPTION", "ClientToServer" },
+        { 0x2D0020, "CMSG_GUILD_ADD_BATTLENET_FRIEND", "ClientToServer" },
+        { 0x2D0005, "CMSG_GUILD_ADD_RANK", "ClientToServer" },
+        { 0x2D0002, "CMSG_GUILD_ASSIGN_MEMBER_RANK", "ClientToServer" },
+        { 0x3A0047, "CMSG_GUILD_BANK_ACTIVATE", "ClientToServer" },
+        { 0x3A0055, "CMSG_GUILD_BANK_BUY_TAB", "ClientToServer" },
+        { 0x3A0057, "CMSG_GUILD_BANK_DEPOSIT_MONEY", "ClientToServer" },
+        { 0x2D0019, "CMSG_GUILD_BANK_LOG_QUERY", "ClientToServer" },
+        { 0x3A0054, "CMSG_GUILD_BANK_QUERY_TAB", "ClientToServer" },
+        { 0x2D001A, "CMSG_GUILD_BANK_REMAINING_WITHDRAW_MONEY_QUERY", "ClientToServer" },
+        { 0x2D001D, "CMSG_GUILD_BANK_SET_TAB_TEXT", "ClientToServer" },
+        { 0x2D001E, "CMSG_GUILD_BANK_TEXT_QUERY", "ClientToServer" },
+        { 0x3A0056, "CMSG_GUILD_BANK_UPDATE_TAB", "ClientToServer" },
+        { 0x3A0058, "CMSG_GUILD_BANK_WITHDRAW_MONEY", "ClientToServer" },
+        { 0x2D0017, "CMSG_GUILD_CHALLENGE_UPDATE_REQUEST", "ClientToServer" },
+        { 0x2D0018, "CMSG_GUILD_CHANGE_NAME_REQUEST", "ClientToServer" },
+        { 0x3E002A, "CMSG_GUILD_DECLINE_INVITATION", "ClientToServer" },
+        { 0x2D0009, "CMSG_GUILD_DELETE", "ClientToServer" },
+        { 0x2D0006, "CMSG_GUILD_DELETE_RANK", "ClientToServer" },
+        { 0x2D0001, "CMSG_GUILD_DEMOTE_MEMBER", "ClientToServer" },
+        { 0x2D001C, "CMSG_GUILD_EVENT_LOG_QUERY", "ClientToServer" },
+        { 0x2D0012, "CMSG_GUILD_GET_ACHIEVEMENT_MEMBERS", "ClientToServer" },
+        { 0x2D0026, "CMSG_GUILD_GET_OTHERS_OWNED_HOUSES", "ClientToServer" },
+        { 0x2D000E, "CMSG_GUILD_GET_RANKS", "ClientToServer" },
+        { 0x2D0014, "CMSG_GUILD_GET_ROSTER", "ClientToServer" },
+        { 0x3E0034, "CMSG_GUILD_INVITE_BY_NAME", "ClientToServer" },
+        { 0x2D0003, "CMSG_GUILD_LEAVE", "ClientToServer" },
+        { 0x2D000F, "CMSG_GUILD_NEWS_UPDATE_STICKY", "ClientToServer" },
+        { 0x2D0004, "CMSG_GUILD_OFFICER_REMOVE_MEMBER", "ClientToServer" },
+        { 0x2D001B, "CMSG_GUILD_PERMISSIONS_QUERY", "ClientToServer" },
+        { 0x2D0000, "CMSG_GUILD_PROMOTE_MEMBER", "ClientToServer" },
+        { 0x2D000A, "CMSG_GUILD_QUERY_MEMBER_RECIPES", "ClientToServer" },
+        { 0x2D000C, "CMSG_GUILD_QUERY_MEMBERS_FOR_RECIPE", "ClientToServer" },
+        { 0x2D000D, "CMSG_GUILD_QUERY_NEWS", "ClientToServer" },
+        { 0x2D000B, "CMSG_GUILD_QUERY_RECIPES", "ClientToServer" },
+        { 0x2D001F, "CMSG_GUILD_REPLACE_GUILD_MASTER", "ClientToServer" },
+        { 0x2D0023, "CMSG_GUILD_REQUEST_RENAME", "ClientToServer" },
+        { 0x2D0022, "CMSG_GUILD_REQUEST_RENAME_NAME_CHECK", "ClientToServer" },
+        { 0x2D0024, "CMSG_GUILD_REQUEST_RENAME_REFUND", "ClientToServer" },
+        { 0x2D0021, "CMSG_GUILD_REQUEST_RENAME_STATUS", "ClientToServer" },
+        { 0x2D0010, "CMSG_GUILD_SET_ACHIEVEMENT_TRACKING", "ClientToServer" },
+        { 0x2D0011, "CMSG_GUILD_SET_FOCUSED_ACHIEVEMENT", "ClientToServer" },
+        { 0x3E00F7, "CMSG_GUILD_SET_GUILD_MASTER", "ClientToServer" },
+        { 0x2D0013, "CMSG_GUILD_SET_MEMBER_NOTE", "ClientToServer" },
+        { 0x2D0008, "CMSG_GUILD_SET_RANK_PERMISSIONS", "ClientToServer" },
+        { 0x2D0007, "CMSG_GUILD_SHIFT_RANK", "ClientToServer" },
+        { 0x2D0016, "CMSG_GUILD_UPDATE_INFO_TEXT", "ClientToServer" },
+        { 0x2D0015, "CMSG_GUILD_UPDATE_MOTD_TEXT", "ClientToServer" },
+        { 0x3A009F, "CMSG_HEARTH_AND_RESURRECT", "ClientToServer" },
+        { 0x39017F, "CMSG_HIDE_QUEST_CHOICE", "ClientToServer" },
+        { 0x3E0011, "CMSG_HOTFIX_REQUEST", "ClientToServer" },
+        { 0x2E0001, "CMSG_HOUSE_EXTERIOR_SET_HOUSE_POSITION", "ClientToServer" },
+        { 0x2F0001, "CMSG_HOUSE_INTERIOR_LEAVE_HOUSE", "ClientToServer" },
+        { 0x300009, "CMSG_HOUSING_DECOR_DELETE_FROM_STORAGE", "ClientToServer" },
+        { 0x30000A, "CMSG_HOUSING_DECOR_DELETE_FROM_STORAGE_BY_ID", "ClientToServer" },
+        { 0x300004, "CMSG_HOUSING_DECOR_LOCK", "ClientToServer" },
+        { 0x300002, "CMSG_HOUSING_DECOR_MOVE", "ClientToServer" },
+        { 0x300001, "CMSG_HOUSING_DECOR_PLACE", "ClientToServer" },
+        { 0x300010, "CMSG_HOUSING_DECOR_REDEEM_DEFERRED_DECOR", "ClientToServer" },
+        { 0x300003, "CMSG_HOUSING_DECOR_REMOVE", "ClientToServer" },
+        { 0x30000E, "CMSG_HOUSING_DECOR_REQUEST_STORAGE", "ClientToServer" },
+        { 0x300006, "CMSG_HOUSING_DECOR_SET_DYE_SLOTS", "ClientToServer" },
+        { 0x300000, "CMSG_HOUSING_DECOR_SET_EDIT_MODE", "ClientToServer" },
+        { 0x310006, "CMSG_HOUSING_FIXTURE_CREATE_FIXTURE", "ClientToServer" },
+        { 0x310007, "CMSG_HOUSING_FIXTURE_DELETE_FIXTURE", "ClientToServer" },
+        { 0x310005, "CMSG_HOUSING_FIXTURE_SET_CORE_FIXTURE", "ClientToServer" },
+        { 0x310000, "CMSG_HOUSING_FIXTURE_SET_EDIT_MODE", "ClientToServer" },
+        { 0x350006, "CMSG_HOUSING_GET_CURRENT_HOUSE_INFO", "ClientToServer" },
+        { 0x350008, "CMSG_HOUSING_RESET_KIOSK_MODE", "ClientToServer" },
+        { 0x320001, "CMSG_HOUSING_ROOM_ADD", "ClientToServer" },
+        { 0x320006, "CMSG_HOUSING_ROOM_APPLY_COMPONENT_MATERIALS", "ClientToServer" },
+        { 0x320004, "CMSG_HOUSING_ROOM_MOVE", "ClientToServer" },
+        { 0x320002, "CMSG_HOUSING_ROOM_REMOVE", "ClientToServer" },
+        { 0x320003, "CMSG_HOUSING_ROOM_ROTATE", "ClientToServer" },
+        { 0x320008, "CMSG_HOUSING_ROOM_SET_CEILING_TYPE", "ClientToServer" },
+        { 0x320005, "CMSG_HOUSING_ROOM_SET_COMPONENT_THEME", "ClientToServer" },
+        { 0x320007, "CMSG_HOUSING_ROOM_SET_DOOR_TYPE", "ClientToServer" },
+        { 0x320000, "CMSG_HOUSING_ROOM_SET_LAYOUT_EDIT_MODE", "ClientToServer" },
+        { 0x33001C, "CMSG_HOUSING_SVCS_ACCEPT_NEIGHBORHOOD_OWNERSHIP", "ClientToServer" },
+        { 0x330024, "CMSG_HOUSING_SVCS_DELETE_ALL_NEIGHBORHOOD_INVITES", "ClientToServer" },
+        { 0x330022, "CMSG_HOUSING_SVCS_GET_BNET_FRIEND_NEIGHBORHOODS", "ClientToServer" },
+        { 0x330020, "CMSG_HOUSING_SVCS_GET_HOUSE_FINDER_INFO", "ClientToServer" },
+        { 0x330021, "CMSG_HOUSING_SVCS_GET_HOUSE_FINDER_NEIGHBORHOOD", "ClientToServer" },
+        { 0x330011, "CMSG_HOUSING_SVCS_GET_PLAYER_HOUSES_INFO", "ClientToServer" },
+        { 0x33001F, "CMSG_HOUSING_SVCS_GET_POTENTIAL_HOUSE_OWNERS", "ClientToServer" },
+        { 0x330001, "CMSG_HOUSING_SVCS_GUILD_CREATE_NEIGHBORHOOD", "ClientToServer" },
+        { 0x330006, "CMSG_HOUSING_SVCS_NEIGHBORHOOD_RESERVE_PLOT", "ClientToServer" },
+        { 0x33000F, "CMSG_HOUSING_SVCS_PLAYER_VIEW_HOUSES_BY_BNET_ACCOUNT", "ClientToServer" },
+        { 0x33000E, "CMSG_HOUSING_SVCS_PLAYER_VIEW_HOUSES_BY_PLAYER", "ClientToServer" },
+        { 0x33001D, "CMSG_HOUSING_SVCS_REJECT_NEIGHBORHOOD_OWNERSHIP", "ClientToServer" },
+        { 0x330009, "CMSG_HOUSING_SVCS_RELINQUISH_HOUSE", "ClientToServer" },
+        { 0x330018, "CMSG_HOUSING_SVCS_START_TUTORIAL", "ClientToServer" },
+        { 0x330017, "CMSG_HOUSING_SVCS_TELEPORT_TO_PLOT", "ClientToServer" },
+        { 0x33000A, "CMSG_HOUSING_SVCS_UPDATE_HOUSE_SETTINGS", "ClientToServer" },
+        { 0x390003, "CMSG_IGNORE_TRADE", "ClientToServer" },
+        { 0x3E0006, "CMSG_INITIATE_ROLE_POLL", "ClientToServer" },
+        { 0x390000, "CMSG_INITIATE_TRADE", "ClientToServer" },
+        { 0x3A00C7, "CMSG_INSPECT", "ClientToServer" },
+        { 0x3E0061, "CMSG_INSTANCE_ABANDON_VOTE_RESPONSE", "ClientToServer" },
+        { 0x3A00A4, "CMSG_INSTANCE_LOCK_RESPONSE", "ClientToServer" },
+        { 0x3E019B, "CMSG_INVITE_PLAYER_TO_NEIGHBORHOOD", "ClientToServer" },
+        { 0x390261, "CMSG_ISLAND_QUEUE", "ClientToServer" },
+        { 0x3A00CE, "CMSG_ITEM_PURCHASE_REFUND", "ClientToServer" },
+        { 0x39020F, "CMSG_ITEM_TEXT_QUERY", "ClientToServer" },
+        { 0x39008E, "CMSG_JOIN_PET_BATTLE_QUEUE", "ClientToServer" },
+        { 0x390025, "CMSG_JOIN_RATED_BATTLEGROUND", "ClientToServer" },
+        { 0x3E00AB, "CMSG_KEEP_ALIVE", "ClientToServer" },
+        { 0x3900E2, "CMSG_KEYBOUND_OVERRIDE", "ClientToServer" },
+        { 0x390098, "CMSG_KIOSK_ENABLE_GOD_MODE", "ClientToServer" },
+        { 0x3F000F, "CMSG_LATENCY_REPORT", "ClientToServer" },
+        { 0x3A00FA, "CMSG_LEARN_PVP_TALENTS", "ClientToServer" },
+        { 0x3A00F8, "CMSG_LEARN_TALENTS", "ClientToServer" },
+        { 0x3E0075, "CMSG_LEAVE_GROUP", "ClientToServer" },
+        { 0x39008F, "CMSG_LEAVE_PET_BATTLE_QUEUE", "ClientToServer" },
+        { 0x3E003B, "CMSG_LFG_LIST_APPLY_TO_GROUP", "ClientToServer" },
+        { 0x3E003C, "CMSG_LFG_LIST_CANCEL_APPLICATION", "ClientToServer" },
+        { 0x3E003D, "CMSG_LFG_LIST_DECLINE_APPLICANT", "ClientToServer" },
+        { 0x3E0039, "CMSG_LFG_LIST_GET_STATUS", "ClientToServer" },
+        { 0x3E003E, "CMSG_LFG_LIST_INVITE_APPLICANT", "ClientToServer" },
+        { 0x3E003F, "CMSG_LFG_LIST_INVITE_RESPONSE", "ClientToServer" },
+        { 0x390255, "CMSG_LFG_LIST_JOIN", "ClientToServer" },
+        { 0x3E0038, "CMSG_LFG_LIST_LEAVE", "ClientToServer" },
+        { 0x3E003A, "CMSG_LFG_LIST_SEARCH", "ClientToServer" },
+        { 0x390256, "CMSG_LFG_LIST_UPDATE_REQUEST", "ClientToServer" },
+        { 0x3A0033, "CMSG_LIST_INVENTORY", "ClientToServer" },
+        { 0x3E00E7, "CMSG_LIVE_REGION_ACCOUNT_RESTORE", "ClientToServer" },
+        { 0x3E00E6, "CMSG_LIVE_REGION_CHARACTER_COPY", "ClientToServer" },
+        { 0x3E00E5, "CMSG_LIVE_REGION_GET_ACCOUNT_CHARACTER_LIST", "ClientToServer" },
+        { 0x3E00E8, "CMSG_LIVE_REGION_KEY_BINDINGS_COPY", "ClientToServer" },
+        { 0x3E0024, "CMSG_LOADING_SCREEN_NOTIFY", "ClientToServer" },
+        { 0x3901F1, "CMSG_LOAD_SELECTED_TROPHY", "ClientToServer" },
+        { 0x3E0175, "CMSG_LOBBY_MATCHMAKER_ABANDON_QUEUE", "ClientToServer" },
+        { 0x3E016C, "CMSG_LOBBY_MATCHMAKER_ACCEPT_PARTY_INVITE", "ClientToServer" },
+        { 0x3E017E, "CMSG_LOBBY_MATCHMAKER_CREATE_CHARACTER", "ClientToServer" },
+        { 0x3E0173, "CMSG_LOBBY_MATCHMAKER_ENTER_QUEUE", "ClientToServer" },
+        { 0x3E016F, "CMSG_LOBBY_MATCHMAKER_LEAVE_PARTY", "ClientToServer" },
+        { 0x3E016B, "CMSG_LOBBY_MATCHMAKER_PARTY_INVITE", "ClientToServer" },
+        { 0x3E016E, "CMSG_LOBBY_MATCHMAKER_PARTY_UNINVITE", "ClientToServer" },
+        { 0x3E0174, "CMSG_LOBBY_MATCHMAKER_QUEUE_PROPSAL_RESPONSE", "ClientToServer" },
+        { 0x3E016D, "CMSG_LOBBY_MATCHMAKER_REJECT_PARTY_INVITE", "ClientToServer" },
+        { 0x3E0170, "CMSG_LOBBY_MATCHMAKER_SET_PARTY_PLAYLIST_ENTRY", "ClientToServer" },
+        { 0x3E0171, "CMSG_LOBBY_MATCHMAKER_SET_PLAYER_READY", "ClientToServer" },
+        { 0x3F0007, "CMSG_LOG_DISCONNECT", "ClientToServer" },
+        { 0x3A0070, "CMSG_LOGOUT_CANCEL", "ClientToServer" },
+        { 0x3A0071, "CMSG_LOGOUT_INSTANT", "ClientToServer" },
+        { 0x3A0122, "CMSG_LOGOUT_LOBBY_MATCHMAKER", "ClientToServer" },
+        { 0x3A006F, "CMSG_LOGOUT_REQUEST", "ClientToServer" },
+        { 0x3F000B, "CMSG_LOG_STREAMING_ERROR", "ClientToServer" },
+        { 0x3900CA, "CMSG_LOOT_ITEM", "ClientToServer" },
+        { 0x3900C9, "CMSG_LOOT_MONEY", "ClientToServer" },
+        { 0x3900CE, "CMSG_LOOT_RELEASE", "ClientToServer" },
+        { 0x3900CF, "CMSG_LOOT_ROLL", "ClientToServer" },
+        { 0x3900C8, "CMSG_LOOT_UNIT", "ClientToServer" },
+        { 0x3E00CF, "CMSG_LOW_LEVEL_RAID1", "ClientToServer" },
+        { 0x3A00AB, "CMSG_LOW_LEVEL_RAID2", "ClientToServer" },
+        { 0x3A00D9, "CMSG_MAIL_CREATE_TEXT_ITEM", "ClientToServer" },
+        { 0x3900E4, "CMSG_MAIL_DELETE", "ClientToServer" },
+        { 0x3A00D4, "CMSG_MAIL_GET_LIST", "ClientToServer" },
+        { 0x3A00D8, "CMSG_MAIL_MARK_AS_READ", "ClientToServer" },
+        { 0x3E0081, "CMSG_MAIL_RETURN_TO_SENDER", "ClientToServer" },
+        { 0x3A00D6, "CMSG_MAIL_TAKE_ITEM", "ClientToServer" },
+        { 0x3A00D5, "CMSG_MAIL_TAKE_MONEY", "ClientToServer" },
+        { 0x3900E5, "CMSG_MAKE_CONTITIONAL_APPEARANCE_PERMANENT", "ClientToServer" },
+        { 0x3900CB, "CMSG_MASTER_LOOT_ITEM", "ClientToServer" },
+        { 0x3A0052, "CMSG_MERGE_GUILD_BANK_ITEM_WITH_GUILD_BANK_ITEM", "ClientToServer" },
+        { 0x3A004F, "CMSG_MERGE_GUILD_BANK_ITEM_WITH_ITEM", "ClientToServer" },
+        { 0x3A004D, "CMSG_MERGE_ITEM_WITH_GUILD_BANK_ITEM", "ClientToServer" },
+        { 0x3F0011, "CMSG_MESSAGE_WHISPER", "ClientToServer" },
+        { 0x3E0077, "CMSG_MINIMAP_PING", "ClientToServer" },
+        { 0x390036, "CMSG_MISSILE_TRAJECTORY_COLLISION", "ClientToServer" },
+        { 0x290003, "CMSG_MOUNT_CLEAR_FANFARE", "ClientToServer" },
+        { 0x3E005C, "CMSG_MOUNT_SET_FAVORITE", "ClientToServer" },
+        { 0x390155, "CMSG_MOUNT_SPECIAL_ANIM", "ClientToServer" },
+        { 0x3C006D, "CMSG_MOVE_ADD_IMPULSE_ACK", "ClientToServer" },
+        { 0x3C006B, "CMSG_MOVE_APPLY_INERTIA_ACK", "ClientToServer" },
+        { 0x3C0031, "CMSG_MOVE_APPLY_MOVEMENT_FORCE_ACK", "ClientToServer" },
+        { 0x3C004C, "CMSG_MOVE_CHANGE_TRANSPORT", "ClientToServer" },
+        { 0x3C0051, "CMSG_MOVE_CHANGE_VEHICLE_SEATS", "ClientToServer" },
+        { 0x3C0056, "CMSG_MOVE_COLLISION_DISABLE_ACK", "ClientToServer" },
+        { 0x3C0057, "CMSG_MOVE_COLLISION_ENABLE_ACK", "ClientToServer" },
+        { 0x3C0050, "CMSG_MOVE_DISMISS_VEHICLE", "ClientToServer" },
+        { 0x3C0007, "CMSG_MOVE_DOUBLE_JUMP", "ClientToServer" },
+        { 0x3C003A, "CMSG_MOVE_ENABLE_DOUBLE_JUMP_ACK", "ClientToServer" },
+        { 0x3C0083, "CMSG_MOVE_ENABLE_FULL_SPEED_TURNING_ACK", "ClientToServer" },
+        { 0x3C0040, "CMSG_MOVE_ENABLE_SWIM_TO_FLY_TRANS_ACK", "ClientToServer" },
+        { 0x3C0017, "CMSG_MOVE_FALL_LAND", "ClientToServer" },
+        { 0x3C0035, "CMSG_MOVE_FALL_RESET", "ClientToServer" },
+        { 0x3C0038, "CMSG_MOVE_FEATHER_FALL_ACK", "ClientToServer" },
+        { 0x3C004B, "CMSG_MOVE_FORCE_FLIGHT_BACK_SPEED_CHANGE_ACK", "ClientToServer" },
+        { 0x3C004A, "CMSG_MOVE_FORCE_FLIGHT_SPEED_CHANGE_ACK", "ClientToServer" },
+        { 0x3C004F, "CMSG_MOVE_FORCE_PITCH_RATE_CHANGE_ACK", "ClientToServer" },
+        { 0x3C002A, "CMSG_MOVE_FORCE_ROOT_ACK", "ClientToServer" },
+        { 0x3C0028, "CMSG_MOVE_FORCE_RUN_BACK_SPEED_CHANGE_ACK", "ClientToServer" },
+        { 0x3C0027, "CMSG_MOVE_FORCE_RUN_SPEED_CHANGE_ACK", "ClientToServer" },
+        { 0x3C003E, "CMSG_MOVE_FORCE_SWIM_BACK_SPEED_CHANGE_ACK", "ClientToServer" },
+        { 0x3C0029, "CMSG_MOVE_FORCE_SWIM_SPEED_CHANGE_ACK", "ClientToServer" },
+        { 0x3C003F, "CMSG_MOVE_FORCE_TURN_RATE_CHANGE_ACK", "ClientToServer" },
+        { 0x3C002B, "CMSG_MOVE_FORCE_UNROOT_ACK", "ClientToServer" },
+        { 0x3C003D, "CMSG_MOVE_FORCE_WALK_SPEED_CHANGE_ACK", "ClientToServer" },
+        { 0x3C0052, "CMSG_MOVE_GRAVITY_DISABLE_ACK", "ClientToServer" },
+        { 0x3C0053, "CMSG_MOVE_GRAVITY_ENABLE_ACK", "ClientToServer" },
+        { 0x3A004C, "CMSG_MOVE_GUILD_BANK_ITEM", "ClientToServer" },
+        { 0x3C002C, "CMSG_MOVE_HEARTBEAT", "ClientToServer" },
+        { 0x3C002F, "CMSG_MOVE_HOVER_ACK", "ClientToServer" },
+        { 0x3C0054, "CMSG_MOVE_INERTIA_DISABLE_ACK", "ClientToServer" },
+        { 0x3C0055, "CMSG_MOVE_INERTIA_ENABLE_ACK", "ClientToServer" },
+        { 0x3C0063, "CMSG_MOVE_INIT_ACTIVE_MOVER_COMPLETE", "ClientToServer" },
+        { 0x3C0006, "CMSG_MOVE_JUMP", "ClientToServer" },
+        { 0x3C002E, "CMSG_MOVE_KNOCK_BACK_ACK", "ClientToServer" },
+        { 0x3C006C, "CMSG_MOVE_REMOVE_INERTIA_ACK", "ClientToServer" },
+        { 0x3C0032, "CMSG_MOVE_REMOVE_MOVEMENT_FORCE_ACK", "ClientToServer" },
+        { 0x3C0033, "CMSG_MOVE_REMOVE_MOVEMENT_FORCES", "ClientToServer" },
+        { 0x3C006F, "CMSG_MOVE_SET_ADV_FLY", "ClientToServer" },
+        { 0x3C0077, "CMSG_MOVE_SET_ADV_FLYING_ADD_IMPULSE_MAX_SPEED_ACK", "ClientToServer" },
+        { 0x3C0072, "CMSG_MOVE_SET_ADV_FLYING_AIR_FRICTION_ACK", "ClientToServer" },
+        { 0x3C0078, "CMSG_MOVE_SET_ADV_FLYING_BANKING_RATE_ACK", "ClientToServer" },
+        { 0x3C0075, "CMSG_MOVE_SET_ADV_FLYING_DOUBLE_JUMP_VEL_MOD_ACK", "ClientToServer" },
+        { 0x3C0076, "CMSG_MOVE_SET_ADV_FLYING_GLIDE_START_MIN_HEIGHT_ACK", "ClientToServer" },
+        { 0x3C007F, "CMSG_MOVE_SET_ADV_FLYING_LAUNCH_SPEED_COEFFICIENT_ACK", "ClientToServer" },
+        { 0x3C0074, "CMSG_MOVE_SET_ADV_FLYING_LIFT_COEFFICIENT_ACK", "ClientToServer" },
+        { 0x3C0073, "CMSG_MOVE_SET_ADV_FLYING_MAX_VEL_ACK", "ClientToServer" },
+        { 0x3C007D, "CMSG_MOVE_SET_ADV_FLYING_OVER_MAX_DECELERATION_ACK", "ClientToServer" },
+        { 0x3C0079, "CMSG_MOVE_SET_ADV_FLYING_PITCHING_RATE_DOWN_ACK", "ClientToServer" },
+        { 0x3C007A, "CMSG_MOVE_SET_ADV_FLYING_PITCHING_RATE_UP_ACK", "ClientToServer" },
+        { 0x3C007C, "CMSG_MOVE_SET_ADV_FLYING_SURFACE_FRICTION_ACK", "ClientToServer" },
+        { 0x3C007B, "CMSG_MOVE_SET_ADV_FLYING_TURN_VELOCITY_THRESHOLD_ACK", "ClientToServer" },
+        { 0x3C006E, "CMSG_MOVE_SET_CAN_ADV_FLY_ACK", "ClientToServer" },
+        { 0x3C0070, "CMSG_MOVE_SET_CAN_DRIVE_ACK", "ClientToServer" },
+        { 0x3C0043, "CMSG_MOVE_SET_CAN_FLY_ACK", "ClientToServer" },
+        { 0x3C0041, "CMSG_MOVE_SET_CAN_TURN_WHILE_FALLING_ACK", "ClientToServer" },
+        { 0x3C0058, "CMSG_MOVE_SET_COLLISION_HEIGHT_ACK", "ClientToServer" },
+        { 0x3C0025, "CMSG_MOVE_SET_FACING", "ClientToServer" },
+        { 0x3C007E, "CMSG_MOVE_SET_FACING_HEARTBEAT", "ClientToServer" },
+        { 0x3C0045, "CMSG_MOVE_SET_FLY", "ClientToServer" },
+        { 0x3C0042, "CMSG_MOVE_SET_IGNORE_MOVEMENT_FORCES_ACK", "ClientToServer" },
+        { 0x3C005F, "CMSG_MOVE_SET_MOD_MOVEMENT_FORCE_MAGNITUDE_ACK", "ClientToServer" },
+        { 0x3C0026, "CMSG_MOVE_SET_PITCH", "ClientToServer" },
+        { 0x3C000E, "CMSG_MOVE_SET_RUN_MODE", "ClientToServer" },
+        { 0x3C0022, "CMSG_MOVE_SET_TURN_RATE_CHEAT", "ClientToServer" },
+        { 0x3C0030, "CMSG_MOVE_SET_VEHICLE_REC_ID_ACK", "ClientToServer" },
+        { 0x3C000F, "CMSG_MOVE_SET_WALK_MODE", "ClientToServer" },
+        { 0x3C0034, "CMSG_MOVE_SPLINE_DONE", "ClientToServer" },
+        { 0x3C0046, "CMSG_MOVE_START_ASCEND", "ClientToServer" },
+        { 0x3C0001, "CMSG_MOVE_START_BACKWARD", "ClientToServer" },
+        { 0x3C004D, "CMSG_MOVE_START_DESCEND", "ClientToServer" },
+        { 0x3C0071, "CMSG_MOVE_START_DRIVE_FORWARD", "ClientToServer" },
+        { 0x3C0000, "CMSG_MOVE_START_FORWARD", "ClientToServer" },
+        { 0x3C000C, "CMSG_MOVE_START_PITCH_DOWN", "ClientToServer" },
+        { 0x3C000B, "CMSG_MOVE_START_PITCH_UP", "ClientToServer" },
+        { 0x3C0003, "CMSG_MOVE_START_STRAFE_LEFT", "ClientToServer" },
+        { 0x3C0004, "CMSG_MOVE_START_STRAFE_RIGHT", "ClientToServer" },
+        { 0x3C0018, "CMSG_MOVE_START_SWIM", "ClientToServer" },
+        { 0x3C0008, "CMSG_MOVE_START_TURN_LEFT", "ClientToServer" },
+        { 0x3C0009, "CMSG_MOVE_START_TURN_RIGHT", "ClientToServer" },
+        { 0x3C0002, "CMSG_MOVE_STOP", "ClientToServer" },
+        { 0x3C0047, "CMSG_MOVE_STOP_ASCEND", "ClientToServer" },
+        { 0x3C000D, "CMSG_MOVE_STOP_PITCH", "ClientToServer" },
+        { 0x3C0005, "CMSG_MOVE_STOP_STRAFE", "ClientToServer" },
+        { 0x3C0019, "CMSG_MOVE_STOP_SWIM", "ClientToServer" },
+        { 0x3C000A, "CMSG_MOVE_STOP_TURN", "ClientToServer" },
+        { 0x3C0016, "CMSG_MOVE_TELEPORT_ACK", "ClientToServer" },
+        { 0x3C0037, "CMSG_MOVE_TIME_SKIPPED", "ClientToServer" },
+        { 0x3C0036, "CMSG_MOVE_UPDATE_FALL_SPEED", "ClientToServer" },
+        { 0x3C0039, "CMSG_MOVE_WATER_WALK_ACK", "ClientToServer" },
+        { 0x2C0001, "CMSG_MYTHIC_PLUS_REQUEST_MAP_STATS", "ClientToServer" },
+        { 0x380002, "CMSG_NEIGHBORHOOD_ADD_SECONDARY_OWNER", "ClientToServer" },
+        { 0x380009, "CMSG_NEIGHBORHOOD_BUY_HOUSE", "ClientToServer" },
+        { 0x380005, "CMSG_NEIGHBORHOOD_CANCEL_INVITATION", "ClientToServer" },
+        { 0x370006, "CMSG_NEIGHBORHOOD_CHARTER_ADD_SIGNATURE", "ClientToServer" },
+        { 0x370001, "CMSG_NEIGHBORHOOD_CHARTER_CREATE", "ClientToServer" },
+        { 0x370003, "CMSG_NEIGHBORHOOD_CHARTER_EDIT", "ClientToServer" },
+        { 0x370004, "CMSG_NEIGHBORHOOD_CHARTER_FINALIZE", "ClientToServer" },
+        { 0x370000, "CMSG_NEIGHBORHOOD_CHARTER_OPEN_CONFIRMATION_UI", "ClientToServer" },
+        { 0x370007, "CMSG_NEIGHBORHOOD_CHARTER_SEND_SIGNATURE_REQUEST", "ClientToServer" },
+        { 0x38000F, "CMSG_NEIGHBORHOOD_EVICT_PLOT", "ClientToServer" },
+        { 0x380008, "CMSG_NEIGHBORHOOD_GET_INVITES", "ClientToServer" },
+        { 0x38000E, "CMSG_NEIGHBORHOOD_GET_ROSTER", "ClientToServer" },
+        { 0x380004, "CMSG_NEIGHBORHOOD_INVITE_RESIDENT", "ClientToServer" },
+        { 0x38000A, "CMSG_NEIGHBORHOOD_MOVE_HOUSE", "ClientToServer" },
+        { 0x38000D, "CMSG_NEIGHBORHOOD_OFFER_OWNERSHIP", "ClientToServer" },
+        { 0x38000B, "CMSG_NEIGHBORHOOD_OPEN_CORNERSTONE_UI", "ClientToServer" },
+        { 0x380006, "CMSG_NEIGHBORHOOD_PLAYER_DECLINE_INVITE", "ClientToServer" },
+        { 0x380007, "CMSG_NEIGHBORHOOD_PLAYER_GET_INVITE", "ClientToServer" },
+        { 0x380003, "CMSG_NEIGHBORHOOD_REMOVE_SECONDARY_OWNER", "ClientToServer" },
+        { 0x380001, "CMSG_NEIGHBORHOOD_SET_PUBLIC_FLAG", "ClientToServer" },
+        { 0x380000, "CMSG_NEIGHBORHOOD_UPDATE_NAME", "ClientToServer" },
+        { 0x390084, "CMSG_NEUTRAL_PLAYER_SELECT_FACTION", "ClientToServer" },
+        { 0x3A00E2, "CMSG_NEXT_CINEMATIC_CAMERA", "ClientToServer" },
+        { 0x39002C, "CMSG_OBJECT_UPDATE_FAILED", "ClientToServer" },
+        { 0x39002D, "CMSG_OBJECT_UPDATE_RESCUED", "ClientToServer" },
+        { 0x390287, "CMSG_OFFER_PETITION", "ClientToServer" },
+        { 0x3A00E1, "CMSG_OPENING_CINEMATIC", "ClientToServer" },
+        { 0x390210, "CMSG_OPEN_ITEM", "ClientToServer" },
+        { 0x3901D1, "CMSG_OPEN_MISSION_NPC", "ClientToServer" },
+        { 0x3901D9, "CMSG_OPEN_SHIPMENT_NPC", "ClientToServer" },
+        { 0x3901E4, "CMSG_OPEN_TRADESKILL_NPC", "ClientToServer" },
+        { 0x3A008E, "CMSG_OPT_OUT_OF_LOOT", "ClientToServer" },
+        { 0x3A00B8, "CMSG_OVERRIDE_SCREEN_FLASH", "ClientToServer" },
+        { 0x3E0030, "CMSG_PARTY_INVITE", "ClientToServer" },
+        { 0x3E0032, "CMSG_PARTY_INVITE_RESPONSE", "ClientToServer" },
+        { 0x3E0073, "CMSG_PARTY_UNINVITE", "ClientToServer" },
+        { 0x3900ED, "CMSG_PERFORM_ITEM_INTERACTION", "ClientToServer" },
+        { 0x3902AF, "CMSG_PERKS_PROGRAM_ITEMS_REFRESHED", "ClientToServer" },
+        { 0x3902B2, "CMSG_PERKS_PROGRAM_REQUEST_CART_CHECKOUT", "ClientToServer" },
+        { 0x290016, "CMSG_PERKS_PROGRAM_REQUEST_PENDING_REWARDS", "ClientToServer" },
+        { 0x3902B1, "CMSG_PERKS_PROGRAM_REQUEST_PURCHASE", "ClientToServer" },
+        { 0x3902B3, "CMSG_PERKS_PROGRAM_REQUEST_REFUND", "ClientToServer" },
+        { 0x3902B4, "CMSG_PERKS_PROGRAM_SET_FROZEN_VENDOR_ITEM", "ClientToServer" },
+        { 0x3902B0, "CMSG_PERKS_PROGRAM_STATUS_REQUEST", "ClientToServer" },
+        { 0x3A001E, "CMSG_PET_ABANDON", "ClientToServer" },
+        { 0x3A001F, "CMSG_PET_ABANDON_BY_NUMBER", "ClientToServer" },
+        { 0x3A001C, "CMSG_PET_ACTION", "ClientToServer" },
+        { 0x390093, "CMSG_PET_BATTLE_FINAL_NOTIFY", "ClientToServer" },
+        { 0x3E006D, "CMSG_PET_BATTLE_INPUT", "ClientToServer" },
+        { 0x3900E3, "CMSG_PET_BATTLE_QUEUE_PROPOSE_MATCH_RESULT", "ClientToServer" },
+        { 0x390092, "CMSG_PET_BATTLE_QUIT_NOTIFY", "ClientToServer" },
+        { 0x3E006E, "CMSG_PET_BATTLE_REPLACE_FRONT_PET", "ClientToServer" },
+        { 0x39008C, "CMSG_PET_BATTLE_REQUEST_PVP", "ClientToServer" },
+        { 0x39008D, "CMSG_PET_BATTLE_REQUEST_UPDATE", "ClientToServer" },
+        { 0x39008A, "CMSG_PET_BATTLE_REQUEST_WILD", "ClientToServer" },
+        { 0x390094, "CMSG_PET_BATTLE_SCRIPT_ERROR_NOTIFY", "ClientToServer" },
+        { 0x3A0020, "CMSG_PET_CANCEL_AURA", "ClientToServer" },
+        { 0x390174, "CMSG_PET_CAST_SPELL", "ClientToServer" },
+        { 0x3A005A, "CMSG_PETITION_BUY", "ClientToServer" },
+        { 0x3E00F8, "CMSG_PETITION_RENAME_GUILD", "ClientToServer" },
+        { 0x3A0059, "CMSG_PETITION_SHOW_LIST", "ClientToServer" },
+        { 0x3A005B, "CMSG_PETITION_SHOW_SIGNATURES", "ClientToServer" },
+        { 0x3E00B0, "CMSG_PET_RENAME", "ClientToServer" },
+        { 0x3A001B, "CMSG_PET_SET_ACTION", "ClientToServer" },
+        { 0x3A0021, "CMSG_PET_SPELL_AUTOCAST", "ClientToServer" },
+        { 0x3A001D, "CMSG_PET_STOP_ATTACK", "ClientToServer" },
+        { 0x3F0006, "CMSG_PING", "ClientToServer" },
+        { 0x3E0016, "CMSG_PLAYER_LOGIN", "ClientToServer" },
+        { 0x3A0031, "CMSG_PUSH_QUEST_TO_PARTY", "ClientToServer" },
+        { 0x390028, "CMSG_PVP_LOG_DATA", "ClientToServer" },
+        { 0x390148, "CMSG_QUERY_BATTLE_PET_NAME", "ClientToServer" },
+        { 0x3E008C, "CMSG_QUERY_CORPSE_LOCATION_FROM_CLIENT", "ClientToServer" },
+        { 0x3E008D, "CMSG_QUERY_CORPSE_TRANSPORT", "ClientToServer" },
+        { 0x390055, "CMSG_QUERY_COUNTDOWN_TIMER", "ClientToServer" },
+        { 0x390142, "CMSG_QUERY_CREATURE", "ClientToServer" },
+        { 0x390143, "CMSG_QUERY_GAME_OBJECT", "ClientToServer" },
+        { 0x390149, "CMSG_QUERY_GARRISON_PET_NAME", "ClientToServer" },
+        { 0x3E00B6, "CMSG_QUERY_GUILD_INFO", "ClientToServer" },
+        { 0x3A0098, "CMSG_QUERY_INSPECT_ACHIEVEMENTS", "ClientToServer" },
+        { 0x3E00B7, "CMSG_QUERY_NEIGHBORHOOD_INFO", "ClientToServer" },
+        { 0x3A00D7, "CMSG_QUERY_NEXT_MAIL_TIME", "ClientToServer" },
+        { 0x390144, "CMSG_QUERY_NPC_TEXT", "ClientToServer" },
+        { 0x390146, "CMSG_QUERY_PAGE_TEXT", "ClientToServer" },
+        { 0x39014A, "CMSG_QUERY_PETITION", "ClientToServer" },
+        { 0x390147, "CMSG_QUERY_PET_NAME", "ClientToServer" },
+        { 0x3F000D, "CMSG_QUERY_PLAYER_NAME_BY_COMMUNITY_ID", "ClientToServer" },
+        { 0x3F0010, "CMSG_QUERY_PLAYER_NAMES", "ClientToServer" },
+        { 0x3F000E, "CMSG_QUERY_PLAYER_NAMES_FOR_COMMUNITY", "ClientToServer" },
+        { 0x390021, "CMSG_QUERY_QUEST_COMPLETION_NPCS", "ClientToServer" },
+        { 0x390145, "CMSG_QUERY_QUEST_INFO", "ClientToServer" },
+        { 0x390022, "CMSG_QUERY_QUEST_ITEM_USABILITY", "ClientToServer" },
+        { 0x3E00B5, "CMSG_QUERY_REALM_NAME", "ClientToServer" },
+        { 0x3E0082, "CMSG_QUERY_SCENARIO_POI", "ClientToServer" },
+        { 0x3902EA, "CMSG_QUERY_SELECTED_WOW_LABS_AREA", "ClientToServer" },
+        { 0x3A006E, "CMSG_QUERY_TIME", "ClientToServer" },
+        { 0x390233, "CMSG_QUERY_TREASURE_PICKER", "ClientToServer" },
+        { 0x3902EB, "CMSG_QUERY_WOW_LABS_AREA_INFO", "ClientToServer" },
+        { 0x3A0030, "CMSG_QUEST_CONFIRM_ACCEPT", "ClientToServer" },
+        { 0x3A002A, "CMSG_QUEST_GIVER_ACCEPT_QUEST", "ClientToServer" },
+        { 0x3A002C, "CMSG_QUEST_GIVER_CHOOSE_REWARD", "ClientToServer" },
+        { 0x3A00E8, "CMSG_QUEST_GIVER_CLOSE_QUEST", "ClientToServer" },
+        { 0x3A002B, "CMSG_QUEST_GIVER_COMPLETE_QUEST", "ClientToServer" },
+        { 0x3A0028, "CMSG_QUEST_GIVER_HELLO", "ClientToServer" },
+        { 0x3A0029, "CMSG_QUEST_GIVER_QUERY_QUEST", "ClientToServer" },
+        { 0x3A002D, "CMSG_QUEST_GIVER_REQUEST_REWARD", "ClientToServer" },
+        { 0x3A002F, "CMSG_QUEST_GIVER_STATUS_MULTIPLE_QUERY", "ClientToServer" },
+        { 0x3A002E, "CMSG_QUEST_GIVER_STATUS_QUERY", "ClientToServer" },
+        { 0x3A00CC, "CMSG_QUEST_LOG_REMOVE_QUEST", "ClientToServer" },
+        { 0x3E00DE, "CMSG_QUEST_POI_QUERY", "ClientToServer" },
+        { 0x3A0032, "CMSG_QUEST_PUSH_RESULT", "ClientToServer" },
+        { 0x390279, "CMSG_QUEST_SESSION_BEGIN_RESPONSE", "ClientToServer" },
+        { 0x390278, "CMSG_QUEST_SESSION_REQUEST_START", "ClientToServer" },
+        { 0x3E015B, "CMSG_QUEST_SESSION_REQUEST_STOP", "ClientToServer" },
+        { 0x3F000A, "CMSG_QUEUED_MESSAGES_END", "ClientToServer" },
+        { 0x3E0132, "CMSG_QUICK_JOIN_AUTO_ACCEPT_REQUESTS", "ClientToServer" },
+        { 0x3E0131, "CMSG_QUICK_JOIN_REQUEST_INVITE", "ClientToServer" },
+        { 0x3E0160, "CMSG_QUICK_JOIN_REQUEST_INVITE_WITH_CONFIRMATION", "ClientToServer" },
+        { 0x3E0130, "CMSG_QUICK_JOIN_RESPOND_TO_INVITE", "ClientToServer" },
+        { 0x3E012F, "CMSG_QUICK_JOIN_SIGNAL_TOAST_DISPLAYED", "ClientToServer" },
+        { 0x3A009C, "CMSG_RAF_CLAIM_ACTIVITY_REWARD", "ClientToServer" },
+        { 0x3E0151, "CMSG_RAF_CLAIM_NEXT_REWARD", "ClientToServer" },
+        { 0x3E0153, "CMSG_RAF_GENERATE_RECRUITMENT_LINK", "ClientToServer" },
+        { 0x3E0152, "CMSG_RAF_UPDATE_RECRUITMENT_INFO", "ClientToServer" },
+        { 0x3E0080, "CMSG_RANDOM_ROLL", "ClientToServer" },
+        { 0x390211, "CMSG_READ_ITEM", "ClientToServer" },
+        { 0x3E005F, "CMSG_READY_CHECK_RESPONSE", "ClientToServer" },
+        { 0x3E0198, "CMSG_RECENT_ALLY_REQUEST_DATA", "ClientToServer" },
+        { 0x3E0199, "CMSG_RECENT_ALLY_SET_NOTE", "ClientToServer" },
+        { 0x3A0073, "CMSG_RECLAIM_CORPSE", "ClientToServer" },
+        { 0x390237, "CMSG_REMOVE_NEW_ITEM", "ClientToServer" },
+        { 0x3E0154, "CMSG_REMOVE_RAF_RECRUIT", "ClientToServer" },
+        { 0x3E0015, "CMSG_REORDER_CHARACTERS", "ClientToServer" },
+        { 0x3A0084, "CMSG_REPAIR_ITEM", "ClientToServer" },
+        { 0x3901F2, "CMSG_REPLACE_TROPHY", "ClientToServer" },
+        { 0x3A00C4, "CMSG_REPOP_REQUEST", "ClientToServer" },
+        { 0x3A008C, "CMSG_REPORT_PVP_PLAYER_AFK", "ClientToServer" },
+        { 0x390271, "CMSG_REPORT_SERVER_LAG", "ClientToServer" },
+        { 0x390272, "CMSG_REPORT_STUCK_IN_COMBAT", "ClientToServer" },
+        { 0x3E00C3, "CMSG_REQUEST_ACCOUNT_DATA", "ClientToServer" },
+        { 0x390235, "CMSG_REQUEST_AREA_POI_UPDATE", "ClientToServer" },
+        { 0x3E0008, "CMSG_REQUEST_BATTLEFIELD_STATUS", "ClientToServer" },
+        { 0x390023, "CMSG_REQUEST_CEMETERY_LIST", "ClientToServer" },
+        { 0x3E00B8, "CMSG_REQUEST_CHARACTER_GUILD_FOLLOW_INFO", "ClientToServer" },
+        { 0x390263, "CMSG_REQUEST_COVENANT_CALLINGS", "ClientToServer" },
+        { 0x3A00C8, "CMSG_REQUEST_CROWD_CONTROL_SPELL", "ClientToServer" },
+        { 0x29001D, "CMSG_REQUEST_CURRENCY_DATA_FOR_ACCOUNT_CHARACTERS", "ClientToServer" },
+        { 0x39029C, "CMSG_REQUEST_GARRISON_TALENT_WORLD_QUEST_UNLOCKS", "ClientToServer" },
+        { 0x390054, "CMSG_REQUEST_GUILD_PARTY_STATE", "ClientToServer" },
+        { 0x390053, "CMSG_REQUEST_GUILD_REWARDS_LIST", "ClientToServer" },
+        { 0x390273, "CMSG_REQUEST_LATEST_SPLASH_SCREEN", "ClientToServer" },
+        { 0x390180, "CMSG_REQUEST_LFG_LIST_BLACKLIST", "ClientToServer" },
+        { 0x3900B8, "CMSG_REQUEST_MYTHIC_PLUS_AFFIXES", "ClientToServer" },
+        { 0x3900B9, "CMSG_REQUEST_MYTHIC_PLUS_SEASON_DATA", "ClientToServer" },
+        { 0x3902E9, "CMSG_REQUEST_PARTY_ELIGIBILITY_FOR_DELVE_TIERS", "ClientToServer" },
+        { 0x3E0023, "CMSG_REQUEST_PARTY_JOIN_UPDATES", "ClientToServer" },
+        { 0x3E007F, "CMSG_REQUEST_PARTY_MEMBER_STATS", "ClientToServer" },
+        { 0x3A0022, "CMSG_REQUEST_PET_INFO", "ClientToServer" },
+        { 0x39014D, "CMSG_REQUEST_PLAYED_TIME", "ClientToServer" },
+        { 0x390041, "CMSG_REQUEST_PVP_REWARDS", "ClientToServer" },
+        { 0x3E00F9, "CMSG_REQUEST_RAID_INFO", "ClientToServer" },
+        { 0x3E000F, "CMSG_REQUEST_RATED_PVP_INFO", "ClientToServer" },
+        { 0x3E0196, "CMSG_REQUEST_REALM_GUILD_MASTER_INFO", "ClientToServer" },
+        { 0x390236, "CMSG_REQUEST_SCHEDULED_AREA_POI_UPDATE", "ClientToServer" },
+        { 0x390042, "CMSG_REQUEST_SCHEDULED_PVP_INFO", "ClientToServer" },
+        { 0x3A0023, "CMSG_REQUEST_STABLED_PETS", "ClientToServer" },
+        { 0x290022, "CMSG_REQUEST_STORE_FRONT_INFO_UPDATE", "ClientToServer" },
+        { 0x3902FD, "CMSG_REQUEST_SURVEY", "ClientToServer" },
+        { 0x3900FF, "CMSG_REQUEST_VEHICLE_EXIT", "ClientToServer" },
+        { 0x390101, "CMSG_REQUEST_VEHICLE_NEXT_SEAT", "ClientToServer" },
+        { 0x390100, "CMSG_REQUEST_VEHICLE_PREV_SEAT", "ClientToServer" },
+        { 0x390102, "CMSG_REQUEST_VEHICLE_SWITCH_SEAT", "ClientToServer" },
+        { 0x390266, "CMSG_REQUEST_WEEKLY_REWARDS", "ClientToServer" },
+        { 0x390234, "CMSG_REQUEST_WORLD_QUEST_UPDATE", "ClientToServer" },
+        { 0x3900B6, "CMSG_RESET_CHALLENGE_MODE", "ClientToServer" },
+        { 0x3900B7, "CMSG_RESET_CHALLENGE_MODE_CHEAT", "ClientToServer" },
+        { 0x3E0094, "CMSG_RESET_INSTANCES", "ClientToServer" },
+        { 0x3E00AF, "CMSG_RESURRECT_RESPONSE", "ClientToServer" },
+        { 0x3901F4, "CMSG_REVERT_MONUMENT_APPEARANCE", "ClientToServer" },
+        { 0x390103, "CMSG_RIDE_VEHICLE_INTERACT", "ClientToServer" },
+        { 0x3E017B, "CMSG_SAVE_ACCOUNT_DATA_EXPORT", "ClientToServer" },
+        { 0x390037, "CMSG_SAVE_CUF_PROFILES", "ClientToServer" },
+        { 0x3A00A2, "CMSG_SAVE_EQUIPMENT_SET", "ClientToServer" },
+        { 0x390185, "CMSG_SAVE_GUILD_EMBLEM", "ClientToServer" },
+        { 0x390186, "CMSG_SAVE_PERSONAL_EMBLEM", "ClientToServer" },
+        { 0x3900DF, "CMSG_SCENE_PLAYBACK_CANCELED", "ClientToServer" },
+        { 0x3900DE, "CMSG_SCENE_PLAYBACK_COMPLETE", "ClientToServer" },
+        { 0x3900E0, "CMSG_SCENE_TRIGGER_EVENT", "ClientToServer" },
+        { 0x3902D8, "CMSG_SEAMLESS_TRANSFER_COMPLETE", "ClientToServer" },
+        { 0x3902EC, "CMSG_SELECT_WOW_LABS_AREA", "ClientToServer" },
+        { 0x3A00CF, "CMSG_SELF_RES", "ClientToServer" },
+        { 0x3A0035, "CMSG_SELL_ALL_JUNK_ITEMS", "ClientToServer" },
+        { 0x3A0034, "CMSG_SELL_ITEM", "ClientToServer" },
+        { 0x3E0128, "CMSG_SEND_CHARACTER_CLUB_INVITATION", "ClientToServer" },
+        { 0x3E00FF, "CMSG_SEND_CONTACT_LIST", "ClientToServer" },
+        { 0x3E0026, "CMSG_SEND_MAIL", "ClientToServer" },
+        { 0x3902DA, "CMSG_SEND_PING_UNIT", "ClientToServer" },
+        { 0x3902DB, "CMSG_SEND_PING_WORLD_POINT", "ClientToServer" },
+        { 0x3A0019, "CMSG_SEND_TEXT_EMOTE", "ClientToServer" },
+        { 0x3E00CA, "CMSG_SERVER_TIME_OFFSET_REQUEST", "ClientToServer" },
+        { 0x3A00D0, "CMSG_SET_ACTION_BAR_TOGGLES", "ClientToServer" },
+        { 0x3E0062, "CMSG_SET_ACTION_BUTTON", "ClientToServer" },
+        { 0x3C0059, "CMSG_SET_ACTIVE_MOVER", "ClientToServer" },
+        { 0x390193, "CMSG_SET_ADVANCED_COMBAT_LOGGING", "ClientToServer" },
+        { 0x3902FF, "CMSG_SET_ALLOW_RECENT_ALLIES_SEE_LOCATION", "ClientToServer" },
+        { 0x3E007B, "CMSG_SET_ASSISTANT_LEADER", "ClientToServer" },
+        { 0x390214, "CMSG_SET_BACKPACK_AUTOSORT_DISABLED", "ClientToServer" },
+        { 0x390215, "CMSG_SET_BACKPACK_SELL_JUNK_DISABLED", "ClientToServer" },
+        { 0x390216, "CMSG_SET_BANK_AUTOSORT_DISABLED", "ClientToServer" },
+        { 0x3E0102, "CMSG_SET_CONTACT_NOTES", "ClientToServer" },
+        { 0x390015, "CMSG_SET_CURRENCY_FLAGS", "ClientToServer" },
+        { 0x3900E1, "CMSG_SET_DIFFICULTY_ID", "ClientToServer" },
+        { 0x3E00AE, "CMSG_SET_DUNGEON_DIFFICULTY", "ClientToServer" },
+        { 0x39013C, "CMSG_SET_EMPOWER_MIN_HOLD_STAGE_PERCENT", "ClientToServer" },
+        { 0x3E0046, "CMSG_SET_EVERYONE_IS_ASSISTANT", "ClientToServer" },
+        { 0x3E0133, "CMSG_SET_EXCLUDED_CHAT_CENSOR_SOURCES", "ClientToServer" },
+        { 0x3A0076, "CMSG_SET_FACTION_AT_WAR", "ClientToServer" },
+        { 0x3A0078, "CMSG_SET_FACTION_INACTIVE", "ClientToServer" },
+        { 0x3A0077, "CMSG_SET_FACTION_NOT_AT_WAR", "ClientToServer" },
+        { 0x390065, "CMSG_SET_GAME_EVENT_DEBUG_VIEW_STATE", "ClientToServer" },
+        { 0x390218, "CMSG_SET_INSERT_ITEMS_LEFT_TO_RIGHT", "ClientToServer" },
+        { 0x3E0074, "CMSG_SET_LOOT_METHOD", "ClientToServer" },
+        { 0x3A00DD, "CMSG_SET_LOOT_SPECIALIZATION", "ClientToServer" },
+        { 0x3E007D, "CMSG_SET_PARTY_ASSIGNMENT", "ClientToServer" },
+        { 0x3E0076, "CMSG_SET_PARTY_LEADER", "ClientToServer" },
+        { 0x390012, "CMSG_SET_PET_FAVORITE", "ClientToServer" },
+        { 0x390011, "CMSG_SET_PET_SLOT", "ClientToServer" },
+        { 0x390013, "CMSG_SET_PET_SPECIALIZATION", "ClientToServer" },
+        { 0x3E00B4, "CMSG_SET_PLAYER_DECLINED_NAMES", "ClientToServer" },
+        { 0x390024, "CMSG_SET_PREFERRED_CEMETERY", "ClientToServer" },
+        { 0x39018A, "CMSG_SET_PVP", "ClientToServer" },
+        { 0x3E010B, "CMSG_SET_RAID_DIFFICULTY", "ClientToServer" },
+        { 0x3E0047, "CMSG_SET_RESTRICT_PINGS_TO_ASSISTANTS", "ClientToServer" },
+        { 0x3E0005, "CMSG_SET_ROLE", "ClientToServer" },
+        { 0x3E00B2, "CMSG_SET_SAVED_INSTANCE_EXTEND", "ClientToServer" },
+        { 0x3A00C6, "CMSG_SET_SELECTION", "ClientToServer" },
+        { 0x3A001A, "CMSG_SET_SHEATHED", "ClientToServer" },
+        { 0x390217, "CMSG_SET_SORT_BAGS_RIGHT_TO_LEFT", "ClientToServer" },
+        { 0x3A008B, "CMSG_SET_TAXI_BENCHMARK_MODE", "ClientToServer" },
+        { 0x390153, "CMSG_SET_TITLE", "ClientToServer" },
+        { 0x39000A, "CMSG_SET_TRADE_CURRENCY", "ClientToServer" },
+        { 0x390009, "CMSG_SET_TRADE_GOLD", "ClientToServer" },
+        { 0x390007, "CMSG_SET_TRADE_ITEM", "ClientToServer" },
+        { 0x3E018F, "CMSG_SETUP_WARBAND_GROUPS", "ClientToServer" },
+        { 0x3901D3, "CMSG_SET_USING_PARTY_GARRISON", "ClientToServer" },
+        { 0x39018B, "CMSG_SET_WAR_MODE", "ClientToServer" },
+        { 0x3A0079, "CMSG_SET_WATCHED_FACTION", "ClientToServer" },
+        { 0x3E00F1, "CMSG_SHOW_TRADE_SKILL", "ClientToServer" },
+        { 0x3A00D1, "CMSG_SIGN_PETITION", "ClientToServer" },
+        { 0x3E007E, "CMSG_SILENCE_PARTY_TALKER", "ClientToServer" },
+        { 0x3E0176, "CMSG_SOCIAL_CONTRACT_REQUEST", "ClientToServer" },
+        { 0x3A0083, "CMSG_SOCKET_GEMS", "ClientToServer" },
+        { 0x3902DE, "CMSG_SORT_ACCOUNT_BANK_BAGS", "ClientToServer" },
+        { 0x390219, "CMSG_SORT_BAGS", "ClientToServer" },
+        { 0x39021A, "CMSG_SORT_BANK_BAGS", "ClientToServer" },
+        { 0x390168, "CMSG_SPAWN_TRACKING_UPDATE", "ClientToServer" },
+        { 0x3902D1, "CMSG_SPECTATE_CHANGE", "ClientToServer" },
+        { 0x3A0027, "CMSG_SPELL_CLICK", "ClientToServer" },
+        { 0x39013A, "CMSG_SPELL_EMPOWER_RELEASE", "ClientToServer" },
+        { 0x39013B, "CMSG_SPELL_EMPOWER_RESTART", "ClientToServer" },
+        { 0x3A0042, "CMSG_SPIRIT_HEALER_ACTIVATE", "ClientToServer" },
+        { 0x3A0053, "CMSG_SPLIT_GUILD_BANK_ITEM", "ClientToServer" },
+        { 0x3A0050, "CMSG_SPLIT_GUILD_BANK_ITEM_TO_INVENTORY", "ClientToServer" },
+        { 0x3B0008, "CMSG_SPLIT_ITEM", "ClientToServer" },
+        { 0x3A004E, "CMSG_SPLIT_ITEM_TO_GUILD_BANK", "ClientToServer" },
+        { 0x390035, "CMSG_STAND_STATE_CHANGE", "ClientToServer" },
+        { 0x3A00E9, "CMSG_START_CHALLENGE_MODE", "ClientToServer" },
+        { 0x3E0060, "CMSG_START_INSTANCE_ABANDON_VOTE", "ClientToServer" },
+        { 0x3E000B, "CMSG_START_SPECTATOR_WAR_GAME", "ClientToServer" },
+        { 0x3E000A, "CMSG_START_WAR_GAME", "ClientToServer" },
+        { 0x3A0049, "CMSG_STORE_GUILD_BANK_ITEM", "ClientToServer" },
+        { 0x3E00C2, "CMSG_SUBMIT_USER_FEEDBACK", "ClientToServer" },
+        { 0x390291, "CMSG_SUBSCRIPTION_INTERSTITIAL_RESPONSE", "ClientToServer" },
+        { 0x3E0096, "CMSG_SUMMON_RESPONSE", "ClientToServer" },
+        { 0x3E0072, "CMSG_SUPPORT_TICKET_SUBMIT_COMPLAINT", "ClientToServer" },
+        { 0x390020, "CMSG_SURRENDER_ARENA", "ClientToServer" },
+        { 0x3F0000, "CMSG_SUSPEND_COMMS_ACK", "ClientToServer" },
+        { 0x3F0008, "CMSG_SUSPEND_TOKEN_RESPONSE", "ClientToServer" },
+        { 0x3A004B, "CMSG_SWAP_GUILD_BANK_ITEM_WITH_GUILD_BANK_ITEM", "ClientToServer" },
+        { 0x3B0007, "CMSG_SWAP_INV_ITEM", "ClientToServer" },
+        { 0x3B0006, "CMSG_SWAP_ITEM", "ClientToServer" },
+        { 0x3A004A, "CMSG_SWAP_ITEM_WITH_GUILD_BANK_ITEM", "ClientToServer" },
+        { 0x3E0079, "CMSG_SWAP_SUB_GROUPS", "ClientToServer" },
+        { 0x390187, "CMSG_TABARD_VENDOR_ACTIVATE", "ClientToServer" },
+        { 0x3A0024, "CMSG_TALK_TO_GOSSIP", "ClientToServer" },
+        { 0x3A003B, "CMSG_TAXI_NODE_STATUS_QUERY", "ClientToServer" },
+        { 0x3A003D, "CMSG_TAXI_QUERY_AVAILABLE_NODES", "ClientToServer" },
+        { 0x3A003F, "CMSG_TAXI_REQUEST_EARLY_LANDING", "ClientToServer" },
+        { 0x3C005D, "CMSG_TIME_ADJUSTMENT_RESPONSE", "ClientToServer" },
+        { 0x3C005A, "CMSG_TIME_SYNC_RESPONSE", "ClientToServer" },
+        { 0x3C005C, "CMSG_TIME_SYNC_RESPONSE_DROPPED", "ClientToServer" },
+        { 0x3C005B, "CMSG_TIME_SYNC_RESPONSE_FAILED", "ClientToServer" },
+        { 0x3E0083, "CMSG_TOGGLE_DIFFICULTY", "ClientToServer" },
+        { 0x390189, "CMSG_TOGGLE_PVP", "ClientToServer" },
+        { 0x3A0090, "CMSG_TOTEM_DESTROYED", "ClientToServer" },
+        { 0x290004, "CMSG_TOY_CLEAR_FANFARE", "ClientToServer" },
+        { 0x390232, "CMSG_TRADE_SKILL_SET_FAVORITE", "ClientToServer" },
+        { 0x3A0041, "CMSG_TRAINER_BUY_SPELL", "ClientToServer" },
+        { 0x3A0040, "CMSG_TRAINER_LIST", "ClientToServer" },
+        { 0x3902BA, "CMSG_TRAITS_COMMIT_CONFIG", "ClientToServer" },
+        { 0x3902B8, "CMSG_TRAITS_TALENT_TEST_UNLEARN_SPELLS", "ClientToServer" },
+        { 0x3902E7, "CMSG_TRANSFER_CURRENCY_FROM_ACCOUNT_CHARACTER", "ClientToServer" },
+        { 0x390043, "CMSG_TRANSMOGRIFY_ITEMS", "ClientToServer" },
+        { 0x3A00D3, "CMSG_TURN_IN_PETITION", "ClientToServer" },
+        { 0x3E010C, "CMSG_TUTORIAL", "ClientToServer" },
+        { 0x390262, "CMSG_UI_MAP_QUEST_LINES_REQUEST", "ClientToServer" },
+        { 0x390005, "CMSG_UNACCEPT_TRADE", "ClientToServer" },
+        { 0x3E010E, "CMSG_UNDELETE_CHARACTER", "ClientToServer" },
+        { 0x3A007D, "CMSG_UNLEARN_SKILL", "ClientToServer" },
+        { 0x390051, "CMSG_UNLEARN_SPECIALIZATION", "ClientToServer" },
+        { 0x3E0166, "CMSG_UPDATE_AADC_STATUS", "ClientToServer" },
+        { 0x3A012A, "CMSG_UPDATE_ACCOUNT_BANK_TAB_SETTINGS", "ClientToServer" },
+        { 0x3E00C4, "CMSG_UPDATE_ACCOUNT_DATA", "ClientToServer" },
+        { 0x390177, "CMSG_UPDATE_AREA_TRIGGER_VISUAL", "ClientToServer" },
+        { 0x3901E5, "CMSG_UPDATE_CRAFTING_NPC_RECIPES", "ClientToServer" },
+        { 0x3C0060, "CMSG_UPDATE_MISSILE_TRAJECTORY", "ClientToServer" },
+        { 0x3E007C, "CMSG_UPDATE_RAID_TARGET", "ClientToServer" },
+        { 0x390176, "CMSG_UPDATE_SPELL_VISUAL", "ClientToServer" },
+        { 0x3E0123, "CMSG_UPDATE_VAS_PURCHASE_STATES", "ClientToServer" },
+        { 0x39019B, "CMSG_UPGRADE_GARRISON", "ClientToServer" },
+        { 0x39028F, "CMSG_UPGRADE_RUNEFORGE_LEGENDARY", "ClientToServer" },
+        { 0x390109, "CMSG_USE_CRITTER_ITEM", "ClientToServer" },
+        { 0x390032, "CMSG_USED_FOLLOW", "ClientToServer" },
+        { 0x3B0001, "CMSG_USE_EQUIPMENT_SET", "ClientToServer" },
+        { 0x390170, "CMSG_USE_ITEM", "ClientToServer" },
+        { 0x390173, "CMSG_USE_TOY", "ClientToServer" },
+        { 0x3E0139, "CMSG_VAS_CHECK_TRANSFER_OK", "ClientToServer" },
+        { 0x3E0138, "CMSG_VAS_GET_QUEUE_MINUTES", "ClientToServer" },
+        { 0x3E0137, "CMSG_VAS_GET_SERVICE_STATUS", "ClientToServer" },
+        { 0x390030, "CMSG_VIOLENCE_LEVEL", "ClientToServer" },
+        { 0x3E013D, "CMSG_VOICE_CHANNEL_STT_TOKEN_REQUEST", "ClientToServer" },
+        { 0x3E013E, "CMSG_VOICE_CHAT_JOIN_CHANNEL", "ClientToServer" },
+        { 0x3E013C, "CMSG_VOICE_CHAT_LOGIN", "ClientToServer" },
+        { 0x3E0018, "CMSG_WARDEN3_DATA", "ClientToServer" },
+        { 0x3E00AD, "CMSG_WHO", "ClientToServer" },
+        { 0x3E00AC, "CMSG_WHO_IS", "ClientToServer" },
+        { 0x3902D4, "CMSG_WORLD_LOOT_OBJECT_CLICK", "ClientToServer" },
+        { 0x3E0025, "CMSG_WORLD_PORT_RESPONSE", "ClientToServer" },
+        { 0x3B0000, "CMSG_WRAP_ITEM", "ClientToServer" },
+        { 0x400030, "SMSG_ABORT_NEW_WORLD", "ServerToClient" },
+        { 0x40034B, "SMSG_ACCOUNT_CHARACTER_CURRENCY_LISTS", "ServerToClient" },
+        { 0x400350, "SMSG_ACCOUNT_CONVERSION_STATE_UPDATE", "ServerToClient" },
+        { 0x400304, "SMSG_ACCOUNT_COSMETIC_ADDED", "ServerToClient" },
+        { 0x4002EC, "SMSG_ACCOUNT_CRITERIA_UPDATE", "ServerToClient" },
+        { 0x4001AD, "SMSG_ACCOUNT_DATA_TIMES", "ServerToClient" },
+        { 0x40033C, "SMSG_ACCOUNT_EXPORT_RESPONSE", "ServerToClient" },
+        { 0x400050, "SMSG_ACCOUNT_EXTERIOR_FIXTURE_COLLECTION_UPDATE", "ServerToClient" },
+        { 0x400049, "SMSG_ACCOUNT_HEIRLOOM_UPDATE", "ServerToClient" },
+        { 0x400356, "SMSG_ACCOUNT_ITEM_COLLECTION_DATA", "ServerToClient" },
+        { 0x400047, "SMSG_ACCOUNT_MOUNT_REMOVED", "ServerToClient" },
+        { 0x400046, "SMSG_ACCOUNT_MOUNT_UPDATE", "ServerToClient" },
+        { 0x400303, "SMSG_ACCOUNT_NOTIFICATIONS_RESPONSE", "ServerToClient" },
+        { 0x40004F, "SMSG_ACCOUNT_ROOM_COLLECTION_UPDATE", "ServerToClient" },
+        { 0x400052, "SMSG_ACCOUNT_ROOM_MATERIAL_COLLECTION_UPDATE", "ServerToClient" },
+        { 0x400051, "SMSG_ACCOUNT_ROOM_THEME_COLLECTION_UPDATE", "ServerToClient" },
+        { 0x400325, "SMSG_ACCOUNT_STORE_CURRENCY_UPDATE", "ServerToClient" },
+        { 0x400326, "SMSG_ACCOUNT_STORE_FRONT_UPDATE", "ServerToClient" },
+        { 0x400327, "SMSG_ACCOUNT_STORE_ITEM_STATE_CHANGED", "ServerToClient" },
+        { 0x400328, "SMSG_ACCOUNT_STORE_RESULT", "ServerToClient" },
+        { 0x400048, "SMSG_ACCOUNT_TOY_UPDATE", "ServerToClient" },
+        { 0x40004C, "SMSG_ACCOUNT_TRANSMOG_SET_FAVORITES_UPDATE", "ServerToClient" },
+        { 0x40004B, "SMSG_ACCOUNT_TRANSMOG_UPDATE", "ServerToClient" },
+        { 0x40004E, "SMSG_ACCOUNT_WARBAND_SCENE_UPDATE", "ServerToClient" },
+        { 0x40018A, "SMSG_ACHIEVEMENT_DELETED", "ServerToClient" },
+        { 0x4000E5, "SMSG_ACHIEVEMENT_EARNED", "ServerToClient" },
+        { 0x5C0021, "SMSG_ACTIVATE_ESSENCE_FAILED", "ServerToClient" },
+        { 0x5C0023, "SMSG_ACTIVATE_SOULBIND_FAILED", "ServerToClient" },
+        { 0x400121, "SMSG_ACTIVATE_TAXI_REPLY", "ServerToClient" },
+        { 0x5F0045, "SMSG_ACTIVE_GLYPHS", "ServerToClient" },
+        { 0x4001E8, "SMSG_ACTIVE_SCHEDULED_WORLD_STATE_INFO", "ServerToClient" },
+        { 0x4000DF, "SMSG_ADD_BATTLENET_FRIEND_RESPONSE", "ServerToClient" },
+        { 0x400042, "SMSG_ADD_ITEM_PASSIVE", "ServerToClient" },
+        { 0x400114, "SMSG_ADD_LOSS_OF_CONTROL", "ServerToClient" },
+        { 0x4000E4, "SMSG_ADDON_LIST_REQUEST", "ServerToClient" },
+        { 0x40015B, "SMSG_ADD_RUNE_POWER", "ServerToClient" },
+        { 0x40006D, "SMSG_ADJUST_SPLINE_DURATION", "ServerToClient" },
+        { 0x400301, "SMSG_ADVANCED_COMBAT_LOG", "ServerToClient" },
+        { 0x4002FC, "SMSG_ADVENTURE_JOURNAL_DATA_RESPONSE", "ServerToClient" },
+        { 0x4000BB, "SMSG_AE_LOOT_TARGET_ACK", "ServerToClient" },
+        { 0x4000BA, "SMSG_AE_LOOT_TARGETS", "ServerToClient" },
+        { 0x400158, "SMSG_AI_REACTION", "ServerToClient" },
+        { 0x400005, "SMSG_ALL_ACCOUNT_CRITERIA", "ServerToClient" },
+        { 0x400004, "SMSG_ALL_ACHIEVEMENT_DATA", "ServerToClient" },
+        { 0x4C0000, "SMSG_ALL_GUILD_ACHIEVEMENTS", "ServerToClient" },
+        { 0x400295, "SMSG_ALLIED_RACE_DETAILS", "ServerToClient" },
+        { 0x4002D9, "SMSG_APPLY_MOUNT_EQUIPMENT_RESULT", "ServerToClient" },
+        { 0x40001D, "SMSG_ARCHAEOLOGY_SURVERY_CAST", "ServerToClient" },
+        { 0x5C0019, "SMSG_AREA_POI_UPDATE_RESPONSE", "ServerToClient" },
+        { 0x4001E1, "SMSG_AREA_SPIRIT_HEALER_TIME", "ServerToClient" },
+        { 0x410004, "SMSG_AREA_TRIGGER_DENIED", "ServerToClient" },
+        { 0x4001B9, "SMSG_AREA_TRIGGER_NO_CORPSE", "ServerToClient" },
+        { 0x410002, "SMSG_AREA_TRIGGER_PLAY_SPELL_VISUAL", "ServerToClient" },
+        { 0x410003, "SMSG_AREA_TRIGGER_UPDATE_DECAL_PROPERTIES", "ServerToClient" },
+        { 0x4000EB, "SMSG_ARENA_CLEAR_OPPONENTS", "ServerToClient" },
+        { 0x4000D4, "SMSG_ARENA_CROWD_CONTROL_SPELL_RESULT", "ServerToClient" },
+        { 0x4000EA, "SMSG_ARENA_PREP_OPPONENT_SPECIALIZATIONS", "ServerToClient" },
+        { 0x400243, "SMSG_ARTIFACT_ENDGAME_POWERS_REFUNDED", "ServerToClient" },
+        { 0x400241, "SMSG_ARTIFACT_FORGE_ERROR", "ServerToClient" },
+        { 0x400242, "SMSG_ARTIFACT_RESPEC_PROMPT", "ServerToClient" },
+        { 0x400288, "SMSG_ARTIFACT_XP_GAIN", "ServerToClient" },
+        { 0x46002C, "SMSG_ATTACKER_STATE_UPDATE", "ServerToClient" },
+        { 0x460017, "SMSG_ATTACK_START", "ServerToClient" },
+        { 0x460018, "SMSG_ATTACK_STOP", "ServerToClient" },
+        { 0x460026, "SMSG_ATTACK_SWING_ERROR", "ServerToClient" },
+        { 0x460027, "SMSG_ATTACK_SWING_LANDED_LOG", "ServerToClient" },
+        { 0x400271, "SMSG_AUCTIONABLE_TOKEN_AUCTION_SOLD", "ServerToClient" },
+        { 0x400270, "SMSG_AUCTIONABLE_TOKEN_SELL_AT_MARKET_PRICE_RESPONSE", "ServerToClient" },
+        { 0x40026F, "SMSG_AUCTIONABLE_TOKEN_SELL_CONFIRM_REQUIRED", "ServerToClient" },
+        { 0x400195, "SMSG_AUCTION_CLOSED_NOTIFICATION", "ServerToClient" },
+        { 0x400192, "SMSG_AUCTION_COMMAND_RESULT", "ServerToClient" },
+        { 0x400329, "SMSG_AUCTION_DISABLE_NEW_POSTINGS", "ServerToClient" },
+        { 0x4002F3, "SMSG_AUCTION_FAVORITE_LIST", "ServerToClient" },
+        { 0x4002EB, "SMSG_AUCTION_GET_COMMODITY_QUOTE_RESULT", "ServerToClient" },
+        { 0x400190, "SMSG_AUCTION_HELLO_RESPONSE", "ServerToClient" },
+        { 0x4002EA, "SMSG_AUCTION_LIST_BIDDED_ITEMS_RESULT", "ServerToClient" },
+        { 0x4002E6, "SMSG_AUCTION_LIST_BUCKETS_RESULT", "ServerToClient" },
+        { 0x4002E7, "SMSG_AUCTION_LIST_ITEMS_RESULT", "ServerToClient" },
+        { 0x4002E9, "SMSG_AUCTION_LIST_OWNED_ITEMS_RESULT", "ServerToClient" },
+        { 0x400194, "SMSG_AUCTION_OUTBID_NOTIFICATION", "ServerToClient" },
+        { 0x400196, "SMSG_AUCTION_OWNER_BID_NOTIFICATION", "ServerToClient" },
+        { 0x400191, "SMSG_AUCTION_REPLICATE_RESPONSE", "ServerToClient" },
+        { 0x400193, "SMSG_AUCTION_WON_NOTIFICATION", "ServerToClient" },
+        { 0x5F0012, "SMSG_AURA_POINTS_DEPLETED", "ServerToClient" },
+        { 0x5F0011, "SMSG_AURA_UPDATE", "ServerToClient" },
+        { 0x470000, "SMSG_AUTH_CHALLENGE", "ServerToClient" },
+        { 0x400000, "SMSG_AUTH_FAILED", "ServerToClient" },
+        { 0x400001, "SMSG_AUTH_RESPONSE", "ServerToClient" },
+        { 0x440001, "SMSG_AVAILABLE_HOTFIXES", "ServerToClient" },
+        { 0x40032A, "SMSG_BACKPACK_DEFAULT_SIZE_CHANGED", "ServerToClient" },
+        { 0x600007, "SMSG_BAG_CLEANUP_FINISHED", "ServerToClient" },
+        { 0x400160, "SMSG_BARBER_SHOP_RESULT", "ServerToClient" },
+        { 0x4002CA, "SMSG_BATCH_PRESENCE_SUBSCRIPTION", "ServerToClient" },
+        { 0x460005, "SMSG_BATTLEFIELD_LIST", "ServerToClient" },
+        { 0x46000B, "SMSG_BATTLEFIELD_PORT_DENIED", "ServerToClient" },
+        { 0x460001, "SMSG_BATTLEFIELD_STATUS_ACTIVE", "ServerToClient" },
+        { 0x460004, "SMSG_BATTLEFIELD_STATUS_FAILED", "ServerToClient" },
+        { 0x46000E, "SMSG_BATTLEFIELD_STATUS_GROUP_PROPOSAL_FAILED", "ServerToClient" },
+        { 0x460000, "SMSG_BATTLEFIELD_STATUS_NEED_CONFIRMATION", "ServerToClient" },
+        { 0x460003, "SMSG_BATTLEFIELD_STATUS_NONE", "ServerToClient" },
+        { 0x460002, "SMSG_BATTLEFIELD_STATUS_QUEUED", "ServerToClient" },
+        { 0x46000D, "SMSG_BATTLEFIELD_STATUS_WAIT_FOR_GROUPS", "ServerToClient" },
+        { 0x46000C, "SMSG_BATTLEGROUND_INFO_THROTTLED", "ServerToClient" },
+        { 0x460029, "SMSG_BATTLEGROUND_INIT", "ServerToClient" },
+        { 0x460009, "SMSG_BATTLEGROUND_PLAYER_JOINED", "ServerToClient" },
+        { 0x46000A, "SMSG_BATTLEGROUND_PLAYER_LEFT", "ServerToClient" },
+        { 0x460006, "SMSG_BATTLEGROUND_PLAYER_POSITIONS", "ServerToClient" },
+        { 0x460028, "SMSG_BATTLEGROUND_POINTS", "ServerToClient" },
+        { 0x40022B, "SMSG_BATTLENET_CHALLENGE_ABORT", "ServerToClient" },
+        { 0x40022A, "SMSG_BATTLENET_CHALLENGE_START", "ServerToClient" },
+        { 0x4002A2, "SMSG_BATTLE_NET_CONNECTION_STATUS", "ServerToClient" },
+        { 0x4002A1, "SMSG_BATTLENET_NOTIFICATION", "ServerToClient" },
+        { 0x4002A0, "SMSG_BATTLENET_RESPONSE", "ServerToClient" },
+        { 0x400226, "SMSG_BATTLE_PAY_ACK_FAILED", "ServerToClient" },
+        { 0x40021B, "SMSG_BATTLE_PAY_BATTLE_PET_DELIVERED", "ServerToClient" },
+        { 0x40021C, "SMSG_BATTLE_PAY_COLLECTION_ITEM_DELIVERED", "ServerToClient" },
+        { 0x400225, "SMSG_BATTLE_PAY_CONFIRM_PURCHASE", "ServerToClient" },
+        { 0x400219, "SMSG_BATTLE_PAY_DELIVERY_ENDED", "ServerToClient" },
+        { 0x400218, "SMSG_BATTLE_PAY_DELIVERY_STARTED", "ServerToClient" },
+        { 0x400309, "SMSG_BATTLE_PAY_DISTRIBUTION_ASSIGN_VAS_RESPONSE", "ServerToClient" },
+        { 0x400216, "SMSG_BATTLE_PAY_DISTRIBUTION_UNREVOKED", "ServerToClient" },
+        { 0x400217, "SMSG_BATTLE_PAY_DISTRIBUTION_UPDATE", "ServerToClient" },
+        { 0x400215, "SMSG_BATTLE_PAY_GET_DISTRIBUTION_LIST_RESPONSE", "ServerToClient" },
+        { 0x400213, "SMSG_BATTLE_PAY_GET_PRODUCT_LIST_RESPONSE", "ServerToClient" },
+        { 0x400214, "SMSG_BATTLE_PAY_GET_PURCHASE_LIST_RESPONSE", "ServerToClient" },
+        { 0x40021A, "SMSG_BATTLE_PAY_MOUNT_DELIVERED", "ServerToClient" },
+        { 0x400224, "SMSG_BATTLE_PAY_PURCHASE_UPDATE", "ServerToClient" },
+        { 0x4002BE, "SMSG_BATTLE_PAY_START_CHECKOUT", "ServerToClient" },
+        { 0x400222, "SMSG_BATTLE_PAY_START_DISTRIBUTION_ASSIGN_TO_TARGET_RESPONSE", "ServerToClient" },
+        { 0x400221, "SMSG_BATTLE_PAY_START_PURCHASE_RESPONSE", "ServerToClient" },
+        { 0x4002B1, "SMSG_BATTLE_PAY_VALIDATE_PURCHASE_RESPONSE", "ServerToClient" },
+        { 0x40011C, "SMSG_BATTLE_PET_CAGE_DATE_ERROR", "ServerToClient" },
+        { 0x40008C, "SMSG_BATTLE_PET_DELETED", "ServerToClient" },
+        { 0x4000DA, "SMSG_BATTLE_PET_ERROR", "ServerToClient" },
+        { 0x40008B, "SMSG_BATTLE_PET_JOURNAL", "ServerToClient" },
+        { 0x400089, "SMSG_BATTLE_PET_JOURNAL_LOCK_ACQUIRED", "ServerToClient" },
+        { 0x40008A, "SMSG_BATTLE_PET_JOURNAL_LOCK_DENIED", "ServerToClient" },
+        { 0x40008E, "SMSG_BATTLE_PET_RESTORED", "ServerToClient" },
+        { 0x40008D, "SMSG_BATTLE_PET_REVOKED", "ServerToClient" },
+        { 0x40008F, "SMSG_BATTLE_PETS_HEALED", "ServerToClient" },
+        { 0x400087, "SMSG_BATTLE_PET_TRAP_LEVEL", "ServerToClient" },
+        { 0x400086, "SMSG_BATTLE_PET_UPDATES", "ServerToClient" },
+        { 0x400011, "SMSG_BIND_POINT_UPDATE", "ServerToClient" },
+        { 0x4000CA, "SMSG_BLACK_MARKET_BID_ON_ITEM_RESULT", "ServerToClient" },
+        { 0x4000CB, "SMSG_BLACK_MARKET_OUTBID", "ServerToClient" },
+        { 0x4000C9, "SMSG_BLACK_MARKET_REQUEST_ITEMS_RESULT", "ServerToClient" },
+        { 0x4000CC, "SMSG_BLACK_MARKET_WON", "ServerToClient" },
+        { 0x4000E7, "SMSG_BONUS_ROLL_EMPTY", "ServerToClient" },
+        { 0x46002B, "SMSG_BOSS_KILL", "ServerToClient" },
+        { 0x460016, "SMSG_BREAK_TARGET", "ServerToClient" },
+        { 0x450012, "SMSG_BROADCAST_ACHIEVEMENT", "ServerToClient" },
+        { 0x4002CC, "SMSG_BROADCAST_SUMMON_CAST", "ServerToClient" },
+        { 0x4002CD, "SMSG_BROADCAST_SUMMON_RESPONSE", "ServerToClient" },
+        { 0x400169, "SMSG_BUY_FAILED", "ServerToClient" },
+        { 0x400168, "SMSG_BUY_SUCCEEDED", "ServerToClient" },
+        { 0x44000F, "SMSG_CACHE_INFO", "ServerToClient" },
+        { 0x44000E, "SMSG_CACHE_VERSION", "ServerToClient" },
+        { 0x400141, "SMSG_CALENDAR_CLEAR_PENDING_ACTION", "ServerToClient" },
+        { 0x400142, "SMSG_CALENDAR_COMMAND_RESULT", "ServerToClient" },
+        { 0x400131, "SMSG_CALENDAR_COMMUNITY_INVITE", "ServerToClient" },
+        { 0x400139, "SMSG_CALENDAR_EVENT_REMOVED_ALERT", "ServerToClient" },
+        { 0x40013A, "SMSG_CALENDAR_EVENT_UPDATED_ALERT", "ServerToClient" },
+        { 0x400132, "SMSG_CALENDAR_INVITE_ADDED", "ServerToClient" },
+        { 0x400136, "SMSG_CALENDAR_INVITE_ALERT", "ServerToClient" },
+        { 0x40013B, "SMSG_CALENDAR_INVITE_NOTES", "ServerToClient" },
+        { 0x40013C, "SMSG_CALENDAR_INVITE_NOTES_ALERT", "ServerToClient" },
+        { 0x400133, "SMSG_CALENDAR_INVITE_REMOVED", "ServerToClient" },
+        { 0x400138, "SMSG_CALENDAR_INVITE_REMOVED_ALERT", "ServerToClient" },
+        { 0x400134, "SMSG_CALENDAR_INVITE_STATUS", "ServerToClient" },
+        { 0x400137, "SMSG_CALENDAR_INVITE_STATUS_ALERT", "ServerToClient" },
+        { 0x400135, "SMSG_CALENDAR_MODERATOR_STATUS", "ServerToClient" },
+        { 0x40013D, "SMSG_CALENDAR_RAID_LOCKOUT_ADDED", "ServerToClient" },
+        { 0x40013E, "SMSG_CALENDAR_RAID_LOCKOUT_REMOVED", "ServerToClient" },
+        { 0x40013F, "SMSG_CALENDAR_RAID_LOCKOUT_UPDATED", "ServerToClient" },
+        { 0x40012F, "SMSG_CALENDAR_SEND_CALENDAR", "ServerToClient" },
+        { 0x400130, "SMSG_CALENDAR_SEND_EVENT", "ServerToClient" },
+        { 0x400140, "SMSG_CALENDAR_SEND_NUM_PENDING", "ServerToClient" },
+        { 0x4001C7, "SMSG_CAMERA_EFFECT", "ServerToClient" },
+        { 0x400180, "SMSG_CANCEL_AUTO_REPEAT", "ServerToClient" },
+        { 0x460025, "SMSG_CANCEL_COMBAT", "ServerToClient" },
+        { 0x5F0037, "SMSG_CANCEL_ORPHAN_SPELL_VISUAL", "ServerToClient" },
+        { 0x40003B, "SMSG_CANCEL_PING_PIN", "ServerToClient" },
+        { 0x40002E, "SMSG_CANCEL_PRELOAD_WORLD", "ServerToClient" },
+        { 0x4000D9, "SMSG_CANCEL_SCENE", "ServerToClient" },
+        { 0x5F0035, "SMSG_CANCEL_SPELL_VISUAL", "ServerToClient" },
+        { 0x5F0039, "SMSG_CANCEL_SPELL_VISUAL_KIT", "ServerToClient" },
+        { 0x460021, "SMSG_CAN_DUEL_RESULT", "ServerToClient" },
+        { 0x4002B0, "SMSG_CAN_REDEEM_TOKEN_FOR_BALANCE_RESPONSE", "ServerToClient" },
+        { 0x460008, "SMSG_CAPTURE_POINT_REMOVED", "ServerToClient" },
+        { 0x40011A, "SMSG_CAS_REFRESH_REMOTE_DATA", "ServerToClient" },
+        { 0x5F0048, "SMSG_CAST_FAILED", "ServerToClient" },
+        { 0x4002B2, "SMSG_CATALOG_SHOP_LICENSE_DATA", "ServerToClient" },
+        { 0x40035C, "SMSG_CATALOG_SHOP_OBTAIN_LICENSE", "ServerToClient" },
+        { 0x400357, "SMSG_CATALOG_SHOP_OPEN_CHECKOUT_RESULT", "ServerToClient" },
+        { 0x450009, "SMSG_CAUTIONARY_CHANNEL_MESSAGE", "ServerToClient" },
+        { 0x450008, "SMSG_CAUTIONARY_CHAT_MESSAGE", "ServerToClient" },
+        { 0x400065, "SMSG_CHAIN_MISSILE_BOUNCE", "ServerToClient" },
+        { 0x4000AA, "SMSG_CHALLENGE_MODE_COMPLETE", "ServerToClient" },
+        { 0x4000AB, "SMSG_CHALLENGE_MODE_NEW_PLAYER_RECORD", "ServerToClient" },
+        { 0x4000B2, "SMSG_CHALLENGE_MODE_REQUEST_LEADERBOARD_RESULT", "ServerToClient" },
+        { 0x4000B1, "SMSG_CHALLENGE_MODE_REQUEST_LEADERS_RESULT", "ServerToClient" },
+        { 0x4000A9, "SMSG_CHALLENGE_MODE_RESET", "ServerToClient" },
+        { 0x5C0031, "SMSG_CHALLENGE_MODE_SET_LEAVER_PENALTY_TIMER", "ServerToClient" },
+        { 0x4000A7, "SMSG_CHALLENGE_MODE_START", "ServerToClient" },
+        { 0x4000A8, "SMSG_CHALLENGE_MODE_UPDATE_DEATH_COUNT", "ServerToClient" },
+        { 0x5C000D, "SMSG_CHANGE_PLAYER_DIFFICULTY_RESULT", "ServerToClient" },
+        { 0x4002A3, "SMSG_CHANGE_REALM_TICKET_RESPONSE", "ServerToClient" },
+        { 0x45001B, "SMSG_CHANNEL_LIST", "ServerToClient" },
+        { 0x450017, "SMSG_CHANNEL_NOTIFY", "ServerToClient" },
+        { 0x450019, "SMSG_CHANNEL_NOTIFY_JOINED", "ServerToClient" },
+        { 0x45001A, "SMSG_CHANNEL_NOTIFY_LEFT", "ServerToClient" },
+        { 0x450018, "SMSG_CHANNEL_NOTIFY_NPE_JOINED_BATCH", "ServerToClient" },
+        { 0x40025D, "SMSG_CHARACTER_CHECK_UPGRADE_RESULT", "ServerToClient" },
+        { 0x4001A7, "SMSG_CHARACTER_LOGIN_FAILED", "ServerToClient" },
+        { 0x400229, "SMSG_CHARACTER_OBJECT_TEST_RESPONSE", "ServerToClient" },
+        { 0x400204, "SMSG_CHARACTER_RENAME_RESULT", "ServerToClient" },
+        { 0x40025C, "SMSG_CHARACTER_UPGRADE_ABORTED", "ServerToClient" },
+        { 0x40025B, "SMSG_CHARACTER_UPGRADE_COMPLETE", "ServerToClient" },
+        { 0x40025E, "SMSG_CHARACTER_UPGRADE_MANUAL_UNREVOKE_RESULT", "ServerToClient" },
+        { 0x40025A, "SMSG_CHARACTER_UPGRADE_STARTED", "ServerToClient" },
+        { 0x400184, "SMSG_CHAR_CUSTOMIZE_FAILURE", "ServerToClient" },
+        { 0x400185, "SMSG_CHAR_CUSTOMIZE_SUCCESS", "ServerToClient" },
+        { 0x400247, "SMSG_CHAR_FACTION_CHANGE_RESULT", "ServerToClient" },
+        { 0x450001, "SMSG_CHAT", "ServerToClient" },
+        { 0x45000E, "SMSG_CHAT_AUTO_RESPONDED", "ServerToClient" },
+        { 0x450022, "SMSG_CHAT_CAN_LOCAL_WHISPER_TARGET_RESPONSE", "ServerToClient" },
+        { 0x450014, "SMSG_CHAT_DOWN", "ServerToClient" },
+        { 0x450000, "SMSG_CHAT_IGNORED_ACCOUNT_MUTED", "ServerToClient" },
+        { 0x450015, "SMSG_CHAT_IS_DOWN", "ServerToClient" },
+        { 0x450023, "SMSG_CHAT_NOT_IN_GUILD", "ServerToClient" },
+        { 0x450006, "SMSG_CHAT_NOT_IN_PARTY", "ServerToClient" },
+        { 0x450004, "SMSG_CHAT_PLAYER_AMBIGUOUS", "ServerToClient" },
+        { 0x45000D, "SMSG_CHAT_PLAYER_NOTFOUND", "ServerToClient" },
+        { 0x450016, "SMSG_CHAT_RECONNECT", "ServerToClient" },
+        { 0x45001D, "SMSG_CHAT_REGIONAL_SERVICE_STATUS", "ServerToClient" },
+        { 0x450007, "SMSG_CHAT_RESTRICTED", "ServerToClient" },
+        { 0x45001C, "SMSG_CHAT_SERVER_MESSAGE", "ServerToClient" },
+        { 0x5F0002, "SMSG_CHEAT_IGNORE_DIMISHING_RETURNS", "ServerToClient" },
+        { 0x5C0024, "SMSG_CHECK_ABANDON_NPE", "ServerToClient" },
+        { 0x40001B, "SMSG_CHECK_CHARACTER_NAME_AVAILABILITY_RESULT", "ServerToClient" },
+        { 0x400027, "SMSG_CHECK_WARGAME_ENTRY", "ServerToClient" },
+        { 0x4002F6, "SMSG_CHROMIE_TIME_SELECT_EXPANSION_SUCCESS", "ServerToClient" },
+        { 0x4002DD, "SMSG_CLAIM_RAF_REWARD_RESPONSE", "ServerToClient" },
+        { 0x5F0016, "SMSG_CLEAR_ALL_SPELL_CHARGES", "ServerToClient" },
+        { 0x400058, "SMSG_CLEAR_BOSS_EMOTES", "ServerToClient" },
+        { 0x40015D, "SMSG_CLEAR_COOLDOWN", "ServerToClient" },
+        { 0x5F0015, "SMSG_CLEAR_COOLDOWNS", "ServerToClient" },
+        { 0x400013, "SMSG_CLEAR_RESURRECT", "ServerToClient" },
+        { 0x5F0017, "SMSG_CLEAR_SPELL_CHARGES", "ServerToClient" },
+        { 0x460022, "SMSG_CLEAR_TARGET", "ServerToClient" },
+        { 0x5D0022, "SMSG_CLEAR_TREASURE_PICKER_CACHE", "ServerToClient" },
+        { 0x400240, "SMSG_CLOSE_ARTIFACT_FORGE", "ServerToClient" },
+        { 0x4002D5, "SMSG_CLUB_FINDER_ERROR_MESSAGE", "ServerToClient" },
+        { 0x4002D8, "SMSG_CLUB_FINDER_GET_CLUB_POSTING_IDS_RESPONSE", "ServerToClient" },
+        { 0x4002D6, "SMSG_CLUB_FINDER_LOOKUP_CLUB_POSTINGS_LIST", "ServerToClient" },
+        { 0x4002D3, "SMSG_CLUB_FINDER_RESPONSE_CHARACTER_APPLICATION_LIST", "ServerToClient" },
+        { 0x4002D7, "SMSG_CLUB_FINDER_RESPONSE_POST_RECRUITMENT_MESSAGE", "ServerToClient" },
+        { 0x4002D4, "SMSG_CLUB_FINDER_UPDATE_APPLICATIONS", "ServerToClient" },
+        { 0x400315, "SMSG_CLUB_FINDER_WHISPER_APPLICANT_RESPONSE", "ServerToClient" },
+        { 0x4000B9, "SMSG_COIN_REMOVED", "ServerToClient" },
+        { 0x460019, "SMSG_COMBAT_EVENT_FAILED", "ServerToClient" },
+        { 0x4001A9, "SMSG_COMMENTATOR_MAP_INFO", "ServerToClient" },
+        { 0x4001AA, "SMSG_COMMENTATOR_PLAYER_INFO", "ServerToClient" },
+        { 0x4001A8, "SMSG_COMMENTATOR_STATE_CHANGED", "ServerToClient" },
+        { 0x40026C, "SMSG_COMMERCE_TOKEN_GET_COUNT_RESPONSE", "ServerToClient" },
+        { 0x400278, "SMSG_COMMERCE_TOKEN_GET_LOG_RESPONSE", "ServerToClient" },
+        { 0x40026E, "SMSG_COMMERCE_TOKEN_GET_MARKET_PRICE_RESPONSE", "ServerToClient" },
+        { 0x40026D, "SMSG_COMMERCE_TOKEN_UPDATE", "ServerToClient" },
+        { 0x40014F, "SMSG_COMPLAINT_RESULT", "ServerToClient" },
+        { 0x400239, "SMSG_COMPLETE_SHIPMENT_RESPONSE", "ServerToClient" },
+        { 0x47000C, "SMSG_COMPRESSED_PACKET", "ServerToClient" },
+        { 0x4002AF, "SMSG_CONFIRM_PARTY_INVITE", "ServerToClient" },
+        { 0x470007, "SMSG_CONNECT_TO", "ServerToClient" },
+        { 0x4000D7, "SMSG_CONSOLE_WRITE", "ServerToClient" },
+        { 0x400274, "SMSG_CONSUMABLE_TOKEN_BUY_AT_MARKET_PRICE_RESPONSE", "ServerToClient" },
+        { 0x400273, "SMSG_CONSUMABLE_TOKEN_BUY_CHOICE_REQUIRED", "ServerToClient" },
+        { 0x400272, "SMSG_CONSUMABLE_TOKEN_CAN_VETERAN_BUY_RESPONSE", "ServerToClient" },
+        { 0x400276, "SMSG_CONSUMABLE_TOKEN_REDEEM_CONFIRM_REQUIRED", "ServerToClient" },
+        { 0x400277, "SMSG_CONSUMABLE_TOKEN_REDEEM_RESPONSE", "ServerToClient" },
+        { 0x400227, "SMSG_CONTACT_LIST", "ServerToClient" },
+        { 0x4002B7, "SMSG_CONTRIBUTION_LAST_UPDATE_RESPONSE", "ServerToClient" },
+        { 0x4000E9, "SMSG_CONTROL_UPDATE", "ServerToClient" },
+        { 0x4002FF, "SMSG_CONVERT_ITEMS_TO_CURRENCY_VALUE", "ServerToClient" },
+        { 0x4001DA, "SMSG_COOLDOWN_CHEAT", "ServerToClient" },
+        { 0x40015C, "SMSG_COOLDOWN_EVENT", "ServerToClient" },
+        { 0x4000F0, "SMSG_CORPSE_LOCATION", "ServerToClient" },
+        { 0x4001EB, "SMSG_CORPSE_RECLAIM_DELAY", "ServerToClient" },
+        { 0x4001B5, "SMSG_CORPSE_TRANSPORT_QUERY", "ServerToClient" },
+        { 0x5D0024, "SMSG_COVENANT_CALLINGS_AVAILABILITY_RESPONSE", "ServerToClient" },
+        { 0x400298, "SMSG_COVENANT_PREVIEW_OPEN_NPC", "ServerToClient" },
+        { 0x400300, "SMSG_COVENANT_RENOWN_SEND_CATCHUP_STATE", "ServerToClient" },
+        { 0x400335, "SMSG_CRAFT_ENCHANT_RESULT", "ServerToClient" },
+        { 0x400336, "SMSG_CRAFTING_HOUSE_HELLO_RESPONSE", "ServerToClient" },
+        { 0x400332, "SMSG_CRAFTING_ORDER_CANCEL_RESULT", "ServerToClient" },
+        { 0x40032E, "SMSG_CRAFTING_ORDER_CLAIM_RESULT", "ServerToClient" },
+        { 0x400330, "SMSG_CRAFTING_ORDER_CRAFT_RESULT", "ServerToClient" },
+        { 0x40032C, "SMSG_CRAFTING_ORDER_CREATE_RESULT", "ServerToClient" },
+        { 0x400331, "SMSG_CRAFTING_ORDER_FULFILL_RESULT", "ServerToClient" },
+        { 0x40032D, "SMSG_CRAFTING_ORDER_LIST_ORDERS_RESPONSE", "ServerToClient" },
+        { 0x400338, "SMSG_CRAFTING_ORDER_NPC_REWARD_INFO", "ServerToClient" },
+        { 0x400334, "SMSG_CRAFTING_ORDER_REJECT_RESULT", "ServerToClient" },
+        { 0x40032F, "SMSG_CRAFTING_ORDER_RELEASE_RESULT", "ServerToClient" },
+        { 0x400337, "SMSG_CRAFTING_ORDER_UPDATE_STATE", "ServerToClient" },
+        { 0x4001A3, "SMSG_CREATE_CHAR", "ServerToClient" },
+        { 0x400238, "SMSG_CREATE_SHIPMENT_RESPONSE", "ServerToClient" },
+        { 0x40033B, "SMSG_CREATOR_VISUALS_OVERRIDE", "ServerToClient" },
+        { 0x400189, "SMSG_CRITERIA_DELETED", "ServerToClient" },
+        { 0x400183, "SMSG_CRITERIA_UPDATE", "ServerToClient" },
+        { 0x400164, "SMSG_CROSSED_INEBRIATION_THRESHOLD", "ServerToClient" },
+        { 0x40034D, "SMSG_CURRENCY_TRANSFER_LOG", "ServerToClient" },
+        { 0x40034C, "SMSG_CURRENCY_TRANSFER_RESULT", "ServerToClient" },
+        { 0x400068, "SMSG_CUSTOM_LOAD_SCREEN", "ServerToClient" },
+        { 0x5D0000, "SMSG_DAILY_QUESTS_RESET", "ServerToClient" },
+        { 0x5F0054, "SMSG_DAMAGE_CALC_LOG", "ServerToClient" },
+        { 0x440000, "SMSG_DB_REPLY", "ServerToClient" },
+        { 0x400176, "SMSG_DEATH_RELEASE_LOC", "ServerToClient" },
+        { 0x4000F8, "SMSG_DEBUG_MENU_MANAGER_FULL_UPDATE", "ServerToClient" },
+        { 0x45000C, "SMSG_DEFENSE_MESSAGE", "ServerToClient" },
+        { 0x4001A4, "SMSG_DELETE_CHAR", "ServerToClient" },
+        { 0x4A0022, "SMSG_DELETE_EXPIRED_MISSIONS_RESULT", "ServerToClient" },
+        { 0x400352, "SMSG_DELVES_ACCOUNT_DATA_ELEMENT_CHANGED", "ServerToClient" },
+        { 0x4001E3, "SMSG_DESTROY_ARENA_UNIT", "ServerToClient" },
+        { 0x40019B, "SMSG_DESTRUCTIBLE_BUILDING_DAMAGE", "ServerToClient" },
+        { 0x400020, "SMSG_DIFFERENT_INSTANCE_FROM_PARTY", "ServerToClient" },
+        { 0x40003F, "SMSG_DISENCHANT_CREDIT", "ServerToClient" },
+        { 0x400010, "SMSG_DISMOUNT_RESULT", "ServerToClient" },
+        { 0x5F001E, "SMSG_DISPEL_FAILED", "ServerToClient" },
+        { 0x400035, "SMSG_DISPLAY_GAME_ERROR", "ServerToClient" },
+        { 0x5C0004, "SMSG_DISPLAY_PLAYER_CHOICE", "ServerToClient" },
+        { 0x4000ED, "SMSG_DISPLAY_PROMOTION", "ServerToClient" },
+        { 0x5D001E, "SMSG_DISPLAY_QUEST_POPUP", "ServerToClient" },
+        { 0x4000C6, "SMSG_DISPLAY_TOAST", "ServerToClient" },
+        { 0x400289, "SMSG_DISPLAY_WORLD_TEXT", "ServerToClient" },
+        { 0x5F0053, "SMSG_DISPLAY_WORLD_TEXT_ON_TARGET", "ServerToClient" },
+        { 0x40007D, "SMSG_DONT_AUTO_PUSH_SPELLS_TO_ACTION_BAR", "ServerToClient" },
+        { 0x470006, "SMSG_DROP_NEW_CONNECTION", "ServerToClient" },
+        { 0x46001B, "SMSG_DUEL_ARRANGED", "ServerToClient" },
+        { 0x46001F, "SMSG_DUEL_COMPLETE", "ServerToClient" },
+        { 0x46001E, "SMSG_DUEL_COUNTDOWN", "ServerToClient" },
+        { 0x46001D, "SMSG_DUEL_IN_BOUNDS", "ServerToClient" },
+        { 0x46001C, "SMSG_DUEL_OUT_OF_BOUNDS", "ServerToClient" },
+        { 0x46001A, "SMSG_DUEL_REQUESTED", "ServerToClient" },
+        { 0x460020, "SMSG_DUEL_WINNER", "ServerToClient" },
+        { 0x4001E6, "SMSG_DURABILITY_DAMAGE_DEATH", "ServerToClient" },
+        { 0x400264, "SMSG_EMOTE", "ServerToClient" },
+        { 0x40015F, "SMSG_ENABLE_BARBER_SHOP", "ServerToClient" },
+        { 0x4001B6, "SMSG_ENCHANTMENT_LOG", "ServerToClient" },
+        { 0x400220, "SMSG_ENCOUNTER_END", "ServerToClient" },
+        { 0x40021F, "SMSG_ENCOUNTER_START", "ServerToClient" },
+        { 0x40014C, "SMSG_END_LIGHTNING_STORM", "ServerToClient" },
+        { 0x470003, "SMSG_ENTER_ENCRYPTED_MODE", "ServerToClient" },
+        { 0x400018, "SMSG_ENUM_CHARACTERS_RESULT", "ServerToClient" },
+        { 0x40028E, "SMSG_ENUM_VAS_PURCHASE_STATES_RESPONSE", "ServerToClient" },
+        { 0x5F000E, "SMSG_ENVIRONMENTAL_DAMAGE_LOG", "ServerToClient" },
+        { 0x400155, "SMSG_EQUIPMENT_SET_ID", "ServerToClient" },
+        { 0x450005, "SMSG_EXPECTED_SPAM_RECORDS", "ServerToClient" },
+        { 0x400200, "SMSG_EXPLORATION_EXPERIENCE", "ServerToClient" },
+        { 0x4000F5, "SMSG_EXPORT_ACCOUNT_PROFILE", "ServerToClient" },
+        { 0x4002FD, "SMSG_EXTERNAL_TRANSACTION_ID_GENERATED", "ServerToClient" },
+        { 0x4001C6, "SMSG_FACTION_BONUS_INFO", "ServerToClient" },
+        { 0x5C0002, "SMSG_FAILED_PLAYER_CONDITION", "ServerToClient" },
+        { 0x4002AC, "SMSG_FAILED_QUEST_TURN_IN", "ServerToClient" },
+        { 0x40005C, "SMSG_FEATURE_SYSTEM_STATUS", "ServerToClient" },
+        { 0x40034A, "SMSG_FEATURE_SYSTEM_STATUS2", "ServerToClient" },
+        { 0x40005D, "SMSG_FEATURE_SYSTEM_STATUS_GLUE_SCREEN", "ServerToClient" },
+        { 0x4001E5, "SMSG_FEIGN_DEATH_RESISTED", "ServerToClient" },
+        { 0x400173, "SMSG_FISH_ESCAPED", "ServerToClient" },
+        { 0x400172, "SMSG_FISH_NOT_HOOKED", "ServerToClient" },
+        { 0x58005B, "SMSG_FLIGHT_SPLINE_SYNC", "ServerToClient" },
+        { 0x5F0010, "SMSG_FLUSH_COMBAT_LOG_FILE", "ServerToClient" },
+        { 0x4001F2, "SMSG_FORCE_ANIM", "ServerToClient" },
+        { 0x4001F3, "SMSG_FORCE_ANIMATIONS", "ServerToClient" },
+        { 0x400177, "SMSG_FORCED_DEATH_UPDATE", "ServerToClient" },
+        { 0x40004A, "SMSG_FORCE_RANDOM_TRANSMOG_TOAST", "ServerToClient" },
+        { 0x5D0021, "SMSG_FORCE_SPAWN_TRACKING_UPDATE", "ServerToClient" },
+        { 0x400228, "SMSG_FRIEND_STATUS", "ServerToClient" },
+        { 0x40027D, "SMSG_GAIN_MAW_POWER", "ServerToClient" },
+        { 0x400060, "SMSG_GAME_OBJECT_ACTIVATE_ANIM_KIT", "ServerToClient" },
+        { 0x4002C4, "SMSG_GAME_OBJECT_BASE", "ServerToClient" },
+        { 0x400314, "SMSG_GAME_OBJECT_CLOSE_INTERACTION", "ServerToClient" },
+        { 0x400061, "SMSG_GAME_OBJECT_CUSTOM_ANIM", "ServerToClient" },
+        { 0x400062, "SMSG_GAME_OBJECT_DESPAWN", "ServerToClient" },
+        { 0x400313, "SMSG_GAME_OBJECT_INTERACTION", "ServerToClient" },
+        { 0x5F003C, "SMSG_GAME_OBJECT_PLAY_SPELL_VISUAL", "ServerToClient" },
+        { 0x5F003B, "SMSG_GAME_OBJECT_PLAY_SPELL_VISUAL_KIT", "ServerToClient" },
+        { 0x4001C0, "SMSG_GAME_OBJECT_RESET_STATE", "ServerToClient" },
+        { 0x40029F, "SMSG_GAME_OBJECT_SET_STATE_LOCAL", "ServerToClient" },
+        { 0x400125, "SMSG_GAME_SPEED_SET", "ServerToClient" },
+        { 0x4001AF, "SMSG_GAME_TIME_SET", "ServerToClient" },
+        { 0x4001AE, "SMSG_GAME_TIME_UPDATE", "ServerToClient" },
+        { 0x4A0024, "SMSG_GARRISON_ACTIVATE_MISSION_BONUS_ABILITY", "ServerToClient" },
+        { 0x4A0048, "SMSG_GARRISON_ADD_EVENT", "ServerToClient" },
+        { 0x4A0016, "SMSG_GARRISON_ADD_FOLLOWER_RESULT", "ServerToClient" },
+        { 0x4A001A, "SMSG_GARRISON_ADD_MISSION_RESULT", "ServerToClient" },
+        { 0x4A004B, "SMSG_GARRISON_ADD_SPEC_GROUPS", "ServerToClient" },
+        { 0x4A004F, "SMSG_GARRISON_APPLY_TALENT_SOCKET_DATA_CHANGES", "ServerToClient" },
+        { 0x4A002C, "SMSG_GARRISON_ASSIGN_FOLLOWER_TO_BUILDING_RESULT", "ServerToClient" },
+        { 0x4A0051, "SMSG_GARRISON_AUTO_TROOP_MIN_LEVEL_UPDATE_RESULT", "ServerToClient" },
+        { 0x4A000B, "SMSG_GARRISON_BUILDING_ACTIVATED", "ServerToClient" },
+        { 0x4A0004, "SMSG_GARRISON_BUILDING_REMOVED", "ServerToClient" },
+        { 0x4A0006, "SMSG_GARRISON_BUILDING_SET_ACTIVE_SPECIALIZATION_RESULT", "ServerToClient" },
+        { 0x4A001D, "SMSG_GARRISON_CHANGE_MISSION_START_TIME_RESULT", "ServerToClient" },
+        { 0x4A0047, "SMSG_GARRISON_CLEAR_COLLECTION", "ServerToClient" },
+        { 0x4A004A, "SMSG_GARRISON_CLEAR_EVENT_LIST", "ServerToClient" },
+        { 0x4A004C, "SMSG_GARRISON_CLEAR_SPEC_GROUPS", "ServerToClient" },
+        { 0x4A0046, "SMSG_GARRISON_COLLECTION_REMOVE_ENTRY", "ServerToClient" },
+        { 0x4A0045, "SMSG_GARRISON_COLLECTION_UPDATE_ENTRY", "ServerToClient" },
+        { 0x4A003D, "SMSG_GARRISON_COMPLETE_BUILDING_CONSTRUCTION_RESULT", "ServerToClient" },
+        { 0x4A001C, "SMSG_GARRISON_COMPLETE_MISSION_RESULT", "ServerToClient" },
+        { 0x4A000C, "SMSG_GARRISON_CREATE_RESULT", "ServerToClient" },
+        { 0x4A0023, "SMSG_GARRISON_DELETE_MISSION_RESULT", "ServerToClient" },
+        { 0x4A0035, "SMSG_GARRISON_DELETE_RESULT", "ServerToClient" },
+        { 0x4A002B, "SMSG_GARRISON_FOLLOWER_ACTIVATIONS_SET", "ServerToClient" },
+        { 0x4A0029, "SMSG_GARRISON_FOLLOWER_CHANGED_FLAGS", "ServerToClient" },
+        { 0x4A0027, "SMSG_GARRISON_FOLLOWER_CHANGED_ITEM_LEVEL", "ServerToClient" },
+        { 0x4A0028, "SMSG_GARRISON_FOLLOWER_CHANGED_QUALITY", "ServerToClient" },
+        { 0x4A0026, "SMSG_GARRISON_FOLLOWER_CHANGED_XP", "ServerToClient" },
+        { 0x4A002A, "SMSG_GARRISON_FOLLOWER_FATIGUE_CLEARED", "ServerToClient" },
+        { 0x4A0033, "SMSG_GARRISON_GENERATE_FOLLOWERS_RESULT", "ServerToClient" },
+        { 0x4A0015, "SMSG_GARRISON_GET_CLASS_SPEC_CATEGORY_INFO_RESULT", "ServerToClient" },
+        { 0x4A001E, "SMSG_GARRISON_GET_RECALL_PORTAL_LAST_USED_TIME_RESULT", "ServerToClient" },
+        { 0x4A003F, "SMSG_GARRISON_IS_UPGRADEABLE_RESPONSE", "ServerToClient" },
+        { 0x4A0007, "SMSG_GARRISON_LEARN_BLUEPRINT_RESULT", "ServerToClient" },
+        { 0x4A0005, "SMSG_GARRISON_LEARN_SPECIALIZATION_RESULT", "ServerToClient" },
+        { 0x4A0040, "SMSG_GARRISON_LIST_COMPLETED_MISSIONS_CHEAT_RESULT", "ServerToClient" },
+        { 0x4A0019, "SMSG_GARRISON_LIST_FOLLOWERS_CHEAT_RESULT", "ServerToClient" },
+        { 0x4A0042, "SMSG_GARRISON_MAP_DATA_RESPONSE", "ServerToClient" },
+        { 0x4A0020, "SMSG_GARRISON_MISSION_BONUS_ROLL_RESULT", "ServerToClient" },
+        { 0x4A0043, "SMSG_GARRISON_MISSION_REQUEST_REWARD_INFO_RESPONSE", "ServerToClient" },
+        { 0x4A0025, "SMSG_GARRISON_MISSION_START_CONDITION_UPDATE", "ServerToClient" },
+        { 0x4A0037, "SMSG_GARRISON_OPEN_CRAFTER", "ServerToClient" },
+        { 0x4A0030, "SMSG_GARRISON_OPEN_RECRUITMENT_NPC", "ServerToClient" },
+        { 0x4A0003, "SMSG_GARRISON_PLACE_BUILDING_RESULT", "ServerToClient" },
+        { 0x4A0001, "SMSG_GARRISON_PLOT_PLACED", "ServerToClient" },
+        { 0x4A0002, "SMSG_GARRISON_PLOT_REMOVED", "ServerToClient" },
+        { 0x4A0034, "SMSG_GARRISON_RECRUIT_FOLLOWER_RESULT", "ServerToClient" },
+        { 0x4A000A, "SMSG_GARRISON_REMOTE_INFO", "ServerToClient" },
+        { 0x4A0049, "SMSG_GARRISON_REMOVE_EVENT", "ServerToClient" },
+        { 0x4A002F, "SMSG_GARRISON_REMOVE_FOLLOWER_ABILITY_RESULT", "ServerToClient" },
+        { 0x4A002D, "SMSG_GARRISON_REMOVE_FOLLOWER_FROM_BUILDING_RESULT", "ServerToClient" },
+        { 0x4A0017, "SMSG_GARRISON_REMOVE_FOLLOWER_RESULT", "ServerToClient" },
+        { 0x4A002E, "SMSG_GARRISON_RENAME_FOLLOWER_RESULT", "ServerToClient" },
+        { 0x4A0009, "SMSG_GARRISON_REQUEST_BLUEPRINT_AND_SPECIALIZATION_DATA_RESULT", "ServerToClient" },
+        { 0x4A000E, "SMSG_GARRISON_RESEARCH_TALENT_RESULT", "ServerToClient" },
+        { 0x4A0013, "SMSG_GARRISON_RESET_TALENT_TREE", "ServerToClient" },
+        { 0x4A0014, "SMSG_GARRISON_RESET_TALENT_TREE_SOCKET_DATA", "ServerToClient" },
+        { 0x4A001B, "SMSG_GARRISON_START_MISSION_RESULT", "ServerToClient" },
+        { 0x4A003C, "SMSG_GARRISON_SWAP_BUILDINGS_RESPONSE", "ServerToClient" },
+        { 0x4A004D, "SMSG_GARRISON_SWITCH_TALENT_TREE_BRANCH", "ServerToClient" },
+        { 0x4A000F, "SMSG_GARRISON_TALENT_COMPLETED", "ServerToClient" },
+        { 0x4A0010, "SMSG_GARRISON_TALENT_REMOVED", "ServerToClient" },
+        { 0x4A0012, "SMSG_GARRISON_TALENT_REMOVE_SOCKET_DATA", "ServerToClient" },
+        { 0x4A0011, "SMSG_GARRISON_TALENT_UPDATE_SOCKET_DATA", "ServerToClient" },
+        { 0x4A004E, "SMSG_GARRISON_TALENT_WORLD_QUEST_UNLOCKS_RESPONSE", "ServerToClient" },
+        { 0x4A0008, "SMSG_GARRISON_UNLEARN_BLUEPRINT_RESULT", "ServerToClient" },
+        { 0x4A0018, "SMSG_GARRISON_UPDATE_FOLLOWER", "ServerToClient" },
+        { 0x4A003E, "SMSG_GARRISON_UPDATE_GARRISON_MONUMENT_SELECTIONS", "ServerToClient" },
+        { 0x4A0050, "SMSG_GARRISON_UPDATE_MISSION_CHEAT_RESULT", "ServerToClient" },
+        { 0x4A000D, "SMSG_GARRISON_UPGRADE_RESULT", "ServerToClient" },
+        { 0x4A001F, "SMSG_GARRISON_USE_RECALL_PORTAL_RESULT", "ServerToClient" },
+        { 0x40001C, "SMSG_GENERATE_RANDOM_CHARACTER_NAME_RESULT", "ServerToClient" },
+        { 0x4002B8, "SMSG_GENERATE_SSO_TOKEN_RESPONSE", "ServerToClient" },
+        { 0x400202, "SMSG_GET_ACCOUNT_CHARACTER_LIST_RESULT", "ServerToClient" },
+        { 0x4A0000, "SMSG_GET_GARRISON_INFO_RESULT", "ServerToClient" },
+        { 0x40023B, "SMSG_GET_LANDING_PAGE_SHIPMENTS_RESPONSE", "ServerToClient" },
+        { 0x400341, "SMSG_GET_REALM_HIDDEN_RESULT", "ServerToClient" },
+        { 0x400275, "SMSG_GET_REMAINING_GAME_TIME_RESPONSE", "ServerToClient" },
+        { 0x400262, "SMSG_GET_SELECTED_TROPHY_ID_RESPONSE", "ServerToClient" },
+        { 0x400236, "SMSG_GET_SHIPMENT_INFO_RESPONSE", "ServerToClient" },
+        { 0x40023A, "SMSG_GET_SHIPMENTS_OF_TYPE_RESPONSE", "ServerToClient" },
+        { 0x400261, "SMSG_GET_TROPHY_LIST_RESPONSE", "ServerToClient" },
+        { 0x40028A, "SMSG_GET_VAS_ACCOUNT_CHARACTER_LIST_RESULT", "ServerToClient" },
+        { 0x40028B, "SMSG_GET_VAS_TRANSFER_TARGET_REALM_LIST_RESULT", "ServerToClient" },
+        { 0x5C000E, "SMSG_GM_PLAYER_INFO", "ServerToClient" },
+        { 0x5C0003, "SMSG_GM_REQUEST_PLAYER_INFO", "ServerToClient" },
+        { 0x400147, "SMSG_GM_TICKET_CASE_STATUS", "ServerToClient" },
+        { 0x400146, "SMSG_GM_TICKET_SYSTEM_STATUS", "ServerToClient" },
+        { 0x40019E, "SMSG_GOD_MODE", "ServerToClient" },
+        { 0x5D0017, "SMSG_GOSSIP_COMPLETE", "ServerToClient" },
+        { 0x5D0018, "SMSG_GOSSIP_MESSAGE", "ServerToClient" },
+        { 0x5D0028, "SMSG_GOSSIP_OPTION_NPC_INTERACTION", "ServerToClient" },
+        { 0x400233, "SMSG_GOSSIP_POI", "ServerToClient" },
+        { 0x5D0019, "SMSG_GOSSIP_QUEST_UPDATE", "ServerToClient" },
+        { 0x5D0027, "SMSG_GOSSIP_REFRESH_OPTIONS", "ServerToClient" },
+        { 0x400024, "SMSG_GROUP_ACTION_THROTTLED", "ServerToClient" },
+        { 0x400230, "SMSG_GROUP_AUTO_KICK", "ServerToClient" },
+        { 0x40022C, "SMSG_GROUP_DECLINE", "ServerToClient" },
+        { 0x40022F, "SMSG_GROUP_DESTROYED", "ServerToClient" },
+        { 0x4000CF, "SMSG_GROUP_NEW_LEADER", "ServerToClient" },
+        { 0x40022D, "SMSG_GROUP_REQUEST_DECLINE", "ServerToClient" },
+        { 0x40022E, "SMSG_GROUP_UNINVITE", "ServerToClient" },
+        { 0x4C000D, "SMSG_GUILD_ACHIEVEMENT_DELETED", "ServerToClient" },
+        { 0x4C000C, "SMSG_GUILD_ACHIEVEMENT_EARNED", "ServerToClient" },
+        { 0x4C000F, "SMSG_GUILD_ACHIEVEMENT_MEMBERS", "ServerToClient" },
+        { 0x4C0027, "SMSG_GUILD_BANK_LOG_QUERY_RESULTS", "ServerToClient" },
+        { 0x4C0026, "SMSG_GUILD_BANK_QUERY_RESULTS", "ServerToClient" },
+        { 0x4C0028, "SMSG_GUILD_BANK_REMAINING_WITHDRAW_MONEY", "ServerToClient" },
+        { 0x4C002B, "SMSG_GUILD_BANK_TEXT_QUERY_RESULT", "ServerToClient" },
+        { 0x4C001B, "SMSG_GUILD_CHALLENGE_COMPLETED", "ServerToClient" },
+        { 0x4C001A, "SMSG_GUILD_CHALLENGE_UPDATE", "ServerToClient" },
+        { 0x4C0025, "SMSG_GUILD_CHANGE_NAME_RESULT", "ServerToClient" },
+        { 0x4C0002, "SMSG_GUILD_COMMAND_RESULT", "ServerToClient" },
+        { 0x4C000E, "SMSG_GUILD_CRITERIA_DELETED", "ServerToClient" },
+        { 0x4C000B, "SMSG_GUILD_CRITERIA_UPDATE", "ServerToClient" },
+        { 0x4C0040, "SMSG_GUILD_EVENT_BANK_CONTENTS_CHANGED", "ServerToClient" },
+        { 0x4C003F, "SMSG_GUILD_EVENT_BANK_MONEY_CHANGED", "ServerToClient" },
+        { 0x4C0035, "SMSG_GUILD_EVENT_DISBANDED", "ServerToClient" },
+        { 0x4C002A, "SMSG_GUILD_EVENT_LOG_QUERY_RESULTS", "ServerToClient" },
+        { 0x4C0036, "SMSG_GUILD_EVENT_MOTD", "ServerToClient" },
+        { 0x4C0034, "SMSG_GUILD_EVENT_NEW_LEADER", "ServerToClient" },
+        { 0x4C0032, "SMSG_GUILD_EVENT_PLAYER_JOINED", "ServerToClient" },
+        { 0x4C0033, "SMSG_GUILD_EVENT_PLAYER_LEFT", "ServerToClient" },
+        { 0x4C0037, "SMSG_GUILD_EVENT_PRESENCE_CHANGE", "ServerToClient" },
+        { 0x4C003A, "SMSG_GUILD_EVENT_RANK_CHANGED", "ServerToClient" },
+        { 0x4C0039, "SMSG_GUILD_EVENT_RANKS_UPDATED", "ServerToClient" },
+        { 0x4C0038, "SMSG_GUILD_EVENT_STATUS_CHANGE", "ServerToClient" },
+        { 0x4C003B, "SMSG_GUILD_EVENT_TAB_ADDED", "ServerToClient" },
+        { 0x4C003C, "SMSG_GUILD_EVENT_TAB_DELETED", "ServerToClient" },
+        { 0x4C003D, "SMSG_GUILD_EVENT_TAB_MODIFIED", "ServerToClient" },
+        { 0x4C003E, "SMSG_GUILD_EVENT_TAB_TEXT_CHANGED", "ServerToClient" },
+        { 0x4C0024, "SMSG_GUILD_FLAGGED_FOR_RENAME", "ServerToClient" },
+        { 0x4C0004, "SMSG_GUILD_HARDCORE_MEMBER_DEATH", "ServerToClient" },
+        { 0x4C0012, "SMSG_GUILD_INVITE", "ServerToClient" },
+        { 0x4C0030, "SMSG_GUILD_INVITE_DECLINED", "ServerToClient" },
+        { 0x4C0031, "SMSG_GUILD_INVITE_EXPIRED", "ServerToClient" },
+        { 0x4C001C, "SMSG_GUILD_ITEM_LOOTED_NOTIFY", "ServerToClient" },
+        { 0x4C0006, "SMSG_GUILD_KNOWN_RECIPES", "ServerToClient" },
+        { 0x4C002C, "SMSG_GUILD_MEMBER_DAILY_RESET", "ServerToClient" },
+        { 0x4C0005, "SMSG_GUILD_MEMBER_RECIPES", "ServerToClient" },
+        { 0x4C0007, "SMSG_GUILD_MEMBERS_WITH_RECIPE", "ServerToClient" },
+        { 0x4C0011, "SMSG_GUILD_MEMBER_UPDATE_NOTE", "ServerToClient" },
+        { 0x4C0022, "SMSG_GUILD_MOVED", "ServerToClient" },
+        { 0x4C0021, "SMSG_GUILD_MOVE_STARTING", "ServerToClient" },
+        { 0x4C0023, "SMSG_GUILD_NAME_CHANGED", "ServerToClient" },
+        { 0x4C0009, "SMSG_GUILD_NEWS", "ServerToClient" },
+        { 0x4C000A, "SMSG_GUILD_NEWS_DELETED", "ServerToClient" },
+        { 0x4C0047, "SMSG_GUILD_OTHERS_OWNED_HOUSES_RESULT", "ServerToClient" },
+        { 0x4C0013, "SMSG_GUILD_PARTY_STATE", "ServerToClient" },
+        { 0x4C0029, "SMSG_GUILD_PERMISSIONS_QUERY_RESULTS", "ServerToClient" },
+        { 0x4C0010, "SMSG_GUILD_RANKS", "ServerToClient" },
+        { 0x4C0044, "SMSG_GUILD_RENAME_NAME_CHECK", "ServerToClient" },
+        { 0x4C0046, "SMSG_GUILD_RENAME_REFUND_RESULT", "ServerToClient" },
+        { 0x4C0045, "SMSG_GUILD_RENAME_REQUESTED_RESULT", "ServerToClient" },
+        { 0x4C0043, "SMSG_GUILD_RENAME_STATUS_UPDATE", "ServerToClient" },
+        { 0x4C0014, "SMSG_GUILD_REPUTATION_REACTION_CHANGED", "ServerToClient" },
+        { 0x4C0020, "SMSG_GUILD_RESET", "ServerToClient" },
+        { 0x4C0008, "SMSG_GUILD_REWARD_LIST", "ServerToClient" },
+        { 0x4C0003, "SMSG_GUILD_ROSTER", "ServerToClient" },
+        { 0x4C0001, "SMSG_GUILD_SEND_RANK_CHANGE", "ServerToClient" },
+        { 0x400349, "SMSG_HARDCORE_DEATH_ALERT", "ServerToClient" },
+        { 0x400174, "SMSG_HEALTH_UPDATE", "ServerToClient" },
+        { 0x40017C, "SMSG_HIGHEST_THREAT_UPDATE", "ServerToClient" },
+        { 0x440003, "SMSG_HOTFIX_CONNECT", "ServerToClient" },
+        { 0x440002, "SMSG_HOTFIX_MESSAGE", "ServerToClient" },
+        { 0x4E0000, "SMSG_HOUSE_EXTERIOR_LOCK_RESPONSE", "ServerToClient" },
+        { 0x4E0001, "SMSG_HOUSE_EXTERIOR_SET_HOUSE_POSITION_RESPONSE", "ServerToClient" },
+        { 0x4F0007, "SMSG_HOUSING_DECOR_ADD_TO_HOUSE_CHEST_RESPONSE", "ServerToClient" },
+        { 0x4F0005, "SMSG_HOUSING_DECOR_DELETE_FROM_STORAGE_RESPONSE", "ServerToClient" },
+        { 0x4F0004, "SMSG_HOUSING_DECOR_LOCK_RESPONSE", "ServerToClient" },
+        { 0x4F0001, "SMSG_HOUSING_DECOR_MOVE_RESPONSE", "ServerToClient" },
+        { 0x4F0002, "SMSG_HOUSING_DECOR_PLACE_RESPONSE", "ServerToClient" },
+        { 0x4F0003, "SMSG_HOUSING_DECOR_REMOVE_RESPONSE", "ServerToClient" },
+        { 0x4F0006, "SMSG_HOUSING_DECOR_REQUEST_STORAGE_RESPONSE", "ServerToClient" },
+        { 0x4F0000, "SMSG_HOUSING_DECOR_SET_EDIT_MODE_RESPONSE", "ServerToClient" },
+        { 0x4F0008, "SMSG_HOUSING_DECOR_SYSTEM_SET_DYE_SLOTS_RESPONSE", "ServerToClient" },
+        { 0x530003, "SMSG_HOUSING_EXPORT_HOUSE_RESPONSE", "ServerToClient" },
+        { 0x4F000A, "SMSG_HOUSING_FIRST_TIME_DECOR_ACQUISITION", "ServerToClient" },
+        { 0x500001, "SMSG_HOUSING_FIXTURE_CREATE_BASIC_HOUSE_RESPONSE", "ServerToClient" },
+        { 0x500006, "SMSG_HOUSING_FIXTURE_CREATE_FIXTURE_RESPONSE", "ServerToClient" },
+        { 0x500007, "SMSG_HOUSING_FIXTURE_DELETE_FIXTURE_RESPONSE", "ServerToClient" },
+        { 0x500002, "SMSG_HOUSING_FIXTURE_DELETE_HOUSE_RESPONSE", "ServerToClient" },
+        { 0x500005, "SMSG_HOUSING_FIXTURE_SET_CORE_FIXTURE_RESPONSE", "ServerToClient" },
+        { 0x500000, "SMSG_HOUSING_FIXTURE_SET_EDIT_MODE_RESPONSE", "ServerToClient" },
+        { 0x500003, "SMSG_HOUSING_FIXTURE_SET_HOUSE_SIZE_RESPONSE", "ServerToClient" },
+        { 0x500004, "SMSG_HOUSING_FIXTURE_SET_HOUSE_TYPE_RESPONSE", "ServerToClient" },
+        { 0x530001, "SMSG_HOUSING_GET_CURRENT_HOUSE_INFO_RESPONSE", "ServerToClient" },
+        { 0x530006, "SMSG_HOUSING_GET_PLAYER_PERMISSIONS_RESPONSE", "ServerToClient" },
+        { 0x530000, "SMSG_HOUSING_HOUSE_STATUS_RESPONSE", "ServerToClient" },
+        { 0x4F0009, "SMSG_HOUSING_REDEEM_DEFERRED_DECOR_RESPONSE", "ServerToClient" },
+        { 0x530007, "SMSG_HOUSING_RESET_KIOSK_MODE_RESPONSE", "ServerToClient" },
+        { 0x510001, "SMSG_HOUSING_ROOM_ADD_RESPONSE", "ServerToClient" },
+        { 0x510005, "SMSG_HOUSING_ROOM_APPLY_COMPONENT_MATERIALS_RESPONSE", "ServerToClient" },
+        { 0x510002, "SMSG_HOUSING_ROOM_REMOVE_RESPONSE", "ServerToClient" },
+        { 0x510007, "SMSG_HOUSING_ROOM_SET_CEILING_TYPE_RESPONSE", "ServerToClient" },
+        { 0x510004, "SMSG_HOUSING_ROOM_SET_COMPONENT_THEME_RESPONSE", "ServerToClient" },
+        { 0x510006, "SMSG_HOUSING_ROOM_SET_DOOR_TYPE_RESPONSE", "ServerToClient" },
+        { 0x510000, "SMSG_HOUSING_ROOM_SET_LAYOUT_EDIT_MODE_RESPONSE", "ServerToClient" },
+        { 0x510003, "SMSG_HOUSING_ROOM_UPDATE_RESPONSE", "ServerToClient" },
+        { 0x520021, "SMSG_HOUSING_SVC_REQUEST_PLAYER_RELOAD_DATA", "ServerToClient" },
+        { 0x520018, "SMSG_HOUSING_SVCS_ACCEPT_NEIGHBORHOOD_OWNERSHIP_RESPONSE", "ServerToClient" },
+        { 0x520008, "SMSG_HOUSING_SVCS_CANCEL_RELINQUISH_HOUSE_RESPONSE", "ServerToClient" },
+        { 0x520011, "SMSG_HOUSING_SVCS_CHANGE_HOUSE_COSMETIC_OWNER", "ServerToClient" },
+        { 0x520005, "SMSG_HOUSING_SVCS_CLEAR_PLOT_RESERVATION_RESPONSE", "ServerToClient" },
+        { 0x520003, "SMSG_HOUSING_SVCS_CREATE_CHARTER_NEIGHBORHOOD_RESPONSE", "ServerToClient" },
+        { 0x520022, "SMSG_HOUSING_SVCS_DELETE_ALL_NEIGHBORHOOD_INVITES_RESPONSE", "ServerToClient" },
+        { 0x52001F, "SMSG_HOUSING_SVCS_GET_BNET_FRIEND_NEIGHBORHOODS_RESPONSE", "ServerToClient" },
+        { 0x52001D, "SMSG_HOUSING_SVCS_GET_HOUSE_FINDER_INFO_RESPONSE", "ServerToClient" },
+        { 0x52001E, "SMSG_HOUSING_SVCS_GET_HOUSE_FINDER_NEIGHBORHOOD_RESPONSE", "ServerToClient" },
+        { 0x52000C, "SMSG_HOUSING_SVCS_GET_PLAYER_HOUSES_INFO_RESPONSE", "ServerToClient" },
+        { 0x52001B, "SMSG_HOUSING_SVCS_GET_POTENTIAL_HOUSE_OWNERS_RESPONSE", "ServerToClient" },
+        { 0x520013, "SMSG_HOUSING_SVCS_GUILD_ADD_HOUSE_NOTIFICATION", "ServerToClient" },
+        { 0x520015, "SMSG_HOUSING_SVCS_GUILD_APPEND_NEIGHBORHOOD_NOTIFICATION", "ServerToClient" },
+        { 0x520001, "SMSG_HOUSING_SVCS_GUILD_CREATE_NEIGHBORHOOD_NOTIFICATION", "ServerToClient" },
+        { 0x520017, "SMSG_HOUSING_SVCS_GUILD_GET_HOUSING_INFO_RESPONSE", "ServerToClient" },
+        { 0x520014, "SMSG_HOUSING_SVCS_GUILD_REMOVE_HOUSE_NOTIFICATION", "ServerToClient" },
+        { 0x520016, "SMSG_HOUSING_SVCS_GUILD_RENAME_NEIGHBORHOOD_NOTIFICATION", "ServerToClient" },
+        { 0x520020, "SMSG_HOUSING_SVCS_HOUSE_FINDER_FORCE_REFRESH", "ServerToClient" },
+        { 0x52001A, "SMSG_HOUSING_SVCS_NEIGHBORHOOD_OWNERSHIP_TRANSFERRED_RESPONSE", "ServerToClient" },
+        { 0x520004, "SMSG_HOUSING_SVCS_NEIGHBORHOOD_RESERVE_PLOT_RESPONSE", "ServerToClient" },
+        { 0x520000, "SMSG_HOUSING_SVCS_NOTIFY_PERMISSIONS_FAILURE", "ServerToClient" },
+        { 0x52000D, "SMSG_HOUSING_SVCS_PLAYER_VIEW_HOUSES_RESPONSE", "ServerToClient" },
+        { 0x520019, "SMSG_HOUSING_SVCS_REJECT_NEIGHBORHOOD_OWNERSHIP_RESPONSE", "ServerToClient" },
+        { 0x520007, "SMSG_HOUSING_SVCS_RELINQUISH_HOUSE_RESPONSE", "ServerToClient" },
+        { 0x52001C, "SMSG_HOUSING_SVCS_UPDATE_HOUSE_SETTINGS_RESPONSE", "ServerToClient" },
+        { 0x520012, "SMSG_HOUSING_SVCS_UPDATE_HOUSES_LEVEL_FAVOR", "ServerToClient" },
+        { 0x4001C5, "SMSG_INITIALIZE_FACTIONS", "ServerToClient" },
+        { 0x400014, "SMSG_INITIAL_SETUP", "ServerToClient" },
+        { 0x4001E7, "SMSG_INIT_WORLD_STATES", "ServerToClient" },
+        { 0x4000D3, "SMSG_INSPECT_RESULT", "ServerToClient" },
+        { 0x400097, "SMSG_INSTANCE_ABANDON_VOTE_COMPLETED", "ServerToClient" },
+        { 0x400098, "SMSG_INSTANCE_ABANDON_VOTE_PLAYER_LEFT", "ServerToClient" },
+        { 0x400096, "SMSG_INSTANCE_ABANDON_VOTE_RESPONSE", "ServerToClient" },
+        { 0x400095, "SMSG_INSTANCE_ABANDON_VOTE_STARTED", "ServerToClient" },
+        { 0x40024D, "SMSG_INSTANCE_ENCOUNTER_CHANGE_PRIORITY", "ServerToClient" },
+        { 0x40024C, "SMSG_INSTANCE_ENCOUNTER_DISENGAGE_UNIT", "ServerToClient" },
+        { 0x400255, "SMSG_INSTANCE_ENCOUNTER_END", "ServerToClient" },
+        { 0x40024B, "SMSG_INSTANCE_ENCOUNTER_ENGAGE_UNIT", "ServerToClient" },
+        { 0x400257, "SMSG_INSTANCE_ENCOUNTER_GAIN_COMBAT_RESURRECTION_CHARGE", "ServerToClient" },
+        { 0x400256, "SMSG_INSTANCE_ENCOUNTER_IN_COMBAT_RESURRECTION", "ServerToClient" },
+        { 0x400250, "SMSG_INSTANCE_ENCOUNTER_OBJECTIVE_COMPLETE", "ServerToClient" },
+        { 0x40024F, "SMSG_INSTANCE_ENCOUNTER_OBJECTIVE_START", "ServerToClient" },
+        { 0x400254, "SMSG_INSTANCE_ENCOUNTER_OBJECTIVE_UPDATE", "ServerToClient" },
+        { 0x400258, "SMSG_INSTANCE_ENCOUNTER_PHASE_SHIFT_CHANGED", "ServerToClient" },
+        { 0x400251, "SMSG_INSTANCE_ENCOUNTER_START", "ServerToClient" },
+        { 0x40024E, "SMSG_INSTANCE_ENCOUNTER_TIMER_START", "ServerToClient" },
+        { 0x400253, "SMSG_INSTANCE_ENCOUNTER_UPDATE_ALLOW_RELEASE_IN_PROGRESS", "ServerToClient" },
+        { 0x400252, "SMSG_INSTANCE_ENCOUNTER_UPDATE_SUPPRESS_RELEASE", "ServerToClient" },
+        { 0x40019C, "SMSG_INSTANCE_GROUP_SIZE_CHANGED", "ServerToClient" },
+        { 0x4000D6, "SMSG_INSTANCE_INFO", "ServerToClient" },
+        { 0x40012A, "SMSG_INSTANCE_RESET", "ServerToClient" },
+        { 0x40012B, "SMSG_INSTANCE_RESET_FAILED", "ServerToClient" },
+        { 0x40021E, "SMSG_INSTANCE_SAVE_CREATED", "ServerToClient" },
+        { 0x5F004A, "SMSG_INTERRUPT_POWER_REGEN", "ServerToClient" },
+        { 0x440013, "SMSG_INVALIDATE_NEIGHBORHOOD_NAME", "ServerToClient" },
+        { 0x44000A, "SMSG_INVALIDATE_PAGE_TEXT", "ServerToClient" },
+        { 0x5C0007, "SMSG_INVALIDATE_PLAYER", "ServerToClient" },
+        { 0x4001F4, "SMSG_INVALID_PROMOTION_CODE", "ServerToClient" },
+        { 0x600005, "SMSG_INVENTORY_CHANGE_FAILURE", "ServerToClient" },
+        { 0x4002AE, "SMSG_INVENTORY_FIXUP_COMPLETE", "ServerToClient" },
+        { 0x4002C0, "SMSG_INVENTORY_FULL_OVERFLOW", "ServerToClient" },
+        { 0x4001FD, "SMSG_ISLAND_AZERITE_GAIN", "ServerToClient" },
+        { 0x4001FE, "SMSG_ISLAND_COMPLETE", "ServerToClient" },
+        { 0x5D0004, "SMSG_IS_QUEST_COMPLETE_RESPONSE", "ServerToClient" },
+        { 0x40018D, "SMSG_ITEM_CHANGED", "ServerToClient" },
+        { 0x400263, "SMSG_ITEM_COOLDOWN", "ServerToClient" },
+        { 0x4001F6, "SMSG_ITEM_ENCHANT_TIME_UPDATE", "ServerToClient" },
+        { 0x400034, "SMSG_ITEM_EXPIRE_PURCHASE_REFUND", "ServerToClient" },
+        { 0x4002F5, "SMSG_ITEM_INTERACTION_COMPLETE", "ServerToClient" },
+        { 0x400032, "SMSG_ITEM_PURCHASE_REFUND_RESULT", "ServerToClient" },
+        { 0x4000C5, "SMSG_ITEM_PUSH_RESULT", "ServerToClient" },
+        { 0x4001F5, "SMSG_ITEM_TIME_UPDATE", "ServerToClient" },
+        { 0x40012D, "SMSG_KICK_REASON", "ServerToClient" },
+        { 0x400305, "SMSG_LATENCY_REPORT_PING", "ServerToClient" },
+        { 0x5F003E, "SMSG_LEARNED_SPELLS", "ServerToClient" },
+        { 0x400071, "SMSG_LEARN_PVP_TALENT_FAILED", "ServerToClient" },
+        { 0x400070, "SMSG_LEARN_TALENT_FAILED", "ServerToClient" },
+        { 0x4002C5, "SMSG_LEGACY_LOOT_RULES", "ServerToClient" },
+        { 0x4002DB, "SMSG_LEVEL_LINKING_RESULT", "ServerToClient" },
+        { 0x40018B, "SMSG_LEVEL_UP_INFO", "ServerToClient" },
+        { 0x540019, "SMSG_LFG_BOOT_PLAYER", "ServerToClient" },
+        { 0x540017, "SMSG_LFG_DISABLED", "ServerToClient" },
+        { 0x54001F, "SMSG_LFG_EXPAND_SEARCH_PROMPT", "ServerToClient" },
+        { 0x540009, "SMSG_LFG_INSTANCE_SHUTDOWN_COUNTDOWN", "ServerToClient" },
+        { 0x540020, "SMSG_LFG_JOIN_LOBBY_MATCHMAKER_QUEUE", "ServerToClient" },
+        { 0x540000, "SMSG_LFG_JOIN_RESULT", "ServerToClient" },
+        { 0x54000F, "SMSG_LFG_LIST_APPLICANT_LIST_UPDATE", "ServerToClient" },
+        { 0x54000C, "SMSG_LFG_LIST_APPLICATION_STATUS_UPDATE", "ServerToClient" },
+        { 0x54000D, "SMSG_LFG_LIST_APPLY_TO_GROUP_RESULT", "ServerToClient" },
+        { 0x540001, "SMSG_LFG_LIST_JOIN_RESULT", "ServerToClient" },
+        { 0x540002, "SMSG_LFG_LIST_SEARCH_RESULTS", "ServerToClient" },
+        { 0x540010, "SMSG_LFG_LIST_SEARCH_RESULTS_UPDATE", "ServerToClient" },
+        { 0x540003, "SMSG_LFG_LIST_SEARCH_STATUS", "ServerToClient" },
+        { 0x54000E, "SMSG_LFG_LIST_UPDATE_BLACKLIST", "ServerToClient" },
+        { 0x54000B, "SMSG_LFG_LIST_UPDATE_EXPIRATION", "ServerToClient" },
+        { 0x54000A, "SMSG_LFG_LIST_UPDATE_STATUS", "ServerToClient" },
+        { 0x540018, "SMSG_LFG_OFFER_CONTINUE", "ServerToClient" },
+        { 0x54001A, "SMSG_LFG_PARTY_INFO", "ServerToClient" },
+        { 0x54001B, "SMSG_LFG_PLAYER_INFO", "ServerToClient" },
+        { 0x54001C, "SMSG_LFG_PLAYER_REWARD", "ServerToClient" },
+        { 0x540011, "SMSG_LFG_PROPOSAL_UPDATE", "ServerToClient" },
+        { 0x540004, "SMSG_LFG_QUEUE_STATUS", "ServerToClient" },
+        { 0x54001E, "SMSG_LFG_READY_CHECK_RESULT", "ServerToClient" },
+        { 0x540006, "SMSG_LFG_READY_CHECK_UPDATE", "ServerToClient" },
+        { 0x540005, "SMSG_LFG_ROLE_CHECK_UPDATE", "ServerToClient" },
+        { 0x540014, "SMSG_LFG_SLOT_INVALID", "ServerToClient" },
+        { 0x540021, "SMSG_LFG_SUSPEND_LOREWALKING", "ServerToClient" },
+        { 0x540016, "SMSG_LFG_TELEPORT_DENIED", "ServerToClient" },
+        { 0x540008, "SMSG_LFG_UPDATE_STATUS", "ServerToClient" },
+        { 0x400210, "SMSG_LIVE_REGION_ACCOUNT_RESTORE_RESULT", "ServerToClient" },
+        { 0x40020F, "SMSG_LIVE_REGION_CHARACTER_COPY_RESULT", "ServerToClient" },
+        { 0x400203, "SMSG_LIVE_REGION_GET_ACCOUNT_CHARACTER_LIST_RESULT", "ServerToClient" },
+        { 0x400211, "SMSG_LIVE_REGION_KEY_BINDINGS_COPY_RESULT", "ServerToClient" },
+        { 0x400059, "SMSG_LOAD_CUF_PROFILES", "ServerToClient" },
+        { 0x4001B1, "SMSG_LOAD_EQUIPMENT_SET", "ServerToClient" },
+        { 0x400316, "SMSG_LOBBY_MATCHMAKER_LOBBY_ACQUIRED_SERVER", "ServerToClient" },
+        { 0x400317, "SMSG_LOBBY_MATCHMAKER_PARTY_INFO", "ServerToClient" },
+        { 0x400318, "SMSG_LOBBY_MATCHMAKER_PARTY_INVITE_REJECTED", "ServerToClient" },
+        { 0x40031A, "SMSG_LOBBY_MATCHMAKER_QUEUE_PROPOSED", "ServerToClient" },
+        { 0x40031B, "SMSG_LOBBY_MATCHMAKER_QUEUE_RESULT", "ServerToClient" },
+        { 0x400319, "SMSG_LOBBY_MATCHMAKER_RECEIVE_INVITE", "ServerToClient" },
+        { 0x4001B0, "SMSG_LOGIN_SET_TIME_SPEED", "ServerToClient" },
+        { 0x40002F, "SMSG_LOGIN_VERIFY_WORLD", "ServerToClient" },
+        { 0x400129, "SMSG_LOGOUT_CANCEL_ACK", "ServerToClient" },
+        { 0x400128, "SMSG_LOGOUT_COMPLETE", "ServerToClient" },
+        { 0x400127, "SMSG_LOGOUT_RESPONSE", "ServerToClient" },
+        { 0x400187, "SMSG_LOG_XP_GAIN", "ServerToClient" },
+        { 0x4000C3, "SMSG_LOOT_ALL_PASSED", "ServerToClient" },
+        { 0x4001E2, "SMSG_LOOT_LIST", "ServerToClient" },
+        { 0x4000BE, "SMSG_LOOT_MONEY_NOTIFY", "ServerToClient" },
+        { 0x4000BD, "SMSG_LOOT_RELEASE", "ServerToClient" },
+        { 0x4000BC, "SMSG_LOOT_RELEASE_ALL", "ServerToClient" },
+        { 0x4000B8, "SMSG_LOOT_REMOVED", "ServerToClient" },
+        { 0x4000B7, "SMSG_LOOT_RESPONSE", "ServerToClient" },
+        { 0x4000C0, "SMSG_LOOT_ROLL", "ServerToClient" },
+        { 0x4000C2, "SMSG_LOOT_ROLLS_COMPLETE", "ServerToClient" },
+        { 0x4000C4, "SMSG_LOOT_ROLL_WON", "ServerToClient" },
+        { 0x400113, "SMSG_LOSS_OF_CONTROL_AURA_UPDATE", "ServerToClient" },
+        { 0x4000DD, "SMSG_MAIL_COMMAND_RESULT", "ServerToClient" },
+        { 0x4001F7, "SMSG_MAIL_LIST_RESULT", "ServerToClient" },
+        { 0x4001F8, "SMSG_MAIL_QUERY_NEXT_TIME_RESULT", "ServerToClient" },
+        { 0x46002A, "SMSG_MAP_OBJECTIVES_INIT", "ServerToClient" },
+        { 0x400063, "SMSG_MAP_OBJ_EVENTS", "ServerToClient" },
+        { 0x4000C1, "SMSG_MASTER_LOOT_CANDIDATE_LIST", "ServerToClient" },
+        { 0x40031C, "SMSG_MEETING_STONE_FAILED", "ServerToClient" },
+        { 0x40000A, "SMSG_MESSAGE_BOX", "ServerToClient" },
+        { 0x400171, "SMSG_MINIMAP_PING", "ServerToClient" },
+        { 0x5F0004, "SMSG_MIRROR_IMAGE_COMPONENTED_DATA", "ServerToClient" },
+        { 0x5F0003, "SMSG_MIRROR_IMAGE_CREATURE_DATA", "ServerToClient" },
+        { 0x40035D, "SMSG_MIRROR_VARS", "ServerToClient" },
+        { 0x400064, "SMSG_MISSILE_CANCEL", "ServerToClient" },
+        { 0x400205, "SMSG_MODIFY_COOLDOWN", "ServerToClient" },
+        { 0x450003, "SMSG_MOTD", "ServerToClient" },
+        { 0x40000F, "SMSG_MOUNT_RESULT", "ServerToClient" },
+        { 0x580062, "SMSG_MOVE_ADD_IMPULSE", "ServerToClient" },
+        { 0x58005E, "SMSG_MOVE_APPLY_INERTIA", "ServerToClient" },
+        { 0x580045, "SMSG_MOVE_APPLY_MOVEMENT_FORCE", "ServerToClient" },
+        { 0x580041, "SMSG_MOVE_DISABLE_COLLISION", "ServerToClient" },
+        { 0x58002B, "SMSG_MOVE_DISABLE_DOUBLE_JUMP", "ServerToClient" },
+        { 0x580075, "SMSG_MOVE_DISABLE_FULL_SPEED_TURNING", "ServerToClient" },
+        { 0x58003D, "SMSG_MOVE_DISABLE_GRAVITY", "ServerToClient" },
+        { 0x58003F, "SMSG_MOVE_DISABLE_INERTIA", "ServerToClient" },
+        { 0x58003C, "SMSG_MOVE_DISABLE_TRANSITION_BETWEEN_SWIM_AND_FLY", "ServerToClient" },
+        { 0x580042, "SMSG_MOVE_ENABLE_COLLISION", "ServerToClient" },
+        { 0x58002A, "SMSG_MOVE_ENABLE_DOUBLE_JUMP", "ServerToClient" },
+        { 0x580074, "SMSG_MOVE_ENABLE_FULL_SPEED_TURNING", "ServerToClient" },
+        { 0x58003E, "SMSG_MOVE_ENABLE_GRAVITY", "ServerToClient" },
+        { 0x580040, "SMSG_MOVE_ENABLE_INERTIA", "ServerToClient" },
+        { 0x58003B, "SMSG_MOVE_ENABLE_TRANSITION_BETWEEN_SWIM_AND_FLY", "ServerToClient" },
+        { 0x580031, "SMSG_MOVE_KNOCK_BACK", "ServerToClient" },
+        { 0x4002CB, "SMSG_MOVEMENT_ENFORCEMENT_ALERT", "ServerToClient" },
+        { 0x58005F, "SMSG_MOVE_REMOVE_INERTIA", "ServerToClient" },
+        { 0x580046, "SMSG_MOVE_REMOVE_MOVEMENT_FORCE", "ServerToClient" },
+        { 0x580027, "SMSG_MOVE_ROOT", "ServerToClient" },
+        { 0x580003, "SMSG_MOVE_SET_ACTIVE_MOVER", "ServerToClient" },
+        { 0x58006B, "SMSG_MOVE_SET_ADV_FLYING_ADD_IMPULSE_MAX_SPEED", "ServerToClient" },
+        { 0x580066, "SMSG_MOVE_SET_ADV_FLYING_AIR_FRICTION", "ServerToClient" },
+        { 0x58006C, "SMSG_MOVE_SET_ADV_FLYING_BANKING_RATE", "ServerToClient" },
+        { 0x580069, "SMSG_MOVE_SET_ADV_FLYING_DOUBLE_JUMP_VEL_MOD", "ServerToClient" },
+        { 0x58006A, "SMSG_MOVE_SET_ADV_FLYING_GLIDE_START_MIN_HEIGHT", "ServerToClient" },
+        { 0x580072, "SMSG_MOVE_SET_ADV_FLYING_LAUNCH_SPEED_COEFFICIENT", "ServerToClient" },
+        { 0x580068, "SMSG_MOVE_SET_ADV_FLYING_LIFT_COEFFICIENT", "ServerToClient" },
+        { 0x580067, "SMSG_MOVE_SET_ADV_FLYING_MAX_VEL", "ServerToClient" },
+        { 0x580071, "SMSG_MOVE_SET_ADV_FLYING_OVER_MAX_DECELERATION", "ServerToClient" },
+        { 0x58006D, "SMSG_MOVE_SET_ADV_FLYING_PITCHING_RATE_DOWN", "ServerToClient" },
+        { 0x58006E, "SMSG_MOVE_SET_ADV_FLYING_PITCHING_RATE_UP", "ServerToClient" },
+        { 0x580070, "SMSG_MOVE_SET_ADV_FLYING_SURFACE_FRICTION", "ServerToClient" },
+        { 0x58006F, "SMSG_MOVE_SET_ADV_FLYING_TURN_VELOCITY_THRESHOLD", "ServerToClient" },
+        { 0x580064, "SMSG_MOVE_SET_CAN_ADV_FLY", "ServerToClient" },
+        { 0x580076, "SMSG_MOVE_SET_CAN_DRIVE", "ServerToClient" },
+        { 0x580033, "SMSG_MOVE_SET_CAN_FLY", "ServerToClient" },
+        { 0x580035, "SMSG_MOVE_SET_CANNOT_SWIM", "ServerToClient" },
+        { 0x580037, "SMSG_MOVE_SET_CAN_TURN_WHILE_FALLING", "ServerToClient" },
+        { 0x580043, "SMSG_MOVE_SET_COLLISION_HEIGHT", "ServerToClient" },
+        { 0x580047, "SMSG_MOVE_SET_COMPOUND_STATE", "ServerToClient" },
+        { 0x58002D, "SMSG_MOVE_SET_FEATHER_FALL", "ServerToClient" },
+        { 0x580023, "SMSG_MOVE_SET_FLIGHT_BACK_SPEED", "ServerToClient" },
+        { 0x580022, "SMSG_MOVE_SET_FLIGHT_SPEED", "ServerToClient" },
+        { 0x58002F, "SMSG_MOVE_SET_HOVERING", "ServerToClient" },
+        { 0x580039, "SMSG_MOVE_SET_IGNORE_MOVEMENT_FORCES", "ServerToClient" },
+        { 0x58002C, "SMSG_MOVE_SET_LAND_WALK", "ServerToClient" },
+        { 0x580014, "SMSG_MOVE_SET_MOD_MOVEMENT_FORCE_MAGNITUDE", "ServerToClient" },
+        { 0x58002E, "SMSG_MOVE_SET_NORMAL_FALL", "ServerToClient" },
+        { 0x580026, "SMSG_MOVE_SET_PITCH_RATE", "ServerToClient" },
+        { 0x58001F, "SMSG_MOVE_SET_RUN_BACK_SPEED", "ServerToClient" },
+        { 0x58001E, "SMSG_MOVE_SET_RUN_SPEED", "ServerToClient" },
+        { 0x580021, "SMSG_MOVE_SET_SWIM_BACK_SPEED", "ServerToClient" },
+        { 0x580020, "SMSG_MOVE_SET_SWIM_SPEED", "ServerToClient" },
+        { 0x580025, "SMSG_MOVE_SET_TURN_RATE", "ServerToClient" },
+        { 0x580044, "SMSG_MOVE_SET_VEHICLE_REC_ID", "ServerToClient" },
+        { 0x580024, "SMSG_MOVE_SET_WALK_SPEED", "ServerToClient" },
+        { 0x580029, "SMSG_MOVE_SET_WATER_WALK", "ServerToClient" },
+        { 0x580048, "SMSG_MOVE_SKIP_TIME", "ServerToClient" },
+        { 0x58004D, "SMSG_MOVE_SPLINE_DISABLE_COLLISION", "ServerToClient" },
+        { 0x58004B, "SMSG_MOVE_SPLINE_DISABLE_GRAVITY", "ServerToClient" },
+        { 0x58004E, "SMSG_MOVE_SPLINE_ENABLE_COLLISION", "ServerToClient" },
+        { 0x58004C, "SMSG_MOVE_SPLINE_ENABLE_GRAVITY", "ServerToClient" },
+        { 0x580049, "SMSG_MOVE_SPLINE_ROOT", "ServerToClient" },
+        { 0x58004F, "SMSG_MOVE_SPLINE_SET_FEATHER_FALL", "ServerToClient" },
+        { 0x58001A, "SMSG_MOVE_SPLINE_SET_FLIGHT_BACK_SPEED", "ServerToClient" },
+        { 0x580019, "SMSG_MOVE_SPLINE_SET_FLIGHT_SPEED", "ServerToClient" },
+        { 0x580059, "SMSG_MOVE_SPLINE_SET_FLYING", "ServerToClient" },
+        { 0x580051, "SMSG_MOVE_SPLINE_SET_HOVER", "ServerToClient" },
+        { 0x580054, "SMSG_MOVE_SPLINE_SET_LAND_WALK", "ServerToClient" },
+        { 0x580050, "SMSG_MOVE_SPLINE_SET_NORMAL_FALL", "ServerToClient" },
+        { 0x58001D, "SMSG_MOVE_SPLINE_SET_PITCH_RATE", "ServerToClient" },
+        { 0x580016, "SMSG_MOVE_SPLINE_SET_RUN_BACK_SPEED", "ServerToClient" },
+        { 0x580057, "SMSG_MOVE_SPLINE_SET_RUN_MODE", "ServerToClient" },
+        { 0x580015, "SMSG_MOVE_SPLINE_SET_RUN_SPEED", "ServerToClient" },
+        { 0x580018, "SMSG_MOVE_SPLINE_SET_SWIM_BACK_SPEED", "ServerToClient" },
+        { 0x580017, "SMSG_MOVE_SPLINE_SET_SWIM_SPEED", "ServerToClient" },
+        { 0x58001C, "SMSG_MOVE_SPLINE_SET_TURN_RATE", "ServerToClient" },
+        { 0x580058, "SMSG_MOVE_SPLINE_SET_WALK_MODE", "ServerToClient" },
+        { 0x58001B, "SMSG_MOVE_SPLINE_SET_WALK_SPEED", "ServerToClient" },
+        { 0x580053, "SMSG_MOVE_SPLINE_SET_WATER_WALK", "ServerToClient" },
+        { 0x580055, "SMSG_MOVE_SPLINE_START_SWIM", "ServerToClient" },
+        { 0x580056, "SMSG_MOVE_SPLINE_STOP_SWIM", "ServerToClient" },
+        { 0x58004A, "SMSG_MOVE_SPLINE_UNROOT", "ServerToClient" },
+        { 0x58005A, "SMSG_MOVE_SPLINE_UNSET_FLYING", "ServerToClient" },
+        { 0x580052, "SMSG_MOVE_SPLINE_UNSET_HOVER", "ServerToClient" },
+        { 0x580032, "SMSG_MOVE_TELEPORT", "ServerToClient" },
+        { 0x580028, "SMSG_MOVE_UNROOT", "ServerToClient" },
+        { 0x580065, "SMSG_MOVE_UNSET_CAN_ADV_FLY", "ServerToClient" },
+        { 0x580077, "SMSG_MOVE_UNSET_CAN_DRIVE", "ServerToClient" },
+        { 0x580034, "SMSG_MOVE_UNSET_CAN_FLY", "ServerToClient" },
+        { 0x580036, "SMSG_MOVE_UNSET_CANNOT_SWIM", "ServerToClient" },
+        { 0x580038, "SMSG_MOVE_UNSET_CAN_TURN_WHILE_FALLING", "ServerToClient" },
+        { 0x580030, "SMSG_MOVE_UNSET_HOVERING", "ServerToClient" },
+        { 0x58003A, "SMSG_MOVE_UNSET_IGNORE_MOVEMENT_FORCES", "ServerToClient" },
+        { 0x58000E, "SMSG_MOVE_UPDATE", "ServerToClient" },
+        { 0x580063, "SMSG_MOVE_UPDATE_ADD_IMPULSE", "ServerToClient" },
+        { 0x580060, "SMSG_MOVE_UPDATE_APPLY_INERTIA", "ServerToClient" },
+        { 0x580012, "SMSG_MOVE_UPDATE_APPLY_MOVEMENT_FORCE", "ServerToClient" },
+        { 0x58000D, "SMSG_MOVE_UPDATE_COLLISION_HEIGHT", "ServerToClient" },
+        { 0x58000A, "SMSG_MOVE_UPDATE_FLIGHT_BACK_SPEED", "ServerToClient" },
+        { 0x580009, "SMSG_MOVE_UPDATE_FLIGHT_SPEED", "ServerToClient" },
+        { 0x580010, "SMSG_MOVE_UPDATE_KNOCK_BACK", "ServerToClient" },
+        { 0x580011, "SMSG_MOVE_UPDATE_MOD_MOVEMENT_FORCE_MAGNITUDE", "ServerToClient" },
+        { 0x58000C, "SMSG_MOVE_UPDATE_PITCH_RATE", "ServerToClient" },
+        { 0x580061, "SMSG_MOVE_UPDATE_REMOVE_INERTIA", "ServerToClient" },
+        { 0x580013, "SMSG_MOVE_UPDATE_REMOVE_MOVEMENT_FORCE", "ServerToClient" },
+        { 0x580005, "SMSG_MOVE_UPDATE_RUN_BACK_SPEED", "ServerToClient" },
+        { 0x580004, "SMSG_MOVE_UPDATE_RUN_SPEED", "ServerToClient" },
+        { 0x580008, "SMSG_MOVE_UPDATE_SWIM_BACK_SPEED", "ServerToClient" },
+        { 0x580007, "SMSG_MOVE_UPDATE_SWIM_SPEED", "ServerToClient" },
+        { 0x58000F, "SMSG_MOVE_UPDATE_TELEPORT", "ServerToClient" },
+        { 0x58000B, "SMSG_MOVE_UPDATE_TURN_RATE", "ServerToClient" },
+        { 0x580006, "SMSG_MOVE_UPDATE_WALK_SPEED", "ServerToClient" },
+        { 0x40027A, "SMSG_MULTI_FLOOR_LEAVE_FLOOR", "ServerToClient" },
+        { 0x400279, "SMSG_MULTI_FLOOR_NEW_FLOOR", "ServerToClient" },
+        { 0x47000B, "SMSG_MULTIPLE_PACKETS", "ServerToClient" },
+        { 0x4000AC, "SMSG_MYTHIC_PLUS_ALL_MAP_STATS", "ServerToClient" },
+        { 0x4000AE, "SMSG_MYTHIC_PLUS_CURRENT_AFFIXES", "ServerToClient" },
+        { 0x4000B4, "SMSG_MYTHIC_PLUS_NEW_WEEK_RECORD", "ServerToClient" },
+        { 0x4000AD, "SMSG_MYTHIC_PLUS_SEASON_DATA", "ServerToClient" },
+        { 0x5A0007, "SMSG_NEIGHBORHOOD_BUY_HOUSE_RESPONSE", "ServerToClient" },
+        { 0x5A000B, "SMSG_NEIGHBORHOOD_CANCEL_INVITATION_RESPONSE", "ServerToClient" },
+        { 0x590003, "SMSG_NEIGHBORHOOD_CHARTER_ADD_SIGNATURE_RESPONSE", "ServerToClient" },
+        { 0x590004, "SMSG_NEIGHBORHOOD_CHARTER_OPEN_CONFIRMATION_UI_RESPONSE", "ServerToClient" },
+        { 0x590001, "SMSG_NEIGHBORHOOD_CHARTER_OPEN_UI_RESPONSE", "ServerToClient" },
+        { 0x590002, "SMSG_NEIGHBORHOOD_CHARTER_SIGN_REQUEST", "ServerToClient" },
+        { 0x590000, "SMSG_NEIGHBORHOOD_CHARTER_UPDATE_RESPONSE", "ServerToClient" },
+        { 0x5A000C, "SMSG_NEIGHBORHOOD_DECLINE_INVITATION_RESPONSE", "ServerToClient" },
+        { 0x5A0002, "SMSG_NEIGHBORHOOD_EVICT_PLAYER", "ServerToClient" },
+        { 0x5A0015, "SMSG_NEIGHBORHOOD_EVICT_PLOT_NOTICE", "ServerToClient" },
+        { 0x5A0014, "SMSG_NEIGHBORHOOD_EVICT_PLOT_RESPONSE", "ServerToClient" },
+        { 0x5A000E, "SMSG_NEIGHBORHOOD_GET_INVITES_RESPONSE", "ServerToClient" },
+        { 0x5A0011, "SMSG_NEIGHBORHOOD_GET_ROSTER_RESPONSE", "ServerToClient" },
+        { 0x5A0013, "SMSG_NEIGHBORHOOD_INVITE_NAME_LOOKUP_RESULT", "ServerToClient" },
+        { 0x5A00F, "SMSG_NEIGHBORHOOD_INVITE_NOTIFICATION", "ServerToClient" },
+        { 0x5A000A, "SMSG_NEIGHBORHOOD_INVITE_RESIDENT_RESPONSE", "ServerToClient" },
+        { 0x5A0008, "SMSG_NEIGHBORHOOD_MOVE_HOUSE_RESPONSE", "ServerToClient" },
+        { 0x5A0010, "SMSG_NEIGHBORHOOD_OFFER_OWNERSHIP_RESPONSE", "ServerToClient" },
+        { 0x5A0009, "SMSG_NEIGHBORHOOD_OPEN_CORNERSTONE_UI_RESPONSE", "ServerToClient" },
+        { 0x5A0000, "SMSG_NEIGHBORHOOD_PLAYER_ENTER_PLOT", "ServerToClient" },
+        { 0x5A000D, "SMSG_NEIGHBORHOOD_PLAYER_GET_INVITE_RESPONSE", "ServerToClient" },
+        { 0x5A0001, "SMSG_NEIGHBORHOOD_PLAYER_LEAVE_PLOT", "ServerToClient" },
+        { 0x5A0012, "SMSG_NEIGHBORHOOD_ROSTER_RESIDENT_UPDATE", "ServerToClient" },
+        { 0x5A0003, "SMSG_NEIGHBORHOOD_UPDATE_NAME_RESPONSE", "ServerToClient" },
+        { 0x400078, "SMSG_NEUTRAL_PLAYER_FACTION_SELECT_RESULT", "ServerToClient" },
+        { 0x400340, "SMSG_NEW_DATA_BUILD", "ServerToClient" },
+        { 0x400122, "SMSG_NEW_TAXI_PATH", "ServerToClient" },
+        { 0x40002B, "SMSG_NEW_WORLD", "ServerToClient" },
+        { 0x5F0034, "SMSG_NOTIFY_DEST_LOC_SPELL_CAST", "ServerToClient" },
+        { 0x40014E, "SMSG_NOTIFY_MISSILE_TRAJECTORY_COLLISION", "ServerToClient" },
+        { 0x400031, "SMSG_NOTIFY_MONEY", "ServerToClient" },
+        { 0x4000DE, "SMSG_NOTIFY_RECEIVED_MAIL", "ServerToClient" },
+        { 0x400312, "SMSG_NPC_INTERACTION_OPEN_RESULT", "ServerToClient" },
+        { 0x400159, "SMSG_OFFER_PETITION_ERROR", "ServerToClient" },
+        { 0x400188, "SMSG_ON_CANCEL_EXPECTED_RIDE_VEHICLE_AURA", "ServerToClient" },
+        { 0x580002, "SMSG_ON_MONSTER_MOVE", "ServerToClient" },
+        { 0x40023F, "SMSG_OPEN_ARTIFACT_FORGE", "ServerToClient" },
+        { 0x600006, "SMSG_OPEN_CONTAINER", "ServerToClient" },
+        { 0x540015, "SMSG_OPEN_LFG_DUNGEON_FINDER", "ServerToClient" },
+        { 0x400237, "SMSG_OPEN_SHIPMENT_NPC_RESULT", "ServerToClient" },
+        { 0x40015E, "SMSG_OVERRIDE_LIGHT", "ServerToClient" },
+        { 0x4001BC, "SMSG_PAGE_TEXT", "ServerToClient" },
+        { 0x400231, "SMSG_PARTY_COMMAND_RESULT", "ServerToClient" },
+        { 0x400355, "SMSG_PARTY_ELIGIBILITY_FOR_DELVE_TIERS_RESPONSE", "ServerToClient" },
+        { 0x40005A, "SMSG_PARTY_INVITE", "ServerToClient" },
+        { 0x4001FB, "SMSG_PARTY_KILL_LOG", "ServerToClient" },
+        { 0x4001FA, "SMSG_PARTY_MEMBER_FULL_STATE", "ServerToClient" },
+        { 0x4001F9, "SMSG_PARTY_MEMBER_PARTIAL_STATE", "ServerToClient" },
+        { 0x4002FB, "SMSG_PARTY_NOTIFY_LFG_LEADER_CHANGE", "ServerToClient" },
+        { 0x400090, "SMSG_PARTY_UPDATE", "ServerToClient" },
+        { 0x40005F, "SMSG_PAST_TIME_EVENTS", "ServerToClient" },
+        { 0x4001B3, "SMSG_PAUSE_MIRROR_TIMER", "ServerToClient" },
+        { 0x40019A, "SMSG_PENDING_RAID_LOCK", "ServerToClient" },
+        { 0x40030F, "SMSG_PERKS_PROGRAM_ACTIVITY_COMPLETE", "ServerToClient" },
+        { 0x40030B, "SMSG_PERKS_PROGRAM_ACTIVITY_UPDATE", "ServerToClient" },
+        { 0x400310, "SMSG_PERKS_PROGRAM_DISABLED", "ServerToClient" },
+        { 0x40030C, "SMSG_PERKS_PROGRAM_RESULT", "ServerToClient" },
+        { 0x40030A, "SMSG_PERKS_PROGRAM_VENDOR_UPDATE", "ServerToClient" },
+        { 0x4001EA, "SMSG_PET_ACTION_FEEDBACK", "ServerToClient" },
+        { 0x400144, "SMSG_PET_ACTION_SOUND", "ServerToClient" },
+        { 0x4000A2, "SMSG_PET_BATTLE_CHAT_RESTRICTED", "ServerToClient" },
+        { 0x400118, "SMSG_PET_BATTLE_DEBUG_QUEUE_DUMP_RESPONSE", "ServerToClient" },
+        { 0x40009B, "SMSG_PET_BATTLE_FINALIZE_LOCATION", "ServerToClient" },
+        { 0x4000A0, "SMSG_PET_BATTLE_FINAL_ROUND", "ServerToClient" },
+        { 0x4000A1, "SMSG_PET_BATTLE_FINISHED", "ServerToClient" },
+        { 0x40009D, "SMSG_PET_BATTLE_FIRST_ROUND", "ServerToClient" },
+        { 0x40009C, "SMSG_PET_BATTLE_INITIAL_UPDATE", "ServerToClient" },
+        { 0x4000A3, "SMSG_PET_BATTLE_MAX_GAME_LENGTH_WARNING", "ServerToClient" },
+        { 0x40009A, "SMSG_PET_BATTLE_PVP_CHALLENGE", "ServerToClient" },
+        { 0x4000DB, "SMSG_PET_BATTLE_QUEUE_PROPOSE_MATCH", "ServerToClient" },
+        { 0x4000DC, "SMSG_PET_BATTLE_QUEUE_STATUS", "ServerToClient" },
+        { 0x40009F, "SMSG_PET_BATTLE_REPLACEMENTS_MADE", "ServerToClient" },
+        { 0x400099, "SMSG_PET_BATTLE_REQUEST_FAILED", "ServerToClient" },
+        { 0x40009E, "SMSG_PET_BATTLE_ROUND_RESULT", "ServerToClient" },
+        { 0x400088, "SMSG_PET_BATTLE_SLOT_UPDATES", "ServerToClient" },
+        { 0x5F0049, "SMSG_PET_CAST_FAILED", "ServerToClient" },
+        { 0x5F0013, "SMSG_PET_CLEAR_SPELLS", "ServerToClient" },
+        { 0x400145, "SMSG_PET_DISMISS_SOUND", "ServerToClient" },
+        { 0x40011F, "SMSG_PET_GOD_MODE", "ServerToClient" },
+        { 0x4001A6, "SMSG_PET_GUIDS", "ServerToClient" },
+        { 0x400037, "SMSG_PETITION_ALREADY_SIGNED", "ServerToClient" },
+        { 0x4C0042, "SMSG_PETITION_RENAME_GUILD_RESPONSE", "ServerToClient" },
+        { 0x400161, "SMSG_PETITION_SHOW_LIST", "ServerToClient" },
+        { 0x400162, "SMSG_PETITION_SHOW_SIGNATURES", "ServerToClient" },
+        { 0x4001ED, "SMSG_PETITION_SIGN_RESULTS", "ServerToClient" },
+        { 0x5F0040, "SMSG_PET_LEARNED_SPELLS", "ServerToClient" },
+        { 0x40001F, "SMSG_PET_MODE", "ServerToClient" },
+        { 0x400166, "SMSG_PET_NAME_INVALID", "ServerToClient" },
+        { 0x40001E, "SMSG_PET_NEWLY_TAMED", "ServerToClient" },
+        { 0x5F0014, "SMSG_PET_SPELLS_MESSAGE", "ServerToClient" },
+        { 0x40002A, "SMSG_PET_STABLE_RESULT", "ServerToClient" },
+        { 0x400156, "SMSG_PET_TAME_FAILURE", "ServerToClient" },
+        { 0x5F0041, "SMSG_PET_UNLEARNED_SPELLS", "ServerToClient" },
+        { 0x40000C, "SMSG_PHASE_SHIFT_CHANGE", "ServerToClient" },
+        { 0x400178, "SMSG_PLAYED_TIME", "ServerToClient" },
+        { 0x5C002E, "SMSG_PLAYER_ACKNOWLEDGE_ARROW_CALLOUT", "ServerToClient" },
+        { 0x5C0020, "SMSG_PLAYER_AZERITE_ITEM_EQUIPPED_STATUS_CHANGED", "ServerToClient" },
+        { 0x5C001F, "SMSG_PLAYER_AZERITE_ITEM_GAINS", "ServerToClient" },
+        { 0x5C0022, "SMSG_PLAYER_BONUS_ROLL_FAILED", "ServerToClient" },
+        { 0x5C0000, "SMSG_PLAYER_BOUND", "ServerToClient" },
+        { 0x5C0006, "SMSG_PLAYER_CHOICE_CLEAR", "ServerToClient" },
+        { 0x5C0005, "SMSG_PLAYER_CHOICE_DISPLAY_ERROR", "ServerToClient" },
+        { 0x5C0013, "SMSG_PLAYER_CONDITION_RESULT", "ServerToClient" },
+        { 0x5C0030, "SMSG_PLAYER_END_OF_MATCH_DETAILS", "ServerToClient" },
+        { 0x5C002D, "SMSG_PLAYER_HIDE_ARROW_CALLOUT", "ServerToClient" },
+        { 0x5C0012, "SMSG_PLAYER_IS_ADVENTURE_MAP_POI_VALID", "ServerToClient" },
+        { 0x5C0017, "SMSG_PLAYER_OPEN_SUBSCRIPTION_INTERSTITIAL", "ServerToClient" },
+        { 0x4C0041, "SMSG_PLAYER_SAVE_GUILD_EMBLEM", "ServerToClient" },
+        { 0x5C002F, "SMSG_PLAYER_SAVE_PERSONAL_EMBLEM", "ServerToClient" },
+        { 0x5C002C, "SMSG_PLAYER_SHOW_ARROW_CALLOUT", "ServerToClient" },
+        { 0x5C002A, "SMSG_PLAYER_SHOW_GENERIC_WIDGET_DISPLAY", "ServerToClient" },
+        { 0x5C002B, "SMSG_PLAYER_SHOW_PARTY_POSE_UI", "ServerToClient" },
+        { 0x5C0025, "SMSG_PLAYER_SHOW_UI_EVENT_TOAST", "ServerToClient" },
+        { 0x5C000F, "SMSG_PLAYER_SKINNED", "ServerToClient" },
+        { 0x5C0016, "SMSG_PLAYER_TUTORIAL_HIGHLIGHT_SPELL", "ServerToClient" },
+        { 0x5C0015, "SMSG_PLAYER_TUTORIAL_UNHIGHLIGHT_SPELL", "ServerToClient" },
+        { 0x5C0032, "SMSG_PLAYER_UPLOAD_SCREENSHOT", "ServerToClient" },
+        { 0x40020A, "SMSG_PLAY_MUSIC", "ServerToClient" },
+        { 0x40020C, "SMSG_PLAY_OBJECT_SOUND", "ServerToClient" },
+        { 0x4001D2, "SMSG_PLAY_ONE_SHOT_ANIM_KIT", "ServerToClient" },
+        { 0x5F0038, "SMSG_PLAY_ORPHAN_SPELL_VISUAL", "ServerToClient" },
+        { 0x4000D8, "SMSG_PLAY_SCENE", "ServerToClient" },
+        { 0x400209, "SMSG_PLAY_SOUND", "ServerToClient" },
+        { 0x40020D, "SMSG_PLAY_SPEAKERBOT_SOUND", "ServerToClient" },
+        { 0x5F0036, "SMSG_PLAY_SPELL_VISUAL", "ServerToClient" },
+        { 0x5F003A, "SMSG_PLAY_SPELL_VISUAL_KIT", "ServerToClient" },
+        { 0x4001A0, "SMSG_PLAY_TIME_WARNING", "ServerToClient" },
+        { 0x470008, "SMSG_PONG", "ServerToClient" },
+        { 0x400175, "SMSG_POWER_UPDATE", "ServerToClient" },
+        { 0x40000D, "SMSG_PRELOAD_CHILD_MAP", "ServerToClient" },
+        { 0x40002C, "SMSG_PRELOAD_WORLD", "ServerToClient" },
+        { 0x4002CE, "SMSG_PREPOPULATE_NAME_CACHE", "ServerToClient" },
+        { 0x400208, "SMSG_PRE_RESSURECT", "ServerToClient" },
+        { 0x400067, "SMSG_PRINT_NOTIFICATION", "ServerToClient" },
+        { 0x4001FC, "SMSG_PROC_RESIST", "ServerToClient" },
+        { 0x40029A, "SMSG_PROFESSION_GOSSIP", "ServerToClient" },
+        { 0x5F0042, "SMSG_PUSH_SPELL_TO_ACTION_BAR", "ServerToClient" },
+        { 0x460024, "SMSG_PVP_CREDIT", "ServerToClient" },
+        { 0x46002F, "SMSG_PVP_MATCH_COMPLETE", "ServerToClient" },
+        { 0x460030, "SMSG_PVP_MATCH_INITIALIZE", "ServerToClient" },
+        { 0x46002E, "SMSG_PVP_MATCH_SET_STATE", "ServerToClient" },
+        { 0x46002D, "SMSG_PVP_MATCH_START", "ServerToClient" },
+        { 0x460010, "SMSG_PVP_MATCH_STATISTICS", "ServerToClient" },
+        { 0x460013, "SMSG_PVP_OPTIONS_ENABLED", "ServerToClient" },
+        { 0x400306, "SMSG_PVP_TIER_RECORD", "ServerToClient" },
+        { 0x44000C, "SMSG_QUERY_BATTLE_PET_NAME_RESPONSE", "ServerToClient" },
+        { 0x440006, "SMSG_QUERY_CREATURE_RESPONSE", "ServerToClient" },
+        { 0x440007, "SMSG_QUERY_GAME_OBJECT_RESPONSE", "ServerToClient" },
+        { 0x4A0041, "SMSG_QUERY_GARRISON_PET_NAME_RESPONSE", "ServerToClient" },
+        { 0x4C002F, "SMSG_QUERY_GUILD_FOLLOW_INFO_RESPONSE", "ServerToClient" },
+        { 0x4C002D, "SMSG_QUERY_GUILD_INFO_RESPONSE", "ServerToClient" },
+        { 0x440010, "SMSG_QUERY_ITEM_TEXT_RESPONSE", "ServerToClient" },
+        { 0x440012, "SMSG_QUERY_NEIGHBORHOOD_NAME_RESPONSE", "ServerToClient" },
+        { 0x440008, "SMSG_QUERY_NPC_TEXT_RESPONSE", "ServerToClient" },
+        { 0x440009, "SMSG_QUERY_PAGE_TEXT_RESPONSE", "ServerToClient" },
+        { 0x44000D, "SMSG_QUERY_PETITION_RESPONSE", "ServerToClient" },
+        { 0x44000B, "SMSG_QUERY_PET_NAME_RESPONSE", "ServerToClient" },
+        { 0x5C000B, "SMSG_QUERY_PLAYER_NAME_BY_COMMUNITY_ID_RESPONSE", "ServerToClient" },
+        { 0x5C0027, "SMSG_QUERY_PLAYER_NAMES_RESPONSE", "ServerToClient" },
+        { 0x5D0016, "SMSG_QUERY_QUEST_INFO_RESPONSE", "ServerToClient" },
+        { 0x4C002E, "SMSG_QUERY_REALM_GUILD_MASTER_INFO_RESPONSE", "ServerToClient" },
+        { 0x400321, "SMSG_QUERY_SELECTED_WOW_LABS_AREA_RESPONSE", "ServerToClient" },
+        { 0x400186, "SMSG_QUERY_TIME_RESPONSE", "ServerToClient" },
+        { 0x400322, "SMSG_QUERY_WOW_LABS_AREA_INFO_RESPONSE", "ServerToClient" },
+        { 0x5D0001, "SMSG_QUEST_COMPLETION_NPC_RESPONSE", "ServerToClient" },
+        { 0x5D000F, "SMSG_QUEST_CONFIRM_ACCEPT", "ServerToClient" },
+        { 0x5D001C, "SMSG_QUEST_FORCE_REMOVED", "ServerToClient" },
+        { 0x5D0005, "SMSG_QUEST_GIVER_INVALID_QUEST", "ServerToClient" },
+        { 0x5D0014, "SMSG_QUEST_GIVER_OFFER_REWARD_MESSAGE", "ServerToClient" },
+        { 0x5D0003, "SMSG_QUEST_GIVER_QUEST_COMPLETE", "ServerToClient" },
+        { 0x5D0012, "SMSG_QUEST_GIVER_QUEST_DETAILS", "ServerToClient" },
+        { 0x5D0006, "SMSG_QUEST_GIVER_QUEST_FAILED", "ServerToClient" },
+        { 0x5D001A, "SMSG_QUEST_GIVER_QUEST_LIST_MESSAGE", "ServerToClient" },
+        { 0x5D0013, "SMSG_QUEST_GIVER_REQUEST_ITEMS", "ServerToClient" },
+        { 0x5D001B, "SMSG_QUEST_GIVER_STATUS", "ServerToClient" },
+        { 0x5D0011, "SMSG_QUEST_GIVER_STATUS_MULTIPLE", "ServerToClient" },
+        { 0x5D0002, "SMSG_QUEST_ITEM_USABILITY_RESPONSE", "ServerToClient" },
+        { 0x5D0007, "SMSG_QUEST_LOG_FULL", "ServerToClient" },
+        { 0x5D0008, "SMSG_QUEST_NON_LOG_UPDATE_COMPLETE", "ServerToClient" },
+        { 0x5D001D, "SMSG_QUEST_POI_QUERY_RESPONSE", "ServerToClient" },
+        { 0x5D001F, "SMSG_QUEST_POI_UPDATE_RESPONSE", "ServerToClient" },
+        { 0x5D0010, "SMSG_QUEST_PUSH_RESULT", "ServerToClient" },
+        { 0x4002F1, "SMSG_QUEST_SESSION_INFO_RESPONSE", "ServerToClient" },
+        { 0x4002DF, "SMSG_QUEST_SESSION_READY_CHECK", "ServerToClient" },
+        { 0x4002E0, "SMSG_QUEST_SESSION_READY_CHECK_RESPONSE", "ServerToClient" },
+        { 0x4002DE, "SMSG_QUEST_SESSION_RESULT", "ServerToClient" },
+        { 0x5D000C, "SMSG_QUEST_UPDATE_ADD_CREDIT", "ServerToClient" },
+        { 0x5D000D, "SMSG_QUEST_UPDATE_ADD_CREDIT_SIMPLE", "ServerToClient" },
+        { 0x5D000E, "SMSG_QUEST_UPDATE_ADD_PVP_CREDIT", "ServerToClient" },
+        { 0x5D0009, "SMSG_QUEST_UPDATE_COMPLETE", "ServerToClient" },
+        { 0x5D000A, "SMSG_QUEST_UPDATE_FAILED", "ServerToClient" },
+        { 0x5D000B, "SMSG_QUEST_UPDATE_FAILED_TIMER", "ServerToClient" },
+        { 0x4002AD, "SMSG_QUEUE_SUMMARY_UPDATE", "ServerToClient" },
+        { 0x4002DC, "SMSG_RAF_ACCOUNT_INFO", "ServerToClient" },
+        { 0x4002ED, "SMSG_RAF_ACTIVITY_STATE_CHANGED", "ServerToClient" },
+        { 0x40033D, "SMSG_RAF_DEBUG_FRIEND_MONTHS", "ServerToClient" },
+        { 0x400248, "SMSG_RAID_DIFFICULTY_SET", "ServerToClient" },
+        { 0x40024A, "SMSG_RAID_GROUP_ONLY", "ServerToClient" },
+        { 0x45000A, "SMSG_RAID_INSTANCE_MESSAGE", "ServerToClient" },
+        { 0x400038, "SMSG_RAID_MARKERS_CHANGED", "ServerToClient" },
+        { 0x4000D2, "SMSG_RANDOM_ROLL", "ServerToClient" },
+        { 0x46000F, "SMSG_RATED_PVP_INFO", "ServerToClient" },
+        { 0x400244, "SMSG_READ_ITEM_RESULT_FAILED", "ServerToClient" },
+        { 0x40023C, "SMSG_READ_ITEM_RESULT_OK", "ServerToClient" },
+        { 0x400094, "SMSG_READY_CHECK_COMPLETED", "ServerToClient" },
+        { 0x400093, "SMSG_READY_CHECK_RESPONSE", "ServerToClient" },
+        { 0x400092, "SMSG_READY_CHECK_STARTED", "ServerToClient" },
+        { 0x440005, "SMSG_REALM_QUERY_RESPONSE", "ServerToClient" },
+        { 0x4001EC, "SMSG_REATTACH_RESURRECT", "ServerToClient" },
+        { 0x400039, "SMSG_RECEIVE_PING_UNIT", "ServerToClient" },
+        { 0x40003A, "SMSG_RECEIVE_PING_WORLD_POINT", "ServerToClient" },
+        { 0x400358, "SMSG_RECENT_ALLY_DATA_RESPONSE", "ServerToClient" },
+        { 0x400359, "SMSG_RECENT_ALLY_NOTE_UPDATED", "ServerToClient" },
+        { 0x400333, "SMSG_RECRAFT_ITEM_RESULT", "ServerToClient" },
+        { 0x400163, "SMSG_RECRUIT_A_FRIEND_FAILURE", "ServerToClient" },
+        { 0x4000F2, "SMSG_REFRESH_COMPONENT", "ServerToClient" },
+        { 0x40001A, "SMSG_REGIONWIDE_CHARACTER_MAIL_DATA", "ServerToClient" },
+        { 0x400019, "SMSG_REGIONWIDE_CHARACTER_RESTRICTIONS_DATA", "ServerToClient" },
+        { 0x400043, "SMSG_REMOVE_ITEM_PASSIVE", "ServerToClient" },
+        { 0x5F0043, "SMSG_REMOVE_SPELL_FROM_ACTION_BAR", "ServerToClient" },
+        { 0x400260, "SMSG_REPLACE_TROPHY_RESPONSE", "ServerToClient" },
+        { 0x5C000A, "SMSG_REPORT_PVP_PLAYER_AFK_RESULT", "ServerToClient" },
+        { 0x400025, "SMSG_REQUEST_CEMETERY_LIST_RESPONSE", "ServerToClient" },
+        { 0x460014, "SMSG_REQUEST_PVP_REWARDS_RESPONSE", "ServerToClient" },
+        { 0x460015, "SMSG_REQUEST_SCHEDULED_PVP_INFO_RESPONSE", "ServerToClient" },
+        { 0x470009, "SMSG_RESET_COMPRESSION_CONTEXT", "ServerToClient" },
+        { 0x40015A, "SMSG_RESET_FAILED_NOTIFY", "ServerToClient" },
+        { 0x40033A, "SMSG_RESET_LAST_LOADED_CONFIG_CVARS", "ServerToClient" },
+        { 0x5D0020, "SMSG_RESET_QUEST_POI", "ServerToClient" },
+        { 0x460023, "SMSG_RESET_RANGED_COMBAT_TIMER", "ServerToClient" },
+        { 0x400009, "SMSG_RESET_WEEKLY_CURRENCY", "ServerToClient" },
+        { 0x4000B5, "SMSG_RESPEC_WIPE_CONFIRM", "ServerToClient" },
+        { 0x400006, "SMSG_RESPOND_INSPECT_ACHIEVEMENTS", "ServerToClient" },
+        { 0x40030D, "SMSG_RESPONSE_PERK_PENDING_REWARDS", "ServerToClient" },
+        { 0x40030E, "SMSG_RESPONSE_PERK_RECENT_PURCHASES", "ServerToClient" },
+        { 0x5F0052, "SMSG_RESTART_GLOBAL_COOLDOWN", "ServerToClient" },
+        { 0x400056, "SMSG_RESTRICTED_ACCOUNT_WARNING", "ServerToClient" },
+        { 0x5F002C, "SMSG_RESUME_CAST", "ServerToClient" },
+        { 0x5F002F, "SMSG_RESUME_CAST_BAR", "ServerToClient" },
+        { 0x470005, "SMSG_RESUME_COMMS", "ServerToClient" },
+        { 0x400041, "SMSG_RESUME_TOKEN", "ServerToClient" },
+        { 0x400012, "SMSG_RESURRECT_REQUEST", "ServerToClient" },
+        { 0x5F0050, "SMSG_RESYNC_RUNES", "ServerToClient" },
+        { 0x4002D2, "SMSG_RETURN_APPLICANT_LIST", "ServerToClient" },
+        { 0x4002D1, "SMSG_RETURN_RECRUITING_CLUBS", "ServerToClient" },
+        { 0x400021, "SMSG_ROLE_CHANGED_INFORM", "ServerToClient" },
+        { 0x54001D, "SMSG_ROLE_CHOSEN", "ServerToClient" },
+        { 0x400022, "SMSG_ROLE_POLL_INFORM", "ServerToClient" },
+        { 0x400299, "SMSG_RUNEFORGE_LEGENDARY_CRAFTING_OPEN_NPC", "ServerToClient" },
+        { 0x400053, "SMSG_RUNE_REGEN_DEBUG", "ServerToClient" },
+        { 0x400287, "SMSG_SCENARIO_COMPLETED", "ServerToClient" },
+        { 0x4000D5, "SMSG_SCENARIO_POIS", "ServerToClient" },
+        { 0x4000CE, "SMSG_SCENARIO_PROGRESS_UPDATE", "ServerToClient" },
+        { 0x40029D, "SMSG_SCENARIO_SHOW_CRITERIA", "ServerToClient" },
+        { 0x4000CD, "SMSG_SCENARIO_STATE", "ServerToClient" },
+        { 0x40029C, "SMSG_SCENARIO_UI_UPDATE", "ServerToClient" },
+        { 0x400245, "SMSG_SCENARIO_VACATE", "ServerToClient" },
+        { 0x40007E, "SMSG_SCENE_OBJECT_EVENT", "ServerToClient" },
+        { 0x400083, "SMSG_SCENE_OBJECT_PET_BATTLE_FINAL_ROUND", "ServerToClient" },
+        { 0x400084, "SMSG_SCENE_OBJECT_PET_BATTLE_FINISHED", "ServerToClient" },
+        { 0x400080, "SMSG_SCENE_OBJECT_PET_BATTLE_FIRST_ROUND", "ServerToClient" },
+        { 0x40007F, "SMSG_SCENE_OBJECT_PET_BATTLE_INITIAL_UPDATE", "ServerToClient" },
+        { 0x400082, "SMSG_SCENE_OBJECT_PET_BATTLE_REPLACEMENTS_MADE", "ServerToClient" },
+        { 0x400081, "SMSG_SCENE_OBJECT_PET_BATTLE_ROUND_RESULT", "ServerToClient" },
+        { 0x5C001A, "SMSG_SCHEDULED_AREA_POI_UPDATE_RESPONSE", "ServerToClient" },
+        { 0x5F0047, "SMSG_SCRIPT_CAST", "ServerToClient" },
+        { 0x40005E, "SMSG_SEASON_INFO", "ServerToClient" },
+        { 0x400167, "SMSG_SELL_RESPONSE", "ServerToClient" },
+        { 0x400044, "SMSG_SEND_ITEM_PASSIVES", "ServerToClient" },
+        { 0x5F0019, "SMSG_SEND_KNOWN_SPELLS", "ServerToClient" },
+        { 0x4000D0, "SMSG_SEND_RAID_TARGET_UPDATE_ALL", "ServerToClient" },
+        { 0x4000D1, "SMSG_SEND_RAID_TARGET_UPDATE_SINGLE", "ServerToClient" },
+        { 0x5F001B, "SMSG_SEND_SPELL_CHARGES", "ServerToClient" },
+        { 0x5F001A, "SMSG_SEND_SPELL_HISTORY", "ServerToClient" },
+        { 0x5F001C, "SMSG_SEND_UNLEARN_SPELLS", "ServerToClient" },
+        { 0x4000EF, "SMSG_SERVER_FIRST_ACHIEVEMENTS", "ServerToClient" },
+        { 0x400126, "SMSG_SERVER_TIME", "ServerToClient" },
+        { 0x4001B7, "SMSG_SERVER_TIME_OFFSET", "ServerToClient" },
+        { 0x4001D1, "SMSG_SET_AI_ANIM_KIT", "ServerToClient" },
+        { 0x4001D5, "SMSG_SET_ANIM_TIER", "ServerToClient" },
+        { 0x40007B, "SMSG_SET_CHR_UPGRADE_TIER", "ServerToClient" },
+        { 0x400362, "SMSG_SET_CTR_OPTIONS", "ServerToClient" },
+        { 0x400008, "SMSG_SET_CURRENCY", "ServerToClient" },
+        { 0x540012, "SMSG_SET_DF_FAST_LAUNCH_RESULT", "ServerToClient" },
+        { 0x400148, "SMSG_SET_DUNGEON_DIFFICULTY", "ServerToClient" },
+        { 0x4001A2, "SMSG_SET_FACTION_AT_WAR", "ServerToClient" },
+        { 0x4001CC, "SMSG_SET_FACTION_NOT_VISIBLE", "ServerToClient" },
+        { 0x4001CD, "SMSG_SET_FACTION_STANDING", "ServerToClient" },
+        { 0x4001CB, "SMSG_SET_FACTION_VISIBLE", "ServerToClient" },
+        { 0x5F0027, "SMSG_SET_FLAT_SPELL_MODIFIER", "ServerToClient" },
+        { 0x40035E, "SMSG_SET_INSTANCE_LEAVER", "ServerToClient" },
+        { 0x400033, "SMSG_SET_ITEM_PURCHASE_DATA", "ServerToClient" },
+        { 0x40026B, "SMSG_SET_LOOT_METHOD_FAILED", "ServerToClient" },
+        { 0x400036, "SMSG_SET_MAX_WEEKLY_QUANTITY", "ServerToClient" },
+        { 0x4001D4, "SMSG_SET_MELEE_ANIM_KIT", "ServerToClient" },
+        { 0x4001D3, "SMSG_SET_MOVEMENT_ANIM_KIT", "ServerToClient" },
+        { 0x5F0028, "SMSG_SET_PCT_SPELL_MODIFIER", "ServerToClient" },
+        { 0x4000C7, "SMSG_SET_PET_SPECIALIZATION", "ServerToClient" },
+        { 0x5C000C, "SMSG_SET_PLAYER_DECLINED_NAMES_RESULT", "ServerToClient" },
+        { 0x400057, "SMSG_SET_PLAY_HOVER_ANIM", "ServerToClient" },
+        { 0x4001D6, "SMSG_SET_PROFICIENCY", "ServerToClient" },
+        { 0x4002E5, "SMSG_SET_QUEST_REPLAY_COOLDOWN_OVERRIDE", "ServerToClient" },
+        { 0x4A003A, "SMSG_SET_SHIPMENT_READY_RESPONSE", "ServerToClient" },
+        { 0x5F0018, "SMSG_SET_SPELL_CHARGES", "ServerToClient" },
+        { 0x40011B, "SMSG_SET_TIME_ZONE_INFORMATION", "ServerToClient" },
+        { 0x5F000F, "SMSG_SETUP_COMBAT_LOG_FILE_FLUSH", "ServerToClient" },
+        { 0x400007, "SMSG_SETUP_CURRENCY", "ServerToClient" },
+        { 0x400199, "SMSG_SET_VEHICLE_REC_ID", "ServerToClient" },
+        { 0x400311, "SMSG_SHADOWLANDS_CAPACITANCE_UPDATE", "ServerToClient" },
+        { 0x4A003B, "SMSG_SHIPMENT_FACTION_UPDATE_RESULT", "ServerToClient" },
+        { 0x400353, "SMSG_SHOW_DELVES_COMPANION_CONFIGURATION_UI", "ServerToClient" },
+        { 0x400351, "SMSG_SHOW_DELVES_DISPLAY_UI", "ServerToClient" },
+        { 0x400077, "SMSG_SHOW_NEUTRAL_PLAYER_FACTION_SELECT_UI", "ServerToClient" },
+        { 0x5D0015, "SMSG_SHOW_QUEST_COMPLETION_TEXT", "ServerToClient" },
+        { 0x400170, "SMSG_SHOW_TAXI_NODES", "ServerToClient" },
+        { 0x400212, "SMSG_SHOW_TRADE_SKILL_RESPONSE", "ServerToClient" },
+        { 0x40031D, "SMSG_SOCIAL_CONTRACT_REQUEST_RESPONSE", "ServerToClient" },
+        { 0x4001C9, "SMSG_SOCKET_GEMS_FAILURE", "ServerToClient" },
+        { 0x4001C8, "SMSG_SOCKET_GEMS_SUCCESS", "ServerToClient" },
+        { 0x400143, "SMSG_SPECIAL_MOUNT_ANIM", "ServerToClient" },
+        { 0x4001BB, "SMSG_SPEC_INVOLUNTARILY_CHANGED", "ServerToClient" },
+        { 0x40033F, "SMSG_SPECTATE_END", "ServerToClient" },
+        { 0x40033E, "SMSG_SPECTATE_PLAYER", "ServerToClient" },
+        { 0x5F000C, "SMSG_SPELL_ABSORB_LOG", "ServerToClient" },
+        { 0x5F0006, "SMSG_SPELL_CATEGORY_COOLDOWN", "ServerToClient" },
+        { 0x5F0022, "SMSG_SPELL_CHANNEL_START", "ServerToClient" },
+        { 0x5F0023, "SMSG_SPELL_CHANNEL_UPDATE", "ServerToClient" },
+        { 0x5F0005, "SMSG_SPELL_COOLDOWN", "ServerToClient" },
+        { 0x5F001F, "SMSG_SPELL_DAMAGE_SHIELD", "ServerToClient" },
+        { 0x5F0030, "SMSG_SPELL_DELAYED", "ServerToClient" },
+        { 0x5F0007, "SMSG_SPELL_DISPELL_LOG", "ServerToClient" },
+        { 0x5F0026, "SMSG_SPELL_EMPOWER_SET_STAGE", "ServerToClient" },
+        { 0x5F0024, "SMSG_SPELL_EMPOWER_START", "ServerToClient" },
+        { 0x5F0025, "SMSG_SPELL_EMPOWER_UPDATE", "ServerToClient" },
+        { 0x5F0009, "SMSG_SPELL_ENERGIZE_LOG", "ServerToClient" },
+        { 0x5F0031, "SMSG_SPELL_EXECUTE_LOG", "ServerToClient" },
+        { 0x5F0046, "SMSG_SPELL_FAILED_OTHER", "ServerToClient" },
+        { 0x5F0044, "SMSG_SPELL_FAILURE", "ServerToClient" },
+        { 0x5F004B, "SMSG_SPELL_FAILURE_MESSAGE", "ServerToClient" },
+        { 0x5F002A, "SMSG_SPELL_GO", "ServerToClient" },
+        { 0x5F000B, "SMSG_SPELL_HEAL_ABSORB_LOG", "ServerToClient" },
+        { 0x5F000A, "SMSG_SPELL_HEAL_LOG", "ServerToClient" },
+        { 0x5F0021, "SMSG_SPELL_INSTAKILL_LOG", "ServerToClient" },
+        { 0x5F000D, "SMSG_SPELL_INTERRUPT_LOG", "ServerToClient" },
+        { 0x5F0032, "SMSG_SPELL_MISS_LOG", "ServerToClient" },
+        { 0x5F0020, "SMSG_SPELL_NON_MELEE_DAMAGE_LOG", "ServerToClient" },
+        { 0x5F001D, "SMSG_SPELL_OR_DAMAGE_IMMUNE", "ServerToClient" },
+        { 0x5F0008, "SMSG_SPELL_PERIODIC_AURA_LOG", "ServerToClient" },
+        { 0x5F0029, "SMSG_SPELL_PREPARE", "ServerToClient" },
+        { 0x5F002B, "SMSG_SPELL_START", "ServerToClient" },
+        { 0x400069, "SMSG_SPELL_VISUAL_LOAD_SCREEN", "ServerToClient" },
+        { 0x4002F7, "SMSG_SPLASH_SCREEN_SHOW_LATEST", "ServerToClient" },
+        { 0x4001BF, "SMSG_STAND_STATE_UPDATE", "ServerToClient" },
+        { 0x4000A4, "SMSG_START_ELAPSED_TIMER", "ServerToClient" },
+        { 0x4000A6, "SMSG_START_ELAPSED_TIMERS", "ServerToClient" },
+        { 0x40006F, "SMSG_STARTER_BUILD_ACTIVATE_FAILED", "ServerToClient" },
+        { 0x40014B, "SMSG_START_LIGHTNING_STORM", "ServerToClient" },
+        { 0x4000BF, "SMSG_START_LOOT_ROLL", "ServerToClient" },
+        { 0x4001B2, "SMSG_START_MIRROR_TIMER", "ServerToClient" },
+        { 0x40003D, "SMSG_START_TIMER", "ServerToClient" },
+        { 0x4000A5, "SMSG_STOP_ELAPSED_TIMER", "ServerToClient" },
+        { 0x4001B4, "SMSG_STOP_MIRROR_TIMER", "ServerToClient" },
+        { 0x40020E, "SMSG_STOP_SPEAKERBOT_SOUND", "ServerToClient" },
+        { 0x40003E, "SMSG_STOP_TIMER", "ServerToClient" },
+        { 0x40003C, "SMSG_STREAMING_MOVIES", "ServerToClient" },
+        { 0x400232, "SMSG_SUGGEST_INVITE_INFORM", "ServerToClient" },
+        { 0x400154, "SMSG_SUMMON_CANCEL", "ServerToClient" },
+        { 0x400023, "SMSG_SUMMON_RAID_MEMBER_VALIDATE_FAILED", "ServerToClient" },
+        { 0x4001C3, "SMSG_SUMMON_REQUEST", "ServerToClient" },
+        { 0x5F003D, "SMSG_SUPERCEDED_SPELLS", "ServerToClient" },
+        { 0x40035B, "SMSG_SURVEY_DELIVERED", "ServerToClient" },
+        { 0x470004, "SMSG_SUSPEND_COMMS", "ServerToClient" },
+        { 0x400040, "SMSG_SUSPEND_TOKEN", "ServerToClient" },
+        { 0x4002EF, "SMSG_SYNC_WOW_ENTITLEMENTS", "ServerToClient" },
+        { 0x4001BA, "SMSG_TALENTS_INVOLUNTARILY_RESET", "ServerToClient" },
+        { 0x400120, "SMSG_TAXI_NODE_STATUS", "ServerToClient" },
+        { 0x40011E, "SMSG_TEXT_EMOTE", "ServerToClient" },
+        { 0x40017F, "SMSG_THREAT_CLEAR", "ServerToClient" },
+        { 0x40017E, "SMSG_THREAT_REMOVE", "ServerToClient" },
+        { 0x40017D, "SMSG_THREAT_UPDATE", "ServerToClient" },
+        { 0x580001, "SMSG_TIME_ADJUSTMENT", "ServerToClient" },
+        { 0x400354, "SMSG_TIMERUNNING_SEASON_ENDED", "ServerToClient" },
+        { 0x580000, "SMSG_TIME_SYNC_REQUEST", "ServerToClient" },
+        { 0x40017A, "SMSG_TITLE_EARNED", "ServerToClient" },
+        { 0x40017B, "SMSG_TITLE_LOST", "ServerToClient" },
+        { 0x40016A, "SMSG_TOTEM_CREATED", "ServerToClient" },
+        { 0x40016C, "SMSG_TOTEM_DURATION_CHANGED", "ServerToClient" },
+        { 0x40016D, "SMSG_TOTEM_MOVED", "ServerToClient" },
+        { 0x40016B, "SMSG_TOTEM_REMOVED", "ServerToClient" },
+        { 0x400017, "SMSG_TRADE_STATUS", "ServerToClient" },
+        { 0x400016, "SMSG_TRADE_UPDATED", "ServerToClient" },
+        { 0x400182, "SMSG_TRAINER_BUY_FAILED", "ServerToClient" },
+        { 0x400181, "SMSG_TRAINER_LIST", "ServerToClient" },
+        { 0x40006E, "SMSG_TRAIT_CONFIG_COMMIT_FAILED", "ServerToClient" },
+        { 0x4001A5, "SMSG_TRANSFER_ABORTED", "ServerToClient" },
+        { 0x40006A, "SMSG_TRANSFER_PENDING", "ServerToClient" },
+        { 0x440011, "SMSG_TREASURE_PICKER_RESPONSE", "ServerToClient" },
+        { 0x400265, "SMSG_TRIGGER_CINEMATIC", "ServerToClient" },
+        { 0x40016E, "SMSG_TRIGGER_MOVIE", "ServerToClient" },
+        { 0x4001EF, "SMSG_TURN_IN_PETITION_RESULT", "ServerToClient" },
+        { 0x400259, "SMSG_TUTORIAL_FLAGS", "ServerToClient" },
+        { 0x40020B, "SMSG_UI_ACTION", "ServerToClient" },
+        { 0x5D0023, "SMSG_UI_MAP_QUEST_LINES_RESPONSE", "ServerToClient" },
+        { 0x400266, "SMSG_UNDELETE_CHARACTER_RESPONSE", "ServerToClient" },
+        { 0x400267, "SMSG_UNDELETE_COOLDOWN_STATUS_RESPONSE", "ServerToClient" },
+        { 0x5F003F, "SMSG_UNLEARNED_SPELLS", "ServerToClient" },
+        { 0x40000E, "SMSG_UNLOAD_CHILD_MAP", "ServerToClient" },
+        { 0x40035F, "SMSG_UNSET_INSTANCE_LEAVER", "ServerToClient" },
+        { 0x400307, "SMSG_UPDATE_AADC_STATUS_RESPONSE", "ServerToClient" },
+        { 0x4001AB, "SMSG_UPDATE_ACCOUNT_DATA", "ServerToClient" },
+        { 0x4001AC, "SMSG_UPDATE_ACCOUNT_DATA_COMPLETE", "ServerToClient" },
+        { 0x40007C, "SMSG_UPDATE_ACTION_BUTTONS", "ServerToClient" },
+        { 0x4002BF, "SMSG_UPDATE_BNET_SESSION_KEY", "ServerToClient" },
+        { 0x460007, "SMSG_UPDATE_CAPTURE_POINT", "ServerToClient" },
+        { 0x4002BB, "SMSG_UPDATE_CELESTIAL_BODY", "ServerToClient" },
+        { 0x40025F, "SMSG_UPDATE_CHARACTER_FLAGS", "ServerToClient" },
+        { 0x400207, "SMSG_UPDATE_CHARGE_CATEGORY_COOLDOWN", "ServerToClient" },
+        { 0x400206, "SMSG_UPDATE_COOLDOWN", "ServerToClient" },
+        { 0x4A0038, "SMSG_UPDATE_CRAFTING_NPC_RECIPES", "ServerToClient" },
+        { 0x4A0021, "SMSG_UPDATE_DAILY_MISSION_COUNTER", "ServerToClient" },
+        { 0x4000E8, "SMSG_UPDATE_EXPANSION_LEVEL", "ServerToClient" },
+        { 0x4002C2, "SMSG_UPDATE_GAME_TIME_STATE", "ServerToClient" },
+        { 0x40014D, "SMSG_UPDATE_INSTANCE_OWNERSHIP", "ServerToClient" },
+        { 0x40012C, "SMSG_UPDATE_LAST_INSTANCE", "ServerToClient" },
+        { 0x560000, "SMSG_UPDATE_OBJECT", "ServerToClient" },
+        { 0x400074, "SMSG_UPDATE_PRIMARY_SPEC", "ServerToClient" },
+        { 0x400091, "SMSG_UPDATE_RECENT_PLAYER_GUIDS", "ServerToClient" },
+        { 0x400073, "SMSG_UPDATE_TALENT_DATA", "ServerToClient" },
+        { 0x4001E9, "SMSG_UPDATE_WORLD_STATE", "ServerToClient" },
+        { 0x4001F0, "SMSG_USE_EQUIPMENT_SET_RESULT", "ServerToClient" },
+        { 0x45000F, "SMSG_USERLIST_ADD", "ServerToClient" },
+        { 0x450010, "SMSG_USERLIST_REMOVE", "ServerToClient" },
+        { 0x450011, "SMSG_USERLIST_UPDATE", "ServerToClient" },
+        { 0x4002B6, "SMSG_VAS_CHECK_TRANSFER_OK_RESPONSE", "ServerToClient" },
+        { 0x4002B4, "SMSG_VAS_GET_QUEUE_MINUTES_RESPONSE", "ServerToClient" },
+        { 0x4002B3, "SMSG_VAS_GET_SERVICE_STATUS_RESPONSE", "ServerToClient" },
+        { 0x40028D, "SMSG_VAS_PURCHASE_COMPLETE", "ServerToClient" },
+        { 0x40028C, "SMSG_VAS_PURCHASE_STATE_UPDATE", "ServerToClient" },
+        { 0x400055, "SMSG_VENDOR_INVENTORY", "ServerToClient" },
+        { 0x5C0011, "SMSG_VIGNETTE_UPDATE", "ServerToClient" },
+        { 0x4002BA, "SMSG_VOICE_CHANNEL_INFO_RESPONSE", "ServerToClient" },
+        { 0x400302, "SMSG_VOICE_CHANNEL_STT_TOKEN_RESPONSE", "ServerToClient" },
+        { 0x4002B9, "SMSG_VOICE_LOGIN_RESPONSE", "ServerToClient" },
+        { 0x600004, "SMSG_VOID_ITEM_SWAP_RESPONSE", "ServerToClient" },
+        { 0x600001, "SMSG_VOID_STORAGE_CONTENTS", "ServerToClient" },
+        { 0x600000, "SMSG_VOID_STORAGE_FAILED", "ServerToClient" },
+        { 0x600002, "SMSG_VOID_STORAGE_TRANSFER_CHANGES", "ServerToClient" },
+        { 0x600003, "SMSG_VOID_TRANSFER_RESULT", "ServerToClient" },
+        { 0x400003, "SMSG_WAIT_QUEUE_FINISH", "ServerToClient" },
+        { 0x400002, "SMSG_WAIT_QUEUE_UPDATE", "ServerToClient" },
+        { 0x620000, "SMSG_WALK_IN_RESULT", "ServerToClient" },
+        { 0x40000B, "SMSG_WARDEN3_DATA", "ServerToClient" },
+        { 0x4002BD, "SMSG_WARDEN3_DISABLED", "ServerToClient" },
+        { 0x4002BC, "SMSG_WARDEN3_ENABLED", "ServerToClient" },
+        { 0x4001FF, "SMSG_WARFRONT_COMPLETE", "ServerToClient" },
+        { 0x460012, "SMSG_WARGAME_REQUEST_OPPONENT_RESPONSE", "ServerToClient" },
+        { 0x460011, "SMSG_WARGAME_REQUEST_SUCCESSFULLY_SENT_TO_OPPONENT", "ServerToClient" },
+        { 0x40014A, "SMSG_WEATHER", "ServerToClient" },
+        { 0x4002F9, "SMSG_WEEKLY_REWARD_CLAIM_RESULT", "ServerToClient" },
+        { 0x4002FA, "SMSG_WEEKLY_REWARDS_PROGRESS_RESULT", "ServerToClient" },
+        { 0x4002F8, "SMSG_WEEKLY_REWARDS_RESULT", "ServerToClient" },
+        { 0x450002, "SMSG_WHO", "ServerToClient" },
+        { 0x400149, "SMSG_WHO_IS", "ServerToClient" },
+        { 0x4002C1, "SMSG_WILL_BE_KICKED_FOR_ADDED_SUBSCRIPTION_TIME", "ServerToClient" },
+        { 0x5C0018, "SMSG_WORLD_QUEST_UPDATE_RESPONSE", "ServerToClient" },
+        { 0x400045, "SMSG_WORLD_SERVER_INFO", "ServerToClient" },
+        { 0x4002F0, "SMSG_WOW_ENTITLEMENT_NOTIFICATION", "ServerToClient" },
+        { 0x40031E, "SMSG_WOW_LABS_NOTIFY_PLAYERS_MATCH_END", "ServerToClient" },
+        { 0x40031F, "SMSG_WOW_LABS_NOTIFY_PLAYERS_MATCH_STATE_CHANGED", "ServerToClient" },
+        { 0x40032B, "SMSG_WOW_LABS_PARTY_ERROR", "ServerToClient" },
+        { 0x400324, "SMSG_WOW_LABS_SET_PREDICTION_CIRCLE", "ServerToClient" },
+        { 0x400320, "SMSG_WOW_LABS_SET_WOW_LABS_AREA_ID_RESPONSE", "ServerToClient" },
+        { 0x400339, "SMSG_XP_AWARDED_FROM_CURRENCY", "ServerToClient" },
+        { 0x400066, "SMSG_XP_GAIN_ABORTED", "ServerToClient" },
+        { 0x400249, "SMSG_XP_GAIN_ENABLED", "ServerToClient" },
+        { 0x45000B, "SMSG_ZONE_UNDER_ATTACK", "ServerToClient" },
+    };
+}
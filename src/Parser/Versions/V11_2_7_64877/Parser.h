@@ -11,6 +11,9 @@ namespace PktParser::V11_2_7_64877
 	using IVersionParser = PktParser::Versions::IVersionParser;
 	using ParseResult = PktParser::Common::ParseResult;
 
+	// build this parser was written against, part of the binary record schema id
+	static constexpr uint32 PARSER_BUILD = 64877;
+
 	class Parser final : public IVersionParser
 	{
 	private:
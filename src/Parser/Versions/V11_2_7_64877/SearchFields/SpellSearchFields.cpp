@@ -1,4 +1,5 @@
 #include "SpellSearchFields.h"
+#include "Common/PacketArena.h"
 
 using namespace PktParser::V11_2_7_64877::Structures;
 using namespace PktParser::Common;
@@ -7,16 +8,23 @@ namespace PktParser::V11_2_7_64877::SearchFields
 {
     SpellSearchFields FillSpellFields(SpellCastData const& data)
     {
-        SpellSearchFields fields{};
+        SpellSearchFields fields{ CurrentResource() };
         fields.spellId = data.FixedData.SpellID;
-        fields.castId = data.CastID.ToHexString();
-        fields.originalCastId = data.OriginalCastID.ToHexString();
-        fields.casterGuid = data.CasterGUID.ToHexString();
-        fields.casterType = Enums::GuidTypeToString(data.CasterGUID.GetType());
+        fields.castId = data.CastID;
+        fields.originalCastId = data.OriginalCastID;
+        fields.casterGuid = data.CasterGUID;
+        fields.casterType = data.CasterGUID.GetType();
         fields.casterEntry = data.CasterGUID.GetEntry();
         fields.casterLow = data.CasterGUID.GetLow();
         fields.mapId = data.CasterGUID.GetMapId();
+        fields.castFlags = data.FixedData.CastFlags;
+        fields.castFlagsEx = data.FixedData.CastFlagsEx;
+        fields.castFlagsEx2 = data.FixedData.CastFlagsEx2;
+        fields.castTime = data.FixedData.CastTime;
+        fields.missTargetCount = static_cast<uint32>(data.MissTargets.size());
+        fields.targetPointCount = static_cast<uint32>(data.TargetPoints.size());
         
+        fields.hitTargetEntries.reserve(data.HitTargets.size());
         for (auto const& guid : data.HitTargets)
             fields.hitTargetEntries.push_back(guid.GetEntry());
 
@@ -1,9 +1,103 @@
 #include "SpellSerializer.h"
 
+#include <span>
+
 using namespace PktParser::V11_2_7_64877::Structures;
+using namespace PktParser::Common;
 
 namespace PktParser::V11_2_7_64877::Serializers
 {
+    namespace
+    {
+        enum SpellRecordFlags : uint8
+        {
+            SPELL_RECORD_CASTER_UNIT        = 0x01,
+            SPELL_RECORD_CASTER_UNIT_SELF   = 0x02,
+            SPELL_RECORD_ORIGINAL_CAST_ID   = 0x04,
+            SPELL_RECORD_BEACON             = 0x08,
+            SPELL_RECORD_RUNE_DATA          = 0x10
+        };
+
+        enum TargetRecordFlags : uint8
+        {
+            TARGET_RECORD_SRC_LOCATION      = 0x01,
+            TARGET_RECORD_DST_LOCATION      = 0x02,
+            TARGET_RECORD_ORIENTATION       = 0x04,
+            TARGET_RECORD_MAP_ID            = 0x08,
+            TARGET_RECORD_NAME              = 0x10
+        };
+
+        void EncodeGuids(BinaryWriter& w, std::span<WowGuid128 const> guids)
+        {
+            w.VarUInt(guids.size());
+            for (WowGuid128 const& guid : guids)
+                w.Guid(guid);
+        }
+
+        void DecodeGuids(BinaryReader& r, std::pmr::vector<WowGuid128>& guids)
+        {
+            guids.resize(r.Count(sizeof(WowGuid128)));
+            for (WowGuid128& guid : guids)
+                guid = r.Guid();
+        }
+
+        void EncodeTargetLocation(BinaryWriter& w, TargetLocation const& loc)
+        {
+            WriteBinaryFields<TARGET_LOCATION_FIELDS>(w, loc);
+        }
+
+        TargetLocation DecodeTargetLocation(BinaryReader& r)
+        {
+            TargetLocation loc{};
+            ReadBinaryFields<TARGET_LOCATION_FIELDS>(r, loc);
+            return loc;
+        }
+
+        void EncodeTargetData(BinaryWriter& w, SpellTargetData const& target)
+        {
+            uint8 flags = 0;
+            if (target.SrcLocation) flags |= TARGET_RECORD_SRC_LOCATION;
+            if (target.DstLocation) flags |= TARGET_RECORD_DST_LOCATION;
+            if (target.Orientation) flags |= TARGET_RECORD_ORIENTATION;
+            if (target.MapID) flags |= TARGET_RECORD_MAP_ID;
+            if (!target.Name.empty()) flags |= TARGET_RECORD_NAME;
+
+            w.UInt8(flags);
+            WriteBinaryFields<SPELL_TARGET_FIELDS>(w, target);
+
+            if (target.SrcLocation)
+                EncodeTargetLocation(w, *target.SrcLocation);
+            if (target.DstLocation)
+                EncodeTargetLocation(w, *target.DstLocation);
+            if (target.Orientation)
+                w.Float(*target.Orientation);
+            if (target.MapID)
+                w.VarInt(*target.MapID);
+            if (!target.Name.empty())
+                w.String(target.Name);
+        }
+
+        SpellTargetData DecodeTargetData(BinaryReader& r)
+        {
+            SpellTargetData target{};
+            uint8 flags = r.UInt8();
+            ReadBinaryFields<SPELL_TARGET_FIELDS>(r, target);
+
+            if (flags & TARGET_RECORD_SRC_LOCATION)
+                target.SrcLocation = DecodeTargetLocation(r);
+            if (flags & TARGET_RECORD_DST_LOCATION)
+                target.DstLocation = DecodeTargetLocation(r);
+            if (flags & TARGET_RECORD_ORIENTATION)
+                target.Orientation = r.Float();
+            if (flags & TARGET_RECORD_MAP_ID)
+                target.MapID = static_cast<int32>(r.VarInt());
+            if (flags & TARGET_RECORD_NAME)
+                target.Name = r.StringView();
+
+            return target;
+        }
+    }
+
     void SerializeSpellData(JsonWriter& w, SpellCastData const& data)
     {
         w.BeginObject();
@@ -18,36 +112,9 @@ namespace PktParser::V11_2_7_64877::Serializers
         if (!data.OriginalCastID.IsEmpty())
             w.WriteGuid("OriginalCastID", data.OriginalCastID);
 
-        w.WriteInt("SpellID", data.FixedData.SpellID);
-
-		if (data.FixedData.Visual.SpellXSpellVisualID)
-            w.WriteUInt("SpellXSpellVisualID", data.FixedData.Visual.SpellXSpellVisualID);
-        if (data.FixedData.Visual.ScriptVisualID)
-            w.WriteUInt("ScriptVisualID", data.FixedData.Visual.ScriptVisualID);
-        if (data.FixedData.CastFlags)
-            w.WriteUInt("CastFlags", data.FixedData.CastFlags);
-        if (data.FixedData.CastFlagsEx)
-            w.WriteUInt("CastFlagsEx", data.FixedData.CastFlagsEx);
-        if (data.FixedData.CastFlagsEx2)
-            w.WriteUInt("CastFlagsEx2", data.FixedData.CastFlagsEx2);
-        if (data.FixedData.CastTime)
-            w.WriteUInt("CastTime", data.FixedData.CastTime);
-        if (data.FixedData.MissileTrajectory.TravelTime)
-            w.WriteUInt("TravelTime", data.FixedData.MissileTrajectory.TravelTime);
-        if (data.FixedData.MissileTrajectory.Pitch != 0.f)
-            w.WriteDouble("Pitch", data.FixedData.MissileTrajectory.Pitch);
-        if (data.FixedData.AmmoDisplayID)
-            w.WriteInt("AmmoDisplayID", data.FixedData.AmmoDisplayID);
-        if (data.FixedData.DestLocSpellCastIndex)
-            w.WriteUInt("DestLocSpellCastIndex", data.FixedData.DestLocSpellCastIndex);
-        if (data.FixedData.Immunities.School)
-            w.WriteUInt("ImmunitySchool", data.FixedData.Immunities.School);
-        if (data.FixedData.Immunities.Value)
-            w.WriteUInt("ImmunityValue", data.FixedData.Immunities.Value);
-        if (data.HealPrediction.Points)
-            w.WriteUInt("HealPoints", data.HealPrediction.Points);
-        if (data.HealPrediction.Type)
-            w.WriteUInt("HealType", data.HealPrediction.Type);
+        WriteJsonFields<SPELL_CAST_FIXED_FIELDS>(w, data.FixedData);
+        WriteJsonFields<SPELL_HEAL_PREDICTION_FIELDS>(w, data.HealPrediction);
+
         if (!data.BeaconGUID.IsEmpty())
             w.WriteGuid("BeaconGUID", data.BeaconGUID);
 
@@ -131,18 +198,7 @@ namespace PktParser::V11_2_7_64877::Serializers
     void SerializeTargetData(JsonWriter& w, SpellTargetData const& target)
     {
         w.BeginObject();
-        if (target.Flags)
-            w.WriteUInt("Flags", target.Flags);
-            
-        if (!target.Unit.IsEmpty())
-            w.WriteGuid("Unit", target.Unit);
-        if (!target.Item.IsEmpty())
-            w.WriteGuid("Item", target.Item);
-
-        if (!target.HousingGUID.IsEmpty())
-			w.WriteGuid("HousingGUID", target.HousingGUID);
-		if (target.HousingIsResident)
-			w.WriteBool("HousingIsResident", target.HousingIsResident);
+        WriteJsonFields<SPELL_TARGET_FIELDS>(w, target);
 
         if (target.SrcLocation)
         {
@@ -170,11 +226,133 @@ namespace PktParser::V11_2_7_64877::Serializers
     void SerializeTargetLocation(JsonWriter& w, Structures::TargetLocation const& loc)
     {
         w.BeginObject();
-        if (!loc.Transport.IsEmpty())
-            w.WriteGuid("Transport", loc.Transport);
-        w.WriteDouble("X", loc.X);
-        w.WriteDouble("Y", loc.Y);
-        w.WriteDouble("Z", loc.Z);
+        WriteJsonFields<TARGET_LOCATION_FIELDS>(w, loc);
         w.EndObject();
     }
+
+    void EncodeSpellData(BinaryWriter& w, SpellCastData const& data)
+    {
+        uint8 flags = 0;
+        if (!data.CasterUnit.IsEmpty())
+            flags |= data.CasterUnit != data.CasterGUID ? SPELL_RECORD_CASTER_UNIT : SPELL_RECORD_CASTER_UNIT_SELF;
+        if (!data.OriginalCastID.IsEmpty())
+            flags |= SPELL_RECORD_ORIGINAL_CAST_ID;
+        if (!data.BeaconGUID.IsEmpty())
+            flags |= SPELL_RECORD_BEACON;
+        if (data.HasRuneData)
+            flags |= SPELL_RECORD_RUNE_DATA;
+
+        w.UInt8(flags);
+        w.Guid(data.CasterGUID);
+        if (flags & SPELL_RECORD_CASTER_UNIT)
+            w.Guid(data.CasterUnit);
+        w.Guid(data.CastID);
+        if (flags & SPELL_RECORD_ORIGINAL_CAST_ID)
+            w.Guid(data.OriginalCastID);
+
+        WriteBinaryFields<SPELL_CAST_FIXED_FIELDS>(w, data.FixedData);
+        WriteBinaryFields<SPELL_HEAL_PREDICTION_FIELDS>(w, data.HealPrediction);
+
+        if (flags & SPELL_RECORD_BEACON)
+            w.Guid(data.BeaconGUID);
+
+        EncodeTargetData(w, data.TargetData);
+        EncodeGuids(w, data.HitTargets);
+        EncodeGuids(w, data.MissTargets);
+
+        w.VarUInt(data.HitStatus.size());
+        for (SpellHitStatus const& status : data.HitStatus)
+            w.UInt8(status.Reason);
+
+        w.VarUInt(data.MissStatus.size());
+        for (SpellMissStatus const& status : data.MissStatus)
+        {
+            w.UInt8(status.MissReason);
+            w.UInt8(status.ReflectStatus);
+        }
+
+        w.VarUInt(data.RemainingPower.size());
+        for (SpellPowerData const& power : data.RemainingPower)
+        {
+            w.VarInt(power.Type);
+            w.VarInt(power.Cost);
+        }
+
+        if (data.HasRuneData)
+        {
+            w.UInt8(data.Runes.Start);
+            w.UInt8(data.Runes.Count);
+            w.VarUInt(data.RuneCooldowns.size());
+            w.Bytes(data.RuneCooldowns.data(), data.RuneCooldowns.size());
+        }
+
+        w.VarUInt(data.TargetPoints.size());
+        for (TargetLocation const& point : data.TargetPoints)
+            EncodeTargetLocation(w, point);
+    }
+
+    SpellCastData DecodeSpellData(BinaryReader& r)
+    {
+        SpellCastData data{};
+
+        uint8 flags = r.UInt8();
+        data.CasterGUID = r.Guid();
+        if (flags & SPELL_RECORD_CASTER_UNIT)
+            data.CasterUnit = r.Guid();
+        else if (flags & SPELL_RECORD_CASTER_UNIT_SELF)
+            data.CasterUnit = data.CasterGUID;
+        data.CastID = r.Guid();
+        if (flags & SPELL_RECORD_ORIGINAL_CAST_ID)
+            data.OriginalCastID = r.Guid();
+
+        ReadBinaryFields<SPELL_CAST_FIXED_FIELDS>(r, data.FixedData);
+        ReadBinaryFields<SPELL_HEAL_PREDICTION_FIELDS>(r, data.HealPrediction);
+
+        if (flags & SPELL_RECORD_BEACON)
+            data.BeaconGUID = r.Guid();
+
+        data.TargetData = DecodeTargetData(r);
+        DecodeGuids(r, data.HitTargets);
+        DecodeGuids(r, data.MissTargets);
+
+        data.HitStatus.resize(r.Count(1));
+        for (SpellHitStatus& status : data.HitStatus)
+            status.Reason = r.UInt8();
+
+        data.MissStatus.resize(r.Count(2));
+        for (SpellMissStatus& status : data.MissStatus)
+        {
+            status.MissReason = r.UInt8();
+            status.ReflectStatus = r.UInt8();
+        }
+
+        data.RemainingPower.resize(r.Count(2));
+        for (SpellPowerData& power : data.RemainingPower)
+        {
+            power.Type = static_cast<int8>(r.VarInt());
+            power.Cost = static_cast<int32>(r.VarInt());
+        }
+
+        data.HasRuneData = (flags & SPELL_RECORD_RUNE_DATA) != 0;
+        if (data.HasRuneData)
+        {
+            data.Runes.Start = r.UInt8();
+            data.Runes.Count = r.UInt8();
+            data.RuneCooldowns.resize(r.Count(1));
+            r.Bytes(data.RuneCooldowns.data(), data.RuneCooldowns.size());
+        }
+
+        data.TargetPoints.resize(r.Count(1));
+        for (TargetLocation& point : data.TargetPoints)
+            point = DecodeTargetLocation(r);
+
+        data.HitTargetsCount = static_cast<uint32>(data.HitTargets.size());
+        data.MissTargetsCount = static_cast<uint32>(data.MissTargets.size());
+        data.HitStatusCount = static_cast<uint32>(data.HitStatus.size());
+        data.MissStatusCount = static_cast<uint32>(data.MissStatus.size());
+        data.RemainingPowerCount = static_cast<uint32>(data.RemainingPower.size());
+        data.TargetPointsCount = static_cast<uint32>(data.TargetPoints.size());
+
+        return data;
+    }
 }
\ No newline at end of file
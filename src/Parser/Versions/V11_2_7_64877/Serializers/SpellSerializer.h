@@ -1,17 +1,24 @@
 #pragma once
 
 #include "JsonWriter.h"
+#include "FieldSerializers.h"
 #include "../Structures/SpellCastData.h"
 #include "../Structures/SpellTargetData.h"
 #include "../Structures/TargetLocation.h"
+#include "../Structures/FieldDescriptors.h"
 
 namespace PktParser::V11_2_7_64877::Serializers
 {
     using JsonWriter = PktParser::Common::JsonWriter;
+    using BinaryWriter = PktParser::Common::BinaryWriter;
+    using BinaryReader = PktParser::Common::BinaryReader;
 
     static constexpr size_t SPELL_CAST_JSON_RESERVE = 8192;
 
     void SerializeSpellData(JsonWriter& w, Structures::SpellCastData const& data);
     void SerializeTargetData(JsonWriter& w, Structures::SpellTargetData const& target);
     void SerializeTargetLocation(JsonWriter& w, Structures::TargetLocation const& loc);
+
+    void EncodeSpellData(BinaryWriter& w, Structures::SpellCastData const& data);
+    Structures::SpellCastData DecodeSpellData(BinaryReader& r);
 }
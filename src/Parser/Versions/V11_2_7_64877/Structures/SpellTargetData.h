@@ -3,7 +3,7 @@
 #include "Misc/WowGuid.h"
 #include "TargetLocation.h"
 
-#include <string>
+#include <string_view>
 #include <optional>
 
 namespace PktParser::V11_2_7_64877::Structures
@@ -21,6 +21,6 @@ namespace PktParser::V11_2_7_64877::Structures
         std::optional<TargetLocation> DstLocation;
         std::optional<float> Orientation;
         std::optional<int32> MapID;
-        std::string Name;
+        std::string_view Name;  // points into the packet / record the structure was parsed from
     };
 }
@@ -0,0 +1,2391 @@
+// AUTO-GENERATED from database - DO NOT EDIT
+// parser version: V12_0_0_65390
+// total opcodes: 2378
+#pragma once
+
+#include "Common/OpcodeEntry.h"
+
+namespace PktParser::V12_0_0_65390
+{
+    inline constexpr Common::OpcodeEntry OPCODE_TABLE[] =
+    {
+        { 0x3A02A4, "CMSG_ABANDON_NPE_RESPONSE", "ClientToServer" },
+        { 0x400029, "CMSG_ACCEPT_GUILD_INVITE", "ClientToServer" },
+        { 0x400177, "CMSG_ACCEPT_SOCIAL_CONTRACT", "ClientToServer" },
+        { 0x3A0004, "CMSG_ACCEPT_TRADE", "ClientToServer" },
+        { 0x40000C, "CMSG_ACCEPT_WARGAME_INVITE", "ClientToServer" },
+        { 0x3A02E6, "CMSG_ACCOUNT_BANK_DEPOSIT_MONEY", "ClientToServer" },
+        { 0x3A02E7, "CMSG_ACCOUNT_BANK_WITHDRAW_MONEY", "ClientToServer" },
+        { 0x400163, "CMSG_ACCOUNT_NOTIFICATION_ACKNOWLEDGED", "ClientToServer" },
+        { 0x4000C1, "CMSG_ACCOUNT_STORE_BEGIN_PURCHASE_OR_REFUND", "ClientToServer" },
+        { 0x3A0293, "CMSG_ACTIVATE_SOULBIND", "ClientToServer" },
+        { 0x3B003E, "CMSG_ACTIVATE_TAXI", "ClientToServer" },
+        { 0x3A0179, "CMSG_ADD_ACCOUNT_COSMETIC", "ClientToServer" },
+        { 0x400086, "CMSG_ADD_BATTLENET_FRIEND", "ClientToServer" },
+        { 0x400100, "CMSG_ADD_FRIEND", "ClientToServer" },
+        { 0x400104, "CMSG_ADD_IGNORE", "ClientToServer" },
+        { 0x400004, "CMSG_ADDON_LIST", "ClientToServer" },
+        { 0x3A0178, "CMSG_ADD_TOY", "ClientToServer" },
+        { 0x3A00BB, "CMSG_ADVENTURE_JOURNAL_OPEN_QUEST", "ClientToServer" },
+        { 0x3A0296, "CMSG_ADVENTURE_JOURNAL_UPDATE_SUGGESTIONS", "ClientToServer" },
+        { 0x3A0236, "CMSG_ADVENTURE_MAP_START_QUEST", "ClientToServer" },
+        { 0x3B008D, "CMSG_ALTER_APPEARANCE", "ClientToServer" },
+        { 0x3B0043, "CMSG_AREA_SPIRIT_HEALER_QUERY", "ClientToServer" },
+        { 0x3B0044, "CMSG_AREA_SPIRIT_HEALER_QUEUE", "ClientToServer" },
+        { 0x3A008D, "CMSG_AREA_TRIGGER", "ClientToServer" },
+        { 0x3A005C, "CMSG_ARTIFACT_ADD_POWER", "ClientToServer" },
+        { 0x3A005E, "CMSG_ARTIFACT_SET_APPEARANCE", "ClientToServer" },
+        { 0x3A00C7, "CMSG_ASSIGN_EQUIPMENT_SET_SPEC", "ClientToServer" },
+        { 0x3A0125, "CMSG_ATTACK_STOP", "ClientToServer" },
+        { 0x3A0124, "CMSG_ATTACK_SWING", "ClientToServer" },
+        { 0x400116, "CMSG_AUCTIONABLE_TOKEN_SELL", "ClientToServer" },
+        { 0x400117, "CMSG_AUCTIONABLE_TOKEN_SELL_AT_MARKET_PRICE", "ClientToServer" },
+        { 0x3B0061, "CMSG_AUCTION_BROWSE_QUERY", "ClientToServer" },
+        { 0x3B0069, "CMSG_AUCTION_CANCEL_COMMODITIES_PURCHASE", "ClientToServer" },
+        { 0x3B0068, "CMSG_AUCTION_CONFIRM_COMMODITIES_PURCHASE", "ClientToServer" },
+        { 0x3B0067, "CMSG_AUCTION_GET_COMMODITY_QUOTE", "ClientToServer" },
+        { 0x3B005C, "CMSG_AUCTION_HELLO_REQUEST", "ClientToServer" },
+        { 0x3B0065, "CMSG_AUCTION_LIST_BIDDED_ITEMS", "ClientToServer" },
+        { 0x3B0066, "CMSG_AUCTION_LIST_BUCKETS_BY_BUCKET_KEYS", "ClientToServer" },
+        { 0x3B0062, "CMSG_AUCTION_LIST_ITEMS_BY_BUCKET_KEY", "ClientToServer" },
+        { 0x3B0063, "CMSG_AUCTION_LIST_ITEMS_BY_ITEM_ID", "ClientToServer" },
+        { 0x3B0064, "CMSG_AUCTION_LIST_OWNED_ITEMS", "ClientToServer" },
+        { 0x3B0060, "CMSG_AUCTION_PLACE_BID", "ClientToServer" },
+        { 0x3B005E, "CMSG_AUCTION_REMOVE_ITEM", "ClientToServer" },
+        { 0x3B005F, "CMSG_AUCTION_REPLICATE_ITEMS", "ClientToServer" },
+        { 0x3B006A, "CMSG_AUCTION_SELL_COMMODITY", "ClientToServer" },
+        { 0x3B005D, "CMSG_AUCTION_SELL_ITEM", "ClientToServer" },
+        { 0x400164, "CMSG_AUCTION_SET_FAVORITE_ITEM", "ClientToServer" },
+        { 0x410003, "CMSG_AUTH_CONTINUED_SESSION", "ClientToServer" },
+        { 0x410001, "CMSG_AUTH_SESSION", "ClientToServer" },
+        { 0x3D0003, "CMSG_AUTOBANK_ITEM", "ClientToServer" },
+        { 0x3A02F0, "CMSG_AUTO_DEPOSIT_ACCOUNT_BANK", "ClientToServer" },
+        { 0x3A02FA, "CMSG_AUTO_DEPOSIT_CHARACTER_BANK", "ClientToServer" },
+        { 0x3D0004, "CMSG_AUTO_EQUIP_ITEM", "ClientToServer" },
+        { 0x3D0009, "CMSG_AUTO_EQUIP_ITEM_SLOT", "ClientToServer" },
+        { 0x3B0048, "CMSG_AUTO_GUILD_BANK_ITEM", "ClientToServer" },
+        { 0x3D0005, "CMSG_AUTO_STORE_BAG_ITEM", "ClientToServer" },
+        { 0x3D0002, "CMSG_AUTOSTORE_BANK_ITEM", "ClientToServer" },
+        { 0x3B0051, "CMSG_AUTO_STORE_GUILD_BANK_ITEM", "ClientToServer" },
+        { 0x3A0262, "CMSG_AZERITE_EMPOWERED_ITEM_SELECT_POWER", "ClientToServer" },
+        { 0x3A0242, "CMSG_AZERITE_EMPOWERED_ITEM_VIEWED", "ClientToServer" },
+        { 0x3A0264, "CMSG_AZERITE_ESSENCE_ACTIVATE_ESSENCE", "ClientToServer" },
+        { 0x3A0263, "CMSG_AZERITE_ESSENCE_UNLOCK_MILESTONE", "ClientToServer" },
+        { 0x3B0046, "CMSG_BANKER_ACTIVATE", "ClientToServer" },
+        { 0x3A001F, "CMSG_BATTLEFIELD_LEAVE", "ClientToServer" },
+        { 0x3A002A, "CMSG_BATTLEFIELD_LIST", "ClientToServer" },
+        { 0x3B00C4, "CMSG_BATTLEFIELD_PORT", "ClientToServer" },
+        { 0x3A0197, "CMSG_BATTLEMASTER_HELLO", "ClientToServer" },
+        { 0x3B00BA, "CMSG_BATTLEMASTER_JOIN", "ClientToServer" },
+        { 0x3B00BB, "CMSG_BATTLEMASTER_JOIN_ARENA", "ClientToServer" },
+        { 0x3B00C1, "CMSG_BATTLEMASTER_JOIN_BRAWL", "ClientToServer" },
+        { 0x3B00BD, "CMSG_BATTLEMASTER_JOIN_RATED_BG_BLITZ", "ClientToServer" },
+        { 0x3B00BC, "CMSG_BATTLEMASTER_JOIN_RATED_SOLO_SHUFFLE", "ClientToServer" },
+        { 0x3B00BE, "CMSG_BATTLEMASTER_JOIN_SKIRMISH", "ClientToServer" },
+        { 0x400103, "CMSG_BATTLENET_CHALLENGE_RESPONSE", "ClientToServer" },
+        { 0x400124, "CMSG_BATTLENET_REQUEST", "ClientToServer" },
+        { 0x4000FC, "CMSG_BATTLE_PAY_ACK_FAILED_RESPONSE", "ClientToServer" },
+        { 0x400141, "CMSG_BATTLE_PAY_CANCEL_OPEN_CHECKOUT", "ClientToServer" },
+        { 0x4000FB, "CMSG_BATTLE_PAY_CONFIRM_PURCHASE_RESPONSE", "ClientToServer" },
+        { 0x4000F2, "CMSG_BATTLE_PAY_DISTRIBUTION_ASSIGN_TO_TARGET", "ClientToServer" },
+        { 0x400167, "CMSG_BATTLE_PAY_DISTRIBUTION_ASSIGN_VAS", "ClientToServer" },
+        { 0x4000E9, "CMSG_BATTLE_PAY_GET_PRODUCT_LIST", "ClientToServer" },
+        { 0x4000EA, "CMSG_BATTLE_PAY_GET_PURCHASE_LIST", "ClientToServer" },
+        { 0x40013A, "CMSG_BATTLE_PAY_OPEN_CHECKOUT", "ClientToServer" },
+        { 0x400135, "CMSG_BATTLE_PAY_REQUEST_PRICE_INFO", "ClientToServer" },
+        { 0x4000FA, "CMSG_BATTLE_PAY_START_PURCHASE", "ClientToServer" },
+        { 0x400122, "CMSG_BATTLE_PAY_START_VAS_PURCHASE", "ClientToServer" },
+        { 0x290002, "CMSG_BATTLE_PET_CLEAR_FANFARE", "ClientToServer" },
+        { 0x40004F, "CMSG_BATTLE_PET_DELETE_PET", "ClientToServer" },
+        { 0x400052, "CMSG_BATTLE_PET_MODIFY_NAME", "ClientToServer" },
+        { 0x40004E, "CMSG_BATTLE_PET_REQUEST_JOURNAL", "ClientToServer" },
+        { 0x40004D, "CMSG_BATTLE_PET_REQUEST_JOURNAL_LOCK", "ClientToServer" },
+        { 0x400057, "CMSG_BATTLE_PET_SET_BATTLE_SLOT", "ClientToServer" },
+        { 0x40005A, "CMSG_BATTLE_PET_SET_FLAGS", "ClientToServer" },
+        { 0x400053, "CMSG_BATTLE_PET_SUMMON", "ClientToServer" },
+        { 0x3A0097, "CMSG_BATTLE_PET_UPDATE_DISPLAY_NOTIFY", "ClientToServer" },
+        { 0x3A0096, "CMSG_BATTLE_PET_UPDATE_NOTIFY", "ClientToServer" },
+        { 0x3A0001, "CMSG_BEGIN_TRADE", "ClientToServer" },
+        { 0x3B0045, "CMSG_BINDER_ACTIVATE", "ClientToServer" },
+        { 0x3B00CC, "CMSG_BLACK_MARKET_BID_ON_ITEM", "ClientToServer" },
+        { 0x3B00CA, "CMSG_BLACK_MARKET_OPEN", "ClientToServer" },
+        { 0x3B00CB, "CMSG_BLACK_MARKET_REQUEST_ITEMS", "ClientToServer" },
+        { 0x3A0265, "CMSG_BONUS_ROLL", "ClientToServer" },
+        { 0x4000B1, "CMSG_BUG_REPORT", "ClientToServer" },
+        { 0x290032, "CMSG_BULK_PURCHASE", "ClientToServer" },
+        { 0x3A0002, "CMSG_BUSY_TRADE", "ClientToServer" },
+        { 0x3B0124, "CMSG_BUY_ACCOUNT_BANK_TAB", "ClientToServer" },
+        { 0x3B0037, "CMSG_BUY_BACK_ITEM", "ClientToServer" },
+        { 0x3B0036, "CMSG_BUY_ITEM", "ClientToServer" },
+        { 0x3A00AA, "CMSG_CAGE_BATTLE_PET", "ClientToServer" },
+        { 0x4000A9, "CMSG_CALENDAR_ADD_EVENT", "ClientToServer" },
+        { 0x40009D, "CMSG_CALENDAR_COMMUNITY_INVITE", "ClientToServer" },
+        { 0x4000A5, "CMSG_CALENDAR_COMPLAIN", "ClientToServer" },
+        { 0x4000A4, "CMSG_CALENDAR_COPY_EVENT", "ClientToServer" },
+        { 0x4000A7, "CMSG_CALENDAR_EVENT_SIGN_UP", "ClientToServer" },
+        { 0x40009B, "CMSG_CALENDAR_GET", "ClientToServer" },
+        { 0x40009C, "CMSG_CALENDAR_GET_EVENT", "ClientToServer" },
+        { 0x4000A6, "CMSG_CALENDAR_GET_NUM_PENDING", "ClientToServer" },
+        { 0x40009E, "CMSG_CALENDAR_INVITE", "ClientToServer" },
+        { 0x4000A2, "CMSG_CALENDAR_MODERATOR_STATUS", "ClientToServer" },
+        { 0x4000A3, "CMSG_CALENDAR_REMOVE_EVENT", "ClientToServer" },
+        { 0x40009F, "CMSG_CALENDAR_REMOVE_INVITE", "ClientToServer" },
+        { 0x4000A0, "CMSG_CALENDAR_RSVP", "ClientToServer" },
+        { 0x4000A1, "CMSG_CALENDAR_STATUS", "ClientToServer" },
+        { 0x4000AA, "CMSG_CALENDAR_UPDATE_EVENT", "ClientToServer" },
+        { 0x3A0060, "CMSG_CANCEL_AURA", "ClientToServer" },
+        { 0x3B007F, "CMSG_CANCEL_AUTO_REPEAT_SPELL", "ClientToServer" },
+        { 0x3A017F, "CMSG_CANCEL_CAST", "ClientToServer" },
+        { 0x3A0140, "CMSG_CANCEL_CHANNELLING", "ClientToServer" },
+        { 0x3A0148, "CMSG_CANCEL_GROWTH_AURA", "ClientToServer" },
+        { 0x3A00D4, "CMSG_CANCEL_MASTER_LOOT_ROLL", "ClientToServer" },
+        { 0x3A005F, "CMSG_CANCEL_MOD_SPEED_NO_CONTROL_AURAS", "ClientToServer" },
+        { 0x3A015B, "CMSG_CANCEL_MOUNT_AURA", "ClientToServer" },
+        { 0x3A002B, "CMSG_CANCEL_QUEUED_SPELL", "ClientToServer" },
+        { 0x3B008A, "CMSG_CANCEL_TEMP_ENCHANTMENT", "ClientToServer" },
+        { 0x3A0006, "CMSG_CANCEL_TRADE", "ClientToServer" },
+        { 0x40008E, "CMSG_CAN_DUEL", "ClientToServer" },
+        { 0x400134, "CMSG_CAN_REDEEM_TOKEN_FOR_BALANCE", "ClientToServer" },
+        { 0x3A017C, "CMSG_CAST_SPELL", "ClientToServer" },
+        { 0x4000FD, "CMSG_CATALOG_SHOP_LICENSE_GAME_DATA_REQUEST", "ClientToServer" },
+        { 0x2C0002, "CMSG_CHALLENGE_MODE_REQUEST_LEADERS", "ClientToServer" },
+        { 0x3A021B, "CMSG_CHANGE_BAG_SLOT_FLAG", "ClientToServer" },
+        { 0x3A021C, "CMSG_CHANGE_BANK_BAG_SLOT_FLAG", "ClientToServer" },
+        { 0x3A01FC, "CMSG_CHANGE_MONUMENT_APPEARANCE", "ClientToServer" },
+        { 0x400129, "CMSG_CHANGE_REALM_TICKET", "ClientToServer" },
+        { 0x400078, "CMSG_CHANGE_SUB_GROUP", "ClientToServer" },
+        { 0x4000F5, "CMSG_CHARACTER_CHECK_UPGRADE", "ClientToServer" },
+        { 0x4000F0, "CMSG_CHARACTER_RENAME_REQUEST", "ClientToServer" },
+        { 0x4000F3, "CMSG_CHARACTER_UPGRADE_MANUAL_UNREVOKE_REQUEST", "ClientToServer" },
+        { 0x4000F4, "CMSG_CHARACTER_UPGRADE_START", "ClientToServer" },
+        { 0x4000B9, "CMSG_CHAR_CUSTOMIZE", "ClientToServer" },
+        { 0x4000CB, "CMSG_CHAR_DELETE", "ClientToServer" },
+        { 0x4000BF, "CMSG_CHAR_RACE_OR_FACTION_CHANGE", "ClientToServer" },
+        { 0x2B002A, "CMSG_CHAT_ADDON_MESSAGE", "ClientToServer" },
+        { 0x2B002B, "CMSG_CHAT_ADDON_MESSAGE_TARGETED", "ClientToServer" },
+        { 0x2B0032, "CMSG_CHAT_CAN_LOCAL_WHISPER_TARGET_REQUEST", "ClientToServer" },
+        { 0x2B001F, "CMSG_CHAT_CHANNEL_ANNOUNCEMENTS", "ClientToServer" },
+        { 0x2B001D, "CMSG_CHAT_CHANNEL_BAN", "ClientToServer" },
+        { 0x2B0022, "CMSG_CHAT_CHANNEL_DECLINE_INVITE", "ClientToServer" },
+        { 0x2B0012, "CMSG_CHAT_CHANNEL_DISPLAY_LIST", "ClientToServer" },
+        { 0x2B001B, "CMSG_CHAT_CHANNEL_INVITE", "ClientToServer" },
+        { 0x2B001C, "CMSG_CHAT_CHANNEL_KICK", "ClientToServer" },
+        { 0x2B0011, "CMSG_CHAT_CHANNEL_LIST", "ClientToServer" },
+        { 0x2B0016, "CMSG_CHAT_CHANNEL_MODERATE", "ClientToServer" },
+        { 0x2B0017, "CMSG_CHAT_CHANNEL_MODERATOR", "ClientToServer" },
+        { 0x2B0015, "CMSG_CHAT_CHANNEL_OWNER", "ClientToServer" },
+        { 0x2B0013, "CMSG_CHAT_CHANNEL_PASSWORD", "ClientToServer" },
+        { 0x2B0014, "CMSG_CHAT_CHANNEL_SET_OWNER", "ClientToServer" },
+        { 0x2B0020, "CMSG_CHAT_CHANNEL_SILENCE_ALL", "ClientToServer" },
+        { 0x2B001E, "CMSG_CHAT_CHANNEL_UNBAN", "ClientToServer" },
+        { 0x2B0018, "CMSG_CHAT_CHANNEL_UNMODERATOR", "ClientToServer" },
+        { 0x2B0021, "CMSG_CHAT_CHANNEL_UNSILENCE_ALL", "ClientToServer" },
+        { 0x2B000A, "CMSG_CHAT_DROP_CAUTIONARY_CHAT_MESSAGE", "ClientToServer" },
+        { 0x2B0000, "CMSG_CHAT_JOIN_CHANNEL", "ClientToServer" },
+        { 0x2B0001, "CMSG_CHAT_LEAVE_CHANNEL", "ClientToServer" },
+        { 0x2B0031, "CMSG_CHAT_LOBBY_MATCHMAKER_MESSAGE_INSTANCE_CHAT", "ClientToServer" },
+        { 0x2B0030, "CMSG_CHAT_LOBBY_MATCHMAKER_MESSAGE_PARTY", "ClientToServer" },
+        { 0x2B000F, "CMSG_CHAT_MESSAGE_AFK", "ClientToServer" },
+        { 0x2B0007, "CMSG_CHAT_MESSAGE_CHANNEL", "ClientToServer" },
+        { 0x2B0010, "CMSG_CHAT_MESSAGE_DND", "ClientToServer" },
+        { 0x2B0024, "CMSG_CHAT_MESSAGE_EMOTE", "ClientToServer" },
+        { 0x2B000D, "CMSG_CHAT_MESSAGE_GUILD", "ClientToServer" },
+        { 0x2B0028, "CMSG_CHAT_MESSAGE_INSTANCE_CHAT", "ClientToServer" },
+        { 0x2B000E, "CMSG_CHAT_MESSAGE_OFFICER", "ClientToServer" },
+        { 0x2B0026, "CMSG_CHAT_MESSAGE_PARTY", "ClientToServer" },
+        { 0x2B0027, "CMSG_CHAT_MESSAGE_RAID", "ClientToServer" },
+        { 0x2B0029, "CMSG_CHAT_MESSAGE_RAID_WARNING", "ClientToServer" },
+        { 0x2B0023, "CMSG_CHAT_MESSAGE_SAY", "ClientToServer" },
+        { 0x2B0008, "CMSG_CHAT_MESSAGE_WHISPER", "ClientToServer" },
+        { 0x2B0025, "CMSG_CHAT_MESSAGE_YELL", "ClientToServer" },
+        { 0x2B0005, "CMSG_CHAT_REGISTER_ADDON_PREFIXES", "ClientToServer" },
+        { 0x2B0004, "CMSG_CHAT_REPORT_FILTERED", "ClientToServer" },
+        { 0x2B0003, "CMSG_CHAT_REPORT_IGNORED", "ClientToServer" },
+        { 0x2B000B, "CMSG_CHAT_SEND_CAUTIONARY_CHANNEL_MESSAGE", "ClientToServer" },
+        { 0x2B0009, "CMSG_CHAT_SEND_CAUTIONARY_CHAT_MESSAGE", "ClientToServer" },
+        { 0x2B0006, "CMSG_CHAT_UNREGISTER_ALL_ADDON_PREFIXES", "ClientToServer" },
+        { 0x400071, "CMSG_CHECK_CHARACTER_NAME_AVAILABILITY", "ClientToServer" },
+        { 0x3A0116, "CMSG_CHECK_IS_ADVENTURE_MAP_POI_VALID", "ClientToServer" },
+        { 0x3A0184, "CMSG_CHOICE_RESPONSE", "ClientToServer" },
+        { 0x3A0292, "CMSG_CHROMIE_TIME_SELECT_EXPANSION", "ClientToServer" },
+        { 0x3A026F, "CMSG_CLAIM_WEEKLY_REWARD", "ClientToServer" },
+        { 0x3A02CC, "CMSG_CLASS_TALENTS_DELETE_CONFIG", "ClientToServer" },
+        { 0x3A00CB, "CMSG_CLASS_TALENTS_NOTIFY_EMPTY_CONFIG", "ClientToServer" },
+        { 0x3A02CE, "CMSG_CLASS_TALENTS_NOTIFY_VALIDATION_FAILED", "ClientToServer" },
+        { 0x3A02CB, "CMSG_CLASS_TALENTS_RENAME_CONFIG", "ClientToServer" },
+        { 0x3A02CA, "CMSG_CLASS_TALENTS_REQUEST_NEW_CONFIG", "ClientToServer" },
+        { 0x3A02CF, "CMSG_CLASS_TALENTS_SET_STARTER_BUILD_ACTIVE", "ClientToServer" },
+        { 0x3A00CA, "CMSG_CLASS_TALENTS_SET_USES_SHARED_ACTION_BARS", "ClientToServer" },
+        { 0x290005, "CMSG_CLEAR_NEW_APPEARANCE", "ClientToServer" },
+        { 0x3A0058, "CMSG_CLEAR_RAID_MARKER", "ClientToServer" },
+        { 0x3A0008, "CMSG_CLEAR_TRADE_ITEM", "ClientToServer" },
+        { 0x3B00C6, "CMSG_CLIENT_PORT_GRAVEYARD", "ClientToServer" },
+        { 0x3B0025, "CMSG_CLOSE_INTERACTION", "ClientToServer" },
+        { 0x3A0185, "CMSG_CLOSE_QUEST_CHOICE", "ClientToServer" },
+        { 0x3A029A, "CMSG_CLOSE_RUNEFORGE_INTERACTION", "ClientToServer" },
+        { 0x3A02D0, "CMSG_CLOSE_TRAIT_SYSTEM_INTERACTION", "ClientToServer" },
+        { 0x40014C, "CMSG_CLUB_FINDER_APPLICATION_RESPONSE", "ClientToServer" },
+        { 0x40014A, "CMSG_CLUB_FINDER_GET_APPLICANTS_LIST", "ClientToServer" },
+        { 0x400147, "CMSG_CLUB_FINDER_POST", "ClientToServer" },
+        { 0x40014E, "CMSG_CLUB_FINDER_REQUEST_CLUBS_DATA", "ClientToServer" },
+        { 0x400148, "CMSG_CLUB_FINDER_REQUEST_CLUBS_LIST", "ClientToServer" },
+        { 0x400149, "CMSG_CLUB_FINDER_REQUEST_MEMBERSHIP_TO_CLUB", "ClientToServer" },
+        { 0x40014D, "CMSG_CLUB_FINDER_REQUEST_PENDING_CLUBS_LIST", "ClientToServer" },
+        { 0x40014F, "CMSG_CLUB_FINDER_REQUEST_SUBSCRIBED_CLUB_POSTING_IDS", "ClientToServer" },
+        { 0x40014B, "CMSG_CLUB_FINDER_RESPOND_TO_APPLICANT", "ClientToServer" },
+        { 0x40016A, "CMSG_CLUB_FINDER_WHISPER_APPLICANT_REQUEST", "ClientToServer" },
+        { 0x400126, "CMSG_CLUB_PRESENCE_SUBSCRIBE", "ClientToServer" },
+        { 0x40005D, "CMSG_COLLECTION_ITEM_SET_FAVORITE", "ClientToServer" },
+        { 0x40001C, "CMSG_COMMENTATOR_ENABLE", "ClientToServer" },
+        { 0x400020, "CMSG_COMMENTATOR_ENTER_INSTANCE", "ClientToServer" },
+        { 0x400021, "CMSG_COMMENTATOR_EXIT_INSTANCE", "ClientToServer" },
+        { 0x40001D, "CMSG_COMMENTATOR_GET_MAP_INFO", "ClientToServer" },
+        { 0x40001F, "CMSG_COMMENTATOR_GET_PLAYER_COOLDOWNS", "ClientToServer" },
+        { 0x40001E, "CMSG_COMMENTATOR_GET_PLAYER_INFO", "ClientToServer" },
+        { 0x400168, "CMSG_COMMENTATOR_SPECTATE", "ClientToServer" },
+        { 0x40001B, "CMSG_COMMENTATOR_START_WARGAME", "ClientToServer" },
+        { 0x400114, "CMSG_COMMERCE_TOKEN_GET_COUNT", "ClientToServer" },
+        { 0x40011E, "CMSG_COMMERCE_TOKEN_GET_LOG", "ClientToServer" },
+        { 0x400115, "CMSG_COMMERCE_TOKEN_GET_MARKET_PRICE", "ClientToServer" },
+        { 0x400098, "CMSG_COMPLAINT", "ClientToServer" },
+        { 0x3B00E4, "CMSG_COMPLETE_CINEMATIC", "ClientToServer" },
+        { 0x3B0075, "CMSG_COMPLETE_MOVIE", "ClientToServer" },
+        { 0x3A005D, "CMSG_CONFIRM_ARTIFACT_RESPEC", "ClientToServer" },
+        { 0x3A00CE, "CMSG_CONFIRM_PROFESSION_RESPEC", "ClientToServer" },
+        { 0x3A00CD, "CMSG_CONFIRM_RESPEC_WIPE", "ClientToServer" },
+        { 0x400000, "CMSG_CONNECT_TO_FAILED", "ClientToServer" },
+        { 0x400119, "CMSG_CONSUMABLE_TOKEN_BUY", "ClientToServer" },
+        { 0x40011A, "CMSG_CONSUMABLE_TOKEN_BUY_AT_MARKET_PRICE", "ClientToServer" },
+        { 0x400118, "CMSG_CONSUMABLE_TOKEN_CAN_VETERAN_BUY", "ClientToServer" },
+        { 0x40011C, "CMSG_CONSUMABLE_TOKEN_REDEEM", "ClientToServer" },
+        { 0x40011D, "CMSG_CONSUMABLE_TOKEN_REDEEM_CONFIRMATION", "ClientToServer" },
+        { 0x3A02DF, "CMSG_CONTENT_TRACKING_START_TRACKING", "ClientToServer" },
+        { 0x3A02E0, "CMSG_CONTENT_TRACKING_STOP_TRACKING", "ClientToServer" },
+        { 0x3B00FC, "CMSG_CONTRIBUTION_CONTRIBUTE", "ClientToServer" },
+        { 0x3B00FD, "CMSG_CONTRIBUTION_LAST_UPDATE_REQUEST", "ClientToServer" },
+        { 0x3B00E6, "CMSG_CONVERSATION_CINEMATIC_READY", "ClientToServer" },
+        { 0x3B00E5, "CMSG_CONVERSATION_LINE_STARTED", "ClientToServer" },
+        { 0x3A02EF, "CMSG_CONVERT_ITEM_TO_BIND_TO_ACCOUNT", "ClientToServer" },
+        { 0x40007A, "CMSG_CONVERT_RAID", "ClientToServer" },
+        { 0x40018D, "CMSG_CONVERT_TIMERUNNING_CHARACTER", "ClientToServer" },
+        { 0x3B0110, "CMSG_COVENANT_RENOWN_REQUEST_CATCHUP_STATE", "ClientToServer" },
+        { 0x3B011C, "CMSG_CRAFTING_ORDER_CANCEL", "ClientToServer" },
+        { 0x3B0119, "CMSG_CRAFTING_ORDER_CLAIM", "ClientToServer" },
+        { 0x3B0115, "CMSG_CRAFTING_ORDER_CREATE", "ClientToServer" },
+        { 0x3B011B, "CMSG_CRAFTING_ORDER_FULFILL", "ClientToServer" },
+        { 0x3B0118, "CMSG_CRAFTING_ORDER_GET_NPC_REWARD_INFO", "ClientToServer" },
+        { 0x3B0117, "CMSG_CRAFTING_ORDER_LIST_CRAFTER_ORDERS", "ClientToServer" },
+        { 0x3B0116, "CMSG_CRAFTING_ORDER_LIST_MY_ORDERS", "ClientToServer" },
+        { 0x3B011D, "CMSG_CRAFTING_ORDER_REJECT", "ClientToServer" },
+        { 0x3B011A, "CMSG_CRAFTING_ORDER_RELEASE", "ClientToServer" },
+        { 0x3B011E, "CMSG_CRAFTING_ORDER_REPORT_PLAYER", "ClientToServer" },
+        { 0x3B011F, "CMSG_CRAFTING_ORDER_UPDATE_IGNORE_LIST", "ClientToServer" },
+        { 0x400070, "CMSG_CREATE_CHARACTER", "ClientToServer" },
+        { 0x3A01E5, "CMSG_CREATE_SHIPMENT", "ClientToServer" },
+        { 0x400010, "CMSG_DB_QUERY_BULK", "ClientToServer" },
+        { 0x3B00B7, "CMSG_DECLINE_GUILD_INVITES", "ClientToServer" },
+        { 0x3B0130, "CMSG_DECLINE_NEIGHBORHOOD_INVITES", "ClientToServer" },
+        { 0x3B00D3, "CMSG_DECLINE_PETITION", "ClientToServer" },
+        { 0x3B00A3, "CMSG_DELETE_EQUIPMENT_SET", "ClientToServer" },
+        { 0x400101, "CMSG_DEL_FRIEND", "ClientToServer" },
+        { 0x400105, "CMSG_DEL_IGNORE", "ClientToServer" },
+        { 0x3B012C, "CMSG_DELVE_TELEPORT_OUT", "ClientToServer" },
+        { 0x3A0172, "CMSG_DESTROY_ITEM", "ClientToServer" },
+        { 0x400044, "CMSG_DF_BOOT_PLAYER_VOTE", "ClientToServer" },
+        { 0x400036, "CMSG_DF_CONFIRM_EXPAND_SEARCH", "ClientToServer" },
+        { 0x400042, "CMSG_DF_GET_JOIN_STATUS", "ClientToServer" },
+        { 0x400041, "CMSG_DF_GET_SYSTEM_INFO", "ClientToServer" },
+        { 0x400037, "CMSG_DF_JOIN", "ClientToServer" },
+        { 0x400040, "CMSG_DF_LEAVE", "ClientToServer" },
+        { 0x400035, "CMSG_DF_PROPOSAL_RESPONSE", "ClientToServer" },
+        { 0x400048, "CMSG_DF_READY_CHECK_RESPONSE", "ClientToServer" },
+        { 0x400043, "CMSG_DF_SET_ROLES", "ClientToServer" },
+        { 0x400045, "CMSG_DF_TELEPORT", "ClientToServer" },
+        { 0x3E0060, "CMSG_DISCARDED_TIME_SYNC_ACKS", "ClientToServer" },
+        { 0x3B0091, "CMSG_DISMISS_CRITTER", "ClientToServer" },
+        { 0x400146, "CMSG_DO_COUNTDOWN", "ClientToServer" },
+        { 0x3A00D3, "CMSG_DO_MASTER_LOOT_ROLL", "ClientToServer" },
+        { 0x40005E, "CMSG_DO_READY_CHECK", "ClientToServer" },
+        { 0x3B007A, "CMSG_DUEL_RESPONSE", "ClientToServer" },
+        { 0x3A010B, "CMSG_EJECT_PASSENGER", "ClientToServer" },
+        { 0x3B00E0, "CMSG_EMOTE", "ClientToServer" },
+        { 0x410009, "CMSG_ENABLE_NAGLE", "ClientToServer" },
+        { 0x3B003C, "CMSG_ENABLE_TAXI_NODE", "ClientToServer" },
+        { 0x3A030A, "CMSG_ENCOUNTER_JOURNAL_START_ARATHI_RPE", "ClientToServer" },
+        { 0x400113, "CMSG_ENGINE_SURVEY", "ClientToServer" },
+        { 0x410005, "CMSG_ENTER_ENCRYPTED_MODE_ACK", "ClientToServer" },
+        { 0x400014, "CMSG_ENUM_CHARACTERS", "ClientToServer" },
+        { 0x40010D, "CMSG_ENUM_CHARACTERS_DELETED_BY_CLIENT", "ClientToServer" },
+        { 0x3B0080, "CMSG_FAR_SIGHT", "ClientToServer" },
+        { 0x3A0064, "CMSG_GAME_EVENT_DEBUG_DISABLE", "ClientToServer" },
+        { 0x3A0063, "CMSG_GAME_EVENT_DEBUG_ENABLE", "ClientToServer" },
+        { 0x3B0087, "CMSG_GAME_OBJ_REPORT_USE", "ClientToServer" },
+        { 0x3B0086, "CMSG_GAME_OBJ_USE", "ClientToServer" },
+        { 0x3A01E0, "CMSG_GARRISON_ADD_FOLLOWER_HEALTH", "ClientToServer" },
+        { 0x3A01C6, "CMSG_GARRISON_ASSIGN_FOLLOWER_TO_BUILDING", "ClientToServer" },
+        { 0x3A01B2, "CMSG_GARRISON_CANCEL_CONSTRUCTION", "ClientToServer" },
+        { 0x3A0217, "CMSG_GARRISON_CHECK_UPGRADEABLE", "ClientToServer" },
+        { 0x3A0209, "CMSG_GARRISON_COMPLETE_MISSION", "ClientToServer" },
+        { 0x3A01E1, "CMSG_GARRISON_FULLY_HEAL_ALL_FOLLOWERS", "ClientToServer" },
+        { 0x3A01C9, "CMSG_GARRISON_GENERATE_RECRUITS", "ClientToServer" },
+        { 0x3A01D8, "CMSG_GARRISON_GET_CLASS_SPEC_CATEGORY_INFO", "ClientToServer" },
+        { 0x3A01DF, "CMSG_GARRISON_GET_MAP_DATA", "ClientToServer" },
+        { 0x3A023A, "CMSG_GARRISON_GET_MISSION_REWARD", "ClientToServer" },
+        { 0x3A01D4, "CMSG_GARRISON_LEARN_TALENT", "ClientToServer" },
+        { 0x3A020B, "CMSG_GARRISON_MISSION_BONUS_ROLL", "ClientToServer" },
+        { 0x3A01AE, "CMSG_GARRISON_PURCHASE_BUILDING", "ClientToServer" },
+        { 0x3A01CB, "CMSG_GARRISON_RECRUIT_FOLLOWER", "ClientToServer" },
+        { 0x3A0200, "CMSG_GARRISON_REMOVE_FOLLOWER", "ClientToServer" },
+        { 0x3A01C7, "CMSG_GARRISON_REMOVE_FOLLOWER_FROM_BUILDING", "ClientToServer" },
+        { 0x3A01C8, "CMSG_GARRISON_RENAME_FOLLOWER", "ClientToServer" },
+        { 0x3A01AD, "CMSG_GARRISON_REQUEST_BLUEPRINT_AND_SPECIALIZATION_DATA", "ClientToServer" },
+        { 0x3A01E3, "CMSG_GARRISON_REQUEST_SHIPMENT_INFO", "ClientToServer" },
+        { 0x3A01CC, "CMSG_GARRISON_RESEARCH_TALENT", "ClientToServer" },
+        { 0x3A01AF, "CMSG_GARRISON_SET_BUILDING_ACTIVE", "ClientToServer" },
+        { 0x3A01C4, "CMSG_GARRISON_SET_FOLLOWER_FAVORITE", "ClientToServer" },
+        { 0x3A01BB, "CMSG_GARRISON_SET_FOLLOWER_INACTIVE", "ClientToServer" },
+        { 0x3A01CA, "CMSG_GARRISON_SET_RECRUITMENT_PREFERENCES", "ClientToServer" },
+        { 0x3A02A7, "CMSG_GARRISON_SOCKET_TALENT", "ClientToServer" },
+        { 0x3A0208, "CMSG_GARRISON_START_MISSION", "ClientToServer" },
+        { 0x3A01B3, "CMSG_GARRISON_SWAP_BUILDINGS", "ClientToServer" },
+        { 0x400013, "CMSG_GENERATE_RANDOM_CHARACTER_NAME", "ClientToServer" },
+        { 0x4000E4, "CMSG_GET_ACCOUNT_CHARACTER_LIST", "ClientToServer" },
+        { 0x400162, "CMSG_GET_ACCOUNT_NOTIFICATIONS", "ClientToServer" },
+        { 0x290034, "CMSG_GET_ALL_LICENSED_DECOR_QUANTITIES", "ClientToServer" },
+        { 0x380002, "CMSG_GET_AVAILABLE_INITIATIVE_REQUEST", "ClientToServer" },
+        { 0x29001F, "CMSG_GET_CHARACTER_CURRENCY_TRANSFER_LOG", "ClientToServer" },
+        { 0x400140, "CMSG_GET_CLIENT_CHECKOUT_LICENSES", "ClientToServer" },
+        { 0x290031, "CMSG_GET_DECOR_REFUND_LIST", "ClientToServer" },
+        { 0x3A01A8, "CMSG_GET_GARRISON_INFO", "ClientToServer" },
+        { 0x380004, "CMSG_GET_INITIATIVE_ACTIVITY_LOG_REQUEST", "ClientToServer" },
+        { 0x3B00CE, "CMSG_GET_ITEM_PURCHASE_DATA", "ClientToServer" },
+        { 0x3A01E4, "CMSG_GET_LANDING_PAGE_SHIPMENTS", "ClientToServer" },
+        { 0x290036, "CMSG_GET_LAST_CATALOG_FETCH", "ClientToServer" },
+        { 0x3A0176, "CMSG_GET_MIRROR_IMAGE_DATA", "ClientToServer" },
+        { 0x40001A, "CMSG_GET_PVP_OPTIONS_ENABLED", "ClientToServer" },
+        { 0x400150, "CMSG_GET_RAF_ACCOUNT_INFO", "ClientToServer" },
+        { 0x400193, "CMSG_GET_REGIONWIDE_CHARACTER_RESTRICTION_AND_MAIL_DATA", "ClientToServer" },
+        { 0x40011B, "CMSG_GET_REMAINING_GAME_TIME", "ClientToServer" },
+        { 0x3A01F9, "CMSG_GET_TROPHY_LIST", "ClientToServer" },
+        { 0x40010F, "CMSG_GET_UNDELETE_CHARACTER_COOLDOWN_STATUS", "ClientToServer" },
+        { 0x400120, "CMSG_GET_VAS_ACCOUNT_CHARACTER_LIST", "ClientToServer" },
+        { 0x400121, "CMSG_GET_VAS_TRANSFER_TARGET_REALM_LIST", "ClientToServer" },
+        { 0x4000BD, "CMSG_GM_TICKET_ACKNOWLEDGE_SURVEY", "ClientToServer" },
+        { 0x4000BC, "CMSG_GM_TICKET_GET_CASE_STATUS", "ClientToServer" },
+        { 0x4000BB, "CMSG_GM_TICKET_GET_SYSTEM_STATUS", "ClientToServer" },
+        { 0x3B010F, "CMSG_GOSSIP_REFRESH_OPTIONS", "ClientToServer" },
+        { 0x3B0026, "CMSG_GOSSIP_SELECT_OPTION", "ClientToServer" },
+        { 0x2D0020, "CMSG_GUILD_ADD_BATTLENET_FRIEND", "ClientToServer" },
+        { 0x2D0005, "CMSG_GUILD_ADD_RANK", "ClientToServer" },
+        { 0x2D0002, "CMSG_GUILD_ASSIGN_MEMBER_RANK", "ClientToServer" },
+        { 0x3B0047, "CMSG_GUILD_BANK_ACTIVATE", "ClientToServer" },
+        { 0x3B0055, "CMSG_GUILD_BANK_BUY_TAB", "ClientToServer" },
+        { 0x3B0057, "CMSG_GUILD_BANK_DEPOSIT_MONEY", "ClientToServer" },
+        { 0x2D0019, "CMSG_GUILD_BANK_LOG_QUERY", "ClientToServer" },
+        { 0x3B0054, "CMSG_GUILD_BANK_QUERY_TAB", "ClientToServer" },
+        { 0x2D001A, "CMSG_GUILD_BANK_REMAINING_WITHDRAW_MONEY_QUERY", "ClientToServer" },
+        { 0x2D001D, "CMSG_GUILD_BANK_SET_TAB_TEXT", "ClientToServer" },
+        { 0x2D001E, "CMSG_GUILD_BANK_TEXT_QUERY", "ClientToServer" },
+        { 0x3B0056, "CMSG_GUILD_BANK_UPDATE_TAB", "ClientToServer" },
+        { 0x3B0058, "CMSG_GUILD_BANK_WITHDRAW_MONEY", "ClientToServer" },
+        { 0x2D0017, "CMSG_GUILD_CHALLENGE_UPDATE_REQUEST", "ClientToServer" },
+        { 0x2D0018, "CMSG_GUILD_CHANGE_NAME_REQUEST", "ClientToServer" },
+        { 0x40002A, "CMSG_GUILD_DECLINE_INVITATION", "ClientToServer" },
+        { 0x2D0009, "CMSG_GUILD_DELETE", "ClientToServer" },
+        { 0x2D0006, "CMSG_GUILD_DELETE_RANK", "ClientToServer" },
+        { 0x2D0001, "CMSG_GUILD_DEMOTE_MEMBER", "ClientToServer" },
+        { 0x2D001C, "CMSG_GUILD_EVENT_LOG_QUERY", "ClientToServer" },
+        { 0x2D0012, "CMSG_GUILD_GET_ACHIEVEMENT_MEMBERS", "ClientToServer" },
+        { 0x2D0026, "CMSG_GUILD_GET_OTHERS_OWNED_HOUSES", "ClientToServer" },
+        { 0x2D000E, "CMSG_GUILD_GET_RANKS", "ClientToServer" },
+        { 0x2D0014, "CMSG_GUILD_GET_ROSTER", "ClientToServer" },
+        { 0x400034, "CMSG_GUILD_INVITE_BY_NAME", "ClientToServer" },
+        { 0x2D0003, "CMSG_GUILD_LEAVE", "ClientToServer" },
+        { 0x2D000F, "CMSG_GUILD_NEWS_UPDATE_STICKY", "ClientToServer" },
+        { 0x2D0004, "CMSG_GUILD_OFFICER_REMOVE_MEMBER", "ClientToServer" },
+        { 0x2D001B, "CMSG_GUILD_PERMISSIONS_QUERY", "ClientToServer" },
+        { 0x2D0000, "CMSG_GUILD_PROMOTE_MEMBER", "ClientToServer" },
+        { 0x2D000A, "CMSG_GUILD_QUERY_MEMBER_RECIPES", "ClientToServer" },
+        { 0x2D000C, "CMSG_GUILD_QUERY_MEMBERS_FOR_RECIPE", "ClientToServer" },
+        { 0x2D000D, "CMSG_GUILD_QUERY_NEWS", "ClientToServer" },
+        { 0x2D000B, "CMSG_GUILD_QUERY_RECIPES", "ClientToServer" },
+        { 0x2D001F, "CMSG_GUILD_REPLACE_GUILD_MASTER", "ClientToServer" },
+        { 0x2D0023, "CMSG_GUILD_REQUEST_RENAME", "ClientToServer" },
+        { 0x2D0022, "CMSG_GUILD_REQUEST_RENAME_NAME_CHECK", "ClientToServer" },
+        { 0x2D0024, "CMSG_GUILD_REQUEST_RENAME_REFUND", "ClientToServer" },
+        { 0x2D0021, "CMSG_GUILD_REQUEST_RENAME_STATUS", "ClientToServer" },
+        { 0x2D0010, "CMSG_GUILD_SET_ACHIEVEMENT_TRACKING", "ClientToServer" },
+        { 0x2D0011, "CMSG_GUILD_SET_FOCUSED_ACHIEVEMENT", "ClientToServer" },
+        { 0x4000F7, "CMSG_GUILD_SET_GUILD_MASTER", "ClientToServer" },
+        { 0x2D0013, "CMSG_GUILD_SET_MEMBER_NOTE", "ClientToServer" },
+        { 0x2D0008, "CMSG_GUILD_SET_RANK_PERMISSIONS", "ClientToServer" },
+        { 0x2D0007, "CMSG_GUILD_SHIFT_RANK", "ClientToServer" },
+        { 0x2D0016, "CMSG_GUILD_UPDATE_INFO_TEXT", "ClientToServer" },
+        { 0x2D0015, "CMSG_GUILD_UPDATE_MOTD_TEXT", "ClientToServer" },
+        { 0x3B009F, "CMSG_HEARTH_AND_RESURRECT", "ClientToServer" },
+        { 0x3A0186, "CMSG_HIDE_QUEST_CHOICE", "ClientToServer" },
+        { 0x400011, "CMSG_HOTFIX_REQUEST", "ClientToServer" },
+        { 0x2E0000, "CMSG_HOUSE_EXTERIOR_LOCK", "ClientToServer" },
+        { 0x2E0001, "CMSG_HOUSE_EXTERIOR_SET_HOUSE_POSITION", "ClientToServer" },
+        { 0x2F0001, "CMSG_HOUSE_INTERIOR_LEAVE_HOUSE", "ClientToServer" },
+        { 0x300009, "CMSG_HOUSING_DECOR_DELETE_FROM_STORAGE", "ClientToServer" },
+        { 0x30000A, "CMSG_HOUSING_DECOR_DELETE_FROM_STORAGE_BY_ID", "ClientToServer" },
+        { 0x300004, "CMSG_HOUSING_DECOR_LOCK", "ClientToServer" },
+        { 0x300002, "CMSG_HOUSING_DECOR_MOVE", "ClientToServer" },
+        { 0x300001, "CMSG_HOUSING_DECOR_PLACE", "ClientToServer" },
+        { 0x300010, "CMSG_HOUSING_DECOR_REDEEM_DEFERRED_DECOR", "ClientToServer" },
+        { 0x300003, "CMSG_HOUSING_DECOR_REMOVE", "ClientToServer" },
+        { 0x30000E, "CMSG_HOUSING_DECOR_REQUEST_STORAGE", "ClientToServer" },
+        { 0x300006, "CMSG_HOUSING_DECOR_SET_DYE_SLOTS", "ClientToServer" },
+        { 0x300000, "CMSG_HOUSING_DECOR_SET_EDIT_MODE", "ClientToServer" },
+        { 0x310006, "CMSG_HOUSING_FIXTURE_CREATE_FIXTURE", "ClientToServer" },
+        { 0x310007, "CMSG_HOUSING_FIXTURE_DELETE_FIXTURE", "ClientToServer" },
+        { 0x310005, "CMSG_HOUSING_FIXTURE_SET_CORE_FIXTURE", "ClientToServer" },
+        { 0x310000, "CMSG_HOUSING_FIXTURE_SET_EDIT_MODE", "ClientToServer" },
+        { 0x310003, "CMSG_HOUSING_FIXTURE_SET_HOUSE_SIZE", "ClientToServer" },
+        { 0x310004, "CMSG_HOUSING_FIXTURE_SET_HOUSE_TYPE", "ClientToServer" },
+        { 0x350006, "CMSG_HOUSING_GET_CURRENT_HOUSE_INFO", "ClientToServer" },
+        { 0x350007, "CMSG_HOUSING_GET_PLAYER_PERMISSIONS", "ClientToServer" },
+        { 0x350005, "CMSG_HOUSING_HOUSE_STATUS", "ClientToServer" },
+        { 0x350008, "CMSG_HOUSING_RESET_KIOSK_MODE", "ClientToServer" },
+        { 0x320001, "CMSG_HOUSING_ROOM_ADD", "ClientToServer" },
+        { 0x320006, "CMSG_HOUSING_ROOM_APPLY_COMPONENT_MATERIALS", "ClientToServer" },
+        { 0x320004, "CMSG_HOUSING_ROOM_MOVE", "ClientToServer" },
+        { 0x320002, "CMSG_HOUSING_ROOM_REMOVE", "ClientToServer" },
+        { 0x320003, "CMSG_HOUSING_ROOM_ROTATE", "ClientToServer" },
+        { 0x320008, "CMSG_HOUSING_ROOM_SET_CEILING_TYPE", "ClientToServer" },
+        { 0x320005, "CMSG_HOUSING_ROOM_SET_COMPONENT_THEME", "ClientToServer" },
+        { 0x320007, "CMSG_HOUSING_ROOM_SET_DOOR_TYPE", "ClientToServer" },
+        { 0x320000, "CMSG_HOUSING_ROOM_SET_LAYOUT_EDIT_MODE", "ClientToServer" },
+        { 0x33001C, "CMSG_HOUSING_SVCS_ACCEPT_NEIGHBORHOOD_OWNERSHIP", "ClientToServer" },
+        { 0x330023, "CMSG_HOUSING_SVCS_DELETE_ALL_NEIGHBORHOOD_INVITES", "ClientToServer" },
+        { 0x330021, "CMSG_HOUSING_SVCS_GET_BNET_FRIEND_NEIGHBORHOODS", "ClientToServer" },
+        { 0x33001F, "CMSG_HOUSING_SVCS_GET_HOUSE_FINDER_INFO", "ClientToServer" },
+        { 0x330020, "CMSG_HOUSING_SVCS_GET_HOUSE_FINDER_NEIGHBORHOOD", "ClientToServer" },
+        { 0x330011, "CMSG_HOUSING_SVCS_GET_PLAYER_HOUSES_INFO", "ClientToServer" },
+        { 0x33001E, "CMSG_HOUSING_SVCS_GET_POTENTIAL_HOUSE_OWNERS", "ClientToServer" },
+        { 0x330001, "CMSG_HOUSING_SVCS_GUILD_CREATE_NEIGHBORHOOD", "ClientToServer" },
+        { 0x330006, "CMSG_HOUSING_SVCS_NEIGHBORHOOD_RESERVE_PLOT", "ClientToServer" },
+        { 0x33000F, "CMSG_HOUSING_SVCS_PLAYER_VIEW_HOUSES_BY_BNET_ACCOUNT", "ClientToServer" },
+        { 0x33000E, "CMSG_HOUSING_SVCS_PLAYER_VIEW_HOUSES_BY_PLAYER", "ClientToServer" },
+        { 0x33001D, "CMSG_HOUSING_SVCS_REJECT_NEIGHBORHOOD_OWNERSHIP", "ClientToServer" },
+        { 0x330009, "CMSG_HOUSING_SVCS_RELINQUISH_HOUSE", "ClientToServer" },
+        { 0x330018, "CMSG_HOUSING_SVCS_START_TUTORIAL", "ClientToServer" },
+        { 0x330017, "CMSG_HOUSING_SVCS_TELEPORT_TO_PLOT", "ClientToServer" },
+        { 0x33000A, "CMSG_HOUSING_SVCS_UPDATE_HOUSE_SETTINGS", "ClientToServer" },
+        { 0x3A0003, "CMSG_IGNORE_TRADE", "ClientToServer" },
+        { 0x400006, "CMSG_INITIATE_ROLE_POLL", "ClientToServer" },
+        { 0x3A0000, "CMSG_INITIATE_TRADE", "ClientToServer" },
+        { 0x3C0000, "CMSG_INITIATIVE_UPDATE_ACTIVE_NEIGHBORHOOD", "ClientToServer" },
+        { 0x3B00C8, "CMSG_INSPECT", "ClientToServer" },
+        { 0x400061, "CMSG_INSTANCE_ABANDON_VOTE_RESPONSE", "ClientToServer" },
+        { 0x3B00A4, "CMSG_INSTANCE_LOCK_RESPONSE", "ClientToServer" },
+        { 0x40019B, "CMSG_INVITE_PLAYER_TO_NEIGHBORHOOD", "ClientToServer" },
+        { 0x3A026B, "CMSG_ISLAND_QUEUE", "ClientToServer" },
+        { 0x3B00CF, "CMSG_ITEM_PURCHASE_REFUND", "ClientToServer" },
+        { 0x3A0218, "CMSG_ITEM_TEXT_QUERY", "ClientToServer" },
+        { 0x3A0094, "CMSG_JOIN_PET_BATTLE_QUEUE", "ClientToServer" },
+        { 0x3A0025, "CMSG_JOIN_RATED_BATTLEGROUND", "ClientToServer" },
+        { 0x4000AB, "CMSG_KEEP_ALIVE", "ClientToServer" },
+        { 0x3A00E9, "CMSG_KEYBOUND_OVERRIDE", "ClientToServer" },
+        { 0x3A009E, "CMSG_KIOSK_ENABLE_GOD_MODE", "ClientToServer" },
+        { 0x41000F, "CMSG_LATENCY_REPORT", "ClientToServer" },
+        { 0x3B00FB, "CMSG_LEARN_PVP_TALENTS", "ClientToServer" },
+        { 0x3B00F9, "CMSG_LEARN_TALENTS", "ClientToServer" },
+        { 0x400075, "CMSG_LEAVE_GROUP", "ClientToServer" },
+        { 0x3A0095, "CMSG_LEAVE_PET_BATTLE_QUEUE", "ClientToServer" },
+        { 0x40003B, "CMSG_LFG_LIST_APPLY_TO_GROUP", "ClientToServer" },
+        { 0x40003C, "CMSG_LFG_LIST_CANCEL_APPLICATION", "ClientToServer" },
+        { 0x40003D, "CMSG_LFG_LIST_DECLINE_APPLICANT", "ClientToServer" },
+        { 0x400039, "CMSG_LFG_LIST_GET_STATUS", "ClientToServer" },
+        { 0x40003E, "CMSG_LFG_LIST_INVITE_APPLICANT", "ClientToServer" },
+        { 0x40003F, "CMSG_LFG_LIST_INVITE_RESPONSE", "ClientToServer" },
+        { 0x3A025F, "CMSG_LFG_LIST_JOIN", "ClientToServer" },
+        { 0x400038, "CMSG_LFG_LIST_LEAVE", "ClientToServer" },
+        { 0x40003A, "CMSG_LFG_LIST_SEARCH", "ClientToServer" },
+        { 0x3A0260, "CMSG_LFG_LIST_UPDATE_REQUEST", "ClientToServer" },
+        { 0x3A0261, "CMSG_LFG_LOREWALKING_UPDATE_REQUEST", "ClientToServer" },
+        { 0x3B0033, "CMSG_LIST_INVENTORY", "ClientToServer" },
+        { 0x4000E7, "CMSG_LIVE_REGION_ACCOUNT_RESTORE", "ClientToServer" },
+        { 0x4000E6, "CMSG_LIVE_REGION_CHARACTER_COPY", "ClientToServer" },
+        { 0x4000E5, "CMSG_LIVE_REGION_GET_ACCOUNT_CHARACTER_LIST", "ClientToServer" },
+        { 0x4000E8, "CMSG_LIVE_REGION_KEY_BINDINGS_COPY", "ClientToServer" },
+        { 0x400024, "CMSG_LOADING_SCREEN_NOTIFY", "ClientToServer" },
+        { 0x3A01FA, "CMSG_LOAD_SELECTED_TROPHY", "ClientToServer" },
+        { 0x400175, "CMSG_LOBBY_MATCHMAKER_ABANDON_QUEUE", "ClientToServer" },
+        { 0x40016C, "CMSG_LOBBY_MATCHMAKER_ACCEPT_PARTY_INVITE", "ClientToServer" },
+        { 0x40017E, "CMSG_LOBBY_MATCHMAKER_CREATE_CHARACTER", "ClientToServer" },
+        { 0x400173, "CMSG_LOBBY_MATCHMAKER_ENTER_QUEUE", "ClientToServer" },
+        { 0x40016F, "CMSG_LOBBY_MATCHMAKER_LEAVE_PARTY", "ClientToServer" },
+        { 0x40016B, "CMSG_LOBBY_MATCHMAKER_PARTY_INVITE", "ClientToServer" },
+        { 0x40016E, "CMSG_LOBBY_MATCHMAKER_PARTY_UNINVITE", "ClientToServer" },
+        { 0x400174, "CMSG_LOBBY_MATCHMAKER_QUEUE_PROPSAL_RESPONSE", "ClientToServer" },
+        { 0x40016D, "CMSG_LOBBY_MATCHMAKER_REJECT_PARTY_INVITE", "ClientToServer" },
+        { 0x400170, "CMSG_LOBBY_MATCHMAKER_SET_PARTY_PLAYLIST_ENTRY", "ClientToServer" },
+        { 0x400171, "CMSG_LOBBY_MATCHMAKER_SET_PLAYER_READY", "ClientToServer" },
+        { 0x410007, "CMSG_LOG_DISCONNECT", "ClientToServer" },
+        { 0x3B0070, "CMSG_LOGOUT_CANCEL", "ClientToServer" },
+        { 0x3B0071, "CMSG_LOGOUT_INSTANT", "ClientToServer" },
+        { 0x3B0123, "CMSG_LOGOUT_LOBBY_MATCHMAKER", "ClientToServer" },
+        { 0x3B006F, "CMSG_LOGOUT_REQUEST", "ClientToServer" },
+        { 0x41000B, "CMSG_LOG_STREAMING_ERROR", "ClientToServer" },
+        { 0x3A00D1, "CMSG_LOOT_ITEM", "ClientToServer" },
+        { 0x3A00D0, "CMSG_LOOT_MONEY", "ClientToServer" },
+        { 0x3A00D5, "CMSG_LOOT_RELEASE", "ClientToServer" },
+        { 0x3A00D6, "CMSG_LOOT_ROLL", "ClientToServer" },
+        { 0x3A00CF, "CMSG_LOOT_UNIT", "ClientToServer" },
+        { 0x4000CF, "CMSG_LOW_LEVEL_RAID1", "ClientToServer" },
+        { 0x3B00AB, "CMSG_LOW_LEVEL_RAID2", "ClientToServer" },
+        { 0x3B00DA, "CMSG_MAIL_CREATE_TEXT_ITEM", "ClientToServer" },
+        { 0x3A00EB, "CMSG_MAIL_DELETE", "ClientToServer" },
+        { 0x3B00D5, "CMSG_MAIL_GET_LIST", "ClientToServer" },
+        { 0x3B00D9, "CMSG_MAIL_MARK_AS_READ", "ClientToServer" },
+        { 0x400081, "CMSG_MAIL_RETURN_TO_SENDER", "ClientToServer" },
+        { 0x3B00D7, "CMSG_MAIL_TAKE_ITEM", "ClientToServer" },
+        { 0x3B00D6, "CMSG_MAIL_TAKE_MONEY", "ClientToServer" },
+        { 0x3A00EC, "CMSG_MAKE_CONTITIONAL_APPEARANCE_PERMANENT", "ClientToServer" },
+        { 0x3A00D2, "CMSG_MASTER_LOOT_ITEM", "ClientToServer" },
+        { 0x3B0052, "CMSG_MERGE_GUILD_BANK_ITEM_WITH_GUILD_BANK_ITEM", "ClientToServer" },
+        { 0x3B004F, "CMSG_MERGE_GUILD_BANK_ITEM_WITH_ITEM", "ClientToServer" },
+        { 0x3B004D, "CMSG_MERGE_ITEM_WITH_GUILD_BANK_ITEM", "ClientToServer" },
+        { 0x410011, "CMSG_MESSAGE_WHISPER", "ClientToServer" },
+        { 0x400077, "CMSG_MINIMAP_PING", "ClientToServer" },
+        { 0x3A0036, "CMSG_MISSILE_TRAJECTORY_COLLISION", "ClientToServer" },
+        { 0x290003, "CMSG_MOUNT_CLEAR_FANFARE", "ClientToServer" },
+        { 0x40005C, "CMSG_MOUNT_SET_FAVORITE", "ClientToServer" },
+        { 0x3A015C, "CMSG_MOUNT_SPECIAL_ANIM", "ClientToServer" },
+        { 0x3E006F, "CMSG_MOVE_ADD_IMPULSE_ACK", "ClientToServer" },
+        { 0x3E006D, "CMSG_MOVE_APPLY_INERTIA_ACK", "ClientToServer" },
+        { 0x3E0033, "CMSG_MOVE_APPLY_MOVEMENT_FORCE_ACK", "ClientToServer" },
+        { 0x3E004E, "CMSG_MOVE_CHANGE_TRANSPORT", "ClientToServer" },
+        { 0x3E0053, "CMSG_MOVE_CHANGE_VEHICLE_SEATS", "ClientToServer" },
+        { 0x3E0058, "CMSG_MOVE_COLLISION_DISABLE_ACK", "ClientToServer" },
+        { 0x3E0059, "CMSG_MOVE_COLLISION_ENABLE_ACK", "ClientToServer" },
+        { 0x3E0052, "CMSG_MOVE_DISMISS_VEHICLE", "ClientToServer" },
+        { 0x3E0007, "CMSG_MOVE_DOUBLE_JUMP", "ClientToServer" },
+        { 0x3E003C, "CMSG_MOVE_ENABLE_DOUBLE_JUMP_ACK", "ClientToServer" },
+        { 0x3E0085, "CMSG_MOVE_ENABLE_FULL_SPEED_TURNING_ACK", "ClientToServer" },
+        { 0x3E0042, "CMSG_MOVE_ENABLE_SWIM_TO_FLY_TRANS_ACK", "ClientToServer" },
+        { 0x3E0017, "CMSG_MOVE_FALL_LAND", "ClientToServer" },
+        { 0x3E0037, "CMSG_MOVE_FALL_RESET", "ClientToServer" },
+        { 0x3E003A, "CMSG_MOVE_FEATHER_FALL_ACK", "ClientToServer" },
+        { 0x3E004D, "CMSG_MOVE_FORCE_FLIGHT_BACK_SPEED_CHANGE_ACK", "ClientToServer" },
+        { 0x3E004C, "CMSG_MOVE_FORCE_FLIGHT_SPEED_CHANGE_ACK", "ClientToServer" },
+        { 0x3E0022, "CMSG_MOVE_FORCE_GRAVITY_MODIFIER_CHANGE_ACK", "ClientToServer" },
+        { 0x3E0051, "CMSG_MOVE_FORCE_PITCH_RATE_CHANGE_ACK", "ClientToServer" },
+        { 0x3E002C, "CMSG_MOVE_FORCE_ROOT_ACK", "ClientToServer" },
+        { 0x3E002A, "CMSG_MOVE_FORCE_RUN_BACK_SPEED_CHANGE_ACK", "ClientToServer" },
+        { 0x3E0029, "CMSG_MOVE_FORCE_RUN_SPEED_CHANGE_ACK", "ClientToServer" },
+        { 0x3E0040, "CMSG_MOVE_FORCE_SWIM_BACK_SPEED_CHANGE_ACK", "ClientToServer" },
+        { 0x3E002B, "CMSG_MOVE_FORCE_SWIM_SPEED_CHANGE_ACK", "ClientToServer" },
+        { 0x3E0041, "CMSG_MOVE_FORCE_TURN_RATE_CHANGE_ACK", "ClientToServer" },
+        { 0x3E002D, "CMSG_MOVE_FORCE_UNROOT_ACK", "ClientToServer" },
+        { 0x3E003F, "CMSG_MOVE_FORCE_WALK_SPEED_CHANGE_ACK", "ClientToServer" },
+        { 0x3E0054, "CMSG_MOVE_GRAVITY_DISABLE_ACK", "ClientToServer" },
+        { 0x3E0055, "CMSG_MOVE_GRAVITY_ENABLE_ACK", "ClientToServer" },
+        { 0x3B004C, "CMSG_MOVE_GUILD_BANK_ITEM", "ClientToServer" },
+        { 0x3E002E, "CMSG_MOVE_HEARTBEAT", "ClientToServer" },
+        { 0x3E0031, "CMSG_MOVE_HOVER_ACK", "ClientToServer" },
+        { 0x3E0056, "CMSG_MOVE_INERTIA_DISABLE_ACK", "ClientToServer" },
+        { 0x3E0057, "CMSG_MOVE_INERTIA_ENABLE_ACK", "ClientToServer" },
+        { 0x3E0065, "CMSG_MOVE_INIT_ACTIVE_MOVER_COMPLETE", "ClientToServer" },
+        { 0x3E0084, "CMSG_MOVE_INITIAL_OBJECT_UPDATE_COMPLETE_ACK", "ClientToServer" },
+        { 0x3E0006, "CMSG_MOVE_JUMP", "ClientToServer" },
+        { 0x3E0030, "CMSG_MOVE_KNOCK_BACK_ACK", "ClientToServer" },
+        { 0x3E006E, "CMSG_MOVE_REMOVE_INERTIA_ACK", "ClientToServer" },
+        { 0x3E0034, "CMSG_MOVE_REMOVE_MOVEMENT_FORCE_ACK", "ClientToServer" },
+        { 0x3E0035, "CMSG_MOVE_REMOVE_MOVEMENT_FORCES", "ClientToServer" },
+        { 0x3E0071, "CMSG_MOVE_SET_ADV_FLY", "ClientToServer" },
+        { 0x3E0079, "CMSG_MOVE_SET_ADV_FLYING_ADD_IMPULSE_MAX_SPEED_ACK", "ClientToServer" },
+        { 0x3E0074, "CMSG_MOVE_SET_ADV_FLYING_AIR_FRICTION_ACK", "ClientToServer" },
+        { 0x3E007A, "CMSG_MOVE_SET_ADV_FLYING_BANKING_RATE_ACK", "ClientToServer" },
+        { 0x3E0077, "CMSG_MOVE_SET_ADV_FLYING_DOUBLE_JUMP_VEL_MOD_ACK", "ClientToServer" },
+        { 0x3E0078, "CMSG_MOVE_SET_ADV_FLYING_GLIDE_START_MIN_HEIGHT_ACK", "ClientToServer" },
+        { 0x3E0081, "CMSG_MOVE_SET_ADV_FLYING_LAUNCH_SPEED_COEFFICIENT_ACK", "ClientToServer" },
+        { 0x3E0076, "CMSG_MOVE_SET_ADV_FLYING_LIFT_COEFFICIENT_ACK", "ClientToServer" },
+        { 0x3E0075, "CMSG_MOVE_SET_ADV_FLYING_MAX_VEL_ACK", "ClientToServer" },
+        { 0x3E007F, "CMSG_MOVE_SET_ADV_FLYING_OVER_MAX_DECELERATION_ACK", "ClientToServer" },
+        { 0x3E007B, "CMSG_MOVE_SET_ADV_FLYING_PITCHING_RATE_DOWN_ACK", "ClientToServer" },
+        { 0x3E007C, "CMSG_MOVE_SET_ADV_FLYING_PITCHING_RATE_UP_ACK", "ClientToServer" },
+        { 0x3E007E, "CMSG_MOVE_SET_ADV_FLYING_SURFACE_FRICTION_ACK", "ClientToServer" },
+        { 0x3E007D, "CMSG_MOVE_SET_ADV_FLYING_TURN_VELOCITY_THRESHOLD_ACK", "ClientToServer" },
+        { 0x3E0070, "CMSG_MOVE_SET_CAN_ADV_FLY_ACK", "ClientToServer" },
+        { 0x3E0072, "CMSG_MOVE_SET_CAN_DRIVE_ACK", "ClientToServer" },
+        { 0x3E0045, "CMSG_MOVE_SET_CAN_FLY_ACK", "ClientToServer" },
+        { 0x3E0046, "CMSG_MOVE_SET_CANNOT_SWIM_ACK", "ClientToServer" },
+        { 0x3E0043, "CMSG_MOVE_SET_CAN_TURN_WHILE_FALLING_ACK", "ClientToServer" },
+        { 0x3E005A, "CMSG_MOVE_SET_COLLISION_HEIGHT_ACK", "ClientToServer" },
+        { 0x3E0027, "CMSG_MOVE_SET_FACING", "ClientToServer" },
+        { 0x3E0080, "CMSG_MOVE_SET_FACING_HEARTBEAT", "ClientToServer" },
+        { 0x3E0047, "CMSG_MOVE_SET_FLY", "ClientToServer" },
+        { 0x3E0044, "CMSG_MOVE_SET_IGNORE_MOVEMENT_FORCES_ACK", "ClientToServer" },
+        { 0x3E0061, "CMSG_MOVE_SET_MOD_MOVEMENT_FORCE_MAGNITUDE_ACK", "ClientToServer" },
+        { 0x3E0028, "CMSG_MOVE_SET_PITCH", "ClientToServer" },
+        { 0x3E000E, "CMSG_MOVE_SET_RUN_MODE", "ClientToServer" },
+        { 0x3E0024, "CMSG_MOVE_SET_TURN_RATE_CHEAT", "ClientToServer" },
+        { 0x3E0032, "CMSG_MOVE_SET_VEHICLE_REC_ID_ACK", "ClientToServer" },
+        { 0x3E000F, "CMSG_MOVE_SET_WALK_MODE", "ClientToServer" },
+        { 0x3E0036, "CMSG_MOVE_SPLINE_DONE", "ClientToServer" },
+        { 0x3E0048, "CMSG_MOVE_START_ASCEND", "ClientToServer" },
+        { 0x3E0001, "CMSG_MOVE_START_BACKWARD", "ClientToServer" },
+        { 0x3E004F, "CMSG_MOVE_START_DESCEND", "ClientToServer" },
+        { 0x3E0073, "CMSG_MOVE_START_DRIVE_FORWARD", "ClientToServer" },
+        { 0x3E0000, "CMSG_MOVE_START_FORWARD", "ClientToServer" },
+        { 0x3E000C, "CMSG_MOVE_START_PITCH_DOWN", "ClientToServer" },
+        { 0x3E000B, "CMSG_MOVE_START_PITCH_UP", "ClientToServer" },
+        { 0x3E0003, "CMSG_MOVE_START_STRAFE_LEFT", "ClientToServer" },
+        { 0x3E0004, "CMSG_MOVE_START_STRAFE_RIGHT", "ClientToServer" },
+        { 0x3E0018, "CMSG_MOVE_START_SWIM", "ClientToServer" },
+        { 0x3E0008, "CMSG_MOVE_START_TURN_LEFT", "ClientToServer" },
+        { 0x3E0009, "CMSG_MOVE_START_TURN_RIGHT", "ClientToServer" },
+        { 0x3E0002, "CMSG_MOVE_STOP", "ClientToServer" },
+        { 0x3E0049, "CMSG_MOVE_STOP_ASCEND", "ClientToServer" },
+        { 0x3E000D, "CMSG_MOVE_STOP_PITCH", "ClientToServer" },
+        { 0x3E0005, "CMSG_MOVE_STOP_STRAFE", "ClientToServer" },
+        { 0x3E0019, "CMSG_MOVE_STOP_SWIM", "ClientToServer" },
+        { 0x3E000A, "CMSG_MOVE_STOP_TURN", "ClientToServer" },
+        { 0x3E0016, "CMSG_MOVE_TELEPORT_ACK", "ClientToServer" },
+        { 0x3E0039, "CMSG_MOVE_TIME_SKIPPED", "ClientToServer" },
+        { 0x3E0038, "CMSG_MOVE_UPDATE_FALL_SPEED", "ClientToServer" },
+        { 0x3E003B, "CMSG_MOVE_WATER_WALK_ACK", "ClientToServer" },
+        { 0x2C0001, "CMSG_MYTHIC_PLUS_REQUEST_MAP_STATS", "ClientToServer" },
+        { 0x390002, "CMSG_NEIGHBORHOOD_ADD_SECONDARY_OWNER", "ClientToServer" },
+        { 0x390009, "CMSG_NEIGHBORHOOD_BUY_HOUSE", "ClientToServer" },
+        { 0x390005, "CMSG_NEIGHBORHOOD_CANCEL_INVITATION", "ClientToServer" },
+        { 0x370006, "CMSG_NEIGHBORHOOD_CHARTER_ADD_SIGNATURE", "ClientToServer" },
+        { 0x370001, "CMSG_NEIGHBORHOOD_CHARTER_CREATE", "ClientToServer" },
+        { 0x370003, "CMSG_NEIGHBORHOOD_CHARTER_EDIT", "ClientToServer" },
+        { 0x370004, "CMSG_NEIGHBORHOOD_CHARTER_FINALIZE", "ClientToServer" },
+        { 0x370000, "CMSG_NEIGHBORHOOD_CHARTER_OPEN_CONFIRMATION_UI", "ClientToServer" },
+        { 0x370007, "CMSG_NEIGHBORHOOD_CHARTER_SEND_SIGNATURE_REQUEST", "ClientToServer" },
+        { 0x39000F, "CMSG_NEIGHBORHOOD_EVICT_PLOT", "ClientToServer" },
+        { 0x390008, "CMSG_NEIGHBORHOOD_GET_INVITES", "ClientToServer" },
+        { 0x39000E, "CMSG_NEIGHBORHOOD_GET_ROSTER", "ClientToServer" },
+        { 0x380000, "CMSG_NEIGHBORHOOD_INITIATIVE_SERVICE_STATUS_CHECK", "ClientToServer" },
+        { 0x390004, "CMSG_NEIGHBORHOOD_INVITE_RESIDENT", "ClientToServer" },
+        { 0x39000A, "CMSG_NEIGHBORHOOD_MOVE_HOUSE", "ClientToServer" },
+        { 0x39000D, "CMSG_NEIGHBORHOOD_OFFER_OWNERSHIP", "ClientToServer" },
+        { 0x39000B, "CMSG_NEIGHBORHOOD_OPEN_CORNERSTONE_UI", "ClientToServer" },
+        { 0x390006, "CMSG_NEIGHBORHOOD_PLAYER_DECLINE_INVITE", "ClientToServer" },
+        { 0x390007, "CMSG_NEIGHBORHOOD_PLAYER_GET_INVITE", "ClientToServer" },
+        { 0x390003, "CMSG_NEIGHBORHOOD_REMOVE_SECONDARY_OWNER", "ClientToServer" },
+        { 0x390001, "CMSG_NEIGHBORHOOD_SET_PUBLIC_FLAG", "ClientToServer" },
+        { 0x390000, "CMSG_NEIGHBORHOOD_UPDATE_NAME", "ClientToServer" },
+        { 0x3A008A, "CMSG_NEUTRAL_PLAYER_SELECT_FACTION", "ClientToServer" },
+        { 0x3B00E3, "CMSG_NEXT_CINEMATIC_CAMERA", "ClientToServer" },
+        { 0x3B012D, "CMSG_NPC_CRAFTING_ORDER_REQUEST", "ClientToServer" },
+        { 0x3A002C, "CMSG_OBJECT_UPDATE_FAILED", "ClientToServer" },
+        { 0x3A002D, "CMSG_OBJECT_UPDATE_RESCUED", "ClientToServer" },
+        { 0x3A0291, "CMSG_OFFER_PETITION", "ClientToServer" },
+        { 0x3B00E2, "CMSG_OPENING_CINEMATIC", "ClientToServer" },
+        { 0x3A0219, "CMSG_OPEN_ITEM", "ClientToServer" },
+        { 0x3A01DA, "CMSG_OPEN_MISSION_NPC", "ClientToServer" },
+        { 0x3A01E2, "CMSG_OPEN_SHIPMENT_NPC", "ClientToServer" },
+        { 0x3A01ED, "CMSG_OPEN_TRADESKILL_NPC", "ClientToServer" },
+        { 0x3B008E, "CMSG_OPT_OUT_OF_LOOT", "ClientToServer" },
+        { 0x3B00B8, "CMSG_OVERRIDE_SCREEN_FLASH", "ClientToServer" },
+        { 0x400030, "CMSG_PARTY_INVITE", "ClientToServer" },
+        { 0x400032, "CMSG_PARTY_INVITE_RESPONSE", "ClientToServer" },
+        { 0x400073, "CMSG_PARTY_UNINVITE", "ClientToServer" },
+        { 0x3A00F4, "CMSG_PERFORM_ITEM_INTERACTION", "ClientToServer" },
+        { 0x290018, "CMSG_PERKS_PROGRAM_GET_RECENT_PURCHASES", "ClientToServer" },
+        { 0x3A02B9, "CMSG_PERKS_PROGRAM_ITEMS_REFRESHED", "ClientToServer" },
+        { 0x3A02BC, "CMSG_PERKS_PROGRAM_REQUEST_CART_CHECKOUT", "ClientToServer" },
+        { 0x290017, "CMSG_PERKS_PROGRAM_REQUEST_PENDING_REWARDS", "ClientToServer" },
+        { 0x3A02BB, "CMSG_PERKS_PROGRAM_REQUEST_PURCHASE", "ClientToServer" },
+        { 0x3A02BD, "CMSG_PERKS_PROGRAM_REQUEST_REFUND", "ClientToServer" },
+        { 0x3A02BE, "CMSG_PERKS_PROGRAM_SET_FROZEN_VENDOR_ITEM", "ClientToServer" },
+        { 0x3A02BA, "CMSG_PERKS_PROGRAM_STATUS_REQUEST", "ClientToServer" },
+        { 0x3B001E, "CMSG_PET_ABANDON", "ClientToServer" },
+        { 0x3B001F, "CMSG_PET_ABANDON_BY_NUMBER", "ClientToServer" },
+        { 0x3B001C, "CMSG_PET_ACTION", "ClientToServer" },
+        { 0x3A0099, "CMSG_PET_BATTLE_FINAL_NOTIFY", "ClientToServer" },
+        { 0x40006D, "CMSG_PET_BATTLE_INPUT", "ClientToServer" },
+        { 0x3A00EA, "CMSG_PET_BATTLE_QUEUE_PROPOSE_MATCH_RESULT", "ClientToServer" },
+        { 0x3A0098, "CMSG_PET_BATTLE_QUIT_NOTIFY", "ClientToServer" },
+        { 0x40006E, "CMSG_PET_BATTLE_REPLACE_FRONT_PET", "ClientToServer" },
+        { 0x3A0092, "CMSG_PET_BATTLE_REQUEST_PVP", "ClientToServer" },
+        { 0x3A0093, "CMSG_PET_BATTLE_REQUEST_UPDATE", "ClientToServer" },
+        { 0x3A0090, "CMSG_PET_BATTLE_REQUEST_WILD", "ClientToServer" },
+        { 0x3A009A, "CMSG_PET_BATTLE_SCRIPT_ERROR_NOTIFY", "ClientToServer" },
+        { 0x3B0020, "CMSG_PET_CANCEL_AURA", "ClientToServer" },
+        { 0x3A017B, "CMSG_PET_CAST_SPELL", "ClientToServer" },
+        { 0x3B005A, "CMSG_PETITION_BUY", "ClientToServer" },
+        { 0x4000F8, "CMSG_PETITION_RENAME_GUILD", "ClientToServer" },
+        { 0x3B0059, "CMSG_PETITION_SHOW_LIST", "ClientToServer" },
+        { 0x3B005B, "CMSG_PETITION_SHOW_SIGNATURES", "ClientToServer" },
+        { 0x4000B0, "CMSG_PET_RENAME", "ClientToServer" },
+        { 0x3B001B, "CMSG_PET_SET_ACTION", "ClientToServer" },
+        { 0x3B0021, "CMSG_PET_SPELL_AUTOCAST", "ClientToServer" },
+        { 0x3B001D, "CMSG_PET_STOP_ATTACK", "ClientToServer" },
+        { 0x410006, "CMSG_PING", "ClientToServer" },
+        { 0x400016, "CMSG_PLAYER_LOGIN", "ClientToServer" },
+        { 0x3B0031, "CMSG_PUSH_QUEST_TO_PARTY", "ClientToServer" },
+        { 0x3A0028, "CMSG_PVP_LOG_DATA", "ClientToServer" },
+        { 0x3A014F, "CMSG_QUERY_BATTLE_PET_NAME", "ClientToServer" },
+        { 0x40008C, "CMSG_QUERY_CORPSE_LOCATION_FROM_CLIENT", "ClientToServer" },
+        { 0x40008D, "CMSG_QUERY_CORPSE_TRANSPORT", "ClientToServer" },
+        { 0x3A005B, "CMSG_QUERY_COUNTDOWN_TIMER", "ClientToServer" },
+        { 0x3A0149, "CMSG_QUERY_CREATURE", "ClientToServer" },
+        { 0x3A014A, "CMSG_QUERY_GAME_OBJECT", "ClientToServer" },
+        { 0x3A0150, "CMSG_QUERY_GARRISON_PET_NAME", "ClientToServer" },
+        { 0x4000B6, "CMSG_QUERY_GUILD_INFO", "ClientToServer" },
+        { 0x3B0098, "CMSG_QUERY_INSPECT_ACHIEVEMENTS", "ClientToServer" },
+        { 0x4000B7, "CMSG_QUERY_NEIGHBORHOOD_INFO", "ClientToServer" },
+        { 0x3B00D8, "CMSG_QUERY_NEXT_MAIL_TIME", "ClientToServer" },
+        { 0x3A014B, "CMSG_QUERY_NPC_TEXT", "ClientToServer" },
+        { 0x3A014D, "CMSG_QUERY_PAGE_TEXT", "ClientToServer" },
+        { 0x3A0151, "CMSG_QUERY_PETITION", "ClientToServer" },
+        { 0x3A014E, "CMSG_QUERY_PET_NAME", "ClientToServer" },
+        { 0x41000D, "CMSG_QUERY_PLAYER_NAME_BY_COMMUNITY_ID", "ClientToServer" },
+        { 0x410010, "CMSG_QUERY_PLAYER_NAMES", "ClientToServer" },
+        { 0x41000E, "CMSG_QUERY_PLAYER_NAMES_FOR_COMMUNITY", "ClientToServer" },
+        { 0x3A0021, "CMSG_QUERY_QUEST_COMPLETION_NPCS", "ClientToServer" },
+        { 0x3A014C, "CMSG_QUERY_QUEST_INFO", "ClientToServer" },
+        { 0x3A0022, "CMSG_QUERY_QUEST_ITEM_USABILITY", "ClientToServer" },
+        { 0x4000B5, "CMSG_QUERY_REALM_NAME", "ClientToServer" },
+        { 0x400082, "CMSG_QUERY_SCENARIO_POI", "ClientToServer" },
+        { 0x3A02F6, "CMSG_QUERY_SELECTED_WOW_LABS_AREA", "ClientToServer" },
+        { 0x3B006E, "CMSG_QUERY_TIME", "ClientToServer" },
+        { 0x3A023D, "CMSG_QUERY_TREASURE_PICKER", "ClientToServer" },
+        { 0x3A02F7, "CMSG_QUERY_WOW_LABS_AREA_INFO", "ClientToServer" },
+        { 0x3B0030, "CMSG_QUEST_CONFIRM_ACCEPT", "ClientToServer" },
+        { 0x3A02F2, "CMSG_QUEST_DRIVEN_SCENARIO_STATE_CHANGE", "ClientToServer" },
+        { 0x3B002A, "CMSG_QUEST_GIVER_ACCEPT_QUEST", "ClientToServer" },
+        { 0x3B002C, "CMSG_QUEST_GIVER_CHOOSE_REWARD", "ClientToServer" },
+        { 0x3B00E9, "CMSG_QUEST_GIVER_CLOSE_QUEST", "ClientToServer" },
+        { 0x3B002B, "CMSG_QUEST_GIVER_COMPLETE_QUEST", "ClientToServer" },
+        { 0x3B0028, "CMSG_QUEST_GIVER_HELLO", "ClientToServer" },
+        { 0x3B0029, "CMSG_QUEST_GIVER_QUERY_QUEST", "ClientToServer" },
+        { 0x3B002D, "CMSG_QUEST_GIVER_REQUEST_REWARD", "ClientToServer" },
+        { 0x3B002F, "CMSG_QUEST_GIVER_STATUS_MULTIPLE_QUERY", "ClientToServer" },
+        { 0x3B002E, "CMSG_QUEST_GIVER_STATUS_QUERY", "ClientToServer" },
+        { 0x3B00CD, "CMSG_QUEST_LOG_REMOVE_QUEST", "ClientToServer" },
+        { 0x4000DE, "CMSG_QUEST_POI_QUERY", "ClientToServer" },
+        { 0x3B0032, "CMSG_QUEST_PUSH_RESULT", "ClientToServer" },
+        { 0x3A0283, "CMSG_QUEST_SESSION_BEGIN_RESPONSE", "ClientToServer" },
+        { 0x3A0282, "CMSG_QUEST_SESSION_REQUEST_START", "ClientToServer" },
+        { 0x40015B, "CMSG_QUEST_SESSION_REQUEST_STOP", "ClientToServer" },
+        { 0x41000A, "CMSG_QUEUED_MESSAGES_END", "ClientToServer" },
+        { 0x400132, "CMSG_QUICK_JOIN_AUTO_ACCEPT_REQUESTS", "ClientToServer" },
+        { 0x400131, "CMSG_QUICK_JOIN_REQUEST_INVITE", "ClientToServer" },
+        { 0x400160, "CMSG_QUICK_JOIN_REQUEST_INVITE_WITH_CONFIRMATION", "ClientToServer" },
+        { 0x400130, "CMSG_QUICK_JOIN_RESPOND_TO_INVITE", "ClientToServer" },
+        { 0x40012F, "CMSG_QUICK_JOIN_SIGNAL_TOAST_DISPLAYED", "ClientToServer" },
+        { 0x3B009C, "CMSG_RAF_CLAIM_ACTIVITY_REWARD", "ClientToServer" },
+        { 0x400151, "CMSG_RAF_CLAIM_NEXT_REWARD", "ClientToServer" },
+        { 0x400153, "CMSG_RAF_GENERATE_RECRUITMENT_LINK", "ClientToServer" },
+        { 0x400127, "CMSG_RAF_RECRUIT_PRESENCE_SUBSCRIBE", "ClientToServer" },
+        { 0x400152, "CMSG_RAF_UPDATE_RECRUITMENT_INFO", "ClientToServer" },
+        { 0x400080, "CMSG_RANDOM_ROLL", "ClientToServer" },
+        { 0x3A021A, "CMSG_READ_ITEM", "ClientToServer" },
+        { 0x40005F, "CMSG_READY_CHECK_RESPONSE", "ClientToServer" },
+        { 0x400198, "CMSG_RECENT_ALLY_REQUEST_DATA", "ClientToServer" },
+        { 0x400199, "CMSG_RECENT_ALLY_SET_NOTE", "ClientToServer" },
+        { 0x3B0073, "CMSG_RECLAIM_CORPSE", "ClientToServer" },
+        { 0x40019C, "CMSG_REFRESH_ENTITLEMENTS_ON_ORDER_COMPLETE", "ClientToServer" },
+        { 0x400172, "CMSG_REGISTER_FAST_LOGIN", "ClientToServer" },
+        { 0x3A0241, "CMSG_REMOVE_NEW_ITEM", "ClientToServer" },
+        { 0x400154, "CMSG_REMOVE_RAF_RECRUIT", "ClientToServer" },
+        { 0x400015, "CMSG_REORDER_CHARACTERS", "ClientToServer" },
+        { 0x3B0084, "CMSG_REPAIR_ITEM", "ClientToServer" },
+        { 0x3A01FB, "CMSG_REPLACE_TROPHY", "ClientToServer" },
+        { 0x3B00C5, "CMSG_REPOP_REQUEST", "ClientToServer" },
+        { 0x3B008C, "CMSG_REPORT_PVP_PLAYER_AFK", "ClientToServer" },
+        { 0x3A027B, "CMSG_REPORT_SERVER_LAG", "ClientToServer" },
+        { 0x3A027C, "CMSG_REPORT_STUCK_IN_COMBAT", "ClientToServer" },
+        { 0x4000C3, "CMSG_REQUEST_ACCOUNT_DATA", "ClientToServer" },
+        { 0x3A023F, "CMSG_REQUEST_AREA_POI_UPDATE", "ClientToServer" },
+        { 0x400008, "CMSG_REQUEST_BATTLEFIELD_STATUS", "ClientToServer" },
+        { 0x3A0023, "CMSG_REQUEST_CEMETERY_LIST", "ClientToServer" },
+        { 0x4000B8, "CMSG_REQUEST_CHARACTER_GUILD_FOLLOW_INFO", "ClientToServer" },
+        { 0x400028, "CMSG_REQUEST_CHAT_LOGIN", "ClientToServer" },
+        { 0x3A026D, "CMSG_REQUEST_COVENANT_CALLINGS", "ClientToServer" },
+        { 0x3B00C9, "CMSG_REQUEST_CROWD_CONTROL_SPELL", "ClientToServer" },
+        { 0x29001E, "CMSG_REQUEST_CURRENCY_DATA_FOR_ACCOUNT_CHARACTERS", "ClientToServer" },
+        { 0x3A02A6, "CMSG_REQUEST_GARRISON_TALENT_WORLD_QUEST_UNLOCKS", "ClientToServer" },
+        { 0x3A005A, "CMSG_REQUEST_GUILD_PARTY_STATE", "ClientToServer" },
+        { 0x3A0059, "CMSG_REQUEST_GUILD_REWARDS_LIST", "ClientToServer" },
+        { 0x3A019A, "CMSG_REQUEST_INSTANCE_ENCOUNTER_EVENT_SYNC", "ClientToServer" },
+        { 0x3A027D, "CMSG_REQUEST_LATEST_SPLASH_SCREEN", "ClientToServer" },
+        { 0x3A0187, "CMSG_REQUEST_LFG_LIST_BLACKLIST", "ClientToServer" },
+        { 0x3A00BF, "CMSG_REQUEST_MYTHIC_PLUS_AFFIXES", "ClientToServer" },
+        { 0x3A00C0, "CMSG_REQUEST_MYTHIC_PLUS_SEASON_DATA", "ClientToServer" },
+        { 0x3A02F3, "CMSG_REQUEST_PARTY_ELIGIBILITY_FOR_DELVE_TIERS", "ClientToServer" },
+        { 0x400023, "CMSG_REQUEST_PARTY_JOIN_UPDATES", "ClientToServer" },
+        { 0x40007F, "CMSG_REQUEST_PARTY_MEMBER_STATS", "ClientToServer" },
+        { 0x3B0022, "CMSG_REQUEST_PET_INFO", "ClientToServer" },
+        { 0x3A0154, "CMSG_REQUEST_PLAYED_TIME", "ClientToServer" },
+        { 0x3A0041, "CMSG_REQUEST_PVP_REWARDS", "ClientToServer" },
+        { 0x4000F9, "CMSG_REQUEST_RAID_INFO", "ClientToServer" },
+        { 0x40000F, "CMSG_REQUEST_RATED_PVP_INFO", "ClientToServer" },
+        { 0x400196, "CMSG_REQUEST_REALM_GUILD_MASTER_INFO", "ClientToServer" },
+        { 0x3A0240, "CMSG_REQUEST_SCHEDULED_AREA_POI_UPDATE", "ClientToServer" },
+        { 0x3A0042, "CMSG_REQUEST_SCHEDULED_PVP_INFO", "ClientToServer" },
+        { 0x3B0023, "CMSG_REQUEST_STABLED_PETS", "ClientToServer" },
+        { 0x290023, "CMSG_REQUEST_STORE_FRONT_INFO_UPDATE", "ClientToServer" },
+        { 0x3A0309, "CMSG_REQUEST_SURVEY", "ClientToServer" },
+        { 0x3A030D, "CMSG_REQUEST_TREASURE_PUNCH_LIST_ITEMS", "ClientToServer" },
+        { 0x3A0106, "CMSG_REQUEST_VEHICLE_EXIT", "ClientToServer" },
+        { 0x3A0108, "CMSG_REQUEST_VEHICLE_NEXT_SEAT", "ClientToServer" },
+        { 0x3A0107, "CMSG_REQUEST_VEHICLE_PREV_SEAT", "ClientToServer" },
+        { 0x3A0109, "CMSG_REQUEST_VEHICLE_SWITCH_SEAT", "ClientToServer" },
+        { 0x3A0270, "CMSG_REQUEST_WEEKLY_REWARDS", "ClientToServer" },
+        { 0x3A023E, "CMSG_REQUEST_WORLD_QUEST_UPDATE", "ClientToServer" },
+        { 0x3A00BD, "CMSG_RESET_CHALLENGE_MODE", "ClientToServer" },
+        { 0x3A00BE, "CMSG_RESET_CHALLENGE_MODE_CHEAT", "ClientToServer" },
+        { 0x400094, "CMSG_RESET_INSTANCES", "ClientToServer" },
+        { 0x4000AF, "CMSG_RESURRECT_RESPONSE", "ClientToServer" },
+        { 0x3A01FD, "CMSG_REVERT_MONUMENT_APPEARANCE", "ClientToServer" },
+        { 0x3A010A, "CMSG_RIDE_VEHICLE_INTERACT", "ClientToServer" },
+        { 0x40017B, "CMSG_SAVE_ACCOUNT_DATA_EXPORT", "ClientToServer" },
+        { 0x3A0037, "CMSG_SAVE_CUF_PROFILES", "ClientToServer" },
+        { 0x3B00A2, "CMSG_SAVE_EQUIPMENT_SET", "ClientToServer" },
+        { 0x3A018C, "CMSG_SAVE_GUILD_EMBLEM", "ClientToServer" },
+        { 0x3A018D, "CMSG_SAVE_PERSONAL_EMBLEM", "ClientToServer" },
+        { 0x3A00E6, "CMSG_SCENE_PLAYBACK_CANCELED", "ClientToServer" },
+        { 0x3A00E5, "CMSG_SCENE_PLAYBACK_COMPLETE", "ClientToServer" },
+        { 0x3A00E7, "CMSG_SCENE_TRIGGER_EVENT", "ClientToServer" },
+        { 0x3A02E2, "CMSG_SEAMLESS_TRANSFER_COMPLETE", "ClientToServer" },
+        { 0x3A02F8, "CMSG_SELECT_WOW_LABS_AREA", "ClientToServer" },
+        { 0x3B00D0, "CMSG_SELF_RES", "ClientToServer" },
+        { 0x3B0035, "CMSG_SELL_ALL_JUNK_ITEMS", "ClientToServer" },
+        { 0x3B0034, "CMSG_SELL_ITEM", "ClientToServer" },
+        { 0x400128, "CMSG_SEND_CHARACTER_CLUB_INVITATION", "ClientToServer" },
+        { 0x4000FF, "CMSG_SEND_CONTACT_LIST", "ClientToServer" },
+        { 0x400026, "CMSG_SEND_MAIL", "ClientToServer" },
+        { 0x3A02E4, "CMSG_SEND_PING_UNIT", "ClientToServer" },
+        { 0x3A02E5, "CMSG_SEND_PING_WORLD_POINT", "ClientToServer" },
+        { 0x3B0019, "CMSG_SEND_TEXT_EMOTE", "ClientToServer" },
+        { 0x4000CA, "CMSG_SERVER_TIME_OFFSET_REQUEST", "ClientToServer" },
+        { 0x400197, "CMSG_SERVER_VALIDATION_SIGNATURE_REQUEST", "ClientToServer" },
+        { 0x3B00D1, "CMSG_SET_ACTION_BAR_TOGGLES", "ClientToServer" },
+        { 0x400062, "CMSG_SET_ACTION_BUTTON", "ClientToServer" },
+        { 0x3E005B, "CMSG_SET_ACTIVE_MOVER", "ClientToServer" },
+        { 0x3A019B, "CMSG_SET_ADVANCED_COMBAT_LOGGING", "ClientToServer" },
+        { 0x3A030B, "CMSG_SET_ALLOW_RECENT_ALLIES_SEE_LOCATION", "ClientToServer" },
+        { 0x40007B, "CMSG_SET_ASSISTANT_LEADER", "ClientToServer" },
+        { 0x3A021D, "CMSG_SET_BACKPACK_AUTOSORT_DISABLED", "ClientToServer" },
+        { 0x3A021E, "CMSG_SET_BACKPACK_SELL_JUNK_DISABLED", "ClientToServer" },
+        { 0x3A021F, "CMSG_SET_BANK_AUTOSORT_DISABLED", "ClientToServer" },
+        { 0x400102, "CMSG_SET_CONTACT_NOTES", "ClientToServer" },
+        { 0x3A0015, "CMSG_SET_CURRENCY_FLAGS", "ClientToServer" },
+        { 0x3A00E8, "CMSG_SET_DIFFICULTY_ID", "ClientToServer" },
+        { 0x4000AE, "CMSG_SET_DUNGEON_DIFFICULTY", "ClientToServer" },
+        { 0x3A0143, "CMSG_SET_EMPOWER_MIN_HOLD_STAGE_PERCENT", "ClientToServer" },
+        { 0x400046, "CMSG_SET_EVERYONE_IS_ASSISTANT", "ClientToServer" },
+        { 0x400133, "CMSG_SET_EXCLUDED_CHAT_CENSOR_SOURCES", "ClientToServer" },
+        { 0x3B0076, "CMSG_SET_FACTION_AT_WAR", "ClientToServer" },
+        { 0x3B0078, "CMSG_SET_FACTION_INACTIVE", "ClientToServer" },
+        { 0x3B0077, "CMSG_SET_FACTION_NOT_AT_WAR", "ClientToServer" },
+        { 0x3A006B, "CMSG_SET_GAME_EVENT_DEBUG_VIEW_STATE", "ClientToServer" },
+        { 0x3A0221, "CMSG_SET_INSERT_ITEMS_LEFT_TO_RIGHT", "ClientToServer" },
+        { 0x400074, "CMSG_SET_LOOT_METHOD", "ClientToServer" },
+        { 0x3B00DE, "CMSG_SET_LOOT_SPECIALIZATION", "ClientToServer" },
+        { 0x40007D, "CMSG_SET_PARTY_ASSIGNMENT", "ClientToServer" },
+        { 0x400076, "CMSG_SET_PARTY_LEADER", "ClientToServer" },
+        { 0x3A0012, "CMSG_SET_PET_FAVORITE", "ClientToServer" },
+        { 0x3A0011, "CMSG_SET_PET_SLOT", "ClientToServer" },
+        { 0x3A0013, "CMSG_SET_PET_SPECIALIZATION", "ClientToServer" },
+        { 0x4000B4, "CMSG_SET_PLAYER_DECLINED_NAMES", "ClientToServer" },
+        { 0x3A0024, "CMSG_SET_PREFERRED_CEMETERY", "ClientToServer" },
+        { 0x3A0191, "CMSG_SET_PVP", "ClientToServer" },
+        { 0x40010B, "CMSG_SET_RAID_DIFFICULTY", "ClientToServer" },
+        { 0x400047, "CMSG_SET_RESTRICT_PINGS_TO_ASSISTANTS", "ClientToServer" },
+        { 0x400005, "CMSG_SET_ROLE", "ClientToServer" },
+        { 0x4000B2, "CMSG_SET_SAVED_INSTANCE_EXTEND", "ClientToServer" },
+        { 0x3B00C7, "CMSG_SET_SELECTION", "ClientToServer" },
+        { 0x3B001A, "CMSG_SET_SHEATHED", "ClientToServer" },
+        { 0x3A0220, "CMSG_SET_SORT_BAGS_RIGHT_TO_LEFT", "ClientToServer" },
+        { 0x3A0226, "CMSG_SET_STOP_CONVERSATION", "ClientToServer" },
+        { 0x3B008B, "CMSG_SET_TAXI_BENCHMARK_MODE", "ClientToServer" },
+        { 0x3A015A, "CMSG_SET_TITLE", "ClientToServer" },
+        { 0x3A000A, "CMSG_SET_TRADE_CURRENCY", "ClientToServer" },
+        { 0x3A0009, "CMSG_SET_TRADE_GOLD", "ClientToServer" },
+        { 0x3A0007, "CMSG_SET_TRADE_ITEM", "ClientToServer" },
+        { 0x40018F, "CMSG_SETUP_WARBAND_GROUPS", "ClientToServer" },
+        { 0x3A01DC, "CMSG_SET_USING_PARTY_GARRISON", "ClientToServer" },
+        { 0x3A0192, "CMSG_SET_WAR_MODE", "ClientToServer" },
+        { 0x3B0079, "CMSG_SET_WATCHED_FACTION", "ClientToServer" },
+        { 0x4000F1, "CMSG_SHOW_TRADE_SKILL", "ClientToServer" },
+        { 0x3B00D2, "CMSG_SIGN_PETITION", "ClientToServer" },
+        { 0x40007E, "CMSG_SILENCE_PARTY_TALKER", "ClientToServer" },
+        { 0x400176, "CMSG_SOCIAL_CONTRACT_REQUEST", "ClientToServer" },
+        { 0x3B0083, "CMSG_SOCKET_GEMS", "ClientToServer" },
+        { 0x3A02E8, "CMSG_SORT_ACCOUNT_BANK_BAGS", "ClientToServer" },
+        { 0x3A0222, "CMSG_SORT_BAGS", "ClientToServer" },
+        { 0x3A0223, "CMSG_SORT_BANK_BAGS", "ClientToServer" },
+        { 0x3A016F, "CMSG_SPAWN_TRACKING_UPDATE", "ClientToServer" },
+        { 0x3A02DB, "CMSG_SPECTATE_CHANGE", "ClientToServer" },
+        { 0x3B0027, "CMSG_SPELL_CLICK", "ClientToServer" },
+        { 0x3A0141, "CMSG_SPELL_EMPOWER_RELEASE", "ClientToServer" },
+        { 0x3A0142, "CMSG_SPELL_EMPOWER_RESTART", "ClientToServer" },
+        { 0x3B0042, "CMSG_SPIRIT_HEALER_ACTIVATE", "ClientToServer" },
+        { 0x3B0053, "CMSG_SPLIT_GUILD_BANK_ITEM", "ClientToServer" },
+        { 0x3B0050, "CMSG_SPLIT_GUILD_BANK_ITEM_TO_INVENTORY", "ClientToServer" },
+        { 0x3D0008, "CMSG_SPLIT_ITEM", "ClientToServer" },
+        { 0x3B004E, "CMSG_SPLIT_ITEM_TO_GUILD_BANK", "ClientToServer" },
+        { 0x3A0035, "CMSG_STAND_STATE_CHANGE", "ClientToServer" },
+        { 0x3B00EA, "CMSG_START_CHALLENGE_MODE", "ClientToServer" },
+        { 0x400060, "CMSG_START_INSTANCE_ABANDON_VOTE", "ClientToServer" },
+        { 0x40000B, "CMSG_START_SPECTATOR_WAR_GAME", "ClientToServer" },
+        { 0x40000A, "CMSG_START_WAR_GAME", "ClientToServer" },
+        { 0x3B0049, "CMSG_STORE_GUILD_BANK_ITEM", "ClientToServer" },
+        { 0x4000C2, "CMSG_SUBMIT_USER_FEEDBACK", "ClientToServer" },
+        { 0x3A029B, "CMSG_SUBSCRIPTION_INTERSTITIAL_RESPONSE", "ClientToServer" },
+        { 0x400096, "CMSG_SUMMON_RESPONSE", "ClientToServer" },
+        { 0x400072, "CMSG_SUPPORT_TICKET_SUBMIT_COMPLAINT", "ClientToServer" },
+        { 0x3A0020, "CMSG_SURRENDER_ARENA", "ClientToServer" },
+        { 0x410000, "CMSG_SUSPEND_COMMS_ACK", "ClientToServer" },
+        { 0x410008, "CMSG_SUSPEND_TOKEN_RESPONSE", "ClientToServer" },
+        { 0x3B004B, "CMSG_SWAP_GUILD_BANK_ITEM_WITH_GUILD_BANK_ITEM", "ClientToServer" },
+        { 0x3D0007, "CMSG_SWAP_INV_ITEM", "ClientToServer" },
+        { 0x3D0006, "CMSG_SWAP_ITEM", "ClientToServer" },
+        { 0x3B004A, "CMSG_SWAP_ITEM_WITH_GUILD_BANK_ITEM", "ClientToServer" },
+        { 0x400079, "CMSG_SWAP_SUB_GROUPS", "ClientToServer" },
+        { 0x3A018E, "CMSG_TABARD_VENDOR_ACTIVATE", "ClientToServer" },
+        { 0x3B0024, "CMSG_TALK_TO_GOSSIP", "ClientToServer" },
+        { 0x3B003B, "CMSG_TAXI_NODE_STATUS_QUERY", "ClientToServer" },
+        { 0x3B003D, "CMSG_TAXI_QUERY_AVAILABLE_NODES", "ClientToServer" },
+        { 0x3B003F, "CMSG_TAXI_REQUEST_EARLY_LANDING", "ClientToServer" },
+        { 0x3E005F, "CMSG_TIME_ADJUSTMENT_RESPONSE", "ClientToServer" },
+        { 0x3E005C, "CMSG_TIME_SYNC_RESPONSE", "ClientToServer" },
+        { 0x3E005E, "CMSG_TIME_SYNC_RESPONSE_DROPPED", "ClientToServer" },
+        { 0x3E005D, "CMSG_TIME_SYNC_RESPONSE_FAILED", "ClientToServer" },
+        { 0x400083, "CMSG_TOGGLE_DIFFICULTY", "ClientToServer" },
+        { 0x3A0190, "CMSG_TOGGLE_PVP", "ClientToServer" },
+        { 0x3B0090, "CMSG_TOTEM_DESTROYED", "ClientToServer" },
+        { 0x290004, "CMSG_TOY_CLEAR_FANFARE", "ClientToServer" },
+        { 0x3A023C, "CMSG_TRADE_SKILL_SET_FAVORITE", "ClientToServer" },
+        { 0x3B0041, "CMSG_TRAINER_BUY_SPELL", "ClientToServer" },
+        { 0x3B0040, "CMSG_TRAINER_LIST", "ClientToServer" },
+        { 0x3B00C3, "CMSG_TRAINING_GROUNDS_JOIN", "ClientToServer" },
+        { 0x3A02C4, "CMSG_TRAITS_COMMIT_CONFIG", "ClientToServer" },
+        { 0x3A02C2, "CMSG_TRAITS_TALENT_TEST_UNLEARN_SPELLS", "ClientToServer" },
+        { 0x3A02F1, "CMSG_TRANSFER_CURRENCY_FROM_ACCOUNT_CHARACTER", "ClientToServer" },
+        { 0x3A0044, "CMSG_TRANSMOG_OUTFIT_NEW", "ClientToServer" },
+        { 0x3A0045, "CMSG_TRANSMOG_OUTFIT_UPDATE_INFO", "ClientToServer" },
+        { 0x3A0046, "CMSG_TRANSMOG_OUTFIT_UPDATE_SITUATIONS", "ClientToServer" },
+        { 0x3A0047, "CMSG_TRANSMOG_OUTFIT_UPDATE_SLOTS", "ClientToServer" },
+        { 0x3B00D4, "CMSG_TURN_IN_PETITION", "ClientToServer" },
+        { 0x40010C, "CMSG_TUTORIAL", "ClientToServer" },
+        { 0x3A026C, "CMSG_UI_MAP_QUEST_LINES_REQUEST", "ClientToServer" },
+        { 0x3A0005, "CMSG_UNACCEPT_TRADE", "ClientToServer" },
+        { 0x40010E, "CMSG_UNDELETE_CHARACTER", "ClientToServer" },
+        { 0x3B007D, "CMSG_UNLEARN_SKILL", "ClientToServer" },
+        { 0x3A0057, "CMSG_UNLEARN_SPECIALIZATION", "ClientToServer" },
+        { 0x400166, "CMSG_UPDATE_AADC_STATUS", "ClientToServer" },
+        { 0x3B012B, "CMSG_UPDATE_ACCOUNT_BANK_TAB_SETTINGS", "ClientToServer" },
+        { 0x4000C4, "CMSG_UPDATE_ACCOUNT_DATA", "ClientToServer" },
+        { 0x3A017E, "CMSG_UPDATE_AREA_TRIGGER_VISUAL", "ClientToServer" },
+        { 0x3A01EE, "CMSG_UPDATE_CRAFTING_NPC_RECIPES", "ClientToServer" },
+        { 0x290035, "CMSG_UPDATE_LAST_CATALOG_FETCH", "ClientToServer" },
+        { 0x3E0062, "CMSG_UPDATE_MISSILE_TRAJECTORY", "ClientToServer" },
+        { 0x40007C, "CMSG_UPDATE_RAID_TARGET", "ClientToServer" },
+        { 0x3A017D, "CMSG_UPDATE_SPELL_VISUAL", "ClientToServer" },
+        { 0x400123, "CMSG_UPDATE_VAS_PURCHASE_STATES", "ClientToServer" },
+        { 0x3A01A3, "CMSG_UPGRADE_GARRISON", "ClientToServer" },
+        { 0x3A0299, "CMSG_UPGRADE_RUNEFORGE_LEGENDARY", "ClientToServer" },
+        { 0x3A0110, "CMSG_USE_CRITTER_ITEM", "ClientToServer" },
+        { 0x3A0032, "CMSG_USED_FOLLOW", "ClientToServer" },
+        { 0x3D0001, "CMSG_USE_EQUIPMENT_SET", "ClientToServer" },
+        { 0x3A0177, "CMSG_USE_ITEM", "ClientToServer" },
+        { 0x3A017A, "CMSG_USE_TOY", "ClientToServer" },
+        { 0x400139, "CMSG_VAS_CHECK_TRANSFER_OK", "ClientToServer" },
+        { 0x400138, "CMSG_VAS_GET_QUEUE_MINUTES", "ClientToServer" },
+        { 0x400137, "CMSG_VAS_GET_SERVICE_STATUS", "ClientToServer" },
+        { 0x3A0030, "CMSG_VIOLENCE_LEVEL", "ClientToServer" },
+        { 0x40013D, "CMSG_VOICE_CHANNEL_STT_TOKEN_REQUEST", "ClientToServer" },
+        { 0x40013E, "CMSG_VOICE_CHAT_JOIN_CHANNEL", "ClientToServer" },
+        { 0x40013C, "CMSG_VOICE_CHAT_LOGIN", "ClientToServer" },
+        { 0x400018, "CMSG_WARDEN3_DATA", "ClientToServer" },
+        { 0x4000AD, "CMSG_WHO", "ClientToServer" },
+        { 0x4000AC, "CMSG_WHO_IS", "ClientToServer" },
+        { 0x3A02DE, "CMSG_WORLD_LOOT_OBJECT_CLICK", "ClientToServer" },
+        { 0x400025, "CMSG_WORLD_PORT_RESPONSE", "ClientToServer" },
+        { 0x3D0000, "CMSG_WRAP_ITEM", "ClientToServer" },
+        { 0x420030, "SMSG_ABORT_NEW_WORLD", "ServerToClient" },
+        { 0x420350, "SMSG_ACCOUNT_CHARACTER_CURRENCY_LISTS", "ServerToClient" },
+        { 0x420355, "SMSG_ACCOUNT_CONVERSION_STATE_UPDATE", "ServerToClient" },
+        { 0x420311, "SMSG_ACCOUNT_COSMETIC_ADDED", "ServerToClient" },
+        { 0x4202F9, "SMSG_ACCOUNT_CRITERIA_UPDATE", "ServerToClient" },
+        { 0x4201B4, "SMSG_ACCOUNT_DATA_TIMES", "ServerToClient" },
+        { 0x420342, "SMSG_ACCOUNT_EXPORT_RESPONSE", "ServerToClient" },
+        { 0x420054, "SMSG_ACCOUNT_EXTERIOR_FIXTURE_COLLECTION_UPDATE", "ServerToClient" },
+        { 0x420049, "SMSG_ACCOUNT_HEIRLOOM_UPDATE", "ServerToClient" },
+        { 0x420057, "SMSG_ACCOUNT_HOUSE_TYPE_COLLECTION_UPDATE", "ServerToClient" },
+        { 0x42035B, "SMSG_ACCOUNT_ITEM_COLLECTION_DATA", "ServerToClient" },
+        { 0x420047, "SMSG_ACCOUNT_MOUNT_REMOVED", "ServerToClient" },
+        { 0x420046, "SMSG_ACCOUNT_MOUNT_UPDATE", "ServerToClient" },
+        { 0x420310, "SMSG_ACCOUNT_NOTIFICATIONS_RESPONSE", "ServerToClient" },
+        { 0x420053, "SMSG_ACCOUNT_ROOM_COLLECTION_UPDATE", "ServerToClient" },
+        { 0x420056, "SMSG_ACCOUNT_ROOM_MATERIAL_COLLECTION_UPDATE", "ServerToClient" },
+        { 0x420055, "SMSG_ACCOUNT_ROOM_THEME_COLLECTION_UPDATE", "ServerToClient" },
+        { 0x42032B, "SMSG_ACCOUNT_STORE_CURRENCY_UPDATE", "ServerToClient" },
+        { 0x42032C, "SMSG_ACCOUNT_STORE_FRONT_UPDATE", "ServerToClient" },
+        { 0x42032D, "SMSG_ACCOUNT_STORE_ITEM_STATE_CHANGED", "ServerToClient" },
+        { 0x42032E, "SMSG_ACCOUNT_STORE_RESULT", "ServerToClient" },
+        { 0x420048, "SMSG_ACCOUNT_TOY_UPDATE", "ServerToClient" },
+        { 0x420050, "SMSG_ACCOUNT_TRANSMOG_SET_FAVORITES_UPDATE", "ServerToClient" },
+        { 0x42004F, "SMSG_ACCOUNT_TRANSMOG_UPDATE", "ServerToClient" },
+        { 0x420052, "SMSG_ACCOUNT_WARBAND_SCENE_UPDATE", "ServerToClient" },
+        { 0x420191, "SMSG_ACHIEVEMENT_DELETED", "ServerToClient" },
+        { 0x4200EB, "SMSG_ACHIEVEMENT_EARNED", "ServerToClient" },
+        { 0x5F0021, "SMSG_ACTIVATE_ESSENCE_FAILED", "ServerToClient" },
+        { 0x5F0023, "SMSG_ACTIVATE_SOULBIND_FAILED", "ServerToClient" },
+        { 0x420127, "SMSG_ACTIVATE_TAXI_REPLY", "ServerToClient" },
+        { 0x620047, "SMSG_ACTIVE_GLYPHS", "ServerToClient" },
+        { 0x4201EF, "SMSG_ACTIVE_SCHEDULED_WORLD_STATE_INFO", "ServerToClient" },
+        { 0x4200E5, "SMSG_ADD_BATTLENET_FRIEND_RESPONSE", "ServerToClient" },
+        { 0x420042, "SMSG_ADD_ITEM_PASSIVE", "ServerToClient" },
+        { 0x42011A, "SMSG_ADD_LOSS_OF_CONTROL", "ServerToClient" },
+        { 0x4200EA, "SMSG_ADDON_LIST_REQUEST", "ServerToClient" },
+        { 0x420162, "SMSG_ADD_RUNE_POWER", "ServerToClient" },
+        { 0x420073, "SMSG_ADJUST_SPLINE_DURATION", "ServerToClient" },
+        { 0x42030E, "SMSG_ADVANCED_COMBAT_LOG", "ServerToClient" },
+        { 0x420309, "SMSG_ADVENTURE_JOURNAL_DATA_RESPONSE", "ServerToClient" },
+        { 0x4200C1, "SMSG_AE_LOOT_TARGET_ACK", "ServerToClient" },
+        { 0x4200C0, "SMSG_AE_LOOT_TARGETS", "ServerToClient" },
+        { 0x42015F, "SMSG_AI_REACTION", "ServerToClient" },
+        { 0x420005, "SMSG_ALL_ACCOUNT_CRITERIA", "ServerToClient" },
+        { 0x420004, "SMSG_ALL_ACHIEVEMENT_DATA", "ServerToClient" },
+        { 0x4E0000, "SMSG_ALL_GUILD_ACHIEVEMENTS", "ServerToClient" },
+        { 0x4202A2, "SMSG_ALLIED_RACE_DETAILS", "ServerToClient" },
+        { 0x4202E6, "SMSG_APPLY_MOUNT_EQUIPMENT_RESULT", "ServerToClient" },
+        { 0x42001D, "SMSG_ARCHAEOLOGY_SURVERY_CAST", "ServerToClient" },
+        { 0x5F0019, "SMSG_AREA_POI_UPDATE_RESPONSE", "ServerToClient" },
+        { 0x4201E8, "SMSG_AREA_SPIRIT_HEALER_TIME", "ServerToClient" },
+        { 0x430004, "SMSG_AREA_TRIGGER_DENIED", "ServerToClient" },
+        { 0x4201C0, "SMSG_AREA_TRIGGER_NO_CORPSE", "ServerToClient" },
+        { 0x430002, "SMSG_AREA_TRIGGER_PLAY_SPELL_VISUAL", "ServerToClient" },
+        { 0x430003, "SMSG_AREA_TRIGGER_UPDATE_DECAL_PROPERTIES", "ServerToClient" },
+        { 0x4200F1, "SMSG_ARENA_CLEAR_OPPONENTS", "ServerToClient" },
+        { 0x4200DA, "SMSG_ARENA_CROWD_CONTROL_SPELL_RESULT", "ServerToClient" },
+        { 0x4200F0, "SMSG_ARENA_PREP_OPPONENT_SPECIALIZATIONS", "ServerToClient" },
+        { 0x420250, "SMSG_ARTIFACT_ENDGAME_POWERS_REFUNDED", "ServerToClient" },
+        { 0x42024E, "SMSG_ARTIFACT_FORGE_ERROR", "ServerToClient" },
+        { 0x42024F, "SMSG_ARTIFACT_RESPEC_PROMPT", "ServerToClient" },
+        { 0x420295, "SMSG_ARTIFACT_XP_GAIN", "ServerToClient" },
+        { 0x48002C, "SMSG_ATTACKER_STATE_UPDATE", "ServerToClient" },
+        { 0x480017, "SMSG_ATTACK_START", "ServerToClient" },
+        { 0x480018, "SMSG_ATTACK_STOP", "ServerToClient" },
+        { 0x480026, "SMSG_ATTACK_SWING_ERROR", "ServerToClient" },
+        { 0x480027, "SMSG_ATTACK_SWING_LANDED_LOG", "ServerToClient" },
+        { 0x42027E, "SMSG_AUCTIONABLE_TOKEN_AUCTION_SOLD", "ServerToClient" },
+        { 0x42027D, "SMSG_AUCTIONABLE_TOKEN_SELL_AT_MARKET_PRICE_RESPONSE", "ServerToClient" },
+        { 0x42027C, "SMSG_AUCTIONABLE_TOKEN_SELL_CONFIRM_REQUIRED", "ServerToClient" },
+        { 0x42019C, "SMSG_AUCTION_CLOSED_NOTIFICATION", "ServerToClient" },
+        { 0x420199, "SMSG_AUCTION_COMMAND_RESULT", "ServerToClient" },
+        { 0x42032F, "SMSG_AUCTION_DISABLE_NEW_POSTINGS", "ServerToClient" },
+        { 0x420300, "SMSG_AUCTION_FAVORITE_LIST", "ServerToClient" },
+        { 0x4202F8, "SMSG_AUCTION_GET_COMMODITY_QUOTE_RESULT", "ServerToClient" },
+        { 0x420197, "SMSG_AUCTION_HELLO_RESPONSE", "ServerToClient" },
+        { 0x4202F7, "SMSG_AUCTION_LIST_BIDDED_ITEMS_RESULT", "ServerToClient" },
+        { 0x4202F3, "SMSG_AUCTION_LIST_BUCKETS_RESULT", "ServerToClient" },
+        { 0x4202F4, "SMSG_AUCTION_LIST_ITEMS_RESULT", "ServerToClient" },
+        { 0x4202F6, "SMSG_AUCTION_LIST_OWNED_ITEMS_RESULT", "ServerToClient" },
+        { 0x42019B, "SMSG_AUCTION_OUTBID_NOTIFICATION", "ServerToClient" },
+        { 0x42019D, "SMSG_AUCTION_OWNER_BID_NOTIFICATION", "ServerToClient" },
+        { 0x420198, "SMSG_AUCTION_REPLICATE_RESPONSE", "ServerToClient" },
+        { 0x42019A, "SMSG_AUCTION_WON_NOTIFICATION", "ServerToClient" },
+        { 0x620012, "SMSG_AURA_POINTS_DEPLETED", "ServerToClient" },
+        { 0x620011, "SMSG_AURA_UPDATE", "ServerToClient" },
+        { 0x490000, "SMSG_AUTH_CHALLENGE", "ServerToClient" },
+        { 0x420000, "SMSG_AUTH_FAILED", "ServerToClient" },
+        { 0x420001, "SMSG_AUTH_RESPONSE", "ServerToClient" },
+        { 0x460001, "SMSG_AVAILABLE_HOTFIXES", "ServerToClient" },
+        { 0x420330, "SMSG_BACKPACK_DEFAULT_SIZE_CHANGED", "ServerToClient" },
+        { 0x630007, "SMSG_BAG_CLEANUP_FINISHED", "ServerToClient" },
+        { 0x420167, "SMSG_BARBER_SHOP_RESULT", "ServerToClient" },
+        { 0x4202D7, "SMSG_BATCH_PRESENCE_SUBSCRIPTION", "ServerToClient" },
+        { 0x480005, "SMSG_BATTLEFIELD_LIST", "ServerToClient" },
+        { 0x48000B, "SMSG_BATTLEFIELD_PORT_DENIED", "ServerToClient" },
+        { 0x480001, "SMSG_BATTLEFIELD_STATUS_ACTIVE", "ServerToClient" },
+        { 0x480004, "SMSG_BATTLEFIELD_STATUS_FAILED", "ServerToClient" },
+        { 0x48000E, "SMSG_BATTLEFIELD_STATUS_GROUP_PROPOSAL_FAILED", "ServerToClient" },
+        { 0x480000, "SMSG_BATTLEFIELD_STATUS_NEED_CONFIRMATION", "ServerToClient" },
+        { 0x480003, "SMSG_BATTLEFIELD_STATUS_NONE", "ServerToClient" },
+        { 0x480002, "SMSG_BATTLEFIELD_STATUS_QUEUED", "ServerToClient" },
+        { 0x48000D, "SMSG_BATTLEFIELD_STATUS_WAIT_FOR_GROUPS", "ServerToClient" },
+        { 0x48000C, "SMSG_BATTLEGROUND_INFO_THROTTLED", "ServerToClient" },
+        { 0x480029, "SMSG_BATTLEGROUND_INIT", "ServerToClient" },
+        { 0x480009, "SMSG_BATTLEGROUND_PLAYER_JOINED", "ServerToClient" },
+        { 0x48000A, "SMSG_BATTLEGROUND_PLAYER_LEFT", "ServerToClient" },
+        { 0x480006, "SMSG_BATTLEGROUND_PLAYER_POSITIONS", "ServerToClient" },
+        { 0x480028, "SMSG_BATTLEGROUND_POINTS", "ServerToClient" },
+        { 0x420238, "SMSG_BATTLENET_CHALLENGE_ABORT", "ServerToClient" },
+        { 0x420237, "SMSG_BATTLENET_CHALLENGE_START", "ServerToClient" },
+        { 0x4202AF, "SMSG_BATTLE_NET_CONNECTION_STATUS", "ServerToClient" },
+        { 0x4202AE, "SMSG_BATTLENET_NOTIFICATION", "ServerToClient" },
+        { 0x4202AD, "SMSG_BATTLENET_RESPONSE", "ServerToClient" },
+        { 0x420233, "SMSG_BATTLE_PAY_ACK_FAILED", "ServerToClient" },
+        { 0x420222, "SMSG_BATTLE_PAY_BATTLE_PET_DELIVERED", "ServerToClient" },
+        { 0x420223, "SMSG_BATTLE_PAY_COLLECTION_ITEM_DELIVERED", "ServerToClient" },
+        { 0x420232, "SMSG_BATTLE_PAY_CONFIRM_PURCHASE", "ServerToClient" },
+        { 0x420220, "SMSG_BATTLE_PAY_DELIVERY_ENDED", "ServerToClient" },
+        { 0x42021F, "SMSG_BATTLE_PAY_DELIVERY_STARTED", "ServerToClient" },
+        { 0x420316, "SMSG_BATTLE_PAY_DISTRIBUTION_ASSIGN_VAS_RESPONSE", "ServerToClient" },
+        { 0x42021D, "SMSG_BATTLE_PAY_DISTRIBUTION_UNREVOKED", "ServerToClient" },
+        { 0x42021E, "SMSG_BATTLE_PAY_DISTRIBUTION_UPDATE", "ServerToClient" },
+        { 0x42021C, "SMSG_BATTLE_PAY_GET_DISTRIBUTION_LIST_RESPONSE", "ServerToClient" },
+        { 0x42021A, "SMSG_BATTLE_PAY_GET_PRODUCT_LIST_RESPONSE", "ServerToClient" },
+        { 0x42021B, "SMSG_BATTLE_PAY_GET_PURCHASE_LIST_RESPONSE", "ServerToClient" },
+        { 0x420221, "SMSG_BATTLE_PAY_MOUNT_DELIVERED", "ServerToClient" },
+        { 0x420231, "SMSG_BATTLE_PAY_PURCHASE_UPDATE", "ServerToClient" },
+        { 0x4202CB, "SMSG_BATTLE_PAY_START_CHECKOUT", "ServerToClient" },
+        { 0x42022F, "SMSG_BATTLE_PAY_START_DISTRIBUTION_ASSIGN_TO_TARGET_RESPONSE", "ServerToClient" },
+        { 0x42022E, "SMSG_BATTLE_PAY_START_PURCHASE_RESPONSE", "ServerToClient" },
+        { 0x4202BE, "SMSG_BATTLE_PAY_VALIDATE_PURCHASE_RESPONSE", "ServerToClient" },
+        { 0x420122, "SMSG_BATTLE_PET_CAGE_DATE_ERROR", "ServerToClient" },
+        { 0x420092, "SMSG_BATTLE_PET_DELETED", "ServerToClient" },
+        { 0x4200E0, "SMSG_BATTLE_PET_ERROR", "ServerToClient" },
+        { 0x420091, "SMSG_BATTLE_PET_JOURNAL", "ServerToClient" },
+        { 0x42008F, "SMSG_BATTLE_PET_JOURNAL_LOCK_ACQUIRED", "ServerToClient" },
+        { 0x420090, "SMSG_BATTLE_PET_JOURNAL_LOCK_DENIED", "ServerToClient" },
+        { 0x420094, "SMSG_BATTLE_PET_RESTORED", "ServerToClient" },
+        { 0x420093, "SMSG_BATTLE_PET_REVOKED", "ServerToClient" },
+        { 0x420095, "SMSG_BATTLE_PETS_HEALED", "ServerToClient" },
+        { 0x42008D, "SMSG_BATTLE_PET_TRAP_LEVEL", "ServerToClient" },
+        { 0x42008C, "SMSG_BATTLE_PET_UPDATES", "ServerToClient" },
+        { 0x420011, "SMSG_BIND_POINT_UPDATE", "ServerToClient" },
+        { 0x4200D0, "SMSG_BLACK_MARKET_BID_ON_ITEM_RESULT", "ServerToClient" },
+        { 0x4200D1, "SMSG_BLACK_MARKET_OUTBID", "ServerToClient" },
+        { 0x4200CF, "SMSG_BLACK_MARKET_REQUEST_ITEMS_RESULT", "ServerToClient" },
+        { 0x4200D2, "SMSG_BLACK_MARKET_WON", "ServerToClient" },
+        { 0x4200ED, "SMSG_BONUS_ROLL_EMPTY", "ServerToClient" },
+        { 0x48002B, "SMSG_BOSS_KILL", "ServerToClient" },
+        { 0x480016, "SMSG_BREAK_TARGET", "ServerToClient" },
+        { 0x470012, "SMSG_BROADCAST_ACHIEVEMENT", "ServerToClient" },
+        { 0x4202D9, "SMSG_BROADCAST_SUMMON_CAST", "ServerToClient" },
+        { 0x4202DA, "SMSG_BROADCAST_SUMMON_RESPONSE", "ServerToClient" },
+        { 0x420373, "SMSG_BULK_PURCHASE_RESPONSE", "ServerToClient" },
+        { 0x420374, "SMSG_BULK_PURCHASE_UPDATE_RESPONSE", "ServerToClient" },
+        { 0x420375, "SMSG_BULK_REFUND_RESPONSE", "ServerToClient" },
+        { 0x420170, "SMSG_BUY_FAILED", "ServerToClient" },
+        { 0x42016F, "SMSG_BUY_SUCCEEDED", "ServerToClient" },
+        { 0x46000F, "SMSG_CACHE_INFO", "ServerToClient" },
+        { 0x46000E, "SMSG_CACHE_VERSION", "ServerToClient" },
+        { 0x420147, "SMSG_CALENDAR_CLEAR_PENDING_ACTION", "ServerToClient" },
+        { 0x420148, "SMSG_CALENDAR_COMMAND_RESULT", "ServerToClient" },
+        { 0x420137, "SMSG_CALENDAR_COMMUNITY_INVITE", "ServerToClient" },
+        { 0x42013F, "SMSG_CALENDAR_EVENT_REMOVED_ALERT", "ServerToClient" },
+        { 0x420140, "SMSG_CALENDAR_EVENT_UPDATED_ALERT", "ServerToClient" },
+        { 0x420138, "SMSG_CALENDAR_INVITE_ADDED", "ServerToClient" },
+        { 0x42013C, "SMSG_CALENDAR_INVITE_ALERT", "ServerToClient" },
+        { 0x420141, "SMSG_CALENDAR_INVITE_NOTES", "ServerToClient" },
+        { 0x420142, "SMSG_CALENDAR_INVITE_NOTES_ALERT", "ServerToClient" },
+        { 0x420139, "SMSG_CALENDAR_INVITE_REMOVED", "ServerToClient" },
+        { 0x42013E, "SMSG_CALENDAR_INVITE_REMOVED_ALERT", "ServerToClient" },
+        { 0x42013A, "SMSG_CALENDAR_INVITE_STATUS", "ServerToClient" },
+        { 0x42013D, "SMSG_CALENDAR_INVITE_STATUS_ALERT", "ServerToClient" },
+        { 0x42013B, "SMSG_CALENDAR_MODERATOR_STATUS", "ServerToClient" },
+        { 0x420143, "SMSG_CALENDAR_RAID_LOCKOUT_ADDED", "ServerToClient" },
+        { 0x420144, "SMSG_CALENDAR_RAID_LOCKOUT_REMOVED", "ServerToClient" },
+        { 0x420145, "SMSG_CALENDAR_RAID_LOCKOUT_UPDATED", "ServerToClient" },
+        { 0x420135, "SMSG_CALENDAR_SEND_CALENDAR", "ServerToClient" },
+        { 0x420136, "SMSG_CALENDAR_SEND_EVENT", "ServerToClient" },
+        { 0x420146, "SMSG_CALENDAR_SEND_NUM_PENDING", "ServerToClient" },
+        { 0x4201CE, "SMSG_CAMERA_EFFECT", "ServerToClient" },
+        { 0x420187, "SMSG_CANCEL_AUTO_REPEAT", "ServerToClient" },
+        { 0x480025, "SMSG_CANCEL_COMBAT", "ServerToClient" },
+        { 0x620039, "SMSG_CANCEL_ORPHAN_SPELL_VISUAL", "ServerToClient" },
+        { 0x42003B, "SMSG_CANCEL_PING_PIN", "ServerToClient" },
+        { 0x42002E, "SMSG_CANCEL_PRELOAD_WORLD", "ServerToClient" },
+        { 0x4200DF, "SMSG_CANCEL_SCENE", "ServerToClient" },
+        { 0x620037, "SMSG_CANCEL_SPELL_VISUAL", "ServerToClient" },
+        { 0x62003B, "SMSG_CANCEL_SPELL_VISUAL_KIT", "ServerToClient" },
+        { 0x480021, "SMSG_CAN_DUEL_RESULT", "ServerToClient" },
+        { 0x4202BD, "SMSG_CAN_REDEEM_TOKEN_FOR_BALANCE_RESPONSE", "ServerToClient" },
+        { 0x480008, "SMSG_CAPTURE_POINT_REMOVED", "ServerToClient" },
+        { 0x420120, "SMSG_CAS_REFRESH_REMOTE_DATA", "ServerToClient" },
+        { 0x62004A, "SMSG_CAST_FAILED", "ServerToClient" },
+        { 0x4202BF, "SMSG_CATALOG_SHOP_LICENSE_DATA", "ServerToClient" },
+        { 0x420369, "SMSG_CATALOG_SHOP_OBTAIN_LICENSE", "ServerToClient" },
+        { 0x42035C, "SMSG_CATALOG_SHOP_OPEN_CHECKOUT_RESULT", "ServerToClient" },
+        { 0x470009, "SMSG_CAUTIONARY_CHANNEL_MESSAGE", "ServerToClient" },
+        { 0x470008, "SMSG_CAUTIONARY_CHAT_MESSAGE", "ServerToClient" },
+        { 0x42006B, "SMSG_CHAIN_MISSILE_BOUNCE", "ServerToClient" },
+        { 0x4200B0, "SMSG_CHALLENGE_MODE_COMPLETE", "ServerToClient" },
+        { 0x4200B1, "SMSG_CHALLENGE_MODE_NEW_PLAYER_RECORD", "ServerToClient" },
+        { 0x4200B8, "SMSG_CHALLENGE_MODE_REQUEST_LEADERBOARD_RESULT", "ServerToClient" },
+        { 0x4200B7, "SMSG_CHALLENGE_MODE_REQUEST_LEADERS_RESULT", "ServerToClient" },
+        { 0x4200AF, "SMSG_CHALLENGE_MODE_RESET", "ServerToClient" },
+        { 0x5F0031, "SMSG_CHALLENGE_MODE_SET_LEAVER_PENALTY_TIMER", "ServerToClient" },
+        { 0x4200AD, "SMSG_CHALLENGE_MODE_START", "ServerToClient" },
+        { 0x4200AE, "SMSG_CHALLENGE_MODE_UPDATE_DEATH_COUNT", "ServerToClient" },
+        { 0x5F000D, "SMSG_CHANGE_PLAYER_DIFFICULTY_RESULT", "ServerToClient" },
+        { 0x4202B0, "SMSG_CHANGE_REALM_TICKET_RESPONSE", "ServerToClient" },
+        { 0x47001B, "SMSG_CHANNEL_LIST", "ServerToClient" },
+        { 0x470017, "SMSG_CHANNEL_NOTIFY", "ServerToClient" },
+        { 0x470019, "SMSG_CHANNEL_NOTIFY_JOINED", "ServerToClient" },
+        { 0x47001A, "SMSG_CHANNEL_NOTIFY_LEFT", "ServerToClient" },
+        { 0x470018, "SMSG_CHANNEL_NOTIFY_NPE_JOINED_BATCH", "ServerToClient" },
+        { 0x42026A, "SMSG_CHARACTER_CHECK_UPGRADE_RESULT", "ServerToClient" },
+        { 0x4201AE, "SMSG_CHARACTER_LOGIN_FAILED", "ServerToClient" },
+        { 0x420236, "SMSG_CHARACTER_OBJECT_TEST_RESPONSE", "ServerToClient" },
+        { 0x42020B, "SMSG_CHARACTER_RENAME_RESULT", "ServerToClient" },
+        { 0x420269, "SMSG_CHARACTER_UPGRADE_ABORTED", "ServerToClient" },
+        { 0x420268, "SMSG_CHARACTER_UPGRADE_COMPLETE", "ServerToClient" },
+        { 0x42026B, "SMSG_CHARACTER_UPGRADE_MANUAL_UNREVOKE_RESULT", "ServerToClient" },
+        { 0x420267, "SMSG_CHARACTER_UPGRADE_STARTED", "ServerToClient" },
+        { 0x42018B, "SMSG_CHAR_CUSTOMIZE_FAILURE", "ServerToClient" },
+        { 0x42018C, "SMSG_CHAR_CUSTOMIZE_SUCCESS", "ServerToClient" },
+        { 0x420254, "SMSG_CHAR_FACTION_CHANGE_RESULT", "ServerToClient" },
+        { 0x470001, "SMSG_CHAT", "ServerToClient" },
+        { 0x47000E, "SMSG_CHAT_AUTO_RESPONDED", "ServerToClient" },
+        { 0x470022, "SMSG_CHAT_CAN_LOCAL_WHISPER_TARGET_RESPONSE", "ServerToClient" },
+        { 0x470014, "SMSG_CHAT_DOWN", "ServerToClient" },
+        { 0x470000, "SMSG_CHAT_IGNORED_ACCOUNT_MUTED", "ServerToClient" },
+        { 0x470015, "SMSG_CHAT_IS_DOWN", "ServerToClient" },
+        { 0x470023, "SMSG_CHAT_NOT_IN_GUILD", "ServerToClient" },
+        { 0x470006, "SMSG_CHAT_NOT_IN_PARTY", "ServerToClient" },
+        { 0x470004, "SMSG_CHAT_PLAYER_AMBIGUOUS", "ServerToClient" },
+        { 0x47000D, "SMSG_CHAT_PLAYER_NOTFOUND", "ServerToClient" },
+        { 0x470016, "SMSG_CHAT_RECONNECT", "ServerToClient" },
+        { 0x47001D, "SMSG_CHAT_REGIONAL_SERVICE_STATUS", "ServerToClient" },
+        { 0x470007, "SMSG_CHAT_RESTRICTED", "ServerToClient" },
+        { 0x47001C, "SMSG_CHAT_SERVER_MESSAGE", "ServerToClient" },
+        { 0x620002, "SMSG_CHEAT_IGNORE_DIMISHING_RETURNS", "ServerToClient" },
+        { 0x5F0024, "SMSG_CHECK_ABANDON_NPE", "ServerToClient" },
+        { 0x42001B, "SMSG_CHECK_CHARACTER_NAME_AVAILABILITY_RESULT", "ServerToClient" },
+        { 0x420027, "SMSG_CHECK_WARGAME_ENTRY", "ServerToClient" },
+        { 0x420303, "SMSG_CHROMIE_TIME_SELECT_EXPANSION_SUCCESS", "ServerToClient" },
+        { 0x4202EA, "SMSG_CLAIM_RAF_REWARD_RESPONSE", "ServerToClient" },
+        { 0x620016, "SMSG_CLEAR_ALL_SPELL_CHARGES", "ServerToClient" },
+        { 0x42005E, "SMSG_CLEAR_BOSS_EMOTES", "ServerToClient" },
+        { 0x420164, "SMSG_CLEAR_COOLDOWN", "ServerToClient" },
+        { 0x620015, "SMSG_CLEAR_COOLDOWNS", "ServerToClient" },
+        { 0x420364, "SMSG_CLEAR_INITIATIVE_TASK_CRITERIA_PROGRESS", "ServerToClient" },
+        { 0x420013, "SMSG_CLEAR_RESURRECT", "ServerToClient" },
+        { 0x620017, "SMSG_CLEAR_SPELL_CHARGES", "ServerToClient" },
+        { 0x480022, "SMSG_CLEAR_TARGET", "ServerToClient" },
+        { 0x600022, "SMSG_CLEAR_TREASURE_PICKER_CACHE", "ServerToClient" },
+        { 0x42024D, "SMSG_CLOSE_ARTIFACT_FORGE", "ServerToClient" },
+        { 0x4202E2, "SMSG_CLUB_FINDER_ERROR_MESSAGE", "ServerToClient" },
+        { 0x4202E5, "SMSG_CLUB_FINDER_GET_CLUB_POSTING_IDS_RESPONSE", "ServerToClient" },
+        { 0x4202E3, "SMSG_CLUB_FINDER_LOOKUP_CLUB_POSTINGS_LIST", "ServerToClient" },
+        { 0x4202E0, "SMSG_CLUB_FINDER_RESPONSE_CHARACTER_APPLICATION_LIST", "ServerToClient" },
+        { 0x4202E4, "SMSG_CLUB_FINDER_RESPONSE_POST_RECRUITMENT_MESSAGE", "ServerToClient" },
+        { 0x4202E1, "SMSG_CLUB_FINDER_UPDATE_APPLICATIONS", "ServerToClient" },
+        { 0x42031B, "SMSG_CLUB_FINDER_WHISPER_APPLICANT_RESPONSE", "ServerToClient" },
+        { 0x4200BF, "SMSG_COIN_REMOVED", "ServerToClient" },
+        { 0x480019, "SMSG_COMBAT_EVENT_FAILED", "ServerToClient" },
+        { 0x4201B0, "SMSG_COMMENTATOR_MAP_INFO", "ServerToClient" },
+        { 0x4201B1, "SMSG_COMMENTATOR_PLAYER_INFO", "ServerToClient" },
+        { 0x4201AF, "SMSG_COMMENTATOR_STATE_CHANGED", "ServerToClient" },
+        { 0x420279, "SMSG_COMMERCE_TOKEN_GET_COUNT_RESPONSE", "ServerToClient" },
+        { 0x420285, "SMSG_COMMERCE_TOKEN_GET_LOG_RESPONSE", "ServerToClient" },
+        { 0x42027B, "SMSG_COMMERCE_TOKEN_GET_MARKET_PRICE_RESPONSE", "ServerToClient" },
+        { 0x42027A, "SMSG_COMMERCE_TOKEN_UPDATE", "ServerToClient" },
+        { 0x420155, "SMSG_COMPLAINT_RESULT", "ServerToClient" },
+        { 0x420246, "SMSG_COMPLETE_SHIPMENT_RESPONSE", "ServerToClient" },
+        { 0x49000C, "SMSG_COMPRESSED_PACKET", "ServerToClient" },
+        { 0x4202BC, "SMSG_CONFIRM_PARTY_INVITE", "ServerToClient" },
+        { 0x490007, "SMSG_CONNECT_TO", "ServerToClient" },
+        { 0x4200DD, "SMSG_CONSOLE_WRITE", "ServerToClient" },
+        { 0x420281, "SMSG_CONSUMABLE_TOKEN_BUY_AT_MARKET_PRICE_RESPONSE", "ServerToClient" },
+        { 0x420280, "SMSG_CONSUMABLE_TOKEN_BUY_CHOICE_REQUIRED", "ServerToClient" },
+        { 0x42027F, "SMSG_CONSUMABLE_TOKEN_CAN_VETERAN_BUY_RESPONSE", "ServerToClient" },
+        { 0x420283, "SMSG_CONSUMABLE_TOKEN_REDEEM_CONFIRM_REQUIRED", "ServerToClient" },
+        { 0x420284, "SMSG_CONSUMABLE_TOKEN_REDEEM_RESPONSE", "ServerToClient" },
+        { 0x420234, "SMSG_CONTACT_LIST", "ServerToClient" },
+        { 0x4202C4, "SMSG_CONTRIBUTION_LAST_UPDATE_RESPONSE", "ServerToClient" },
+        { 0x4200EF, "SMSG_CONTROL_UPDATE", "ServerToClient" },
+        { 0x42030C, "SMSG_CONVERT_ITEMS_TO_CURRENCY_VALUE", "ServerToClient" },
+        { 0x4201E1, "SMSG_COOLDOWN_CHEAT", "ServerToClient" },
+        { 0x420163, "SMSG_COOLDOWN_EVENT", "ServerToClient" },
+        { 0x4200F6, "SMSG_CORPSE_LOCATION", "ServerToClient" },
+        { 0x4201F2, "SMSG_CORPSE_RECLAIM_DELAY", "ServerToClient" },
+        { 0x4201BC, "SMSG_CORPSE_TRANSPORT_QUERY", "ServerToClient" },
+        { 0x600024, "SMSG_COVENANT_CALLINGS_AVAILABILITY_RESPONSE", "ServerToClient" },
+        { 0x4202A5, "SMSG_COVENANT_PREVIEW_OPEN_NPC", "ServerToClient" },
+        { 0x42030D, "SMSG_COVENANT_RENOWN_SEND_CATCHUP_STATE", "ServerToClient" },
+        { 0x42033B, "SMSG_CRAFT_ENCHANT_RESULT", "ServerToClient" },
+        { 0x42033C, "SMSG_CRAFTING_HOUSE_HELLO_RESPONSE", "ServerToClient" },
+        { 0x420338, "SMSG_CRAFTING_ORDER_CANCEL_RESULT", "ServerToClient" },
+        { 0x420334, "SMSG_CRAFTING_ORDER_CLAIM_RESULT", "ServerToClient" },
+        { 0x420336, "SMSG_CRAFTING_ORDER_CRAFT_RESULT", "ServerToClient" },
+        { 0x420332, "SMSG_CRAFTING_ORDER_CREATE_RESULT", "ServerToClient" },
+        { 0x420337, "SMSG_CRAFTING_ORDER_FULFILL_RESULT", "ServerToClient" },
+        { 0x420333, "SMSG_CRAFTING_ORDER_LIST_ORDERS_RESPONSE", "ServerToClient" },
+        { 0x42033E, "SMSG_CRAFTING_ORDER_NPC_REWARD_INFO", "ServerToClient" },
+        { 0x42033A, "SMSG_CRAFTING_ORDER_REJECT_RESULT", "ServerToClient" },
+        { 0x420335, "SMSG_CRAFTING_ORDER_RELEASE_RESULT", "ServerToClient" },
+        { 0x42033D, "SMSG_CRAFTING_ORDER_UPDATE_STATE", "ServerToClient" },
+        { 0x4201AA, "SMSG_CREATE_CHAR", "ServerToClient" },
+        { 0x420245, "SMSG_CREATE_SHIPMENT_RESPONSE", "ServerToClient" },
+        { 0x420341, "SMSG_CREATOR_VISUALS_OVERRIDE", "ServerToClient" },
+        { 0x420190, "SMSG_CRITERIA_DELETED", "ServerToClient" },
+        { 0x42018A, "SMSG_CRITERIA_UPDATE", "ServerToClient" },
+        { 0x42016B, "SMSG_CROSSED_INEBRIATION_THRESHOLD", "ServerToClient" },
+        { 0x420352, "SMSG_CURRENCY_TRANSFER_LOG", "ServerToClient" },
+        { 0x420351, "SMSG_CURRENCY_TRANSFER_RESULT", "ServerToClient" },
+        { 0x42006E, "SMSG_CUSTOM_LOAD_SCREEN", "ServerToClient" },
+        { 0x600000, "SMSG_DAILY_QUESTS_RESET", "ServerToClient" },
+        { 0x620056, "SMSG_DAMAGE_CALC_LOG", "ServerToClient" },
+        { 0x460000, "SMSG_DB_REPLY", "ServerToClient" },
+        { 0x42017D, "SMSG_DEATH_RELEASE_LOC", "ServerToClient" },
+        { 0x4200FE, "SMSG_DEBUG_MENU_MANAGER_FULL_UPDATE", "ServerToClient" },
+        { 0x47000C, "SMSG_DEFENSE_MESSAGE", "ServerToClient" },
+        { 0x4201AB, "SMSG_DELETE_CHAR", "ServerToClient" },
+        { 0x4C0022, "SMSG_DELETE_EXPIRED_MISSIONS_RESULT", "ServerToClient" },
+        { 0x420357, "SMSG_DELVES_ACCOUNT_DATA_ELEMENT_CHANGED", "ServerToClient" },
+        { 0x4201EA, "SMSG_DESTROY_ARENA_UNIT", "ServerToClient" },
+        { 0x4201A2, "SMSG_DESTRUCTIBLE_BUILDING_DAMAGE", "ServerToClient" },
+        { 0x420020, "SMSG_DIFFERENT_INSTANCE_FROM_PARTY", "ServerToClient" },
+        { 0x42003F, "SMSG_DISENCHANT_CREDIT", "ServerToClient" },
+        { 0x420010, "SMSG_DISMOUNT_RESULT", "ServerToClient" },
+        { 0x62001E, "SMSG_DISPEL_FAILED", "ServerToClient" },
+        { 0x420035, "SMSG_DISPLAY_GAME_ERROR", "ServerToClient" },
+        { 0x5F0004, "SMSG_DISPLAY_PLAYER_CHOICE", "ServerToClient" },
+        { 0x4200F3, "SMSG_DISPLAY_PROMOTION", "ServerToClient" },
+        { 0x60001E, "SMSG_DISPLAY_QUEST_POPUP", "ServerToClient" },
+        { 0x4200CC, "SMSG_DISPLAY_TOAST", "ServerToClient" },
+        { 0x420296, "SMSG_DISPLAY_WORLD_TEXT", "ServerToClient" },
+        { 0x620055, "SMSG_DISPLAY_WORLD_TEXT_ON_TARGET", "ServerToClient" },
+        { 0x420083, "SMSG_DONT_AUTO_PUSH_SPELLS_TO_ACTION_BAR", "ServerToClient" },
+        { 0x490006, "SMSG_DROP_NEW_CONNECTION", "ServerToClient" },
+        { 0x48001B, "SMSG_DUEL_ARRANGED", "ServerToClient" },
+        { 0x48001F, "SMSG_DUEL_COMPLETE", "ServerToClient" },
+        { 0x48001E, "SMSG_DUEL_COUNTDOWN", "ServerToClient" },
+        { 0x48001D, "SMSG_DUEL_IN_BOUNDS", "ServerToClient" },
+        { 0x48001C, "SMSG_DUEL_OUT_OF_BOUNDS", "ServerToClient" },
+        { 0x48001A, "SMSG_DUEL_REQUESTED", "ServerToClient" },
+        { 0x480020, "SMSG_DUEL_WINNER", "ServerToClient" },
+        { 0x4201ED, "SMSG_DURABILITY_DAMAGE_DEATH", "ServerToClient" },
+        { 0x420271, "SMSG_EMOTE", "ServerToClient" },
+        { 0x420166, "SMSG_ENABLE_BARBER_SHOP", "ServerToClient" },
+        { 0x4201BD, "SMSG_ENCHANTMENT_LOG", "ServerToClient" },
+        { 0x420227, "SMSG_ENCOUNTER_END", "ServerToClient" },
+        { 0x420226, "SMSG_ENCOUNTER_START", "ServerToClient" },
+        { 0x420152, "SMSG_END_LIGHTNING_STORM", "ServerToClient" },
+        { 0x490003, "SMSG_ENTER_ENCRYPTED_MODE", "ServerToClient" },
+        { 0x420018, "SMSG_ENUM_CHARACTERS_RESULT", "ServerToClient" },
+        { 0x42029B, "SMSG_ENUM_VAS_PURCHASE_STATES_RESPONSE", "ServerToClient" },
+        { 0x62000E, "SMSG_ENVIRONMENTAL_DAMAGE_LOG", "ServerToClient" },
+        { 0x42015B, "SMSG_EQUIPMENT_SET_ID", "ServerToClient" },
+        { 0x470005, "SMSG_EXPECTED_SPAM_RECORDS", "ServerToClient" },
+        { 0x420207, "SMSG_EXPLORATION_EXPERIENCE", "ServerToClient" },
+        { 0x4200FB, "SMSG_EXPORT_ACCOUNT_PROFILE", "ServerToClient" },
+        { 0x42030A, "SMSG_EXTERNAL_TRANSACTION_ID_GENERATED", "ServerToClient" },
+        { 0x4201CD, "SMSG_FACTION_BONUS_INFO", "ServerToClient" },
+        { 0x5F0002, "SMSG_FAILED_PLAYER_CONDITION", "ServerToClient" },
+        { 0x4202B9, "SMSG_FAILED_QUEST_TURN_IN", "ServerToClient" },
+        { 0x420062, "SMSG_FEATURE_SYSTEM_STATUS", "ServerToClient" },
+        { 0x420063, "SMSG_FEATURE_SYSTEM_STATUS_GLUE_SCREEN", "ServerToClient" },
+        { 0x4201EC, "SMSG_FEIGN_DEATH_RESISTED", "ServerToClient" },
+        { 0x42017A, "SMSG_FISH_ESCAPED", "ServerToClient" },
+        { 0x420179, "SMSG_FISH_NOT_HOOKED", "ServerToClient" },
+        { 0x5A005D, "SMSG_FLIGHT_SPLINE_SYNC", "ServerToClient" },
+        { 0x620010, "SMSG_FLUSH_COMBAT_LOG_FILE", "ServerToClient" },
+        { 0x4201F9, "SMSG_FORCE_ANIM", "ServerToClient" },
+        { 0x4201FA, "SMSG_FORCE_ANIMATIONS", "ServerToClient" },
+        { 0x42017E, "SMSG_FORCED_DEATH_UPDATE", "ServerToClient" },
+        { 0x42004E, "SMSG_FORCE_RANDOM_TRANSMOG_TOAST", "ServerToClient" },
+        { 0x600021, "SMSG_FORCE_SPAWN_TRACKING_UPDATE", "ServerToClient" },
+        { 0x420235, "SMSG_FRIEND_STATUS", "ServerToClient" },
+        { 0x42028A, "SMSG_GAIN_MAW_POWER", "ServerToClient" },
+        { 0x420066, "SMSG_GAME_OBJECT_ACTIVATE_ANIM_KIT", "ServerToClient" },
+        { 0x4202D1, "SMSG_GAME_OBJECT_BASE", "ServerToClient" },
+        { 0x42031A, "SMSG_GAME_OBJECT_CLOSE_INTERACTION", "ServerToClient" },
+        { 0x420067, "SMSG_GAME_OBJECT_CUSTOM_ANIM", "ServerToClient" },
+        { 0x420068, "SMSG_GAME_OBJECT_DESPAWN", "ServerToClient" },
+        { 0x420319, "SMSG_GAME_OBJECT_INTERACTION", "ServerToClient" },
+        { 0x62003E, "SMSG_GAME_OBJECT_PLAY_SPELL_VISUAL", "ServerToClient" },
+        { 0x62003D, "SMSG_GAME_OBJECT_PLAY_SPELL_VISUAL_KIT", "ServerToClient" },
+        { 0x4201C7, "SMSG_GAME_OBJECT_RESET_STATE", "ServerToClient" },
+        { 0x4202AC, "SMSG_GAME_OBJECT_SET_STATE_LOCAL", "ServerToClient" },
+        { 0x42012B, "SMSG_GAME_SPEED_SET", "ServerToClient" },
+        { 0x4201B6, "SMSG_GAME_TIME_SET", "ServerToClient" },
+        { 0x4201B5, "SMSG_GAME_TIME_UPDATE", "ServerToClient" },
+        { 0x4C0024, "SMSG_GARRISON_ACTIVATE_MISSION_BONUS_ABILITY", "ServerToClient" },
+        { 0x4C0048, "SMSG_GARRISON_ADD_EVENT", "ServerToClient" },
+        { 0x4C0016, "SMSG_GARRISON_ADD_FOLLOWER_RESULT", "ServerToClient" },
+        { 0x4C001A, "SMSG_GARRISON_ADD_MISSION_RESULT", "ServerToClient" },
+        { 0x4C004B, "SMSG_GARRISON_ADD_SPEC_GROUPS", "ServerToClient" },
+        { 0x4C004F, "SMSG_GARRISON_APPLY_TALENT_SOCKET_DATA_CHANGES", "ServerToClient" },
+        { 0x4C002C, "SMSG_GARRISON_ASSIGN_FOLLOWER_TO_BUILDING_RESULT", "ServerToClient" },
+        { 0x4C0051, "SMSG_GARRISON_AUTO_TROOP_MIN_LEVEL_UPDATE_RESULT", "ServerToClient" },
+        { 0x4C000B, "SMSG_GARRISON_BUILDING_ACTIVATED", "ServerToClient" },
+        { 0x4C0004, "SMSG_GARRISON_BUILDING_REMOVED", "ServerToClient" },
+        { 0x4C0006, "SMSG_GARRISON_BUILDING_SET_ACTIVE_SPECIALIZATION_RESULT", "ServerToClient" },
+        { 0x4C001D, "SMSG_GARRISON_CHANGE_MISSION_START_TIME_RESULT", "ServerToClient" },
+        { 0x4C0047, "SMSG_GARRISON_CLEAR_COLLECTION", "ServerToClient" },
+        { 0x4C004A, "SMSG_GARRISON_CLEAR_EVENT_LIST", "ServerToClient" },
+        { 0x4C004C, "SMSG_GARRISON_CLEAR_SPEC_GROUPS", "ServerToClient" },
+        { 0x4C0046, "SMSG_GARRISON_COLLECTION_REMOVE_ENTRY", "ServerToClient" },
+        { 0x4C0045, "SMSG_GARRISON_COLLECTION_UPDATE_ENTRY", "ServerToClient" },
+        { 0x4C003D, "SMSG_GARRISON_COMPLETE_BUILDING_CONSTRUCTION_RESULT", "ServerToClient" },
+        { 0x4C001C, "SMSG_GARRISON_COMPLETE_MISSION_RESULT", "ServerToClient" },
+        { 0x4C000C, "SMSG_GARRISON_CREATE_RESULT", "ServerToClient" },
+        { 0x4C0023, "SMSG_GARRISON_DELETE_MISSION_RESULT", "ServerToClient" },
+        { 0x4C0035, "SMSG_GARRISON_DELETE_RESULT", "ServerToClient" },
+        { 0x4C002B, "SMSG_GARRISON_FOLLOWER_ACTIVATIONS_SET", "ServerToClient" },
+        { 0x4C0029, "SMSG_GARRISON_FOLLOWER_CHANGED_FLAGS", "ServerToClient" },
+        { 0x4C0027, "SMSG_GARRISON_FOLLOWER_CHANGED_ITEM_LEVEL", "ServerToClient" },
+        { 0x4C0028, "SMSG_GARRISON_FOLLOWER_CHANGED_QUALITY", "ServerToClient" },
+        { 0x4C0026, "SMSG_GARRISON_FOLLOWER_CHANGED_XP", "ServerToClient" },
+        { 0x4C002A, "SMSG_GARRISON_FOLLOWER_FATIGUE_CLEARED", "ServerToClient" },
+        { 0x4C0033, "SMSG_GARRISON_GENERATE_FOLLOWERS_RESULT", "ServerToClient" },
+        { 0x4C0015, "SMSG_GARRISON_GET_CLASS_SPEC_CATEGORY_INFO_RESULT", "ServerToClient" },
+        { 0x4C001E, "SMSG_GARRISON_GET_RECALL_PORTAL_LAST_USED_TIME_RESULT", "ServerToClient" },
+        { 0x4C003F, "SMSG_GARRISON_IS_UPGRADEABLE_RESPONSE", "ServerToClient" },
+        { 0x4C0007, "SMSG_GARRISON_LEARN_BLUEPRINT_RESULT", "ServerToClient" },
+        { 0x4C0005, "SMSG_GARRISON_LEARN_SPECIALIZATION_RESULT", "ServerToClient" },
+        { 0x4C0040, "SMSG_GARRISON_LIST_COMPLETED_MISSIONS_CHEAT_RESULT", "ServerToClient" },
+        { 0x4C0019, "SMSG_GARRISON_LIST_FOLLOWERS_CHEAT_RESULT", "ServerToClient" },
+        { 0x4C0042, "SMSG_GARRISON_MAP_DATA_RESPONSE", "ServerToClient" },
+        { 0x4C0020, "SMSG_GARRISON_MISSION_BONUS_ROLL_RESULT", "ServerToClient" },
+        { 0x4C0043, "SMSG_GARRISON_MISSION_REQUEST_REWARD_INFO_RESPONSE", "ServerToClient" },
+        { 0x4C0025, "SMSG_GARRISON_MISSION_START_CONDITION_UPDATE", "ServerToClient" },
+        { 0x4C0037, "SMSG_GARRISON_OPEN_CRAFTER", "ServerToClient" },
+        { 0x4C0030, "SMSG_GARRISON_OPEN_RECRUITMENT_NPC", "ServerToClient" },
+        { 0x4C0003, "SMSG_GARRISON_PLACE_BUILDING_RESULT", "ServerToClient" },
+        { 0x4C0001, "SMSG_GARRISON_PLOT_PLACED", "ServerToClient" },
+        { 0x4C0002, "SMSG_GARRISON_PLOT_REMOVED", "ServerToClient" },
+        { 0x4C0034, "SMSG_GARRISON_RECRUIT_FOLLOWER_RESULT", "ServerToClient" },
+        { 0x4C000A, "SMSG_GARRISON_REMOTE_INFO", "ServerToClient" },
+        { 0x4C0049, "SMSG_GARRISON_REMOVE_EVENT", "ServerToClient" },
+        { 0x4C002F, "SMSG_GARRISON_REMOVE_FOLLOWER_ABILITY_RESULT", "ServerToClient" },
+        { 0x4C002D, "SMSG_GARRISON_REMOVE_FOLLOWER_FROM_BUILDING_RESULT", "ServerToClient" },
+        { 0x4C0017, "SMSG_GARRISON_REMOVE_FOLLOWER_RESULT", "ServerToClient" },
+        { 0x4C002E, "SMSG_GARRISON_RENAME_FOLLOWER_RESULT", "ServerToClient" },
+        { 0x4C0009, "SMSG_GARRISON_REQUEST_BLUEPRINT_AND_SPECIALIZATION_DATA_RESULT", "ServerToClient" },
+        { 0x4C000E, "SMSG_GARRISON_RESEARCH_TALENT_RESULT", "ServerToClient" },
+        { 0x4C0013, "SMSG_GARRISON_RESET_TALENT_TREE", "ServerToClient" },
+        { 0x4C0014, "SMSG_GARRISON_RESET_TALENT_TREE_SOCKET_DATA", "ServerToClient" },
+        { 0x4C001B, "SMSG_GARRISON_START_MISSION_RESULT", "ServerToClient" },
+        { 0x4C003C, "SMSG_GARRISON_SWAP_BUILDINGS_RESPONSE", "ServerToClient" },
+        { 0x4C004D, "SMSG_GARRISON_SWITCH_TALENT_TREE_BRANCH", "ServerToClient" },
+        { 0x4C000F, "SMSG_GARRISON_TALENT_COMPLETED", "ServerToClient" },
+        { 0x4C0010, "SMSG_GARRISON_TALENT_REMOVED", "ServerToClient" },
+        { 0x4C0012, "SMSG_GARRISON_TALENT_REMOVE_SOCKET_DATA", "ServerToClient" },
+        { 0x4C0011, "SMSG_GARRISON_TALENT_UPDATE_SOCKET_DATA", "ServerToClient" },
+        { 0x4C004E, "SMSG_GARRISON_TALENT_WORLD_QUEST_UNLOCKS_RESPONSE", "ServerToClient" },
+        { 0x4C0008, "SMSG_GARRISON_UNLEARN_BLUEPRINT_RESULT", "ServerToClient" },
+        { 0x4C0018, "SMSG_GARRISON_UPDATE_FOLLOWER", "ServerToClient" },
+        { 0x4C003E, "SMSG_GARRISON_UPDATE_GARRISON_MONUMENT_SELECTIONS", "ServerToClient" },
+        { 0x4C0050, "SMSG_GARRISON_UPDATE_MISSION_CHEAT_RESULT", "ServerToClient" },
+        { 0x4C000D, "SMSG_GARRISON_UPGRADE_RESULT", "ServerToClient" },
+        { 0x4C001F, "SMSG_GARRISON_USE_RECALL_PORTAL_RESULT", "ServerToClient" },
+        { 0x42001C, "SMSG_GENERATE_RANDOM_CHARACTER_NAME_RESULT", "ServerToClient" },
+        { 0x4202C5, "SMSG_GENERATE_SSO_TOKEN_RESPONSE", "ServerToClient" },
+        { 0x420209, "SMSG_GET_ACCOUNT_CHARACTER_LIST_RESULT", "ServerToClient" },
+        { 0x420377, "SMSG_GET_ALL_LICENSED_DECOR_QUANTITIES_RESPONSE", "ServerToClient" },
+        { 0x420372, "SMSG_GET_DECOR_REFUND_LIST_RESPONSE", "ServerToClient" },
+        { 0x4C0000, "SMSG_GET_GARRISON_INFO_RESULT", "ServerToClient" },
+        { 0x420366, "SMSG_GET_INITIATIVE_ACTIVITY_LOG_RESULT", "ServerToClient" },
+        { 0x420367, "SMSG_GET_INITIATIVE_REWARDS_RESULT", "ServerToClient" },
+        { 0x420248, "SMSG_GET_LANDING_PAGE_SHIPMENTS_RESPONSE", "ServerToClient" },
+        { 0x420365, "SMSG_GET_PLAYER_INITIATIVE_INFO_RESULT", "ServerToClient" },
+        { 0x420347, "SMSG_GET_REALM_HIDDEN_RESULT", "ServerToClient" },
+        { 0x420282, "SMSG_GET_REMAINING_GAME_TIME_RESPONSE", "ServerToClient" },
+        { 0x42026F, "SMSG_GET_SELECTED_TROPHY_ID_RESPONSE", "ServerToClient" },
+        { 0x420243, "SMSG_GET_SHIPMENT_INFO_RESPONSE", "ServerToClient" },
+        { 0x420247, "SMSG_GET_SHIPMENTS_OF_TYPE_RESPONSE", "ServerToClient" },
+        { 0x42026E, "SMSG_GET_TROPHY_LIST_RESPONSE", "ServerToClient" },
+        { 0x420297, "SMSG_GET_VAS_ACCOUNT_CHARACTER_LIST_RESULT", "ServerToClient" },
+        { 0x420298, "SMSG_GET_VAS_TRANSFER_TARGET_REALM_LIST_RESULT", "ServerToClient" },
+        { 0x5F000E, "SMSG_GM_PLAYER_INFO", "ServerToClient" },
+        { 0x5F0003, "SMSG_GM_REQUEST_PLAYER_INFO", "ServerToClient" },
+        { 0x42014D, "SMSG_GM_TICKET_CASE_STATUS", "ServerToClient" },
+        { 0x42014C, "SMSG_GM_TICKET_SYSTEM_STATUS", "ServerToClient" },
+        { 0x4201A5, "SMSG_GOD_MODE", "ServerToClient" },
+        { 0x600017, "SMSG_GOSSIP_COMPLETE", "ServerToClient" },
+        { 0x600018, "SMSG_GOSSIP_MESSAGE", "ServerToClient" },
+        { 0x600028, "SMSG_GOSSIP_OPTION_NPC_INTERACTION", "ServerToClient" },
+        { 0x420240, "SMSG_GOSSIP_POI", "ServerToClient" },
+        { 0x600019, "SMSG_GOSSIP_QUEST_UPDATE", "ServerToClient" },
+        { 0x600027, "SMSG_GOSSIP_REFRESH_OPTIONS", "ServerToClient" },
+        { 0x420024, "SMSG_GROUP_ACTION_THROTTLED", "ServerToClient" },
+        { 0x42023D, "SMSG_GROUP_AUTO_KICK", "ServerToClient" },
+        { 0x420239, "SMSG_GROUP_DECLINE", "ServerToClient" },
+        { 0x42023C, "SMSG_GROUP_DESTROYED", "ServerToClient" },
+        { 0x4200D5, "SMSG_GROUP_NEW_LEADER", "ServerToClient" },
+        { 0x42023A, "SMSG_GROUP_REQUEST_DECLINE", "ServerToClient" },
+        { 0x42023B, "SMSG_GROUP_UNINVITE", "ServerToClient" },
+        { 0x4E000D, "SMSG_GUILD_ACHIEVEMENT_DELETED", "ServerToClient" },
+        { 0x4E000C, "SMSG_GUILD_ACHIEVEMENT_EARNED", "ServerToClient" },
+        { 0x4E000F, "SMSG_GUILD_ACHIEVEMENT_MEMBERS", "ServerToClient" },
+        { 0x4E0027, "SMSG_GUILD_BANK_LOG_QUERY_RESULTS", "ServerToClient" },
+        { 0x4E0026, "SMSG_GUILD_BANK_QUERY_RESULTS", "ServerToClient" },
+        { 0x4E0028, "SMSG_GUILD_BANK_REMAINING_WITHDRAW_MONEY", "ServerToClient" },
+        { 0x4E002B, "SMSG_GUILD_BANK_TEXT_QUERY_RESULT", "ServerToClient" },
+        { 0x4E001B, "SMSG_GUILD_CHALLENGE_COMPLETED", "ServerToClient" },
+        { 0x4E001A, "SMSG_GUILD_CHALLENGE_UPDATE", "ServerToClient" },
+        { 0x4E0025, "SMSG_GUILD_CHANGE_NAME_RESULT", "ServerToClient" },
+        { 0x4E0002, "SMSG_GUILD_COMMAND_RESULT", "ServerToClient" },
+        { 0x4E000E, "SMSG_GUILD_CRITERIA_DELETED", "ServerToClient" },
+        { 0x4E000B, "SMSG_GUILD_CRITERIA_UPDATE", "ServerToClient" },
+        { 0x4E0040, "SMSG_GUILD_EVENT_BANK_CONTENTS_CHANGED", "ServerToClient" },
+        { 0x4E003F, "SMSG_GUILD_EVENT_BANK_MONEY_CHANGED", "ServerToClient" },
+        { 0x4E0035, "SMSG_GUILD_EVENT_DISBANDED", "ServerToClient" },
+        { 0x4E002A, "SMSG_GUILD_EVENT_LOG_QUERY_RESULTS", "ServerToClient" },
+        { 0x4E0036, "SMSG_GUILD_EVENT_MOTD", "ServerToClient" },
+        { 0x4E0034, "SMSG_GUILD_EVENT_NEW_LEADER", "ServerToClient" },
+        { 0x4E0032, "SMSG_GUILD_EVENT_PLAYER_JOINED", "ServerToClient" },
+        { 0x4E0033, "SMSG_GUILD_EVENT_PLAYER_LEFT", "ServerToClient" },
+        { 0x4E0037, "SMSG_GUILD_EVENT_PRESENCE_CHANGE", "ServerToClient" },
+        { 0x4E003A, "SMSG_GUILD_EVENT_RANK_CHANGED", "ServerToClient" },
+        { 0x4E0039, "SMSG_GUILD_EVENT_RANKS_UPDATED", "ServerToClient" },
+        { 0x4E0038, "SMSG_GUILD_EVENT_STATUS_CHANGE", "ServerToClient" },
+        { 0x4E003B, "SMSG_GUILD_EVENT_TAB_ADDED", "ServerToClient" },
+        { 0x4E003C, "SMSG_GUILD_EVENT_TAB_DELETED", "ServerToClient" },
+        { 0x4E003D, "SMSG_GUILD_EVENT_TAB_MODIFIED", "ServerToClient" },
+        { 0x4E003E, "SMSG_GUILD_EVENT_TAB_TEXT_CHANGED", "ServerToClient" },
+        { 0x4E0024, "SMSG_GUILD_FLAGGED_FOR_RENAME", "ServerToClient" },
+        { 0x4E0004, "SMSG_GUILD_HARDCORE_MEMBER_DEATH", "ServerToClient" },
+        { 0x4E0012, "SMSG_GUILD_INVITE", "ServerToClient" },
+        { 0x4E0030, "SMSG_GUILD_INVITE_DECLINED", "ServerToClient" },
+        { 0x4E0031, "SMSG_GUILD_INVITE_EXPIRED", "ServerToClient" },
+        { 0x4E001C, "SMSG_GUILD_ITEM_LOOTED_NOTIFY", "ServerToClient" },
+        { 0x4E0006, "SMSG_GUILD_KNOWN_RECIPES", "ServerToClient" },
+        { 0x4E002C, "SMSG_GUILD_MEMBER_DAILY_RESET", "ServerToClient" },
+        { 0x4E0005, "SMSG_GUILD_MEMBER_RECIPES", "ServerToClient" },
+        { 0x4E0007, "SMSG_GUILD_MEMBERS_WITH_RECIPE", "ServerToClient" },
+        { 0x4E0011, "SMSG_GUILD_MEMBER_UPDATE_NOTE", "ServerToClient" },
+        { 0x4E0022, "SMSG_GUILD_MOVED", "ServerToClient" },
+        { 0x4E0021, "SMSG_GUILD_MOVE_STARTING", "ServerToClient" },
+        { 0x4E0023, "SMSG_GUILD_NAME_CHANGED", "ServerToClient" },
+        { 0x4E0009, "SMSG_GUILD_NEWS", "ServerToClient" },
+        { 0x4E000A, "SMSG_GUILD_NEWS_DELETED", "ServerToClient" },
+        { 0x4E0047, "SMSG_GUILD_OTHERS_OWNED_HOUSES_RESULT", "ServerToClient" },
+        { 0x4E0013, "SMSG_GUILD_PARTY_STATE", "ServerToClient" },
+        { 0x4E0029, "SMSG_GUILD_PERMISSIONS_QUERY_RESULTS", "ServerToClient" },
+        { 0x4E0010, "SMSG_GUILD_RANKS", "ServerToClient" },
+        { 0x4E0044, "SMSG_GUILD_RENAME_NAME_CHECK", "ServerToClient" },
+        { 0x4E0046, "SMSG_GUILD_RENAME_REFUND_RESULT", "ServerToClient" },
+        { 0x4E0045, "SMSG_GUILD_RENAME_REQUESTED_RESULT", "ServerToClient" },
+        { 0x4E0043, "SMSG_GUILD_RENAME_STATUS_UPDATE", "ServerToClient" },
+        { 0x4E0014, "SMSG_GUILD_REPUTATION_REACTION_CHANGED", "ServerToClient" },
+        { 0x4E0020, "SMSG_GUILD_RESET", "ServerToClient" },
+        { 0x4E0008, "SMSG_GUILD_REWARD_LIST", "ServerToClient" },
+        { 0x4E0003, "SMSG_GUILD_ROSTER", "ServerToClient" },
+        { 0x4E0001, "SMSG_GUILD_SEND_RANK_CHANGE", "ServerToClient" },
+        { 0x42034F, "SMSG_HARDCORE_DEATH_ALERT", "ServerToClient" },
+        { 0x42017B, "SMSG_HEALTH_UPDATE", "ServerToClient" },
+        { 0x420183, "SMSG_HIGHEST_THREAT_UPDATE", "ServerToClient" },
+        { 0x460003, "SMSG_HOTFIX_CONNECT", "ServerToClient" },
+        { 0x460002, "SMSG_HOTFIX_MESSAGE", "ServerToClient" },
+        { 0x500000, "SMSG_HOUSE_EXTERIOR_LOCK_RESPONSE", "ServerToClient" },
+        { 0x500001, "SMSG_HOUSE_EXTERIOR_SET_HOUSE_POSITION_RESPONSE", "ServerToClient" },
+        { 0x510007, "SMSG_HOUSING_DECOR_ADD_TO_HOUSE_CHEST_RESPONSE", "ServerToClient" },
+        { 0x510005, "SMSG_HOUSING_DECOR_DELETE_FROM_STORAGE_RESPONSE", "ServerToClient" },
+        { 0x510004, "SMSG_HOUSING_DECOR_LOCK_RESPONSE", "ServerToClient" },
+        { 0x510001, "SMSG_HOUSING_DECOR_MOVE_RESPONSE", "ServerToClient" },
+        { 0x510002, "SMSG_HOUSING_DECOR_PLACE_RESPONSE", "ServerToClient" },
+        { 0x510003, "SMSG_HOUSING_DECOR_REMOVE_RESPONSE", "ServerToClient" },
+        { 0x510006, "SMSG_HOUSING_DECOR_REQUEST_STORAGE_RESPONSE", "ServerToClient" },
+        { 0x510000, "SMSG_HOUSING_DECOR_SET_EDIT_MODE_RESPONSE", "ServerToClient" },
+        { 0x510008, "SMSG_HOUSING_DECOR_SYSTEM_SET_DYE_SLOTS_RESPONSE", "ServerToClient" },
+        { 0x550003, "SMSG_HOUSING_EXPORT_HOUSE_RESPONSE", "ServerToClient" },
+        { 0x51000A, "SMSG_HOUSING_FIRST_TIME_DECOR_ACQUISITION", "ServerToClient" },
+        { 0x520001, "SMSG_HOUSING_FIXTURE_CREATE_BASIC_HOUSE_RESPONSE", "ServerToClient" },
+        { 0x520006, "SMSG_HOUSING_FIXTURE_CREATE_FIXTURE_RESPONSE", "ServerToClient" },
+        { 0x520007, "SMSG_HOUSING_FIXTURE_DELETE_FIXTURE_RESPONSE", "ServerToClient" },
+        { 0x520002, "SMSG_HOUSING_FIXTURE_DELETE_HOUSE_RESPONSE", "ServerToClient" },
+        { 0x520005, "SMSG_HOUSING_FIXTURE_SET_CORE_FIXTURE_RESPONSE", "ServerToClient" },
+        { 0x520000, "SMSG_HOUSING_FIXTURE_SET_EDIT_MODE_RESPONSE", "ServerToClient" },
+        { 0x520003, "SMSG_HOUSING_FIXTURE_SET_HOUSE_SIZE_RESPONSE", "ServerToClient" },
+        { 0x520004, "SMSG_HOUSING_FIXTURE_SET_HOUSE_TYPE_RESPONSE", "ServerToClient" },
+        { 0x550001, "SMSG_HOUSING_GET_CURRENT_HOUSE_INFO_RESPONSE", "ServerToClient" },
+        { 0x550006, "SMSG_HOUSING_GET_PLAYER_PERMISSIONS_RESPONSE", "ServerToClient" },
+        { 0x550000, "SMSG_HOUSING_HOUSE_STATUS_RESPONSE", "ServerToClient" },
+        { 0x510009, "SMSG_HOUSING_REDEEM_DEFERRED_DECOR_RESPONSE", "ServerToClient" },
+        { 0x550007, "SMSG_HOUSING_RESET_KIOSK_MODE_RESPONSE", "ServerToClient" },
+        { 0x530001, "SMSG_HOUSING_ROOM_ADD_RESPONSE", "ServerToClient" },
+        { 0x530005, "SMSG_HOUSING_ROOM_APPLY_COMPONENT_MATERIALS_RESPONSE", "ServerToClient" },
+        { 0x530002, "SMSG_HOUSING_ROOM_REMOVE_RESPONSE", "ServerToClient" },
+        { 0x530007, "SMSG_HOUSING_ROOM_SET_CEILING_TYPE_RESPONSE", "ServerToClient" },
+        { 0x530004, "SMSG_HOUSING_ROOM_SET_COMPONENT_THEME_RESPONSE", "ServerToClient" },
+        { 0x530006, "SMSG_HOUSING_ROOM_SET_DOOR_TYPE_RESPONSE", "ServerToClient" },
+        { 0x530000, "SMSG_HOUSING_ROOM_SET_LAYOUT_EDIT_MODE_RESPONSE", "ServerToClient" },
+        { 0x530003, "SMSG_HOUSING_ROOM_UPDATE_RESPONSE", "ServerToClient" },
+        { 0x540021, "SMSG_HOUSING_SVC_REQUEST_PLAYER_RELOAD_DATA", "ServerToClient" },
+        { 0x540018, "SMSG_HOUSING_SVCS_ACCEPT_NEIGHBORHOOD_OWNERSHIP_RESPONSE", "ServerToClient" },
+        { 0x540008, "SMSG_HOUSING_SVCS_CANCEL_RELINQUISH_HOUSE_RESPONSE", "ServerToClient" },
+        { 0x540011, "SMSG_HOUSING_SVCS_CHANGE_HOUSE_COSMETIC_OWNER", "ServerToClient" },
+        { 0x540005, "SMSG_HOUSING_SVCS_CLEAR_PLOT_RESERVATION_RESPONSE", "ServerToClient" },
+        { 0x540003, "SMSG_HOUSING_SVCS_CREATE_CHARTER_NEIGHBORHOOD_RESPONSE", "ServerToClient" },
+        { 0x540022, "SMSG_HOUSING_SVCS_DELETE_ALL_NEIGHBORHOOD_INVITES_RESPONSE", "ServerToClient" },
+        { 0x54001F, "SMSG_HOUSING_SVCS_GET_BNET_FRIEND_NEIGHBORHOODS_RESPONSE", "ServerToClient" },
+        { 0x54001D, "SMSG_HOUSING_SVCS_GET_HOUSE_FINDER_INFO_RESPONSE", "ServerToClient" },
+        { 0x54001E, "SMSG_HOUSING_SVCS_GET_HOUSE_FINDER_NEIGHBORHOOD_RESPONSE", "ServerToClient" },
+        { 0x54000C, "SMSG_HOUSING_SVCS_GET_PLAYER_HOUSES_INFO_RESPONSE", "ServerToClient" },
+        { 0x54001B, "SMSG_HOUSING_SVCS_GET_POTENTIAL_HOUSE_OWNERS_RESPONSE", "ServerToClient" },
+        { 0x540013, "SMSG_HOUSING_SVCS_GUILD_ADD_HOUSE_NOTIFICATION", "ServerToClient" },
+        { 0x540015, "SMSG_HOUSING_SVCS_GUILD_APPEND_NEIGHBORHOOD_NOTIFICATION", "ServerToClient" },
+        { 0x540001, "SMSG_HOUSING_SVCS_GUILD_CREATE_NEIGHBORHOOD_NOTIFICATION", "ServerToClient" },
+        { 0x540017, "SMSG_HOUSING_SVCS_GUILD_GET_HOUSING_INFO_RESPONSE", "ServerToClient" },
+        { 0x540014, "SMSG_HOUSING_SVCS_GUILD_REMOVE_HOUSE_NOTIFICATION", "ServerToClient" },
+        { 0x540016, "SMSG_HOUSING_SVCS_GUILD_RENAME_NEIGHBORHOOD_NOTIFICATION", "ServerToClient" },
+        { 0x540020, "SMSG_HOUSING_SVCS_HOUSE_FINDER_FORCE_REFRESH", "ServerToClient" },
+        { 0x54001A, "SMSG_HOUSING_SVCS_NEIGHBORHOOD_OWNERSHIP_TRANSFERRED_RESPONSE", "ServerToClient" },
+        { 0x540004, "SMSG_HOUSING_SVCS_NEIGHBORHOOD_RESERVE_PLOT_RESPONSE", "ServerToClient" },
+        { 0x540000, "SMSG_HOUSING_SVCS_NOTIFY_PERMISSIONS_FAILURE", "ServerToClient" },
+        { 0x54000D, "SMSG_HOUSING_SVCS_PLAYER_VIEW_HOUSES_RESPONSE", "ServerToClient" },
+        { 0x540019, "SMSG_HOUSING_SVCS_REJECT_NEIGHBORHOOD_OWNERSHIP_RESPONSE", "ServerToClient" },
+        { 0x540007, "SMSG_HOUSING_SVCS_RELINQUISH_HOUSE_RESPONSE", "ServerToClient" },
+        { 0x54001C, "SMSG_HOUSING_SVCS_UPDATE_HOUSE_SETTINGS_RESPONSE", "ServerToClient" },
+        { 0x540012, "SMSG_HOUSING_SVCS_UPDATE_HOUSES_LEVEL_FAVOR", "ServerToClient" },
+        { 0x4201CC, "SMSG_INITIALIZE_FACTIONS", "ServerToClient" },
+        { 0x420014, "SMSG_INITIAL_SETUP", "ServerToClient" },
+        { 0x420363, "SMSG_INITIATIVE_COMPLETE", "ServerToClient" },
+        { 0x420368, "SMSG_INITIATIVE_REWARD_AVAILABLE", "ServerToClient" },
+        { 0x420361, "SMSG_INITIATIVE_SERVICE_STATUS", "ServerToClient" },
+        { 0x420362, "SMSG_INITIATIVE_TASK_COMPLETE", "ServerToClient" },
+        { 0x4201EE, "SMSG_INIT_WORLD_STATES", "ServerToClient" },
+        { 0x4200D9, "SMSG_INSPECT_RESULT", "ServerToClient" },
+        { 0x42009D, "SMSG_INSTANCE_ABANDON_VOTE_COMPLETED", "ServerToClient" },
+        { 0x42009E, "SMSG_INSTANCE_ABANDON_VOTE_PLAYER_LEFT", "ServerToClient" },
+        { 0x42009C, "SMSG_INSTANCE_ABANDON_VOTE_RESPONSE", "ServerToClient" },
+        { 0x42009B, "SMSG_INSTANCE_ABANDON_VOTE_STARTED", "ServerToClient" },
+        { 0x42025A, "SMSG_INSTANCE_ENCOUNTER_CHANGE_PRIORITY", "ServerToClient" },
+        { 0x420259, "SMSG_INSTANCE_ENCOUNTER_DISENGAGE_UNIT", "ServerToClient" },
+        { 0x420262, "SMSG_INSTANCE_ENCOUNTER_END", "ServerToClient" },
+        { 0x420258, "SMSG_INSTANCE_ENCOUNTER_ENGAGE_UNIT", "ServerToClient" },
+        { 0x42022A, "SMSG_INSTANCE_ENCOUNTER_EVENT_APPEND", "ServerToClient" },
+        { 0x42022C, "SMSG_INSTANCE_ENCOUNTER_EVENT_BLOCKED_CHANGED", "ServerToClient" },
+        { 0x42022D, "SMSG_INSTANCE_ENCOUNTER_EVENT_CAST_UPDATE", "ServerToClient" },
+        { 0x42022B, "SMSG_INSTANCE_ENCOUNTER_EVENT_RESPAWN", "ServerToClient" },
+        { 0x420228, "SMSG_INSTANCE_ENCOUNTER_EVENT_SEQUENCE", "ServerToClient" },
+        { 0x420264, "SMSG_INSTANCE_ENCOUNTER_GAIN_COMBAT_RESURRECTION_CHARGE", "ServerToClient" },
+        { 0x420263, "SMSG_INSTANCE_ENCOUNTER_IN_COMBAT_RESURRECTION", "ServerToClient" },
+        { 0x42025D, "SMSG_INSTANCE_ENCOUNTER_OBJECTIVE_COMPLETE", "ServerToClient" },
+        { 0x42025C, "SMSG_INSTANCE_ENCOUNTER_OBJECTIVE_START", "ServerToClient" },
+        { 0x420261, "SMSG_INSTANCE_ENCOUNTER_OBJECTIVE_UPDATE", "ServerToClient" },
+        { 0x420265, "SMSG_INSTANCE_ENCOUNTER_PHASE_SHIFT_CHANGED", "ServerToClient" },
+        { 0x42025E, "SMSG_INSTANCE_ENCOUNTER_START", "ServerToClient" },
+        { 0x420229, "SMSG_INSTANCE_ENCOUNTER_TIMELINE_SYNC", "ServerToClient" },
+        { 0x42025B, "SMSG_INSTANCE_ENCOUNTER_TIMER_START", "ServerToClient" },
+        { 0x420260, "SMSG_INSTANCE_ENCOUNTER_UPDATE_ALLOW_RELEASE_IN_PROGRESS", "ServerToClient" },
+        { 0x42025F, "SMSG_INSTANCE_ENCOUNTER_UPDATE_SUPPRESS_RELEASE", "ServerToClient" },
+        { 0x4201A3, "SMSG_INSTANCE_GROUP_SIZE_CHANGED", "ServerToClient" },
+        { 0x4200DC, "SMSG_INSTANCE_INFO", "ServerToClient" },
+        { 0x420130, "SMSG_INSTANCE_RESET", "ServerToClient" },
+        { 0x420131, "SMSG_INSTANCE_RESET_FAILED", "ServerToClient" },
+        { 0x420225, "SMSG_INSTANCE_SAVE_CREATED", "ServerToClient" },
+        { 0x62004C, "SMSG_INTERRUPT_POWER_REGEN", "ServerToClient" },
+        { 0x5F0008, "SMSG_INVALIDATE_NEIGHBORHOOD", "ServerToClient" },
+        { 0x460013, "SMSG_INVALIDATE_NEIGHBORHOOD_NAME", "ServerToClient" },
+        { 0x46000A, "SMSG_INVALIDATE_PAGE_TEXT", "ServerToClient" },
+        { 0x5F0007, "SMSG_INVALIDATE_PLAYER", "ServerToClient" },
+        { 0x4201FB, "SMSG_INVALID_PROMOTION_CODE", "ServerToClient" },
+        { 0x630005, "SMSG_INVENTORY_CHANGE_FAILURE", "ServerToClient" },
+        { 0x4202BB, "SMSG_INVENTORY_FIXUP_COMPLETE", "ServerToClient" },
+        { 0x4202CD, "SMSG_INVENTORY_FULL_OVERFLOW", "ServerToClient" },
+        { 0x420204, "SMSG_ISLAND_AZERITE_GAIN", "ServerToClient" },
+        { 0x420205, "SMSG_ISLAND_COMPLETE", "ServerToClient" },
+        { 0x600004, "SMSG_IS_QUEST_COMPLETE_RESPONSE", "ServerToClient" },
+        { 0x420194, "SMSG_ITEM_CHANGED", "ServerToClient" },
+        { 0x420270, "SMSG_ITEM_COOLDOWN", "ServerToClient" },
+        { 0x4201FD, "SMSG_ITEM_ENCHANT_TIME_UPDATE", "ServerToClient" },
+        { 0x420034, "SMSG_ITEM_EXPIRE_PURCHASE_REFUND", "ServerToClient" },
+        { 0x420302, "SMSG_ITEM_INTERACTION_COMPLETE", "ServerToClient" },
+        { 0x420032, "SMSG_ITEM_PURCHASE_REFUND_RESULT", "ServerToClient" },
+        { 0x4200CB, "SMSG_ITEM_PUSH_RESULT", "ServerToClient" },
+        { 0x4201FC, "SMSG_ITEM_TIME_UPDATE", "ServerToClient" },
+        { 0x420133, "SMSG_KICK_REASON", "ServerToClient" },
+        { 0x42037A, "SMSG_LAST_CATALOG_FETCH_RESPONSE", "ServerToClient" },
+        { 0x420312, "SMSG_LATENCY_REPORT_PING", "ServerToClient" },
+        { 0x620040, "SMSG_LEARNED_SPELLS", "ServerToClient" },
+        { 0x420077, "SMSG_LEARN_PVP_TALENT_FAILED", "ServerToClient" },
+        { 0x420076, "SMSG_LEARN_TALENT_FAILED", "ServerToClient" },
+        { 0x4202D2, "SMSG_LEGACY_LOOT_RULES", "ServerToClient" },
+        { 0x4202E8, "SMSG_LEVEL_LINKING_RESULT", "ServerToClient" },
+        { 0x420192, "SMSG_LEVEL_UP_INFO", "ServerToClient" },
+        { 0x560019, "SMSG_LFG_BOOT_PLAYER", "ServerToClient" },
+        { 0x560017, "SMSG_LFG_DISABLED", "ServerToClient" },
+        { 0x56001F, "SMSG_LFG_EXPAND_SEARCH_PROMPT", "ServerToClient" },
+        { 0x560009, "SMSG_LFG_INSTANCE_SHUTDOWN_COUNTDOWN", "ServerToClient" },
+        { 0x560020, "SMSG_LFG_JOIN_LOBBY_MATCHMAKER_QUEUE", "ServerToClient" },
+        { 0x560000, "SMSG_LFG_JOIN_RESULT", "ServerToClient" },
+        { 0x56000F, "SMSG_LFG_LIST_APPLICANT_LIST_UPDATE", "ServerToClient" },
+        { 0x56000C, "SMSG_LFG_LIST_APPLICATION_STATUS_UPDATE", "ServerToClient" },
+        { 0x56000D, "SMSG_LFG_LIST_APPLY_TO_GROUP_RESULT", "ServerToClient" },
+        { 0x560001, "SMSG_LFG_LIST_JOIN_RESULT", "ServerToClient" },
+        { 0x560002, "SMSG_LFG_LIST_SEARCH_RESULTS", "ServerToClient" },
+        { 0x560010, "SMSG_LFG_LIST_SEARCH_RESULTS_UPDATE", "ServerToClient" },
+        { 0x560003, "SMSG_LFG_LIST_SEARCH_STATUS", "ServerToClient" },
+        { 0x56000E, "SMSG_LFG_LIST_UPDATE_BLACKLIST", "ServerToClient" },
+        { 0x56000B, "SMSG_LFG_LIST_UPDATE_EXPIRATION", "ServerToClient" },
+        { 0x56000A, "SMSG_LFG_LIST_UPDATE_STATUS", "ServerToClient" },
+        { 0x560018, "SMSG_LFG_OFFER_CONTINUE", "ServerToClient" },
+        { 0x56001A, "SMSG_LFG_PARTY_INFO", "ServerToClient" },
+        { 0x56001B, "SMSG_LFG_PLAYER_INFO", "ServerToClient" },
+        { 0x56001C, "SMSG_LFG_PLAYER_REWARD", "ServerToClient" },
+        { 0x560011, "SMSG_LFG_PROPOSAL_UPDATE", "ServerToClient" },
+        { 0x560004, "SMSG_LFG_QUEUE_STATUS", "ServerToClient" },
+        { 0x56001E, "SMSG_LFG_READY_CHECK_RESULT", "ServerToClient" },
+        { 0x560006, "SMSG_LFG_READY_CHECK_UPDATE", "ServerToClient" },
+        { 0x560005, "SMSG_LFG_ROLE_CHECK_UPDATE", "ServerToClient" },
+        { 0x560014, "SMSG_LFG_SLOT_INVALID", "ServerToClient" },
+        { 0x560021, "SMSG_LFG_SUSPEND_LOREWALKING", "ServerToClient" },
+        { 0x560016, "SMSG_LFG_TELEPORT_DENIED", "ServerToClient" },
+        { 0x560008, "SMSG_LFG_UPDATE_STATUS", "ServerToClient" },
+        { 0x420378, "SMSG_LICENSED_DECOR_QUANTITIES_UPDATE", "ServerToClient" },
+        { 0x420217, "SMSG_LIVE_REGION_ACCOUNT_RESTORE_RESULT", "ServerToClient" },
+        { 0x420216, "SMSG_LIVE_REGION_CHARACTER_COPY_RESULT", "ServerToClient" },
+        { 0x42020A, "SMSG_LIVE_REGION_GET_ACCOUNT_CHARACTER_LIST_RESULT", "ServerToClient" },
+        { 0x420218, "SMSG_LIVE_REGION_KEY_BINDINGS_COPY_RESULT", "ServerToClient" },
+        { 0x42005F, "SMSG_LOAD_CUF_PROFILES", "ServerToClient" },
+        { 0x4201B8, "SMSG_LOAD_EQUIPMENT_SET", "ServerToClient" },
+        { 0x42031C, "SMSG_LOBBY_MATCHMAKER_LOBBY_ACQUIRED_SERVER", "ServerToClient" },
+        { 0x42031D, "SMSG_LOBBY_MATCHMAKER_PARTY_INFO", "ServerToClient" },
+        { 0x42031E, "SMSG_LOBBY_MATCHMAKER_PARTY_INVITE_REJECTED", "ServerToClient" },
+        { 0x420320, "SMSG_LOBBY_MATCHMAKER_QUEUE_PROPOSED", "ServerToClient" },
+        { 0x420321, "SMSG_LOBBY_MATCHMAKER_QUEUE_RESULT", "ServerToClient" },
+        { 0x42031F, "SMSG_LOBBY_MATCHMAKER_RECEIVE_INVITE", "ServerToClient" },
+        { 0x4201B7, "SMSG_LOGIN_SET_TIME_SPEED", "ServerToClient" },
+        { 0x42002F, "SMSG_LOGIN_VERIFY_WORLD", "ServerToClient" },
+        { 0x42012F, "SMSG_LOGOUT_CANCEL_ACK", "ServerToClient" },
+        { 0x42012E, "SMSG_LOGOUT_COMPLETE", "ServerToClient" },
+        { 0x42012D, "SMSG_LOGOUT_RESPONSE", "ServerToClient" },
+        { 0x42018E, "SMSG_LOG_XP_GAIN", "ServerToClient" },
+        { 0x4200C9, "SMSG_LOOT_ALL_PASSED", "ServerToClient" },
+        { 0x4201E9, "SMSG_LOOT_LIST", "ServerToClient" },
+        { 0x4200C4, "SMSG_LOOT_MONEY_NOTIFY", "ServerToClient" },
+        { 0x4200C3, "SMSG_LOOT_RELEASE", "ServerToClient" },
+        { 0x4200C2, "SMSG_LOOT_RELEASE_ALL", "ServerToClient" },
+        { 0x4200BE, "SMSG_LOOT_REMOVED", "ServerToClient" },
+        { 0x4200BD, "SMSG_LOOT_RESPONSE", "ServerToClient" },
+        { 0x4200C6, "SMSG_LOOT_ROLL", "ServerToClient" },
+        { 0x4200C8, "SMSG_LOOT_ROLLS_COMPLETE", "ServerToClient" },
+        { 0x4200CA, "SMSG_LOOT_ROLL_WON", "ServerToClient" },
+        { 0x420119, "SMSG_LOSS_OF_CONTROL_AURA_UPDATE", "ServerToClient" },
+        { 0x4200E3, "SMSG_MAIL_COMMAND_RESULT", "ServerToClient" },
+        { 0x4201FE, "SMSG_MAIL_LIST_RESULT", "ServerToClient" },
+        { 0x4201FF, "SMSG_MAIL_QUERY_NEXT_TIME_RESULT", "ServerToClient" },
+        { 0x48002A, "SMSG_MAP_OBJECTIVES_INIT", "ServerToClient" },
+        { 0x420069, "SMSG_MAP_OBJ_EVENTS", "ServerToClient" },
+        { 0x4200C7, "SMSG_MASTER_LOOT_CANDIDATE_LIST", "ServerToClient" },
+        { 0x420322, "SMSG_MEETING_STONE_FAILED", "ServerToClient" },
+        { 0x42000A, "SMSG_MESSAGE_BOX", "ServerToClient" },
+        { 0x420178, "SMSG_MINIMAP_PING", "ServerToClient" },
+        { 0x620004, "SMSG_MIRROR_IMAGE_COMPONENTED_DATA", "ServerToClient" },
+        { 0x620003, "SMSG_MIRROR_IMAGE_CREATURE_DATA", "ServerToClient" },
+        { 0x42036A, "SMSG_MIRROR_VARS", "ServerToClient" },
+        { 0x42006A, "SMSG_MISSILE_CANCEL", "ServerToClient" },
+        { 0x42020C, "SMSG_MODIFY_COOLDOWN", "ServerToClient" },
+        { 0x470003, "SMSG_MOTD", "ServerToClient" },
+        { 0x42000F, "SMSG_MOUNT_RESULT", "ServerToClient" },
+        { 0x5A0064, "SMSG_MOVE_ADD_IMPULSE", "ServerToClient" },
+        { 0x5A0060, "SMSG_MOVE_APPLY_INERTIA", "ServerToClient" },
+        { 0x5A0047, "SMSG_MOVE_APPLY_MOVEMENT_FORCE", "ServerToClient" },
+        { 0x5A0043, "SMSG_MOVE_DISABLE_COLLISION", "ServerToClient" },
+        { 0x5A002D, "SMSG_MOVE_DISABLE_DOUBLE_JUMP", "ServerToClient" },
+        { 0x5A0077, "SMSG_MOVE_DISABLE_FULL_SPEED_TURNING", "ServerToClient" },
+        { 0x5A003F, "SMSG_MOVE_DISABLE_GRAVITY", "ServerToClient" },
+        { 0x5A0041, "SMSG_MOVE_DISABLE_INERTIA", "ServerToClient" },
+        { 0x5A003E, "SMSG_MOVE_DISABLE_TRANSITION_BETWEEN_SWIM_AND_FLY", "ServerToClient" },
+        { 0x5A0044, "SMSG_MOVE_ENABLE_COLLISION", "ServerToClient" },
+        { 0x5A002C, "SMSG_MOVE_ENABLE_DOUBLE_JUMP", "ServerToClient" },
+        { 0x5A0076, "SMSG_MOVE_ENABLE_FULL_SPEED_TURNING", "ServerToClient" },
+        { 0x5A0040, "SMSG_MOVE_ENABLE_GRAVITY", "ServerToClient" },
+        { 0x5A0042, "SMSG_MOVE_ENABLE_INERTIA", "ServerToClient" },
+        { 0x5A003D, "SMSG_MOVE_ENABLE_TRANSITION_BETWEEN_SWIM_AND_FLY", "ServerToClient" },
+        { 0x5A0075, "SMSG_MOVE_INITIAL_OBJECT_UPDATE_COMPLETE", "ServerToClient" },
+        { 0x5A0033, "SMSG_MOVE_KNOCK_BACK", "ServerToClient" },
+        { 0x5A005F, "SMSG_MOVE_MARK_REMOTE_TIME_INVALID", "ServerToClient" },
+        { 0x4202D8, "SMSG_MOVEMENT_ENFORCEMENT_ALERT", "ServerToClient" },
+        { 0x5A0061, "SMSG_MOVE_REMOVE_INERTIA", "ServerToClient" },
+        { 0x5A0048, "SMSG_MOVE_REMOVE_MOVEMENT_FORCE", "ServerToClient" },
+        { 0x5A0029, "SMSG_MOVE_ROOT", "ServerToClient" },
+        { 0x5A0003, "SMSG_MOVE_SET_ACTIVE_MOVER", "ServerToClient" },
+        { 0x5A006D, "SMSG_MOVE_SET_ADV_FLYING_ADD_IMPULSE_MAX_SPEED", "ServerToClient" },
+        { 0x5A0068, "SMSG_MOVE_SET_ADV_FLYING_AIR_FRICTION", "ServerToClient" },
+        { 0x5A006E, "SMSG_MOVE_SET_ADV_FLYING_BANKING_RATE", "ServerToClient" },
+        { 0x5A006B, "SMSG_MOVE_SET_ADV_FLYING_DOUBLE_JUMP_VEL_MOD", "ServerToClient" },
+        { 0x5A006C, "SMSG_MOVE_SET_ADV_FLYING_GLIDE_START_MIN_HEIGHT", "ServerToClient" },
+        { 0x5A0074, "SMSG_MOVE_SET_ADV_FLYING_LAUNCH_SPEED_COEFFICIENT", "ServerToClient" },
+        { 0x5A006A, "SMSG_MOVE_SET_ADV_FLYING_LIFT_COEFFICIENT", "ServerToClient" },
+        { 0x5A0069, "SMSG_MOVE_SET_ADV_FLYING_MAX_VEL", "ServerToClient" },
+        { 0x5A0073, "SMSG_MOVE_SET_ADV_FLYING_OVER_MAX_DECELERATION", "ServerToClient" },
+        { 0x5A006F, "SMSG_MOVE_SET_ADV_FLYING_PITCHING_RATE_DOWN", "ServerToClient" },
+        { 0x5A0070, "SMSG_MOVE_SET_ADV_FLYING_PITCHING_RATE_UP", "ServerToClient" },
+        { 0x5A0072, "SMSG_MOVE_SET_ADV_FLYING_SURFACE_FRICTION", "ServerToClient" },
+        { 0x5A0071, "SMSG_MOVE_SET_ADV_FLYING_TURN_VELOCITY_THRESHOLD", "ServerToClient" },
+        { 0x5A0066, "SMSG_MOVE_SET_CAN_ADV_FLY", "ServerToClient" },
+        { 0x5A0078, "SMSG_MOVE_SET_CAN_DRIVE", "ServerToClient" },
+        { 0x5A0035, "SMSG_MOVE_SET_CAN_FLY", "ServerToClient" },
+        { 0x5A0037, "SMSG_MOVE_SET_CANNOT_SWIM", "ServerToClient" },
+        { 0x5A0039, "SMSG_MOVE_SET_CAN_TURN_WHILE_FALLING", "ServerToClient" },
+        { 0x5A0045, "SMSG_MOVE_SET_COLLISION_HEIGHT", "ServerToClient" },
+        { 0x5A0049, "SMSG_MOVE_SET_COMPOUND_STATE", "ServerToClient" },
+        { 0x5A002F, "SMSG_MOVE_SET_FEATHER_FALL", "ServerToClient" },
+        { 0x5A0025, "SMSG_MOVE_SET_FLIGHT_BACK_SPEED", "ServerToClient" },
+        { 0x5A0024, "SMSG_MOVE_SET_FLIGHT_SPEED", "ServerToClient" },
+        { 0x5A001A, "SMSG_MOVE_SET_GRAVITY_MODIFIER", "ServerToClient" },
+        { 0x5A0031, "SMSG_MOVE_SET_HOVERING", "ServerToClient" },
+        { 0x5A003B, "SMSG_MOVE_SET_IGNORE_MOVEMENT_FORCES", "ServerToClient" },
+        { 0x5A002E, "SMSG_MOVE_SET_LAND_WALK", "ServerToClient" },
+        { 0x5A0014, "SMSG_MOVE_SET_MOD_MOVEMENT_FORCE_MAGNITUDE", "ServerToClient" },
+        { 0x5A0030, "SMSG_MOVE_SET_NORMAL_FALL", "ServerToClient" },
+        { 0x5A0028, "SMSG_MOVE_SET_PITCH_RATE", "ServerToClient" },
+        { 0x5A0021, "SMSG_MOVE_SET_RUN_BACK_SPEED", "ServerToClient" },
+        { 0x5A0020, "SMSG_MOVE_SET_RUN_SPEED", "ServerToClient" },
+        { 0x5A0023, "SMSG_MOVE_SET_SWIM_BACK_SPEED", "ServerToClient" },
+        { 0x5A0022, "SMSG_MOVE_SET_SWIM_SPEED", "ServerToClient" },
+        { 0x5A0027, "SMSG_MOVE_SET_TURN_RATE", "ServerToClient" },
+        { 0x5A0046, "SMSG_MOVE_SET_VEHICLE_REC_ID", "ServerToClient" },
+        { 0x5A0026, "SMSG_MOVE_SET_WALK_SPEED", "ServerToClient" },
+        { 0x5A002B, "SMSG_MOVE_SET_WATER_WALK", "ServerToClient" },
+        { 0x5A004A, "SMSG_MOVE_SKIP_TIME", "ServerToClient" },
+        { 0x5A004F, "SMSG_MOVE_SPLINE_DISABLE_COLLISION", "ServerToClient" },
+        { 0x5A004D, "SMSG_MOVE_SPLINE_DISABLE_GRAVITY", "ServerToClient" },
+        { 0x5A0050, "SMSG_MOVE_SPLINE_ENABLE_COLLISION", "ServerToClient" },
+        { 0x5A004E, "SMSG_MOVE_SPLINE_ENABLE_GRAVITY", "ServerToClient" },
+        { 0x5A004B, "SMSG_MOVE_SPLINE_ROOT", "ServerToClient" },
+        { 0x5A0051, "SMSG_MOVE_SPLINE_SET_FEATHER_FALL", "ServerToClient" },
+        { 0x5A001C, "SMSG_MOVE_SPLINE_SET_FLIGHT_BACK_SPEED", "ServerToClient" },
+        { 0x5A001B, "SMSG_MOVE_SPLINE_SET_FLIGHT_SPEED", "ServerToClient" },
+        { 0x5A005B, "SMSG_MOVE_SPLINE_SET_FLYING", "ServerToClient" },
+        { 0x5A0053, "SMSG_MOVE_SPLINE_SET_HOVER", "ServerToClient" },
+        { 0x5A0056, "SMSG_MOVE_SPLINE_SET_LAND_WALK", "ServerToClient" },
+        { 0x5A0052, "SMSG_MOVE_SPLINE_SET_NORMAL_FALL", "ServerToClient" },
+        { 0x5A001F, "SMSG_MOVE_SPLINE_SET_PITCH_RATE", "ServerToClient" },
+        { 0x5A0016, "SMSG_MOVE_SPLINE_SET_RUN_BACK_SPEED", "ServerToClient" },
+        { 0x5A0059, "SMSG_MOVE_SPLINE_SET_RUN_MODE", "ServerToClient" },
+        { 0x5A0015, "SMSG_MOVE_SPLINE_SET_RUN_SPEED", "ServerToClient" },
+        { 0x5A0018, "SMSG_MOVE_SPLINE_SET_SWIM_BACK_SPEED", "ServerToClient" },
+        { 0x5A0017, "SMSG_MOVE_SPLINE_SET_SWIM_SPEED", "ServerToClient" },
+        { 0x5A001E, "SMSG_MOVE_SPLINE_SET_TURN_RATE", "ServerToClient" },
+        { 0x5A005A, "SMSG_MOVE_SPLINE_SET_WALK_MODE", "ServerToClient" },
+        { 0x5A001D, "SMSG_MOVE_SPLINE_SET_WALK_SPEED", "ServerToClient" },
+        { 0x5A0055, "SMSG_MOVE_SPLINE_SET_WATER_WALK", "ServerToClient" },
+        { 0x5A0057, "SMSG_MOVE_SPLINE_START_SWIM", "ServerToClient" },
+        { 0x5A0058, "SMSG_MOVE_SPLINE_STOP_SWIM", "ServerToClient" },
+        { 0x5A004C, "SMSG_MOVE_SPLINE_UNROOT", "ServerToClient" },
+        { 0x5A005C, "SMSG_MOVE_SPLINE_UNSET_FLYING", "ServerToClient" },
+        { 0x5A0054, "SMSG_MOVE_SPLINE_UNSET_HOVER", "ServerToClient" },
+        { 0x5A0034, "SMSG_MOVE_TELEPORT", "ServerToClient" },
+        { 0x5A002A, "SMSG_MOVE_UNROOT", "ServerToClient" },
+        { 0x5A0067, "SMSG_MOVE_UNSET_CAN_ADV_FLY", "ServerToClient" },
+        { 0x5A0079, "SMSG_MOVE_UNSET_CAN_DRIVE", "ServerToClient" },
+        { 0x5A0036, "SMSG_MOVE_UNSET_CAN_FLY", "ServerToClient" },
+        { 0x5A0038, "SMSG_MOVE_UNSET_CANNOT_SWIM", "ServerToClient" },
+        { 0x5A003A, "SMSG_MOVE_UNSET_CAN_TURN_WHILE_FALLING", "ServerToClient" },
+        { 0x5A0032, "SMSG_MOVE_UNSET_HOVERING", "ServerToClient" },
+        { 0x5A003C, "SMSG_MOVE_UNSET_IGNORE_MOVEMENT_FORCES", "ServerToClient" },
+        { 0x5A000E, "SMSG_MOVE_UPDATE", "ServerToClient" },
+        { 0x5A0065, "SMSG_MOVE_UPDATE_ADD_IMPULSE", "ServerToClient" },
+        { 0x5A0062, "SMSG_MOVE_UPDATE_APPLY_INERTIA", "ServerToClient" },
+        { 0x5A0012, "SMSG_MOVE_UPDATE_APPLY_MOVEMENT_FORCE", "ServerToClient" },
+        { 0x5A000D, "SMSG_MOVE_UPDATE_COLLISION_HEIGHT", "ServerToClient" },
+        { 0x5A000A, "SMSG_MOVE_UPDATE_FLIGHT_BACK_SPEED", "ServerToClient" },
+        { 0x5A0009, "SMSG_MOVE_UPDATE_FLIGHT_SPEED", "ServerToClient" },
+        { 0x5A0010, "SMSG_MOVE_UPDATE_KNOCK_BACK", "ServerToClient" },
+        { 0x5A0011, "SMSG_MOVE_UPDATE_MOD_MOVEMENT_FORCE_MAGNITUDE", "ServerToClient" },
+        { 0x5A000C, "SMSG_MOVE_UPDATE_PITCH_RATE", "ServerToClient" },
+        { 0x5A0063, "SMSG_MOVE_UPDATE_REMOVE_INERTIA", "ServerToClient" },
+        { 0x5A0013, "SMSG_MOVE_UPDATE_REMOVE_MOVEMENT_FORCE", "ServerToClient" },
+        { 0x5A0005, "SMSG_MOVE_UPDATE_RUN_BACK_SPEED", "ServerToClient" },
+        { 0x5A0004, "SMSG_MOVE_UPDATE_RUN_SPEED", "ServerToClient" },
+        { 0x5A0019, "SMSG_MOVE_UPDATE_SET_GRAVITY_MODIFIER", "ServerToClient" },
+        { 0x5A0008, "SMSG_MOVE_UPDATE_SWIM_BACK_SPEED", "ServerToClient" },
+        { 0x5A0007, "SMSG_MOVE_UPDATE_SWIM_SPEED", "ServerToClient" },
+        { 0x5A000F, "SMSG_MOVE_UPDATE_TELEPORT", "ServerToClient" },
+        { 0x5A000B, "SMSG_MOVE_UPDATE_TURN_RATE", "ServerToClient" },
+        { 0x5A0006, "SMSG_MOVE_UPDATE_WALK_SPEED", "ServerToClient" },
+        { 0x420287, "SMSG_MULTI_FLOOR_LEAVE_FLOOR", "ServerToClient" },
+        { 0x420286, "SMSG_MULTI_FLOOR_NEW_FLOOR", "ServerToClient" },
+        { 0x49000B, "SMSG_MULTIPLE_PACKETS", "ServerToClient" },
+        { 0x4200B2, "SMSG_MYTHIC_PLUS_ALL_MAP_STATS", "ServerToClient" },
+        { 0x4200B4, "SMSG_MYTHIC_PLUS_CURRENT_AFFIXES", "ServerToClient" },
+        { 0x4200BA, "SMSG_MYTHIC_PLUS_NEW_WEEK_RECORD", "ServerToClient" },
+        { 0x4200B3, "SMSG_MYTHIC_PLUS_SEASON_DATA", "ServerToClient" },
+        { 0x5C0006, "SMSG_NEIGHBORHOOD_ADD_SECONDARY_OWNER_RESPONSE", "ServerToClient" },
+        { 0x5C0008, "SMSG_NEIGHBORHOOD_BUY_HOUSE_RESPONSE", "ServerToClient" },
+        { 0x5C000C, "SMSG_NEIGHBORHOOD_CANCEL_INVITATION_RESPONSE", "ServerToClient" },
+        { 0x5B0003, "SMSG_NEIGHBORHOOD_CHARTER_ADD_SIGNATURE_RESPONSE", "ServerToClient" },
+        { 0x5B0004, "SMSG_NEIGHBORHOOD_CHARTER_OPEN_CONFIRMATION_UI_RESPONSE", "ServerToClient" },
+        { 0x5B0001, "SMSG_NEIGHBORHOOD_CHARTER_OPEN_UI_RESPONSE", "ServerToClient" },
+        { 0x5B0005, "SMSG_NEIGHBORHOOD_CHARTER_SIGNATURE_REMOVED_NOTIFICATION", "ServerToClient" },
+        { 0x5B0002, "SMSG_NEIGHBORHOOD_CHARTER_SIGN_REQUEST", "ServerToClient" },
+        { 0x5B0000, "SMSG_NEIGHBORHOOD_CHARTER_UPDATE_RESPONSE", "ServerToClient" },
+        { 0x5C000D, "SMSG_NEIGHBORHOOD_DECLINE_INVITATION_RESPONSE", "ServerToClient" },
+        { 0x5C0002, "SMSG_NEIGHBORHOOD_EVICT_PLAYER", "ServerToClient" },
+        { 0x5C0016, "SMSG_NEIGHBORHOOD_EVICT_PLOT_NOTICE", "ServerToClient" },
+        { 0x5C0015, "SMSG_NEIGHBORHOOD_EVICT_PLOT_RESPONSE", "ServerToClient" },
+        { 0x5C000F, "SMSG_NEIGHBORHOOD_GET_INVITES_RESPONSE", "ServerToClient" },
+        { 0x5C0012, "SMSG_NEIGHBORHOOD_GET_ROSTER_RESPONSE", "ServerToClient" },
+        { 0x5C0014, "SMSG_NEIGHBORHOOD_INVITE_NAME_LOOKUP_RESULT", "ServerToClient" },
+        { 0x5C0010, "SMSG_NEIGHBORHOOD_INVITE_NOTIFICATION", "ServerToClient" },
+        { 0x5C000B, "SMSG_NEIGHBORHOOD_INVITE_RESIDENT_RESPONSE", "ServerToClient" },
+        { 0x5C0009, "SMSG_NEIGHBORHOOD_MOVE_HOUSE_RESPONSE", "ServerToClient" },
+        { 0x5C0011, "SMSG_NEIGHBORHOOD_OFFER_OWNERSHIP_RESPONSE", "ServerToClient" },
+        { 0x5C000A, "SMSG_NEIGHBORHOOD_OPEN_CORNERSTONE_UI_RESPONSE", "ServerToClient" },
+        { 0x5C0000, "SMSG_NEIGHBORHOOD_PLAYER_ENTER_PLOT", "ServerToClient" },
+        { 0x5C000E, "SMSG_NEIGHBORHOOD_PLAYER_GET_INVITE_RESPONSE", "ServerToClient" },
+        { 0x5C0001, "SMSG_NEIGHBORHOOD_PLAYER_LEAVE_PLOT", "ServerToClient" },
+        { 0x5C0007, "SMSG_NEIGHBORHOOD_REMOVE_SECONDARY_OWNER_RESPONSE", "ServerToClient" },
+        { 0x5C0013, "SMSG_NEIGHBORHOOD_ROSTER_RESIDENT_UPDATE", "ServerToClient" },
+        { 0x5C0004, "SMSG_NEIGHBORHOOD_UPDATE_NAME_NOTIFICATION", "ServerToClient" },
+        { 0x5C0003, "SMSG_NEIGHBORHOOD_UPDATE_NAME_RESPONSE", "ServerToClient" },
+        { 0x42007E, "SMSG_NEUTRAL_PLAYER_FACTION_SELECT_RESULT", "ServerToClient" },
+        { 0x420346, "SMSG_NEW_DATA_BUILD", "ServerToClient" },
+        { 0x420128, "SMSG_NEW_TAXI_PATH", "ServerToClient" },
+        { 0x42002B, "SMSG_NEW_WORLD", "ServerToClient" },
+        { 0x620036, "SMSG_NOTIFY_DEST_LOC_SPELL_CAST", "ServerToClient" },
+        { 0x420154, "SMSG_NOTIFY_MISSILE_TRAJECTORY_COLLISION", "ServerToClient" },
+        { 0x420031, "SMSG_NOTIFY_MONEY", "ServerToClient" },
+        { 0x4200E4, "SMSG_NOTIFY_RECEIVED_MAIL", "ServerToClient" },
+        { 0x420318, "SMSG_NPC_INTERACTION_OPEN_RESULT", "ServerToClient" },
+        { 0x420160, "SMSG_OFFER_PETITION_ERROR", "ServerToClient" },
+        { 0x42018F, "SMSG_ON_CANCEL_EXPECTED_RIDE_VEHICLE_AURA", "ServerToClient" },
+        { 0x5A0002, "SMSG_ON_MONSTER_MOVE", "ServerToClient" },
+        { 0x42024C, "SMSG_OPEN_ARTIFACT_FORGE", "ServerToClient" },
+        { 0x630006, "SMSG_OPEN_CONTAINER", "ServerToClient" },
+        { 0x560015, "SMSG_OPEN_LFG_DUNGEON_FINDER", "ServerToClient" },
+        { 0x420244, "SMSG_OPEN_SHIPMENT_NPC_RESULT", "ServerToClient" },
+        { 0x420165, "SMSG_OVERRIDE_LIGHT", "ServerToClient" },
+        { 0x4201C3, "SMSG_PAGE_TEXT", "ServerToClient" },
+        { 0x42023E, "SMSG_PARTY_COMMAND_RESULT", "ServerToClient" },
+        { 0x42035A, "SMSG_PARTY_ELIGIBILITY_FOR_DELVE_TIERS_RESPONSE", "ServerToClient" },
+        { 0x420060, "SMSG_PARTY_INVITE", "ServerToClient" },
+        { 0x420202, "SMSG_PARTY_KILL_LOG", "ServerToClient" },
+        { 0x420201, "SMSG_PARTY_MEMBER_FULL_STATE", "ServerToClient" },
+        { 0x420200, "SMSG_PARTY_MEMBER_PARTIAL_STATE", "ServerToClient" },
+        { 0x420308, "SMSG_PARTY_NOTIFY_LFG_LEADER_CHANGE", "ServerToClient" },
+        { 0x420096, "SMSG_PARTY_UPDATE", "ServerToClient" },
+        { 0x420065, "SMSG_PAST_TIME_EVENTS", "ServerToClient" },
+        { 0x4201BA, "SMSG_PAUSE_MIRROR_TIMER", "ServerToClient" },
+        { 0x4201A1, "SMSG_PENDING_RAID_LOCK", "ServerToClient" },
+        { 0x5E0007, "SMSG_PERKS_ANIM_TOGGLE_KILL_SWITCH", "ServerToClient" },
+        { 0x5E0005, "SMSG_PERKS_PROGRAM_ACTIVITY_COMPLETE", "ServerToClient" },
+        { 0x5E0001, "SMSG_PERKS_PROGRAM_ACTIVITY_UPDATE", "ServerToClient" },
+        { 0x5E0006, "SMSG_PERKS_PROGRAM_DISABLED", "ServerToClient" },
+        { 0x5E0002, "SMSG_PERKS_PROGRAM_RESULT", "ServerToClient" },
+        { 0x5E0000, "SMSG_PERKS_PROGRAM_VENDOR_UPDATE", "ServerToClient" },
+        { 0x4201F1, "SMSG_PET_ACTION_FEEDBACK", "ServerToClient" },
+        { 0x42014A, "SMSG_PET_ACTION_SOUND", "ServerToClient" },
+        { 0x4200A8, "SMSG_PET_BATTLE_CHAT_RESTRICTED", "ServerToClient" },
+        { 0x42011E, "SMSG_PET_BATTLE_DEBUG_QUEUE_DUMP_RESPONSE", "ServerToClient" },
+        { 0x4200A1, "SMSG_PET_BATTLE_FINALIZE_LOCATION", "ServerToClient" },
+        { 0x4200A6, "SMSG_PET_BATTLE_FINAL_ROUND", "ServerToClient" },
+        { 0x4200A7, "SMSG_PET_BATTLE_FINISHED", "ServerToClient" },
+        { 0x4200A3, "SMSG_PET_BATTLE_FIRST_ROUND", "ServerToClient" },
+        { 0x4200A2, "SMSG_PET_BATTLE_INITIAL_UPDATE", "ServerToClient" },
+        { 0x4200A9, "SMSG_PET_BATTLE_MAX_GAME_LENGTH_WARNING", "ServerToClient" },
+        { 0x4200A0, "SMSG_PET_BATTLE_PVP_CHALLENGE", "ServerToClient" },
+        { 0x4200E1, "SMSG_PET_BATTLE_QUEUE_PROPOSE_MATCH", "ServerToClient" },
+        { 0x4200E2, "SMSG_PET_BATTLE_QUEUE_STATUS", "ServerToClient" },
+        { 0x4200A5, "SMSG_PET_BATTLE_REPLACEMENTS_MADE", "ServerToClient" },
+        { 0x42009F, "SMSG_PET_BATTLE_REQUEST_FAILED", "ServerToClient" },
+        { 0x4200A4, "SMSG_PET_BATTLE_ROUND_RESULT", "ServerToClient" },
+        { 0x42008E, "SMSG_PET_BATTLE_SLOT_UPDATES", "ServerToClient" },
+        { 0x62004B, "SMSG_PET_CAST_FAILED", "ServerToClient" },
+        { 0x620013, "SMSG_PET_CLEAR_SPELLS", "ServerToClient" },
+        { 0x42014B, "SMSG_PET_DISMISS_SOUND", "ServerToClient" },
+        { 0x420125, "SMSG_PET_GOD_MODE", "ServerToClient" },
+        { 0x4201AD, "SMSG_PET_GUIDS", "ServerToClient" },
+        { 0x420037, "SMSG_PETITION_ALREADY_SIGNED", "ServerToClient" },
+        { 0x4E0042, "SMSG_PETITION_RENAME_GUILD_RESPONSE", "ServerToClient" },
+        { 0x420168, "SMSG_PETITION_SHOW_LIST", "ServerToClient" },
+        { 0x420169, "SMSG_PETITION_SHOW_SIGNATURES", "ServerToClient" },
+        { 0x4201F4, "SMSG_PETITION_SIGN_RESULTS", "ServerToClient" },
+        { 0x620042, "SMSG_PET_LEARNED_SPELLS", "ServerToClient" },
+        { 0x42001F, "SMSG_PET_MODE", "ServerToClient" },
+        { 0x42016D, "SMSG_PET_NAME_INVALID", "ServerToClient" },
+        { 0x42001E, "SMSG_PET_NEWLY_TAMED", "ServerToClient" },
+        { 0x620014, "SMSG_PET_SPELLS_MESSAGE", "ServerToClient" },
+        { 0x42002A, "SMSG_PET_STABLE_RESULT", "ServerToClient" },
+        { 0x42015C, "SMSG_PET_TAME_FAILURE", "ServerToClient" },
+        { 0x620043, "SMSG_PET_UNLEARNED_SPELLS", "ServerToClient" },
+        { 0x42000C, "SMSG_PHASE_SHIFT_CHANGE", "ServerToClient" },
+        { 0x42017F, "SMSG_PLAYED_TIME", "ServerToClient" },
+        { 0x5F002E, "SMSG_PLAYER_ACKNOWLEDGE_ARROW_CALLOUT", "ServerToClient" },
+        { 0x5F0020, "SMSG_PLAYER_AZERITE_ITEM_EQUIPPED_STATUS_CHANGED", "ServerToClient" },
+        { 0x5F001F, "SMSG_PLAYER_AZERITE_ITEM_GAINS", "ServerToClient" },
+        { 0x5F0022, "SMSG_PLAYER_BONUS_ROLL_FAILED", "ServerToClient" },
+        { 0x5F0000, "SMSG_PLAYER_BOUND", "ServerToClient" },
+        { 0x5F0006, "SMSG_PLAYER_CHOICE_CLEAR", "ServerToClient" },
+        { 0x5F0005, "SMSG_PLAYER_CHOICE_DISPLAY_ERROR", "ServerToClient" },
+        { 0x5F0013, "SMSG_PLAYER_CONDITION_RESULT", "ServerToClient" },
+        { 0x5F0033, "SMSG_PLAYER_DELAYED_UPLOAD_SCREENSHOT", "ServerToClient" },
+        { 0x5F0030, "SMSG_PLAYER_END_OF_MATCH_DETAILS", "ServerToClient" },
+        { 0x5F002D, "SMSG_PLAYER_HIDE_ARROW_CALLOUT", "ServerToClient" },
+        { 0x5F0012, "SMSG_PLAYER_IS_ADVENTURE_MAP_POI_VALID", "ServerToClient" },
+        { 0x5F0017, "SMSG_PLAYER_OPEN_SUBSCRIPTION_INTERSTITIAL", "ServerToClient" },
+        { 0x4E0041, "SMSG_PLAYER_SAVE_GUILD_EMBLEM", "ServerToClient" },
+        { 0x5F002F, "SMSG_PLAYER_SAVE_PERSONAL_EMBLEM", "ServerToClient" },
+        { 0x5F002C, "SMSG_PLAYER_SHOW_ARROW_CALLOUT", "ServerToClient" },
+        { 0x5F002A, "SMSG_PLAYER_SHOW_GENERIC_WIDGET_DISPLAY", "ServerToClient" },
+        { 0x5F002B, "SMSG_PLAYER_SHOW_PARTY_POSE_UI", "ServerToClient" },
+        { 0x5F0025, "SMSG_PLAYER_SHOW_UI_EVENT_TOAST", "ServerToClient" },
+        { 0x5F000F, "SMSG_PLAYER_SKINNED", "ServerToClient" },
+        { 0x5F0016, "SMSG_PLAYER_TUTORIAL_HIGHLIGHT_SPELL", "ServerToClient" },
+        { 0x5F0015, "SMSG_PLAYER_TUTORIAL_UNHIGHLIGHT_SPELL", "ServerToClient" },
+        { 0x5F0032, "SMSG_PLAYER_UPLOAD_SCREENSHOT", "ServerToClient" },
+        { 0x420211, "SMSG_PLAY_MUSIC", "ServerToClient" },
+        { 0x420213, "SMSG_PLAY_OBJECT_SOUND", "ServerToClient" },
+        { 0x4201D9, "SMSG_PLAY_ONE_SHOT_ANIM_KIT", "ServerToClient" },
+        { 0x62003A, "SMSG_PLAY_ORPHAN_SPELL_VISUAL", "ServerToClient" },
+        { 0x4200DE, "SMSG_PLAY_SCENE", "ServerToClient" },
+        { 0x420210, "SMSG_PLAY_SOUND", "ServerToClient" },
+        { 0x420214, "SMSG_PLAY_SPEAKERBOT_SOUND", "ServerToClient" },
+        { 0x620038, "SMSG_PLAY_SPELL_VISUAL", "ServerToClient" },
+        { 0x62003C, "SMSG_PLAY_SPELL_VISUAL_KIT", "ServerToClient" },
+        { 0x4201A7, "SMSG_PLAY_TIME_WARNING", "ServerToClient" },
+        { 0x490008, "SMSG_PONG", "ServerToClient" },
+        { 0x42017C, "SMSG_POWER_UPDATE", "ServerToClient" },
+        { 0x42000D, "SMSG_PRELOAD_CHILD_MAP", "ServerToClient" },
+        { 0x42002C, "SMSG_PRELOAD_WORLD", "ServerToClient" },
+        { 0x4202DB, "SMSG_PREPOPULATE_NAME_CACHE", "ServerToClient" },
+        { 0x42020F, "SMSG_PRE_RESSURECT", "ServerToClient" },
+        { 0x42006D, "SMSG_PRINT_NOTIFICATION", "ServerToClient" },
+        { 0x420203, "SMSG_PROC_RESIST", "ServerToClient" },
+        { 0x4202A7, "SMSG_PROFESSION_GOSSIP", "ServerToClient" },
+        { 0x620044, "SMSG_PUSH_SPELL_TO_ACTION_BAR", "ServerToClient" },
+        { 0x480024, "SMSG_PVP_CREDIT", "ServerToClient" },
+        { 0x48002F, "SMSG_PVP_MATCH_COMPLETE", "ServerToClient" },
+        { 0x480030, "SMSG_PVP_MATCH_INITIALIZE", "ServerToClient" },
+        { 0x48002E, "SMSG_PVP_MATCH_SET_STATE", "ServerToClient" },
+        { 0x48002D, "SMSG_PVP_MATCH_START", "ServerToClient" },
+        { 0x480010, "SMSG_PVP_MATCH_STATISTICS", "ServerToClient" },
+        { 0x480013, "SMSG_PVP_OPTIONS_ENABLED", "ServerToClient" },
+        { 0x420313, "SMSG_PVP_TIER_RECORD", "ServerToClient" },
+        { 0x46000C, "SMSG_QUERY_BATTLE_PET_NAME_RESPONSE", "ServerToClient" },
+        { 0x460006, "SMSG_QUERY_CREATURE_RESPONSE", "ServerToClient" },
+        { 0x460007, "SMSG_QUERY_GAME_OBJECT_RESPONSE", "ServerToClient" },
+        { 0x4C0041, "SMSG_QUERY_GARRISON_PET_NAME_RESPONSE", "ServerToClient" },
+        { 0x4E002F, "SMSG_QUERY_GUILD_FOLLOW_INFO_RESPONSE", "ServerToClient" },
+        { 0x4E002D, "SMSG_QUERY_GUILD_INFO_RESPONSE", "ServerToClient" },
+        { 0x460010, "SMSG_QUERY_ITEM_TEXT_RESPONSE", "ServerToClient" },
+        { 0x460012, "SMSG_QUERY_NEIGHBORHOOD_NAME_RESPONSE", "ServerToClient" },
+        { 0x460008, "SMSG_QUERY_NPC_TEXT_RESPONSE", "ServerToClient" },
+        { 0x460009, "SMSG_QUERY_PAGE_TEXT_RESPONSE", "ServerToClient" },
+        { 0x46000D, "SMSG_QUERY_PETITION_RESPONSE", "ServerToClient" },
+        { 0x46000B, "SMSG_QUERY_PET_NAME_RESPONSE", "ServerToClient" },
+        { 0x5F000B, "SMSG_QUERY_PLAYER_NAME_BY_COMMUNITY_ID_RESPONSE", "ServerToClient" },
+        { 0x5F0027, "SMSG_QUERY_PLAYER_NAMES_RESPONSE", "ServerToClient" },
+        { 0x600016, "SMSG_QUERY_QUEST_INFO_RESPONSE", "ServerToClient" },
+        { 0x4E002E, "SMSG_QUERY_REALM_GUILD_MASTER_INFO_RESPONSE", "ServerToClient" },
+        { 0x420327, "SMSG_QUERY_SELECTED_WOW_LABS_AREA_RESPONSE", "ServerToClient" },
+        { 0x42018D, "SMSG_QUERY_TIME_RESPONSE", "ServerToClient" },
+        { 0x420328, "SMSG_QUERY_WOW_LABS_AREA_INFO_RESPONSE", "ServerToClient" },
+        { 0x600001, "SMSG_QUEST_COMPLETION_NPC_RESPONSE", "ServerToClient" },
+        { 0x60000F, "SMSG_QUEST_CONFIRM_ACCEPT", "ServerToClient" },
+        { 0x60001C, "SMSG_QUEST_FORCE_REMOVED", "ServerToClient" },
+        { 0x600005, "SMSG_QUEST_GIVER_INVALID_QUEST", "ServerToClient" },
+        { 0x600014, "SMSG_QUEST_GIVER_OFFER_REWARD_MESSAGE", "ServerToClient" },
+        { 0x600003, "SMSG_QUEST_GIVER_QUEST_COMPLETE", "ServerToClient" },
+        { 0x600012, "SMSG_QUEST_GIVER_QUEST_DETAILS", "ServerToClient" },
+        { 0x600006, "SMSG_QUEST_GIVER_QUEST_FAILED", "ServerToClient" },
+        { 0x60001A, "SMSG_QUEST_GIVER_QUEST_LIST_MESSAGE", "ServerToClient" },
+        { 0x600013, "SMSG_QUEST_GIVER_REQUEST_ITEMS", "ServerToClient" },
+        { 0x60001B, "SMSG_QUEST_GIVER_STATUS", "ServerToClient" },
+        { 0x600011, "SMSG_QUEST_GIVER_STATUS_MULTIPLE", "ServerToClient" },
+        { 0x600002, "SMSG_QUEST_ITEM_USABILITY_RESPONSE", "ServerToClient" },
+        { 0x600007, "SMSG_QUEST_LOG_FULL", "ServerToClient" },
+        { 0x600008, "SMSG_QUEST_NON_LOG_UPDATE_COMPLETE", "ServerToClient" },
+        { 0x60001D, "SMSG_QUEST_POI_QUERY_RESPONSE", "ServerToClient" },
+        { 0x60001F, "SMSG_QUEST_POI_UPDATE_RESPONSE", "ServerToClient" },
+        { 0x600010, "SMSG_QUEST_PUSH_RESULT", "ServerToClient" },
+        { 0x4202FE, "SMSG_QUEST_SESSION_INFO_RESPONSE", "ServerToClient" },
+        { 0x4202EC, "SMSG_QUEST_SESSION_READY_CHECK", "ServerToClient" },
+        { 0x4202ED, "SMSG_QUEST_SESSION_READY_CHECK_RESPONSE", "ServerToClient" },
+        { 0x4202EB, "SMSG_QUEST_SESSION_RESULT", "ServerToClient" },
+        { 0x60000C, "SMSG_QUEST_UPDATE_ADD_CREDIT", "ServerToClient" },
+        { 0x60000D, "SMSG_QUEST_UPDATE_ADD_CREDIT_SIMPLE", "ServerToClient" },
+        { 0x60000E, "SMSG_QUEST_UPDATE_ADD_PVP_CREDIT", "ServerToClient" },
+        { 0x600009, "SMSG_QUEST_UPDATE_COMPLETE", "ServerToClient" },
+        { 0x60000A, "SMSG_QUEST_UPDATE_FAILED", "ServerToClient" },
+        { 0x60000B, "SMSG_QUEST_UPDATE_FAILED_TIMER", "ServerToClient" },
+        { 0x4202BA, "SMSG_QUEUE_SUMMARY_UPDATE", "ServerToClient" },
+        { 0x4202E9, "SMSG_RAF_ACCOUNT_INFO", "ServerToClient" },
+        { 0x4202FA, "SMSG_RAF_ACTIVITY_STATE_CHANGED", "ServerToClient" },
+        { 0x420343, "SMSG_RAF_DEBUG_FRIEND_MONTHS", "ServerToClient" },
+        { 0x420255, "SMSG_RAID_DIFFICULTY_SET", "ServerToClient" },
+        { 0x420257, "SMSG_RAID_GROUP_ONLY", "ServerToClient" },
+        { 0x47000A, "SMSG_RAID_INSTANCE_MESSAGE", "ServerToClient" },
+        { 0x420038, "SMSG_RAID_MARKERS_CHANGED", "ServerToClient" },
+        { 0x4200D8, "SMSG_RANDOM_ROLL", "ServerToClient" },
+        { 0x48000F, "SMSG_RATED_PVP_INFO", "ServerToClient" },
+        { 0x420251, "SMSG_READ_ITEM_RESULT_FAILED", "ServerToClient" },
+        { 0x420249, "SMSG_READ_ITEM_RESULT_OK", "ServerToClient" },
+        { 0x42009A, "SMSG_READY_CHECK_COMPLETED", "ServerToClient" },
+        { 0x420099, "SMSG_READY_CHECK_RESPONSE", "ServerToClient" },
+        { 0x420098, "SMSG_READY_CHECK_STARTED", "ServerToClient" },
+        { 0x460005, "SMSG_REALM_QUERY_RESPONSE", "ServerToClient" },
+        { 0x4201F3, "SMSG_REATTACH_RESURRECT", "ServerToClient" },
+        { 0x420039, "SMSG_RECEIVE_PING_UNIT", "ServerToClient" },
+        { 0x42003A, "SMSG_RECEIVE_PING_WORLD_POINT", "ServerToClient" },
+        { 0x42035D, "SMSG_RECENT_ALLY_DATA_RESPONSE", "ServerToClient" },
+        { 0x42035E, "SMSG_RECENT_ALLY_NOTE_UPDATED", "ServerToClient" },
+        { 0x420339, "SMSG_RECRAFT_ITEM_RESULT", "ServerToClient" },
+        { 0x42016A, "SMSG_RECRUIT_A_FRIEND_FAILURE", "ServerToClient" },
+        { 0x420371, "SMSG_REFETCH_TACT_KEYS", "ServerToClient" },
+        { 0x4200F8, "SMSG_REFRESH_COMPONENT", "ServerToClient" },
+        { 0x42001A, "SMSG_REGIONWIDE_CHARACTER_MAIL_DATA", "ServerToClient" },
+        { 0x420019, "SMSG_REGIONWIDE_CHARACTER_RESTRICTIONS_DATA", "ServerToClient" },
+        { 0x420043, "SMSG_REMOVE_ITEM_PASSIVE", "ServerToClient" },
+        { 0x620045, "SMSG_REMOVE_SPELL_FROM_ACTION_BAR", "ServerToClient" },
+        { 0x42026D, "SMSG_REPLACE_TROPHY_RESPONSE", "ServerToClient" },
+        { 0x5F000A, "SMSG_REPORT_PVP_PLAYER_AFK_RESULT", "ServerToClient" },
+        { 0x420025, "SMSG_REQUEST_CEMETERY_LIST_RESPONSE", "ServerToClient" },
+        { 0x480014, "SMSG_REQUEST_PVP_REWARDS_RESPONSE", "ServerToClient" },
+        { 0x480015, "SMSG_REQUEST_SCHEDULED_PVP_INFO_RESPONSE", "ServerToClient" },
+        { 0x490009, "SMSG_RESET_COMPRESSION_CONTEXT", "ServerToClient" },
+        { 0x420161, "SMSG_RESET_FAILED_NOTIFY", "ServerToClient" },
+        { 0x420340, "SMSG_RESET_LAST_LOADED_CONFIG_CVARS", "ServerToClient" },
+        { 0x600020, "SMSG_RESET_QUEST_POI", "ServerToClient" },
+        { 0x480023, "SMSG_RESET_RANGED_COMBAT_TIMER", "ServerToClient" },
+        { 0x420009, "SMSG_RESET_WEEKLY_CURRENCY", "ServerToClient" },
+        { 0x4200BB, "SMSG_RESPEC_WIPE_CONFIRM", "ServerToClient" },
+        { 0x420006, "SMSG_RESPOND_INSPECT_ACHIEVEMENTS", "ServerToClient" },
+        { 0x5E0003, "SMSG_RESPONSE_PERK_PENDING_REWARDS", "ServerToClient" },
+        { 0x5E0004, "SMSG_RESPONSE_PERK_RECENT_PURCHASES", "ServerToClient" },
+        { 0x620054, "SMSG_RESTART_GLOBAL_COOLDOWN", "ServerToClient" },
+        { 0x42005C, "SMSG_RESTRICTED_ACCOUNT_WARNING", "ServerToClient" },
+        { 0x62002E, "SMSG_RESUME_CAST", "ServerToClient" },
+        { 0x620031, "SMSG_RESUME_CAST_BAR", "ServerToClient" },
+        { 0x490005, "SMSG_RESUME_COMMS", "ServerToClient" },
+        { 0x420041, "SMSG_RESUME_TOKEN", "ServerToClient" },
+        { 0x420012, "SMSG_RESURRECT_REQUEST", "ServerToClient" },
+        { 0x620052, "SMSG_RESYNC_RUNES", "ServerToClient" },
+        { 0x4202DF, "SMSG_RETURN_APPLICANT_LIST", "ServerToClient" },
+        { 0x4202DE, "SMSG_RETURN_RECRUITING_CLUBS", "ServerToClient" },
+        { 0x420021, "SMSG_ROLE_CHANGED_INFORM", "ServerToClient" },
+        { 0x56001D, "SMSG_ROLE_CHOSEN", "ServerToClient" },
+        { 0x420022, "SMSG_ROLE_POLL_INFORM", "ServerToClient" },
+        { 0x4202A6, "SMSG_RUNEFORGE_LEGENDARY_CRAFTING_OPEN_NPC", "ServerToClient" },
+        { 0x420059, "SMSG_RUNE_REGEN_DEBUG", "ServerToClient" },
+        { 0x420294, "SMSG_SCENARIO_COMPLETED", "ServerToClient" },
+        { 0x4200DB, "SMSG_SCENARIO_POIS", "ServerToClient" },
+        { 0x4200D4, "SMSG_SCENARIO_PROGRESS_UPDATE", "ServerToClient" },
+        { 0x4202AA, "SMSG_SCENARIO_SHOW_CRITERIA", "ServerToClient" },
+        { 0x4200D3, "SMSG_SCENARIO_STATE", "ServerToClient" },
+        { 0x4202A9, "SMSG_SCENARIO_UI_UPDATE", "ServerToClient" },
+        { 0x420252, "SMSG_SCENARIO_VACATE", "ServerToClient" },
+        { 0x420084, "SMSG_SCENE_OBJECT_EVENT", "ServerToClient" },
+        { 0x420089, "SMSG_SCENE_OBJECT_PET_BATTLE_FINAL_ROUND", "ServerToClient" },
+        { 0x42008A, "SMSG_SCENE_OBJECT_PET_BATTLE_FINISHED", "ServerToClient" },
+        { 0x420086, "SMSG_SCENE_OBJECT_PET_BATTLE_FIRST_ROUND", "ServerToClient" },
+        { 0x420085, "SMSG_SCENE_OBJECT_PET_BATTLE_INITIAL_UPDATE", "ServerToClient" },
+        { 0x420088, "SMSG_SCENE_OBJECT_PET_BATTLE_REPLACEMENTS_MADE", "ServerToClient" },
+        { 0x420087, "SMSG_SCENE_OBJECT_PET_BATTLE_ROUND_RESULT", "ServerToClient" },
+        { 0x5F001A, "SMSG_SCHEDULED_AREA_POI_UPDATE_RESPONSE", "ServerToClient" },
+        { 0x620049, "SMSG_SCRIPT_CAST", "ServerToClient" },
+        { 0x420064, "SMSG_SEASON_INFO", "ServerToClient" },
+        { 0x42016E, "SMSG_SELL_RESPONSE", "ServerToClient" },
+        { 0x42002D, "SMSG_SEND_FORCE_PITCH_CHANGE", "ServerToClient" },
+        { 0x420044, "SMSG_SEND_ITEM_PASSIVES", "ServerToClient" },
+        { 0x620019, "SMSG_SEND_KNOWN_SPELLS", "ServerToClient" },
+        { 0x4200D6, "SMSG_SEND_RAID_TARGET_UPDATE_ALL", "ServerToClient" },
+        { 0x4200D7, "SMSG_SEND_RAID_TARGET_UPDATE_SINGLE", "ServerToClient" },
+        { 0x62001B, "SMSG_SEND_SPELL_CHARGES", "ServerToClient" },
+        { 0x62001A, "SMSG_SEND_SPELL_HISTORY", "ServerToClient" },
+        { 0x62001C, "SMSG_SEND_UNLEARN_SPELLS", "ServerToClient" },
+        { 0x4200F5, "SMSG_SERVER_FIRST_ACHIEVEMENTS", "ServerToClient" },
+        { 0x42012C, "SMSG_SERVER_TIME", "ServerToClient" },
+        { 0x4201BE, "SMSG_SERVER_TIME_OFFSET", "ServerToClient" },
+        { 0x4201D8, "SMSG_SET_AI_ANIM_KIT", "ServerToClient" },
+        { 0x4201DC, "SMSG_SET_ANIM_TIER", "ServerToClient" },
+        { 0x420081, "SMSG_SET_CHR_UPGRADE_TIER", "ServerToClient" },
+        { 0x42036E, "SMSG_SET_CTR_OPTIONS", "ServerToClient" },
+        { 0x420008, "SMSG_SET_CURRENCY", "ServerToClient" },
+        { 0x560012, "SMSG_SET_DF_FAST_LAUNCH_RESULT", "ServerToClient" },
+        { 0x42014E, "SMSG_SET_DUNGEON_DIFFICULTY", "ServerToClient" },
+        { 0x4201A9, "SMSG_SET_FACTION_AT_WAR", "ServerToClient" },
+        { 0x4201D3, "SMSG_SET_FACTION_NOT_VISIBLE", "ServerToClient" },
+        { 0x4201D4, "SMSG_SET_FACTION_STANDING", "ServerToClient" },
+        { 0x4201D2, "SMSG_SET_FACTION_VISIBLE", "ServerToClient" },
+        { 0x620027, "SMSG_SET_FLAT_SPELL_MODIFIER", "ServerToClient" },
+        { 0x620029, "SMSG_SET_FLAT_SPELL_PVP_MODIFIER", "ServerToClient" },
+        { 0x42036B, "SMSG_SET_INSTANCE_LEAVER", "ServerToClient" },
+        { 0x420033, "SMSG_SET_ITEM_PURCHASE_DATA", "ServerToClient" },
+        { 0x420278, "SMSG_SET_LOOT_METHOD_FAILED", "ServerToClient" },
+        { 0x420036, "SMSG_SET_MAX_WEEKLY_QUANTITY", "ServerToClient" },
+        { 0x4201DB, "SMSG_SET_MELEE_ANIM_KIT", "ServerToClient" },
+        { 0x4201DA, "SMSG_SET_MOVEMENT_ANIM_KIT", "ServerToClient" },
+        { 0x620028, "SMSG_SET_PCT_SPELL_MODIFIER", "ServerToClient" },
+        { 0x62002A, "SMSG_SET_PCT_SPELL_PVP_MODIFIER", "ServerToClient" },
+        { 0x4200CD, "SMSG_SET_PET_SPECIALIZATION", "ServerToClient" },
+        { 0x5F000C, "SMSG_SET_PLAYER_DECLINED_NAMES_RESULT", "ServerToClient" },
+        { 0x42005D, "SMSG_SET_PLAY_HOVER_ANIM", "ServerToClient" },
+        { 0x4201DD, "SMSG_SET_PROFICIENCY", "ServerToClient" },
+        { 0x4202F2, "SMSG_SET_QUEST_REPLAY_COOLDOWN_OVERRIDE", "ServerToClient" },
+        { 0x4C003A, "SMSG_SET_SHIPMENT_READY_RESPONSE", "ServerToClient" },
+        { 0x620018, "SMSG_SET_SPELL_CHARGES", "ServerToClient" },
+        { 0x420121, "SMSG_SET_TIME_ZONE_INFORMATION", "ServerToClient" },
+        { 0x62000F, "SMSG_SETUP_COMBAT_LOG_FILE_FLUSH", "ServerToClient" },
+        { 0x420007, "SMSG_SETUP_CURRENCY", "ServerToClient" },
+        { 0x4201A0, "SMSG_SET_VEHICLE_REC_ID", "ServerToClient" },
+        { 0x420317, "SMSG_SHADOWLANDS_CAPACITANCE_UPDATE", "ServerToClient" },
+        { 0x4C003B, "SMSG_SHIPMENT_FACTION_UPDATE_RESULT", "ServerToClient" },
+        { 0x420358, "SMSG_SHOW_DELVES_COMPANION_CONFIGURATION_UI", "ServerToClient" },
+        { 0x420356, "SMSG_SHOW_DELVES_DISPLAY_UI", "ServerToClient" },
+        { 0x42007D, "SMSG_SHOW_NEUTRAL_PLAYER_FACTION_SELECT_UI", "ServerToClient" },
+        { 0x600015, "SMSG_SHOW_QUEST_COMPLETION_TEXT", "ServerToClient" },
+        { 0x420177, "SMSG_SHOW_TAXI_NODES", "ServerToClient" },
+        { 0x420219, "SMSG_SHOW_TRADE_SKILL_RESPONSE", "ServerToClient" },
+        { 0x420323, "SMSG_SOCIAL_CONTRACT_REQUEST_RESPONSE", "ServerToClient" },
+        { 0x4201D0, "SMSG_SOCKET_GEMS_FAILURE", "ServerToClient" },
+        { 0x4201CF, "SMSG_SOCKET_GEMS_SUCCESS", "ServerToClient" },
+        { 0x420149, "SMSG_SPECIAL_MOUNT_ANIM", "ServerToClient" },
+        { 0x4201C2, "SMSG_SPEC_INVOLUNTARILY_CHANGED", "ServerToClient" },
+        { 0x420345, "SMSG_SPECTATE_END", "ServerToClient" },
+        { 0x420344, "SMSG_SPECTATE_PLAYER", "ServerToClient" },
+        { 0x62000C, "SMSG_SPELL_ABSORB_LOG", "ServerToClient" },
+        { 0x620006, "SMSG_SPELL_CATEGORY_COOLDOWN", "ServerToClient" },
+        { 0x620022, "SMSG_SPELL_CHANNEL_START", "ServerToClient" },
+        { 0x620023, "SMSG_SPELL_CHANNEL_UPDATE", "ServerToClient" },
+        { 0x620005, "SMSG_SPELL_COOLDOWN", "ServerToClient" },
+        { 0x62001F, "SMSG_SPELL_DAMAGE_SHIELD", "ServerToClient" },
+        { 0x620032, "SMSG_SPELL_DELAYED", "ServerToClient" },
+        { 0x620007, "SMSG_SPELL_DISPELL_LOG", "ServerToClient" },
+        { 0x620026, "SMSG_SPELL_EMPOWER_SET_STAGE", "ServerToClient" },
+        { 0x620024, "SMSG_SPELL_EMPOWER_START", "ServerToClient" },
+        { 0x620025, "SMSG_SPELL_EMPOWER_UPDATE", "ServerToClient" },
+        { 0x620009, "SMSG_SPELL_ENERGIZE_LOG", "ServerToClient" },
+        { 0x620033, "SMSG_SPELL_EXECUTE_LOG", "ServerToClient" },
+        { 0x620048, "SMSG_SPELL_FAILED_OTHER", "ServerToClient" },
+        { 0x620046, "SMSG_SPELL_FAILURE", "ServerToClient" },
+        { 0x62004D, "SMSG_SPELL_FAILURE_MESSAGE", "ServerToClient" },
+        { 0x62002C, "SMSG_SPELL_GO", "ServerToClient" },
+        { 0x62000B, "SMSG_SPELL_HEAL_ABSORB_LOG", "ServerToClient" },
+        { 0x62000A, "SMSG_SPELL_HEAL_LOG", "ServerToClient" },
+        { 0x620021, "SMSG_SPELL_INSTAKILL_LOG", "ServerToClient" },
+        { 0x62000D, "SMSG_SPELL_INTERRUPT_LOG", "ServerToClient" },
+        { 0x620034, "SMSG_SPELL_MISS_LOG", "ServerToClient" },
+        { 0x620020, "SMSG_SPELL_NON_MELEE_DAMAGE_LOG", "ServerToClient" },
+        { 0x62001D, "SMSG_SPELL_OR_DAMAGE_IMMUNE", "ServerToClient" },
+        { 0x620008, "SMSG_SPELL_PERIODIC_AURA_LOG", "ServerToClient" },
+        { 0x62002B, "SMSG_SPELL_PREPARE", "ServerToClient" },
+        { 0x62002D, "SMSG_SPELL_START", "ServerToClient" },
+        { 0x42006F, "SMSG_SPELL_VISUAL_LOAD_SCREEN", "ServerToClient" },
+        { 0x420304, "SMSG_SPLASH_SCREEN_SHOW_LATEST", "ServerToClient" },
+        { 0x4201C6, "SMSG_STAND_STATE_UPDATE", "ServerToClient" },
+        { 0x4200AA, "SMSG_START_ELAPSED_TIMER", "ServerToClient" },
+        { 0x4200AC, "SMSG_START_ELAPSED_TIMERS", "ServerToClient" },
+        { 0x420075, "SMSG_STARTER_BUILD_ACTIVATE_FAILED", "ServerToClient" },
+        { 0x420151, "SMSG_START_LIGHTNING_STORM", "ServerToClient" },
+        { 0x4200C5, "SMSG_START_LOOT_ROLL", "ServerToClient" },
+        { 0x4201B9, "SMSG_START_MIRROR_TIMER", "ServerToClient" },
+        { 0x42003D, "SMSG_START_TIMER", "ServerToClient" },
+        { 0x4200AB, "SMSG_STOP_ELAPSED_TIMER", "ServerToClient" },
+        { 0x4201BB, "SMSG_STOP_MIRROR_TIMER", "ServerToClient" },
+        { 0x420215, "SMSG_STOP_SPEAKERBOT_SOUND", "ServerToClient" },
+        { 0x42003E, "SMSG_STOP_TIMER", "ServerToClient" },
+        { 0x42003C, "SMSG_STREAMING_MOVIES", "ServerToClient" },
+        { 0x42023F, "SMSG_SUGGEST_INVITE_INFORM", "ServerToClient" },
+        { 0x42015A, "SMSG_SUMMON_CANCEL", "ServerToClient" },
+        { 0x420023, "SMSG_SUMMON_RAID_MEMBER_VALIDATE_FAILED", "ServerToClient" },
+        { 0x4201CA, "SMSG_SUMMON_REQUEST", "ServerToClient" },
+        { 0x62003F, "SMSG_SUPERCEDED_SPELLS", "ServerToClient" },
+        { 0x420360, "SMSG_SURVEY_DELIVERED", "ServerToClient" },
+        { 0x490004, "SMSG_SUSPEND_COMMS", "ServerToClient" },
+        { 0x420040, "SMSG_SUSPEND_TOKEN", "ServerToClient" },
+        { 0x4202FC, "SMSG_SYNC_WOW_ENTITLEMENTS", "ServerToClient" },
+        { 0x4201C1, "SMSG_TALENTS_INVOLUNTARILY_RESET", "ServerToClient" },
+        { 0x420126, "SMSG_TAXI_NODE_STATUS", "ServerToClient" },
+        { 0x420124, "SMSG_TEXT_EMOTE", "ServerToClient" },
+        { 0x420186, "SMSG_THREAT_CLEAR", "ServerToClient" },
+        { 0x420185, "SMSG_THREAT_REMOVE", "ServerToClient" },
+        { 0x420184, "SMSG_THREAT_UPDATE", "ServerToClient" },
+        { 0x5A0001, "SMSG_TIME_ADJUSTMENT", "ServerToClient" },
+        { 0x420359, "SMSG_TIMERUNNING_SEASON_ENDED", "ServerToClient" },
+        { 0x5A0000, "SMSG_TIME_SYNC_REQUEST", "ServerToClient" },
+        { 0x420181, "SMSG_TITLE_EARNED", "ServerToClient" },
+        { 0x420182, "SMSG_TITLE_LOST", "ServerToClient" },
+        { 0x420171, "SMSG_TOTEM_CREATED", "ServerToClient" },
+        { 0x420173, "SMSG_TOTEM_DURATION_CHANGED", "ServerToClient" },
+        { 0x420174, "SMSG_TOTEM_MOVED", "ServerToClient" },
+        { 0x420172, "SMSG_TOTEM_REMOVED", "ServerToClient" },
+        { 0x420017, "SMSG_TRADE_STATUS", "ServerToClient" },
+        { 0x420016, "SMSG_TRADE_UPDATED", "ServerToClient" },
+        { 0x420189, "SMSG_TRAINER_BUY_FAILED", "ServerToClient" },
+        { 0x420188, "SMSG_TRAINER_LIST", "ServerToClient" },
+        { 0x420074, "SMSG_TRAIT_CONFIG_COMMIT_FAILED", "ServerToClient" },
+        { 0x4201AC, "SMSG_TRANSFER_ABORTED", "ServerToClient" },
+        { 0x420070, "SMSG_TRANSFER_PENDING", "ServerToClient" },
+        { 0x42004B, "SMSG_TRANSMOG_OUTFIT_INFO_UPDATED", "ServerToClient" },
+        { 0x42004A, "SMSG_TRANSMOG_OUTFIT_NEW_ENTRY_ADDED", "ServerToClient" },
+        { 0x42004C, "SMSG_TRANSMOG_OUTFIT_SITUATIONS_UPDATED", "ServerToClient" },
+        { 0x42004D, "SMSG_TRANSMOG_OUTFIT_SLOTS_UPDATED", "ServerToClient" },
+        { 0x460011, "SMSG_TREASURE_PICKER_RESPONSE", "ServerToClient" },
+        { 0x420379, "SMSG_TREASURE_PUNCH_LIST_ITEMS_RESPONSE", "ServerToClient" },
+        { 0x420272, "SMSG_TRIGGER_CINEMATIC", "ServerToClient" },
+        { 0x420175, "SMSG_TRIGGER_MOVIE", "ServerToClient" },
+        { 0x4201F6, "SMSG_TURN_IN_PETITION_RESULT", "ServerToClient" },
+        { 0x420266, "SMSG_TUTORIAL_FLAGS", "ServerToClient" },
+        { 0x420212, "SMSG_UI_ACTION", "ServerToClient" },
+        { 0x600023, "SMSG_UI_MAP_QUEST_LINES_RESPONSE", "ServerToClient" },
+        { 0x420273, "SMSG_UNDELETE_CHARACTER_RESPONSE", "ServerToClient" },
+        { 0x420274, "SMSG_UNDELETE_COOLDOWN_STATUS_RESPONSE", "ServerToClient" },
+        { 0x420376, "SMSG_UNIT_DIMINISHING_RETURN_START", "ServerToClient" },
+        { 0x620041, "SMSG_UNLEARNED_SPELLS", "ServerToClient" },
+        { 0x42000E, "SMSG_UNLOAD_CHILD_MAP", "ServerToClient" },
+        { 0x42036C, "SMSG_UNSET_INSTANCE_LEAVER", "ServerToClient" },
+        { 0x420314, "SMSG_UPDATE_AADC_STATUS_RESPONSE", "ServerToClient" },
+        { 0x4201B2, "SMSG_UPDATE_ACCOUNT_DATA", "ServerToClient" },
+        { 0x4201B3, "SMSG_UPDATE_ACCOUNT_DATA_COMPLETE", "ServerToClient" },
+        { 0x420082, "SMSG_UPDATE_ACTION_BUTTONS", "ServerToClient" },
+        { 0x4202CC, "SMSG_UPDATE_BNET_SESSION_KEY", "ServerToClient" },
+        { 0x480007, "SMSG_UPDATE_CAPTURE_POINT", "ServerToClient" },
+        { 0x4202C8, "SMSG_UPDATE_CELESTIAL_BODY", "ServerToClient" },
+        { 0x42026C, "SMSG_UPDATE_CHARACTER_FLAGS", "ServerToClient" },
+        { 0x42020E, "SMSG_UPDATE_CHARGE_CATEGORY_COOLDOWN", "ServerToClient" },
+        { 0x42020D, "SMSG_UPDATE_COOLDOWN", "ServerToClient" },
+        { 0x4C0038, "SMSG_UPDATE_CRAFTING_NPC_RECIPES", "ServerToClient" },
+        { 0x4C0021, "SMSG_UPDATE_DAILY_MISSION_COUNTER", "ServerToClient" },
+        { 0x4200EE, "SMSG_UPDATE_EXPANSION_LEVEL", "ServerToClient" },
+        { 0x4202CF, "SMSG_UPDATE_GAME_TIME_STATE", "ServerToClient" },
+        { 0x420153, "SMSG_UPDATE_INSTANCE_OWNERSHIP", "ServerToClient" },
+        { 0x420132, "SMSG_UPDATE_LAST_INSTANCE", "ServerToClient" },
+        { 0x580000, "SMSG_UPDATE_OBJECT", "ServerToClient" },
+        { 0x42007A, "SMSG_UPDATE_PRIMARY_SPEC", "ServerToClient" },
+        { 0x420097, "SMSG_UPDATE_RECENT_PLAYER_GUIDS", "ServerToClient" },
+        { 0x420079, "SMSG_UPDATE_TALENT_DATA", "ServerToClient" },
+        { 0x4201F0, "SMSG_UPDATE_WORLD_STATE", "ServerToClient" },
+        { 0x4201F7, "SMSG_USE_EQUIPMENT_SET_RESULT", "ServerToClient" },
+        { 0x47000F, "SMSG_USERLIST_ADD", "ServerToClient" },
+        { 0x470010, "SMSG_USERLIST_REMOVE", "ServerToClient" },
+        { 0x470011, "SMSG_USERLIST_UPDATE", "ServerToClient" },
+        { 0x4202C3, "SMSG_VAS_CHECK_TRANSFER_OK_RESPONSE", "ServerToClient" },
+        { 0x4202C1, "SMSG_VAS_GET_QUEUE_MINUTES_RESPONSE", "ServerToClient" },
+        { 0x4202C0, "SMSG_VAS_GET_SERVICE_STATUS_RESPONSE", "ServerToClient" },
+        { 0x42029A, "SMSG_VAS_PURCHASE_COMPLETE", "ServerToClient" },
+        { 0x420299, "SMSG_VAS_PURCHASE_STATE_UPDATE", "ServerToClient" },
+        { 0x42005B, "SMSG_VENDOR_INVENTORY", "ServerToClient" },
+        { 0x5F0011, "SMSG_VIGNETTE_UPDATE", "ServerToClient" },
+        { 0x4202C7, "SMSG_VOICE_CHANNEL_INFO_RESPONSE", "ServerToClient" },
+        { 0x42030F, "SMSG_VOICE_CHANNEL_STT_TOKEN_RESPONSE", "ServerToClient" },
+        { 0x4202C6, "SMSG_VOICE_LOGIN_RESPONSE", "ServerToClient" },
+        { 0x630004, "SMSG_VOID_ITEM_SWAP_RESPONSE", "ServerToClient" },
+        { 0x630001, "SMSG_VOID_STORAGE_CONTENTS", "ServerToClient" },
+        { 0x630000, "SMSG_VOID_STORAGE_FAILED", "ServerToClient" },
+        { 0x630002, "SMSG_VOID_STORAGE_TRANSFER_CHANGES", "ServerToClient" },
+        { 0x630003, "SMSG_VOID_TRANSFER_RESULT", "ServerToClient" },
+        { 0x420003, "SMSG_WAIT_QUEUE_FINISH", "ServerToClient" },
+        { 0x420002, "SMSG_WAIT_QUEUE_UPDATE", "ServerToClient" },
+        { 0x650000, "SMSG_WALK_IN_RESULT", "ServerToClient" },
+        { 0x42000B, "SMSG_WARDEN3_DATA", "ServerToClient" },
+        { 0x4202CA, "SMSG_WARDEN3_DISABLED", "ServerToClient" },
+        { 0x4202C9, "SMSG_WARDEN3_ENABLED", "ServerToClient" },
+        { 0x420206, "SMSG_WARFRONT_COMPLETE", "ServerToClient" },
+        { 0x480012, "SMSG_WARGAME_REQUEST_OPPONENT_RESPONSE", "ServerToClient" },
+        { 0x480011, "SMSG_WARGAME_REQUEST_SUCCESSFULLY_SENT_TO_OPPONENT", "ServerToClient" },
+        { 0x420150, "SMSG_WEATHER", "ServerToClient" },
+        { 0x420306, "SMSG_WEEKLY_REWARD_CLAIM_RESULT", "ServerToClient" },
+        { 0x420307, "SMSG_WEEKLY_REWARDS_PROGRESS_RESULT", "ServerToClient" },
+        { 0x420305, "SMSG_WEEKLY_REWARDS_RESULT", "ServerToClient" },
+        { 0x470002, "SMSG_WHO", "ServerToClient" },
+        { 0x42014F, "SMSG_WHO_IS", "ServerToClient" },
+        { 0x4202CE, "SMSG_WILL_BE_KICKED_FOR_ADDED_SUBSCRIPTION_TIME", "ServerToClient" },
+        { 0x5F0018, "SMSG_WORLD_QUEST_UPDATE_RESPONSE", "ServerToClient" },
+        { 0x420045, "SMSG_WORLD_SERVER_INFO", "ServerToClient" },
+        { 0x4202FD, "SMSG_WOW_ENTITLEMENT_NOTIFICATION", "ServerToClient" },
+        { 0x420329, "SMSG_WOW_LABS_AREA_SELECTED", "ServerToClient" },
+        { 0x420324, "SMSG_WOW_LABS_NOTIFY_PLAYERS_MATCH_END", "ServerToClient" },
+        { 0x420325, "SMSG_WOW_LABS_NOTIFY_PLAYERS_MATCH_STATE_CHANGED", "ServerToClient" },
+        { 0x420331, "SMSG_WOW_LABS_PARTY_ERROR", "ServerToClient" },
+        { 0x42032A, "SMSG_WOW_LABS_SET_PREDICTION_CIRCLE", "ServerToClient" },
+        { 0x420326, "SMSG_WOW_LABS_SET_WOW_LABS_AREA_ID_RESPONSE", "ServerToClient" },
+        { 0x42033F, "SMSG_XP_AWARDED_FROM_CURRENCY", "ServerToClient" },
+        { 0x42006C, "SMSG_XP_GAIN_ABORTED", "ServerToClient" },
+        { 0x420256, "SMSG_XP_GAIN_ENABLED", "ServerToClient" },
+        { 0x47000B, "SMSG_ZONE_UNDER_ATTACK", "ServerToClient" },
+    };
+}
@@ -1,7 +1,9 @@
 #pragma once
 
 #include "JsonWriter.h"
+#include "FieldSerializers.h"
 #include "../Structures/WorldStateData.h"
+#include "../Structures/FieldDescriptors.h"
 
 using namespace PktParser::V12_0_0_65390::Structures;
 
@@ -6,6 +6,7 @@
 #include "TargetLocation.h"
 
 #include <vector>
+#include <memory_resource>
 
 namespace PktParser::V12_0_0_65390::Structures
 {
@@ -76,31 +77,36 @@ namespace PktParser::V12_0_0_65390::Structures
 
 	struct SpellCastData
 	{
-		WowGuid128 CasterGUID;
-		WowGuid128 CasterUnit;
-		WowGuid128 CastID;
-		WowGuid128 OriginalCastID;
-
-		SpellCastFixedData FixedData;
-		WowGuid128 BeaconGUID;
-		SpellHealPrediction HealPrediction;
-
-		uint32 HitTargetsCount;
-		uint32 MissTargetsCount;
-		uint32 HitStatusCount;
-		uint32 MissStatusCount;
-		uint32 RemainingPowerCount;
-		bool HasRuneData;
-		uint32 TargetPointsCount;
-
-		SpellTargetData TargetData;
-		std::vector<WowGuid128> HitTargets;
-		std::vector<WowGuid128> MissTargets;
-		std::vector<SpellHitStatus> HitStatus;
-		std::vector<SpellMissStatus> MissStatus;
-		std::vector<SpellPowerData> RemainingPower;
-		RuneData Runes;
-		std::vector<uint8> RuneCooldowns;
-		std::vector<TargetLocation> TargetPoints;
+		// the arrays live in resource, the worker's packet arena during a batch
+		explicit SpellCastData(std::pmr::memory_resource* resource = std::pmr::get_default_resource())
+			: HitTargets{ resource }, MissTargets{ resource }, HitStatus{ resource }, MissStatus{ resource },
+			RemainingPower{ resource }, RuneCooldowns{ resource }, TargetPoints{ resource } {}
+
+		WowGuid128 CasterGUID{};
+		WowGuid128 CasterUnit{};
+		WowGuid128 CastID{};
+		WowGuid128 OriginalCastID{};
+
+		SpellCastFixedData FixedData{};
+		WowGuid128 BeaconGUID{};
+		SpellHealPrediction HealPrediction{};
+
+		uint32 HitTargetsCount{};
+		uint32 MissTargetsCount{};
+		uint32 HitStatusCount{};
+		uint32 MissStatusCount{};
+		uint32 RemainingPowerCount{};
+		bool HasRuneData{};
+		uint32 TargetPointsCount{};
+
+		SpellTargetData TargetData{};
+		std::pmr::vector<WowGuid128> HitTargets;
+		std::pmr::vector<WowGuid128> MissTargets;
+		std::pmr::vector<SpellHitStatus> HitStatus;
+		std::pmr::vector<SpellMissStatus> MissStatus;
+		std::pmr::vector<SpellPowerData> RemainingPower;
+		RuneData Runes{};
+		std::pmr::vector<uint8> RuneCooldowns;
+		std::pmr::vector<TargetLocation> TargetPoints;
 	};
 }
@@ -5,6 +5,11 @@
 namespace PktParser::Reader
 {
 	std::string BitReader::ReadWoWString(uint32 len /*= 0*/)
+	{
+		return std::string(ReadWoWStringView(len));
+	}
+
+	std::string_view BitReader::ReadWoWStringView(uint32 len /*= 0*/)
 	{
 		if (len == 0)
 			return {};
@@ -13,7 +18,7 @@ namespace PktParser::Reader
 		Skip(len);
 		uint8 const* newEnd = std::find(ptr, ptr + len, 0);
 
-		return std::string(reinterpret_cast<char const*>(ptr), newEnd - ptr);
+		return std::string_view(reinterpret_cast<char const*>(ptr), newEnd - ptr);
 	}
 
 	uint32 BitReader::ReadBits(uint8 numBits)
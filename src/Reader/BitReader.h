@@ -6,6 +6,7 @@
 
 #include <vector>
 #include <string>
+#include <string_view>
 #include <cstring>
 
 namespace PktParser::Reader
@@ -142,6 +143,8 @@ namespace PktParser::Reader
 		}
 
 		std::string ReadWoWString(uint32 len = 0);
+		// same bytes as ReadWoWString, as a view into the packet buffer
+		std::string_view ReadWoWStringView(uint32 len = 0);
 		uint32 ReadBits(uint8 numBits);
 
 		size_t GetBytePosition() const { return _bytePos; }
@@ -171,8 +174,8 @@ namespace PktParser::Reader
 			return result;
 		}
 
-		template<typename T>
-		inline void ReadChunkArray(std::vector<T>& out, size_t count)
+		template<typename T, typename Alloc>
+		inline void ReadChunkArray(std::vector<T, Alloc>& out, size_t count)
 		{
 			static_assert(std::is_trivially_copyable_v<T>, "T mult be trivially copyable");
 			ResetBitReader();
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <span>
+#include <vector>
+
+#include "Misc/Define.h"
+#include "PktFileReader.h"
+
+namespace PktParser::Reader
+{
+	// a run of packets whose payloads share one slab, cleared and refilled instead of freed
+	class PacketBatch
+	{
+	private:
+		std::vector<Pkt> _packets;
+		std::vector<uint8> _slab;
+		size_t _used;
+
+	public:
+		PacketBatch(size_t packets, size_t slabBytes)
+			: _used{ 0 }
+		{
+			_packets.reserve(packets);
+			_slab.resize(slabBytes);
+		}
+
+		PacketBatch(PacketBatch const&) = delete;
+		PacketBatch& operator=(PacketBatch const&) = delete;
+
+		// returns where the payload goes, earlier packets are rebased if the slab has to grow
+		uint8* Append(PktHeader const& header, uint32 pktNumber, size_t size)
+		{
+			if (_used + size > _slab.size())
+			{
+				// grows once and keeps the capacity for every later fill, packets already in move with it
+				uint8 const* oldBase = _slab.data();
+				_slab.resize(std::max(_slab.size() * 2, _used + size));
+				for (Pkt& pkt : _packets)
+					pkt.data = std::span<uint8 const>(_slab.data() + (pkt.data.data() - oldBase), pkt.data.size());
+			}
+
+			uint8* dst = _slab.data() + _used;
+			_packets.emplace_back(header, std::span<uint8 const>(dst, size), pktNumber);
+			_used += size;
+			return dst;
+		}
+
+		void Clear()
+		{
+			_packets.clear();
+			_used = 0;
+		}
+
+		bool IsEmpty() const { return _packets.empty(); }
+		size_t GetCount() const { return _packets.size(); }
+		size_t GetBytes() const { return _used; }
+		std::vector<Pkt> const& GetPackets() const { return _packets; }
+	};
+}
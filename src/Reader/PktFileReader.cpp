@@ -1,5 +1,6 @@
 #include "pchdef.h"
 #include "PktFileReader.h"
+#include "PacketBatch.h"
 
 #include <fcntl.h>
 #include <unistd.h>
@@ -79,43 +80,63 @@ namespace PktParser::Reader
 			Skip(additionalLength);
 	}
 
-	std::optional<Pkt> PktFileReader::ReadNextPacket()
+	bool PktFileReader::ReadNextPacket(PacketBatch& batch)
 	{
 		if (AtEnd())
-        	return std::nullopt;
+        	return false;
 
 		try
 		{
 			PktHeader header = ParsePacketHeader();
 
-			if (_position + header.packetLength > _fileSize)
-            	return std::nullopt;
+			size_t length = static_cast<size_t>(header.packetLength);
+			if (header.packetLength < 0 || _position + length > _fileSize)
+            	return false;
 
-			std::vector<uint8> pktData(header.packetLength);
-			ReadInto(pktData.data(), header.packetLength);
-
-			if (header.packetLength >= 4)
-				header.opcode = static_cast<uint32>(pktData[0])
-					| (static_cast<uint32>(pktData[1]) << 8)
-					| (static_cast<uint32>(pktData[2]) << 16)
-					| (static_cast<uint32>(pktData[3]) << 24);
+			uint8 const* src = _mappedData + _position;
+			if (length >= 4)
+				header.opcode = static_cast<uint32>(src[0])
+					| (static_cast<uint32>(src[1]) << 8)
+					| (static_cast<uint32>(src[2]) << 16)
+					| (static_cast<uint32>(src[3]) << 24);
 			else
 				header.opcode = 0;
-			
-			Pkt pkt{ header, std::move(pktData) };
-			pkt.pktNumber = _pktNumber;
+
+			ReadInto(batch.Append(header, _pktNumber, length), length);
 			_pktNumber++;
-			return pkt;
+			return true;
 		}
 		catch (ParseException const&)
 		{
-			return std::nullopt;
+			return false;
 		}
 		catch (std::exception const& e)
 		{
 			LOG("Unexpected error reading packet {}: {}", _pktNumber, e.what());
-			return std::nullopt;
+			return false;
+		}
+	}
+
+	uint32 PktFileReader::SkipPackets(uint32 count)
+	{
+		uint32 skipped = 0;
+		try
+		{
+			while (skipped < count && !AtEnd())
+			{
+				PktHeader header = ParsePacketHeader();
+				if (header.packetLength < 0 || _position + static_cast<size_t>(header.packetLength) > _fileSize)
+					break;
+
+				_position += static_cast<size_t>(header.packetLength);
+				_pktNumber++;
+				skipped++;
+			}
+		}
+		catch (ParseException const&)
+		{
 		}
+		return skipped;
 	}
 
 	PktHeader PktFileReader::ParsePacketHeader()
@@ -1,8 +1,7 @@
 #pragma once
 
 #include <string>
-#include <vector>
-#include <optional>
+#include <span>
 #include <cstring>
 
 #include "Misc/Define.h"
@@ -35,11 +34,13 @@ namespace PktParser::Reader
 	struct Pkt
 	{
 		PktHeader header;
-		std::vector<uint8> data;
+		std::span<uint8 const> data;     // owned by the PacketBatch it was read into
 		uint32 pktNumber{};
 		BitReader CreateReader() const { return BitReader(data.data(), data.size()); }
 	};
 
+	class PacketBatch;
+
 	class PktFileReader
 	{
 	private:
@@ -60,7 +61,10 @@ namespace PktParser::Reader
 		PktFileReader& operator=(PktFileReader const&) = delete;
 
 		void ParseFileHeader();
-		std::optional<Pkt> ReadNextPacket();
+		// appends the next packet to the batch, false at the end of the file
+		bool ReadNextPacket(PacketBatch& batch);
+		// steps over packets without copying them, returns how many there were
+		uint32 SkipPackets(uint32 count);
 
 		PktFileHeader const& GetFileHeader() const { return _fileHeader; }
 		uint32 GetBuildVersion() const { return _fileHeader.clientBuild; }
@@ -68,6 +72,7 @@ namespace PktParser::Reader
 		bool IsOpen() const { return _mappedData != nullptr; }
 		std::string const& GetFilePath() const { return _filepath; }
 		size_t GetFileSize() const { return _fileSize; }
+		std::span<uint8 const> GetContents() const { return std::span<uint8 const>(_mappedData, _fileSize); }
 		uint32 GetStartTime() const { return _fileHeader.startTime; }
 
 	private:
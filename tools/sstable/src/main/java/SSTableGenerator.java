@@ -2,6 +2,7 @@ import org.apache.cassandra.io.sstable.CQLSSTableWriter;
 import java.io.*;
 import java.util.Base64;
 import java.nio.ByteBuffer;
+import java.util.Arrays;
 import java.util.UUID;
 
 public class SSTableGenerator
@@ -23,70 +24,166 @@ public class SSTableGenerator
         + "(build, file_id, bucket, packet_number, direction, packet_len, opcode, timestamp, pkt_json) "
         + "VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?)";
 
-    static void ProcessCSVs(String csvDir, String outputDir) throws Exception
+    // STORAGE_LAYOUT=block output (csv/blocks_thread_N.csv)
+    static final String BLOCK_SCHEMA = "CREATE TABLE wow_packets.packet_blocks ("
+        + "build int, "
+        + "file_id uuid, "
+        + "bucket int, "
+        + "block_start int, "
+        + "packet_count int, "
+        + "block blob, "
+        + "PRIMARY KEY ((build, file_id, bucket), block_start)"
+        + ") WITH CLUSTERING ORDER BY (block_start ASC)";
+
+    static final String BLOCK_INSERT = "INSERT INTO wow_packets.packet_blocks "
+        + "(build, file_id, bucket, block_start, packet_count, block) "
+        + "VALUES (?, ?, ?, ?, ?, ?)";
+
+    // csv/packets_thread_N_M.rows, written by SortedRowWriter
+    static final byte[] ROWS_MAGIC = { 'P', 'K', 'T', 'R', 'O', 'W', 'S' };
+    static final int ROWS_VERSION = 1;
+
+    static final int[] Totals = new int[2];
+
+    static Object[] BlockRow(String[] cols)
+    {
+        return new Object[] {
+            Integer.parseInt(cols[0]),
+            UUID.fromString(cols[1]),
+            Integer.parseInt(cols[2]),
+            Integer.parseInt(cols[3]),
+            Integer.parseInt(cols[4]),
+            ByteBuffer.wrap(Base64.getDecoder().decode(cols[5]))
+        };
+    }
+
+    interface RowParser
+    {
+        Object[] Parse(String[] cols);
+    }
+
+    static void WriteTable(File[] csvFiles, String outDir, String schema, String insert, int columns, RowParser parser) throws Exception
     {
-        String outDir = outputDir + "/wow_packets/packets";
+        if (csvFiles == null || csvFiles.length == 0)
+            return;
+
         new File(outDir).mkdirs();
 
         CQLSSTableWriter writer = CQLSSTableWriter.builder()
             .inDirectory(outDir)
-            .forTable(SCHEMA)
-            .using(INSERT)
+            .forTable(schema)
+            .using(insert)
             .withMaxSSTableSizeInMiB(256)
             .build();
 
-        int totalRows = 0;
-        int skippedRows = 0;
-
-        File[] csvFiles = new File(csvDir).listFiles((d, name) -> name.endsWith(".csv"));
-        if (csvFiles != null)
+        for (File csvFile : csvFiles)
         {
-            for (File csvFile : csvFiles)
-            {
-                System.err.println("Processing: " + csvFile.getName());
-                int lineNum = 0;
+            System.err.println("Processing: " + csvFile.getName());
+            int lineNum = 0;
 
-                try (BufferedReader br = new BufferedReader(new FileReader(csvFile)))
+            try (BufferedReader br = new BufferedReader(new FileReader(csvFile)))
+            {
+                String line;
+                while ((line = br.readLine()) != null)
                 {
-                    String line;
-                    while ((line = br.readLine()) != null)
+                    lineNum++;
+                    try
                     {
-                        lineNum++;
-                        try
-                        {
-                            String[] cols = line.split(",", 9);
-                            if (cols.length < 9 || cols[8].isEmpty())
-                            {
-                                System.err.println("WARN: Skipping malformed line " + lineNum + " in " + csvFile.getName());
-                                skippedRows++;
-                                continue;
-                            }
-
-                            writer.addRow(
-                                Integer.parseInt(cols[0]),
-                                UUID.fromString(cols[1]),
-                                Integer.parseInt(cols[2]),
-                                Integer.parseInt(cols[3]),
-                                Byte.parseByte(cols[4]),
-                                Integer.parseInt(cols[5]),
-                                Integer.parseInt(cols[6]),
-                                Long.parseLong(cols[7]),
-                                ByteBuffer.wrap(Base64.getDecoder().decode(cols[8]))
-                            );
-                            totalRows++;
-                        }
-                        catch (Exception e)
+                        String[] cols = line.split(",", columns);
+                        if (cols.length < columns || cols[columns - 1].isEmpty())
                         {
-                            System.err.println("WARN: Skipping bad line " + lineNum + " in " + csvFile.getName() + ": " + e.getMessage());
-                            skippedRows++;
+                            System.err.println("WARN: Skipping malformed line " + lineNum + " in " + csvFile.getName());
+                            Totals[1]++;
+                            continue;
                         }
+
+                        writer.addRow(parser.Parse(cols));
+                        Totals[0]++;
+                    }
+                    catch (Exception e)
+                    {
+                        System.err.println("WARN: Skipping bad line " + lineNum + " in " + csvFile.getName() + ": " + e.getMessage());
+                        Totals[1]++;
                     }
                 }
             }
         }
 
         writer.close();
-        System.err.println("SSTables written: " + totalRows + " rows, " + skippedRows + " skipped");
+    }
+
+    // rows already come in token / clustering order, so each run is streamed straight into its own sstable
+    static void WriteSortedRuns(File[] runFiles, String outDir) throws Exception
+    {
+        if (runFiles == null || runFiles.length == 0)
+            return;
+
+        new File(outDir).mkdirs();
+
+        for (File runFile : runFiles)
+        {
+            System.err.println("Processing: " + runFile.getName());
+
+            CQLSSTableWriter writer = CQLSSTableWriter.builder()
+                .inDirectory(outDir)
+                .forTable(SCHEMA)
+                .using(INSERT)
+                .sorted()
+                .build();
+
+            try (DataInputStream in = new DataInputStream(new BufferedInputStream(new FileInputStream(runFile), 4 << 20)))
+            {
+                byte[] magic = new byte[ROWS_MAGIC.length];
+                in.readFully(magic);
+                int version = in.readUnsignedByte();
+                if (!Arrays.equals(magic, ROWS_MAGIC) || version != ROWS_VERSION)
+                    throw new IOException(runFile.getName() + " is not a version " + ROWS_VERSION + " row file");
+
+                while (true)
+                {
+                    int build;
+                    try
+                    {
+                        build = in.readInt();
+                    }
+                    catch (EOFException e)
+                    {
+                        break;
+                    }
+
+                    UUID fileId = new UUID(in.readLong(), in.readLong());
+                    int bucket = in.readInt();
+                    int packetNumber = in.readInt();
+                    byte direction = in.readByte();
+                    int packetLen = in.readInt();
+                    int opcode = in.readInt();
+                    long timestamp = in.readLong();
+                    byte[] blob = new byte[in.readInt()];
+                    in.readFully(blob);
+
+                    writer.addRow(build, fileId, bucket, packetNumber, direction, packetLen, opcode, timestamp, ByteBuffer.wrap(blob));
+                    Totals[0]++;
+                }
+            }
+            finally
+            {
+                writer.close();
+            }
+        }
+    }
+
+    static void ProcessCSVs(String csvDir, String outputDir) throws Exception
+    {
+        Totals[0] = 0;
+        Totals[1] = 0;
+
+        File[] packetRuns = new File(csvDir).listFiles((d, name) -> name.endsWith(".rows"));
+        File[] blockFiles = new File(csvDir).listFiles((d, name) -> name.endsWith(".csv") && name.startsWith("blocks_"));
+
+        WriteSortedRuns(packetRuns, outputDir + "/wow_packets/packets");
+        WriteTable(blockFiles, outputDir + "/wow_packets/packet_blocks", BLOCK_SCHEMA, BLOCK_INSERT, 6, SSTableGenerator::BlockRow);
+
+        System.err.println("SSTables written: " + Totals[0] + " rows, " + Totals[1] + " skipped");
     }
 
     public static void main(String[] args) throws Exception
@@ -115,7 +212,7 @@ public class SSTableGenerator
                 if (parts.length != 2)
                 {
                     System.err.println("Bad input: " + line);
-                    System.out.println(">>ERROR: expected <csv_dir> <output_dir><<");
+                    System.out.println(">>ERROR: expected <export_dir> <output_dir><<");
                     System.out.flush();
                     continue;
                 }
@@ -136,6 +233,6 @@ public class SSTableGenerator
             return;
         }
 
-        System.err.println("Usage: java -jar sstable.jar <csv_dir> <output_dir> | --daemon");
+        System.err.println("Usage: java -jar sstable.jar <export_dir> <output_dir> | --daemon");
     }
 }
\ No newline at end of file